@@ -0,0 +1,161 @@
+#include <array>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Containers>
+#include <module/sys.Threading>
+
+namespace
+{
+    constexpr size_t transferred = 1uz << 16uz;
+
+    // The baseline the lock-free queues replace.
+    template <typename T, size_t Capacity>
+    class locked_queue
+    {
+        sys::mutex mut;
+        sys::inplace_queue<T, Capacity> queue;
+    public:
+        bool enqueue(const T& item)
+        {
+            const sys::mutex::guard g = this->mut.lock().expect();
+            return this->queue.enqueue(item);
+        }
+        bool try_dequeue(T& out)
+        {
+            const sys::mutex::guard g = this->mut.lock().expect();
+            return this->queue.try_dequeue(out);
+        }
+    };
+
+    // Move `transferred` items through `queue` from `producers` threads to `consumers` threads.
+    template <typename Queue>
+    size_t transfer(Queue& queue, const size_t producers, const size_t consumers)
+    {
+        std::atomic<size_t> sum = 0uz;
+        std::vector<sys::managed_thread> threads;
+        threads.reserve(producers + consumers);
+
+        for (size_t i = 0uz; i < producers; i++)
+        {
+            threads.push_back(sys::managed_thread::ctor([&queue, count = transferred / producers]() -> void
+            {
+                for (size_t j = 0uz; j < count; j++)
+                {
+                    while (!queue.enqueue(j))
+                        sys::thread_yield();
+                }
+            }).expect());
+        }
+        for (size_t i = 0uz; i < consumers; i++)
+        {
+            threads.push_back(sys::managed_thread::ctor([&queue, &sum, count = transferred / consumers]() -> void
+            {
+                size_t local = 0uz;
+                for (size_t j = 0uz; j < count; j++)
+                {
+                    size_t item = 0uz;
+                    while (!queue.try_dequeue(item))
+                        sys::thread_yield();
+                    local += item;
+                }
+                sum.fetch_add(local, std::memory_order_relaxed);
+            }).expect());
+        }
+
+        for (sys::managed_thread& t : threads)
+            (void)t.join().expect();
+        return sum.load();
+    }
+} // namespace
+
+TEST_CASE("queue, single thread", "[sys.Containers][inplace_queue][inplace_vector][!benchmark]")
+{
+    constexpr size_t batch = 64uz;
+
+    BENCHMARK("sys::inplace_queue<...>")
+    {
+        sys::inplace_queue<size_t, batch> queue;
+        size_t sum = 0uz;
+        for (size_t i = 0uz; i < batch; i++)
+            (void)queue.enqueue(i);
+        for (size_t out = 0uz; queue.try_dequeue(out);)
+            sum += out;
+        return sum;
+    };
+    BENCHMARK("std::deque<...>")
+    {
+        std::deque<size_t> queue;
+        size_t sum = 0uz;
+        for (size_t i = 0uz; i < batch; i++)
+            queue.push_back(i);
+        for (; !queue.empty(); queue.pop_front())
+            sum += queue.front();
+        return sum;
+    };
+    BENCHMARK("sys::inplace_vector<...>")
+    {
+        sys::inplace_vector<size_t, batch> vec;
+        for (size_t i = 0uz; i < batch; i++)
+            (void)vec.push_back(i);
+        for (size_t i = 0uz; i < batch; i++)
+            vec.pop_back();
+        return vec.size();
+    };
+    BENCHMARK("std::vector<...>")
+    {
+        std::vector<size_t> vec;
+        for (size_t i = 0uz; i < batch; i++)
+            vec.push_back(i);
+        for (size_t i = 0uz; i < batch; i++)
+            vec.pop_back();
+        return vec.size();
+    };
+}
+
+TEST_CASE("queue, one producer, one consumer", "[sys.Containers][inplace_spsc_queue][!benchmark]")
+{
+    BENCHMARK_ADVANCED("sys::inplace_spsc_queue<...>")(Catch::Benchmark::Chronometer meter)
+    {
+        sys::inplace_spsc_queue<size_t, 1024uz> queue;
+        meter.measure([&queue]() -> size_t { return transfer(queue, 1uz, 1uz); });
+    };
+    BENCHMARK_ADVANCED("sys::inplace_mpmc_queue<...>")(Catch::Benchmark::Chronometer meter)
+    {
+        sys::inplace_mpmc_queue<size_t, 1024uz> queue;
+        meter.measure([&queue]() -> size_t { return transfer(queue, 1uz, 1uz); });
+    };
+    BENCHMARK_ADVANCED("sys::inplace_queue<...> behind sys::mutex")(Catch::Benchmark::Chronometer meter)
+    {
+        locked_queue<size_t, 1024uz> queue;
+        meter.measure([&queue]() -> size_t { return transfer(queue, 1uz, 1uz); });
+    };
+}
+
+TEST_CASE("queue, four producers, four consumers", "[sys.Containers][inplace_mpmc_queue][!benchmark]")
+{
+    BENCHMARK_ADVANCED("sys::inplace_mpmc_queue<...>")(Catch::Benchmark::Chronometer meter)
+    {
+        sys::inplace_mpmc_queue<size_t, 1024uz> queue;
+        meter.measure([&queue]() -> size_t { return transfer(queue, 4uz, 4uz); });
+    };
+    BENCHMARK_ADVANCED("sys::inplace_queue<...> behind sys::mutex")(Catch::Benchmark::Chronometer meter)
+    {
+        locked_queue<size_t, 1024uz> queue;
+        meter.measure([&queue]() -> size_t { return transfer(queue, 4uz, 4uz); });
+    };
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
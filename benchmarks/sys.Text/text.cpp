@@ -0,0 +1,368 @@
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+namespace
+{
+    constexpr size_t repeats = 256uz;
+
+    sys::str repeated(const std::u8string_view text)
+    {
+        std::u8string ret;
+        ret.reserve(text.size() * repeats);
+        for (size_t i = 0uz; i < repeats; i++)
+            ret.append(text);
+        return ret;
+    }
+
+    // Pure ASCII, which takes the vectorized paths, and text with a code unit outside ASCII every few characters, which doesn't.
+    const sys::str ascii = repeated(u8"The quick brown fox jumps over the lazy dog, 0123456789. ");
+    const sys::str mixed = repeated(u8"Größe Ωμέγα ΟΔΥΣΣΕΥΣ İstanbul 東京都 café naïve Ærø. ");
+
+    /// Counts the allocations passed through to the heap.
+    class counting_resource final : public std::pmr::memory_resource
+    {
+        void* do_allocate(const size_t bytes, const size_t alignment) override
+        {
+            this->allocations++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t alignment) override { std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment); }
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    public:
+        size_t allocations = 0uz;
+    };
+
+    // A typical parsing pipeline, each record split into fields, which are trimmed and lowercased, every string allocated from `resource`.
+    size_t parse_records(const sys::str& text, std::pmr::memory_resource* const resource)
+    {
+        size_t ret = 0uz;
+        for (const std::u8string_view line : text.split_view(u8'\n'))
+        {
+            const sys::pmr::str record(line, resource);
+            for (const sys::pmr::str& field : record.split(u8','))
+                ret += field.trimmed().lowered().size();
+        }
+        return ret;
+    }
+    size_t parse_records_inline(const sys::str& text, std::pmr::memory_resource* const upstream)
+    {
+        size_t ret = 0uz;
+        for (const std::u8string_view line : text.split_view(u8'\n'))
+        {
+            sys::inline_buffer_resource<1024uz> arena(upstream);
+            const sys::pmr::str record(line, &arena);
+            for (const sys::pmr::str& field : record.split(u8','))
+                ret += field.trimmed().lowered().size();
+        }
+        return ret;
+    }
+} // namespace
+
+TEST_CASE("transcoding", "[sys.Text][string][!benchmark]")
+{
+    const sys::str16 ascii16(ascii);
+    const sys::str16 mixed16(mixed);
+
+    BENCHMARK("UTF-8 -> UTF-16, ASCII") { return sys::str16(ascii); };
+    BENCHMARK("UTF-8 -> UTF-16, mixed") { return sys::str16(mixed); };
+    BENCHMARK("UTF-8 -> UTF-32, ASCII") { return sys::str32(ascii); };
+    BENCHMARK("UTF-8 -> UTF-32, mixed") { return sys::str32(mixed); };
+    BENCHMARK("UTF-16 -> UTF-8, ASCII") { return sys::str(ascii16); };
+    BENCHMARK("UTF-16 -> UTF-8, mixed") { return sys::str(mixed16); };
+
+    std::u16string buffer(mixed.transcoded_length<char16_t>(), u'\0');
+    BENCHMARK("sys::string<...>::transcoded_length<char16_t>(), mixed") { return mixed.transcoded_length<char16_t>(); };
+    BENCHMARK("sys::string<...>::transcode_into(...), UTF-8 -> UTF-16, mixed") { return mixed.transcode_into(std::span<char16_t>(buffer)); };
+}
+
+TEST_CASE("formatting", "[sys.Text][string][format][!benchmark]")
+{
+    const sys::str16 mixed16(mixed);
+    const sys::str32 mixed32(mixed);
+    const sys::str name(u8"Größe");
+    const sys::str16 name16(u"Ωμέγα");
+
+    BENCHMARK("std::format(\"{}\", ...), UTF-8, mixed") { return std::format("{}", mixed); };
+    BENCHMARK("std::format(\"{}\", ...), UTF-16, mixed") { return std::format("{}", mixed16); };
+    BENCHMARK("std::format(\"{}\", ...), UTF-32, mixed") { return std::format("{}", mixed32); };
+    BENCHMARK("std::format(L\"{}\", ...), UTF-8, mixed") { return std::format(L"{}", mixed); };
+    BENCHMARK("std::format(\"{:.100}\", ...), UTF-16, mixed") { return std::format("{:.100}", mixed16); };
+
+    // Many short fields of differing encodings into one line, as in logging.
+    BENCHMARK("std::format(...), short mixed fields")
+    {
+        return std::format("{:<8}|{:>8}|{:^{}}|{}", name, name16, sys::str32(U"東京"), 6, sys::cstr("ascii"));
+    };
+}
+
+TEST_CASE("streaming decoding", "[sys.Text][utf_decoder][!benchmark]")
+{
+    // Mixed text as it might arrive from a socket or file, in chunks splitting sequences wherever they fall.
+    std::u8string stream;
+    while (stream.size() < (4uz << 20uz) /* NOLINT(readability-magic-numbers) */)
+        stream.append(std::u8string_view(mixed));
+
+    for (const size_t chunkSize : { 4uz << 10uz, 64uz << 10uz, 1uz << 20uz })
+    {
+        std::u32string decoded32;
+        std::u16string decoded16;
+        decoded32.reserve(stream.size());
+        decoded16.reserve(stream.size());
+        const auto decodeAll = [&]<typename To>(std::basic_string<To>& out) -> size_t
+        {
+            out.clear();
+            sys::utf_decoder<char8_t> decoder;
+            for (size_t i = 0uz; i < stream.size(); i += chunkSize)
+                decoder.decode(std::span<const char8_t>(stream).subspan(i, std::min(chunkSize, stream.size() - i)), out);
+            decoder.finish(out);
+            return out.size();
+        };
+
+        BENCHMARK("sys::utf_decoder<char8_t>, UTF-32, chunks of " + std::to_string(chunkSize)) { return decodeAll(decoded32); };
+        BENCHMARK("sys::utf_decoder<char8_t>, UTF-16, chunks of " + std::to_string(chunkSize)) { return decodeAll(decoded16); };
+    }
+}
+
+TEST_CASE("validation", "[sys.Text][string][validation][!benchmark]")
+{
+    // Valid text, text with an invalid byte every few kilobytes, and random bytes, which are mostly invalid.
+    sys::str mostlyValid = mixed;
+    for (sz i = 1000_uz; i < mostlyValid.size(); i += 4096_uz /* NOLINT(readability-magic-numbers) */)
+        mostlyValid[i, unsafe] = char8_t(0xFF);
+    sys::str garbage;
+    uint32_t state = 1u;
+    for (size_t i = 0uz; i < mixed.size(); i++)
+    {
+        state = (state * 1103515245u) + 12345u; // NOLINT(readability-magic-numbers)
+        garbage.append(_as(state >> 24u, char8_t));
+    }
+
+    BENCHMARK("sys::string<...>::is_valid(), ASCII") { return ascii.is_valid(); };
+    BENCHMARK("sys::string<...>::is_valid(), mixed") { return mixed.is_valid(); };
+    BENCHMARK("sys::string<...>::invalids_replaced(), mixed") { return mixed.invalids_replaced(); };
+    BENCHMARK("sys::string<...>::invalids_replaced(), mostly valid") { return mostlyValid.invalids_replaced(); };
+    BENCHMARK("sys::string<...>::invalids_replaced(), garbage") { return garbage.invalids_replaced(); };
+    // Valid text is left in place, so repeatedly replacing in the same string measures only the validation.
+    sys::str valid = mixed;
+    BENCHMARK("sys::string<...>::replace_invalid(), mixed") { return valid.replace_invalid().size(); };
+}
+
+TEST_CASE("codepoint index", "[sys.Text][codepoint_index][!benchmark]")
+{
+    // A document of a few megabytes, as in an editor, and the codepoint under a cursor near its end.
+    sys::str doc;
+    while (doc.size() < (4uz << 20uz) /* NOLINT(readability-magic-numbers) */)
+        doc.append(mixed);
+    const sys::codepoint_index index(doc);
+    const sz cursor = index.codepoint_count() - 1000_uz;
+
+    BENCHMARK("sys::codepoint_index(...)") { return sys::codepoint_index(doc).codepoint_count(); };
+    BENCHMARK("sys::codepoint_index<...>::nth_codepoint(...)") { return index.nth_codepoint(cursor); };
+    BENCHMARK("sys::codepoint_view(...), to the cursor")
+    {
+        auto it = sys::codepoint_view(doc).begin();
+        for (sz i = 0_uz; i < cursor; i++)
+            ++it;
+        return *it;
+    };
+}
+
+TEST_CASE("rope editing", "[sys.Text][rope][!benchmark]")
+{
+    for (const size_t megabytes : { 16uz, 64uz })
+    {
+        std::u8string doc;
+        doc.reserve(megabytes << 20uz);
+        while (doc.size() < megabytes << 20uz)
+            doc.append(std::u8string_view(mixed)).push_back(u8'\n');
+        sys::rope r { std::u8string_view(doc) };
+        const sz codepoints = r.codepoint_count();
+
+        // Pseudorandom positions, each edit an insertion then an erasure, so the size stays the same.
+        uint64_t state = 1u;
+        const auto next = [&state](const size_t bound) -> size_t
+        {
+            state = (state * 6364136223846793005u) + 1442695040888963407u; // NOLINT(readability-magic-numbers)
+            return _as(state >> 33u, size_t) % bound;
+        };
+
+        // `sys::string<T>` has no insertion in the middle, so its storage is edited directly.
+        const std::string size = std::to_string(megabytes) + "MiB";
+        BENCHMARK("std::u8string::insert(...), std::u8string::erase(...), " + size)
+        {
+            const size_t at = next(doc.size());
+            doc.insert(at, u8"inserted");
+            doc.erase(at, 8uz);
+            return doc.size();
+        };
+        BENCHMARK("sys::rope<...>::insert(...), sys::rope<...>::erase(...), " + size)
+        {
+            const sz at = sz(next(*codepoints));
+            r.insert(at, u8"inserted");
+            r.erase(at, 8_uz);
+            return r.size();
+        };
+        BENCHMARK("sys::rope<...>::substr(...), " + size) { return r.substr(sz(next(*codepoints)), 1_uz << 20_uz).size(); };
+        BENCHMARK("sys::rope<...>::line_start(...), " + size) { return r.line_start(sz(next(*r.line_count()))); };
+        BENCHMARK("sys::rope<...>, snapshot, " + size) { return sys::rope<char8_t>(r).size(); };
+    }
+}
+
+TEST_CASE("casing", "[sys.Text][string][ch][!benchmark]")
+{
+    BENCHMARK("sys::string<...>::lowered(), ASCII") { return ascii.lowered(); };
+    BENCHMARK("sys::string<...>::lowered(), mixed") { return mixed.lowered(); };
+    BENCHMARK("sys::string<...>::uppered(), ASCII") { return ascii.uppered(); };
+    BENCHMARK("sys::string<...>::uppered(), mixed") { return mixed.uppered(); };
+    BENCHMARK("sys::string<...>::uppered(...), Turkish") { return mixed.uppered(u8"tr"); };
+    BENCHMARK("sys::string<...>::folded(), mixed") { return mixed.folded(); };
+
+    // The property lookups on their own, over every codepoint of the BMP.
+    BENCHMARK("sys::ch::to_lower(...)")
+    {
+        char32_t acc = 0;
+        for (char32_t c = 0; c < 0x10000; c++) // NOLINT(readability-magic-numbers)
+            acc ^= sys::ch::to_lower(c);
+        return acc;
+    };
+    BENCHMARK("sys::ch::is_whitespace(...)")
+    {
+        size_t count = 0uz;
+        for (char32_t c = 0; c < 0x10000; c++) // NOLINT(readability-magic-numbers)
+            count += sys::ch::is_whitespace(c);
+        return count;
+    };
+}
+
+TEST_CASE("case-insensitive comparison", "[sys.Text][string][fold][!benchmark]")
+{
+    const sys::str asciiUpper = ascii.uppered();
+    const sys::str mixedUpper = mixed.uppered();
+
+    BENCHMARK("sys::string<...>::folded() == ..., ASCII") { return ascii.folded() == asciiUpper.folded(); };
+    BENCHMARK("sys::string<...>::fold_equals(...), ASCII") { return ascii.fold_equals(asciiUpper); };
+    BENCHMARK("sys::string<...>::folded() == ..., mixed") { return mixed.folded() == mixedUpper.folded(); };
+    BENCHMARK("sys::string<...>::fold_equals(...), mixed") { return mixed.fold_equals(mixedUpper); };
+    BENCHMARK("sys::string<...>::fold_hash(), mixed") { return mixed.fold_hash(); };
+
+    // Short keys, as in a map of header names, where allocating per lookup dominates.
+    std::unordered_map<sys::str, int, sys::fold_hasher, sys::fold_equal> headers;
+    std::unordered_map<std::u8string, int> foldedHeaders;
+    for (const std::u8string_view name : { std::u8string_view(u8"Accept"), std::u8string_view(u8"Content-Length"), std::u8string_view(u8"Content-Type"),
+                                           std::u8string_view(u8"Host"), std::u8string_view(u8"User-Agent") })
+    {
+        headers.emplace(sys::str(name), 0);
+        foldedHeaders.emplace(std::u8string_view(sys::str(name).folded()), 0);
+    }
+    const sys::str key = u8"content-TYPE";
+
+    BENCHMARK("lookup, folded key") { return foldedHeaders.find(std::u8string(std::u8string_view(key.folded()))) != foldedHeaders.end(); };
+    BENCHMARK("lookup, sys::fold_hasher, sys::fold_equal") { return headers.find(key) != headers.end(); };
+}
+
+TEST_CASE("normalization", "[sys.Text][string][normalization][!benchmark]")
+{
+    const sys::str decomposed = mixed.normalized(sys::normalization_form::nfd);
+
+    BENCHMARK("sys::string<...>::is_normalized(), ASCII") { return ascii.is_normalized(); };
+    BENCHMARK("sys::string<...>::is_normalized(), mixed") { return mixed.is_normalized(); };
+    BENCHMARK("sys::string<...>::normalized(), mixed") { return mixed.normalized(); };
+    BENCHMARK("sys::string<...>::normalized(), decomposed") { return decomposed.normalized(); };
+    BENCHMARK("sys::string<...>::normalized(nfd), mixed") { return mixed.normalized(sys::normalization_form::nfd); };
+}
+
+TEST_CASE("segmentation", "[sys.Text][string][segmentation][!benchmark]")
+{
+    BENCHMARK("sys::string<...>::grapheme_view(), ASCII") { return std::ranges::distance(ascii.grapheme_view()); };
+    BENCHMARK("sys::string<...>::grapheme_view(), mixed") { return std::ranges::distance(mixed.grapheme_view()); };
+    BENCHMARK("sys::string<...>::word_view(), ASCII") { return std::ranges::distance(ascii.word_view()); };
+    BENCHMARK("sys::string<...>::word_view(), mixed") { return std::ranges::distance(mixed.word_view()); };
+}
+
+TEST_CASE("trimming, splitting", "[sys.Text][string][!benchmark]")
+{
+    sys::str padded(u8' ', 4096_uz /* NOLINT(readability-magic-numbers) */);
+    padded.append(ascii);
+    for (size_t i = 0uz; i < 1024uz /* NOLINT(readability-magic-numbers) */; i++)
+        padded.append(std::u8string_view(u8"　 \t\n"));
+
+    BENCHMARK("sys::string<...>::trimmed()") { return padded.trimmed(); };
+    BENCHMARK("sys::string<...>::end_trimmed(), no trailing whitespace") { return mixed.end_trimmed(); };
+    BENCHMARK("sys::reverse_codepoint_view(...)") { return std::ranges::distance(sys::reverse_codepoint_view(std::u8string_view(mixed))); };
+    BENCHMARK("sys::string<...>::split(...), character") { return ascii.split(u8' '); };
+    BENCHMARK("sys::string<...>::split(...), string") { return mixed.split(std::u8string_view(u8", ")); };
+    BENCHMARK("sys::string<...>::split_view(...), character") { return std::ranges::distance(ascii.split_view(u8' ')); };
+    BENCHMARK("sys::string<...>::split_view(...), string") { return std::ranges::distance(mixed.split_view(std::u8string_view(u8", "))); };
+    BENCHMARK("sys::string<...>::split_view(...), codepoint_set") { return std::ranges::distance(mixed.split_view(sys::codepoint_set(U" ,　"))); };
+}
+
+TEST_CASE("allocation", "[sys.Text][string][allocator][!benchmark]")
+{
+    const sys::str records = repeated(u8"  Customer Name Goes Here , 221B Baker Street London ,  Some Longer Description Field  \n");
+
+    // Strings of a pipeline on the heap, in an arena for the whole text, and in an arena on the stack for each record.
+    counting_resource heap, arenaUpstream, inlineUpstream;
+    std::pmr::monotonic_buffer_resource arena(&arenaUpstream);
+    const size_t parsed = parse_records(records, &heap);
+    CHECK(parse_records(records, &arena) == parsed);
+    CHECK(parse_records_inline(records, &inlineUpstream) == parsed);
+    WARN("Heap allocations per pass, heap: " << heap.allocations << ", arena: " << arenaUpstream.allocations << ", inline buffer: " << inlineUpstream.allocations);
+
+    BENCHMARK("sys::pmr::string<...>, parsing, heap") { return parse_records(records, &heap); };
+    BENCHMARK("sys::pmr::string<...>, parsing, arena")
+    {
+        const size_t ret = parse_records(records, &arena);
+        arena.release();
+        return ret;
+    };
+    BENCHMARK("sys::pmr::string<...>, parsing, inline buffer") { return parse_records_inline(records, &inlineUpstream); };
+}
+
+TEST_CASE("substring search", "[sys.Text][string][string_searcher][!benchmark]")
+{
+    // Natural text, searched for needles of increasing length which only occur at the very end.
+    sys::str text = ascii;
+    text.append(std::u8string_view(u8"Größe Ωμέγα ΟΔΥΣΣΕΥΣ İstanbul 東京都 café naïve Ærø. "));
+    for (const std::u8string_view needle : { std::u8string_view(u8"é n"), std::u8string_view(u8"café naïve"), std::u8string_view(u8"İstanbul 東京都 café naïve Ærø") })
+    {
+        const sys::string_searcher<char8_t> searcher(needle);
+
+        BENCHMARK("std::basic_string_view<...>::find(...), needle of " + std::to_string(needle.size())) { return std::u8string_view(text).find(needle); };
+        BENCHMARK("sys::string_searcher<...>::find(...), needle of " + std::to_string(needle.size())) { return searcher.find(text); };
+    }
+
+    // A single letter, searched for that letter with another in the middle, so every position is a partial match, which is the worst case for naive search.
+    const std::u8string repetitive(1uz << 18uz /* NOLINT(readability-magic-numbers) */, u8'a');
+    for (const size_t length : { 4uz, 64uz, 1024uz })
+    {
+        std::u8string needle(length, u8'a');
+        needle[length / 2uz] = u8'b';
+        const sys::string_searcher<char8_t> searcher(needle);
+
+        BENCHMARK("std::basic_string_view<...>::find(...), repetitive, needle of " + std::to_string(length)) { return std::u8string_view(repetitive).find(needle); };
+        BENCHMARK("sys::string_searcher<...>::find(...), repetitive, needle of " + std::to_string(length)) { return searcher.find(repetitive); };
+    }
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Threading>
+
+namespace
+{
+    constexpr size_t iterations = 10000uz;
+
+    // Run `func` on `threads` threads at once, `iterations` times each.
+    template <typename Func>
+    void hammer(const size_t threads, Func&& func)
+    {
+        std::vector<sys::managed_thread> pool;
+        pool.reserve(threads);
+        for (size_t i = 0uz; i < threads; i++)
+        {
+            pool.push_back(sys::managed_thread::ctor([&func]() -> void
+            {
+                for (size_t j = 0uz; j < iterations; j++)
+                    func();
+            }).expect());
+        }
+        for (sys::managed_thread& t : pool)
+            (void)t.join().expect();
+    }
+
+    std::vector<size_t> thread_counts()
+    {
+        const size_t max = std::max(std::thread::hardware_concurrency(), 1u);
+        std::vector<size_t> ret;
+        for (size_t i = 1uz; i < max; i *= 2uz)
+            ret.push_back(i);
+        ret.push_back(max);
+        return ret;
+    }
+} // namespace
+
+TEST_CASE("mutex, uncontended", "[sys.Threading][mutex][reentrant_mutex][!benchmark]")
+{
+    sys::mutex mut;
+    sys::reentrant_mutex rmut;
+
+    BENCHMARK("sys::mutex::lock()") { return bool(mut.lock().expect()); };
+    BENCHMARK("sys::mutex::try_lock()") { return bool(mut.try_lock().expect()); };
+    BENCHMARK("sys::reentrant_mutex::lock()") { return bool(rmut.lock().expect()); };
+    BENCHMARK("sys::reentrant_mutex::lock(), nested")
+    {
+        const sys::reentrant_mutex::guard outer = rmut.lock().expect();
+        return bool(rmut.lock().expect());
+    };
+}
+
+TEST_CASE("mutex, semaphore, contended", "[sys.Threading][mutex][semaphore][!benchmark]")
+{
+    for (const size_t threads : thread_counts())
+    {
+        BENCHMARK_ADVANCED("sys::mutex, " + std::to_string(threads) + " threads")(Catch::Benchmark::Chronometer meter)
+        {
+            sys::mutex mut;
+            size_t counter = 0uz;
+            meter.measure([&]() -> size_t
+            {
+                hammer(threads, [&]() -> void
+                {
+                    const sys::mutex::guard g = mut.lock().expect();
+                    counter++;
+                });
+                return counter;
+            });
+        };
+        BENCHMARK_ADVANCED("sys::semaphore(2), " + std::to_string(threads) + " threads")(Catch::Benchmark::Chronometer meter)
+        {
+            sys::semaphore sem(2_uz, unsafe);
+            meter.measure([&]() -> void
+            {
+                hammer(threads, [&]() -> void { const sys::semaphore::guard g = sem.access().expect(); });
+            });
+        };
+    }
+}
+
+TEST_CASE("cond_var, ping-pong", "[sys.Threading][cond_var][!benchmark]")
+{
+    BENCHMARK_ADVANCED("sys::cond_var::notify_one(), round trips")(Catch::Benchmark::Chronometer meter)
+    {
+        sys::mutex mut;
+        sys::cond_var cv;
+        meter.measure([&]() -> void
+        {
+            size_t turn = 0uz;
+            sys::managed_thread t = sys::managed_thread::ctor([&]() -> void
+            {
+                for (size_t i = 0uz; i < iterations; i++)
+                {
+                    const sys::mutex::guard g = mut.lock().expect();
+                    cv.wait_until(mut, [&]() noexcept -> bool { return turn % 2uz == 1uz; }).expect();
+                    turn++;
+                    cv.notify_one().expect();
+                }
+            }).expect();
+            for (size_t i = 0uz; i < iterations; i++)
+            {
+                const sys::mutex::guard g = mut.lock().expect();
+                turn++;
+                cv.notify_one().expect();
+                cv.wait_until(mut, [&]() noexcept -> bool { return turn % 2uz == 0uz; }).expect();
+            }
+            (void)t.join().expect();
+        });
+    };
+}
+
+TEST_CASE("read scaling", "[sys.Threading][rw_mutex][seqlock][mutex][!benchmark]")
+{
+    struct config
+    {
+        size_t a = 1uz, b = 2uz, c = 3uz, d = 4uz;
+    };
+
+    for (const size_t threads : thread_counts())
+    {
+        BENCHMARK_ADVANCED("sys::mutex, " + std::to_string(threads) + " readers")(Catch::Benchmark::Chronometer meter)
+        {
+            sys::mutex mut;
+            const config value;
+            meter.measure([&]() -> void
+            {
+                hammer(threads, [&]() -> void
+                {
+                    const sys::mutex::guard g = mut.lock().expect();
+                    Catch::Benchmark::keep_memory(&value);
+                });
+            });
+        };
+        BENCHMARK_ADVANCED("sys::rw_mutex, " + std::to_string(threads) + " readers")(Catch::Benchmark::Chronometer meter)
+        {
+            sys::rw_mutex mut;
+            const config value;
+            meter.measure([&]() -> void
+            {
+                hammer(threads, [&]() -> void
+                {
+                    const sys::rw_mutex::read_guard g = mut.read_lock().expect();
+                    Catch::Benchmark::keep_memory(&value);
+                });
+            });
+        };
+        BENCHMARK_ADVANCED("sys::seqlock<...>, " + std::to_string(threads) + " readers")(Catch::Benchmark::Chronometer meter)
+        {
+            sys::seqlock<config> value;
+            meter.measure([&]() -> void
+            {
+                hammer(threads, [&]() -> void
+                {
+                    const config got = value.load();
+                    Catch::Benchmark::keep_memory(&got);
+                });
+            });
+        };
+    }
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+#include <module/sys.Threading>
+
+namespace
+{
+    sys::str repeated(const std::u8string_view text)
+    {
+        constexpr size_t size = 64uz << 20uz;
+
+        std::u8string ret;
+        ret.reserve(size + text.size());
+        while (ret.size() < size)
+            ret.append(text);
+        return ret;
+    }
+} // namespace
+
+TEST_CASE("parallel text transforms", "[sys.Threading][parallel_text][!benchmark]")
+{
+    const sys::str mixed = repeated(u8"Größe Ωμέγα ΟΔΥΣΣΕΥΣ İstanbul 東京都 café naïve Ærø. ");
+
+    // From a single thread, which is the sequential transform plus a copy, up to every core.
+    const size_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+    for (size_t threads = 1uz; threads <= cores; threads = threads == cores ? cores + 1uz : std::min(threads * 2uz, cores))
+    {
+        const std::string suffix = ", 64 MiB, " + std::to_string(threads) + " thread(s)";
+        BENCHMARK("sys::parallel_lowered(...)" + suffix) { return sys::parallel_lowered(mixed, u8"", threads); };
+        BENCHMARK("sys::parallel_uppered(...)" + suffix) { return sys::parallel_uppered(mixed, u8"", threads); };
+        BENCHMARK("sys::parallel_folded(...)" + suffix) { return sys::parallel_folded(mixed, u8"", threads); };
+        BENCHMARK("sys::parallel_invalids_replaced(...)" + suffix) { return sys::parallel_invalids_replaced(mixed, threads); };
+        BENCHMARK("sys::parallel_transcoded<char16_t>(...)" + suffix) { return sys::parallel_transcoded<char16_t>(mixed, threads); };
+    }
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+#include <module/sys.Threading>
+
+namespace
+{
+    constexpr size_t distinct = 20000uz;
+    constexpr size_t tokens = 1uz << 18uz;
+
+    // The identifiers of a large source file, each distinct one occurring many times.
+    std::vector<sys::str> identifiers()
+    {
+        std::vector<sys::str> names;
+        for (size_t i = 0uz; i < distinct; i++)
+        {
+            const std::string digits = std::to_string(i);
+            std::u8string name(i % 3uz == 0uz ? u8"local_variable_" : u8"Member");
+            name.append(digits.begin(), digits.end());
+            names.emplace_back(std::move(name));
+        }
+
+        std::vector<sys::str> ret;
+        ret.reserve(tokens);
+        for (size_t i = 0uz; i < tokens; i++)
+            ret.push_back(names[(i * 7919uz) % distinct]);
+        return ret;
+    }
+    const std::vector<sys::str> source = identifiers();
+
+    struct view_hash final
+    {
+        using is_transparent = void;
+        size_t operator()(const std::u8string_view str) const noexcept { return std::hash<std::u8string_view>()(str); }
+    };
+    struct view_equal final
+    {
+        using is_transparent = void;
+        bool operator()(const std::u8string_view a, const std::u8string_view b) const noexcept { return a == b; }
+    };
+
+    /// Counts the bytes passed through to the heap.
+    class counting_resource final : public std::pmr::memory_resource
+    {
+        void* do_allocate(const size_t bytes, const size_t alignment) override
+        {
+            this->allocated += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t alignment) override
+        {
+            this->allocated -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    public:
+        size_t allocated = 0uz;
+    };
+
+    // The interning a pool does, with a set of strings.
+    template <typename Set>
+    const sys::str* interned(Set& set, const std::u8string_view text)
+    {
+        auto it = set.find(text);
+        if (it == set.end())
+            it = set.emplace(text).first;
+        return &*it;
+    }
+
+    // Run `func(i)` for every token `i`, split across `threads` threads.
+    template <typename Func>
+    void split(const size_t threads, Func&& func)
+    {
+        std::vector<sys::managed_thread> pool;
+        pool.reserve(threads);
+        for (size_t t = 0uz; t < threads; t++)
+        {
+            pool.push_back(sys::managed_thread::ctor([&func, t, threads]() -> void
+            {
+                for (size_t i = t; i < tokens; i += threads)
+                    func(i);
+            }).expect());
+        }
+        for (sys::managed_thread& t : pool)
+            (void)t.join().expect();
+    }
+} // namespace
+
+TEST_CASE("string interning", "[sys.Threading][string_pool][!benchmark]")
+{
+    // What interning the distinct identifiers holds on to, the text and tables of each.
+    counting_resource poolHeap, setHeap;
+    {
+        sys::string_pool<char8_t> pool(&poolHeap);
+        std::pmr::unordered_set<sys::pmr::str, view_hash, view_equal> set(&setHeap);
+        for (const sys::str& name : source)
+        {
+            (void)pool.intern(name);
+            if (set.find(std::u8string_view(name)) == set.end())
+                set.emplace(std::u8string_view(name), set.get_allocator());
+        }
+        CHECK(pool.size() == sz(set.size()));
+        WARN("Bytes held for " << distinct << " distinct identifiers, sys::string_pool<...>: " << poolHeap.allocated << ", std::pmr::unordered_set<sys::pmr::str>: "
+                               << setHeap.allocated);
+    }
+
+    BENCHMARK("sys::string_pool<...>::intern(...), fresh pool")
+    {
+        sys::string_pool<char8_t> pool;
+        for (const sys::str& name : source)
+            (void)pool.intern(name);
+        return pool.size();
+    };
+    BENCHMARK("std::unordered_set<sys::str>, fresh set")
+    {
+        std::unordered_set<sys::str, view_hash, view_equal> set;
+        for (const sys::str& name : source)
+            (void)interned(set, name);
+        return set.size();
+    };
+
+    // Once every identifier is interned, as when interning the rest of a program.
+    sys::string_pool<char8_t> pool;
+    std::unordered_set<sys::str, view_hash, view_equal> set;
+    for (const sys::str& name : source)
+    {
+        (void)pool.intern(name);
+        (void)interned(set, name);
+    }
+    BENCHMARK("sys::string_pool<...>::intern(...), all interned") { return std::ranges::count_if(source, [&](const sys::str& name) { return bool(pool.intern(name)); }); };
+    BENCHMARK("std::unordered_set<sys::str>, all interned")
+    {
+        return std::ranges::count_if(source, [&](const sys::str& name) { return interned(set, name) != nullptr; });
+    };
+
+    // Comparing interned identifiers rather than their text.
+    std::vector<sys::interned_string<char8_t>> internedSource;
+    internedSource.reserve(tokens);
+    for (const sys::str& name : source)
+        internedSource.push_back(pool.intern(name));
+    const sys::interned_string<char8_t> keyword = pool.intern(source[distinct / 2uz]);
+    BENCHMARK("sys::interned_string<...>::operator==(...)") { return std::ranges::count(internedSource, keyword); };
+    BENCHMARK("sys::string<...>::operator==(...)") { return std::ranges::count(source, source[distinct / 2uz]); };
+}
+
+TEST_CASE("string interning, contended", "[sys.Threading][string_pool][!benchmark]")
+{
+    const size_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+    for (size_t threads = 1uz; threads <= cores; threads = threads == cores ? cores + 1uz : std::min(threads * 2uz, cores))
+    {
+        BENCHMARK("sys::string_pool<...>::intern(...), " + std::to_string(threads) + " thread(s)")
+        {
+            sys::string_pool<char8_t> pool;
+            split(threads, [&](const size_t i) -> void { (void)pool.intern(source[i]); });
+            return pool.size();
+        };
+        BENCHMARK("std::unordered_set<sys::str>, sys::mutex, " + std::to_string(threads) + " thread(s)")
+        {
+            std::unordered_set<sys::str, view_hash, view_equal> set;
+            sys::mutex mut;
+            split(threads, [&](const size_t i) -> void
+            {
+                const sys::mutex::guard g = mut.lock().expect();
+                (void)interned(set, source[i]);
+            });
+            return set.size();
+        };
+    }
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,52 @@
+#include <atomic>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Threading>
+
+TEST_CASE("thread spawn", "[sys.Threading][managed_thread][thread_pool][!benchmark]")
+{
+    constexpr size_t tasks = 64uz;
+    sys::thread_pool pool = sys::thread_pool::ctor().expect();
+
+    BENCHMARK("sys::managed_thread::ctor(...), join()")
+    {
+        std::atomic<size_t> ran = 0uz;
+        std::vector<sys::managed_thread> threads;
+        threads.reserve(tasks);
+        for (size_t i = 0uz; i < tasks; i++)
+            threads.push_back(sys::managed_thread::ctor([&ran]() -> void { ran.fetch_add(1uz, std::memory_order_relaxed); }).expect());
+        for (sys::managed_thread& t : threads)
+            (void)t.join().expect();
+        return ran.load();
+    };
+    BENCHMARK("sys::thread_pool::submit(...), get()")
+    {
+        std::atomic<size_t> ran = 0uz;
+        std::vector<sys::task_future<void>> futures;
+        futures.reserve(tasks);
+        for (size_t i = 0uz; i < tasks; i++)
+            futures.push_back(pool.submit([&ran]() -> void { ran.fetch_add(1uz, std::memory_order_relaxed); }).expect());
+        for (sys::task_future<void>& f : futures)
+            f.get().expect();
+        return ran.load();
+    };
+    BENCHMARK("sys::thread_pool::parallel_for(...)")
+    {
+        std::atomic<size_t> ran = 0uz;
+        pool.parallel_for(0uz, tasks, [&ran](size_t) -> void { ran.fetch_add(1uz, std::memory_order_relaxed); }).expect();
+        return ran.load();
+    };
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,106 @@
+#include <stdexcept>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+
+namespace
+{
+    enum class bench_error : int
+    {
+        negative = 1
+    };
+
+    _inline_never sys::result<int, bench_error> leaf_result(const int x) noexcept
+    {
+        _retif(bench_error::negative, x < 0);
+        return x + 1;
+    }
+    _inline_never sys::result<int, bench_error> propagate_result(const int x, const int depth) noexcept // NOLINT(misc-no-recursion)
+    {
+        if (depth == 0)
+            return leaf_result(x);
+        _res_movret(const int ret, propagate_result(x, depth - 1));
+        return ret + 1;
+    }
+
+    _inline_never int leaf_code(const int x, int& out) noexcept
+    {
+        _retif(1, x < 0);
+        out = x + 1;
+        return 0;
+    }
+    _inline_never int propagate_code(const int x, const int depth, int& out) noexcept // NOLINT(misc-no-recursion)
+    {
+        if (depth == 0)
+            return leaf_code(x, out);
+        _retif(code, const int code = propagate_code(x, depth - 1, out); code != 0);
+        out++;
+        return 0;
+    }
+
+    _inline_never int leaf_throw(const int x)
+    {
+        if (x < 0)
+            throw std::invalid_argument("negative");
+        return x + 1;
+    }
+    _inline_never int propagate_throw(const int x, const int depth) // NOLINT(misc-no-recursion)
+    {
+        if (depth == 0)
+            return leaf_throw(x);
+        return propagate_throw(x, depth - 1) + 1;
+    }
+} // namespace
+
+TEST_CASE("result propagation", "[sys][result][!benchmark]")
+{
+    constexpr int depth = 8;
+    // Opaque to the optimizer, so nothing is folded away.
+    volatile int ok = 1;
+    volatile int bad = -1;
+
+    BENCHMARK("sys::result<...>, success")
+    {
+        return propagate_result(ok, depth).expect();
+    };
+    BENCHMARK("sys::result<...>, error")
+    {
+        return propagate_result(bad, depth).expect_err();
+    };
+    BENCHMARK("error code, success")
+    {
+        int out = 0;
+        return propagate_code(ok, depth, out) + out;
+    };
+    BENCHMARK("error code, error")
+    {
+        int out = 0;
+        return propagate_code(bad, depth, out) + out;
+    };
+    BENCHMARK("exception, success")
+    {
+        return propagate_throw(ok, depth);
+    };
+    BENCHMARK("exception, error")
+    {
+        try
+        {
+            return propagate_throw(bad, depth);
+        }
+        catch (const std::invalid_argument&)
+        {
+            return -1;
+        }
+    };
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
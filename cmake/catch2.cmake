@@ -13,3 +13,13 @@ function(add_test_with_catch2 TEST_NAME TEST_FILE)
 
     add_test(${TEST_NAME} ${TEST_NAME})
 endfunction()
+
+function(add_benchmark_with_catch2 BENCHMARK_NAME BENCHMARK_FILE)
+    add_executable(${BENCHMARK_NAME} ${BENCHMARK_FILE})
+    target_libcxxext_common_config(${BENCHMARK_NAME})
+    target_compile_options(${BENCHMARK_NAME} PRIVATE $<$<COMPILE_LANG_AND_ID:CXX,Clang,AppleClang>:-Wno-consumed>) # Doesn't play so well with Catch2.
+    target_link_libraries(${BENCHMARK_NAME} PRIVATE
+        Catch2WithMain
+        sys.BuildSupport.CompilerOptions
+    )
+endfunction()
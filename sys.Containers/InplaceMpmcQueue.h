@@ -0,0 +1,126 @@
+#pragma once
+
+/// @file
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include <Platform.h>
+
+namespace sys
+{
+    /// @ingroup sys_containers
+    /// @brief A lock-free queue that stores elements in-place, for any number of producer and consumer threads.
+    /// @details Each slot carries a sequence number recording which lap of the ring it's ready for and whether it's filled, after Dmitry Vyukov's bounded MPMC queue. Producers
+    /// and consumers only contend on the position they claim, never on a lock.
+    /// @tparam T The type of elements to store.
+    /// @tparam Capacity The maximum number of elements that can be stored in the queue, a power of two.
+    template <typename T, size_t Capacity = 128uz /* NOLINT(readability-magic-numbers) */>
+    requires (Capacity > 0 && (Capacity & (Capacity - 1)) == 0)
+    class inplace_mpmc_queue
+    {
+        static constexpr size_t mask = Capacity - 1;
+
+        struct slot
+        {
+            // Equal to the position that may fill this slot next, or one past the position that may empty it.
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        alignas(_libcxxext_cache_line_size) std::atomic<size_t> enqueue_pos { 0 };
+        alignas(_libcxxext_cache_line_size) std::atomic<size_t> dequeue_pos { 0 };
+        alignas(_libcxxext_cache_line_size) slot slots[Capacity];
+
+        // Claim up to `wanted` consecutive slots from `pos`, whose sequence must be `pos + i + offset`.
+        [[nodiscard]] size_t claim(std::atomic<size_t>& pos, const size_t offset, const size_t wanted, size_t& claimed) noexcept
+        {
+            size_t at = pos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                size_t count = 0;
+                bool stale = false;
+                for (; count < wanted; count++)
+                {
+                    const size_t seq = this->slots[(at + count) & mask].sequence.load(std::memory_order_acquire);
+                    const std::ptrdiff_t diff = std::ptrdiff_t(seq - (at + count + offset));
+                    if (diff == 0)
+                        continue;
+                    // Another thread already claimed `at`, the slots ahead of it aren't ours to judge.
+                    stale = count == 0 && diff > 0;
+                    break;
+                }
+
+                if (stale)
+                    at = pos.load(std::memory_order_relaxed);
+                else if (count == 0)
+                    return 0;
+                else if (pos.compare_exchange_weak(at, at + count, std::memory_order_relaxed))
+                {
+                    claimed = at;
+                    return count;
+                }
+            }
+        }
+    public:
+        inplace_mpmc_queue() noexcept
+        {
+            for (size_t i = 0; i < Capacity; i++)
+                this->slots[i].sequence.store(i, std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        inplace_mpmc_queue(const inplace_mpmc_queue&) = delete;
+        inplace_mpmc_queue(inplace_mpmc_queue&&) = delete;
+        ~inplace_mpmc_queue() = default;
+
+        inplace_mpmc_queue& operator=(const inplace_mpmc_queue&) = delete;
+        inplace_mpmc_queue& operator=(inplace_mpmc_queue&&) = delete;
+
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+        /// @note Only a snapshot when called concurrently with producers or consumers.
+        [[nodiscard]] size_t size() const noexcept
+        {
+            const size_t dequeuePos = this->dequeue_pos.load(std::memory_order_acquire);
+            const size_t enqueuePos = this->enqueue_pos.load(std::memory_order_acquire);
+            return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+        }
+        [[nodiscard]] consteval static size_t capacity() noexcept { return Capacity; }
+
+        /// @brief Enqueues `item` into the queue.
+        /// @return Whether the item was enqueued, or the queue was full.
+        bool enqueue(const T& item) { return this->enqueue_bulk(std::span<const T>(&item, 1)) == 1; }
+        /// @brief Enqueues as many of `items` as fit into the queue, in order.
+        /// @return The number of items enqueued.
+        /// @note Items enqueued in bulk are contiguous in the queue, though consumers may dequeue them concurrently with other items.
+        size_t enqueue_bulk(const std::span<const T> items)
+        {
+            size_t at = 0;
+            const size_t count = this->claim(this->enqueue_pos, 0, items.size(), at);
+            for (size_t i = 0; i < count; i++)
+            {
+                slot& s = this->slots[(at + i) & mask];
+                s.data = items[i];
+                s.sequence.store(at + i + 1, std::memory_order_release);
+            }
+            return count;
+        }
+        /// @brief Dequeues an item from the queue.
+        /// @return Whether the item was dequeued, or the queue was empty.
+        bool try_dequeue(T& out) { return this->try_dequeue_bulk(std::span<T>(&out, 1)) == 1; }
+        /// @brief Dequeues up to `out.size()` consecutive items from the queue.
+        /// @return The number of items dequeued into the front of `out`.
+        size_t try_dequeue_bulk(const std::span<T> out)
+        {
+            size_t at = 0;
+            const size_t count = this->claim(this->dequeue_pos, 1, out.size(), at);
+            for (size_t i = 0; i < count; i++)
+            {
+                slot& s = this->slots[(at + i) & mask];
+                out[i] = std::move(s.data);
+                s.sequence.store(at + i + Capacity, std::memory_order_release);
+            }
+            return count;
+        }
+    };
+} // namespace sys
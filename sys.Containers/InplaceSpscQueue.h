@@ -0,0 +1,112 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include <Platform.h>
+
+namespace sys
+{
+    /// @ingroup sys_containers
+    /// @brief A lock-free queue that stores elements in-place, for exactly one producer and one consumer thread.
+    /// @tparam T The type of elements to store.
+    /// @tparam Capacity The maximum number of elements that can be stored in the queue, a power of two.
+    /// @note `enqueue(...)` and `enqueue_bulk(...)` may only be called from one thread at a time, as may `try_dequeue(...)` and `try_dequeue_bulk(...)`.
+    template <typename T, size_t Capacity = 128uz /* NOLINT(readability-magic-numbers) */>
+    requires (Capacity > 0 && (Capacity & (Capacity - 1)) == 0)
+    class inplace_spsc_queue
+    {
+        static constexpr size_t mask = Capacity - 1;
+
+        // Positions increase monotonically and are only masked on access, so `tail - head` is the size even after wrapping.
+        alignas(_libcxxext_cache_line_size) std::atomic<size_t> head { 0 };
+        size_t cached_tail = 0; // Consumer's last observation of `tail`.
+        alignas(_libcxxext_cache_line_size) std::atomic<size_t> tail { 0 };
+        size_t cached_head = 0; // Producer's last observation of `head`.
+        alignas(_libcxxext_cache_line_size) T data[Capacity];
+
+        [[nodiscard]] size_t free_for_producer(const size_t tailPos, const size_t wanted) noexcept
+        {
+            if (Capacity - (tailPos - this->cached_head) < wanted)
+                this->cached_head = this->head.load(std::memory_order_acquire);
+            return Capacity - (tailPos - this->cached_head);
+        }
+        [[nodiscard]] size_t used_for_consumer(const size_t headPos, const size_t wanted) noexcept
+        {
+            if (this->cached_tail - headPos < wanted)
+                this->cached_tail = this->tail.load(std::memory_order_acquire);
+            return this->cached_tail - headPos;
+        }
+    public:
+        inplace_spsc_queue() noexcept = default;
+        inplace_spsc_queue(const inplace_spsc_queue&) = delete;
+        inplace_spsc_queue(inplace_spsc_queue&&) = delete;
+        ~inplace_spsc_queue() = default;
+
+        inplace_spsc_queue& operator=(const inplace_spsc_queue&) = delete;
+        inplace_spsc_queue& operator=(inplace_spsc_queue&&) = delete;
+
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+        /// @note Only a snapshot when called concurrently with the producer or consumer.
+        [[nodiscard]] size_t size() const noexcept
+        {
+            const size_t headPos = this->head.load(std::memory_order_acquire);
+            return this->tail.load(std::memory_order_acquire) - headPos;
+        }
+        [[nodiscard]] consteval static size_t capacity() noexcept { return Capacity; }
+
+        /// @brief Enqueues `item` into the queue.
+        /// @return Whether the item was enqueued, or the queue was full.
+        bool enqueue(const T& item)
+        {
+            const size_t tailPos = this->tail.load(std::memory_order_relaxed);
+            if (this->free_for_producer(tailPos, 1) == 0) [[unlikely]]
+                return false;
+
+            this->data[tailPos & mask] = item;
+            this->tail.store(tailPos + 1, std::memory_order_release);
+            return true;
+        }
+        /// @brief Enqueues as many of `items` as fit into the queue, in order.
+        /// @return The number of items enqueued.
+        size_t enqueue_bulk(const std::span<const T> items)
+        {
+            const size_t tailPos = this->tail.load(std::memory_order_relaxed);
+            const size_t count = std::min(items.size(), this->free_for_producer(tailPos, items.size()));
+
+            for (size_t i = 0; i < count; i++)
+                this->data[(tailPos + i) & mask] = items[i];
+            this->tail.store(tailPos + count, std::memory_order_release);
+            return count;
+        }
+        /// @brief Dequeues an item from the queue.
+        /// @return Whether the item was dequeued, or the queue was empty.
+        bool try_dequeue(T& out)
+        {
+            const size_t headPos = this->head.load(std::memory_order_relaxed);
+            if (this->used_for_consumer(headPos, 1) == 0) [[unlikely]]
+                return false;
+
+            out = std::move(this->data[headPos & mask]);
+            this->head.store(headPos + 1, std::memory_order_release);
+            return true;
+        }
+        /// @brief Dequeues up to `out.size()` items from the queue, in order.
+        /// @return The number of items dequeued into the front of `out`.
+        size_t try_dequeue_bulk(const std::span<T> out)
+        {
+            const size_t headPos = this->head.load(std::memory_order_relaxed);
+            const size_t count = std::min(out.size(), this->used_for_consumer(headPos, out.size()));
+
+            for (size_t i = 0; i < count; i++)
+                out[i] = std::move(this->data[(headPos + i) & mask]);
+            this->head.store(headPos + count, std::memory_order_release);
+            return count;
+        }
+    };
+} // namespace sys
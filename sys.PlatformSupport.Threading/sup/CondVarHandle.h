@@ -6,6 +6,7 @@
 #define NOMINMAX 1 // NOLINT(readability-identifier-naming)
 _nowarn_begin_one_clang(_clwarn_clang_documentation);
 
+#include <chrono>
 #include <cstddef>
 #include <tinycthread.h>
 
@@ -16,14 +17,74 @@ _nowarn_end_clang();
 #endif
 
 #include <LanguageSupport.h>
+#include <sup/Deadline.h>
+#include <sup/Futex.h>
 #include <sup/ThreadingErrors.h>
 
+#if _libcxxext_threading_futex
+#include <atomic>
+#include <cstdint>
+#endif
+
 #if !defined(_libcxxext_mock_sup_mut) || !_libcxxext_mock_sup_mut
 #include <sup/MutexHandle.h>
 #endif
 
 namespace sys::internal
 {
+#if _libcxxext_threading_futex
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Futex-backed condition variable.
+    /// @details Waiters sleep on a sequence number that every notification bumps, so a notification between releasing the mutex and sleeping is never lost.
+    struct cond_var_handle
+    {
+    private:
+        std::atomic<uint32_t> seq { 0 };
+    public:
+        /// @brief Futex condition variables are ready once constructed, and need no runtime initialization.
+        static constexpr bool constant_initializable = true;
+
+        /* NOLINT(hicpp-explicit-conversions) */ constexpr cond_var_handle(std::nullptr_t) noexcept { }
+        cond_var_handle(const cond_var_handle&) noexcept = delete;
+        cond_var_handle(cond_var_handle&&) noexcept = delete;
+        constexpr ~cond_var_handle() noexcept = default;
+
+        cond_var_handle& operator=(const cond_var_handle&) noexcept = delete;
+        cond_var_handle& operator=(cond_var_handle&&) noexcept = delete;
+
+        constexpr internal::threading_error create() noexcept { return internal::threading_error::ok; }
+        constexpr void destroy() noexcept { }
+        internal::threading_error signal() noexcept
+        {
+            this->seq.fetch_add(1, std::memory_order_release);
+            internal::futex_wake(this->seq, 1);
+            return internal::threading_error::ok;
+        }
+        internal::threading_error broadcast() noexcept
+        {
+            this->seq.fetch_add(1, std::memory_order_release);
+            internal::futex_wake_all(this->seq);
+            return internal::threading_error::ok;
+        }
+        internal::threading_error wait(internal::mutex_handle& mut) noexcept
+        {
+            const uint32_t observed = this->seq.load(std::memory_order_acquire);
+            _retif(internal::threading_error::error, mut.unlock() != internal::threading_error::ok);
+            internal::futex_wait(this->seq, observed);
+            return mut.lock();
+        }
+        internal::threading_error wait_until(internal::mutex_handle& mut, const internal::deadline deadline) noexcept
+        {
+            const uint32_t observed = this->seq.load(std::memory_order_acquire);
+            _retif(internal::threading_error::error, mut.unlock() != internal::threading_error::ok);
+            const internal::deadline now = std::chrono::steady_clock::now();
+            const bool timedOut = now >= deadline || internal::futex_wait_for(this->seq, observed, deadline - now);
+            _retif(internal::threading_error::error, mut.lock() != internal::threading_error::ok);
+            return timedOut ? internal::threading_error::timeout : internal::threading_error::ok;
+        }
+    };
+#else
     /// @internal
     /// @ingroup sys_internal
     struct cond_var_handle
@@ -44,5 +105,17 @@ namespace sys::internal
         internal::threading_error signal() noexcept { return _as(cnd_signal(&this->cond), internal::threading_error); }
         internal::threading_error broadcast() noexcept { return _as(cnd_broadcast(&this->cond), internal::threading_error); }
         internal::threading_error wait(internal::mutex_handle& mut) noexcept { return _as(cnd_wait(&this->cond, &mut.mut), internal::threading_error); }
+        internal::threading_error wait_until(internal::mutex_handle& mut, const internal::deadline deadline) noexcept
+        {
+            _retif(this->wait(mut), deadline == internal::deadline::max());
+
+            // `cnd_timedwait(...)` takes a `TIME_UTC` deadline, so translate ours onto the system clock.
+            const auto at = std::chrono::system_clock::now() + std::chrono::ceil<std::chrono::system_clock::duration>(deadline - std::chrono::steady_clock::now());
+            const auto secs = std::chrono::floor<std::chrono::seconds>(at.time_since_epoch());
+            const timespec ts { .tv_sec = _as(secs.count(), time_t),
+                                .tv_nsec = _as(std::chrono::duration_cast<std::chrono::nanoseconds>(at.time_since_epoch() - secs).count(), long) };
+            return _as(cnd_timedwait(&this->cond, &mut.mut, &ts), internal::threading_error);
+        }
     };
+#endif
 } // namespace sys::internal
@@ -0,0 +1,40 @@
+#pragma once
+
+/// @file
+
+#include <chrono>
+#include <concepts>
+
+#include <LanguageSupport.h>
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Deadline on the monotonic clock, which every timed wait of the platform handles takes.
+    using deadline = std::chrono::steady_clock::time_point;
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The deadline `timeout` from now, saturating instead of overflowing.
+    template <typename Rep, typename Period>
+    [[nodiscard]] deadline deadline_after(const std::chrono::duration<Rep, Period> timeout) noexcept
+    {
+        const deadline now = std::chrono::steady_clock::now();
+        _retif(now, timeout <= timeout.zero());
+        // Compared in floating point, since either duration may overflow the other's representation.
+        _retif(deadline::max(), std::chrono::duration<double>(timeout) >= std::chrono::duration<double>(deadline::max() - now));
+        return now + std::chrono::ceil<deadline::duration>(timeout);
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief `at`, on the monotonic clock.
+    template <typename Clock, typename Duration>
+    [[nodiscard]] deadline deadline_at(const std::chrono::time_point<Clock, Duration> at) noexcept
+    {
+        if constexpr (std::same_as<Clock, std::chrono::steady_clock>)
+            return std::chrono::ceil<deadline::duration>(at);
+        else
+            return internal::deadline_after(at - Clock::now());
+    }
+} // namespace sys::internal
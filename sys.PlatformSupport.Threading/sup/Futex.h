@@ -0,0 +1,84 @@
+#pragma once
+
+/// @file
+
+#include <LanguageSupport.h>
+#include <Platform.h>
+
+/// @def _libcxxext_threading_futex
+/// @ingroup sys
+/// @brief Check if the threading primitives are implemented natively over futexes, rather than over tinycthread.
+/// @details Selected at configure time with `LIBCXXEXT_THREADING_BACKEND`.
+#ifndef _libcxxext_threading_futex
+#define _libcxxext_threading_futex 0
+#endif
+
+#if _libcxxext_threading_futex
+#if !_libcxxext_os_linux
+#error "The futex threading backend is only available on Linux."
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if _libcxxext_arch_x86_64 || _libcxxext_arch_x86
+#include <immintrin.h>
+#endif
+
+namespace sys::internal
+{
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex words must be plain 32-bit integers.");
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Block the calling thread while `word` still holds `expected`, or until woken, possibly spuriously.
+    inline void futex_wait(std::atomic<uint32_t>& word, const uint32_t expected) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg, cppcoreguidelines-pro-type-reinterpret-cast)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief `sys::internal::futex_wait(...)`, giving up after `timeout`.
+    /// @return Whether the wait timed out.
+    inline bool futex_wait_for(std::atomic<uint32_t>& word, const uint32_t expected, const std::chrono::nanoseconds timeout) noexcept
+    {
+        const auto secs = std::chrono::floor<std::chrono::seconds>(timeout);
+        const timespec rel { .tv_sec = _as(secs.count(), time_t), .tv_nsec = _as((timeout - secs).count(), long) };
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg, cppcoreguidelines-pro-type-reinterpret-cast)
+        return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, &rel, nullptr, 0) == -1 && errno == ETIMEDOUT;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Wake up to `count` threads blocked in `sys::internal::futex_wait(...)` on `word`.
+    inline void futex_wake(std::atomic<uint32_t>& word, const int count) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg, cppcoreguidelines-pro-type-reinterpret-cast)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Wake every thread blocked in `sys::internal::futex_wait(...)` on `word`.
+    inline void futex_wake_all(std::atomic<uint32_t>& word) noexcept { futex_wake(word, INT_MAX); }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Hint to the processor that the calling thread is spinning.
+    inline void cpu_relax() noexcept
+    {
+#if _libcxxext_arch_x86_64 || _libcxxext_arch_x86
+        _mm_pause();
+#elif _libcxxext_arch_aarch64 || _libcxxext_arch_arm
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+} // namespace sys::internal
+#endif
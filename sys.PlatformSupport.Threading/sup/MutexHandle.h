@@ -4,6 +4,8 @@
 
 #define NOMINMAX 1 // NOLINT(readability-identifier-naming)
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <tinycthread.h>
 
@@ -13,12 +15,155 @@
 #endif
 
 #include <LanguageSupport.h>
+#include <sup/Deadline.h>
+#include <sup/Futex.h>
 #include <sup/ThreadingErrors.h>
 
+#if _libcxxext_threading_futex
+#include <atomic>
+#include <cstdint>
+#endif
+
 namespace sys::internal
 {
     struct cond_var_handle;
 
+#if _libcxxext_threading_futex
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Futex-backed mutex, after Ulrich Drepper's "Futexes Are Tricky".
+    /// @details The lock word is `0` when unlocked, `1` when locked, and `2` when locked with possible waiters, so an uncontended `unlock()` never enters the kernel.
+    struct mutex_handle
+    {
+    private:
+        static constexpr int spin_count = 100;
+
+        static const void* this_thread_tag() noexcept
+        {
+            static thread_local const char tag = 0;
+            return &tag;
+        }
+
+        std::atomic<uint32_t> state { 0 };
+        std::atomic<const void*> owner { nullptr };
+        uint32_t depth = 0;
+        bool recursive = false;
+
+        bool spin_acquire() noexcept
+        {
+            for (int i = 0; i < spin_count; i++)
+            {
+                uint32_t expected = 0;
+                if (this->state.load(std::memory_order_relaxed) == 0 && this->state.compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+                    return true;
+                internal::cpu_relax();
+            }
+            return false;
+        }
+        void lock_contended() noexcept
+        {
+            _retif(, this->spin_acquire());
+
+            // Once marked contended, the word stays `2` until we own it, erring on the side of a spurious wake on `unlock()`.
+            while (this->state.exchange(2, std::memory_order_acquire) != 0)
+                internal::futex_wait(this->state, 2);
+        }
+        bool lock_contended_until(const internal::deadline deadline) noexcept
+        {
+            _retif(true, this->spin_acquire());
+
+            while (this->state.exchange(2, std::memory_order_acquire) != 0)
+            {
+                const internal::deadline now = std::chrono::steady_clock::now();
+                _retif(false, now >= deadline);
+                (void)internal::futex_wait_for(this->state, 2, deadline - now);
+            }
+            return true;
+        }
+        bool reenter() noexcept
+        {
+            if (!this->recursive || this->owner.load(std::memory_order_relaxed) != mutex_handle::this_thread_tag())
+                return false;
+            this->depth++;
+            return true;
+        }
+        void take_ownership() noexcept
+        {
+            if (this->recursive)
+            {
+                this->owner.store(mutex_handle::this_thread_tag(), std::memory_order_relaxed);
+                this->depth = 1;
+            }
+        }
+    public:
+        /// @brief Futex mutexes are ready once constructed, and need no runtime initialization.
+        static constexpr bool constant_initializable = true;
+
+        /* NOLINT(hicpp-explicit-conversions) */ constexpr mutex_handle(std::nullptr_t) noexcept { }
+        mutex_handle(const mutex_handle&) noexcept = delete;
+        mutex_handle(mutex_handle&&) noexcept = delete;
+        constexpr ~mutex_handle() noexcept = default;
+
+        mutex_handle& operator=(const mutex_handle&) noexcept = delete;
+        mutex_handle& operator=(mutex_handle&&) noexcept = delete;
+
+        template <bool IsRecursive>
+        constexpr internal::threading_error create() noexcept
+        {
+            this->recursive = IsRecursive;
+            return internal::threading_error::ok;
+        }
+        constexpr void destroy() noexcept { }
+        internal::threading_error try_lock() noexcept
+        {
+            if (this->reenter())
+                return internal::threading_error::ok;
+
+            uint32_t expected = 0;
+            _retif(internal::threading_error::busy, !this->state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed));
+            this->take_ownership();
+            return internal::threading_error::ok;
+        }
+        internal::threading_error lock() noexcept
+        {
+            if (this->reenter())
+                return internal::threading_error::ok;
+
+            uint32_t expected = 0;
+            if (!this->state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) [[unlikely]]
+                this->lock_contended();
+            this->take_ownership();
+            return internal::threading_error::ok;
+        }
+        internal::threading_error lock_until(const internal::deadline deadline) noexcept
+        {
+            if (this->reenter())
+                return internal::threading_error::ok;
+
+            uint32_t expected = 0;
+            if (!this->state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) [[unlikely]]
+                _retif(internal::threading_error::timeout, !this->lock_contended_until(deadline));
+            this->take_ownership();
+            return internal::threading_error::ok;
+        }
+        internal::threading_error unlock() noexcept
+        {
+            if (this->recursive)
+            {
+                _retif(internal::threading_error::error, this->owner.load(std::memory_order_relaxed) != mutex_handle::this_thread_tag());
+                if (--this->depth > 0)
+                    return internal::threading_error::ok;
+                this->owner.store(nullptr, std::memory_order_relaxed);
+            }
+
+            if (this->state.exchange(0, std::memory_order_release) == 2) [[unlikely]]
+                internal::futex_wake(this->state, 1);
+            return internal::threading_error::ok;
+        }
+
+        friend struct sys::internal::cond_var_handle;
+    };
+#else
     /// @internal
     /// @ingroup sys_internal
     struct mutex_handle
@@ -43,8 +188,28 @@ namespace sys::internal
         void destroy() noexcept { mtx_destroy(&this->mut); }
         internal::threading_error try_lock() noexcept { return _as(mtx_trylock(&this->mut), internal::threading_error); }
         internal::threading_error lock() noexcept { return _as(mtx_lock(&this->mut), internal::threading_error); }
+        /// @note Polls rather than use `mtx_timedlock(...)`, which would need `mtx_timed`.
+        internal::threading_error lock_until(const internal::deadline deadline) noexcept
+        {
+            constexpr std::chrono::nanoseconds maxBackoff = std::chrono::milliseconds(1);
+            std::chrono::nanoseconds backoff(1000); // NOLINT(readability-magic-numbers)
+            while (true)
+            {
+                const internal::threading_error ret = this->try_lock();
+                _retif(ret, ret != internal::threading_error::busy);
+
+                const internal::deadline now = std::chrono::steady_clock::now();
+                _retif(internal::threading_error::timeout, now >= deadline);
+
+                const std::chrono::nanoseconds nap = std::min(backoff, std::chrono::ceil<std::chrono::nanoseconds>(deadline - now));
+                const timespec duration { .tv_sec = 0, .tv_nsec = _as(nap.count(), long) };
+                (void)thrd_sleep(&duration, nullptr);
+                backoff = std::min(backoff * 2, maxBackoff);
+            }
+        }
         internal::threading_error unlock() noexcept { return _as(mtx_unlock(&this->mut), internal::threading_error); }
 
         friend struct sys::internal::cond_var_handle;
     };
+#endif
 } // namespace sys::internal
@@ -21,4 +21,10 @@ namespace sys::internal
         busy = thrd_busy,
         oom = thrd_nomem
     };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief A platform handle that is ready once constructed, whose `create(...)` can't fail and whose `destroy()` is trivial.
+    template <typename Handle>
+    concept IConstantInitializableHandle = requires { requires Handle::constant_initializable; };
 } // namespace sys::internal
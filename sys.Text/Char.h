@@ -139,12 +139,12 @@ namespace sys
                 ret &= 0x1F_u32;
                 len = 2_uz;
             }
-            else if (ret < 0xF0_u32)
+            else if (ret >= 0xE0_u32 && ret < 0xF0_u32)
             {
                 ret &= 0x0F_u32;
                 len = 3_uz;
             }
-            else if (ret < 0xF5_u32)
+            else if (ret >= 0xF0_u32 && ret < 0xF5_u32)
             {
                 ret &= 0x07_u32;
                 len = 4_uz;
@@ -179,6 +179,52 @@ namespace sys
             return read_codepoint(std::span<const ctype>(_asr(range.data(), const ctype*), range.size()), unsafe);
         }
 
+        /// @brief Reads the (possibly multibyte) codepoint at the end of a unicode buffer, decoding backward.
+        /// @details Agrees with reading `range` forward from its start with `sys::ch::read_codepoint(...)`: an invalid sequence is read as U+FFFD, one code unit at a
+        /// time.
+        /// @return `(char32_t codepoint, sz elements_read)`
+        /// @warning `unsafe` because `range` has preconditions.
+        /// @pre `range.empty() == false`, and `range` starts at the start of a sequence.
+        static constexpr codepoint_data read_last_codepoint(const std::span<const char32_t> range, decltype(unsafe))
+        {
+            return ch::read_codepoint(range.last(1uz), unsafe);
+        }
+        /// @see `sys::ch::read_last_codepoint(const std::span<const char32_t>, decltype(unsafe))`
+        static constexpr codepoint_data read_last_codepoint(const std::span<const char16_t> range, decltype(unsafe))
+        {
+            const u32 trail(_as(range.back(), u32::underlying_type));
+            _retif((codepoint_data { .c = _as(*trail, char32_t), .size_bytes = 1_uz }), !ch::is_surrogate(_as(*trail, char32_t))); // BMP
+            _retif(ch::read_codepoint_fail(), !ch::is_low_surrogate(_as(*trail, char32_t)) || range.size() < 2uz ||
+                                                  !ch::is_high_surrogate(range[range.size() - 2uz] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */));
+            return ch::read_codepoint(range.last(2uz), unsafe);
+        }
+        /// @see `sys::ch::read_last_codepoint(const std::span<const char32_t>, decltype(unsafe))`
+        static constexpr codepoint_data read_last_codepoint(const std::span<const char8_t> range, decltype(unsafe))
+        {
+            const sz size = sz(range.size());
+            _retif((codepoint_data { .c = _as(range.back(), char32_t), .size_bytes = 1_uz }), range.back() < 0x80u); // 1-byte sequence, fast path.
+
+            // The lead is at most 3 continuation bytes back, and the code units after it are only one codepoint if they're exactly the sequence it starts.
+            sz lead = size - 1_uz;
+            while (lead > 0_uz && size - lead < 4_uz && ch::is_continuation(range[lead] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */))
+                lead--;
+            const codepoint_data ret = ch::read_codepoint(range.subspan(lead), unsafe);
+            _retif(ch::read_codepoint_fail(), ret.size_bytes != size - lead);
+            return ret;
+        }
+        /// @see `sys::ch::read_last_codepoint(const std::span<const char32_t>, decltype(unsafe))`
+        static constexpr codepoint_data read_last_codepoint(const std::span<const char> range, decltype(unsafe))
+        {
+            using ctype = ch::unicode_equiv<char>;
+            return read_last_codepoint(std::span<const ctype>(_asr(range.data(), const ctype*), range.size()), unsafe);
+        }
+        /// @see `sys::ch::read_last_codepoint(const std::span<const char32_t>, decltype(unsafe))`
+        static constexpr codepoint_data read_last_codepoint(const std::span<const wchar_t> range, decltype(unsafe))
+        {
+            using ctype = ch::unicode_equiv<wchar_t>;
+            return read_last_codepoint(std::span<const ctype>(_asr(range.data(), const ctype*), range.size()), unsafe);
+        }
+
         /// @brief Writes a codepoint to a buffer.
         /// @param c Codepoint value.
         /// @param out Buffer to write to, which must be at least `sizeof(char32_t)` bytes (2 `char16_t`s or 4 `char8_t`s).
@@ -0,0 +1,191 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Char.h>
+#include <CodepointIterator.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <TextKernels.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Index of the codepoints of a unicode string, for random access by codepoint.
+    /// @details
+    /// Records the offset of every `stride`-th codepoint, so finding the `n`-th decodes at most `stride` codepoints from the nearest sample, rather than every
+    /// codepoint before it. The index is built by counting the code units which start a sequence, using the widest vector instructions available at runtime, and
+    /// counts invalid sequences as one codepoint per code unit, just as `sys::codepoint_iter<T>` decodes them.
+    ///
+    /// Like an iterator, the index refers to the text it was built from, and modifying the text invalidates it. Text appended since can be indexed incrementally
+    /// with `extend(...)`.
+    /// @code{.cpp}
+    /// sys::str doc = load();
+    /// sys::codepoint_index index(doc);
+    /// const char32_t c = index.nth_codepoint(100000_uz);
+    /// doc.append(more);
+    /// index.extend(doc);
+    /// @endcode
+    template <ICharacter T>
+    class codepoint_index final
+    {
+        static constexpr sz max_sequence = sz(sizeof(char32_t) / sizeof(T));
+
+        std::span<const T> text;
+        sz stride;
+        std::vector<sz> samples;
+        sz count = 0_uz;
+
+        static constexpr bool continues_sequence(const T unit) noexcept
+        {
+            if constexpr (sizeof(T) == sizeof(char8_t))
+                return ch::is_continuation(unit);
+            else if constexpr (sizeof(T) == sizeof(char16_t))
+                return ch::is_low_surrogate(unit);
+            else
+                return false;
+        }
+
+        // Index the text after the last sample.
+        constexpr void index_rest()
+        {
+            constexpr sz scalarRun = 32_uz;
+
+            internal::utf_count_leads_kernel<T> kernel = &internal::utf_count_leads_portable<T>;
+            if !consteval
+            {
+                kernel = internal::utf_count_leads_kernel_current<T>();
+            }
+
+            const T* const data = this->text.data();
+            const sz size = sz(this->text.size());
+            sz at = this->samples.back();
+            this->count = sz(this->samples.size() - 1uz) * this->stride;
+            while (at < size)
+            {
+                // Count the valid text up to the next invalid sequence in bulk. Each codepoint is at least one code unit, so the next `untilSample` code units start
+                // at most `untilSample` codepoints, and the kernel can't overshoot the sample. Close to it, step a codepoint at a time instead.
+                const sz validEnd = at + internal::utf_first_invalid(this->text.subspan(at));
+                sz untilSample = this->stride - this->count % this->stride;
+                while (at < validEnd)
+                {
+                    sz leads = 1_uz;
+                    if (untilSample >= scalarRun)
+                    {
+                        const sz units = std::min(untilSample, validEnd - at);
+                        leads = kernel(data + at, units);
+                        at += units;
+                    }
+                    else
+                        at++;
+                    while (at < validEnd && codepoint_index::continues_sequence(data[at]))
+                        at++;
+
+                    this->count += leads;
+                    untilSample -= leads;
+                    if (untilSample == 0_uz)
+                    {
+                        this->samples.push_back(at);
+                        untilSample = this->stride;
+                    }
+                }
+
+                // Then the invalid sequence, a single code unit.
+                if (at < size)
+                {
+                    at++;
+                    this->count++;
+                    if (this->count % this->stride == 0_uz)
+                        this->samples.push_back(at);
+                }
+            }
+        }
+    public:
+        /// @brief Index `text`, recording the offset of every `stride`-th codepoint.
+        /// @pre `stride > 0`
+        constexpr explicit codepoint_index(const std::span<const T> text, const sz stride = 256_uz) : text(text), stride(stride), samples { 0_uz }
+        {
+            this->index_rest();
+        }
+        constexpr codepoint_index(const codepoint_index&) = default;
+        constexpr codepoint_index(codepoint_index&&) noexcept = default;
+        constexpr ~codepoint_index() = default;
+
+        constexpr codepoint_index& operator=(const codepoint_index&) = default;
+        constexpr codepoint_index& operator=(codepoint_index&&) noexcept = default;
+
+        /// @brief Index the code units appended to the text since it was indexed.
+        /// @pre `text` starts with the text last indexed, such as the same string after appending to it.
+        constexpr void extend(const std::span<const T> text)
+        {
+            // The appended code units might finish a sequence cut short at the end of the old text, so the samples in its last `max_sequence - 1` code units might
+            // have moved.
+            const sz oldSize = sz(this->text.size());
+            this->text = text;
+            while (this->samples.size() > 1uz && this->samples.back() + max_sequence - 1_uz > oldSize)
+                this->samples.pop_back();
+            this->index_rest();
+        }
+
+        /// @brief The number of codepoints in the text.
+        [[nodiscard]] constexpr sz codepoint_count() const noexcept { return this->count; }
+
+        /// @brief The offset in code units of the `n`-th codepoint, or of the end of the text if `n == codepoint_count()`.
+        /// @pre `n <= codepoint_count()`
+        [[nodiscard]] constexpr sz unit_offset_of(const sz n) const noexcept
+        {
+            const T* const data = this->text.data();
+            codepoint_iter<T> it(data + this->samples[n / this->stride], data + this->text.size());
+            for (sz i = n % this->stride; i > 0_uz; i--)
+                ++it;
+            return sz(std::to_address(it) - data);
+        }
+        /// @brief The index of the codepoint containing the code unit at `offset`, or `codepoint_count()` if `offset` is the end of the text.
+        /// @pre `offset <= text.size()`
+        [[nodiscard]] constexpr sz codepoint_offset_of(const sz offset) const noexcept
+        {
+            if (offset == this->text.size())
+                return this->count;
+
+            const T* const data = this->text.data();
+            const T* const target = data + offset;
+            const auto sample = std::ranges::upper_bound(this->samples, offset) - 1;
+
+            sz ret = sz(_as(sample - this->samples.begin(), size_t)) * this->stride;
+            codepoint_iter<T> it(data + *sample, data + this->text.size());
+            while (std::to_address(++it) <= target)
+                ret++;
+            return ret;
+        }
+        /// @brief The `n`-th codepoint, U+FFFD if it's an invalid sequence.
+        /// @pre `n < codepoint_count()`
+        [[nodiscard]] constexpr char32_t nth_codepoint(const sz n) const noexcept
+        {
+            const T* const data = this->text.data();
+            return *codepoint_iter<T>(data + this->unit_offset_of(n), data + this->text.size());
+        }
+    };
+
+    template <ICharacter T, typename Allocator>
+    class string;
+
+    template <ICharacter T>
+    codepoint_index(std::span<T>, sz = 256_uz) -> codepoint_index<T>;
+    template <ICharacter T>
+    codepoint_index(std::basic_string_view<T>, sz = 256_uz) -> codepoint_index<T>;
+    template <ICharacter T>
+    codepoint_index(std::basic_string<T>, sz = 256_uz) -> codepoint_index<T>;
+    template <ICharacter T, typename Allocator>
+    codepoint_index(sys::string<T, Allocator>, sz = 256_uz) -> codepoint_index<T>;
+} // namespace sys
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -3,6 +3,8 @@
 /// @file
 
 #include <compare>
+#include <cstddef>
+#include <iterator>
 #include <span>
 #include <string>
 #include <string_view>
@@ -16,18 +18,26 @@ namespace sys
 {
     /// @ingroup sys_text
     /// @brief UTF-32 codepoint view iterator for a unicode string.
+    /// @details Bidirectional, decoding backward with `sys::ch::read_last_codepoint(...)`.
     template <ICharacter T>
     struct codepoint_iter final
     {
     private:
-        const T *cur = nullptr, *end = nullptr;
+        const T *beg = nullptr, *cur = nullptr, *end = nullptr;
         ssz cp_size = 0_z;
     public:
+        using value_type = char32_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::bidirectional_iterator_tag;
+
         /// @brief Uninitialized iterator.
         constexpr codepoint_iter() noexcept = default;
-        /// @brief Construct from a contiguous range.
+        /// @brief Construct from a contiguous range, which can't be iterated backward past `cur`.
         /// @pre `end >= cur`
-        constexpr codepoint_iter(const T* cur, const T* end) noexcept : cur(cur), end(end) { }
+        constexpr codepoint_iter(const T* cur, const T* end) noexcept : beg(cur), cur(cur), end(end) { }
+        /// @brief Construct from a contiguous range starting at `beg`, at `cur`.
+        /// @pre `beg <= cur && cur <= end`, and `cur` is at the start of a sequence.
+        constexpr codepoint_iter(const T* beg, const T* cur, const T* end) noexcept : beg(beg), cur(cur), end(end) { }
         constexpr codepoint_iter(const codepoint_iter&) noexcept = default;
         constexpr codepoint_iter(codepoint_iter&&) noexcept = default;
         constexpr ~codepoint_iter() = default;
@@ -42,6 +52,8 @@ namespace sys
             this->cp_size = ssz(size);
             return c;
         }
+        /// @overload
+        constexpr char32_t operator*() const noexcept { return ch::read_codepoint(std::span(this->cur, this->end), unsafe).c; }
         /// @brief Pointer to the address of the current codepoint.
         constexpr const T* operator->() const noexcept { return this->cur; } // For `std::to_address(...)`.
         friend constexpr bool operator==(const codepoint_iter& a, const codepoint_iter& b) noexcept { return a.cur == b.cur && a.end == b.end; }
@@ -64,6 +76,20 @@ namespace sys
             ++*this;
             return ret;
         }
+        /// @pre `cur > beg`
+        constexpr codepoint_iter& operator--() noexcept
+        {
+            // The size read backward is also the size of the codepoint read forward from the new position.
+            this->cp_size = ssz(ch::read_last_codepoint(std::span(this->beg, this->cur), unsafe).size_bytes);
+            this->cur -= this->cp_size;
+            return *this;
+        }
+        constexpr codepoint_iter operator--(int) noexcept
+        {
+            const codepoint_iter ret = *this;
+            --*this;
+            return ret;
+        }
     };
 
     /// @ingroup sys_text
@@ -76,7 +102,7 @@ namespace sys
     public:
         /// @brief Construct from a contiguous range.
         constexpr /* NOLINT(hicpp-explicit-conversions) */ codepoint_view(const std::span<const T> range) noexcept :
-            _beg(range.data(), range.data() + range.size()), _end(range.data() + range.size(), range.data() + range.size())
+            _beg(range.data(), range.data() + range.size()), _end(range.data(), range.data() + range.size(), range.data() + range.size())
         { }
         constexpr codepoint_view(const codepoint_view&) noexcept = default;
         constexpr codepoint_view(codepoint_view&&) noexcept = default;
@@ -89,7 +115,29 @@ namespace sys
         [[nodiscard]] constexpr codepoint_iter<T> end() const noexcept { return this->_end; }
     };
 
+    /// @ingroup sys_text
+    /// @brief UTF-32 codepoint view for a unicode string, from the last codepoint to the first.
+    /// @details Decodes backward, so the codepoints at the end of a string are reached without decoding those before them.
     template <ICharacter T>
+    struct reverse_codepoint_view final
+    {
+    private:
+        codepoint_view<T> view;
+    public:
+        /// @brief Construct from a contiguous range.
+        constexpr /* NOLINT(hicpp-explicit-conversions) */ reverse_codepoint_view(const std::span<const T> range) noexcept : view(range) { }
+        constexpr reverse_codepoint_view(const reverse_codepoint_view&) noexcept = default;
+        constexpr reverse_codepoint_view(reverse_codepoint_view&&) noexcept = default;
+        constexpr ~reverse_codepoint_view() = default;
+
+        constexpr reverse_codepoint_view& operator=(const reverse_codepoint_view&) noexcept = default;
+        constexpr reverse_codepoint_view& operator=(reverse_codepoint_view&&) noexcept = default;
+
+        [[nodiscard]] constexpr std::reverse_iterator<codepoint_iter<T>> begin() const noexcept { return std::reverse_iterator(this->view.end()); }
+        [[nodiscard]] constexpr std::reverse_iterator<codepoint_iter<T>> end() const noexcept { return std::reverse_iterator(this->view.begin()); }
+    };
+
+    template <ICharacter T, typename Allocator>
     class string;
 
     template <ICharacter T>
@@ -98,6 +146,15 @@ namespace sys
     codepoint_view(std::basic_string_view<T>) -> codepoint_view<T>;
     template <ICharacter T>
     codepoint_view(std::basic_string<T>) -> codepoint_view<T>;
+    template <ICharacter T, typename Allocator>
+    codepoint_view(sys::string<T, Allocator>) -> codepoint_view<T>;
+
+    template <ICharacter T>
+    reverse_codepoint_view(std::span<T>) -> reverse_codepoint_view<T>;
+    template <ICharacter T>
+    reverse_codepoint_view(std::basic_string_view<T>) -> reverse_codepoint_view<T>;
     template <ICharacter T>
-    codepoint_view(sys::string<T>) -> codepoint_view<T>;
+    reverse_codepoint_view(std::basic_string<T>) -> reverse_codepoint_view<T>;
+    template <ICharacter T, typename Allocator>
+    reverse_codepoint_view(sys::string<T, Allocator>) -> reverse_codepoint_view<T>;
 } // namespace sys
@@ -0,0 +1,212 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <Char.h>
+#include <CodepointIterator.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <data/UnicodeCasing.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The case folded codepoints of a string, as folded by `sys::string::folded(...)`, produced one at a time without materializing the folded string.
+    /// @details ASCII code units fold on their own, without decoding or looking up the casing tables, unless `lang` folds `I` specially.
+    /// @attention Lifetime assumptions! The string and `lang` must outlive `this`.
+    template <ICharacter T>
+    class fold_stream final
+    {
+        const T* cur;
+        const T* end;
+        std::u8string_view lang;
+        bool ascii_folds_simply;
+        // Codepoints of a full folding not yet produced.
+        char32_t pending[3] {};
+        sz pending_at = 0_uz, pending_size = 0_uz;
+    public:
+        constexpr fold_stream(const std::basic_string_view<T> str, const std::u8string_view lang) noexcept :
+            cur(str.data()), end(str.data() + str.size()), lang(lang), ascii_folds_simply(lang != u8"tr" && lang != u8"az")
+        { }
+
+        /// @brief Produce the next folded codepoint into `out`.
+        /// @return Whether there was one, or the string is exhausted.
+        constexpr bool next(char32_t& out) noexcept
+        {
+            if (this->pending_at < this->pending_size)
+            {
+                out = this->pending[this->pending_at++]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                return true;
+            }
+            _retif(false, this->cur == this->end);
+
+            if (const auto unit = _as(*this->cur, uint32_t); unit < 0x80u && this->ascii_folds_simply)
+            {
+                out = _as(unit - U'A' < 26u ? unit + 0x20u : unit, char32_t);
+                this->cur++;
+                return true;
+            }
+
+            const auto [c, size] = ch::read_codepoint(std::span<const T>(this->cur, this->end), unsafe);
+            this->cur += size;
+            this->pending_size = internal::dchar_fold_special(this->pending /* NOLINT(hicpp-no-array-decay) */, c, this->lang, unsafe);
+            this->pending_at = 1_uz;
+            out = this->pending[0];
+            return true;
+        }
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief View of any string type `sys::fold_hasher` and `sys::fold_equal` accept.
+    template <ICharacter T>
+    constexpr std::basic_string_view<T> fold_view(const std::basic_string_view<T> str) noexcept
+    {
+        return str;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    template <ICharacter T, typename Allocator>
+    constexpr std::basic_string_view<T> fold_view(const std::basic_string<T, std::char_traits<T>, Allocator>& str) noexcept
+    {
+        return str;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    template <ICharacter T, typename Allocator>
+    constexpr std::basic_string_view<T> fold_view(const sys::string<T, Allocator>& str) noexcept
+    {
+        return std::basic_string_view<T>(str);
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The length of the longest common prefix of `a` and `b` which ends on a codepoint boundary in both, which therefore folds identically in both.
+    template <ICharacter T>
+    constexpr sz fold_common_prefix(const std::basic_string_view<T> a, const std::basic_string_view<T> b) noexcept
+    {
+        sz ret = sz(std::mismatch(a.begin(), a.end(), b.begin(), b.end()).first - a.begin());
+        _retif(ret, ret == a.size() && ret == b.size());
+        if constexpr (sizeof(T) < sizeof(char32_t))
+        {
+            // Step back off the unit which differs, to the start of a codepoint, so the codepoint straddling the mismatch (if any) is decoded in full on both sides.
+            const auto startsCodepoint = [](const T unit) noexcept -> bool
+            {
+                if constexpr (sizeof(T) == sizeof(char8_t))
+                    return !ch::is_continuation(unit);
+                else
+                    return !ch::is_low_surrogate(unit);
+            };
+            const sz mismatch = ret;
+            while (ret && (ret == mismatch || !startsCodepoint(a[ret])))
+                ret--;
+        }
+        return ret;
+    }
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Whether `a` and `b` are equal once case folded, without folding either into a new string.
+    /// @details Equivalent to `sys::string(a).folded(lang) == sys::string(b).folded(lang)`, across encodings. A common prefix of identical code units is skipped in bulk.
+    template <ICharacter T, ICharacter U>
+    [[nodiscard]] constexpr bool fold_equals(const std::basic_string_view<T> a, const std::basic_string_view<U> b, const std::u8string_view lang = u8"") noexcept
+    {
+        sz prefix = 0_uz;
+        if constexpr (std::same_as<T, U>)
+            prefix = internal::fold_common_prefix(a, b);
+        _retif(true, prefix == a.size() && prefix == b.size());
+
+        internal::fold_stream<T> as(a.substr(prefix), lang);
+        internal::fold_stream<U> bs(b.substr(prefix), lang);
+        while (true)
+        {
+            char32_t ca = 0, cb = 0;
+            const bool hasA = as.next(ca), hasB = bs.next(cb);
+            _retif(hasA == hasB, !hasA || !hasB);
+            _retif(false, ca != cb);
+        }
+    }
+    /// @ingroup sys_text
+    /// @brief Lexicographically compare the case folded codepoints of `a` and `b`, without folding either into a new string.
+    /// @details Equivalent to comparing `sys::string(a).folded(lang)` to `sys::string(b).folded(lang)` codepoint by codepoint, across encodings.
+    template <ICharacter T, ICharacter U>
+    [[nodiscard]] constexpr std::strong_ordering fold_compare(const std::basic_string_view<T> a, const std::basic_string_view<U> b, const std::u8string_view lang = u8"") noexcept
+    {
+        sz prefix = 0_uz;
+        if constexpr (std::same_as<T, U>)
+            prefix = internal::fold_common_prefix(a, b);
+
+        internal::fold_stream<T> as(a.substr(prefix), lang);
+        internal::fold_stream<U> bs(b.substr(prefix), lang);
+        while (true)
+        {
+            char32_t ca = 0, cb = 0;
+            const bool hasA = as.next(ca), hasB = bs.next(cb);
+            _retif(hasA <=> hasB, !hasA || !hasB);
+            _retif(ca <=> cb, ca != cb);
+        }
+    }
+    /// @ingroup sys_text
+    /// @brief Hash the case folded codepoints of `str`, without folding it into a new string.
+    /// @details Strings which are `sys::fold_equals(...)` hash equally, across encodings.
+    template <ICharacter T>
+    [[nodiscard]] constexpr size_t fold_hash(const std::basic_string_view<T> str, const std::u8string_view lang = u8"") noexcept
+    {
+        // 64-bit FNV-1a, over whole codepoints.
+        uint64_t ret = 0xCBF29CE484222325u;
+        internal::fold_stream<T> s(str, lang);
+        for (char32_t c = 0; s.next(c);)
+            ret = (ret ^ _as(c, uint64_t)) * 0x100000001B3u;
+        return _as(ret, size_t);
+    }
+
+    /// @ingroup sys_text
+    /// @brief Transparent hasher for case-insensitive unordered containers, with `sys::fold_equal`.
+    /// @code{.cpp}
+    /// std::unordered_map<sys::str, int, sys::fold_hasher, sys::fold_equal> headers;
+    /// headers.find(std::u8string_view(u8"Content-Length"));
+    /// @endcode
+    struct fold_hasher final
+    {
+        using is_transparent = void;
+
+        template <typename S>
+        requires requires(const S& str) { internal::fold_view(str); }
+        [[nodiscard]] constexpr size_t operator()(const S& str) const noexcept
+        {
+            return sys::fold_hash(internal::fold_view(str));
+        }
+    };
+    /// @ingroup sys_text
+    /// @brief Transparent equality for case-insensitive unordered containers, with `sys::fold_hasher`.
+    struct fold_equal final
+    {
+        using is_transparent = void;
+
+        template <typename A, typename B>
+        requires requires(const A& a, const B& b) {
+            internal::fold_view(a);
+            internal::fold_view(b);
+        }
+        [[nodiscard]] constexpr bool operator()(const A& a, const B& b) const noexcept
+        {
+            return sys::fold_equals(internal::fold_view(a), internal::fold_view(b));
+        }
+    };
+} // namespace sys
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Arena with an inline buffer of `Capacity` bytes, which spills to `upstream`, the heap by default, once the buffer is exhausted.
+    /// @details
+    /// Allocations are only bumped through the buffer, and deallocations are no-ops, memory being reclaimed all at once by `release()` or destruction. Short lived
+    /// strings, such as the pieces of a line being parsed, can so be allocated without touching the heap at all, by declaring the arena on the stack and allocating
+    /// the strings from it as `sys::pmr::string<T>`.
+    /// @code{.cpp}
+    /// sys::inline_buffer_resource<4096> arena;
+    /// const sys::pmr::str line(text, &arena);
+    /// const sys::pmr::str key = line.substr(0_uz, line.find_index(u8'=')).trimmed();
+    /// @endcode
+    template <size_t Capacity>
+    class inline_buffer_resource final : public std::pmr::memory_resource
+    {
+        alignas(std::max_align_t) std::byte buffer[Capacity];
+        std::pmr::monotonic_buffer_resource arena;
+
+        void* do_allocate(const size_t bytes, const size_t alignment) override { return this->arena.allocate(bytes, alignment); }
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t alignment) override { this->arena.deallocate(ptr, bytes, alignment); }
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    public:
+        /// @brief Empty arena, spilling to `upstream`.
+        explicit inline_buffer_resource(std::pmr::memory_resource* const upstream = std::pmr::new_delete_resource()) noexcept :
+            arena(this->buffer /* NOLINT(hicpp-no-array-decay) */, Capacity, upstream)
+        { }
+        inline_buffer_resource(const inline_buffer_resource&) = delete;
+        inline_buffer_resource(inline_buffer_resource&&) = delete;
+        ~inline_buffer_resource() override = default;
+
+        inline_buffer_resource& operator=(const inline_buffer_resource&) = delete;
+        inline_buffer_resource& operator=(inline_buffer_resource&&) = delete;
+
+        /// @brief Free everything allocated, returning anything spilled to `upstream`, and start again from the start of the inline buffer.
+        /// @attention Lifetime assumptions! No string allocated from the arena can be used after.
+        void release() { this->arena.release(); }
+    };
+} // namespace sys
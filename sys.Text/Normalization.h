@@ -0,0 +1,250 @@
+#pragma once
+
+/// @file
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <Char.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <data/UnicodeCCC.h>
+#include <data/UnicodeNormalization.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Unicode normalization form.
+    /// @see [Unicode Standard Annex #15, "Unicode Normalization Forms"](https://www.unicode.org/reports/tr15/).
+    enum class normalization_form : uint_least8_t
+    {
+        /// @brief Canonical decomposition, followed by canonical composition.
+        nfc,
+        /// @brief Canonical decomposition.
+        nfd,
+        /// @brief Compatibility decomposition, followed by canonical composition.
+        nfkc,
+        /// @brief Compatibility decomposition.
+        nfkd
+    };
+} // namespace sys
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Result of a normalization quick check, as the `NF*_QC` properties of UAX #15.
+    enum class normalization_quick_check_result : uint_least8_t
+    {
+        yes,
+        no,
+        maybe
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    struct normalization_quick_check_data
+    {
+        normalization_quick_check_result result;
+        /// @brief Length of the prefix known to be normalized, ending before a starter which doesn't interact with anything before it.
+        /// @details Normalizing the string is then equivalent to normalizing only what follows the prefix. The whole string if it's normalized.
+        sz stable;
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool normalization_is_compat(const normalization_form form) noexcept { return form == normalization_form::nfkc || form == normalization_form::nfkd; }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool normalization_is_composed(const normalization_form form) noexcept { return form == normalization_form::nfc || form == normalization_form::nfkc; }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Hangul syllable, leading and vowel jamo, and trailing jamo (less one, as a syllable without one has `T` index 0) ranges.
+    inline constexpr char32_t hangul_s_base = U'\uAC00', hangul_l_base = U'\u1100', hangul_v_base = U'\u1161', hangul_t_base = U'\u11A7';
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint32_t hangul_l_count = 19u, hangul_v_count = 21u, hangul_t_count = 28u, hangul_s_count = hangul_l_count * hangul_v_count * hangul_t_count;
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append the full canonical, or with `compat` compatibility, decomposition of `c` to `out`, decomposing Hangul syllables algorithmically.
+    constexpr void normalization_decompose(const char32_t c, const bool compat, std::u32string& out)
+    {
+        if (const uint32_t s = _as(c, uint32_t) - hangul_s_base; s < hangul_s_count)
+        {
+            out.push_back(_as(hangul_l_base + s / (hangul_v_count * hangul_t_count), char32_t));
+            out.push_back(_as(hangul_v_base + (s % (hangul_v_count * hangul_t_count)) / hangul_t_count, char32_t));
+            if (s % hangul_t_count != 0u)
+                out.push_back(_as(hangul_t_base + s % hangul_t_count, char32_t));
+            return;
+        }
+
+        const std::u32string_view decomposition = internal::dchar_decomposition(c, compat);
+        if (decomposition.empty())
+            out.push_back(c);
+        else
+            out.append(decomposition);
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Primary composite of `first` and `second`, composing Hangul syllables algorithmically, or U+0000 if there is none.
+    constexpr char32_t normalization_compose(const char32_t first, const char32_t second) noexcept
+    {
+        if (const uint32_t l = _as(first, uint32_t) - hangul_l_base, v = _as(second, uint32_t) - hangul_v_base; l < hangul_l_count && v < hangul_v_count)
+            return _as(hangul_s_base + (l * hangul_v_count + v) * hangul_t_count, char32_t);
+        if (const uint32_t s = _as(first, uint32_t) - hangul_s_base, t = _as(second, uint32_t) - hangul_t_base;
+            s < hangul_s_count && s % hangul_t_count == 0u && t - 1u < hangul_t_count - 1u)
+            return _as(first + t, char32_t);
+        return internal::dchar_compose(first, second);
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Whether `str` is in normalization form `form`, as far as can be told without normalizing it.
+    /// @details Invalid code units are never normalized, normalizing replaces them with U+FFFD.
+    template <ICharacter T>
+    constexpr normalization_quick_check_data normalization_quick_check(const std::basic_string_view<T> str, const normalization_form form) noexcept
+    {
+        const uint_least8_t no = form == normalization_form::nfc    ? normalization_flag_nfc_no
+                                 : form == normalization_form::nfd  ? normalization_flag_nfd_no
+                                 : form == normalization_form::nfkc ? normalization_flag_nfkc_no
+                                                                    : normalization_flag_nfkd_no;
+        const uint_least8_t maybe = form == normalization_form::nfc    ? normalization_flag_nfc_maybe
+                                    : form == normalization_form::nfkc ? normalization_flag_nfkc_maybe
+                                                                       : uint_least8_t(0);
+
+        normalization_quick_check_data ret { .result = normalization_quick_check_result::yes, .stable = 0_uz };
+        uint_least8_t lastCcc = 0;
+        for (sz i = 0_uz; i < str.size();)
+        {
+            // ASCII is normalized in every form, and never interacts with its neighbours.
+            if (_as(str[i], uint32_t) < 0x80u)
+            {
+                while (i < str.size() && _as(str[i], uint32_t) < 0x80u)
+                    i++;
+                if (ret.result == normalization_quick_check_result::yes)
+                    ret.stable = i - 1_uz;
+                lastCcc = 0;
+                continue;
+            }
+
+            const auto [c, size] = ch::read_codepoint(std::span<const T>(str.substr(i)), unsafe);
+            const bool invalid = c == ch::replacement<char32_t>()[0] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */ &&
+                str.substr(i, size) != ch::replacement<T>();
+            const auto ccc = _as(internal::dchar_ccc(c), uint_least8_t);
+            const uint_least8_t flags = internal::dchar_normalization_record(c).flags;
+            if (invalid || (ccc != 0u && lastCcc > ccc) || (flags & no) != 0u)
+            {
+                ret.result = normalization_quick_check_result::no;
+                return ret;
+            }
+            if (ret.result == normalization_quick_check_result::yes)
+            {
+                if ((flags & maybe) != 0u)
+                    ret.result = normalization_quick_check_result::maybe;
+                else if (ccc == 0u)
+                    ret.stable = i;
+            }
+            lastCcc = ccc;
+            i += size;
+        }
+
+        if (ret.result == normalization_quick_check_result::yes)
+            ret.stable = sz(str.size());
+        return ret;
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append `str` in normalization form `form` to `out`, replacing invalid code units with U+FFFD.
+    template <ICharacter T, typename Allocator>
+    constexpr void normalize_append(const std::basic_string_view<T> str, const normalization_form form, std::basic_string<T, std::char_traits<T>, Allocator>& out)
+    {
+        const bool compat = internal::normalization_is_compat(form);
+        std::u32string buf;
+        buf.reserve(str.size());
+        for (sz i = 0_uz; i < str.size();)
+        {
+            const auto [c, size] = ch::read_codepoint(std::span<const T>(str.substr(i)), unsafe);
+            internal::normalization_decompose(c, compat, buf);
+            i += size;
+        }
+
+        // Canonical ordering, stably sorting each run of non-starters by combining class. Runs are short, so insertion sort it is.
+        for (size_t i = 1uz; i < buf.size(); i++)
+        {
+            const char32_t c = buf[i];
+            const canonical_combining_class ccc = internal::dchar_ccc(c);
+            if (ccc == canonical_combining_class::not_reordered)
+                continue;
+
+            size_t j = i;
+            for (; j > 0uz; j--)
+            {
+                const canonical_combining_class prev = internal::dchar_ccc(buf[j - 1uz]);
+                if (prev == canonical_combining_class::not_reordered || prev <= ccc)
+                    break;
+                buf[j] = buf[j - 1uz];
+            }
+            buf[j] = c;
+        }
+
+        if (internal::normalization_is_composed(form) && !buf.empty())
+        {
+            // Canonical composition, each codepoint combining with the last starter unless blocked by a codepoint in between of the same or a higher combining class.
+            size_t starter = 0uz, at = 1uz;
+            // A leading non-starter has no starter to combine with, so is treated as blocking.
+            uint32_t lastCcc = internal::dchar_ccc(buf[0]) == canonical_combining_class::not_reordered ? 0u : 256u;
+            for (size_t i = 1uz; i < buf.size(); i++)
+            {
+                const char32_t c = buf[i];
+                const auto ccc = _as(internal::dchar_ccc(c), uint32_t);
+                if (const char32_t composite = internal::normalization_compose(buf[starter], c); composite != U'\0' && (lastCcc < ccc || lastCcc == 0u))
+                {
+                    buf[starter] = composite;
+                    continue;
+                }
+
+                if (ccc == 0u)
+                    starter = at;
+                lastCcc = ccc;
+                buf[at++] = c;
+            }
+            buf.resize(at);
+        }
+
+        out.reserve(out.size() + str.size());
+        for (const char32_t c : buf)
+        {
+            T units[sizeof(char32_t) / sizeof(T)];
+            const sz count = ch::write_codepoint(c, units /* NOLINT(hicpp-no-array-decay) */, unsafe);
+            out.append(units /* NOLINT(hicpp-no-array-decay) */, count);
+        }
+    }
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Whether `str` is in normalization form `form`.
+    /// @details Most text is, and is verified in a single pass without allocating, by the quick check properties of UAX #15. Text which may or may not be normalized
+    /// (`NFC_QC=Maybe`) is normalized from its last stable codepoint on, and compared.
+    template <ICharacter T>
+    [[nodiscard]] constexpr bool is_normalized(const std::basic_string_view<T> str, const normalization_form form = normalization_form::nfc)
+    {
+        const auto [result, stable] = internal::normalization_quick_check(str, form);
+        if (result != internal::normalization_quick_check_result::maybe)
+            return result == internal::normalization_quick_check_result::yes;
+
+        std::basic_string<T> tail;
+        internal::normalize_append(str.substr(stable), form, tail);
+        return str.substr(stable) == tail;
+    }
+} // namespace sys
+
+// NOLINTEND(readability-magic-numbers)
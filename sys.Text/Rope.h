@@ -0,0 +1,617 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <Char.h>
+#include <CodepointIterator.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <StringEx.h>
+#include <TextKernels.h>
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Node of a `sys::rope<T>`, immutable once built, so shared between ropes.
+    /// @details A leaf holds a chunk of valid `text`, any other node the concatenation of `left` and `right`. The counts are of the whole subtree.
+    template <ICharacter T>
+    struct rope_node final
+    {
+        std::shared_ptr<const rope_node> left, right;
+        std::basic_string<T> text;
+        sz units = 0_uz, codepoints = 0_uz, newlines = 0_uz;
+        sz height = 1_uz;
+
+        [[nodiscard]] bool is_leaf() const noexcept { return !this->left; }
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The leaf of `root` containing the code unit at `offset`, or the last leaf if `offset` is the end, setting `leafStart` to the offset it starts at.
+    /// @pre `offset <= root->units`
+    template <ICharacter T>
+    const rope_node<T>* rope_leaf_at(const rope_node<T>* root, sz offset, sz& leafStart) noexcept
+    {
+        leafStart = 0_uz;
+        while (!root->is_leaf())
+        {
+            if (offset < root->left->units)
+                root = root->left.get();
+            else
+            {
+                offset -= root->left->units;
+                leafStart += root->left->units;
+                root = root->right.get();
+            }
+        }
+        return root;
+    }
+} // namespace sys::internal
+
+namespace sys
+{
+    template <ICharacter T>
+    class rope;
+
+    /// @ingroup sys_text
+    /// @brief UTF-32 codepoint iterator for a `sys::rope<T>`.
+    /// @details Bidirectional, decoding within a chunk just as `sys::codepoint_iter<T>`, and finding the next or previous chunk from the root in O(log n).
+    template <ICharacter T>
+    struct rope_iter final
+    {
+    private:
+        const internal::rope_node<T>* root = nullptr;
+        sz leaf_start = 0_uz;
+        const internal::rope_node<T>* leaf = nullptr;
+        codepoint_iter<T> it {};
+
+        // At the code unit `offset`, in the leaf containing it.
+        rope_iter(const internal::rope_node<T>* const root, const sz offset) noexcept : root(root), leaf(internal::rope_leaf_at(root, offset, this->leaf_start))
+        {
+            const T* const data = this->leaf->text.data();
+            this->it = codepoint_iter<T>(data, data + *(offset - this->leaf_start), data + this->leaf->text.size()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        friend class rope<T>;
+    public:
+        using value_type = char32_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::bidirectional_iterator_tag;
+
+        /// @brief Uninitialized iterator, also the iterator of an empty rope.
+        rope_iter() noexcept = default;
+        rope_iter(const rope_iter&) noexcept = default;
+        rope_iter(rope_iter&&) noexcept = default;
+        ~rope_iter() = default;
+
+        rope_iter& operator=(const rope_iter&) noexcept = default;
+        rope_iter& operator=(rope_iter&&) noexcept = default;
+
+        /// @brief Codepoint value for current position.
+        char32_t operator*() noexcept { return *this->it; }
+        /// @overload
+        char32_t operator*() const noexcept { return *this->it; }
+        friend bool operator==(const rope_iter& a, const rope_iter& b) noexcept { return a.it == b.it; }
+
+        rope_iter& operator++() noexcept
+        {
+            // The end of a leaf is only ever the position of an iterator if it's the end of the rope, otherwise it's the start of the next leaf.
+            ++this->it;
+            if (std::to_address(this->it) == this->leaf->text.data() + this->leaf->text.size() /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */ &&
+                this->leaf_start + this->leaf->units < this->root->units)
+                *this = rope_iter(this->root, this->leaf_start + this->leaf->units);
+            return *this;
+        }
+        rope_iter operator++(int) noexcept
+        {
+            const rope_iter ret = *this;
+            ++*this;
+            return ret;
+        }
+        /// @pre The iterator isn't at the start of the rope.
+        rope_iter& operator--() noexcept
+        {
+            if (std::to_address(this->it) == this->leaf->text.data())
+            {
+                rope_iter prev(this->root, this->leaf_start - 1_uz);
+                const T* const data = prev.leaf->text.data();
+                const T* const end = data + prev.leaf->text.size(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                prev.it = codepoint_iter<T>(data, end, end);
+                *this = prev;
+            }
+            --this->it;
+            return *this;
+        }
+        rope_iter operator--(int) noexcept
+        {
+            const rope_iter ret = *this;
+            --*this;
+            return ret;
+        }
+    };
+
+    /// @ingroup sys_text
+    /// @brief Unicode text container for large, frequently edited documents.
+    /// @details
+    /// The text is held in chunks of at most a few KiB, the leaves of a balanced binary tree, whose every node caches the code units, codepoints and newlines
+    /// beneath it. Inserting, erasing and taking substrings anywhere, finding the `n`-th codepoint and the start of a line, are so O(log n), rather than moving
+    /// everything after the edit as in a contiguous `sys::string<T>`. Positions are codepoint offsets.
+    ///
+    /// Nodes are never modified once built, edits instead building new nodes along the path to the root, and sharing the rest. Copying a rope is so an O(1)
+    /// snapshot, unaffected by edits of either afterward, which can be read from another thread while the original is edited.
+    ///
+    /// To keep every chunk decodable alone, the text is kept valid, invalid sequences being replaced with U+FFFD as it's inserted.
+    /// @code{.cpp}
+    /// sys::rope doc(load());
+    /// const sys::rope<char8_t> saved = doc;
+    /// doc.insert(doc.line_start(100_uz), u8"// TODO\n").erase(0_uz, 10_uz);
+    /// for (const char32_t c : saved.substr(0_uz, 100_uz))
+    ///     process(c);
+    /// @endcode
+    template <ICharacter T>
+    class rope final
+    {
+        using node = internal::rope_node<T>;
+        using node_ptr = std::shared_ptr<const node>;
+
+        // Large enough that the tree of even a large document has few nodes, small enough that editing within a chunk copies little.
+        static constexpr sz max_chunk = sz(4096uz / sizeof(T));
+
+        node_ptr root;
+
+        explicit rope(node_ptr root) noexcept : root(std::move(root)) { }
+
+        static constexpr bool continues_sequence(const T unit) noexcept
+        {
+            if constexpr (sizeof(T) == sizeof(char8_t))
+                return ch::is_continuation(unit);
+            else if constexpr (sizeof(T) == sizeof(char16_t))
+                return ch::is_low_surrogate(unit);
+            else
+                return false;
+        }
+        // The offset in code units of the `at`-th codepoint of `text`.
+        static sz unit_offset_in(const std::basic_string_view<T> text, sz at) noexcept
+        {
+            if constexpr (sizeof(T) == sizeof(char32_t))
+                return at;
+            else
+            {
+                sz ret = 0_uz;
+                for (; at > 0_uz; at--)
+                {
+                    ret++;
+                    while (ret < text.size() && rope::continues_sequence(text[ret]))
+                        ret++;
+                }
+                return ret;
+            }
+        }
+
+        // Internal: Building and rebalancing nodes.
+
+        static node_ptr leaf(std::basic_string<T> text)
+        {
+            node ret { .text = std::move(text) };
+            ret.units = sz(ret.text.size());
+            ret.codepoints = internal::utf_count_leads_kernel_current<T>()(ret.text.data(), ret.units);
+            ret.newlines = sz(_as(std::ranges::count(ret.text, T('\n')), size_t));
+            return std::make_shared<const node>(std::move(ret));
+        }
+        static node_ptr concat(node_ptr left, node_ptr right)
+        {
+            node ret { .left = std::move(left), .right = std::move(right) };
+            ret.units = ret.left->units + ret.right->units;
+            ret.codepoints = ret.left->codepoints + ret.right->codepoints;
+            ret.newlines = ret.left->newlines + ret.right->newlines;
+            ret.height = std::max(ret.left->height, ret.right->height) + 1_uz;
+            return std::make_shared<const node>(std::move(ret));
+        }
+        /// Concatenate `left` and `right`, whose heights differ by at most two, rotating so that the result's differ by at most one.
+        static node_ptr balance(node_ptr left, node_ptr right)
+        {
+            if (left->height > right->height + 1_uz)
+            {
+                if (left->left->height >= left->right->height)
+                    return rope::concat(left->left, rope::concat(left->right, std::move(right)));
+                return rope::concat(rope::concat(left->left, left->right->left), rope::concat(left->right->right, std::move(right)));
+            }
+            if (right->height > left->height + 1_uz)
+            {
+                if (right->right->height >= right->left->height)
+                    return rope::concat(rope::concat(std::move(left), right->left), right->right);
+                return rope::concat(rope::concat(std::move(left), right->left->left), rope::concat(right->left->right, right->right));
+            }
+            return rope::concat(std::move(left), std::move(right));
+        }
+        /// Concatenate balanced trees of any height, in O(the difference of their heights).
+        static node_ptr link(node_ptr left, node_ptr right)
+        {
+            _retif(right, !left);
+            _retif(left, !right);
+            if (left->height > right->height + 1_uz)
+                return rope::balance(left->left, rope::link(left->right, std::move(right)));
+            if (right->height > left->height + 1_uz)
+                return rope::balance(rope::link(std::move(left), right->left), right->right);
+            return rope::concat(std::move(left), std::move(right));
+        }
+        static node_ptr without_first(const node_ptr& n) { return n->is_leaf() ? node_ptr() : rope::link(rope::without_first(n->left), n->right); }
+        static node_ptr without_last(const node_ptr& n) { return n->is_leaf() ? node_ptr() : rope::link(n->left, rope::without_last(n->right)); }
+        /// As `link(...)`, but merging the leaves either side of the seam if they fit in one, so repeated edits in the same place don't fragment the text.
+        static node_ptr join(node_ptr left, node_ptr right)
+        {
+            _retif(right, !left);
+            _retif(left, !right);
+
+            const node* last = left.get();
+            while (!last->is_leaf())
+                last = last->right.get();
+            const node* first = right.get();
+            while (!first->is_leaf())
+                first = first->left.get();
+            _retif(rope::link(std::move(left), std::move(right)), last->units + first->units > max_chunk);
+
+            std::basic_string<T> text;
+            text.reserve(last->units + first->units);
+            text.append(last->text).append(first->text);
+            return rope::link(rope::link(rope::without_last(left), rope::leaf(std::move(text))), rope::without_first(right));
+        }
+        /// The leaf holding the codepoint `at`, or the last leaf if `at` is the end, making `at` an offset into it.
+        static const node* leaf_of(const node* n, sz& at) noexcept
+        {
+            while (!n->is_leaf())
+            {
+                if (at < n->left->codepoints)
+                    n = n->left.get();
+                else
+                {
+                    at -= n->left->codepoints;
+                    n = n->right.get();
+                }
+            }
+            return n;
+        }
+        /// Copy of `n` with the text of the leaf `leaf_of(n, at)` replaced by `edit(text, offset)`, where `offset` is `at` in code units, sharing the rest.
+        template <typename Edit>
+        static node_ptr edited(const node_ptr& n, const sz at, const Edit& edit)
+        {
+            if (n->is_leaf())
+                return rope::leaf(edit(n->text, rope::unit_offset_in(n->text, at)));
+            if (at < n->left->codepoints)
+                return rope::concat(rope::edited(n->left, at, edit), n->right);
+            return rope::concat(n->left, rope::edited(n->right, at - n->left->codepoints, edit));
+        }
+        /// Split `n` before the codepoint `at`.
+        static std::pair<node_ptr, node_ptr> split(const node_ptr& n, const sz at)
+        {
+            _retif(std::pair(node_ptr(), node_ptr()), !n);
+            _retif(std::pair(node_ptr(), n), at == 0_uz);
+            _retif(std::pair(n, node_ptr()), at >= n->codepoints);
+
+            if (n->is_leaf())
+            {
+                const sz offset = rope::unit_offset_in(n->text, at);
+                return { rope::leaf(n->text.substr(0uz, offset)), rope::leaf(n->text.substr(offset)) };
+            }
+            if (at < n->left->codepoints)
+            {
+                auto [left, right] = rope::split(n->left, at);
+                return { std::move(left), rope::link(std::move(right), n->right) };
+            }
+            auto [left, right] = rope::split(n->right, at - n->left->codepoints);
+            return { rope::link(n->left, std::move(left)), std::move(right) };
+        }
+        static node_ptr build_balanced(const std::span<node_ptr> leaves)
+        {
+            _retif(node_ptr(), leaves.empty());
+            _retif(std::move(leaves.front()), leaves.size() == 1uz);
+            const size_t mid = leaves.size() / 2uz;
+            return rope::concat(rope::build_balanced(leaves.first(mid)), rope::build_balanced(leaves.subspan(mid)));
+        }
+        /// A balanced tree of `text`, with invalid sequences replaced.
+        static node_ptr build(const std::basic_string_view<T> text)
+        {
+            const sz invalid = internal::utf_first_invalid(std::span<const T>(text));
+            if (invalid != text.size())
+            {
+                std::basic_string<T> replaced;
+                replaced.reserve(text.size());
+                internal::invalids_replaced_append(std::span<const T>(text), invalid, replaced);
+                return rope::build(replaced);
+            }
+
+            // Chunks are cut between sequences, so each decodes alone, and are left room to insert into.
+            constexpr sz chunk = max_chunk / 4_uz * 3_uz;
+
+            std::vector<node_ptr> leaves;
+            leaves.reserve(text.size() / chunk + 1uz);
+            for (sz from = 0_uz; from < text.size();)
+            {
+                sz to = std::min(from + chunk, sz(text.size()));
+                while (to < text.size() && rope::continues_sequence(text[to]))
+                    to--;
+                leaves.push_back(rope::leaf(std::basic_string<T>(text.substr(from, to - from))));
+                from = to;
+            }
+            return rope::build_balanced(leaves);
+        }
+
+        /// Visit the leaves in order, stopping once `visit` returns `false`.
+        template <typename Visitor>
+        static bool visit_chunks(const node* const n, const Visitor& visit)
+        {
+            if (n->is_leaf())
+                return visit(std::basic_string_view<T>(n->text));
+            return rope::visit_chunks(n->left.get(), visit) && rope::visit_chunks(n->right.get(), visit);
+        }
+        /// Whether the text at the code unit `offset` starts with `text`.
+        bool matches_at(sz offset, std::basic_string_view<T> text) const noexcept
+        {
+            while (!text.empty())
+            {
+                sz leafStart = 0_uz;
+                const node* const leaf = internal::rope_leaf_at(this->root.get(), offset, leafStart);
+                const std::basic_string_view<T> chunk = std::basic_string_view<T>(leaf->text).substr(offset - leafStart, text.size());
+                _retif(false, !text.starts_with(chunk));
+                text.remove_prefix(chunk.size());
+                offset += sz(chunk.size());
+            }
+            return true;
+        }
+    public:
+        /// @brief Empty rope.
+        rope() noexcept = default;
+        /// @brief Rope of `text`, with invalid sequences replaced with U+FFFD.
+        explicit rope(const std::basic_string_view<T> text) : root(rope::build(text)) { }
+        /// @brief Copy of `other`, sharing its chunks.
+        rope(const rope&) noexcept = default;
+        rope(rope&&) noexcept = default;
+        ~rope() = default;
+
+        rope& operator=(const rope&) noexcept = default;
+        rope& operator=(rope&&) noexcept = default;
+
+        friend bool operator==(const rope& a, const std::basic_string_view<T> b) noexcept { return a.size() == b.size() && a.matches_at(0_uz, b); }
+        friend bool operator==(const rope& a, const rope& b) noexcept
+        {
+            _retif(true, a.root == b.root);
+            _retif(false, a.size() != b.size());
+
+            sz at = 0_uz;
+            return rope::visit_chunks(a.root.get(), [&](const std::basic_string_view<T> chunk) -> bool
+            {
+                const bool ret = b.matches_at(at, chunk);
+                at += sz(chunk.size());
+                return ret;
+            });
+        }
+
+        /// @brief Copy the text into a contiguous string, allocating once, with `alloc`.
+        template <typename Allocator = std::allocator<T>>
+        [[nodiscard]] string<T, Allocator> to_string(const Allocator& alloc = Allocator()) const
+        {
+            std::basic_string<T, std::char_traits<T>, Allocator> ret(alloc);
+            ret.resize_and_overwrite(this->size(), [this](T* const buf, size_t) noexcept
+            {
+                T* at = buf;
+                this->for_each_chunk([&at](const std::basic_string_view<T> chunk) noexcept -> void { at = std::ranges::copy(chunk, at).out; });
+                return *this->size();
+            });
+            return string<T, Allocator>(std::move(ret));
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return !this->root; }
+        /// @brief The length in code units.
+        [[nodiscard]] sz size() const noexcept { return this->root ? this->root->units : 0_uz; }
+        [[nodiscard]] sz codepoint_count() const noexcept { return this->root ? this->root->codepoints : 0_uz; }
+        /// @brief The number of lines, one more than the number of newlines.
+        [[nodiscard]] sz line_count() const noexcept { return (this->root ? this->root->newlines : 0_uz) + 1_uz; }
+
+        /// @brief The offset in code units of the `n`-th codepoint, or of the end of the text if `n == codepoint_count()`.
+        /// @pre `n <= codepoint_count()`
+        [[nodiscard]] sz unit_offset_of(sz n) const noexcept
+        {
+            _retif(this->size(), n >= this->codepoint_count());
+
+            sz ret = 0_uz;
+            const node* at = this->root.get();
+            while (!at->is_leaf())
+            {
+                if (n < at->left->codepoints)
+                    at = at->left.get();
+                else
+                {
+                    n -= at->left->codepoints;
+                    ret += at->left->units;
+                    at = at->right.get();
+                }
+            }
+            return ret + rope::unit_offset_in(at->text, n);
+        }
+        /// @brief The `n`-th codepoint.
+        /// @pre `n < codepoint_count()`
+        [[nodiscard]] char32_t nth_codepoint(const sz n) const noexcept { return *this->iter_at(n); }
+        /// @brief The codepoint offset of the start of the line `line`, following the `line`-th newline.
+        /// @pre `line < line_count()`
+        [[nodiscard]] sz line_start(sz line) const noexcept
+        {
+            _retif(0_uz, line == 0_uz);
+
+            sz ret = 0_uz;
+            const node* at = this->root.get();
+            while (!at->is_leaf())
+            {
+                if (line <= at->left->newlines)
+                    at = at->left.get();
+                else
+                {
+                    line -= at->left->newlines;
+                    ret += at->left->codepoints;
+                    at = at->right.get();
+                }
+            }
+
+            sz offset = 0_uz;
+            while (line > 0_uz)
+            {
+                if (at->text[offset] == T('\n'))
+                    line--;
+                offset++;
+            }
+            return ret + internal::utf_count_leads_kernel_current<T>()(at->text.data(), offset);
+        }
+        /// @brief The line containing the codepoint `at`, the number of newlines before it.
+        /// @pre `at <= codepoint_count()`
+        [[nodiscard]] sz line_of(sz at) const noexcept
+        {
+            _retif(0_uz, this->empty());
+
+            sz ret = 0_uz;
+            const node* n = this->root.get();
+            while (!n->is_leaf())
+            {
+                if (at < n->left->codepoints)
+                    n = n->left.get();
+                else
+                {
+                    at -= n->left->codepoints;
+                    ret += n->left->newlines;
+                    n = n->right.get();
+                }
+            }
+            const std::basic_string_view<T> before = std::basic_string_view<T>(n->text).substr(0uz, rope::unit_offset_in(n->text, at));
+            return ret + sz(_as(std::ranges::count(before, T('\n')), size_t));
+        }
+
+        [[nodiscard]] rope_iter<T> begin() const noexcept { return this->root ? rope_iter<T>(this->root.get(), 0_uz) : rope_iter<T>(); }
+        [[nodiscard]] rope_iter<T> end() const noexcept { return this->root ? rope_iter<T>(this->root.get(), this->size()) : rope_iter<T>(); }
+        /// @brief Iterator at the `n`-th codepoint, or the end if `n == codepoint_count()`.
+        /// @pre `n <= codepoint_count()`
+        [[nodiscard]] rope_iter<T> iter_at(const sz n) const noexcept
+        {
+            return this->root ? rope_iter<T>(this->root.get(), this->unit_offset_of(n)) : rope_iter<T>();
+        }
+
+        /// @brief Call `visit` with each chunk of the text in order, as a `std::basic_string_view<T>`, for reading the text without copying it.
+        template <typename Visitor>
+        void for_each_chunk(const Visitor& visit) const
+        {
+            if (this->root)
+            {
+                (void)rope::visit_chunks(this->root.get(), [&visit](const std::basic_string_view<T> chunk) -> bool
+                {
+                    visit(chunk);
+                    return true;
+                });
+            }
+        }
+
+        /// @brief Copy of the `count` codepoints from `from`, sharing the chunks of this.
+        [[nodiscard]] rope substr(const sz from, const sz count) const
+        {
+            _retif(rope(), from >= this->codepoint_count());
+            return rope(rope::split(rope::split(this->root, from).second, count).first);
+        }
+
+        /// @brief Insert `text` before the codepoint `at`, replacing invalid sequences with U+FFFD.
+        /// @pre `at <= codepoint_count()`
+        rope& insert(const sz at, const std::basic_string_view<T> text) &
+        {
+            _retif(*this, text.empty());
+
+            // Text that fits in the leaf it's inserted into is spliced into a copy of that leaf, rebuilding only the path to it.
+            sz local = at;
+            if (this->root && internal::utf_first_invalid(std::span<const T>(text)) == text.size() &&
+                rope::leaf_of(this->root.get(), local)->units + text.size() <= max_chunk)
+            {
+                this->root = rope::edited(this->root, at, [text](const std::basic_string<T>& leaf, const sz offset) -> std::basic_string<T>
+                {
+                    std::basic_string<T> ret;
+                    ret.reserve(leaf.size() + text.size());
+                    ret.append(leaf, 0uz, offset).append(text).append(leaf, offset);
+                    return ret;
+                });
+                return *this;
+            }
+
+            auto [before, after] = rope::split(this->root, at);
+            this->root = rope::join(rope::join(std::move(before), rope::build(text)), std::move(after));
+            return *this;
+        }
+        /// @overload
+        rope insert(const sz at, const std::basic_string_view<T> text) && { return this->insert(at, text), std::move(*this); }
+        /// @brief Insert the text of `other` before the codepoint `at`, sharing its chunks.
+        /// @pre `at <= codepoint_count()`
+        rope& insert(const sz at, const rope& other) &
+        {
+            auto [before, after] = rope::split(this->root, at);
+            this->root = rope::join(rope::join(std::move(before), other.root), std::move(after));
+            return *this;
+        }
+        /// @overload
+        rope insert(const sz at, const rope& other) && { return this->insert(at, other), std::move(*this); }
+        /// @brief Append `text` to the end, replacing invalid sequences with U+FFFD.
+        rope& append(const std::basic_string_view<T> text) &
+        {
+            this->root = rope::join(std::move(this->root), rope::build(text));
+            return *this;
+        }
+        /// @overload
+        rope append(const std::basic_string_view<T> text) && { return this->append(text), std::move(*this); }
+        /// @brief Append the text of `other` to the end, sharing its chunks.
+        rope& append(const rope& other) &
+        {
+            this->root = rope::join(std::move(this->root), other.root);
+            return *this;
+        }
+        /// @overload
+        rope append(const rope& other) && { return this->append(other), std::move(*this); }
+        /// @brief Erase the `count` codepoints from `at`, or as many as there are.
+        /// @pre `at <= codepoint_count()`
+        rope& erase(const sz at, const sz count) &
+        {
+            _retif(*this, count == 0_uz || at >= this->codepoint_count());
+
+            // Likewise, erasing within a leaf, leaving some of it, only rebuilds the path to it. Compared against what's left of the leaf, as `local + count`
+            // would wrap for a `count` meaning "to the end".
+            sz local = at;
+            if (const node* const leaf = rope::leaf_of(this->root.get(), local); count < leaf->codepoints - local)
+            {
+                this->root = rope::edited(this->root, at, [count](const std::basic_string<T>& leaf, const sz offset) -> std::basic_string<T>
+                {
+                    const sz end = offset + rope::unit_offset_in(std::basic_string_view<T>(leaf).substr(offset), count);
+                    std::basic_string<T> ret;
+                    ret.reserve(leaf.size() - (end - offset));
+                    ret.append(leaf, 0uz, offset).append(leaf, end);
+                    return ret;
+                });
+                return *this;
+            }
+
+            auto [before, rest] = rope::split(this->root, at);
+            this->root = rope::join(std::move(before), rope::split(rest, count).second);
+            return *this;
+        }
+        /// @overload
+        rope erase(const sz at, const sz count) && { return this->erase(at, count), std::move(*this); }
+        void clear() noexcept { this->root.reset(); }
+    };
+
+    template <ICharacter T>
+    rope(std::basic_string_view<T>) -> rope<T>;
+    template <ICharacter T>
+    rope(std::basic_string<T>) -> rope<T>;
+    template <ICharacter T, typename Allocator>
+    rope(sys::string<T, Allocator>) -> rope<T>;
+} // namespace sys
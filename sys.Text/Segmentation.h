@@ -0,0 +1,361 @@
+#pragma once
+
+/// @file
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string_view>
+
+#include <Char.h>
+#include <CodepointIterator.h>
+#include <LanguageSupport.h>
+#include <data/UnicodeSegmentation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index, readability-magic-numbers)
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Whether the Grapheme_Cluster_Break values of two adjacent codepoints alone decide if there's a boundary between them.
+    enum class grapheme_pair_rule : uint_least8_t
+    {
+        join,
+        split,
+        /// @brief Split, unless one of the rules looking further back (GB9c, GB11, GB12, GB13) joins them.
+        split_unless_context
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Rules GB3 to GB9b of UAX #29, in order of precedence, with GB999 as `grapheme_pair_rule::split_unless_context`.
+    consteval grapheme_pair_rule grapheme_pair_rule_of(const grapheme_break a, const grapheme_break b) noexcept
+    {
+        using enum grapheme_break;
+        const auto isControl = [](const grapheme_break v) noexcept -> bool { return v == cr || v == lf || v == control; };
+
+        _retif(grapheme_pair_rule::join, a == cr && b == lf);
+        _retif(grapheme_pair_rule::split, isControl(a) || isControl(b));
+        _retif(grapheme_pair_rule::join, a == l && (b == l || b == v || b == lv || b == lvt));
+        _retif(grapheme_pair_rule::join, (a == lv || a == v) && (b == v || b == t));
+        _retif(grapheme_pair_rule::join, (a == lvt || a == t) && b == t);
+        _retif(grapheme_pair_rule::join, b == extend || b == zwj || b == spacing_mark || a == prepend);
+        return grapheme_pair_rule::split_unless_context;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr size_t grapheme_break_count = _as(grapheme_break::lvt, size_t) + 1uz;
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief `sys::internal::grapheme_pair_rule_of(...)` for every pair of Grapheme_Cluster_Break values, indexed `[a][b]`.
+    inline constexpr auto grapheme_pair_rules = []() consteval
+    {
+        std::array<std::array<grapheme_pair_rule, grapheme_break_count>, grapheme_break_count> ret {};
+        for (size_t a = 0uz; a < grapheme_break_count; a++)
+        {
+            for (size_t b = 0uz; b < grapheme_break_count; b++)
+                ret[a][b] = internal::grapheme_pair_rule_of(_as(a, grapheme_break), _as(b, grapheme_break));
+        }
+        return ret;
+    }();
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Whether a code unit is printable ASCII, which never joins with a following ASCII code unit into a grapheme cluster.
+    template <ICharacter T>
+    constexpr bool is_printable_ascii(const T unit) noexcept
+    {
+        return _as(unit, uint32_t) - 0x20u < 0x5Fu;
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The end of the extended grapheme cluster starting at `beg`.
+    /// @details Runs of printable ASCII split between every code unit without entering the state machine.
+    template <ICharacter T>
+    constexpr const T* next_grapheme_boundary(const T* const beg, const T* const end) noexcept
+    {
+        if (internal::is_printable_ascii(*beg) && (beg + 1 == end || _as(beg[1], uint32_t) < 0x80u))
+            return beg + 1;
+
+        codepoint_iter<T> it(beg, end);
+        const codepoint_iter<T> last(end, end);
+        char32_t c = *it;
+        grapheme_break prev = internal::dchar_grapheme_break(c);
+
+        // State for the rules looking further back than the previous codepoint: whether an Extended_Pictographic codepoint was followed by `Extend*` (GB11), and by
+        // `Extend* ZWJ`, whether an InCB=Consonant was followed by `[Extend Linker]*`, and by at least one Linker (GB9c), and the parity of the run of regional
+        // indicators (GB12, GB13).
+        enum class pictographic_state : uint_least8_t
+        {
+            none,
+            extended,
+            zwj
+        } pictographicState = internal::dchar_is_extended_pictographic(c) ? pictographic_state::extended : pictographic_state::none;
+        enum class conjunct_state : uint_least8_t
+        {
+            none,
+            consonant,
+            linked
+        } conjunct = internal::dchar_indic_conjunct_break(c) == indic_conjunct_break::consonant ? conjunct_state::consonant : conjunct_state::none;
+        bool oddRegionalIndicators = prev == grapheme_break::regional_indicator;
+
+        for (++it; it != last; ++it)
+        {
+            c = *it;
+            const grapheme_break next = internal::dchar_grapheme_break(c);
+            const bool pictographic = internal::dchar_is_extended_pictographic(c);
+            const indic_conjunct_break incb = internal::dchar_indic_conjunct_break(c);
+
+            switch (grapheme_pair_rules[_as(prev, size_t)][_as(next, size_t)])
+            {
+            case grapheme_pair_rule::join:
+                break;
+            case grapheme_pair_rule::split:
+                return std::to_address(it);
+            case grapheme_pair_rule::split_unless_context:
+                if (!(conjunct == conjunct_state::linked && incb == indic_conjunct_break::consonant) &&
+                    !(pictographicState == pictographic_state::zwj && pictographic) &&
+                    !(oddRegionalIndicators && next == grapheme_break::regional_indicator))
+                    return std::to_address(it);
+                break;
+            }
+
+            if (pictographic)
+                pictographicState = pictographic_state::extended;
+            else if (pictographicState == pictographic_state::extended && next == grapheme_break::extend)
+                pictographicState = pictographic_state::extended;
+            else if (pictographicState == pictographic_state::extended && next == grapheme_break::zwj)
+                pictographicState = pictographic_state::zwj;
+            else
+                pictographicState = pictographic_state::none;
+
+            if (incb == indic_conjunct_break::consonant)
+                conjunct = conjunct_state::consonant;
+            else if (conjunct != conjunct_state::none && incb == indic_conjunct_break::linker)
+                conjunct = conjunct_state::linked;
+            else if (incb != indic_conjunct_break::extend)
+                conjunct = conjunct_state::none;
+
+            oddRegionalIndicators = next == grapheme_break::regional_indicator && !oddRegionalIndicators;
+            prev = next;
+        }
+        return end;
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Whether a code unit is an ASCII letter, digit or underscore, which join into a word with each other.
+    template <ICharacter T>
+    constexpr bool is_ascii_word_unit(const T unit) noexcept
+    {
+        const auto u = _as(unit, uint32_t);
+        return (u | 0x20u) - U'a' < 26u || u - U'0' < 10u || u == U'_';
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Whether a code unit is ASCII punctuation which may join the words either side of it, as in "can't", "e.g." or "1,000".
+    template <ICharacter T>
+    constexpr bool is_ascii_word_joiner(const T unit) noexcept
+    {
+        const auto u = _as(unit, uint32_t);
+        return u == U'.' || u == U':' || u == U',' || u == U';' || u == U'\'' || u == U'"';
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The end of the word, or run of spaces, punctuation or other non-word codepoints, starting at `beg`.
+    /// @details Runs of ASCII letters and digits, and of spaces, followed by other ASCII are found without entering the state machine.
+    template <ICharacter T>
+    constexpr const T* next_word_boundary(const T* const beg, const T* const end) noexcept // NOLINT(readability-function-cognitive-complexity)
+    {
+        if (internal::is_ascii_word_unit(*beg))
+        {
+            const T* at = beg + 1;
+            while (at < end && internal::is_ascii_word_unit(*at))
+                at++;
+            if (at == end || (_as(*at, uint32_t) < 0x80u && !internal::is_ascii_word_joiner(*at)))
+                return at;
+        }
+        else if (internal::is_printable_ascii(*beg))
+        {
+            const T* at = beg + 1;
+            if (*beg == T(' '))
+            {
+                while (at < end && *at == T(' '))
+                    at++;
+            }
+            if (at == end || _as(*at, uint32_t) < 0x80u)
+                return at;
+        }
+
+        using enum word_break;
+        const auto isAHLetter = [](const word_break v) noexcept -> bool { return v == aletter || v == hebrew_letter; };
+        const auto isMidLetter = [](const word_break v) noexcept -> bool { return v == mid_letter || v == mid_num_let || v == single_quote; };
+        const auto isMidNum = [](const word_break v) noexcept -> bool { return v == mid_num || v == mid_num_let || v == single_quote; };
+        const auto isIgnored = [](const word_break v) noexcept -> bool { return v == extend || v == format || v == zwj; };
+
+        codepoint_iter<T> it(beg, end);
+        const codepoint_iter<T> last(end, end);
+        const char32_t first = *it;
+        ++it;
+
+        // Rules WB3 to WB3b.
+        word_break prev = internal::dchar_word_break(first);
+        if (prev == cr && it != last && internal::dchar_word_break(*it) == lf)
+            return std::to_address(++it);
+        _retif(std::to_address(it), prev == cr || prev == lf || prev == newline);
+
+        // The codepoint before `prev` ignoring `Extend`, `Format` and `ZWJ` (WB4), and the last codepoint including them.
+        word_break prevPrev = other, raw = prev;
+        bool oddRegionalIndicators = prev == regional_indicator;
+        for (; it != last; ++it)
+        {
+            const char32_t c = *it;
+            const word_break next = internal::dchar_word_break(c);
+            _retif(std::to_address(it), next == cr || next == lf || next == newline);
+
+            const bool pictographicAfterZwj = raw == zwj && internal::dchar_is_extended_pictographic(c);
+            const bool spaces = raw == wseg_space && next == wseg_space;
+            raw = next;
+            if (!pictographicAfterZwj && !spaces && isIgnored(next))
+                continue;
+
+            // The codepoint after `next`, ignoring as above, for the rules looking one ahead.
+            const auto lookahead = [&]() noexcept -> word_break
+            {
+                codepoint_iter<T> ahead = it;
+                for (++ahead; ahead != last; ++ahead)
+                {
+                    if (const word_break v = internal::dchar_word_break(*ahead); !isIgnored(v))
+                        return v;
+                }
+                return other;
+            };
+
+            const bool join = pictographicAfterZwj || spaces ||
+                (isAHLetter(prev) && isAHLetter(next)) ||                                     // WB5
+                (isAHLetter(prev) && isMidLetter(next) && isAHLetter(lookahead())) ||           // WB6
+                (isAHLetter(prevPrev) && isMidLetter(prev) && isAHLetter(next)) ||              // WB7
+                (prev == hebrew_letter && next == single_quote) ||                             // WB7a
+                (prev == hebrew_letter && next == double_quote && lookahead() == hebrew_letter) || // WB7b
+                (prevPrev == hebrew_letter && prev == double_quote && next == hebrew_letter) || // WB7c
+                (prev == numeric && next == numeric) ||                                        // WB8
+                (isAHLetter(prev) && next == numeric) ||                                       // WB9
+                (prev == numeric && isAHLetter(next)) ||                                       // WB10
+                (prevPrev == numeric && isMidNum(prev) && next == numeric) ||                  // WB11
+                (prev == numeric && isMidNum(next) && lookahead() == numeric) ||               // WB12
+                (prev == katakana && next == katakana) ||                                      // WB13
+                ((isAHLetter(prev) || prev == numeric || prev == katakana || prev == extend_num_let) && next == extend_num_let) || // WB13a
+                (prev == extend_num_let && (isAHLetter(next) || next == numeric || next == katakana)) ||                           // WB13b
+                (oddRegionalIndicators && next == regional_indicator);                        // WB15, WB16
+            if (!join)
+                return std::to_address(it);
+
+            oddRegionalIndicators = next == regional_indicator && !oddRegionalIndicators;
+            prevPrev = prev;
+            prev = next;
+        }
+        return end;
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Lazy view of the segments of a string, as `std::basic_string_view<T>`s into the string, each ending where `Next` finds the next boundary.
+    template <ICharacter T, const T* (*Next)(const T*, const T*) noexcept>
+    class segment_view : public std::ranges::view_interface<segment_view<T, Next>>
+    {
+        const T* _beg = nullptr;
+        const T* _end = nullptr;
+    public:
+        /// @brief Forward iterator over the segments of a `sys::internal::segment_view`.
+        class iterator final
+        {
+            const T* cur = nullptr;
+            const T* next = nullptr;
+            const T* end = nullptr;
+        public:
+            using value_type = std::basic_string_view<T>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            constexpr iterator() noexcept = default;
+            constexpr iterator(const T* const cur, const T* const end) noexcept : cur(cur), next(cur == end ? end : Next(cur, end)), end(end) { }
+
+            constexpr value_type operator*() const noexcept { return value_type(this->cur, this->next); }
+
+            constexpr iterator& operator++() noexcept
+            {
+                this->cur = this->next;
+                if (this->cur != this->end)
+                    this->next = Next(this->cur, this->end);
+                return *this;
+            }
+            constexpr iterator operator++(int) noexcept
+            {
+                const iterator ret = *this;
+                ++*this;
+                return ret;
+            }
+
+            friend constexpr bool operator==(const iterator& a, const iterator& b) noexcept { return a.cur == b.cur; }
+            friend constexpr bool operator==(const iterator& a, std::default_sentinel_t) noexcept { return a.cur == a.end; }
+        };
+
+        constexpr explicit segment_view(const std::basic_string_view<T> str) noexcept : _beg(str.data()), _end(str.data() + str.size()) { }
+
+        [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(this->_beg, this->_end); }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    };
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Lazy view of the extended grapheme clusters of a string, as `std::basic_string_view<T>`s into the string, for truncating text or moving a cursor
+    /// without splitting user-perceived characters.
+    /// @details
+    /// Boundaries are found by the rules of UAX #29, driven by a table of the rules between adjacent codepoints and a little state for the rules looking further back,
+    /// such as for emoji ZWJ sequences and regional indicator flags. Nothing is allocated. Invalid code units are segmented as U+FFFD, one code unit at a time, so
+    /// combining marks following one still join its cluster.
+    /// @attention Lifetime assumptions! The string viewed must outlive `this` and its iterators.
+    /// @see [Unicode Standard Annex #29, "Unicode Text Segmentation"](https://www.unicode.org/reports/tr29/).
+    /// @code{.cpp}
+    /// for (const std::u8string_view cluster : sys::grapheme_view(std::u8string_view(u8"é🇦🇺")))
+    ///     ...; // "é", "🇦🇺"
+    /// @endcode
+    template <ICharacter T>
+    class grapheme_view final : public internal::segment_view<T, &internal::next_grapheme_boundary<T>>
+    {
+    public:
+        constexpr explicit grapheme_view(const std::basic_string_view<T> str) noexcept : internal::segment_view<T, &internal::next_grapheme_boundary<T>>(str) { }
+    };
+    /// @ingroup sys_text
+    /// @brief Lazy view of the words of a string, and of the runs of spaces and punctuation between them, as `std::basic_string_view<T>`s into the string.
+    /// @details
+    /// Boundaries are found by the rules of UAX #29, so "can't", "e.g", "3.14" and "1,000" are single words. Nothing is allocated. Filter the segments to those
+    /// containing a letter or digit to tokenize text into words alone.
+    /// @attention Lifetime assumptions! The string viewed must outlive `this` and its iterators.
+    /// @see [Unicode Standard Annex #29, "Unicode Text Segmentation"](https://www.unicode.org/reports/tr29/).
+    /// @code{.cpp}
+    /// for (const std::u8string_view word : sys::word_view(std::u8string_view(u8"Don't panic.")))
+    ///     ...; // "Don't", " ", "panic", "."
+    /// @endcode
+    template <ICharacter T>
+    class word_view final : public internal::segment_view<T, &internal::next_word_boundary<T>>
+    {
+    public:
+        constexpr explicit word_view(const std::basic_string_view<T> str) noexcept : internal::segment_view<T, &internal::next_word_boundary<T>>(str) { }
+    };
+
+    template <ICharacter T>
+    grapheme_view(std::basic_string_view<T>) -> grapheme_view<T>;
+    template <ICharacter T>
+    word_view(std::basic_string_view<T>) -> word_view<T>;
+} // namespace sys
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index, readability-magic-numbers)
@@ -0,0 +1,215 @@
+#pragma once
+
+/// @file
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include <Char.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <StringSearcher.h>
+#include <TextKernels.h>
+#include <meta/InterfaceRequirements.h>
+#include <meta/NamedRequirements.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief A set of codepoints, for splitting on any of them with `sys::split_view`.
+    /// @details Membership of ASCII codepoints is a bitmap lookup, other codepoints are searched for linearly.
+    /// @attention Lifetime assumptions! `codepoints` must outlive `this`.
+    class codepoint_set final
+    {
+        uint64_t ascii[2] {};
+        std::u32string_view others;
+    public:
+        constexpr explicit codepoint_set(const std::u32string_view codepoints) noexcept : others(codepoints)
+        {
+            for (const char32_t c : codepoints)
+            {
+                if (c < 0x80) // NOLINT(readability-magic-numbers)
+                    this->ascii[c / 64u] |= uint64_t(1) << (c % 64u); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+        }
+
+        [[nodiscard]] constexpr bool contains(const char32_t c) const noexcept
+        {
+            if (c < 0x80) // NOLINT(readability-magic-numbers)
+                return (this->ascii[c / 64u] >> (c % 64u)) & 1u; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            return this->others.contains(c);
+        }
+        [[nodiscard]] constexpr bool operator()(const char32_t c) const noexcept { return this->contains(c); }
+    };
+} // namespace sys
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Where a delimiter was found, `beg == end` of the searched range if it wasn't.
+    template <ICharacter T>
+    struct split_match
+    {
+        const T* beg = nullptr;
+        const T* end = nullptr;
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief `sys::split_view` delimiter matching a single code unit.
+    template <ICharacter T>
+    struct split_by_unit final
+    {
+        T unit;
+
+        constexpr /* NOLINT(hicpp-explicit-conversions) */ split_by_unit(const T unit) noexcept : unit(unit) { }
+
+        [[nodiscard]] constexpr split_match<T> find(const T* const beg, const T* const end) const noexcept
+        {
+            const T* const at = beg + internal::find_unit(std::span<const T>(beg, end), this->unit);
+            return { at, at == end ? end : at + 1 };
+        }
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief `sys::split_view` delimiter matching a substring, or every code unit boundary if it's empty.
+    /// @attention Lifetime assumptions! The needle must outlive `this`.
+    template <ICharacter T>
+    struct split_by_substring final
+    {
+        string_searcher<T> searcher;
+
+        constexpr /* NOLINT(hicpp-explicit-conversions) */ split_by_substring(const std::basic_string_view<T> needle) noexcept : searcher(needle) { }
+        constexpr /* NOLINT(hicpp-explicit-conversions) */ split_by_substring(const string_searcher<T>& searcher) noexcept : searcher(searcher) { }
+
+        [[nodiscard]] constexpr split_match<T> find(const T* const beg, const T* const end) const noexcept
+        {
+            const sz needleSize = sz(this->searcher.pattern().size());
+            if (!needleSize)
+            {
+                _retif((split_match<T> { end, end }), end - beg <= 1);
+                return { beg + 1, beg + 1 };
+            }
+
+            const T* const at = beg + this->searcher.find(std::basic_string_view<T>(beg, end));
+            return { at, at == end ? end : at + needleSize };
+        }
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief `sys::split_view` delimiter matching any single codepoint satisfying `Pred`.
+    template <ICharacter T, typename Pred>
+    struct split_by_codepoint final
+    {
+        Pred pred;
+
+        constexpr /* NOLINT(hicpp-explicit-conversions) */ split_by_codepoint(Pred pred) noexcept(INothrowMoveConstructible<Pred>) : pred(std::move(pred)) { }
+
+        [[nodiscard]] constexpr split_match<T> find(const T* const beg, const T* const end) const noexcept(INothrowCallable<const Pred&, char32_t>)
+        {
+            for (const T* it = beg; it < end;)
+            {
+                const auto [c, size] = ch::read_codepoint(std::span<const T>(it, end), unsafe);
+                if (this->pred(c))
+                    return { it, it + size };
+                it += size;
+            }
+            return { end, end };
+        }
+    };
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Lazy view of the substrings of a string separated by a delimiter, as `std::basic_string_view<T>`s into the string.
+    /// @details
+    /// Nothing is allocated or copied, each piece is found when the iterator advances to it. Adjacent delimiters delimit empty pieces, as do delimiters at either end.
+    ///
+    /// The delimiter may be
+    /// - a code unit, found with `std::memchr(...)` or a vector kernel,
+    /// - a substring, or a `sys::string_searcher` for one, found as by `sys::string_searcher::find(...)`, or which splits between every code unit if empty,
+    /// - a `sys::codepoint_set`, or any predicate on `char32_t`, splitting on every codepoint satisfying it.
+    /// @attention Lifetime assumptions! The string viewed, and a substring delimiter, must outlive `this` and its iterators.
+    /// @code{.cpp}
+    /// for (const std::u8string_view field : sys::split_view(std::u8string_view(u8"a,b,,c"), u8','))
+    ///     ...; // "a", "b", "", "c"
+    /// @endcode
+    template <ICharacter T, typename Delimiter>
+    class split_view final : public std::ranges::view_interface<split_view<T, Delimiter>>
+    {
+        const T* _beg = nullptr;
+        const T* _end = nullptr;
+        Delimiter delimiter;
+    public:
+        /// @brief Forward iterator over the pieces of a `sys::split_view`.
+        class iterator final
+        {
+            const split_view* view = nullptr;
+            const T* cur = nullptr;
+            internal::split_match<T> match {};
+            bool done = true;
+        public:
+            using value_type = std::basic_string_view<T>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            constexpr iterator() noexcept = default;
+            constexpr iterator(const split_view& view, const T* const cur) : view(&view), cur(cur), match(view.delimiter.find(cur, view._end)), done(false) { }
+
+            constexpr value_type operator*() const noexcept { return value_type(this->cur, this->match.beg); }
+
+            constexpr iterator& operator++()
+            {
+                if (this->match.beg == this->view->_end)
+                {
+                    // That was the last piece.
+                    this->cur = this->view->_end;
+                    this->done = true;
+                }
+                else
+                {
+                    this->cur = this->match.end;
+                    this->match = this->view->delimiter.find(this->cur, this->view->_end);
+                }
+                return *this;
+            }
+            constexpr iterator operator++(int)
+            {
+                const iterator ret = *this;
+                ++*this;
+                return ret;
+            }
+
+            friend constexpr bool operator==(const iterator& a, const iterator& b) noexcept { return a.cur == b.cur && a.done == b.done; }
+            friend constexpr bool operator==(const iterator& a, std::default_sentinel_t) noexcept { return a.done; }
+        };
+
+        constexpr split_view(const std::basic_string_view<T> str, Delimiter delimiter) noexcept(INothrowMoveConstructible<Delimiter>) :
+            _beg(str.data()), _end(str.data() + str.size()), delimiter(std::move(delimiter))
+        { }
+
+        [[nodiscard]] constexpr iterator begin() const { return iterator(*this, this->_beg); }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    };
+
+    template <ICharacter T>
+    split_view(std::basic_string_view<T>, T) -> split_view<T, internal::split_by_unit<T>>;
+    template <ICharacter T>
+    split_view(std::basic_string_view<T>, std::basic_string_view<T>) -> split_view<T, internal::split_by_substring<T>>;
+    template <ICharacter T>
+    split_view(std::basic_string_view<T>, string_searcher<T>) -> split_view<T, internal::split_by_substring<T>>;
+    template <ICharacter T, typename Pred>
+    requires (!ICharacter<Pred> && ICallable<const Pred&, char32_t>)
+    split_view(std::basic_string_view<T>, Pred) -> split_view<T, internal::split_by_codepoint<T, Pred>>;
+} // namespace sys
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
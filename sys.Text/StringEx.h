@@ -3,159 +3,420 @@
 /// @file
 
 #include <algorithm>
+#include <compare>
 #include <concepts>
 #include <cstddef>
 #include <format>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <memory_resource>
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <Char.h>
 #include <CodepointIterator.h>
+#include <FoldCompare.h>
 #include <Integer.h>
 #include <LanguageSupport.h>
+#include <Normalization.h>
+#include <Segmentation.h>
+#include <SplitView.h>
+#include <StringSearcher.h>
+#include <TextKernels.h>
 #include <data/UnicodeCCC.h>
 #include <data/UnicodeCasing.h>
 #include <meta/Builtin.h>
 #include <meta/Container.h>
 #include <meta/Type.h>
 
-namespace sys
+namespace sys::internal
 {
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool casing_resets_combining(const canonical_combining_class ccc) noexcept
+    {
+        return ccc == canonical_combining_class::not_reordered || ccc == canonical_combining_class::above;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Streams the `sys::lookahead_casing_context` of each codepoint, caching each property until the codepoint that decides it.
     template <ICharacter T>
-    struct codepoint_view;
+    class lookahead_casing_cache
+    {
+        const T* followed_by_cased_until;
+        const T* before_dot_until;
+        bool followed_by_cased = false;
+        bool before_dot = false;
+    public:
+        constexpr explicit lookahead_casing_cache(const T* beg) noexcept : followed_by_cased_until(beg), before_dot_until(beg) { }
 
-    /// @ingroup sys_text
-    /// @brief Unicode string container.
+        /// @brief Context of the codepoint preceding `next`.
+        constexpr lookahead_casing_context context_before(codepoint_iter<T> next, const codepoint_iter<T> end) noexcept
+        {
+            lookahead_casing_context ret;
+            _retif(ret, next == end);
+
+            // Every codepoint between `next` and the deciding codepoint is skipped by the scan, so the result holds until then.
+            const T* const nextPtr = std::to_address(next);
+            if (nextPtr > this->followed_by_cased_until)
+            {
+                codepoint_iter<T> it = next;
+                this->followed_by_cased = false;
+                for (; it < end; ++it)
+                {
+                    const char32_t c = *it;
+                    if (internal::dchar_is_cased(c))
+                    {
+                        this->followed_by_cased = true;
+                        break;
+                    }
+                    if (!internal::dchar_is_case_ignorable(c))
+                        break;
+                }
+                this->followed_by_cased_until = std::to_address(it);
+            }
+            if (nextPtr > this->before_dot_until)
+            {
+                codepoint_iter<T> it = next;
+                this->before_dot = false;
+                for (; it < end; ++it)
+                {
+                    const char32_t c = *it;
+                    if (c == U'\u0307')
+                    {
+                        this->before_dot = true;
+                        break;
+                    }
+                    if (internal::casing_resets_combining(internal::dchar_ccc(c)))
+                        break;
+                }
+                this->before_dot_until = std::to_address(it);
+            }
+
+            ret.followed_by_cased = this->followed_by_cased;
+            ret.more_above = internal::dchar_ccc(*next) == canonical_combining_class::above;
+            ret.before_dot = this->before_dot;
+            return ret;
+        }
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr void casing_update_context(forward_casing_context& ctx, const char32_t c) noexcept
+    {
+        if (internal::dchar_is_cased(c))
+            ctx.is_preceded_by_cased = true;
+        else if (!internal::dchar_is_case_ignorable(c))
+            ctx.is_preceded_by_cased = false;
+
+        if (internal::dchar_is_soft_dotted(c))
+            ctx.after_soft_dotted = true;
+        else if (const canonical_combining_class ccc = internal::dchar_ccc(c); internal::casing_resets_combining(ccc))
+            ctx.after_soft_dotted = false;
+
+        if (c == U'\u0049')
+            ctx.after_i = true;
+        else if (const canonical_combining_class ccc = internal::dchar_ccc(c); internal::casing_resets_combining(ccc))
+            ctx.after_i = false;
+    }
+    /// @internal
+    /// @ingroup sys_internal
     template <ICharacter T>
-    class string final
+    constexpr void casing_update_context_ascii(forward_casing_context& ctx, const std::span<const T> run) noexcept
     {
-        std::basic_string<T> str;
+        // Each ASCII codepoint ends any combining sequence, so only the last codepoint that isn't case-ignorable and those after it contribute.
+        sz from = sz(run.size());
+        while (from > 0_uz && internal::dchar_is_case_ignorable(_as(run[from - 1_uz], char32_t)))
+            from--;
+        for (sz i = from > 0_uz ? from - 1_uz : 0_uz; i < sz(run.size()); i++)
+            internal::casing_update_context(ctx, _as(run[i], char32_t));
+    }
 
-        // Internal: Casing utilities.
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The code units of the codepoints a single codepoint maps to, waiting to be stored.
+    template <ICharacter T>
+    struct mapped_units
+    {
+        T units[3uz * (sizeof(char32_t) / sizeof(T))] {};
+        sz size = 0_uz;
+
+        constexpr void assign(const std::span<const char32_t> mapping) noexcept
+        {
+            this->size = 0_uz;
+            for (const char32_t c : mapping)
+                this->size += ch::write_codepoint(c, this->units + this->size /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */, unsafe);
+        }
+        /// @brief Store the units to `out` at `at`, if they fit.
+        constexpr bool store(const std::span<T> out, sz& at) noexcept
+        {
+            _retif(false, at + this->size > out.size());
+            std::copy_n(this->units /* NOLINT(hicpp-no-array-decay) */, this->size, out.data() + at /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */);
+            at += std::exchange(this->size, 0_uz);
+            return true;
+        }
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append to `out` what `write(buf, written)` stores to `buf`, allocating once if `estimate` code units suffice, and growing geometrically otherwise.
+    /// @details `write` stores from `buf[written]`, advancing `written`, until it returns `true` once done, or `false` once `buf` is full, to be called again with
+    /// a larger `buf` holding what it stored so far.
+    template <ICharacter T, typename Allocator, typename Write>
+    constexpr void estimated_append(std::basic_string<T, std::char_traits<T>, Allocator>& out, const sz estimate, Write&& write)
+    {
+        const sz prevSize = sz(out.size());
+        sz written = 0_uz, capacity = estimate;
+        bool done = false;
+        while (!done)
+        {
+            out.resize_and_overwrite(prevSize + capacity, [&](T* const buf, const size_t bufSize) noexcept
+            {
+                done = write(std::span<T>(buf + prevSize /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */, bufSize - prevSize), written);
+                return *(prevSize + written);
+            });
+            capacity = capacity * 2_uz + sz(sizeof(char32_t) / sizeof(T)) * 3_uz;
+        }
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append `in` uppercased if `IsUpper`, otherwise lowercased, to `out`.
+    /// @details
+    /// `in` is cased as if preceded and followed by nothing, see `sys::internal::casing_boundary(...)`. Casing preserves the length of almost all text, so the output
+    /// is allocated once at the length of `in`, and stored to directly.
+    template <bool IsUpper, ICharacter T, typename Allocator>
+    constexpr void case_append(const std::span<const T> in, const std::u8string_view lang, std::basic_string<T, std::char_traits<T>, Allocator>& out)
+    {
+        constexpr sz scalarRun = 32_uz;
 
-        static constexpr bool resets_combining(canonical_combining_class ccc) noexcept
+        // Outside of these languages every ASCII codepoint has a context-free, single codepoint mapping.
+        const bool asciiInvariant = lang != u8"tr" && lang != u8"az" && lang != u8"lt";
+        internal::ascii_case_kernel<T> kernel = &internal::ascii_case_portable<IsUpper, T>;
+        if !consteval
         {
-            return ccc == canonical_combining_class::not_reordered || ccc == canonical_combining_class::above;
+            kernel = internal::ascii_case_kernel_current<IsUpper, T>();
         }
-        static constexpr std::vector<lookahead_casing_context> lookahead_contexts_for_str(std::span<const char32_t> codepoints)
+
+        const T* const begPtr = in.data();
+        const T* const endPtr = begPtr + in.size() /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */;
+        const codepoint_iter<T> end(endPtr, endPtr);
+
+        codepoint_iter<T> it(begPtr, endPtr);
+        forward_casing_context fctx;
+        lookahead_casing_cache<T> lcache(begPtr);
+        mapped_units<T> pending;
+        internal::estimated_append(out, sz(in.size()), [&](const std::span<T> buf, sz& written) noexcept -> bool
         {
-            std::vector<lookahead_casing_context> ret(codepoints.size());
+            _retif(false, !pending.store(buf, written));
+            while (it < end)
+            {
+                if (asciiInvariant)
+                {
+                    const std::span<const T> rest(std::to_address(it), endPtr);
+                    if (const sz bulk = kernel(rest.data(), std::min(sz(rest.size()), sz(buf.size()) - written), buf.data() + written); bulk)
+                    {
+                        written += bulk;
+                        internal::casing_update_context_ascii(fctx, rest.first(bulk));
+                        it = codepoint_iter<T>(rest.data() + bulk /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */, endPtr);
+                    }
+                }
+
+                // Case at least one block of codepoints individually before handing back to the kernel, so mostly non-ASCII input doesn't pay for a failed kernel
+                // entry per codepoint.
+                for (sz i = 0_uz; it < end && (i < scalarRun || !asciiInvariant); i++)
+                {
+                    const char32_t c = *it;
+                    const lookahead_casing_context lctx = lcache.context_before(++it, end);
 
-            bool followedByCased = false;
-            bool beforeDot = false;
-            char32_t nextCp = U'\0';
-            for (ssz i = ssz(codepoints.size()) - 1_z; i >= 0_z; i--)
+                    char32_t conv[3];
+                    sz convSize = 0_uz;
+                    if constexpr (IsUpper)
+                        convSize = internal::dchar_to_upper_special(conv /* NOLINT(hicpp-no-array-decay) */, c, lang, fctx, lctx, unsafe);
+                    else
+                        convSize = internal::dchar_to_lower_special(conv /* NOLINT(hicpp-no-array-decay) */, c, lang, fctx, lctx, unsafe);
+                    pending.assign(std::span<const char32_t>(conv, convSize));
+                    internal::casing_update_context(fctx, c);
+                    _retif(false, !pending.store(buf, written));
+                }
+            }
+            return true;
+        });
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append `in` case folded to `out`.
+    /// @details As in `sys::internal::case_append(...)`, the output is allocated once at the length of `in`, and stored to directly.
+    template <ICharacter T, typename Allocator>
+    constexpr void fold_append(const std::span<const T> in, const std::u8string_view lang, std::basic_string<T, std::char_traits<T>, Allocator>& out)
+    {
+        codepoint_view<T> view(in);
+        auto it = view.begin();
+        mapped_units<T> pending;
+        internal::estimated_append(out, sz(in.size()), [&](const std::span<T> buf, sz& written) noexcept -> bool
+        {
+            _retif(false, !pending.store(buf, written));
+            while (it != view.end())
             {
-                const char32_t c = codepoints[sz(i)] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */;
-                lookahead_casing_context& lctx = ret[sz(i)] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */;
-                lctx.followed_by_cased = followedByCased;
-                lctx.more_above = nextCp != U'\0' && internal::dchar_ccc(nextCp) == canonical_combining_class::above;
-                lctx.before_dot = beforeDot;
-
-                if (internal::dchar_is_cased(c))
-                    followedByCased = true;
-                else if (!internal::dchar_is_case_ignorable(c))
-                    followedByCased = false;
-
-                if (c == U'\u0307')
-                    beforeDot = true;
-                else if (string::resets_combining(internal::dchar_ccc(c)))
-                    beforeDot = false;
-
-                nextCp = c;
+                char32_t conv[3];
+                const sz convSize = internal::dchar_fold_special(conv /* NOLINT(hicpp-no-array-decay) */, *it, lang, unsafe);
+                pending.assign(std::span<const char32_t>(conv, convSize));
+                ++it;
+                _retif(false, !pending.store(buf, written));
             }
+            return true;
+        });
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append `in` with invalids replaced to `out`, from the offset `at` of the first, copying the valid runs between them in bulk.
+    template <ICharacter T, typename Allocator>
+    constexpr void invalids_replaced_append(const std::span<const T> in, sz at, std::basic_string<T, std::char_traits<T>, Allocator>& out)
+    {
+        const std::basic_string_view<T> view(in.data(), in.size());
+        out.append(view.substr(0uz, at));
+        while (at != view.size())
+        {
+            // Each invalid sequence is a single code unit.
+            out.append(ch::replacement<T>());
+            const sz from = at + 1_uz;
+            at = from + internal::utf_first_invalid(in.subspan(from));
+            out.append(view.substr(from, at - from));
+        }
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append `in` transcoded to `out`, replacing invalid sequences with U+FFFD.
+    /// @details The output is measured in bulk first, so is allocated once at exactly its length.
+    template <ICharacter T, ICharacter U, typename Allocator>
+    constexpr void transcode_append(const std::span<const U> in, std::basic_string<T, std::char_traits<T>, Allocator>& out)
+    {
+        const sz prevSize = sz(out.size());
+        const sz length = internal::utf_transcoded_length<T>(in);
+        internal::transcode_progress progress;
+        out.resize_and_overwrite(prevSize + length, [&](T* const buf, size_t) noexcept
+        {
+            progress = internal::utf_transcode_fill(in, std::span<T>(buf + prevSize /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */, length));
+            return *(prevSize + progress.written);
+        });
+        // Only what was written is kept, so a measure that disagrees with the fill can't leave uninitialized code units behind.
+        _contract_assert(progress.read == sz(in.size()), "Transcoded length disagrees with the transcoded output!");
+    }
 
-            return ret;
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The first offset from `at` which doesn't continue a sequence, where `text` can be split and each side decoded alone exactly as it would be whole.
+    template <ICharacter T>
+    constexpr sz utf_sequence_boundary(const std::span<const T> text, sz at) noexcept
+    {
+        if constexpr (sizeof(T) == sizeof(char8_t))
+        {
+            while (at < text.size() && ch::is_continuation(text[at]))
+                at++;
         }
-        static constexpr void update_fcontext_for_char(forward_casing_context& ctx, const char32_t c) noexcept
+        else if constexpr (sizeof(T) == sizeof(char16_t))
         {
-            if (internal::dchar_is_cased(c))
-                ctx.is_preceded_by_cased = true;
-            else if (!internal::dchar_is_case_ignorable(c))
-                ctx.is_preceded_by_cased = false;
+            if (at < text.size() && ch::is_low_surrogate(text[at]))
+                at++;
+        }
+        return at;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The first offset from `at` following ASCII whitespace, or `text.size()`, where `text` can be split and each side cased alone exactly as it would be whole.
+    /// @details ASCII whitespace is neither cased nor case-ignorable, and ends any combining sequence, so no casing context reaches across it in either direction.
+    template <ICharacter T>
+    constexpr sz casing_boundary(const std::span<const T> text, sz at) noexcept
+    {
+        while (at < text.size() && (at == 0_uz || !internal::is_ascii_space(text[at - 1_uz])))
+            at++;
+        return at;
+    }
+} // namespace sys::internal
 
-            if (internal::dchar_is_soft_dotted(c))
-                ctx.after_soft_dotted = true;
-            else if (const canonical_combining_class ccc = internal::dchar_ccc(c); string::resets_combining(ccc))
-                ctx.after_soft_dotted = false;
+namespace sys
+{
+    template <ICharacter T>
+    struct codepoint_view;
 
-            if (c == U'\u0049')
-                ctx.after_i = true;
-            else if (const canonical_combining_class ccc = internal::dchar_ccc(c); string::resets_combining(ccc))
-                ctx.after_i = false;
-        }
+    /// @ingroup sys_text
+    /// @brief Unicode string container.
+    /// @details
+    /// Storage is obtained from `Allocator`, and every string produced from this one, by trimming, casing, splitting and so on, is allocated with a copy of its
+    /// allocator. With `sys::pmr::string<T>`, the strings of a whole parsing pipeline can so share an arena, such as a `sys::inline_buffer_resource<Capacity>`.
+    template <ICharacter T, typename Allocator = std::allocator<T>>
+    class string final
+    {
+        std::basic_string<T, std::char_traits<T>, Allocator> str;
 
         constexpr auto first_non_ws_beg() const
         {
+            const T* const begPtr = std::to_address(this->cbegin());
             const T* const endPtr = std::to_address(this->cend());
             const codepoint_iter<T> end(endPtr, endPtr);
 
-            auto ret = codepoint_iter<T>(std::to_address(this->cbegin()), endPtr);
-            while (ret < end && ch::is_whitespace(*ret))
-                ++ret;
+            // Skip runs of ASCII whitespace in bulk, decoding only the codepoints between them.
+            codepoint_iter<T> ret(begPtr, endPtr);
+            while (ret < end)
+            {
+                if (const sz spaces = internal::ascii_space_run<false>(std::span<const T>(std::to_address(ret), endPtr)); spaces != 0_uz)
+                    ret = codepoint_iter<T>(std::to_address(ret) + spaces /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */, endPtr);
+                else if (ch::is_whitespace(*ret))
+                    ++ret;
+                else
+                    break;
+            }
 
-            return this->cbegin() + (std::to_address(ret) - std::to_address(this->cbegin()));
+            return this->cbegin() + (std::to_address(ret) - begPtr);
         }
         constexpr auto last_ws_beg() const
         {
+            const T* const begPtr = std::to_address(this->cbegin());
             const T* const endPtr = std::to_address(this->cend());
-            const codepoint_iter<T> end(endPtr, endPtr);
+            const codepoint_iter<T> beg(begPtr, endPtr);
 
-            const T* ret = std::to_address(this->cbegin());
-            auto it = codepoint_iter<T>(std::to_address(this->cbegin()), endPtr);
-            while (it < end)
+            // As above, but decoding backward from the end, so only the trailing whitespace is visited.
+            codepoint_iter<T> ret(begPtr, endPtr, endPtr);
+            while (ret > beg)
             {
-                if (!ch::is_whitespace(*it))
-                    ret = std::to_address(++it);
+                codepoint_iter<T> prev = ret;
+                if (const sz spaces = internal::ascii_space_run<true>(std::span<const T>(begPtr, std::to_address(ret))); spaces != 0_uz)
+                    ret = codepoint_iter<T>(begPtr, std::to_address(ret) - spaces /* NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) */, endPtr);
+                else if (ch::is_whitespace(*--prev))
+                    ret = prev;
                 else
-                    ++it;
+                    break;
             }
 
-            return this->cbegin() + (ret - std::to_address(this->cbegin()));
+            return this->cbegin() + (std::to_address(ret) - begPtr);
         }
         template <bool IsUpper>
-        constexpr string as_cased(std::u8string_view lang) const
+        constexpr string as_cased(const std::u8string_view lang) const
         {
-            string ret;
-            ret.reserve(this->capacity());
-
-            std::vector<char32_t> codepoints;
-            codepoints.reserve(this->size());
-            for (const char32_t c : codepoint_view<T>(*this))
-                codepoints.push_back(c);
-            _retif(ret, codepoints.empty());
-
-            std::vector<lookahead_casing_context> lookaheads = string::lookahead_contexts_for_str(codepoints);
-            forward_casing_context fctx;
-            for (sz i = 0_uz; i < sz(codepoints.size()); i++)
-            {
-                const char32_t c = codepoints[i] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */;
-                const lookahead_casing_context& lctx = lookaheads[i] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */;
-
-                char32_t conv[3];
-                sz convSize = 0_uz;
-                if constexpr (IsUpper)
-                    convSize = internal::dchar_to_upper_special(conv /* NOLINT(hicpp-no-array-decay) */, c, lang, fctx, lctx, unsafe);
-                else
-                    convSize = internal::dchar_to_lower_special(conv /* NOLINT(hicpp-no-array-decay) */, c, lang, fctx, lctx, unsafe);
-
-                T buf[sizeof(char32_t) / sizeof(T)];
-                for (sz j = 0_uz; j < convSize; j++)
-                    ret.append(std::span(buf, ch::write_codepoint(conv[j] /* NOLINT(cppcoreguidelines-pro-bounds-constant-array-index) */, buf, unsafe)));
+            string ret(this->get_allocator());
+            internal::case_append<IsUpper>(std::span<const T>(*this), lang, ret.str);
+            return ret;
+        }
 
-                string::update_fcontext_for_char(fctx, c);
-            }
+        // Internal: Validation utilities.
 
+        /// Copy with invalids replaced, from the offset of the first.
+        constexpr string invalids_replaced_from(const sz at) const
+        {
+            string ret(this->get_allocator());
+            ret.reserve(this->capacity());
+            internal::invalids_replaced_append(std::span<const T>(*this), at, ret.str);
             return ret;
         }
     public:
         /// @brief Empty string.
         constexpr string() = default;
+        /// @brief Empty string, allocating with `alloc`.
+        constexpr explicit string(const Allocator& alloc) noexcept : str(alloc) { }
         constexpr string(std::nullptr_t) = delete;
         template <size_t N>
         requires (N > 0uz)
@@ -165,28 +426,39 @@ namespace sys
         /// @warning `unsafe` because `cstr` has preconditions.
         /// @pre `const T cstr[N] && cstr != nullptr && cstr[N - 1z] == '\0'`
         constexpr string(const T* cstr, decltype(unsafe)) : string(cstr, cstr + ch::buffer_size(cstr, unsafe)) { }
-        constexpr /* NOLINT(hicpp-explicit-conversions) */ string(std::basic_string<T> str) : str(std::move(str)) { }
-        constexpr explicit string(const std::span<const T> data) : string(data.begin(), data.end()) { }
-        constexpr explicit string(const std::basic_string_view<T> data) : string(data.begin(), data.end()) { }
+        constexpr /* NOLINT(hicpp-explicit-conversions) */ string(std::basic_string<T, std::char_traits<T>, Allocator> str) : str(std::move(str)) { }
+        constexpr explicit string(const std::span<const T> data, const Allocator& alloc = Allocator()) : string(data.begin(), data.end(), alloc) { }
+        constexpr explicit string(const std::basic_string_view<T> data, const Allocator& alloc = Allocator()) : string(data.begin(), data.end(), alloc) { }
         /// @pre `++...beg == end`
-        constexpr explicit string(std::input_iterator auto beg, std::input_iterator auto end) : str(beg, end) { }
+        constexpr explicit string(std::input_iterator auto beg, std::input_iterator auto end, const Allocator& alloc = Allocator()) : str(beg, end, alloc) { }
         constexpr explicit string(const IEnumerable auto& container) : string(std::begin(container), std::end(container)) { }
         /// @brief Construct from a single character.
         constexpr /* NOLINT(hicpp-explicit-conversions) */ string(const T c) : str(1uz, c) { }
         /// @brief Repeat a character.
-        constexpr string(const T c, const sz count) : str(count, c) { }
+        constexpr string(const T c, const sz count, const Allocator& alloc = Allocator()) : str(count, c, alloc) { }
         constexpr string(const string&) = default;
-        constexpr string(string&& other) noexcept { swap(*this, other); }
+        /// @brief Copy `other`, allocating with `alloc`.
+        constexpr string(const string& other, const Allocator& alloc) : str(other.str, alloc) { }
+        // Move-constructed rather than swapped with an empty string, which would trade `other`'s allocator for a default-constructed one.
+        constexpr string(string&& other) noexcept : str(std::move(other.str)) { other.str.clear(); }
         ~string() = default;
 
         constexpr string& operator=(const string&) = default;
-        constexpr string& operator=(string&& other) noexcept
+        // Likewise, strings with unequal allocators can't be swapped, so the contents are moved, or copied between arenas.
+        constexpr string& operator=(string&& other) noexcept(std::is_nothrow_move_assignable_v<std::basic_string<T, std::char_traits<T>, Allocator>>)
         {
-            swap(*this, other);
+            this->str = std::move(other.str);
+            other.str.clear();
             return *this;
         }
 
         friend constexpr bool operator==(const string&, const string&) = default;
+        template <typename OtherAllocator>
+        requires (!std::same_as<Allocator, OtherAllocator>)
+        friend constexpr bool operator==(const string& a, const string<T, OtherAllocator>& b)
+        {
+            return a.str == std::basic_string_view<T>(b);
+        }
         template <size_t N>
         friend constexpr bool operator==(const string& a, const T (&b)[N])
         {
@@ -200,6 +472,12 @@ namespace sys
         friend constexpr bool operator==(const string& a, const std::basic_string_view<T>& b) { return a.str == b; }
         friend constexpr bool operator==(const std::basic_string_view<T>& a, const string& b) { return b.str == a; }
         friend constexpr auto operator<=>(const string&, const string&) = default;
+        template <typename OtherAllocator>
+        requires (!std::same_as<Allocator, OtherAllocator>)
+        friend constexpr auto operator<=>(const string& a, const string<T, OtherAllocator>& b)
+        {
+            return a.str <=> std::basic_string_view<T>(b);
+        }
         template <size_t N>
         friend constexpr auto operator<=>(const string& a, const T (&b)[N])
         {
@@ -227,27 +505,43 @@ namespace sys
         constexpr const T& operator[](const sz i, decltype(unsafe)) const { return this->str[i]; }
 
         /// @brief Transcode between unicode strings of different character types.
+        /// @details Invalid sequences are replaced with U+FFFD. Runs of ASCII are converted in bulk, using the widest vector instructions available at runtime.
         template <ICharacter U>
         requires (!std::same_as<T, U>)
-        constexpr explicit string(const std::basic_string_view<U> other)
+        constexpr explicit string(const std::basic_string_view<U> other, const Allocator& alloc = Allocator()) : str(alloc)
         {
-            for (const char32_t c : codepoint_view(std::span(other)))
-            {
-                T buf[(sizeof(char32_t) / sizeof(T)) + 1uz] {};
-                this->append(std::span(buf, ch::write_codepoint(c, buf, unsafe)));
-            }
+            internal::transcode_append(std::span<const U>(other), this->str);
         }
         /// @see `sys::string<T>::string(const std::basic_string_view<U>)`
-        template <ICharacter U>
+        template <ICharacter U, typename UAllocator>
         requires (!std::same_as<T, U>)
-        constexpr explicit string(const std::basic_string<U>& other) : string(std::basic_string_view<U>(other))
+        constexpr explicit string(const std::basic_string<U, std::char_traits<U>, UAllocator>& other, const Allocator& alloc = Allocator()) :
+            string(std::basic_string_view<U>(other), alloc)
         { }
         /// @see `sys::string<T>::string(const std::basic_string_view<U>)`
-        template <ICharacter U>
+        template <ICharacter U, typename UAllocator>
         requires (!std::same_as<T, U>)
-        constexpr explicit string(const sys::string<U>& other) : string(_as(other, std::basic_string_view<U>))
+        constexpr explicit string(const sys::string<U, UAllocator>& other, const Allocator& alloc = Allocator()) : string(_as(other, std::basic_string_view<U>), alloc)
         { }
 
+        /// @brief Copy of the allocator the string allocates with.
+        [[nodiscard]] constexpr Allocator get_allocator() const noexcept { return this->str.get_allocator(); }
+
+        /// @brief The length in code units of `U` the string transcodes to, with invalid sequences replaced with U+FFFD.
+        /// @details Measured in bulk, using the widest vector instructions available at runtime.
+        template <ICharacter U>
+        [[nodiscard]] constexpr sz transcoded_length() const noexcept
+        {
+            return internal::utf_transcoded_length<U>(std::span<const T>(*this));
+        }
+        /// @brief Transcode into the caller-owned buffer `out`, without allocating, replacing invalid sequences with U+FFFD.
+        /// @return The number of code units stored, which is `transcoded_length<U>()` if `out` is large enough, otherwise as many whole codepoints are stored as fit.
+        template <ICharacter U>
+        constexpr sz transcode_into(const std::span<U> out) const noexcept
+        {
+            return internal::utf_transcode_fill(std::span<const T>(*this), out).written;
+        }
+
         [[nodiscard]] constexpr bool empty() const noexcept { return this->str.empty(); }
         [[nodiscard]] constexpr sz size() const noexcept { return sz(this->str.size()); }
         [[nodiscard]] constexpr sz capacity() const noexcept { return sz(this->str.capacity()); }
@@ -275,7 +569,9 @@ namespace sys
         /// @overload
         [[nodiscard]] constexpr const T& back(decltype(unsafe)) const { return this->str.back(); }
 
-        [[nodiscard]] bool contains(const std::basic_string_view<T> substr) const { return this->str.contains(substr); }
+        [[nodiscard]] bool contains(const std::basic_string_view<T> substr) const { return string_searcher<T>(substr).found_in(*this); }
+        /// @brief Whether the needle of `searcher` occurs in the string, for searching many strings for the same substring.
+        [[nodiscard]] bool contains(const string_searcher<T>& searcher) const { return searcher.found_in(*this); }
         [[nodiscard]] bool starts_with(const T c) const { return this->str.starts_with(c); }
         [[nodiscard]] bool starts_with(const std::basic_string_view<T> substr) const { return this->str.starts_with(substr); }
         [[nodiscard]] bool ends_with(const T c) const { return this->str.ends_with(c); }
@@ -290,16 +586,20 @@ namespace sys
         }
         /// @brief Find the index of the first occurrence of `substr` from `from`.
         [[nodiscard]] sz find_index(const std::basic_string_view<T> substr, const sz from = 0_uz) const
+        {
+            return this->find_index(string_searcher<T>(substr), from);
+        }
+        /// @brief Find the index of the first occurrence of the needle of `searcher` from `from`, for searching many strings for the same substring.
+        [[nodiscard]] sz find_index(const string_searcher<T>& searcher, const sz from = 0_uz) const
         {
             _retif(this->size(), from >= this->size());
-            const sz ret = this->str.find(substr, from);
-            return ret != std::basic_string_view<T>::npos ? ret : this->size();
+            return searcher.find(*this, from);
         }
         /// @brief Substring of range [`from`, `from` + `count`).
         [[nodiscard]] string substr(const sz from, const sz count) const
         {
-            _retif({}, from >= this->size());
-            return this->str.substr(from, count);
+            _retif(string(this->get_allocator()), from >= this->size());
+            return string(std::basic_string_view<T>(*this).substr(from, count), this->get_allocator());
         }
 
         constexpr void reserve(const sz capacity) { this->str.reserve(capacity); }
@@ -354,8 +654,8 @@ namespace sys
         constexpr string trimmed() const
         {
             const auto from = this->first_non_ws_beg(), to = this->last_ws_beg();
-            _retif({}, from >= to);
-            return std::basic_string<T>(from, to);
+            _retif(string(this->get_allocator()), from >= to);
+            return string(from, to, this->get_allocator());
         }
         /// @brief Remove leading and trailing whitespace.
         constexpr string& trim() &
@@ -366,34 +666,38 @@ namespace sys
         /// @overload
         constexpr string trim() && { return this->trim(), std::move(*this); }
         /// @brief Obtain a copy with leading whitespace removed.
-        constexpr string start_trimmed() const { return std::basic_string<T>(this->first_non_ws_beg(), this->cend()); }
+        constexpr string start_trimmed() const { return string(this->first_non_ws_beg(), this->cend(), this->get_allocator()); }
         /// @brief Remove leading whitespace.
         constexpr string& trim_start() & { return this->str.erase(this->cbegin(), this->first_non_ws_beg()), *this; }
         /// @overload
         constexpr string trim_start() && { return this->trim_start(), std::move(*this); }
         /// @brief Obtain a copy with trailing whitespace removed.
-        constexpr string end_trimmed() const { return std::basic_string<T>(this->cbegin(), this->last_ws_beg()); }
+        constexpr string end_trimmed() const { return string(this->cbegin(), this->last_ws_beg(), this->get_allocator()); }
         /// @brief Remove trailing whitespace.
         constexpr string& trim_end() & { return this->str.erase(this->last_ws_beg(), this->cend()), *this; }
         /// @overload
         constexpr string trim_end() && { return this->trim_end(), std::move(*this); }
 
+        /// @brief Offset of the first invalid sequence, which `sys::string<T>::invalids_replaced()` replaces with U+FFFD, or `size()` if there's none.
+        /// @details Validated in bulk, using the widest vector instructions available at runtime.
+        [[nodiscard]] constexpr sz first_invalid_offset() const noexcept { return internal::utf_first_invalid(std::span<const T>(*this)); }
+        /// @brief Whether the string is valid UTF-8, UTF-16 or UTF-32, without unpaired surrogates, overlong sequences or codepoints beyond U+10FFFF.
+        /// @see `sys::string<T>::first_invalid_offset()`
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return this->first_invalid_offset() == this->size(); }
+
         /// @brief Obtain a copy with invalids replaced with U+FFFD.
-        constexpr string invalids_replaced() const
+        /// @details Only invalid sequences are decoded and replaced, the valid text between them is copied in bulk.
+        constexpr string invalids_replaced() const { return this->invalids_replaced_from(this->first_invalid_offset()); }
+        /// @brief Replace invalid codepoints with U+FFFD.
+        /// @details Doesn't allocate if the string is already valid.
+        constexpr string& replace_invalid() &
         {
-            string ret;
-            ret.reserve(this->capacity());
-            for (const char32_t c : codepoint_view(*this))
-            {
-                T buf[(sizeof(char32_t) / sizeof(T)) + 1uz] {};
-                ret.append(std::span(buf, ch::write_codepoint(c, buf, unsafe)));
-            }
-            return ret;
+            if (const sz at = this->first_invalid_offset(); at != this->size())
+                *this = this->invalids_replaced_from(at);
+            return *this;
         }
-        /// @brief Replace invalid codepoints with U+FFFD.
-        constexpr string& replace_invalid() & { return (*this = this->invalids_replaced()); }
         /// @overload
-        constexpr string replace_invalid() && { return this->invalids_replaced(); }
+        constexpr string replace_invalid() && { return this->replace_invalid(), std::move(*this); }
 
         /// @brief Obtain a copy as lowercase.
         constexpr string lowered(std::u8string_view lang = u8"") const { return this->as_cased<false>(lang); }
@@ -411,43 +715,119 @@ namespace sys
         /// @brief Obtain a copy case folded.
         constexpr string folded(std::u8string_view lang = u8"") const
         {
-            string ret;
-            ret.reserve(this->capacity());
-            for (const char32_t c : codepoint_view(*this))
-            {
-                char32_t conv[3];
-                const sz convSize = internal::dchar_fold_special(conv /* NOLINT(hicpp-no-array-decay) */, c, lang, unsafe);
-
-                T buf[sizeof(char32_t) / sizeof(T)];
-                for (sz i = 0_uz; i < convSize; i++)
-                    ret.append(std::span(buf, ch::write_codepoint(conv[i] /* NOLINT(cppcoreguidelines-pro-bounds-constant-array-index) */, buf, unsafe)));
-            }
+            string ret(this->get_allocator());
+            internal::fold_append(std::span<const T>(*this), lang, ret.str);
             return ret;
         }
         /// @brief Transform with canonical case folding.
         constexpr string& fold(std::u8string_view lang = u8"") & { return (*this = this->folded(lang)); }
         /// @overload
         constexpr string fold(std::u8string_view lang = u8"") && { return this->folded(lang); }
+        /// @brief Whether the string equals `other` once both are case folded, without allocating.
+        /// @see `sys::fold_equals(...)`
+        [[nodiscard]] constexpr bool fold_equals(const std::basic_string_view<T> other, const std::u8string_view lang = u8"") const noexcept
+        {
+            return sys::fold_equals(std::basic_string_view<T>(*this), other, lang);
+        }
+        /// @brief Compare the string to `other` once both are case folded, without allocating.
+        /// @see `sys::fold_compare(...)`
+        [[nodiscard]] constexpr std::strong_ordering fold_compare(const std::basic_string_view<T> other, const std::u8string_view lang = u8"") const noexcept
+        {
+            return sys::fold_compare(std::basic_string_view<T>(*this), other, lang);
+        }
+        /// @brief Hash the string once case folded, without allocating.
+        /// @see `sys::fold_hash(...)`
+        [[nodiscard]] constexpr size_t fold_hash(const std::u8string_view lang = u8"") const noexcept { return sys::fold_hash(std::basic_string_view<T>(*this), lang); }
+
+        /// @brief Whether the string is in normalization form `form`.
+        /// @see `sys::is_normalized(...)`
+        [[nodiscard]] constexpr bool is_normalized(const normalization_form form = normalization_form::nfc) const
+        {
+            return sys::is_normalized(std::basic_string_view<T>(*this), form);
+        }
+        /// @brief Obtain a copy in normalization form `form`, with invalids replaced with U+FFFD.
+        /// @details An already normalized string is verified in a single pass and copied as-is, otherwise only what follows its last stable codepoint is normalized.
+        constexpr string normalized(const normalization_form form = normalization_form::nfc) const
+        {
+            const std::basic_string_view<T> view(*this);
+            const auto [result, stable] = internal::normalization_quick_check(view, form);
+            if (result == internal::normalization_quick_check_result::yes)
+                return string(*this, this->get_allocator());
+
+            string ret(this->get_allocator());
+            ret.reserve(this->capacity());
+            ret.str.append(view.substr(0uz, stable));
+            internal::normalize_append(view.substr(stable), form, ret.str);
+            return ret;
+        }
+        /// @brief Transform to normalization form `form`, replacing invalids with U+FFFD.
+        /// @details Doesn't allocate if the string is already normalized.
+        constexpr string& normalize(const normalization_form form = normalization_form::nfc) &
+        {
+            const auto [result, stable] = internal::normalization_quick_check(std::basic_string_view<T>(*this), form);
+            if (result == internal::normalization_quick_check_result::yes)
+                return *this;
+
+            std::basic_string<T, std::char_traits<T>, Allocator> tail(this->get_allocator());
+            internal::normalize_append(std::basic_string_view<T>(*this).substr(stable), form, tail);
+            this->str.resize(stable);
+            this->str.append(tail);
+            return *this;
+        }
+        /// @overload
+        constexpr string normalize(const normalization_form form = normalization_form::nfc) && { return this->normalize(form), std::move(*this); }
+
+        /// @brief Lazily split the string into views of the substrings separated by `delimiter`.
+        /// @attention Lifetime assumptions! `this` must outlive the view.
+        /// @see `sys::split_view`
+        [[nodiscard]] constexpr auto split_view(const T delimiter) const noexcept
+        {
+            return sys::split_view<T, internal::split_by_unit<T>>(std::basic_string_view<T>(*this), delimiter);
+        }
+        /// @brief Lazily split the string into views of the substrings separated by `delimiter`, or into single code units if it's empty.
+        /// @attention Lifetime assumptions! `this` and `delimiter` must outlive the view.
+        /// @see `sys::split_view`
+        [[nodiscard]] constexpr auto split_view(const std::basic_string_view<T> delimiter) const noexcept
+        {
+            return sys::split_view<T, internal::split_by_substring<T>>(std::basic_string_view<T>(*this), delimiter);
+        }
+        /// @brief Lazily split the string into views of the substrings separated by the needle of `searcher`, for splitting many strings by the same substring.
+        /// @attention Lifetime assumptions! `this` and the needle must outlive the view.
+        /// @see `sys::split_view`
+        [[nodiscard]] constexpr auto split_view(const string_searcher<T>& searcher) const noexcept
+        {
+            return sys::split_view<T, internal::split_by_substring<T>>(std::basic_string_view<T>(*this), searcher);
+        }
+        /// @brief Lazily split the string into views of the substrings separated by any codepoint satisfying `pred`, such as one in a `sys::codepoint_set`.
+        /// @attention Lifetime assumptions! `this` must outlive the view.
+        /// @see `sys::split_view`
+        template <typename Pred>
+        requires (!ICharacter<Pred> && ICallable<const Pred&, char32_t>)
+        [[nodiscard]] constexpr auto split_view(Pred pred) const noexcept(INothrowMoveConstructible<Pred>)
+        {
+            return sys::split_view<T, internal::split_by_codepoint<T, Pred>>(std::basic_string_view<T>(*this), std::move(pred));
+        }
+        /// @brief Lazily split the string into views of its extended grapheme clusters, the characters a user perceives.
+        /// @attention Lifetime assumptions! `this` must outlive the view.
+        /// @see `sys::grapheme_view`
+        [[nodiscard]] constexpr sys::grapheme_view<T> grapheme_view() const noexcept { return sys::grapheme_view<T>(std::basic_string_view<T>(*this)); }
+        /// @brief Lazily split the string into views of its words, and of the runs of spaces and punctuation between them.
+        /// @attention Lifetime assumptions! `this` must outlive the view.
+        /// @see `sys::word_view`
+        [[nodiscard]] constexpr sys::word_view<T> word_view() const noexcept { return sys::word_view<T>(std::basic_string_view<T>(*this)); }
 
         /// @brief Split the string into substrings separated by `delimiter`.
+        /// @see `sys::string::split_view(...)`, which doesn't allocate.
         template <IAppendable<string> Container = std::vector<string>>
         [[nodiscard]] Container split(const T delimiter) const
         {
             Container ret;
-            auto from = this->begin();
-            for (auto it = this->begin(); it < this->end(); ++it)
-            {
-                if (*it == delimiter)
-                {
-                    meta::generic_container_adaptor(ret).append_back(string(from, it));
-                    from = it + 1z;
-                }
-            }
-            meta::generic_container_adaptor(ret).append_back(string(from, this->end()));
-
+            for (const std::basic_string_view<T> piece : this->split_view(delimiter))
+                meta::generic_container_adaptor(ret).append_back(string(piece, this->get_allocator()));
             return ret;
         }
         /// @brief Split the string into substrings separated by `delimiter`.
+        /// @see `sys::string::split_view(...)`, which doesn't allocate.
         template <typename Container = std::vector<string>>
         requires requires {
             requires IAppendable<Container, T>;
@@ -463,38 +843,22 @@ namespace sys
                     meta::generic_container_adaptor(ret).append_back(c);
                 return ret;
             }
-            if (delimiter.size() > this->size())
-            {
-                Container ret;
-                meta::generic_container_adaptor(ret).append_back(*this);
-                return ret;
-            }
 
             Container ret;
-            auto from = this->begin();
-            for (auto it = this->begin(); it <= this->end() - ssz(delimiter.size()); ++it)
-            {
-                if (std::basic_string_view<T>(it, it + ssz(delimiter.size())) == delimiter)
-                {
-                    meta::generic_container_adaptor(ret).append_back(string(from, it));
-                    it += ssz(delimiter.size()) - 1_z;
-                    from = it + 1z;
-                }
-            }
-            meta::generic_container_adaptor(ret).append_back(string(from, this->end()));
-
+            for (const std::basic_string_view<T> piece : this->split_view(delimiter))
+                meta::generic_container_adaptor(ret).append_back(string(piece, this->get_allocator()));
             return ret;
         }
-        /// @brief Join the strings in `container` with `sep`.
+        /// @brief Join the strings in `container` with `sep`, allocating with `alloc`.
         template <typename Container, typename Chars>
         requires requires {
             requires IEnumerable<Container>;
             requires IEmptyQueryable<Container>;
         }
-        [[nodiscard]] static string join(const Container& container, const Chars& sep)
+        [[nodiscard]] static string join(const Container& container, const Chars& sep, const Allocator& alloc = Allocator())
         {
             if (meta::generic_container_adaptor(container).empty())
-                return {};
+                return string(alloc);
 
             sz totalSize = 0_uz;
             for (const auto& s : container)
@@ -514,7 +878,7 @@ namespace sys
                     totalSize += sz(std::size(sep)) * (sz(std::size(container)) - 1_uz);
             }
 
-            string ret;
+            string ret(alloc);
             ret.reserve(totalSize);
 
             bool needPrependSep = false;
@@ -540,14 +904,16 @@ namespace sys
 
         friend void swap(string& a, string& b) noexcept(noexcept(std::swap(a.str, b.str))) { std::swap(a.str, b.str); }
 
-        template <ICharacter U>
+        template <ICharacter U, typename UAllocator>
         friend class string;
     };
 
     template <ICharacter T>
     string(std::basic_string_view<T>) -> string<T>;
-    template <ICharacter T>
-    string(std::basic_string<T>) -> string<T>;
+    template <ICharacter T, typename Allocator>
+    string(std::basic_string_view<T>, Allocator) -> string<T, Allocator>;
+    template <ICharacter T, typename Allocator>
+    string(std::basic_string<T, std::char_traits<T>, Allocator>) -> string<T, Allocator>;
 
     /// @ingroup sys_text
     using cstr = string<char>;
@@ -561,18 +927,177 @@ namespace sys
     using str32 = string<char32_t>;
 } // namespace sys
 
+namespace sys::pmr
+{
+    /// @ingroup sys_text
+    /// @brief `sys::string<T>` allocating from a `std::pmr::memory_resource`, such as an arena shared by the strings of a parsing pipeline.
+    template <ICharacter T>
+    using string = sys::string<T, std::pmr::polymorphic_allocator<T>>;
+
+    /// @ingroup sys_text
+    using cstr = string<char>;
+    /// @ingroup sys_text
+    using wstr = string<wchar_t>;
+    /// @ingroup sys_text
+    using str = string<char8_t>;
+    /// @ingroup sys_text
+    using str16 = string<char16_t>;
+    /// @ingroup sys_text
+    using str32 = string<char32_t>;
+} // namespace sys::pmr
+
 /// @ingroup sys_text
 /// @brief `std::formatter<...>` specialization for `sys::string<...>`.
-template <sys::ICharacter T, sys::ICharacter FormatChar>
-struct /* NOLINT(bugprone-std-namespace-modification) */ std::formatter<sys::string<T>, FormatChar> : std::formatter<std::basic_string_view<FormatChar>, FormatChar>
+/// @details
+/// Takes the standard string specification, `[[fill]align][width][.precision][s]`, with width and precision counted in codepoints rather than code units. A string
+/// of another character type is transcoded straight into the output, a block at a time through a buffer on the stack, rather than into a temporary string.
+template <sys::ICharacter T, typename Allocator, sys::ICharacter FormatChar>
+struct /* NOLINT(bugprone-std-namespace-modification) */ std::formatter<sys::string<T, Allocator>, FormatChar>
 {
-    /// @brief Formats a `sys::string<T>` as a `std::basic_string_view<FormatChar>`.
+private:
+    static constexpr size_t no_arg = std::numeric_limits<size_t>::max();
+
+    char32_t fill = U' ';
+    FormatChar align = FormatChar('<');
+    size_t width = 0uz;
+    size_t width_arg = no_arg;
+    size_t precision = std::numeric_limits<size_t>::max();
+    size_t precision_arg = no_arg;
+
+    /// Parse a width or precision at `it`, either literal, or the id of the argument it's taken from as `{}` or `{n}`.
+    template <typename Iterator>
+    static constexpr Iterator parse_count(Iterator it, const Iterator end, std::basic_format_parse_context<FormatChar>& context, size_t& count, size_t& arg)
+    {
+        const auto parseNumber = [&](size_t& ret) -> bool
+        {
+            const Iterator beg = it;
+            for (ret = 0uz; it != end && *it >= FormatChar('0') && *it <= FormatChar('9'); ++it)
+                ret = ret * 10uz + _as(*it - FormatChar('0'), size_t);
+            return it != beg;
+        };
+
+        if (it == end || *it != FormatChar('{'))
+        {
+            (void)parseNumber(count);
+            return it;
+        }
+
+        ++it;
+        if (parseNumber(arg))
+            context.check_arg_id(arg);
+        else
+            arg = context.next_arg_id();
+        if (it == end || *it != FormatChar('}'))
+            throw std::format_error("Expected `}` closing the argument id of a `sys::string` width or precision.");
+        return ++it;
+    }
+    /// The width or precision taken from the argument `arg`.
+    template <typename FormatContext>
+    static size_t count_arg(FormatContext& context, const size_t arg)
+    {
+        const auto get = []<typename Arg>(const Arg& value) -> size_t
+        {
+            if constexpr (std::integral<Arg> && !std::same_as<Arg, bool> && !std::same_as<Arg, FormatChar>)
+            {
+                if (std::cmp_less(value, 0))
+                    throw std::format_error("A `sys::string` width or precision can't be negative.");
+                return _as(value, size_t);
+            }
+            else
+                throw std::format_error("A `sys::string` width or precision must be an integer.");
+        };
+#if __cpp_lib_format >= 202306L
+        return context.arg(arg).visit(get);
+#else
+        return std::visit_format_arg(get, context.arg(arg));
+#endif
+    }
+    /// Output `count` fill codepoints to `out`.
+    template <typename OutputIterator>
+    constexpr OutputIterator pad(OutputIterator out, const size_t count) const
+    {
+        FormatChar units[sizeof(char32_t) / sizeof(FormatChar)] {};
+        const sz size = sys::ch::write_codepoint(this->fill, units /* NOLINT(hicpp-no-array-decay) */, unsafe);
+        for (size_t i = 0uz; i < count; i++)
+            out = std::copy_n(units /* NOLINT(hicpp-no-array-decay) */, *size, out);
+        return out;
+    }
+public:
+    /// @brief Parse the format specification.
+    /// @throws `std::format_error` if it isn't a string specification.
+    constexpr auto parse(std::basic_format_parse_context<FormatChar>& context)
+    {
+        const auto isAlign = [](const FormatChar c) -> bool { return c == FormatChar('<') || c == FormatChar('^') || c == FormatChar('>'); };
+
+        auto it = context.begin();
+        const auto end = context.end();
+        if (it != end && *it != FormatChar('}'))
+        {
+            // The fill is any single codepoint, so only known once the alignment follows it. It's decoded from a copy, as reinterpreting `FormatChar` isn't possible
+            // in constant evaluation.
+            using unit = sys::ch::unicode_equiv<FormatChar>;
+            unit units[sizeof(char32_t) / sizeof(FormatChar)] {};
+            const size_t unitCount = std::min(std::size(units), _as(end - it, size_t));
+            std::transform(it, it + unitCount, units /* NOLINT(hicpp-no-array-decay) */, [](const FormatChar c) -> unit { return _as(c, unit); });
+            const auto [c, size] = sys::ch::read_codepoint(std::span<const unit>(units, unitCount), unsafe);
+            if (*size < _as(end - it, size_t) && isAlign(it[*size]))
+            {
+                this->fill = c;
+                this->align = it[*size];
+                it += *size + 1uz;
+            }
+            else if (isAlign(*it))
+                this->align = *it++;
+        }
+
+        it = formatter::parse_count(it, end, context, this->width, this->width_arg);
+        if (it != end && *it == FormatChar('.'))
+        {
+            if (++it == end || (*it != FormatChar('{') && (*it < FormatChar('0') || *it > FormatChar('9'))))
+                throw std::format_error("Expected a `sys::string` precision following `.`.");
+            it = formatter::parse_count(it, end, context, this->precision, this->precision_arg);
+        }
+        if (it != end && *it == FormatChar('s'))
+            ++it;
+        if (it != end && *it != FormatChar('}'))
+            throw std::format_error("Invalid format specification for `sys::string`.");
+        return it;
+    }
+    /// @brief Format `str`, padded to the width and cut to the precision.
     template <typename FormatContext>
-    auto format(const sys::string<T>& str, FormatContext& context) const
+    auto format(const sys::string<T, Allocator>& str, FormatContext& context) const
     {
+        const size_t width = this->width_arg == no_arg ? this->width : formatter::count_arg(context, this->width_arg);
+        const size_t precision = this->precision_arg == no_arg ? this->precision : formatter::count_arg(context, this->precision_arg);
+
+        // Codepoints are only walked as far as the precision cuts the string, or else as far as decides the padding.
+        const std::span<const T> in(str);
+        const size_t walk = precision != std::numeric_limits<size_t>::max() ? precision : width;
+        sz cut = 0_uz;
+        size_t count = 0uz;
+        for (; count < walk && cut < in.size(); count++)
+            cut += sys::ch::read_codepoint(in.subspan(cut), unsafe).size_bytes;
+        if (precision == std::numeric_limits<size_t>::max())
+            cut = sz(in.size());
+
+        const size_t padding = width > count ? width - count : 0uz;
+        const size_t before = this->align == FormatChar('>') ? padding : this->align == FormatChar('^') ? padding / 2uz : 0uz;
+
+        auto out = this->pad(context.out(), before);
         if constexpr (std::same_as<T, FormatChar>)
-            return std::formatter<std::basic_string_view<FormatChar>, FormatChar>::format(std::basic_string_view<T>(str), context);
+            out = std::copy_n(in.data(), *cut, out);
         else
-            return std::formatter<std::basic_string_view<FormatChar>, FormatChar>::format(_as(sys::string<FormatChar>(str), std::basic_string_view<FormatChar>), context);
+        {
+            constexpr size_t bufferSize = 256uz;
+
+            FormatChar buf[bufferSize];
+            for (std::span<const T> rest = in.first(cut); !rest.empty();)
+            {
+                const auto [read, written] = sys::internal::utf_transcode_fill(rest, std::span<FormatChar>(buf));
+                out = std::copy_n(buf /* NOLINT(hicpp-no-array-decay) */, *written, out);
+                rest = rest.subspan(read);
+            }
+        }
+        return this->pad(out, padding - before);
     }
 };
@@ -0,0 +1,210 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <Char.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <TextKernels.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Substring searcher, analyzing a needle once to search any number of haystacks for it.
+    /// @details
+    /// Candidate positions are found with a vector kernel comparing both the first and the last code unit of the needle at once, so the rest of it is only compared where both
+    /// match. Should that filter keep admitting false candidates, as it does on repetitive input, the search switches over to the Two-Way algorithm, skipping ahead
+    /// Boyer-Moore-Horspool style on the code unit under the end of the needle, which is sublinear on typical input and linear in the length of the haystack at worst.
+    ///
+    /// Implements `sys::INothrowCopyConstructible` and `sys::INothrowCopyAssignable`.
+    /// @attention Lifetime assumptions! `needle` must outlive `this`.
+    /// @see
+    /// For more information on the algorithms used, see
+    /// [Wojciech Muła, "SIMD-friendly algorithms for substring searching"](http://0x80.pl/notesen/2016-11-28-simd-strfind.html),
+    /// [Crochemore, Perrin, "Two-way string-matching"](https://doi.org/10.1145/116825.116845),
+    /// [Wikipedia](https://en.wikipedia.org/wiki/Two-way_string-matching_algorithm).
+    /// @code{.cpp}
+    /// const sys::string_searcher<char8_t> searcher(u8"ERROR");
+    /// for (const sys::str& line : lines)
+    ///     if (searcher.found_in(line))
+    ///         ...;
+    /// @endcode
+    template <ICharacter T>
+    class string_searcher final
+    {
+        // Verifying false candidates may cost this many code units, plus as many as were scanned, before the Two-Way search takes over.
+        static constexpr size_t filter_budget = 256uz;
+
+        std::basic_string_view<T> needle;
+        // How far to skip when a code unit with the given low byte is under the end of the needle, saturating. Code units sharing a low byte share the smallest skip.
+        std::array<uint8_t, 256> skip {};
+        // Critical factorization of the needle, `~0uz` standing in for -1.
+        size_t critical = 0;
+        size_t period = 0;
+        bool periodic = false;
+
+        static constexpr uint8_t bucket(const T c) noexcept { return _as(_as(c, std::make_unsigned_t<T>) & 0xFFu, uint8_t); }
+
+        // The maximal suffix of the needle under either ordering of code units, and its period.
+        constexpr std::pair<size_t, size_t> maximal_suffix(const bool reversed) const noexcept
+        {
+            const T* const n = this->needle.data();
+            const size_t size = this->needle.size();
+
+            size_t ip = ~0uz, jp = 0uz, k = 1uz, p = 1uz;
+            while (jp + k < size)
+            {
+                const T a = n[ip + k], b = n[jp + k];
+                if (a == b)
+                {
+                    if (k == p)
+                    {
+                        jp += p;
+                        k = 1uz;
+                    }
+                    else
+                        k++;
+                }
+                else if (reversed ? a < b : a > b)
+                {
+                    jp += k;
+                    k = 1uz;
+                    p = jp - ip;
+                }
+                else
+                {
+                    ip = jp++;
+                    k = p = 1uz;
+                }
+            }
+            return { ip, p };
+        }
+
+        constexpr size_t two_way(const std::basic_string_view<T> haystack, const size_t from) const noexcept
+        {
+            const T* const n = this->needle.data();
+            const size_t size = this->needle.size();
+            const size_t memorized = this->periodic ? size - this->period : 0uz;
+
+            // How much of the needle's prefix is known to match already, as found by shifting a periodic needle by its period.
+            size_t mem = 0uz;
+            for (size_t at = from; haystack.size() - at >= size;)
+            {
+                const T* const h = haystack.data() + at;
+
+                if (const size_t shift = this->skip[string_searcher::bucket(h[size - 1uz])]; shift != 0uz)
+                {
+                    at += std::max(shift, mem);
+                    mem = 0uz;
+                    continue;
+                }
+
+                // Compare the right half, then the left.
+                size_t k = std::max(this->critical + 1uz, mem);
+                while (k < size && n[k] == h[k])
+                    k++;
+                if (k < size)
+                {
+                    at += k - this->critical;
+                    mem = 0uz;
+                    continue;
+                }
+                k = this->critical + 1uz;
+                while (k > mem && n[k - 1uz] == h[k - 1uz])
+                    k--;
+                _retif(at, k <= mem);
+                at += this->period;
+                mem = memorized;
+            }
+            return haystack.size();
+        }
+    public:
+        constexpr explicit string_searcher(const std::basic_string_view<T> needle) noexcept : needle(needle)
+        {
+            const size_t size = needle.size();
+            _retif(, size < 2uz);
+
+            this->skip.fill(_as(std::min(size, 255uz), uint8_t));
+            for (size_t i = 0; i < size; i++)
+                this->skip[string_searcher::bucket(needle[i])] = _as(std::min(size - 1uz - i, 255uz), uint8_t);
+
+            const auto [ms, p] = this->maximal_suffix(false);
+            const auto [msReversed, pReversed] = this->maximal_suffix(true);
+            if (msReversed + 1uz > ms + 1uz)
+            {
+                this->critical = msReversed;
+                this->period = pReversed;
+            }
+            else
+            {
+                this->critical = ms;
+                this->period = p;
+            }
+
+            this->periodic = std::equal(needle.begin(), needle.begin() + _as(this->critical + 1uz, ptrdiff_t), needle.begin() + _as(this->period, ptrdiff_t));
+            if (!this->periodic)
+                this->period = std::max(this->critical, size - this->critical - 1uz) + 1uz;
+        }
+
+        /// @brief The needle searched for.
+        [[nodiscard]] constexpr std::basic_string_view<T> pattern() const noexcept { return this->needle; }
+
+        /// @brief Find the first occurrence of the needle in `haystack`, at or after `from`.
+        /// @return The index of the occurrence, or `haystack.size()` if there is none.
+        [[nodiscard]] constexpr sz find(const std::basic_string_view<T> haystack, const sz from = 0_uz) const noexcept
+        {
+            const size_t size = this->needle.size();
+            _retif(sz(haystack.size()), from > haystack.size() || haystack.size() - from < size);
+            _retif(from, size == 0uz);
+            if (size == 1uz)
+                return from + internal::find_unit(std::span<const T>(haystack.substr(from)), this->needle.front());
+
+            if consteval
+            {
+                return sz(this->two_way(haystack, from));
+            }
+            else
+            {
+                const internal::find_unit_pair_kernel<T> kernel = internal::find_unit_pair_kernel_current<T>();
+                const T* const h = haystack.data();
+                const size_t lastStart = haystack.size() - size;
+
+                size_t wasted = 0uz;
+                for (size_t at = from; at <= lastStart; at++)
+                {
+                    at += kernel(h + at, sz(lastStart - at + 1uz), this->needle.front(), this->needle.back(), sz(size - 1uz));
+                    if (at > lastStart)
+                        break;
+                    _retif(sz(at), std::equal(this->needle.begin() + 1, this->needle.end() - 1, h + at + 1));
+
+                    wasted += size;
+                    if (wasted > at - from + string_searcher::filter_budget)
+                        return sz(this->two_way(haystack, at + 1uz));
+                }
+                return sz(haystack.size());
+            }
+        }
+        /// @brief Whether the needle occurs in `haystack` at all.
+        [[nodiscard]] constexpr bool found_in(const std::basic_string_view<T> haystack) const noexcept
+        {
+            _retif(true, this->needle.empty());
+            return this->find(haystack) != haystack.size();
+        }
+    };
+
+    template <ICharacter T>
+    string_searcher(std::basic_string_view<T>) -> string_searcher<T>;
+} // namespace sys
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
@@ -0,0 +1,1335 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <span>
+
+#include <Char.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <Simd.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
+
+namespace sys::internal
+{
+    /// @ingroup sys_internal
+    /// @brief Bulk ASCII conversion kernel.
+    /// @details Converts whole blocks of ASCII code units from `in` to `out`, stopping at the first block containing a non-ASCII unit.
+    /// @return The number of code units converted, which is the same for `in` and `out`.
+    /// @pre `in[0..count) && out[0..count)`
+    template <ICharacter To, ICharacter From>
+    using ascii_transcode_kernel = sz (*)(const From* in, sz count, To* out) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::ascii_transcode_kernel`, structured for autovectorization.
+    template <ICharacter To, ICharacter From>
+    constexpr sz ascii_transcode_portable(const From* _restrict in, const sz count, To* _restrict out) noexcept
+    {
+        constexpr sz step = 16_uz;
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            u32::underlying_type acc = 0;
+            for (sz j = 0_uz; j < step; j++)
+                acc |= _as(in[i + j], u32::underlying_type);
+            if (acc >= 0x80u)
+                break;
+
+            for (sz j = 0_uz; j < step; j++)
+                out[i + j] = _as(in[i + j], To);
+        }
+        return i;
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief Whether all code units of width `Width` in `v` are ASCII.
+    template <size_t Width>
+    _inline_always bool sse2_is_ascii(const __m128i v) noexcept
+    {
+        if constexpr (Width == 1uz)
+            return _mm_movemask_epi8(v) == 0;
+        else
+        {
+            const __m128i highBits = Width == 2uz ? _mm_set1_epi16(_as(0xFF80, short)) : _mm_set1_epi32(_as(0xFFFFFF80, int));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, highBits), _mm_setzero_si128())) == 0xFFFF;
+        }
+    }
+    /// @ingroup sys_internal
+    /// @brief Store the ASCII code units of `v` to `out`, narrowing or widening as required.
+    template <ICharacter To, ICharacter From>
+    _inline_always void sse2_store_ascii(To* const out, const __m128i v) noexcept
+    {
+        __m128i* const vout = _as(_as(out, void*), __m128i*);
+        const __m128i zero = _mm_setzero_si128();
+        if constexpr (sizeof(To) == sizeof(From))
+            _mm_storeu_si128(vout, v);
+        else if constexpr (sizeof(From) == 1uz && sizeof(To) == 2uz)
+        {
+            _mm_storeu_si128(vout, _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(vout + 1, _mm_unpackhi_epi8(v, zero));
+        }
+        else if constexpr (sizeof(From) == 1uz && sizeof(To) == 4uz)
+        {
+            const __m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128(vout, _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(vout + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(vout + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(vout + 3, _mm_unpackhi_epi16(hi, zero));
+        }
+        else if constexpr (sizeof(From) == 2uz && sizeof(To) == 1uz)
+            _mm_storel_epi64(vout, _mm_packus_epi16(v, v));
+        else if constexpr (sizeof(From) == 2uz && sizeof(To) == 4uz)
+        {
+            _mm_storeu_si128(vout, _mm_unpacklo_epi16(v, zero));
+            _mm_storeu_si128(vout + 1, _mm_unpackhi_epi16(v, zero));
+        }
+        else if constexpr (sizeof(From) == 4uz && sizeof(To) == 1uz)
+        {
+            const __m128i packed = _mm_packs_epi32(v, v);
+            const int word = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+            std::memcpy(out, &word, sizeof(word));
+        }
+        else if constexpr (sizeof(From) == 4uz && sizeof(To) == 2uz)
+            _mm_storel_epi64(vout, _mm_packs_epi32(v, v));
+    }
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::ascii_transcode_kernel`, 16 bytes of input per step.
+    template <ICharacter To, ICharacter From>
+    inline sz ascii_transcode_sse2(const From* _restrict in, const sz count, To* _restrict out) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(From));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m128i v = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+            if (!internal::sse2_is_ascii<sizeof(From)>(v))
+                break;
+            internal::sse2_store_ascii<To, From>(out + i, v);
+        }
+        return i;
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::ascii_transcode_kernel`, 32 bytes of input per step.
+    template <ICharacter To, ICharacter From>
+    _target_avx2 inline sz ascii_transcode_avx2(const From* _restrict in, const sz count, To* _restrict out) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(From));
+
+        __m256i highBits;
+        if constexpr (sizeof(From) == 2uz)
+            highBits = _mm256_set1_epi16(_as(0xFF80, short));
+        else
+            highBits = _mm256_set1_epi32(_as(0xFFFFFF80, int));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+            if constexpr (sizeof(From) == 1uz)
+            {
+                if (_mm256_movemask_epi8(v) != 0)
+                    break;
+            }
+            else if (!_mm256_testz_si256(v, highBits))
+                break;
+
+            __m256i* const vout = _as(_as(out + i, void*), __m256i*);
+            const __m128i lo = _mm256_castsi256_si128(v), hi = _mm256_extracti128_si256(v, 1);
+            if constexpr (sizeof(To) == sizeof(From))
+                _mm256_storeu_si256(vout, v);
+            else if constexpr (sizeof(From) == 1uz && sizeof(To) == 2uz)
+            {
+                _mm256_storeu_si256(vout, _mm256_cvtepu8_epi16(lo));
+                _mm256_storeu_si256(vout + 1, _mm256_cvtepu8_epi16(hi));
+            }
+            else if constexpr (sizeof(From) == 1uz && sizeof(To) == 4uz)
+            {
+                _mm256_storeu_si256(vout, _mm256_cvtepu8_epi32(lo));
+                _mm256_storeu_si256(vout + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+                _mm256_storeu_si256(vout + 2, _mm256_cvtepu8_epi32(hi));
+                _mm256_storeu_si256(vout + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+            }
+            else if constexpr (sizeof(From) == 2uz && sizeof(To) == 1uz)
+            {
+                // `packus` works per 128-bit lane, so gather the low quadword of each lane.
+                const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0b11'01'10'00);
+                _mm_storeu_si128(_as(_as(vout, void*), __m128i*), _mm256_castsi256_si128(packed));
+            }
+            else if constexpr (sizeof(From) == 2uz && sizeof(To) == 4uz)
+            {
+                _mm256_storeu_si256(vout, _mm256_cvtepu16_epi32(lo));
+                _mm256_storeu_si256(vout + 1, _mm256_cvtepu16_epi32(hi));
+            }
+            else if constexpr (sizeof(From) == 4uz && sizeof(To) == 1uz)
+            {
+                const __m256i packed = _mm256_packs_epi32(v, v);
+                const __m256i gathered = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(packed, packed), _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0));
+                _mm_storel_epi64(_as(_as(vout, void*), __m128i*), _mm256_castsi256_si128(gathered));
+            }
+            else if constexpr (sizeof(From) == 4uz && sizeof(To) == 2uz)
+            {
+                const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v), 0b11'01'10'00);
+                _mm_storeu_si128(_as(_as(vout, void*), __m128i*), _mm256_castsi256_si128(packed));
+            }
+        }
+        return i;
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::ascii_transcode_kernel` supported by the executing processor.
+    template <ICharacter To, ICharacter From>
+    [[nodiscard]] inline ascii_transcode_kernel<To, From> ascii_transcode_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::ascii_transcode_avx2<To, From>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::ascii_transcode_sse2<To, From>;
+#else
+        return &internal::ascii_transcode_portable<To, From>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Bulk ASCII case conversion kernel.
+    /// @details Converts whole blocks of ASCII code units from `in` to `out`, mapping only `A-Z` (or `a-z`), stopping at the first block containing a non-ASCII unit.
+    /// @return The number of code units converted.
+    /// @pre `in[0..count) && out[0..count)`
+    template <ICharacter T>
+    using ascii_case_kernel = sz (*)(const T* in, sz count, T* out) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::ascii_case_kernel`, structured for autovectorization.
+    template <bool IsUpper, ICharacter T>
+    constexpr sz ascii_case_portable(const T* _restrict in, const sz count, T* _restrict out) noexcept
+    {
+        constexpr sz step = 16_uz;
+        constexpr u32::underlying_type first = IsUpper ? u32::underlying_type('a') : u32::underlying_type('A');
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            u32::underlying_type acc = 0;
+            for (sz j = 0_uz; j < step; j++)
+                acc |= _as(in[i + j], u32::underlying_type);
+            if (acc >= 0x80u)
+                break;
+
+            for (sz j = 0_uz; j < step; j++)
+            {
+                const u32::underlying_type c = _as(in[i + j], u32::underlying_type);
+                out[i + j] = _as(c - first < 26u ? c ^ 0x20u : c, T);
+            }
+        }
+        return i;
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief Flip the case of the code units of width `Width` in `v` within `A-Z` (or `a-z`).
+    /// @pre All code units of `v` are ASCII.
+    template <bool IsUpper, size_t Width>
+    _inline_always __m128i sse2_ascii_case(const __m128i v) noexcept
+    {
+        constexpr int first = IsUpper ? 'a' : 'A', last = IsUpper ? 'z' : 'Z';
+        // ASCII code units are non-negative in every width, so signed comparisons suffice.
+        if constexpr (Width == 1uz)
+        {
+            const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8(last + 1)));
+            return _mm_xor_si128(v, _mm_and_si128(inRange, _mm_set1_epi8(0x20)));
+        }
+        else if constexpr (Width == 2uz)
+        {
+            const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(first - 1)), _mm_cmplt_epi16(v, _mm_set1_epi16(last + 1)));
+            return _mm_xor_si128(v, _mm_and_si128(inRange, _mm_set1_epi16(0x20)));
+        }
+        else
+        {
+            const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(first - 1)), _mm_cmplt_epi32(v, _mm_set1_epi32(last + 1)));
+            return _mm_xor_si128(v, _mm_and_si128(inRange, _mm_set1_epi32(0x20)));
+        }
+    }
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::ascii_case_kernel`, 16 bytes per step.
+    template <bool IsUpper, ICharacter T>
+    inline sz ascii_case_sse2(const T* _restrict in, const sz count, T* _restrict out) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(T));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m128i v = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+            if (!internal::sse2_is_ascii<sizeof(T)>(v))
+                break;
+            _mm_storeu_si128(_as(_as(out + i, void*), __m128i*), internal::sse2_ascii_case<IsUpper, sizeof(T)>(v));
+        }
+        return i;
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::ascii_case_kernel`, 32 bytes per step.
+    template <bool IsUpper, ICharacter T>
+    _target_avx2 inline sz ascii_case_avx2(const T* _restrict in, const sz count, T* _restrict out) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(T));
+        constexpr int first = IsUpper ? 'a' : 'A', last = IsUpper ? 'z' : 'Z';
+
+        __m256i highBits, lower, upper, bit;
+        if constexpr (sizeof(T) == 1uz)
+        {
+            highBits = _mm256_set1_epi8(_as(0x80, char));
+            lower = _mm256_set1_epi8(first - 1);
+            upper = _mm256_set1_epi8(last + 1);
+            bit = _mm256_set1_epi8(0x20);
+        }
+        else if constexpr (sizeof(T) == 2uz)
+        {
+            highBits = _mm256_set1_epi16(_as(0xFF80, short));
+            lower = _mm256_set1_epi16(first - 1);
+            upper = _mm256_set1_epi16(last + 1);
+            bit = _mm256_set1_epi16(0x20);
+        }
+        else
+        {
+            highBits = _mm256_set1_epi32(_as(0xFFFFFF80, int));
+            lower = _mm256_set1_epi32(first - 1);
+            upper = _mm256_set1_epi32(last + 1);
+            bit = _mm256_set1_epi32(0x20);
+        }
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+            if (!_mm256_testz_si256(v, highBits))
+                break;
+
+            __m256i inRange;
+            if constexpr (sizeof(T) == 1uz)
+                inRange = _mm256_and_si256(_mm256_cmpgt_epi8(v, lower), _mm256_cmpgt_epi8(upper, v));
+            else if constexpr (sizeof(T) == 2uz)
+                inRange = _mm256_and_si256(_mm256_cmpgt_epi16(v, lower), _mm256_cmpgt_epi16(upper, v));
+            else
+                inRange = _mm256_and_si256(_mm256_cmpgt_epi32(v, lower), _mm256_cmpgt_epi32(upper, v));
+            _mm256_storeu_si256(_as(_as(out + i, void*), __m256i*), _mm256_xor_si256(v, _mm256_and_si256(inRange, bit)));
+        }
+        return i;
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::ascii_case_kernel` supported by the executing processor.
+    template <bool IsUpper, ICharacter T>
+    [[nodiscard]] inline ascii_case_kernel<T> ascii_case_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::ascii_case_avx2<IsUpper, T>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::ascii_case_sse2<IsUpper, T>;
+#else
+        return &internal::ascii_case_portable<IsUpper, T>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Bulk ASCII whitespace skipping kernel.
+    /// @return The number of code units of ASCII whitespace at the start of `in`, or at the end if `FromEnd`.
+    /// @pre `in[0..count)`
+    template <ICharacter T>
+    using ascii_space_kernel = sz (*)(const T* in, sz count) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Whether `unit` is one of `\t`, `\n`, `\v`, `\f`, `\r` or a space, the only whitespace in ASCII.
+    template <ICharacter T>
+    constexpr bool is_ascii_space(const T unit) noexcept
+    {
+        const u32::underlying_type c = _as(unit, u32::underlying_type);
+        return c == 0x20u || c - 0x09u < 5u;
+    }
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::ascii_space_kernel`.
+    template <bool FromEnd, ICharacter T>
+    constexpr sz ascii_space_portable(const T* const in, const sz count) noexcept
+    {
+        sz i = 0_uz;
+        while (i < count && internal::is_ascii_space(in[FromEnd ? count - i - 1_uz : i]))
+            i++;
+        return i;
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief Byte mask of the code units of width `Width` in `v` which are ASCII whitespace.
+    template <size_t Width>
+    _inline_always unsigned sse2_ascii_space_mask(const __m128i v) noexcept
+    {
+        // `\t-\r` is `[0, 4]` after subtracting `\t`, in every width and however the subtraction wraps, so signed comparisons suffice.
+        if constexpr (Width == 1uz)
+        {
+            const __m128i off = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+            const __m128i control = _mm_and_si128(_mm_cmpgt_epi8(off, _mm_set1_epi8(-1)), _mm_cmplt_epi8(off, _mm_set1_epi8(5)));
+            return _as(_mm_movemask_epi8(_mm_or_si128(control, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')))), unsigned);
+        }
+        else if constexpr (Width == 2uz)
+        {
+            const __m128i off = _mm_sub_epi16(v, _mm_set1_epi16('\t'));
+            const __m128i control = _mm_and_si128(_mm_cmpgt_epi16(off, _mm_set1_epi16(-1)), _mm_cmplt_epi16(off, _mm_set1_epi16(5)));
+            return _as(_mm_movemask_epi8(_mm_or_si128(control, _mm_cmpeq_epi16(v, _mm_set1_epi16(' ')))), unsigned);
+        }
+        else
+        {
+            const __m128i off = _mm_sub_epi32(v, _mm_set1_epi32('\t'));
+            const __m128i control = _mm_and_si128(_mm_cmpgt_epi32(off, _mm_set1_epi32(-1)), _mm_cmplt_epi32(off, _mm_set1_epi32(5)));
+            return _as(_mm_movemask_epi8(_mm_or_si128(control, _mm_cmpeq_epi32(v, _mm_set1_epi32(' ')))), unsigned);
+        }
+    }
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::ascii_space_kernel`, 16 bytes per step.
+    template <bool FromEnd, ICharacter T>
+    inline sz ascii_space_sse2(const T* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(T));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m128i v = _mm_loadu_si128(_as(_as(in + (FromEnd ? count - i - step : i), const void*), const __m128i*));
+            if (const unsigned other = ~internal::sse2_ascii_space_mask<sizeof(T)>(v) & 0xFFFFu; other != 0u)
+            {
+                if constexpr (FromEnd)
+                    return i + sz(_as(std::countl_zero(other << 16u), size_t) / sizeof(T));
+                else
+                    return i + sz(_as(std::countr_zero(other), size_t) / sizeof(T));
+            }
+        }
+        return i + internal::ascii_space_portable<FromEnd>(FromEnd ? in : in + i, count - i);
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::ascii_space_kernel`, 32 bytes per step.
+    template <bool FromEnd, ICharacter T>
+    _target_avx2 inline sz ascii_space_avx2(const T* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(T));
+
+        // As in `sys::internal::sse2_ascii_space_mask(...)`.
+        __m256i tab, below, above, space;
+        if constexpr (sizeof(T) == 1uz)
+        {
+            tab = _mm256_set1_epi8('\t');
+            below = _mm256_set1_epi8(-1);
+            above = _mm256_set1_epi8(5);
+            space = _mm256_set1_epi8(' ');
+        }
+        else if constexpr (sizeof(T) == 2uz)
+        {
+            tab = _mm256_set1_epi16('\t');
+            below = _mm256_set1_epi16(-1);
+            above = _mm256_set1_epi16(5);
+            space = _mm256_set1_epi16(' ');
+        }
+        else
+        {
+            tab = _mm256_set1_epi32('\t');
+            below = _mm256_set1_epi32(-1);
+            above = _mm256_set1_epi32(5);
+            space = _mm256_set1_epi32(' ');
+        }
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m256i v = _mm256_loadu_si256(_as(_as(in + (FromEnd ? count - i - step : i), const void*), const __m256i*));
+            __m256i spaces;
+            if constexpr (sizeof(T) == 1uz)
+            {
+                const __m256i off = _mm256_sub_epi8(v, tab);
+                spaces = _mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi8(off, below), _mm256_cmpgt_epi8(above, off)), _mm256_cmpeq_epi8(v, space));
+            }
+            else if constexpr (sizeof(T) == 2uz)
+            {
+                const __m256i off = _mm256_sub_epi16(v, tab);
+                spaces = _mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi16(off, below), _mm256_cmpgt_epi16(above, off)), _mm256_cmpeq_epi16(v, space));
+            }
+            else
+            {
+                const __m256i off = _mm256_sub_epi32(v, tab);
+                spaces = _mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi32(off, below), _mm256_cmpgt_epi32(above, off)), _mm256_cmpeq_epi32(v, space));
+            }
+
+            if (const unsigned other = ~_as(_mm256_movemask_epi8(spaces), unsigned); other != 0u)
+            {
+                if constexpr (FromEnd)
+                    return i + sz(_as(std::countl_zero(other), size_t) / sizeof(T));
+                else
+                    return i + sz(_as(std::countr_zero(other), size_t) / sizeof(T));
+            }
+        }
+        return i + internal::ascii_space_portable<FromEnd>(FromEnd ? in : in + i, count - i);
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::ascii_space_kernel` supported by the executing processor.
+    template <bool FromEnd, ICharacter T>
+    [[nodiscard]] inline ascii_space_kernel<T> ascii_space_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::ascii_space_avx2<FromEnd, T>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::ascii_space_sse2<FromEnd, T>;
+#else
+        return &internal::ascii_space_portable<FromEnd, T>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief The number of code units of ASCII whitespace at the start of `in`, or at the end if `FromEnd`.
+    template <bool FromEnd, ICharacter T>
+    constexpr sz ascii_space_run(const std::span<const T> in) noexcept
+    {
+        if consteval
+        {
+            return internal::ascii_space_portable<FromEnd>(in.data(), sz(in.size()));
+        }
+        else
+        {
+            return internal::ascii_space_kernel_current<FromEnd, T>()(in.data(), sz(in.size()));
+        }
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Code unit search kernel.
+    /// @return The offset of the first occurrence of `unit` in `in`, or `count` if there is none.
+    /// @pre `in[0..count)`
+    template <ICharacter T>
+    using find_unit_kernel = sz (*)(const T* in, sz count, T unit) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::find_unit_kernel`.
+    template <ICharacter T>
+    constexpr sz find_unit_portable(const T* in, const sz count, const T unit) noexcept
+    {
+        return sz(std::find(in, in + count, unit) - in);
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::find_unit_kernel`, 16 bytes per step.
+    template <ICharacter T>
+    inline sz find_unit_sse2(const T* in, const sz count, const T unit) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(T));
+
+        __m128i needle;
+        if constexpr (sizeof(T) == 1uz)
+            needle = _mm_set1_epi8(_as(unit, char));
+        else if constexpr (sizeof(T) == 2uz)
+            needle = _mm_set1_epi16(_as(unit, short));
+        else
+            needle = _mm_set1_epi32(_as(unit, int));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m128i v = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+            __m128i eq;
+            if constexpr (sizeof(T) == 1uz)
+                eq = _mm_cmpeq_epi8(v, needle);
+            else if constexpr (sizeof(T) == 2uz)
+                eq = _mm_cmpeq_epi16(v, needle);
+            else
+                eq = _mm_cmpeq_epi32(v, needle);
+
+            if (const int mask = _mm_movemask_epi8(eq); mask != 0)
+                return i + sz(_as(std::countr_zero(_as(mask, unsigned)), size_t) / sizeof(T));
+        }
+        return i + internal::find_unit_portable(in + i, count - i, unit);
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::find_unit_kernel`, 32 bytes per step.
+    template <ICharacter T>
+    _target_avx2 inline sz find_unit_avx2(const T* in, const sz count, const T unit) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(T));
+
+        __m256i needle;
+        if constexpr (sizeof(T) == 1uz)
+            needle = _mm256_set1_epi8(_as(unit, char));
+        else if constexpr (sizeof(T) == 2uz)
+            needle = _mm256_set1_epi16(_as(unit, short));
+        else
+            needle = _mm256_set1_epi32(_as(unit, int));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+            __m256i eq;
+            if constexpr (sizeof(T) == 1uz)
+                eq = _mm256_cmpeq_epi8(v, needle);
+            else if constexpr (sizeof(T) == 2uz)
+                eq = _mm256_cmpeq_epi16(v, needle);
+            else
+                eq = _mm256_cmpeq_epi32(v, needle);
+
+            if (const int mask = _mm256_movemask_epi8(eq); mask != 0)
+                return i + sz(_as(std::countr_zero(_as(mask, unsigned)), size_t) / sizeof(T));
+        }
+        return i + internal::find_unit_portable(in + i, count - i, unit);
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::find_unit_kernel` supported by the executing processor.
+    template <ICharacter T>
+    [[nodiscard]] inline find_unit_kernel<T> find_unit_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::find_unit_avx2<T>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::find_unit_sse2<T>;
+#else
+        return &internal::find_unit_portable<T>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Find the first occurrence of `unit` in `in`.
+    /// @details Defers to `std::memchr(...)` for byte-sized code units, which every C library vectorizes already, and to the fastest kernel otherwise.
+    /// @return The offset of the first occurrence of `unit` in `in`, or `in.size()` if there is none.
+    template <ICharacter T>
+    constexpr sz find_unit(const std::span<const T> in, const T unit) noexcept
+    {
+        if consteval
+        {
+            return internal::find_unit_portable(in.data(), sz(in.size()), unit);
+        }
+        else
+        {
+            if constexpr (sizeof(T) == 1uz)
+            {
+                const void* const at = std::memchr(in.data(), _as(unit, unsigned char), in.size());
+                return at ? sz(_as(at, const T*) - in.data()) : sz(in.size());
+            }
+            else
+                return internal::find_unit_kernel_current<T>()(in.data(), sz(in.size()), unit);
+        }
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Substring candidate search kernel.
+    /// @return The first offset `i` at which `in[i] == first && in[i + distance] == last`, or `count` if there is none.
+    /// @pre `in[0..count + distance)`
+    template <ICharacter T>
+    using find_unit_pair_kernel = sz (*)(const T* in, sz count, T first, T last, sz distance) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::find_unit_pair_kernel`.
+    template <ICharacter T>
+    constexpr sz find_unit_pair_portable(const T* in, const sz count, const T first, const T last, const sz distance) noexcept
+    {
+        for (sz i = 0_uz; i < count; i++)
+        {
+            if (in[i] == first && in[i + distance] == last)
+                return i;
+        }
+        return count;
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::find_unit_pair_kernel`, 16 candidates' bytes per step.
+    template <ICharacter T>
+    inline sz find_unit_pair_sse2(const T* in, const sz count, const T first, const T last, const sz distance) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(T));
+
+        __m128i vfirst, vlast;
+        if constexpr (sizeof(T) == 1uz)
+        {
+            vfirst = _mm_set1_epi8(_as(first, char));
+            vlast = _mm_set1_epi8(_as(last, char));
+        }
+        else if constexpr (sizeof(T) == 2uz)
+        {
+            vfirst = _mm_set1_epi16(_as(first, short));
+            vlast = _mm_set1_epi16(_as(last, short));
+        }
+        else
+        {
+            vfirst = _mm_set1_epi32(_as(first, int));
+            vlast = _mm_set1_epi32(_as(last, int));
+        }
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m128i a = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+            const __m128i b = _mm_loadu_si128(_as(_as(in + i + distance, const void*), const __m128i*));
+            __m128i eq;
+            if constexpr (sizeof(T) == 1uz)
+                eq = _mm_and_si128(_mm_cmpeq_epi8(a, vfirst), _mm_cmpeq_epi8(b, vlast));
+            else if constexpr (sizeof(T) == 2uz)
+                eq = _mm_and_si128(_mm_cmpeq_epi16(a, vfirst), _mm_cmpeq_epi16(b, vlast));
+            else
+                eq = _mm_and_si128(_mm_cmpeq_epi32(a, vfirst), _mm_cmpeq_epi32(b, vlast));
+
+            if (const int mask = _mm_movemask_epi8(eq); mask != 0)
+                return i + sz(_as(std::countr_zero(_as(mask, unsigned)), size_t) / sizeof(T));
+        }
+        return i + internal::find_unit_pair_portable(in + i, count - i, first, last, distance);
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::find_unit_pair_kernel`, 32 candidates' bytes per step.
+    template <ICharacter T>
+    _target_avx2 inline sz find_unit_pair_avx2(const T* in, const sz count, const T first, const T last, const sz distance) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(T));
+
+        __m256i vfirst, vlast;
+        if constexpr (sizeof(T) == 1uz)
+        {
+            vfirst = _mm256_set1_epi8(_as(first, char));
+            vlast = _mm256_set1_epi8(_as(last, char));
+        }
+        else if constexpr (sizeof(T) == 2uz)
+        {
+            vfirst = _mm256_set1_epi16(_as(first, short));
+            vlast = _mm256_set1_epi16(_as(last, short));
+        }
+        else
+        {
+            vfirst = _mm256_set1_epi32(_as(first, int));
+            vlast = _mm256_set1_epi32(_as(last, int));
+        }
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m256i a = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+            const __m256i b = _mm256_loadu_si256(_as(_as(in + i + distance, const void*), const __m256i*));
+            __m256i eq;
+            if constexpr (sizeof(T) == 1uz)
+                eq = _mm256_and_si256(_mm256_cmpeq_epi8(a, vfirst), _mm256_cmpeq_epi8(b, vlast));
+            else if constexpr (sizeof(T) == 2uz)
+                eq = _mm256_and_si256(_mm256_cmpeq_epi16(a, vfirst), _mm256_cmpeq_epi16(b, vlast));
+            else
+                eq = _mm256_and_si256(_mm256_cmpeq_epi32(a, vfirst), _mm256_cmpeq_epi32(b, vlast));
+
+            if (const int mask = _mm256_movemask_epi8(eq); mask != 0)
+                return i + sz(_as(std::countr_zero(_as(mask, unsigned)), size_t) / sizeof(T));
+        }
+        return i + internal::find_unit_pair_portable(in + i, count - i, first, last, distance);
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::find_unit_pair_kernel` supported by the executing processor.
+    template <ICharacter T>
+    [[nodiscard]] inline find_unit_pair_kernel<T> find_unit_pair_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::find_unit_pair_avx2<T>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::find_unit_pair_sse2<T>;
+#else
+        return &internal::find_unit_pair_portable<T>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief UTF validation kernel.
+    /// @details Skips whole blocks of code units which are certainly valid, stopping at the first block which may not be.
+    /// @return The length of a valid prefix of `in`, ending between two sequences.
+    /// @pre `in[0..count)`, starting a sequence.
+    template <ICharacter T>
+    using utf_validate_kernel = sz (*)(const T* in, sz count) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::utf_validate_kernel`, structured for autovectorization, skipping blocks of ASCII (UTF-8), of code units other than surrogates
+    /// (UTF-16), or of scalar values (UTF-32).
+    template <ICharacter T>
+    constexpr sz utf_validate_portable(const T* const in, const sz count) noexcept
+    {
+        constexpr sz step = 16_uz;
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            bool invalid = false;
+            for (sz j = 0_uz; j < step; j++)
+            {
+                const u32::underlying_type c = _as(in[i + j], u32::underlying_type);
+                if constexpr (sizeof(T) == 1uz)
+                    invalid |= (c & 0x80u) != 0u;
+                else if constexpr (sizeof(T) == 2uz)
+                    invalid |= (c & 0xF800u) == 0xD800u;
+                else
+                    invalid |= (c & 0xFFFFF800u) == 0xD800u || c > 0x10FFFFu;
+            }
+            if (invalid)
+                break;
+        }
+        return i;
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::utf_validate_kernel`, 16 bytes per step, skipping the same blocks as `sys::internal::utf_validate_portable(...)`.
+    template <ICharacter T>
+    inline sz utf_validate_sse2(const T* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(T));
+
+        sz i = 0_uz;
+        for (; i + step <= count; i += step)
+        {
+            const __m128i v = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+            __m128i invalid;
+            if constexpr (sizeof(T) == 1uz)
+                invalid = v;
+            else if constexpr (sizeof(T) == 2uz)
+                invalid = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(_as(0xF800, short))), _mm_set1_epi16(_as(0xD800, short)));
+            else
+            {
+                // Code units above `INT32_MAX` are negative, and invalid too.
+                invalid = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(_as(0xFFFFF800, int))), _mm_set1_epi32(0xD800)),
+                                       _mm_or_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(0x10FFFF)), _mm_cmplt_epi32(v, _mm_setzero_si128())));
+            }
+            if (_mm_movemask_epi8(invalid) != 0)
+                break;
+        }
+        return i;
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::utf_validate_kernel`, 32 bytes per step.
+    /// @details UTF-8 is validated in full, not just skipping ASCII, by classifying each pair of adjacent bytes by the nibbles of the first and the high nibble of the
+    /// second through lookup tables, as in Keiser and Lemire's "Validating UTF-8 In Less Than One Instruction Per Byte".
+    template <ICharacter T>
+    _target_avx2 inline sz utf_validate_avx2(const T* const in, const sz count) noexcept // NOLINT(readability-function-cognitive-complexity)
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(T));
+
+        sz i = 0_uz;
+        if constexpr (sizeof(T) == 1uz)
+        {
+            // Error classes, each bit set in a table entry for every class the nibble is consistent with. A pair of bytes is invalid when some class is in all three
+            // of its entries: too short (1), too long (2), overlong 3-byte (4), too large (8), surrogate (0x10), overlong 2-byte (0x20), too large or overlong 4-byte
+            // (0x40), or two continuations (0x80). A continuation which should be the third or fourth of a sequence shows up as two continuations, and is expected.
+            const __m256i byte1High = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, _as(0x80, char), _as(0x80, char),
+                                                                                 _as(0x80, char), _as(0x80, char), 0x21, 0x01, 0x15, 0x49));
+            const __m256i byte1Low = _mm256_broadcastsi128_si256(_mm_setr_epi8(_as(0xE7, char), _as(0xA3, char), _as(0x83, char), _as(0x83, char), _as(0x8B, char),
+                                                                                _as(0xCB, char), _as(0xCB, char), _as(0xCB, char), _as(0xCB, char), _as(0xCB, char),
+                                                                                _as(0xCB, char), _as(0xCB, char), _as(0xCB, char), _as(0xDB, char), _as(0xCB, char),
+                                                                                _as(0xCB, char)));
+            const __m256i byte2High = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, _as(0xE6, char), _as(0xAE, char),
+                                                                                 _as(0xBA, char), _as(0xBA, char), 0x01, 0x01, 0x01, 0x01));
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            // Bytes at the end of a block which start a sequence the next block must continue.
+            const __m256i incompleteMax = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                           -1, -1, _as(0xEF, char), _as(0xDF, char), _as(0xBF, char));
+
+            sz ret = 0_uz;
+            __m256i prev = _mm256_setzero_si256(), prevIncomplete = _mm256_setzero_si256();
+            for (; i + step <= count; i += step)
+            {
+                const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+                __m256i error = prevIncomplete;
+                if (_mm256_movemask_epi8(v) != 0)
+                {
+                    const __m256i prevCarry = _mm256_permute2x128_si256(prev, v, 0x21);
+                    const __m256i prev1 = _mm256_alignr_epi8(v, prevCarry, 15), prev2 = _mm256_alignr_epi8(v, prevCarry, 14),
+                                  prev3 = _mm256_alignr_epi8(v, prevCarry, 13);
+                    const __m256i special =
+                        _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(byte1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                                                          _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, nibble))),
+                                         _mm256_shuffle_epi8(byte2High, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble)));
+                    const __m256i mustContinue = _mm256_and_si256(
+                        _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)), _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80))),
+                        _mm256_set1_epi8(_as(0x80, char)));
+                    error = _mm256_xor_si256(mustContinue, special);
+                }
+                if (!_mm256_testz_si256(error, error))
+                    break;
+
+                prevIncomplete = _mm256_subs_epu8(v, incompleteMax);
+                prev = v;
+                if (_mm256_testz_si256(prevIncomplete, prevIncomplete))
+                    ret = i + step;
+                else
+                {
+                    // Valid up to the sequence cut short by the end of the block.
+                    const sz cut = _as(in[i + step - 1_uz], uint8_t) >= 0xC0u ? 1_uz : _as(in[i + step - 2_uz], uint8_t) >= 0xE0u ? 2_uz : 3_uz;
+                    ret = i + step - cut;
+                }
+            }
+            return ret;
+        }
+        else
+        {
+            for (; i + step <= count; i += step)
+            {
+                const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+                __m256i invalid;
+                if constexpr (sizeof(T) == 2uz)
+                    invalid = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(_as(0xF800, short))), _mm256_set1_epi16(_as(0xD800, short)));
+                else
+                {
+                    invalid = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_set1_epi32(_as(0xFFFFF800, int))), _mm256_set1_epi32(0xD800)),
+                                              _mm256_or_si256(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x10FFFF)), _mm256_cmpgt_epi32(_mm256_setzero_si256(), v)));
+                }
+                if (!_mm256_testz_si256(invalid, invalid))
+                    break;
+            }
+            return i;
+        }
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::utf_validate_kernel` supported by the executing processor.
+    template <ICharacter T>
+    [[nodiscard]] inline utf_validate_kernel<T> utf_validate_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::utf_validate_avx2<T>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::utf_validate_sse2<T>;
+#else
+        return &internal::utf_validate_portable<T>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Find the first invalid sequence in `in`, which `sys::ch::read_codepoint(...)` replaces with U+FFFD.
+    /// @return The offset of the first invalid sequence, or `in.size()` if `in` is valid.
+    template <ICharacter T>
+    constexpr sz utf_first_invalid(const std::span<const T> in) noexcept
+    {
+        constexpr sz scalarRun = 32_uz;
+
+        utf_validate_kernel<T> kernel = &internal::utf_validate_portable<T>;
+        if !consteval
+        {
+            kernel = internal::utf_validate_kernel_current<T>();
+        }
+
+        sz i = 0_uz;
+        while (i < in.size())
+        {
+            i += kernel(in.data() + i, sz(in.size()) - i);
+
+            // Check at least one block before handing back to the kernel, so text the kernel doesn't skip doesn't pay for a failed kernel entry per codepoint.
+            const sz runEnd = std::min(i + scalarRun, sz(in.size()));
+            while (i < runEnd)
+            {
+                const auto [c, size] = ch::read_codepoint(in.subspan(i), unsafe);
+                _retif(i, c == ch::replacement<char32_t>()[0] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */ &&
+                              !std::ranges::equal(in.subspan(i, size), ch::replacement<T>()));
+                i += size;
+            }
+        }
+        return sz(in.size());
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Codepoint counting kernel.
+    /// @return The number of code units in `in` which start a sequence, which is the number of codepoints they start if `in` is valid.
+    /// @pre `in[0..count)`
+    template <ICharacter T>
+    using utf_count_leads_kernel = sz (*)(const T* in, sz count) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::utf_count_leads_kernel`, structured for autovectorization.
+    template <ICharacter T>
+    constexpr sz utf_count_leads_portable(const T* const in, const sz count) noexcept
+    {
+        if constexpr (sizeof(T) == 4uz)
+            return count;
+        else
+        {
+            sz ret = 0_uz;
+            for (sz i = 0_uz; i < count; i++)
+            {
+                const u32::underlying_type c = _as(in[i], u32::underlying_type);
+                if constexpr (sizeof(T) == 1uz)
+                    ret += (c & 0xC0u) != 0x80u;
+                else
+                    ret += (c & 0xFC00u) != 0xDC00u;
+            }
+            return ret;
+        }
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::utf_count_leads_kernel`, 16 bytes per step.
+    template <ICharacter T>
+    inline sz utf_count_leads_sse2(const T* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(T));
+        if constexpr (sizeof(T) == 4uz)
+            return count;
+        else
+        {
+            sz ret = 0_uz, i = 0_uz;
+            for (; i + step <= count; i += step)
+            {
+                const __m128i v = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+                if constexpr (sizeof(T) == 1uz)
+                {
+                    // Continuation bytes are `[-128, -65]` as signed bytes.
+                    ret += sz(std::popcount(_as(_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(-65))), unsigned)));
+                }
+                else
+                {
+                    const __m128i trail = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(_as(0xFC00, short))), _mm_set1_epi16(_as(0xDC00, short)));
+                    ret += step - sz(_as(std::popcount(_as(_mm_movemask_epi8(trail), unsigned)), size_t) / sizeof(T));
+                }
+            }
+            return ret + internal::utf_count_leads_portable(in + i, count - i);
+        }
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::utf_count_leads_kernel`, 32 bytes per step.
+    template <ICharacter T>
+    _target_avx2 inline sz utf_count_leads_avx2(const T* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(T));
+        if constexpr (sizeof(T) == 4uz)
+            return count;
+        else
+        {
+            sz ret = 0_uz, i = 0_uz;
+            for (; i + step <= count; i += step)
+            {
+                const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+                if constexpr (sizeof(T) == 1uz)
+                    ret += sz(std::popcount(_as(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-65))), unsigned)));
+                else
+                {
+                    const __m256i trail = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(_as(0xFC00, short))), _mm256_set1_epi16(_as(0xDC00, short)));
+                    ret += step - sz(_as(std::popcount(_as(_mm256_movemask_epi8(trail), unsigned)), size_t) / sizeof(T));
+                }
+            }
+            return ret + internal::utf_count_leads_portable(in + i, count - i);
+        }
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::utf_count_leads_kernel` supported by the executing processor.
+    template <ICharacter T>
+    [[nodiscard]] inline utf_count_leads_kernel<T> utf_count_leads_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::utf_count_leads_avx2<T>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::utf_count_leads_sse2<T>;
+#else
+        return &internal::utf_count_leads_portable<T>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Transcoded length kernel.
+    /// @return The number of code units of `To` transcoding `in` produces, if `in` is valid.
+    /// @pre `in[0..count)`
+    template <ICharacter To, ICharacter From>
+    using utf_transcoded_length_kernel = sz (*)(const From* in, sz count) noexcept;
+
+    /// @ingroup sys_internal
+    /// @brief Portable `sys::internal::utf_transcoded_length_kernel`, structured for autovectorization.
+    /// @details Each code unit contributes independently: a lead byte the units of its codepoint that aren't accounted for by its continuations, and each half of a
+    /// surrogate pair half of its codepoint.
+    template <ICharacter To, ICharacter From>
+    constexpr sz utf_transcoded_length_portable(const From* const in, const sz count) noexcept
+    {
+        if constexpr (sizeof(To) == sizeof(From))
+            return count;
+        else
+        {
+            sz ret = 0_uz;
+            for (sz i = 0_uz; i < count; i++)
+            {
+                const u32::underlying_type c = _as(in[i], u32::underlying_type);
+                if constexpr (sizeof(From) == 1uz)
+                    ret += sz((c & 0xC0u) != 0x80u) + sz(sizeof(To) == 2uz && c >= 0xF0u);
+                else if constexpr (sizeof(From) == 2uz && sizeof(To) == 1uz)
+                    ret += 1_uz + sz(c >= 0x80u) + sz(c >= 0x800u) - sz((c & 0xF800u) == 0xD800u);
+                else if constexpr (sizeof(From) == 2uz)
+                    ret += sz((c & 0xFC00u) != 0xDC00u);
+                else if constexpr (sizeof(To) == 1uz)
+                    ret += 1_uz + sz(c >= 0x80u) + sz(c >= 0x800u) + sz(c >= 0x10000u);
+                else
+                    ret += 1_uz + sz(c >= 0x10000u);
+            }
+            return ret;
+        }
+    }
+
+#if _libcxxext_simd_sse2
+    /// @ingroup sys_internal
+    /// @brief The number of code units of width `Width` set in the comparison result `mask`.
+    template <size_t Width>
+    _inline_always sz sse2_mask_units(const __m128i mask) noexcept
+    {
+        return sz(_as(std::popcount(_as(_mm_movemask_epi8(mask), unsigned)), size_t) / Width);
+    }
+    /// @ingroup sys_internal
+    /// @brief SSE2 `sys::internal::utf_transcoded_length_kernel`, 16 bytes per step, counting as `sys::internal::utf_transcoded_length_portable(...)`.
+    template <ICharacter To, ICharacter From>
+    inline sz utf_transcoded_length_sse2(const From* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m128i) / sizeof(From));
+        if constexpr (sizeof(To) == sizeof(From))
+            return count;
+        else
+        {
+            sz ret = 0_uz, i = 0_uz;
+            for (; i + step <= count; i += step)
+            {
+                const __m128i v = _mm_loadu_si128(_as(_as(in + i, const void*), const __m128i*));
+                if constexpr (sizeof(From) == 1uz)
+                {
+                    // Continuation bytes are `[-128, -65]` as signed bytes, and 4-byte leads `[-16, -1]`.
+                    ret += internal::sse2_mask_units<1uz>(_mm_cmpgt_epi8(v, _mm_set1_epi8(-65)));
+                    if constexpr (sizeof(To) == 2uz)
+                        ret += internal::sse2_mask_units<1uz>(_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(-17)), _mm_cmplt_epi8(v, _mm_setzero_si128())));
+                }
+                else if constexpr (sizeof(From) == 2uz && sizeof(To) == 1uz)
+                {
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(_as(0xFF80, short))), zero);
+                    const __m128i twoByte = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(_as(0xF800, short))), zero);
+                    const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(_as(0xF800, short))), _mm_set1_epi16(_as(0xD800, short)));
+                    ret += step * 3_uz - internal::sse2_mask_units<2uz>(ascii) - internal::sse2_mask_units<2uz>(twoByte) - internal::sse2_mask_units<2uz>(surrogate);
+                }
+                else if constexpr (sizeof(From) == 2uz)
+                {
+                    const __m128i trail = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(_as(0xFC00, short))), _mm_set1_epi16(_as(0xDC00, short)));
+                    ret += step - internal::sse2_mask_units<2uz>(trail);
+                }
+                else
+                {
+                    // Valid code units are at most U+10FFFF, so signed comparisons suffice.
+                    ret += step + internal::sse2_mask_units<4uz>(_mm_cmpgt_epi32(v, _mm_set1_epi32(0xFFFF)));
+                    if constexpr (sizeof(To) == 1uz)
+                    {
+                        ret += internal::sse2_mask_units<4uz>(_mm_cmpgt_epi32(v, _mm_set1_epi32(0x7F)));
+                        ret += internal::sse2_mask_units<4uz>(_mm_cmpgt_epi32(v, _mm_set1_epi32(0x7FF)));
+                    }
+                }
+            }
+            return ret + internal::utf_transcoded_length_portable<To>(in + i, count - i);
+        }
+    }
+#endif
+
+#if _libcxxext_simd_avx2
+    /// @ingroup sys_internal
+    /// @brief The number of code units of width `Width` set in the comparison result `mask`.
+    template <size_t Width>
+    _target_avx2 inline sz avx2_mask_units(const __m256i mask) noexcept
+    {
+        return sz(_as(std::popcount(_as(_mm256_movemask_epi8(mask), unsigned)), size_t) / Width);
+    }
+    /// @ingroup sys_internal
+    /// @brief AVX2 `sys::internal::utf_transcoded_length_kernel`, 32 bytes per step.
+    template <ICharacter To, ICharacter From>
+    _target_avx2 inline sz utf_transcoded_length_avx2(const From* const in, const sz count) noexcept
+    {
+        constexpr sz step = sz(sizeof(__m256i) / sizeof(From));
+        if constexpr (sizeof(To) == sizeof(From))
+            return count;
+        else
+        {
+            sz ret = 0_uz, i = 0_uz;
+            for (; i + step <= count; i += step)
+            {
+                const __m256i v = _mm256_loadu_si256(_as(_as(in + i, const void*), const __m256i*));
+                if constexpr (sizeof(From) == 1uz)
+                {
+                    ret += internal::avx2_mask_units<1uz>(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-65)));
+                    if constexpr (sizeof(To) == 2uz)
+                        ret += internal::avx2_mask_units<1uz>(_mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-17)), _mm256_cmpgt_epi8(_mm256_setzero_si256(), v)));
+                }
+                else if constexpr (sizeof(From) == 2uz && sizeof(To) == 1uz)
+                {
+                    const __m256i zero = _mm256_setzero_si256();
+                    const __m256i ascii = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(_as(0xFF80, short))), zero);
+                    const __m256i twoByte = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(_as(0xF800, short))), zero);
+                    const __m256i surrogate = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(_as(0xF800, short))), _mm256_set1_epi16(_as(0xD800, short)));
+                    ret += step * 3_uz - internal::avx2_mask_units<2uz>(ascii) - internal::avx2_mask_units<2uz>(twoByte) - internal::avx2_mask_units<2uz>(surrogate);
+                }
+                else if constexpr (sizeof(From) == 2uz)
+                {
+                    const __m256i trail = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(_as(0xFC00, short))), _mm256_set1_epi16(_as(0xDC00, short)));
+                    ret += step - internal::avx2_mask_units<2uz>(trail);
+                }
+                else
+                {
+                    ret += step + internal::avx2_mask_units<4uz>(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0xFFFF)));
+                    if constexpr (sizeof(To) == 1uz)
+                    {
+                        ret += internal::avx2_mask_units<4uz>(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x7F)));
+                        ret += internal::avx2_mask_units<4uz>(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x7FF)));
+                    }
+                }
+            }
+            return ret + internal::utf_transcoded_length_portable<To>(in + i, count - i);
+        }
+    }
+#endif
+
+    /// @ingroup sys_internal
+    /// @brief Select the fastest `sys::internal::utf_transcoded_length_kernel` supported by the executing processor.
+    template <ICharacter To, ICharacter From>
+    [[nodiscard]] inline utf_transcoded_length_kernel<To, From> utf_transcoded_length_kernel_current() noexcept
+    {
+#if _libcxxext_simd_avx2
+        if (internal::cpu_features_current().avx2)
+            return &internal::utf_transcoded_length_avx2<To, From>;
+#endif
+#if _libcxxext_simd_sse2
+        return &internal::utf_transcoded_length_sse2<To, From>;
+#else
+        return &internal::utf_transcoded_length_portable<To, From>;
+#endif
+    }
+
+    /// @ingroup sys_internal
+    /// @brief The number of code units of `To` which `sys::internal::utf_transcode(...)` produces from `in`, replacing invalid sequences with U+FFFD.
+    /// @details The valid runs between invalid sequences, found by `sys::internal::utf_first_invalid(...)`, are measured in bulk.
+    template <ICharacter To, ICharacter From>
+    constexpr sz utf_transcoded_length(const std::span<const From> in) noexcept
+    {
+        utf_transcoded_length_kernel<To, From> kernel = &internal::utf_transcoded_length_portable<To, From>;
+        if !consteval
+        {
+            kernel = internal::utf_transcoded_length_kernel_current<To, From>();
+        }
+
+        sz ret = 0_uz, i = 0_uz;
+        while (i < in.size())
+        {
+            const sz valid = internal::utf_first_invalid(in.subspan(i));
+            ret += kernel(in.data() + i, valid);
+            i += valid;
+            if (i < in.size())
+            {
+                ret += sz(ch::replacement<To>().size());
+                i += ch::read_codepoint(in.subspan(i), unsafe).size_bytes;
+            }
+        }
+        return ret;
+    }
+
+    /// @ingroup sys_internal
+    /// @brief Progress of a bulk transcoding operation.
+    struct transcode_progress
+    {
+        sz read = 0_uz;
+        sz written = 0_uz;
+    };
+
+    /// @ingroup sys_internal
+    /// @brief Transcode as much of `in` as fits in `out`, replacing invalid sequences with U+FFFD.
+    /// @details Equivalent to decoding `in` with `sys::ch::read_codepoint(...)` and encoding each codepoint with `sys::ch::write_codepoint(...)`, with runs of ASCII
+    /// converted in bulk.
+    /// @return The number of code units consumed from `in` and produced in `out`. Stops early only when less than `sizeof(char32_t) / sizeof(To)` units remain in `out`.
+    template <ICharacter To, ICharacter From>
+    constexpr transcode_progress utf_transcode(const std::span<const From> in, const std::span<To> out) noexcept
+    {
+        constexpr sz maxUnitsPerCodepoint = sz(sizeof(char32_t) / sizeof(To));
+        constexpr sz scalarRun = 32_uz;
+
+        ascii_transcode_kernel<To, From> kernel = &internal::ascii_transcode_portable<To, From>;
+        if !consteval
+        {
+            kernel = internal::ascii_transcode_kernel_current<To, From>();
+        }
+
+        transcode_progress ret;
+        while (ret.read < in.size() && ret.written + maxUnitsPerCodepoint <= out.size())
+        {
+            const sz bulk = kernel(in.data() + ret.read, std::min(sz(in.size()) - ret.read, sz(out.size()) - ret.written), out.data() + ret.written);
+            ret.read += bulk;
+            ret.written += bulk;
+
+            // Decode at least one block before handing back to the kernel, so mostly non-ASCII input doesn't pay for a failed kernel entry per codepoint.
+            const sz runEnd = std::min(ret.read + scalarRun, sz(in.size()));
+            while (ret.read < runEnd && ret.written + maxUnitsPerCodepoint <= out.size())
+            {
+                const auto [c, size] = ch::read_codepoint(in.subspan(ret.read), unsafe);
+                ret.written += ch::write_codepoint(c, out.data() + ret.written, unsafe);
+                ret.read += size;
+            }
+        }
+        return ret;
+    }
+    /// @ingroup sys_internal
+    /// @brief As `sys::internal::utf_transcode(...)`, but also storing the codepoints which fit whole in the last units of `out`, so an `out` of exactly
+    /// `sys::internal::utf_transcoded_length<To>(in)` units is filled.
+    /// @return The number of code units consumed from `in` and produced in `out`. Stops early only when the next codepoint doesn't fit in what remains of `out`.
+    template <ICharacter To, ICharacter From>
+    constexpr transcode_progress utf_transcode_fill(const std::span<const From> in, const std::span<To> out) noexcept
+    {
+        transcode_progress ret = internal::utf_transcode(in, out);
+        while (ret.read < in.size())
+        {
+            To buf[sizeof(char32_t) / sizeof(To)] {};
+            const auto [c, size] = ch::read_codepoint(in.subspan(ret.read), unsafe);
+            const sz units = ch::write_codepoint(c, buf, unsafe);
+            _retif(ret, ret.written + units > out.size());
+            std::copy_n(buf /* NOLINT(hicpp-no-array-decay) */, units, out.data() + ret.written);
+            ret.read += size;
+            ret.written += units;
+        }
+        return ret;
+    }
+} // namespace sys::internal
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
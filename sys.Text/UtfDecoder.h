@@ -0,0 +1,191 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include <Char.h>
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <TextKernels.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Whether `seq` is the start of a sequence cut short, which more code units might complete.
+    /// @details Invalid sequences cut short are as good as complete, they're replaced the same whatever follows.
+    template <ICharacter T>
+    constexpr bool utf_is_truncated(const std::span<const T> seq) noexcept
+    {
+        if constexpr (sizeof(T) == sizeof(char8_t))
+        {
+            const auto lead = _as(_as(seq[0] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */, char8_t), uint32_t);
+            const sz length = lead >= 0xC2u && lead < 0xE0u ? 2_uz : lead >= 0xE0u && lead < 0xF0u ? 3_uz : lead >= 0xF0u && lead < 0xF5u ? 4_uz : 1_uz;
+            return sz(seq.size()) < length && std::all_of(seq.begin() + 1, seq.end(), [](const T unit) noexcept -> bool { return ch::is_continuation(unit); });
+        }
+        else if constexpr (sizeof(T) == sizeof(char16_t))
+            return seq.size() == 1uz && ch::is_high_surrogate(seq[0] /* NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) */);
+        else
+            return false;
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Number of code units at the end of `in` which are the start of a sequence cut short.
+    template <ICharacter T>
+    constexpr sz utf_truncated_tail_size(const std::span<const T> in) noexcept
+    {
+        constexpr sz maxUnits = sz(sizeof(char32_t) / sizeof(T));
+        for (sz back = 1_uz; back < maxUnits && back <= sz(in.size()); back++)
+        {
+            if (internal::utf_is_truncated(in.last(back)))
+                return back;
+        }
+        return 0_uz;
+    }
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_text
+    /// @brief Resumable decoder for UTF-8, UTF-16 or UTF-32 text arriving in chunks, such as from a socket or a file read a block at a time.
+    /// @details
+    /// A sequence split between chunks is held back, and finished with the start of the next. Decoding chunk by chunk produces exactly what decoding the whole text
+    /// at once would, invalid sequences replaced with U+FFFD as by `sys::string<T>::invalids_replaced()`, wherever the chunks are split. Output is to caller-provided
+    /// buffers of any encoding, and runs of ASCII are converted in bulk, using the widest vector instructions available at runtime.
+    /// @code{.cpp}
+    /// sys::utf_decoder<char8_t> decoder;
+    /// std::u32string text;
+    /// while (const std::span<const char8_t> chunk = read_some())
+    ///     decoder.decode(chunk, text);
+    /// decoder.finish(text);
+    /// @endcode
+    template <ICharacter T>
+    class utf_decoder final
+    {
+        static constexpr sz max_sequence = sz(sizeof(char32_t) / sizeof(T));
+
+        T pending[max_sequence] {};
+        sz pending_size = 0_uz;
+    public:
+        /// @brief Progress of a call to `sys::utf_decoder<T>::decode(...)`.
+        struct result
+        {
+            /// @brief Code units consumed from the input, including any held back for the next chunk.
+            sz read = 0_uz;
+            /// @brief Code units produced in the output.
+            sz written = 0_uz;
+        };
+
+        constexpr utf_decoder() noexcept = default;
+
+        /// @brief Whether the start of a sequence is held back, waiting for the next chunk.
+        [[nodiscard]] constexpr bool has_pending() const noexcept { return this->pending_size != 0_uz; }
+        /// @brief Discard any sequence held back, to start decoding a new stream.
+        constexpr void reset() noexcept { this->pending_size = 0_uz; }
+
+        /// @brief Decode the next chunk `in` to `out`.
+        /// @return The number of code units consumed from `in` and produced in `out`. Stops early only when less than `sizeof(char32_t) / sizeof(U)` units remain in
+        /// `out`, so decode the rest of `in` to another buffer then.
+        template <ICharacter U>
+        constexpr result decode(const std::span<const T> in, const std::span<U> out) noexcept
+        {
+            constexpr sz maxUnitsPerCodepoint = sz(sizeof(char32_t) / sizeof(U));
+
+            result ret;
+            // Finish the sequence held back from the last chunk, a code unit at a time if it turns out to be invalid.
+            while (this->pending_size != 0_uz)
+            {
+                _retif(ret, ret.written + maxUnitsPerCodepoint > out.size());
+
+                T seq[max_sequence] {};
+                std::copy_n(this->pending, this->pending_size, seq);
+                const sz taken = std::min(max_sequence - this->pending_size, sz(in.size()) - ret.read);
+                std::copy_n(in.data() + ret.read, taken, seq + this->pending_size);
+                const sz seqSize = this->pending_size + taken;
+                if (internal::utf_is_truncated(std::span<const T>(seq, seqSize)))
+                {
+                    // Still cut short, by the end of `in` this time.
+                    std::copy_n(seq, seqSize, this->pending);
+                    this->pending_size = seqSize;
+                    ret.read += taken;
+                    return ret;
+                }
+
+                const auto [c, size] = ch::read_codepoint(std::span<const T>(seq, seqSize), unsafe);
+                ret.written += ch::write_codepoint(c, out.data() + ret.written, unsafe);
+                if (size >= this->pending_size)
+                {
+                    ret.read += size - this->pending_size;
+                    this->pending_size = 0_uz;
+                }
+                else
+                {
+                    std::copy(this->pending + size, this->pending + this->pending_size, this->pending);
+                    this->pending_size -= size;
+                }
+            }
+
+            const sz bodyEnd = sz(in.size()) - internal::utf_truncated_tail_size(in.subspan(ret.read));
+            const internal::transcode_progress progress = internal::utf_transcode(in.subspan(ret.read, bodyEnd - ret.read), out.subspan(ret.written));
+            ret.read += progress.read;
+            ret.written += progress.written;
+            _retif(ret, ret.read != bodyEnd);
+
+            std::copy(in.data() + bodyEnd, in.data() + in.size(), this->pending);
+            this->pending_size = sz(in.size()) - bodyEnd;
+            ret.read = sz(in.size());
+            return ret;
+        }
+        /// @brief Decode the next chunk `in`, appending to `out`.
+        template <ICharacter U>
+        constexpr void decode(std::span<const T> in, std::basic_string<U>& out)
+        {
+            while (!in.empty())
+            {
+                // Sufficient in one pass whenever `U` is at least as wide as `T`, otherwise grows geometrically.
+                const sz size = sz(out.size());
+                const sz capacity = size + std::max(sz(in.size()), size) + sz(sizeof(char32_t) / sizeof(U));
+                out.resize_and_overwrite(capacity, [&](U* const buf, const size_t bufSize) noexcept
+                {
+                    const result progress = this->decode(in, std::span<U>(buf + size, bufSize - size));
+                    in = in.subspan(progress.read);
+                    return *(size + progress.written);
+                });
+            }
+        }
+
+        /// @brief End the stream, replacing any sequence held back, which can never be finished now, with U+FFFD.
+        /// @return The number of code units produced in `out`. Stops early only when less than `sizeof(char32_t) / sizeof(U)` units remain in `out`, while
+        /// `has_pending()`.
+        template <ICharacter U>
+        constexpr sz finish(const std::span<U> out) noexcept
+        {
+            constexpr sz maxUnitsPerCodepoint = sz(sizeof(char32_t) / sizeof(U));
+
+            sz written = 0_uz;
+            while (this->pending_size != 0_uz && written + maxUnitsPerCodepoint <= out.size())
+            {
+                const auto [c, size] = ch::read_codepoint(std::span<const T>(this->pending, this->pending_size), unsafe);
+                written += ch::write_codepoint(c, out.data() + written, unsafe);
+                std::copy(this->pending + size, this->pending + this->pending_size, this->pending);
+                this->pending_size -= size;
+            }
+            return written;
+        }
+        /// @brief End the stream, appending U+FFFD to `out` in place of any sequence held back.
+        template <ICharacter U>
+        constexpr void finish(std::basic_string<U>& out)
+        {
+            U buf[max_sequence * (sizeof(char32_t) / sizeof(U))] {};
+            out.append(buf /* NOLINT(hicpp-no-array-decay) */, this->finish(std::span<U>(buf)));
+        }
+    };
+} // namespace sys
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-magic-numbers)
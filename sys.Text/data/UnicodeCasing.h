@@ -4,6 +4,8 @@
 /// @brief Generated by `workflows/scripts/generate_unicode_casing.py`.
 /// @note If this file is out of date, please regenerate it!
 
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 
 #include <Integer.h>
@@ -35,12041 +37,840 @@ namespace sys::internal
 {
     /// @internal
     /// @ingroup sys_internal
-    constexpr bool dchar_is_cased(const char32_t c) noexcept
+    /// @brief Casing properties shared by a set of codepoints.
+    struct casing_record
     {
-        switch (c)
-        {
-        case U'\u0041': return true;
-        case U'\u0042': return true;
-        case U'\u0043': return true;
-        case U'\u0044': return true;
-        case U'\u0045': return true;
-        case U'\u0046': return true;
-        case U'\u0047': return true;
-        case U'\u0048': return true;
-        case U'\u0049': return true;
-        case U'\u004A': return true;
-        case U'\u004B': return true;
-        case U'\u004C': return true;
-        case U'\u004D': return true;
-        case U'\u004E': return true;
-        case U'\u004F': return true;
-        case U'\u0050': return true;
-        case U'\u0051': return true;
-        case U'\u0052': return true;
-        case U'\u0053': return true;
-        case U'\u0054': return true;
-        case U'\u0055': return true;
-        case U'\u0056': return true;
-        case U'\u0057': return true;
-        case U'\u0058': return true;
-        case U'\u0059': return true;
-        case U'\u005A': return true;
-        case U'\u0061': return true;
-        case U'\u0062': return true;
-        case U'\u0063': return true;
-        case U'\u0064': return true;
-        case U'\u0065': return true;
-        case U'\u0066': return true;
-        case U'\u0067': return true;
-        case U'\u0068': return true;
-        case U'\u0069': return true;
-        case U'\u006A': return true;
-        case U'\u006B': return true;
-        case U'\u006C': return true;
-        case U'\u006D': return true;
-        case U'\u006E': return true;
-        case U'\u006F': return true;
-        case U'\u0070': return true;
-        case U'\u0071': return true;
-        case U'\u0072': return true;
-        case U'\u0073': return true;
-        case U'\u0074': return true;
-        case U'\u0075': return true;
-        case U'\u0076': return true;
-        case U'\u0077': return true;
-        case U'\u0078': return true;
-        case U'\u0079': return true;
-        case U'\u007A': return true;
-        case U'\u00AA': return true;
-        case U'\u00B5': return true;
-        case U'\u00BA': return true;
-        case U'\u00C0': return true;
-        case U'\u00C1': return true;
-        case U'\u00C2': return true;
-        case U'\u00C3': return true;
-        case U'\u00C4': return true;
-        case U'\u00C5': return true;
-        case U'\u00C6': return true;
-        case U'\u00C7': return true;
-        case U'\u00C8': return true;
-        case U'\u00C9': return true;
-        case U'\u00CA': return true;
-        case U'\u00CB': return true;
-        case U'\u00CC': return true;
-        case U'\u00CD': return true;
-        case U'\u00CE': return true;
-        case U'\u00CF': return true;
-        case U'\u00D0': return true;
-        case U'\u00D1': return true;
-        case U'\u00D2': return true;
-        case U'\u00D3': return true;
-        case U'\u00D4': return true;
-        case U'\u00D5': return true;
-        case U'\u00D6': return true;
-        case U'\u00D8': return true;
-        case U'\u00D9': return true;
-        case U'\u00DA': return true;
-        case U'\u00DB': return true;
-        case U'\u00DC': return true;
-        case U'\u00DD': return true;
-        case U'\u00DE': return true;
-        case U'\u00DF': return true;
-        case U'\u00E0': return true;
-        case U'\u00E1': return true;
-        case U'\u00E2': return true;
-        case U'\u00E3': return true;
-        case U'\u00E4': return true;
-        case U'\u00E5': return true;
-        case U'\u00E6': return true;
-        case U'\u00E7': return true;
-        case U'\u00E8': return true;
-        case U'\u00E9': return true;
-        case U'\u00EA': return true;
-        case U'\u00EB': return true;
-        case U'\u00EC': return true;
-        case U'\u00ED': return true;
-        case U'\u00EE': return true;
-        case U'\u00EF': return true;
-        case U'\u00F0': return true;
-        case U'\u00F1': return true;
-        case U'\u00F2': return true;
-        case U'\u00F3': return true;
-        case U'\u00F4': return true;
-        case U'\u00F5': return true;
-        case U'\u00F6': return true;
-        case U'\u00F8': return true;
-        case U'\u00F9': return true;
-        case U'\u00FA': return true;
-        case U'\u00FB': return true;
-        case U'\u00FC': return true;
-        case U'\u00FD': return true;
-        case U'\u00FE': return true;
-        case U'\u00FF': return true;
-        case U'\u0100': return true;
-        case U'\u0101': return true;
-        case U'\u0102': return true;
-        case U'\u0103': return true;
-        case U'\u0104': return true;
-        case U'\u0105': return true;
-        case U'\u0106': return true;
-        case U'\u0107': return true;
-        case U'\u0108': return true;
-        case U'\u0109': return true;
-        case U'\u010A': return true;
-        case U'\u010B': return true;
-        case U'\u010C': return true;
-        case U'\u010D': return true;
-        case U'\u010E': return true;
-        case U'\u010F': return true;
-        case U'\u0110': return true;
-        case U'\u0111': return true;
-        case U'\u0112': return true;
-        case U'\u0113': return true;
-        case U'\u0114': return true;
-        case U'\u0115': return true;
-        case U'\u0116': return true;
-        case U'\u0117': return true;
-        case U'\u0118': return true;
-        case U'\u0119': return true;
-        case U'\u011A': return true;
-        case U'\u011B': return true;
-        case U'\u011C': return true;
-        case U'\u011D': return true;
-        case U'\u011E': return true;
-        case U'\u011F': return true;
-        case U'\u0120': return true;
-        case U'\u0121': return true;
-        case U'\u0122': return true;
-        case U'\u0123': return true;
-        case U'\u0124': return true;
-        case U'\u0125': return true;
-        case U'\u0126': return true;
-        case U'\u0127': return true;
-        case U'\u0128': return true;
-        case U'\u0129': return true;
-        case U'\u012A': return true;
-        case U'\u012B': return true;
-        case U'\u012C': return true;
-        case U'\u012D': return true;
-        case U'\u012E': return true;
-        case U'\u012F': return true;
-        case U'\u0130': return true;
-        case U'\u0131': return true;
-        case U'\u0132': return true;
-        case U'\u0133': return true;
-        case U'\u0134': return true;
-        case U'\u0135': return true;
-        case U'\u0136': return true;
-        case U'\u0137': return true;
-        case U'\u0138': return true;
-        case U'\u0139': return true;
-        case U'\u013A': return true;
-        case U'\u013B': return true;
-        case U'\u013C': return true;
-        case U'\u013D': return true;
-        case U'\u013E': return true;
-        case U'\u013F': return true;
-        case U'\u0140': return true;
-        case U'\u0141': return true;
-        case U'\u0142': return true;
-        case U'\u0143': return true;
-        case U'\u0144': return true;
-        case U'\u0145': return true;
-        case U'\u0146': return true;
-        case U'\u0147': return true;
-        case U'\u0148': return true;
-        case U'\u0149': return true;
-        case U'\u014A': return true;
-        case U'\u014B': return true;
-        case U'\u014C': return true;
-        case U'\u014D': return true;
-        case U'\u014E': return true;
-        case U'\u014F': return true;
-        case U'\u0150': return true;
-        case U'\u0151': return true;
-        case U'\u0152': return true;
-        case U'\u0153': return true;
-        case U'\u0154': return true;
-        case U'\u0155': return true;
-        case U'\u0156': return true;
-        case U'\u0157': return true;
-        case U'\u0158': return true;
-        case U'\u0159': return true;
-        case U'\u015A': return true;
-        case U'\u015B': return true;
-        case U'\u015C': return true;
-        case U'\u015D': return true;
-        case U'\u015E': return true;
-        case U'\u015F': return true;
-        case U'\u0160': return true;
-        case U'\u0161': return true;
-        case U'\u0162': return true;
-        case U'\u0163': return true;
-        case U'\u0164': return true;
-        case U'\u0165': return true;
-        case U'\u0166': return true;
-        case U'\u0167': return true;
-        case U'\u0168': return true;
-        case U'\u0169': return true;
-        case U'\u016A': return true;
-        case U'\u016B': return true;
-        case U'\u016C': return true;
-        case U'\u016D': return true;
-        case U'\u016E': return true;
-        case U'\u016F': return true;
-        case U'\u0170': return true;
-        case U'\u0171': return true;
-        case U'\u0172': return true;
-        case U'\u0173': return true;
-        case U'\u0174': return true;
-        case U'\u0175': return true;
-        case U'\u0176': return true;
-        case U'\u0177': return true;
-        case U'\u0178': return true;
-        case U'\u0179': return true;
-        case U'\u017A': return true;
-        case U'\u017B': return true;
-        case U'\u017C': return true;
-        case U'\u017D': return true;
-        case U'\u017E': return true;
-        case U'\u017F': return true;
-        case U'\u0180': return true;
-        case U'\u0181': return true;
-        case U'\u0182': return true;
-        case U'\u0183': return true;
-        case U'\u0184': return true;
-        case U'\u0185': return true;
-        case U'\u0186': return true;
-        case U'\u0187': return true;
-        case U'\u0188': return true;
-        case U'\u0189': return true;
-        case U'\u018A': return true;
-        case U'\u018B': return true;
-        case U'\u018C': return true;
-        case U'\u018D': return true;
-        case U'\u018E': return true;
-        case U'\u018F': return true;
-        case U'\u0190': return true;
-        case U'\u0191': return true;
-        case U'\u0192': return true;
-        case U'\u0193': return true;
-        case U'\u0194': return true;
-        case U'\u0195': return true;
-        case U'\u0196': return true;
-        case U'\u0197': return true;
-        case U'\u0198': return true;
-        case U'\u0199': return true;
-        case U'\u019A': return true;
-        case U'\u019B': return true;
-        case U'\u019C': return true;
-        case U'\u019D': return true;
-        case U'\u019E': return true;
-        case U'\u019F': return true;
-        case U'\u01A0': return true;
-        case U'\u01A1': return true;
-        case U'\u01A2': return true;
-        case U'\u01A3': return true;
-        case U'\u01A4': return true;
-        case U'\u01A5': return true;
-        case U'\u01A6': return true;
-        case U'\u01A7': return true;
-        case U'\u01A8': return true;
-        case U'\u01A9': return true;
-        case U'\u01AA': return true;
-        case U'\u01AB': return true;
-        case U'\u01AC': return true;
-        case U'\u01AD': return true;
-        case U'\u01AE': return true;
-        case U'\u01AF': return true;
-        case U'\u01B0': return true;
-        case U'\u01B1': return true;
-        case U'\u01B2': return true;
-        case U'\u01B3': return true;
-        case U'\u01B4': return true;
-        case U'\u01B5': return true;
-        case U'\u01B6': return true;
-        case U'\u01B7': return true;
-        case U'\u01B8': return true;
-        case U'\u01B9': return true;
-        case U'\u01BA': return true;
-        case U'\u01BC': return true;
-        case U'\u01BD': return true;
-        case U'\u01BE': return true;
-        case U'\u01BF': return true;
-        case U'\u01C4': return true;
-        case U'\u01C5': return true;
-        case U'\u01C6': return true;
-        case U'\u01C7': return true;
-        case U'\u01C8': return true;
-        case U'\u01C9': return true;
-        case U'\u01CA': return true;
-        case U'\u01CB': return true;
-        case U'\u01CC': return true;
-        case U'\u01CD': return true;
-        case U'\u01CE': return true;
-        case U'\u01CF': return true;
-        case U'\u01D0': return true;
-        case U'\u01D1': return true;
-        case U'\u01D2': return true;
-        case U'\u01D3': return true;
-        case U'\u01D4': return true;
-        case U'\u01D5': return true;
-        case U'\u01D6': return true;
-        case U'\u01D7': return true;
-        case U'\u01D8': return true;
-        case U'\u01D9': return true;
-        case U'\u01DA': return true;
-        case U'\u01DB': return true;
-        case U'\u01DC': return true;
-        case U'\u01DD': return true;
-        case U'\u01DE': return true;
-        case U'\u01DF': return true;
-        case U'\u01E0': return true;
-        case U'\u01E1': return true;
-        case U'\u01E2': return true;
-        case U'\u01E3': return true;
-        case U'\u01E4': return true;
-        case U'\u01E5': return true;
-        case U'\u01E6': return true;
-        case U'\u01E7': return true;
-        case U'\u01E8': return true;
-        case U'\u01E9': return true;
-        case U'\u01EA': return true;
-        case U'\u01EB': return true;
-        case U'\u01EC': return true;
-        case U'\u01ED': return true;
-        case U'\u01EE': return true;
-        case U'\u01EF': return true;
-        case U'\u01F0': return true;
-        case U'\u01F1': return true;
-        case U'\u01F2': return true;
-        case U'\u01F3': return true;
-        case U'\u01F4': return true;
-        case U'\u01F5': return true;
-        case U'\u01F6': return true;
-        case U'\u01F7': return true;
-        case U'\u01F8': return true;
-        case U'\u01F9': return true;
-        case U'\u01FA': return true;
-        case U'\u01FB': return true;
-        case U'\u01FC': return true;
-        case U'\u01FD': return true;
-        case U'\u01FE': return true;
-        case U'\u01FF': return true;
-        case U'\u0200': return true;
-        case U'\u0201': return true;
-        case U'\u0202': return true;
-        case U'\u0203': return true;
-        case U'\u0204': return true;
-        case U'\u0205': return true;
-        case U'\u0206': return true;
-        case U'\u0207': return true;
-        case U'\u0208': return true;
-        case U'\u0209': return true;
-        case U'\u020A': return true;
-        case U'\u020B': return true;
-        case U'\u020C': return true;
-        case U'\u020D': return true;
-        case U'\u020E': return true;
-        case U'\u020F': return true;
-        case U'\u0210': return true;
-        case U'\u0211': return true;
-        case U'\u0212': return true;
-        case U'\u0213': return true;
-        case U'\u0214': return true;
-        case U'\u0215': return true;
-        case U'\u0216': return true;
-        case U'\u0217': return true;
-        case U'\u0218': return true;
-        case U'\u0219': return true;
-        case U'\u021A': return true;
-        case U'\u021B': return true;
-        case U'\u021C': return true;
-        case U'\u021D': return true;
-        case U'\u021E': return true;
-        case U'\u021F': return true;
-        case U'\u0220': return true;
-        case U'\u0221': return true;
-        case U'\u0222': return true;
-        case U'\u0223': return true;
-        case U'\u0224': return true;
-        case U'\u0225': return true;
-        case U'\u0226': return true;
-        case U'\u0227': return true;
-        case U'\u0228': return true;
-        case U'\u0229': return true;
-        case U'\u022A': return true;
-        case U'\u022B': return true;
-        case U'\u022C': return true;
-        case U'\u022D': return true;
-        case U'\u022E': return true;
-        case U'\u022F': return true;
-        case U'\u0230': return true;
-        case U'\u0231': return true;
-        case U'\u0232': return true;
-        case U'\u0233': return true;
-        case U'\u0234': return true;
-        case U'\u0235': return true;
-        case U'\u0236': return true;
-        case U'\u0237': return true;
-        case U'\u0238': return true;
-        case U'\u0239': return true;
-        case U'\u023A': return true;
-        case U'\u023B': return true;
-        case U'\u023C': return true;
-        case U'\u023D': return true;
-        case U'\u023E': return true;
-        case U'\u023F': return true;
-        case U'\u0240': return true;
-        case U'\u0241': return true;
-        case U'\u0242': return true;
-        case U'\u0243': return true;
-        case U'\u0244': return true;
-        case U'\u0245': return true;
-        case U'\u0246': return true;
-        case U'\u0247': return true;
-        case U'\u0248': return true;
-        case U'\u0249': return true;
-        case U'\u024A': return true;
-        case U'\u024B': return true;
-        case U'\u024C': return true;
-        case U'\u024D': return true;
-        case U'\u024E': return true;
-        case U'\u024F': return true;
-        case U'\u0250': return true;
-        case U'\u0251': return true;
-        case U'\u0252': return true;
-        case U'\u0253': return true;
-        case U'\u0254': return true;
-        case U'\u0255': return true;
-        case U'\u0256': return true;
-        case U'\u0257': return true;
-        case U'\u0258': return true;
-        case U'\u0259': return true;
-        case U'\u025A': return true;
-        case U'\u025B': return true;
-        case U'\u025C': return true;
-        case U'\u025D': return true;
-        case U'\u025E': return true;
-        case U'\u025F': return true;
-        case U'\u0260': return true;
-        case U'\u0261': return true;
-        case U'\u0262': return true;
-        case U'\u0263': return true;
-        case U'\u0264': return true;
-        case U'\u0265': return true;
-        case U'\u0266': return true;
-        case U'\u0267': return true;
-        case U'\u0268': return true;
-        case U'\u0269': return true;
-        case U'\u026A': return true;
-        case U'\u026B': return true;
-        case U'\u026C': return true;
-        case U'\u026D': return true;
-        case U'\u026E': return true;
-        case U'\u026F': return true;
-        case U'\u0270': return true;
-        case U'\u0271': return true;
-        case U'\u0272': return true;
-        case U'\u0273': return true;
-        case U'\u0274': return true;
-        case U'\u0275': return true;
-        case U'\u0276': return true;
-        case U'\u0277': return true;
-        case U'\u0278': return true;
-        case U'\u0279': return true;
-        case U'\u027A': return true;
-        case U'\u027B': return true;
-        case U'\u027C': return true;
-        case U'\u027D': return true;
-        case U'\u027E': return true;
-        case U'\u027F': return true;
-        case U'\u0280': return true;
-        case U'\u0281': return true;
-        case U'\u0282': return true;
-        case U'\u0283': return true;
-        case U'\u0284': return true;
-        case U'\u0285': return true;
-        case U'\u0286': return true;
-        case U'\u0287': return true;
-        case U'\u0288': return true;
-        case U'\u0289': return true;
-        case U'\u028A': return true;
-        case U'\u028B': return true;
-        case U'\u028C': return true;
-        case U'\u028D': return true;
-        case U'\u028E': return true;
-        case U'\u028F': return true;
-        case U'\u0290': return true;
-        case U'\u0291': return true;
-        case U'\u0292': return true;
-        case U'\u0293': return true;
-        case U'\u0296': return true;
-        case U'\u0297': return true;
-        case U'\u0298': return true;
-        case U'\u0299': return true;
-        case U'\u029A': return true;
-        case U'\u029B': return true;
-        case U'\u029C': return true;
-        case U'\u029D': return true;
-        case U'\u029E': return true;
-        case U'\u029F': return true;
-        case U'\u02A0': return true;
-        case U'\u02A1': return true;
-        case U'\u02A2': return true;
-        case U'\u02A3': return true;
-        case U'\u02A4': return true;
-        case U'\u02A5': return true;
-        case U'\u02A6': return true;
-        case U'\u02A7': return true;
-        case U'\u02A8': return true;
-        case U'\u02A9': return true;
-        case U'\u02AA': return true;
-        case U'\u02AB': return true;
-        case U'\u02AC': return true;
-        case U'\u02AD': return true;
-        case U'\u02AE': return true;
-        case U'\u02AF': return true;
-        case U'\u02B0': return true;
-        case U'\u02B1': return true;
-        case U'\u02B2': return true;
-        case U'\u02B3': return true;
-        case U'\u02B4': return true;
-        case U'\u02B5': return true;
-        case U'\u02B6': return true;
-        case U'\u02B7': return true;
-        case U'\u02B8': return true;
-        case U'\u02C0': return true;
-        case U'\u02C1': return true;
-        case U'\u02E0': return true;
-        case U'\u02E1': return true;
-        case U'\u02E2': return true;
-        case U'\u02E3': return true;
-        case U'\u02E4': return true;
-        case U'\u0345': return true;
-        case U'\u0370': return true;
-        case U'\u0371': return true;
-        case U'\u0372': return true;
-        case U'\u0373': return true;
-        case U'\u0376': return true;
-        case U'\u0377': return true;
-        case U'\u037A': return true;
-        case U'\u037B': return true;
-        case U'\u037C': return true;
-        case U'\u037D': return true;
-        case U'\u037F': return true;
-        case U'\u0386': return true;
-        case U'\u0388': return true;
-        case U'\u0389': return true;
-        case U'\u038A': return true;
-        case U'\u038C': return true;
-        case U'\u038E': return true;
-        case U'\u038F': return true;
-        case U'\u0390': return true;
-        case U'\u0391': return true;
-        case U'\u0392': return true;
-        case U'\u0393': return true;
-        case U'\u0394': return true;
-        case U'\u0395': return true;
-        case U'\u0396': return true;
-        case U'\u0397': return true;
-        case U'\u0398': return true;
-        case U'\u0399': return true;
-        case U'\u039A': return true;
-        case U'\u039B': return true;
-        case U'\u039C': return true;
-        case U'\u039D': return true;
-        case U'\u039E': return true;
-        case U'\u039F': return true;
-        case U'\u03A0': return true;
-        case U'\u03A1': return true;
-        case U'\u03A3': return true;
-        case U'\u03A4': return true;
-        case U'\u03A5': return true;
-        case U'\u03A6': return true;
-        case U'\u03A7': return true;
-        case U'\u03A8': return true;
-        case U'\u03A9': return true;
-        case U'\u03AA': return true;
-        case U'\u03AB': return true;
-        case U'\u03AC': return true;
-        case U'\u03AD': return true;
-        case U'\u03AE': return true;
-        case U'\u03AF': return true;
-        case U'\u03B0': return true;
-        case U'\u03B1': return true;
-        case U'\u03B2': return true;
-        case U'\u03B3': return true;
-        case U'\u03B4': return true;
-        case U'\u03B5': return true;
-        case U'\u03B6': return true;
-        case U'\u03B7': return true;
-        case U'\u03B8': return true;
-        case U'\u03B9': return true;
-        case U'\u03BA': return true;
-        case U'\u03BB': return true;
-        case U'\u03BC': return true;
-        case U'\u03BD': return true;
-        case U'\u03BE': return true;
-        case U'\u03BF': return true;
-        case U'\u03C0': return true;
-        case U'\u03C1': return true;
-        case U'\u03C2': return true;
-        case U'\u03C3': return true;
-        case U'\u03C4': return true;
-        case U'\u03C5': return true;
-        case U'\u03C6': return true;
-        case U'\u03C7': return true;
-        case U'\u03C8': return true;
-        case U'\u03C9': return true;
-        case U'\u03CA': return true;
-        case U'\u03CB': return true;
-        case U'\u03CC': return true;
-        case U'\u03CD': return true;
-        case U'\u03CE': return true;
-        case U'\u03CF': return true;
-        case U'\u03D0': return true;
-        case U'\u03D1': return true;
-        case U'\u03D2': return true;
-        case U'\u03D3': return true;
-        case U'\u03D4': return true;
-        case U'\u03D5': return true;
-        case U'\u03D6': return true;
-        case U'\u03D7': return true;
-        case U'\u03D8': return true;
-        case U'\u03D9': return true;
-        case U'\u03DA': return true;
-        case U'\u03DB': return true;
-        case U'\u03DC': return true;
-        case U'\u03DD': return true;
-        case U'\u03DE': return true;
-        case U'\u03DF': return true;
-        case U'\u03E0': return true;
-        case U'\u03E1': return true;
-        case U'\u03E2': return true;
-        case U'\u03E3': return true;
-        case U'\u03E4': return true;
-        case U'\u03E5': return true;
-        case U'\u03E6': return true;
-        case U'\u03E7': return true;
-        case U'\u03E8': return true;
-        case U'\u03E9': return true;
-        case U'\u03EA': return true;
-        case U'\u03EB': return true;
-        case U'\u03EC': return true;
-        case U'\u03ED': return true;
-        case U'\u03EE': return true;
-        case U'\u03EF': return true;
-        case U'\u03F0': return true;
-        case U'\u03F1': return true;
-        case U'\u03F2': return true;
-        case U'\u03F3': return true;
-        case U'\u03F4': return true;
-        case U'\u03F5': return true;
-        case U'\u03F7': return true;
-        case U'\u03F8': return true;
-        case U'\u03F9': return true;
-        case U'\u03FA': return true;
-        case U'\u03FB': return true;
-        case U'\u03FC': return true;
-        case U'\u03FD': return true;
-        case U'\u03FE': return true;
-        case U'\u03FF': return true;
-        case U'\u0400': return true;
-        case U'\u0401': return true;
-        case U'\u0402': return true;
-        case U'\u0403': return true;
-        case U'\u0404': return true;
-        case U'\u0405': return true;
-        case U'\u0406': return true;
-        case U'\u0407': return true;
-        case U'\u0408': return true;
-        case U'\u0409': return true;
-        case U'\u040A': return true;
-        case U'\u040B': return true;
-        case U'\u040C': return true;
-        case U'\u040D': return true;
-        case U'\u040E': return true;
-        case U'\u040F': return true;
-        case U'\u0410': return true;
-        case U'\u0411': return true;
-        case U'\u0412': return true;
-        case U'\u0413': return true;
-        case U'\u0414': return true;
-        case U'\u0415': return true;
-        case U'\u0416': return true;
-        case U'\u0417': return true;
-        case U'\u0418': return true;
-        case U'\u0419': return true;
-        case U'\u041A': return true;
-        case U'\u041B': return true;
-        case U'\u041C': return true;
-        case U'\u041D': return true;
-        case U'\u041E': return true;
-        case U'\u041F': return true;
-        case U'\u0420': return true;
-        case U'\u0421': return true;
-        case U'\u0422': return true;
-        case U'\u0423': return true;
-        case U'\u0424': return true;
-        case U'\u0425': return true;
-        case U'\u0426': return true;
-        case U'\u0427': return true;
-        case U'\u0428': return true;
-        case U'\u0429': return true;
-        case U'\u042A': return true;
-        case U'\u042B': return true;
-        case U'\u042C': return true;
-        case U'\u042D': return true;
-        case U'\u042E': return true;
-        case U'\u042F': return true;
-        case U'\u0430': return true;
-        case U'\u0431': return true;
-        case U'\u0432': return true;
-        case U'\u0433': return true;
-        case U'\u0434': return true;
-        case U'\u0435': return true;
-        case U'\u0436': return true;
-        case U'\u0437': return true;
-        case U'\u0438': return true;
-        case U'\u0439': return true;
-        case U'\u043A': return true;
-        case U'\u043B': return true;
-        case U'\u043C': return true;
-        case U'\u043D': return true;
-        case U'\u043E': return true;
-        case U'\u043F': return true;
-        case U'\u0440': return true;
-        case U'\u0441': return true;
-        case U'\u0442': return true;
-        case U'\u0443': return true;
-        case U'\u0444': return true;
-        case U'\u0445': return true;
-        case U'\u0446': return true;
-        case U'\u0447': return true;
-        case U'\u0448': return true;
-        case U'\u0449': return true;
-        case U'\u044A': return true;
-        case U'\u044B': return true;
-        case U'\u044C': return true;
-        case U'\u044D': return true;
-        case U'\u044E': return true;
-        case U'\u044F': return true;
-        case U'\u0450': return true;
-        case U'\u0451': return true;
-        case U'\u0452': return true;
-        case U'\u0453': return true;
-        case U'\u0454': return true;
-        case U'\u0455': return true;
-        case U'\u0456': return true;
-        case U'\u0457': return true;
-        case U'\u0458': return true;
-        case U'\u0459': return true;
-        case U'\u045A': return true;
-        case U'\u045B': return true;
-        case U'\u045C': return true;
-        case U'\u045D': return true;
-        case U'\u045E': return true;
-        case U'\u045F': return true;
-        case U'\u0460': return true;
-        case U'\u0461': return true;
-        case U'\u0462': return true;
-        case U'\u0463': return true;
-        case U'\u0464': return true;
-        case U'\u0465': return true;
-        case U'\u0466': return true;
-        case U'\u0467': return true;
-        case U'\u0468': return true;
-        case U'\u0469': return true;
-        case U'\u046A': return true;
-        case U'\u046B': return true;
-        case U'\u046C': return true;
-        case U'\u046D': return true;
-        case U'\u046E': return true;
-        case U'\u046F': return true;
-        case U'\u0470': return true;
-        case U'\u0471': return true;
-        case U'\u0472': return true;
-        case U'\u0473': return true;
-        case U'\u0474': return true;
-        case U'\u0475': return true;
-        case U'\u0476': return true;
-        case U'\u0477': return true;
-        case U'\u0478': return true;
-        case U'\u0479': return true;
-        case U'\u047A': return true;
-        case U'\u047B': return true;
-        case U'\u047C': return true;
-        case U'\u047D': return true;
-        case U'\u047E': return true;
-        case U'\u047F': return true;
-        case U'\u0480': return true;
-        case U'\u0481': return true;
-        case U'\u048A': return true;
-        case U'\u048B': return true;
-        case U'\u048C': return true;
-        case U'\u048D': return true;
-        case U'\u048E': return true;
-        case U'\u048F': return true;
-        case U'\u0490': return true;
-        case U'\u0491': return true;
-        case U'\u0492': return true;
-        case U'\u0493': return true;
-        case U'\u0494': return true;
-        case U'\u0495': return true;
-        case U'\u0496': return true;
-        case U'\u0497': return true;
-        case U'\u0498': return true;
-        case U'\u0499': return true;
-        case U'\u049A': return true;
-        case U'\u049B': return true;
-        case U'\u049C': return true;
-        case U'\u049D': return true;
-        case U'\u049E': return true;
-        case U'\u049F': return true;
-        case U'\u04A0': return true;
-        case U'\u04A1': return true;
-        case U'\u04A2': return true;
-        case U'\u04A3': return true;
-        case U'\u04A4': return true;
-        case U'\u04A5': return true;
-        case U'\u04A6': return true;
-        case U'\u04A7': return true;
-        case U'\u04A8': return true;
-        case U'\u04A9': return true;
-        case U'\u04AA': return true;
-        case U'\u04AB': return true;
-        case U'\u04AC': return true;
-        case U'\u04AD': return true;
-        case U'\u04AE': return true;
-        case U'\u04AF': return true;
-        case U'\u04B0': return true;
-        case U'\u04B1': return true;
-        case U'\u04B2': return true;
-        case U'\u04B3': return true;
-        case U'\u04B4': return true;
-        case U'\u04B5': return true;
-        case U'\u04B6': return true;
-        case U'\u04B7': return true;
-        case U'\u04B8': return true;
-        case U'\u04B9': return true;
-        case U'\u04BA': return true;
-        case U'\u04BB': return true;
-        case U'\u04BC': return true;
-        case U'\u04BD': return true;
-        case U'\u04BE': return true;
-        case U'\u04BF': return true;
-        case U'\u04C0': return true;
-        case U'\u04C1': return true;
-        case U'\u04C2': return true;
-        case U'\u04C3': return true;
-        case U'\u04C4': return true;
-        case U'\u04C5': return true;
-        case U'\u04C6': return true;
-        case U'\u04C7': return true;
-        case U'\u04C8': return true;
-        case U'\u04C9': return true;
-        case U'\u04CA': return true;
-        case U'\u04CB': return true;
-        case U'\u04CC': return true;
-        case U'\u04CD': return true;
-        case U'\u04CE': return true;
-        case U'\u04CF': return true;
-        case U'\u04D0': return true;
-        case U'\u04D1': return true;
-        case U'\u04D2': return true;
-        case U'\u04D3': return true;
-        case U'\u04D4': return true;
-        case U'\u04D5': return true;
-        case U'\u04D6': return true;
-        case U'\u04D7': return true;
-        case U'\u04D8': return true;
-        case U'\u04D9': return true;
-        case U'\u04DA': return true;
-        case U'\u04DB': return true;
-        case U'\u04DC': return true;
-        case U'\u04DD': return true;
-        case U'\u04DE': return true;
-        case U'\u04DF': return true;
-        case U'\u04E0': return true;
-        case U'\u04E1': return true;
-        case U'\u04E2': return true;
-        case U'\u04E3': return true;
-        case U'\u04E4': return true;
-        case U'\u04E5': return true;
-        case U'\u04E6': return true;
-        case U'\u04E7': return true;
-        case U'\u04E8': return true;
-        case U'\u04E9': return true;
-        case U'\u04EA': return true;
-        case U'\u04EB': return true;
-        case U'\u04EC': return true;
-        case U'\u04ED': return true;
-        case U'\u04EE': return true;
-        case U'\u04EF': return true;
-        case U'\u04F0': return true;
-        case U'\u04F1': return true;
-        case U'\u04F2': return true;
-        case U'\u04F3': return true;
-        case U'\u04F4': return true;
-        case U'\u04F5': return true;
-        case U'\u04F6': return true;
-        case U'\u04F7': return true;
-        case U'\u04F8': return true;
-        case U'\u04F9': return true;
-        case U'\u04FA': return true;
-        case U'\u04FB': return true;
-        case U'\u04FC': return true;
-        case U'\u04FD': return true;
-        case U'\u04FE': return true;
-        case U'\u04FF': return true;
-        case U'\u0500': return true;
-        case U'\u0501': return true;
-        case U'\u0502': return true;
-        case U'\u0503': return true;
-        case U'\u0504': return true;
-        case U'\u0505': return true;
-        case U'\u0506': return true;
-        case U'\u0507': return true;
-        case U'\u0508': return true;
-        case U'\u0509': return true;
-        case U'\u050A': return true;
-        case U'\u050B': return true;
-        case U'\u050C': return true;
-        case U'\u050D': return true;
-        case U'\u050E': return true;
-        case U'\u050F': return true;
-        case U'\u0510': return true;
-        case U'\u0511': return true;
-        case U'\u0512': return true;
-        case U'\u0513': return true;
-        case U'\u0514': return true;
-        case U'\u0515': return true;
-        case U'\u0516': return true;
-        case U'\u0517': return true;
-        case U'\u0518': return true;
-        case U'\u0519': return true;
-        case U'\u051A': return true;
-        case U'\u051B': return true;
-        case U'\u051C': return true;
-        case U'\u051D': return true;
-        case U'\u051E': return true;
-        case U'\u051F': return true;
-        case U'\u0520': return true;
-        case U'\u0521': return true;
-        case U'\u0522': return true;
-        case U'\u0523': return true;
-        case U'\u0524': return true;
-        case U'\u0525': return true;
-        case U'\u0526': return true;
-        case U'\u0527': return true;
-        case U'\u0528': return true;
-        case U'\u0529': return true;
-        case U'\u052A': return true;
-        case U'\u052B': return true;
-        case U'\u052C': return true;
-        case U'\u052D': return true;
-        case U'\u052E': return true;
-        case U'\u052F': return true;
-        case U'\u0531': return true;
-        case U'\u0532': return true;
-        case U'\u0533': return true;
-        case U'\u0534': return true;
-        case U'\u0535': return true;
-        case U'\u0536': return true;
-        case U'\u0537': return true;
-        case U'\u0538': return true;
-        case U'\u0539': return true;
-        case U'\u053A': return true;
-        case U'\u053B': return true;
-        case U'\u053C': return true;
-        case U'\u053D': return true;
-        case U'\u053E': return true;
-        case U'\u053F': return true;
-        case U'\u0540': return true;
-        case U'\u0541': return true;
-        case U'\u0542': return true;
-        case U'\u0543': return true;
-        case U'\u0544': return true;
-        case U'\u0545': return true;
-        case U'\u0546': return true;
-        case U'\u0547': return true;
-        case U'\u0548': return true;
-        case U'\u0549': return true;
-        case U'\u054A': return true;
-        case U'\u054B': return true;
-        case U'\u054C': return true;
-        case U'\u054D': return true;
-        case U'\u054E': return true;
-        case U'\u054F': return true;
-        case U'\u0550': return true;
-        case U'\u0551': return true;
-        case U'\u0552': return true;
-        case U'\u0553': return true;
-        case U'\u0554': return true;
-        case U'\u0555': return true;
-        case U'\u0556': return true;
-        case U'\u0560': return true;
-        case U'\u0561': return true;
-        case U'\u0562': return true;
-        case U'\u0563': return true;
-        case U'\u0564': return true;
-        case U'\u0565': return true;
-        case U'\u0566': return true;
-        case U'\u0567': return true;
-        case U'\u0568': return true;
-        case U'\u0569': return true;
-        case U'\u056A': return true;
-        case U'\u056B': return true;
-        case U'\u056C': return true;
-        case U'\u056D': return true;
-        case U'\u056E': return true;
-        case U'\u056F': return true;
-        case U'\u0570': return true;
-        case U'\u0571': return true;
-        case U'\u0572': return true;
-        case U'\u0573': return true;
-        case U'\u0574': return true;
-        case U'\u0575': return true;
-        case U'\u0576': return true;
-        case U'\u0577': return true;
-        case U'\u0578': return true;
-        case U'\u0579': return true;
-        case U'\u057A': return true;
-        case U'\u057B': return true;
-        case U'\u057C': return true;
-        case U'\u057D': return true;
-        case U'\u057E': return true;
-        case U'\u057F': return true;
-        case U'\u0580': return true;
-        case U'\u0581': return true;
-        case U'\u0582': return true;
-        case U'\u0583': return true;
-        case U'\u0584': return true;
-        case U'\u0585': return true;
-        case U'\u0586': return true;
-        case U'\u0587': return true;
-        case U'\u0588': return true;
-        case U'\u10A0': return true;
-        case U'\u10A1': return true;
-        case U'\u10A2': return true;
-        case U'\u10A3': return true;
-        case U'\u10A4': return true;
-        case U'\u10A5': return true;
-        case U'\u10A6': return true;
-        case U'\u10A7': return true;
-        case U'\u10A8': return true;
-        case U'\u10A9': return true;
-        case U'\u10AA': return true;
-        case U'\u10AB': return true;
-        case U'\u10AC': return true;
-        case U'\u10AD': return true;
-        case U'\u10AE': return true;
-        case U'\u10AF': return true;
-        case U'\u10B0': return true;
-        case U'\u10B1': return true;
-        case U'\u10B2': return true;
-        case U'\u10B3': return true;
-        case U'\u10B4': return true;
-        case U'\u10B5': return true;
-        case U'\u10B6': return true;
-        case U'\u10B7': return true;
-        case U'\u10B8': return true;
-        case U'\u10B9': return true;
-        case U'\u10BA': return true;
-        case U'\u10BB': return true;
-        case U'\u10BC': return true;
-        case U'\u10BD': return true;
-        case U'\u10BE': return true;
-        case U'\u10BF': return true;
-        case U'\u10C0': return true;
-        case U'\u10C1': return true;
-        case U'\u10C2': return true;
-        case U'\u10C3': return true;
-        case U'\u10C4': return true;
-        case U'\u10C5': return true;
-        case U'\u10C7': return true;
-        case U'\u10CD': return true;
-        case U'\u10D0': return true;
-        case U'\u10D1': return true;
-        case U'\u10D2': return true;
-        case U'\u10D3': return true;
-        case U'\u10D4': return true;
-        case U'\u10D5': return true;
-        case U'\u10D6': return true;
-        case U'\u10D7': return true;
-        case U'\u10D8': return true;
-        case U'\u10D9': return true;
-        case U'\u10DA': return true;
-        case U'\u10DB': return true;
-        case U'\u10DC': return true;
-        case U'\u10DD': return true;
-        case U'\u10DE': return true;
-        case U'\u10DF': return true;
-        case U'\u10E0': return true;
-        case U'\u10E1': return true;
-        case U'\u10E2': return true;
-        case U'\u10E3': return true;
-        case U'\u10E4': return true;
-        case U'\u10E5': return true;
-        case U'\u10E6': return true;
-        case U'\u10E7': return true;
-        case U'\u10E8': return true;
-        case U'\u10E9': return true;
-        case U'\u10EA': return true;
-        case U'\u10EB': return true;
-        case U'\u10EC': return true;
-        case U'\u10ED': return true;
-        case U'\u10EE': return true;
-        case U'\u10EF': return true;
-        case U'\u10F0': return true;
-        case U'\u10F1': return true;
-        case U'\u10F2': return true;
-        case U'\u10F3': return true;
-        case U'\u10F4': return true;
-        case U'\u10F5': return true;
-        case U'\u10F6': return true;
-        case U'\u10F7': return true;
-        case U'\u10F8': return true;
-        case U'\u10F9': return true;
-        case U'\u10FA': return true;
-        case U'\u10FC': return true;
-        case U'\u10FD': return true;
-        case U'\u10FE': return true;
-        case U'\u10FF': return true;
-        case U'\u13A0': return true;
-        case U'\u13A1': return true;
-        case U'\u13A2': return true;
-        case U'\u13A3': return true;
-        case U'\u13A4': return true;
-        case U'\u13A5': return true;
-        case U'\u13A6': return true;
-        case U'\u13A7': return true;
-        case U'\u13A8': return true;
-        case U'\u13A9': return true;
-        case U'\u13AA': return true;
-        case U'\u13AB': return true;
-        case U'\u13AC': return true;
-        case U'\u13AD': return true;
-        case U'\u13AE': return true;
-        case U'\u13AF': return true;
-        case U'\u13B0': return true;
-        case U'\u13B1': return true;
-        case U'\u13B2': return true;
-        case U'\u13B3': return true;
-        case U'\u13B4': return true;
-        case U'\u13B5': return true;
-        case U'\u13B6': return true;
-        case U'\u13B7': return true;
-        case U'\u13B8': return true;
-        case U'\u13B9': return true;
-        case U'\u13BA': return true;
-        case U'\u13BB': return true;
-        case U'\u13BC': return true;
-        case U'\u13BD': return true;
-        case U'\u13BE': return true;
-        case U'\u13BF': return true;
-        case U'\u13C0': return true;
-        case U'\u13C1': return true;
-        case U'\u13C2': return true;
-        case U'\u13C3': return true;
-        case U'\u13C4': return true;
-        case U'\u13C5': return true;
-        case U'\u13C6': return true;
-        case U'\u13C7': return true;
-        case U'\u13C8': return true;
-        case U'\u13C9': return true;
-        case U'\u13CA': return true;
-        case U'\u13CB': return true;
-        case U'\u13CC': return true;
-        case U'\u13CD': return true;
-        case U'\u13CE': return true;
-        case U'\u13CF': return true;
-        case U'\u13D0': return true;
-        case U'\u13D1': return true;
-        case U'\u13D2': return true;
-        case U'\u13D3': return true;
-        case U'\u13D4': return true;
-        case U'\u13D5': return true;
-        case U'\u13D6': return true;
-        case U'\u13D7': return true;
-        case U'\u13D8': return true;
-        case U'\u13D9': return true;
-        case U'\u13DA': return true;
-        case U'\u13DB': return true;
-        case U'\u13DC': return true;
-        case U'\u13DD': return true;
-        case U'\u13DE': return true;
-        case U'\u13DF': return true;
-        case U'\u13E0': return true;
-        case U'\u13E1': return true;
-        case U'\u13E2': return true;
-        case U'\u13E3': return true;
-        case U'\u13E4': return true;
-        case U'\u13E5': return true;
-        case U'\u13E6': return true;
-        case U'\u13E7': return true;
-        case U'\u13E8': return true;
-        case U'\u13E9': return true;
-        case U'\u13EA': return true;
-        case U'\u13EB': return true;
-        case U'\u13EC': return true;
-        case U'\u13ED': return true;
-        case U'\u13EE': return true;
-        case U'\u13EF': return true;
-        case U'\u13F0': return true;
-        case U'\u13F1': return true;
-        case U'\u13F2': return true;
-        case U'\u13F3': return true;
-        case U'\u13F4': return true;
-        case U'\u13F5': return true;
-        case U'\u13F8': return true;
-        case U'\u13F9': return true;
-        case U'\u13FA': return true;
-        case U'\u13FB': return true;
-        case U'\u13FC': return true;
-        case U'\u13FD': return true;
-        case U'\u1C80': return true;
-        case U'\u1C81': return true;
-        case U'\u1C82': return true;
-        case U'\u1C83': return true;
-        case U'\u1C84': return true;
-        case U'\u1C85': return true;
-        case U'\u1C86': return true;
-        case U'\u1C87': return true;
-        case U'\u1C88': return true;
-        case U'\u1C89': return true;
-        case U'\u1C8A': return true;
-        case U'\u1C90': return true;
-        case U'\u1C91': return true;
-        case U'\u1C92': return true;
-        case U'\u1C93': return true;
-        case U'\u1C94': return true;
-        case U'\u1C95': return true;
-        case U'\u1C96': return true;
-        case U'\u1C97': return true;
-        case U'\u1C98': return true;
-        case U'\u1C99': return true;
-        case U'\u1C9A': return true;
-        case U'\u1C9B': return true;
-        case U'\u1C9C': return true;
-        case U'\u1C9D': return true;
-        case U'\u1C9E': return true;
-        case U'\u1C9F': return true;
-        case U'\u1CA0': return true;
-        case U'\u1CA1': return true;
-        case U'\u1CA2': return true;
-        case U'\u1CA3': return true;
-        case U'\u1CA4': return true;
-        case U'\u1CA5': return true;
-        case U'\u1CA6': return true;
-        case U'\u1CA7': return true;
-        case U'\u1CA8': return true;
-        case U'\u1CA9': return true;
-        case U'\u1CAA': return true;
-        case U'\u1CAB': return true;
-        case U'\u1CAC': return true;
-        case U'\u1CAD': return true;
-        case U'\u1CAE': return true;
-        case U'\u1CAF': return true;
-        case U'\u1CB0': return true;
-        case U'\u1CB1': return true;
-        case U'\u1CB2': return true;
-        case U'\u1CB3': return true;
-        case U'\u1CB4': return true;
-        case U'\u1CB5': return true;
-        case U'\u1CB6': return true;
-        case U'\u1CB7': return true;
-        case U'\u1CB8': return true;
-        case U'\u1CB9': return true;
-        case U'\u1CBA': return true;
-        case U'\u1CBD': return true;
-        case U'\u1CBE': return true;
-        case U'\u1CBF': return true;
-        case U'\u1D00': return true;
-        case U'\u1D01': return true;
-        case U'\u1D02': return true;
-        case U'\u1D03': return true;
-        case U'\u1D04': return true;
-        case U'\u1D05': return true;
-        case U'\u1D06': return true;
-        case U'\u1D07': return true;
-        case U'\u1D08': return true;
-        case U'\u1D09': return true;
-        case U'\u1D0A': return true;
-        case U'\u1D0B': return true;
-        case U'\u1D0C': return true;
-        case U'\u1D0D': return true;
-        case U'\u1D0E': return true;
-        case U'\u1D0F': return true;
-        case U'\u1D10': return true;
-        case U'\u1D11': return true;
-        case U'\u1D12': return true;
-        case U'\u1D13': return true;
-        case U'\u1D14': return true;
-        case U'\u1D15': return true;
-        case U'\u1D16': return true;
-        case U'\u1D17': return true;
-        case U'\u1D18': return true;
-        case U'\u1D19': return true;
-        case U'\u1D1A': return true;
-        case U'\u1D1B': return true;
-        case U'\u1D1C': return true;
-        case U'\u1D1D': return true;
-        case U'\u1D1E': return true;
-        case U'\u1D1F': return true;
-        case U'\u1D20': return true;
-        case U'\u1D21': return true;
-        case U'\u1D22': return true;
-        case U'\u1D23': return true;
-        case U'\u1D24': return true;
-        case U'\u1D25': return true;
-        case U'\u1D26': return true;
-        case U'\u1D27': return true;
-        case U'\u1D28': return true;
-        case U'\u1D29': return true;
-        case U'\u1D2A': return true;
-        case U'\u1D2B': return true;
-        case U'\u1D2C': return true;
-        case U'\u1D2D': return true;
-        case U'\u1D2E': return true;
-        case U'\u1D2F': return true;
-        case U'\u1D30': return true;
-        case U'\u1D31': return true;
-        case U'\u1D32': return true;
-        case U'\u1D33': return true;
-        case U'\u1D34': return true;
-        case U'\u1D35': return true;
-        case U'\u1D36': return true;
-        case U'\u1D37': return true;
-        case U'\u1D38': return true;
-        case U'\u1D39': return true;
-        case U'\u1D3A': return true;
-        case U'\u1D3B': return true;
-        case U'\u1D3C': return true;
-        case U'\u1D3D': return true;
-        case U'\u1D3E': return true;
-        case U'\u1D3F': return true;
-        case U'\u1D40': return true;
-        case U'\u1D41': return true;
-        case U'\u1D42': return true;
-        case U'\u1D43': return true;
-        case U'\u1D44': return true;
-        case U'\u1D45': return true;
-        case U'\u1D46': return true;
-        case U'\u1D47': return true;
-        case U'\u1D48': return true;
-        case U'\u1D49': return true;
-        case U'\u1D4A': return true;
-        case U'\u1D4B': return true;
-        case U'\u1D4C': return true;
-        case U'\u1D4D': return true;
-        case U'\u1D4E': return true;
-        case U'\u1D4F': return true;
-        case U'\u1D50': return true;
-        case U'\u1D51': return true;
-        case U'\u1D52': return true;
-        case U'\u1D53': return true;
-        case U'\u1D54': return true;
-        case U'\u1D55': return true;
-        case U'\u1D56': return true;
-        case U'\u1D57': return true;
-        case U'\u1D58': return true;
-        case U'\u1D59': return true;
-        case U'\u1D5A': return true;
-        case U'\u1D5B': return true;
-        case U'\u1D5C': return true;
-        case U'\u1D5D': return true;
-        case U'\u1D5E': return true;
-        case U'\u1D5F': return true;
-        case U'\u1D60': return true;
-        case U'\u1D61': return true;
-        case U'\u1D62': return true;
-        case U'\u1D63': return true;
-        case U'\u1D64': return true;
-        case U'\u1D65': return true;
-        case U'\u1D66': return true;
-        case U'\u1D67': return true;
-        case U'\u1D68': return true;
-        case U'\u1D69': return true;
-        case U'\u1D6A': return true;
-        case U'\u1D6B': return true;
-        case U'\u1D6C': return true;
-        case U'\u1D6D': return true;
-        case U'\u1D6E': return true;
-        case U'\u1D6F': return true;
-        case U'\u1D70': return true;
-        case U'\u1D71': return true;
-        case U'\u1D72': return true;
-        case U'\u1D73': return true;
-        case U'\u1D74': return true;
-        case U'\u1D75': return true;
-        case U'\u1D76': return true;
-        case U'\u1D77': return true;
-        case U'\u1D78': return true;
-        case U'\u1D79': return true;
-        case U'\u1D7A': return true;
-        case U'\u1D7B': return true;
-        case U'\u1D7C': return true;
-        case U'\u1D7D': return true;
-        case U'\u1D7E': return true;
-        case U'\u1D7F': return true;
-        case U'\u1D80': return true;
-        case U'\u1D81': return true;
-        case U'\u1D82': return true;
-        case U'\u1D83': return true;
-        case U'\u1D84': return true;
-        case U'\u1D85': return true;
-        case U'\u1D86': return true;
-        case U'\u1D87': return true;
-        case U'\u1D88': return true;
-        case U'\u1D89': return true;
-        case U'\u1D8A': return true;
-        case U'\u1D8B': return true;
-        case U'\u1D8C': return true;
-        case U'\u1D8D': return true;
-        case U'\u1D8E': return true;
-        case U'\u1D8F': return true;
-        case U'\u1D90': return true;
-        case U'\u1D91': return true;
-        case U'\u1D92': return true;
-        case U'\u1D93': return true;
-        case U'\u1D94': return true;
-        case U'\u1D95': return true;
-        case U'\u1D96': return true;
-        case U'\u1D97': return true;
-        case U'\u1D98': return true;
-        case U'\u1D99': return true;
-        case U'\u1D9A': return true;
-        case U'\u1D9B': return true;
-        case U'\u1D9C': return true;
-        case U'\u1D9D': return true;
-        case U'\u1D9E': return true;
-        case U'\u1D9F': return true;
-        case U'\u1DA0': return true;
-        case U'\u1DA1': return true;
-        case U'\u1DA2': return true;
-        case U'\u1DA3': return true;
-        case U'\u1DA4': return true;
-        case U'\u1DA5': return true;
-        case U'\u1DA6': return true;
-        case U'\u1DA7': return true;
-        case U'\u1DA8': return true;
-        case U'\u1DA9': return true;
-        case U'\u1DAA': return true;
-        case U'\u1DAB': return true;
-        case U'\u1DAC': return true;
-        case U'\u1DAD': return true;
-        case U'\u1DAE': return true;
-        case U'\u1DAF': return true;
-        case U'\u1DB0': return true;
-        case U'\u1DB1': return true;
-        case U'\u1DB2': return true;
-        case U'\u1DB3': return true;
-        case U'\u1DB4': return true;
-        case U'\u1DB5': return true;
-        case U'\u1DB6': return true;
-        case U'\u1DB7': return true;
-        case U'\u1DB8': return true;
-        case U'\u1DB9': return true;
-        case U'\u1DBA': return true;
-        case U'\u1DBB': return true;
-        case U'\u1DBC': return true;
-        case U'\u1DBD': return true;
-        case U'\u1DBE': return true;
-        case U'\u1DBF': return true;
-        case U'\u1E00': return true;
-        case U'\u1E01': return true;
-        case U'\u1E02': return true;
-        case U'\u1E03': return true;
-        case U'\u1E04': return true;
-        case U'\u1E05': return true;
-        case U'\u1E06': return true;
-        case U'\u1E07': return true;
-        case U'\u1E08': return true;
-        case U'\u1E09': return true;
-        case U'\u1E0A': return true;
-        case U'\u1E0B': return true;
-        case U'\u1E0C': return true;
-        case U'\u1E0D': return true;
-        case U'\u1E0E': return true;
-        case U'\u1E0F': return true;
-        case U'\u1E10': return true;
-        case U'\u1E11': return true;
-        case U'\u1E12': return true;
-        case U'\u1E13': return true;
-        case U'\u1E14': return true;
-        case U'\u1E15': return true;
-        case U'\u1E16': return true;
-        case U'\u1E17': return true;
-        case U'\u1E18': return true;
-        case U'\u1E19': return true;
-        case U'\u1E1A': return true;
-        case U'\u1E1B': return true;
-        case U'\u1E1C': return true;
-        case U'\u1E1D': return true;
-        case U'\u1E1E': return true;
-        case U'\u1E1F': return true;
-        case U'\u1E20': return true;
-        case U'\u1E21': return true;
-        case U'\u1E22': return true;
-        case U'\u1E23': return true;
-        case U'\u1E24': return true;
-        case U'\u1E25': return true;
-        case U'\u1E26': return true;
-        case U'\u1E27': return true;
-        case U'\u1E28': return true;
-        case U'\u1E29': return true;
-        case U'\u1E2A': return true;
-        case U'\u1E2B': return true;
-        case U'\u1E2C': return true;
-        case U'\u1E2D': return true;
-        case U'\u1E2E': return true;
-        case U'\u1E2F': return true;
-        case U'\u1E30': return true;
-        case U'\u1E31': return true;
-        case U'\u1E32': return true;
-        case U'\u1E33': return true;
-        case U'\u1E34': return true;
-        case U'\u1E35': return true;
-        case U'\u1E36': return true;
-        case U'\u1E37': return true;
-        case U'\u1E38': return true;
-        case U'\u1E39': return true;
-        case U'\u1E3A': return true;
-        case U'\u1E3B': return true;
-        case U'\u1E3C': return true;
-        case U'\u1E3D': return true;
-        case U'\u1E3E': return true;
-        case U'\u1E3F': return true;
-        case U'\u1E40': return true;
-        case U'\u1E41': return true;
-        case U'\u1E42': return true;
-        case U'\u1E43': return true;
-        case U'\u1E44': return true;
-        case U'\u1E45': return true;
-        case U'\u1E46': return true;
-        case U'\u1E47': return true;
-        case U'\u1E48': return true;
-        case U'\u1E49': return true;
-        case U'\u1E4A': return true;
-        case U'\u1E4B': return true;
-        case U'\u1E4C': return true;
-        case U'\u1E4D': return true;
-        case U'\u1E4E': return true;
-        case U'\u1E4F': return true;
-        case U'\u1E50': return true;
-        case U'\u1E51': return true;
-        case U'\u1E52': return true;
-        case U'\u1E53': return true;
-        case U'\u1E54': return true;
-        case U'\u1E55': return true;
-        case U'\u1E56': return true;
-        case U'\u1E57': return true;
-        case U'\u1E58': return true;
-        case U'\u1E59': return true;
-        case U'\u1E5A': return true;
-        case U'\u1E5B': return true;
-        case U'\u1E5C': return true;
-        case U'\u1E5D': return true;
-        case U'\u1E5E': return true;
-        case U'\u1E5F': return true;
-        case U'\u1E60': return true;
-        case U'\u1E61': return true;
-        case U'\u1E62': return true;
-        case U'\u1E63': return true;
-        case U'\u1E64': return true;
-        case U'\u1E65': return true;
-        case U'\u1E66': return true;
-        case U'\u1E67': return true;
-        case U'\u1E68': return true;
-        case U'\u1E69': return true;
-        case U'\u1E6A': return true;
-        case U'\u1E6B': return true;
-        case U'\u1E6C': return true;
-        case U'\u1E6D': return true;
-        case U'\u1E6E': return true;
-        case U'\u1E6F': return true;
-        case U'\u1E70': return true;
-        case U'\u1E71': return true;
-        case U'\u1E72': return true;
-        case U'\u1E73': return true;
-        case U'\u1E74': return true;
-        case U'\u1E75': return true;
-        case U'\u1E76': return true;
-        case U'\u1E77': return true;
-        case U'\u1E78': return true;
-        case U'\u1E79': return true;
-        case U'\u1E7A': return true;
-        case U'\u1E7B': return true;
-        case U'\u1E7C': return true;
-        case U'\u1E7D': return true;
-        case U'\u1E7E': return true;
-        case U'\u1E7F': return true;
-        case U'\u1E80': return true;
-        case U'\u1E81': return true;
-        case U'\u1E82': return true;
-        case U'\u1E83': return true;
-        case U'\u1E84': return true;
-        case U'\u1E85': return true;
-        case U'\u1E86': return true;
-        case U'\u1E87': return true;
-        case U'\u1E88': return true;
-        case U'\u1E89': return true;
-        case U'\u1E8A': return true;
-        case U'\u1E8B': return true;
-        case U'\u1E8C': return true;
-        case U'\u1E8D': return true;
-        case U'\u1E8E': return true;
-        case U'\u1E8F': return true;
-        case U'\u1E90': return true;
-        case U'\u1E91': return true;
-        case U'\u1E92': return true;
-        case U'\u1E93': return true;
-        case U'\u1E94': return true;
-        case U'\u1E95': return true;
-        case U'\u1E96': return true;
-        case U'\u1E97': return true;
-        case U'\u1E98': return true;
-        case U'\u1E99': return true;
-        case U'\u1E9A': return true;
-        case U'\u1E9B': return true;
-        case U'\u1E9C': return true;
-        case U'\u1E9D': return true;
-        case U'\u1E9E': return true;
-        case U'\u1E9F': return true;
-        case U'\u1EA0': return true;
-        case U'\u1EA1': return true;
-        case U'\u1EA2': return true;
-        case U'\u1EA3': return true;
-        case U'\u1EA4': return true;
-        case U'\u1EA5': return true;
-        case U'\u1EA6': return true;
-        case U'\u1EA7': return true;
-        case U'\u1EA8': return true;
-        case U'\u1EA9': return true;
-        case U'\u1EAA': return true;
-        case U'\u1EAB': return true;
-        case U'\u1EAC': return true;
-        case U'\u1EAD': return true;
-        case U'\u1EAE': return true;
-        case U'\u1EAF': return true;
-        case U'\u1EB0': return true;
-        case U'\u1EB1': return true;
-        case U'\u1EB2': return true;
-        case U'\u1EB3': return true;
-        case U'\u1EB4': return true;
-        case U'\u1EB5': return true;
-        case U'\u1EB6': return true;
-        case U'\u1EB7': return true;
-        case U'\u1EB8': return true;
-        case U'\u1EB9': return true;
-        case U'\u1EBA': return true;
-        case U'\u1EBB': return true;
-        case U'\u1EBC': return true;
-        case U'\u1EBD': return true;
-        case U'\u1EBE': return true;
-        case U'\u1EBF': return true;
-        case U'\u1EC0': return true;
-        case U'\u1EC1': return true;
-        case U'\u1EC2': return true;
-        case U'\u1EC3': return true;
-        case U'\u1EC4': return true;
-        case U'\u1EC5': return true;
-        case U'\u1EC6': return true;
-        case U'\u1EC7': return true;
-        case U'\u1EC8': return true;
-        case U'\u1EC9': return true;
-        case U'\u1ECA': return true;
-        case U'\u1ECB': return true;
-        case U'\u1ECC': return true;
-        case U'\u1ECD': return true;
-        case U'\u1ECE': return true;
-        case U'\u1ECF': return true;
-        case U'\u1ED0': return true;
-        case U'\u1ED1': return true;
-        case U'\u1ED2': return true;
-        case U'\u1ED3': return true;
-        case U'\u1ED4': return true;
-        case U'\u1ED5': return true;
-        case U'\u1ED6': return true;
-        case U'\u1ED7': return true;
-        case U'\u1ED8': return true;
-        case U'\u1ED9': return true;
-        case U'\u1EDA': return true;
-        case U'\u1EDB': return true;
-        case U'\u1EDC': return true;
-        case U'\u1EDD': return true;
-        case U'\u1EDE': return true;
-        case U'\u1EDF': return true;
-        case U'\u1EE0': return true;
-        case U'\u1EE1': return true;
-        case U'\u1EE2': return true;
-        case U'\u1EE3': return true;
-        case U'\u1EE4': return true;
-        case U'\u1EE5': return true;
-        case U'\u1EE6': return true;
-        case U'\u1EE7': return true;
-        case U'\u1EE8': return true;
-        case U'\u1EE9': return true;
-        case U'\u1EEA': return true;
-        case U'\u1EEB': return true;
-        case U'\u1EEC': return true;
-        case U'\u1EED': return true;
-        case U'\u1EEE': return true;
-        case U'\u1EEF': return true;
-        case U'\u1EF0': return true;
-        case U'\u1EF1': return true;
-        case U'\u1EF2': return true;
-        case U'\u1EF3': return true;
-        case U'\u1EF4': return true;
-        case U'\u1EF5': return true;
-        case U'\u1EF6': return true;
-        case U'\u1EF7': return true;
-        case U'\u1EF8': return true;
-        case U'\u1EF9': return true;
-        case U'\u1EFA': return true;
-        case U'\u1EFB': return true;
-        case U'\u1EFC': return true;
-        case U'\u1EFD': return true;
-        case U'\u1EFE': return true;
-        case U'\u1EFF': return true;
-        case U'\u1F00': return true;
-        case U'\u1F01': return true;
-        case U'\u1F02': return true;
-        case U'\u1F03': return true;
-        case U'\u1F04': return true;
-        case U'\u1F05': return true;
-        case U'\u1F06': return true;
-        case U'\u1F07': return true;
-        case U'\u1F08': return true;
-        case U'\u1F09': return true;
-        case U'\u1F0A': return true;
-        case U'\u1F0B': return true;
-        case U'\u1F0C': return true;
-        case U'\u1F0D': return true;
-        case U'\u1F0E': return true;
-        case U'\u1F0F': return true;
-        case U'\u1F10': return true;
-        case U'\u1F11': return true;
-        case U'\u1F12': return true;
-        case U'\u1F13': return true;
-        case U'\u1F14': return true;
-        case U'\u1F15': return true;
-        case U'\u1F18': return true;
-        case U'\u1F19': return true;
-        case U'\u1F1A': return true;
-        case U'\u1F1B': return true;
-        case U'\u1F1C': return true;
-        case U'\u1F1D': return true;
-        case U'\u1F20': return true;
-        case U'\u1F21': return true;
-        case U'\u1F22': return true;
-        case U'\u1F23': return true;
-        case U'\u1F24': return true;
-        case U'\u1F25': return true;
-        case U'\u1F26': return true;
-        case U'\u1F27': return true;
-        case U'\u1F28': return true;
-        case U'\u1F29': return true;
-        case U'\u1F2A': return true;
-        case U'\u1F2B': return true;
-        case U'\u1F2C': return true;
-        case U'\u1F2D': return true;
-        case U'\u1F2E': return true;
-        case U'\u1F2F': return true;
-        case U'\u1F30': return true;
-        case U'\u1F31': return true;
-        case U'\u1F32': return true;
-        case U'\u1F33': return true;
-        case U'\u1F34': return true;
-        case U'\u1F35': return true;
-        case U'\u1F36': return true;
-        case U'\u1F37': return true;
-        case U'\u1F38': return true;
-        case U'\u1F39': return true;
-        case U'\u1F3A': return true;
-        case U'\u1F3B': return true;
-        case U'\u1F3C': return true;
-        case U'\u1F3D': return true;
-        case U'\u1F3E': return true;
-        case U'\u1F3F': return true;
-        case U'\u1F40': return true;
-        case U'\u1F41': return true;
-        case U'\u1F42': return true;
-        case U'\u1F43': return true;
-        case U'\u1F44': return true;
-        case U'\u1F45': return true;
-        case U'\u1F48': return true;
-        case U'\u1F49': return true;
-        case U'\u1F4A': return true;
-        case U'\u1F4B': return true;
-        case U'\u1F4C': return true;
-        case U'\u1F4D': return true;
-        case U'\u1F50': return true;
-        case U'\u1F51': return true;
-        case U'\u1F52': return true;
-        case U'\u1F53': return true;
-        case U'\u1F54': return true;
-        case U'\u1F55': return true;
-        case U'\u1F56': return true;
-        case U'\u1F57': return true;
-        case U'\u1F59': return true;
-        case U'\u1F5B': return true;
-        case U'\u1F5D': return true;
-        case U'\u1F5F': return true;
-        case U'\u1F60': return true;
-        case U'\u1F61': return true;
-        case U'\u1F62': return true;
-        case U'\u1F63': return true;
-        case U'\u1F64': return true;
-        case U'\u1F65': return true;
-        case U'\u1F66': return true;
-        case U'\u1F67': return true;
-        case U'\u1F68': return true;
-        case U'\u1F69': return true;
-        case U'\u1F6A': return true;
-        case U'\u1F6B': return true;
-        case U'\u1F6C': return true;
-        case U'\u1F6D': return true;
-        case U'\u1F6E': return true;
-        case U'\u1F6F': return true;
-        case U'\u1F70': return true;
-        case U'\u1F71': return true;
-        case U'\u1F72': return true;
-        case U'\u1F73': return true;
-        case U'\u1F74': return true;
-        case U'\u1F75': return true;
-        case U'\u1F76': return true;
-        case U'\u1F77': return true;
-        case U'\u1F78': return true;
-        case U'\u1F79': return true;
-        case U'\u1F7A': return true;
-        case U'\u1F7B': return true;
-        case U'\u1F7C': return true;
-        case U'\u1F7D': return true;
-        case U'\u1F80': return true;
-        case U'\u1F81': return true;
-        case U'\u1F82': return true;
-        case U'\u1F83': return true;
-        case U'\u1F84': return true;
-        case U'\u1F85': return true;
-        case U'\u1F86': return true;
-        case U'\u1F87': return true;
-        case U'\u1F88': return true;
-        case U'\u1F89': return true;
-        case U'\u1F8A': return true;
-        case U'\u1F8B': return true;
-        case U'\u1F8C': return true;
-        case U'\u1F8D': return true;
-        case U'\u1F8E': return true;
-        case U'\u1F8F': return true;
-        case U'\u1F90': return true;
-        case U'\u1F91': return true;
-        case U'\u1F92': return true;
-        case U'\u1F93': return true;
-        case U'\u1F94': return true;
-        case U'\u1F95': return true;
-        case U'\u1F96': return true;
-        case U'\u1F97': return true;
-        case U'\u1F98': return true;
-        case U'\u1F99': return true;
-        case U'\u1F9A': return true;
-        case U'\u1F9B': return true;
-        case U'\u1F9C': return true;
-        case U'\u1F9D': return true;
-        case U'\u1F9E': return true;
-        case U'\u1F9F': return true;
-        case U'\u1FA0': return true;
-        case U'\u1FA1': return true;
-        case U'\u1FA2': return true;
-        case U'\u1FA3': return true;
-        case U'\u1FA4': return true;
-        case U'\u1FA5': return true;
-        case U'\u1FA6': return true;
-        case U'\u1FA7': return true;
-        case U'\u1FA8': return true;
-        case U'\u1FA9': return true;
-        case U'\u1FAA': return true;
-        case U'\u1FAB': return true;
-        case U'\u1FAC': return true;
-        case U'\u1FAD': return true;
-        case U'\u1FAE': return true;
-        case U'\u1FAF': return true;
-        case U'\u1FB0': return true;
-        case U'\u1FB1': return true;
-        case U'\u1FB2': return true;
-        case U'\u1FB3': return true;
-        case U'\u1FB4': return true;
-        case U'\u1FB6': return true;
-        case U'\u1FB7': return true;
-        case U'\u1FB8': return true;
-        case U'\u1FB9': return true;
-        case U'\u1FBA': return true;
-        case U'\u1FBB': return true;
-        case U'\u1FBC': return true;
-        case U'\u1FBE': return true;
-        case U'\u1FC2': return true;
-        case U'\u1FC3': return true;
-        case U'\u1FC4': return true;
-        case U'\u1FC6': return true;
-        case U'\u1FC7': return true;
-        case U'\u1FC8': return true;
-        case U'\u1FC9': return true;
-        case U'\u1FCA': return true;
-        case U'\u1FCB': return true;
-        case U'\u1FCC': return true;
-        case U'\u1FD0': return true;
-        case U'\u1FD1': return true;
-        case U'\u1FD2': return true;
-        case U'\u1FD3': return true;
-        case U'\u1FD6': return true;
-        case U'\u1FD7': return true;
-        case U'\u1FD8': return true;
-        case U'\u1FD9': return true;
-        case U'\u1FDA': return true;
-        case U'\u1FDB': return true;
-        case U'\u1FE0': return true;
-        case U'\u1FE1': return true;
-        case U'\u1FE2': return true;
-        case U'\u1FE3': return true;
-        case U'\u1FE4': return true;
-        case U'\u1FE5': return true;
-        case U'\u1FE6': return true;
-        case U'\u1FE7': return true;
-        case U'\u1FE8': return true;
-        case U'\u1FE9': return true;
-        case U'\u1FEA': return true;
-        case U'\u1FEB': return true;
-        case U'\u1FEC': return true;
-        case U'\u1FF2': return true;
-        case U'\u1FF3': return true;
-        case U'\u1FF4': return true;
-        case U'\u1FF6': return true;
-        case U'\u1FF7': return true;
-        case U'\u1FF8': return true;
-        case U'\u1FF9': return true;
-        case U'\u1FFA': return true;
-        case U'\u1FFB': return true;
-        case U'\u1FFC': return true;
-        case U'\u2071': return true;
-        case U'\u207F': return true;
-        case U'\u2090': return true;
-        case U'\u2091': return true;
-        case U'\u2092': return true;
-        case U'\u2093': return true;
-        case U'\u2094': return true;
-        case U'\u2095': return true;
-        case U'\u2096': return true;
-        case U'\u2097': return true;
-        case U'\u2098': return true;
-        case U'\u2099': return true;
-        case U'\u209A': return true;
-        case U'\u209B': return true;
-        case U'\u209C': return true;
-        case U'\u2102': return true;
-        case U'\u2107': return true;
-        case U'\u210A': return true;
-        case U'\u210B': return true;
-        case U'\u210C': return true;
-        case U'\u210D': return true;
-        case U'\u210E': return true;
-        case U'\u210F': return true;
-        case U'\u2110': return true;
-        case U'\u2111': return true;
-        case U'\u2112': return true;
-        case U'\u2113': return true;
-        case U'\u2115': return true;
-        case U'\u2119': return true;
-        case U'\u211A': return true;
-        case U'\u211B': return true;
-        case U'\u211C': return true;
-        case U'\u211D': return true;
-        case U'\u2124': return true;
-        case U'\u2126': return true;
-        case U'\u2128': return true;
-        case U'\u212A': return true;
-        case U'\u212B': return true;
-        case U'\u212C': return true;
-        case U'\u212D': return true;
-        case U'\u212F': return true;
-        case U'\u2130': return true;
-        case U'\u2131': return true;
-        case U'\u2132': return true;
-        case U'\u2133': return true;
-        case U'\u2134': return true;
-        case U'\u2139': return true;
-        case U'\u213C': return true;
-        case U'\u213D': return true;
-        case U'\u213E': return true;
-        case U'\u213F': return true;
-        case U'\u2145': return true;
-        case U'\u2146': return true;
-        case U'\u2147': return true;
-        case U'\u2148': return true;
-        case U'\u2149': return true;
-        case U'\u214E': return true;
-        case U'\u2160': return true;
-        case U'\u2161': return true;
-        case U'\u2162': return true;
-        case U'\u2163': return true;
-        case U'\u2164': return true;
-        case U'\u2165': return true;
-        case U'\u2166': return true;
-        case U'\u2167': return true;
-        case U'\u2168': return true;
-        case U'\u2169': return true;
-        case U'\u216A': return true;
-        case U'\u216B': return true;
-        case U'\u216C': return true;
-        case U'\u216D': return true;
-        case U'\u216E': return true;
-        case U'\u216F': return true;
-        case U'\u2170': return true;
-        case U'\u2171': return true;
-        case U'\u2172': return true;
-        case U'\u2173': return true;
-        case U'\u2174': return true;
-        case U'\u2175': return true;
-        case U'\u2176': return true;
-        case U'\u2177': return true;
-        case U'\u2178': return true;
-        case U'\u2179': return true;
-        case U'\u217A': return true;
-        case U'\u217B': return true;
-        case U'\u217C': return true;
-        case U'\u217D': return true;
-        case U'\u217E': return true;
-        case U'\u217F': return true;
-        case U'\u2183': return true;
-        case U'\u2184': return true;
-        case U'\u24B6': return true;
-        case U'\u24B7': return true;
-        case U'\u24B8': return true;
-        case U'\u24B9': return true;
-        case U'\u24BA': return true;
-        case U'\u24BB': return true;
-        case U'\u24BC': return true;
-        case U'\u24BD': return true;
-        case U'\u24BE': return true;
-        case U'\u24BF': return true;
-        case U'\u24C0': return true;
-        case U'\u24C1': return true;
-        case U'\u24C2': return true;
-        case U'\u24C3': return true;
-        case U'\u24C4': return true;
-        case U'\u24C5': return true;
-        case U'\u24C6': return true;
-        case U'\u24C7': return true;
-        case U'\u24C8': return true;
-        case U'\u24C9': return true;
-        case U'\u24CA': return true;
-        case U'\u24CB': return true;
-        case U'\u24CC': return true;
-        case U'\u24CD': return true;
-        case U'\u24CE': return true;
-        case U'\u24CF': return true;
-        case U'\u24D0': return true;
-        case U'\u24D1': return true;
-        case U'\u24D2': return true;
-        case U'\u24D3': return true;
-        case U'\u24D4': return true;
-        case U'\u24D5': return true;
-        case U'\u24D6': return true;
-        case U'\u24D7': return true;
-        case U'\u24D8': return true;
-        case U'\u24D9': return true;
-        case U'\u24DA': return true;
-        case U'\u24DB': return true;
-        case U'\u24DC': return true;
-        case U'\u24DD': return true;
-        case U'\u24DE': return true;
-        case U'\u24DF': return true;
-        case U'\u24E0': return true;
-        case U'\u24E1': return true;
-        case U'\u24E2': return true;
-        case U'\u24E3': return true;
-        case U'\u24E4': return true;
-        case U'\u24E5': return true;
-        case U'\u24E6': return true;
-        case U'\u24E7': return true;
-        case U'\u24E8': return true;
-        case U'\u24E9': return true;
-        case U'\u2C00': return true;
-        case U'\u2C01': return true;
-        case U'\u2C02': return true;
-        case U'\u2C03': return true;
-        case U'\u2C04': return true;
-        case U'\u2C05': return true;
-        case U'\u2C06': return true;
-        case U'\u2C07': return true;
-        case U'\u2C08': return true;
-        case U'\u2C09': return true;
-        case U'\u2C0A': return true;
-        case U'\u2C0B': return true;
-        case U'\u2C0C': return true;
-        case U'\u2C0D': return true;
-        case U'\u2C0E': return true;
-        case U'\u2C0F': return true;
-        case U'\u2C10': return true;
-        case U'\u2C11': return true;
-        case U'\u2C12': return true;
-        case U'\u2C13': return true;
-        case U'\u2C14': return true;
-        case U'\u2C15': return true;
-        case U'\u2C16': return true;
-        case U'\u2C17': return true;
-        case U'\u2C18': return true;
-        case U'\u2C19': return true;
-        case U'\u2C1A': return true;
-        case U'\u2C1B': return true;
-        case U'\u2C1C': return true;
-        case U'\u2C1D': return true;
-        case U'\u2C1E': return true;
-        case U'\u2C1F': return true;
-        case U'\u2C20': return true;
-        case U'\u2C21': return true;
-        case U'\u2C22': return true;
-        case U'\u2C23': return true;
-        case U'\u2C24': return true;
-        case U'\u2C25': return true;
-        case U'\u2C26': return true;
-        case U'\u2C27': return true;
-        case U'\u2C28': return true;
-        case U'\u2C29': return true;
-        case U'\u2C2A': return true;
-        case U'\u2C2B': return true;
-        case U'\u2C2C': return true;
-        case U'\u2C2D': return true;
-        case U'\u2C2E': return true;
-        case U'\u2C2F': return true;
-        case U'\u2C30': return true;
-        case U'\u2C31': return true;
-        case U'\u2C32': return true;
-        case U'\u2C33': return true;
-        case U'\u2C34': return true;
-        case U'\u2C35': return true;
-        case U'\u2C36': return true;
-        case U'\u2C37': return true;
-        case U'\u2C38': return true;
-        case U'\u2C39': return true;
-        case U'\u2C3A': return true;
-        case U'\u2C3B': return true;
-        case U'\u2C3C': return true;
-        case U'\u2C3D': return true;
-        case U'\u2C3E': return true;
-        case U'\u2C3F': return true;
-        case U'\u2C40': return true;
-        case U'\u2C41': return true;
-        case U'\u2C42': return true;
-        case U'\u2C43': return true;
-        case U'\u2C44': return true;
-        case U'\u2C45': return true;
-        case U'\u2C46': return true;
-        case U'\u2C47': return true;
-        case U'\u2C48': return true;
-        case U'\u2C49': return true;
-        case U'\u2C4A': return true;
-        case U'\u2C4B': return true;
-        case U'\u2C4C': return true;
-        case U'\u2C4D': return true;
-        case U'\u2C4E': return true;
-        case U'\u2C4F': return true;
-        case U'\u2C50': return true;
-        case U'\u2C51': return true;
-        case U'\u2C52': return true;
-        case U'\u2C53': return true;
-        case U'\u2C54': return true;
-        case U'\u2C55': return true;
-        case U'\u2C56': return true;
-        case U'\u2C57': return true;
-        case U'\u2C58': return true;
-        case U'\u2C59': return true;
-        case U'\u2C5A': return true;
-        case U'\u2C5B': return true;
-        case U'\u2C5C': return true;
-        case U'\u2C5D': return true;
-        case U'\u2C5E': return true;
-        case U'\u2C5F': return true;
-        case U'\u2C60': return true;
-        case U'\u2C61': return true;
-        case U'\u2C62': return true;
-        case U'\u2C63': return true;
-        case U'\u2C64': return true;
-        case U'\u2C65': return true;
-        case U'\u2C66': return true;
-        case U'\u2C67': return true;
-        case U'\u2C68': return true;
-        case U'\u2C69': return true;
-        case U'\u2C6A': return true;
-        case U'\u2C6B': return true;
-        case U'\u2C6C': return true;
-        case U'\u2C6D': return true;
-        case U'\u2C6E': return true;
-        case U'\u2C6F': return true;
-        case U'\u2C70': return true;
-        case U'\u2C71': return true;
-        case U'\u2C72': return true;
-        case U'\u2C73': return true;
-        case U'\u2C74': return true;
-        case U'\u2C75': return true;
-        case U'\u2C76': return true;
-        case U'\u2C77': return true;
-        case U'\u2C78': return true;
-        case U'\u2C79': return true;
-        case U'\u2C7A': return true;
-        case U'\u2C7B': return true;
-        case U'\u2C7C': return true;
-        case U'\u2C7D': return true;
-        case U'\u2C7E': return true;
-        case U'\u2C7F': return true;
-        case U'\u2C80': return true;
-        case U'\u2C81': return true;
-        case U'\u2C82': return true;
-        case U'\u2C83': return true;
-        case U'\u2C84': return true;
-        case U'\u2C85': return true;
-        case U'\u2C86': return true;
-        case U'\u2C87': return true;
-        case U'\u2C88': return true;
-        case U'\u2C89': return true;
-        case U'\u2C8A': return true;
-        case U'\u2C8B': return true;
-        case U'\u2C8C': return true;
-        case U'\u2C8D': return true;
-        case U'\u2C8E': return true;
-        case U'\u2C8F': return true;
-        case U'\u2C90': return true;
-        case U'\u2C91': return true;
-        case U'\u2C92': return true;
-        case U'\u2C93': return true;
-        case U'\u2C94': return true;
-        case U'\u2C95': return true;
-        case U'\u2C96': return true;
-        case U'\u2C97': return true;
-        case U'\u2C98': return true;
-        case U'\u2C99': return true;
-        case U'\u2C9A': return true;
-        case U'\u2C9B': return true;
-        case U'\u2C9C': return true;
-        case U'\u2C9D': return true;
-        case U'\u2C9E': return true;
-        case U'\u2C9F': return true;
-        case U'\u2CA0': return true;
-        case U'\u2CA1': return true;
-        case U'\u2CA2': return true;
-        case U'\u2CA3': return true;
-        case U'\u2CA4': return true;
-        case U'\u2CA5': return true;
-        case U'\u2CA6': return true;
-        case U'\u2CA7': return true;
-        case U'\u2CA8': return true;
-        case U'\u2CA9': return true;
-        case U'\u2CAA': return true;
-        case U'\u2CAB': return true;
-        case U'\u2CAC': return true;
-        case U'\u2CAD': return true;
-        case U'\u2CAE': return true;
-        case U'\u2CAF': return true;
-        case U'\u2CB0': return true;
-        case U'\u2CB1': return true;
-        case U'\u2CB2': return true;
-        case U'\u2CB3': return true;
-        case U'\u2CB4': return true;
-        case U'\u2CB5': return true;
-        case U'\u2CB6': return true;
-        case U'\u2CB7': return true;
-        case U'\u2CB8': return true;
-        case U'\u2CB9': return true;
-        case U'\u2CBA': return true;
-        case U'\u2CBB': return true;
-        case U'\u2CBC': return true;
-        case U'\u2CBD': return true;
-        case U'\u2CBE': return true;
-        case U'\u2CBF': return true;
-        case U'\u2CC0': return true;
-        case U'\u2CC1': return true;
-        case U'\u2CC2': return true;
-        case U'\u2CC3': return true;
-        case U'\u2CC4': return true;
-        case U'\u2CC5': return true;
-        case U'\u2CC6': return true;
-        case U'\u2CC7': return true;
-        case U'\u2CC8': return true;
-        case U'\u2CC9': return true;
-        case U'\u2CCA': return true;
-        case U'\u2CCB': return true;
-        case U'\u2CCC': return true;
-        case U'\u2CCD': return true;
-        case U'\u2CCE': return true;
-        case U'\u2CCF': return true;
-        case U'\u2CD0': return true;
-        case U'\u2CD1': return true;
-        case U'\u2CD2': return true;
-        case U'\u2CD3': return true;
-        case U'\u2CD4': return true;
-        case U'\u2CD5': return true;
-        case U'\u2CD6': return true;
-        case U'\u2CD7': return true;
-        case U'\u2CD8': return true;
-        case U'\u2CD9': return true;
-        case U'\u2CDA': return true;
-        case U'\u2CDB': return true;
-        case U'\u2CDC': return true;
-        case U'\u2CDD': return true;
-        case U'\u2CDE': return true;
-        case U'\u2CDF': return true;
-        case U'\u2CE0': return true;
-        case U'\u2CE1': return true;
-        case U'\u2CE2': return true;
-        case U'\u2CE3': return true;
-        case U'\u2CE4': return true;
-        case U'\u2CEB': return true;
-        case U'\u2CEC': return true;
-        case U'\u2CED': return true;
-        case U'\u2CEE': return true;
-        case U'\u2CF2': return true;
-        case U'\u2CF3': return true;
-        case U'\u2D00': return true;
-        case U'\u2D01': return true;
-        case U'\u2D02': return true;
-        case U'\u2D03': return true;
-        case U'\u2D04': return true;
-        case U'\u2D05': return true;
-        case U'\u2D06': return true;
-        case U'\u2D07': return true;
-        case U'\u2D08': return true;
-        case U'\u2D09': return true;
-        case U'\u2D0A': return true;
-        case U'\u2D0B': return true;
-        case U'\u2D0C': return true;
-        case U'\u2D0D': return true;
-        case U'\u2D0E': return true;
-        case U'\u2D0F': return true;
-        case U'\u2D10': return true;
-        case U'\u2D11': return true;
-        case U'\u2D12': return true;
-        case U'\u2D13': return true;
-        case U'\u2D14': return true;
-        case U'\u2D15': return true;
-        case U'\u2D16': return true;
-        case U'\u2D17': return true;
-        case U'\u2D18': return true;
-        case U'\u2D19': return true;
-        case U'\u2D1A': return true;
-        case U'\u2D1B': return true;
-        case U'\u2D1C': return true;
-        case U'\u2D1D': return true;
-        case U'\u2D1E': return true;
-        case U'\u2D1F': return true;
-        case U'\u2D20': return true;
-        case U'\u2D21': return true;
-        case U'\u2D22': return true;
-        case U'\u2D23': return true;
-        case U'\u2D24': return true;
-        case U'\u2D25': return true;
-        case U'\u2D27': return true;
-        case U'\u2D2D': return true;
-        case U'\uA640': return true;
-        case U'\uA641': return true;
-        case U'\uA642': return true;
-        case U'\uA643': return true;
-        case U'\uA644': return true;
-        case U'\uA645': return true;
-        case U'\uA646': return true;
-        case U'\uA647': return true;
-        case U'\uA648': return true;
-        case U'\uA649': return true;
-        case U'\uA64A': return true;
-        case U'\uA64B': return true;
-        case U'\uA64C': return true;
-        case U'\uA64D': return true;
-        case U'\uA64E': return true;
-        case U'\uA64F': return true;
-        case U'\uA650': return true;
-        case U'\uA651': return true;
-        case U'\uA652': return true;
-        case U'\uA653': return true;
-        case U'\uA654': return true;
-        case U'\uA655': return true;
-        case U'\uA656': return true;
-        case U'\uA657': return true;
-        case U'\uA658': return true;
-        case U'\uA659': return true;
-        case U'\uA65A': return true;
-        case U'\uA65B': return true;
-        case U'\uA65C': return true;
-        case U'\uA65D': return true;
-        case U'\uA65E': return true;
-        case U'\uA65F': return true;
-        case U'\uA660': return true;
-        case U'\uA661': return true;
-        case U'\uA662': return true;
-        case U'\uA663': return true;
-        case U'\uA664': return true;
-        case U'\uA665': return true;
-        case U'\uA666': return true;
-        case U'\uA667': return true;
-        case U'\uA668': return true;
-        case U'\uA669': return true;
-        case U'\uA66A': return true;
-        case U'\uA66B': return true;
-        case U'\uA66C': return true;
-        case U'\uA66D': return true;
-        case U'\uA680': return true;
-        case U'\uA681': return true;
-        case U'\uA682': return true;
-        case U'\uA683': return true;
-        case U'\uA684': return true;
-        case U'\uA685': return true;
-        case U'\uA686': return true;
-        case U'\uA687': return true;
-        case U'\uA688': return true;
-        case U'\uA689': return true;
-        case U'\uA68A': return true;
-        case U'\uA68B': return true;
-        case U'\uA68C': return true;
-        case U'\uA68D': return true;
-        case U'\uA68E': return true;
-        case U'\uA68F': return true;
-        case U'\uA690': return true;
-        case U'\uA691': return true;
-        case U'\uA692': return true;
-        case U'\uA693': return true;
-        case U'\uA694': return true;
-        case U'\uA695': return true;
-        case U'\uA696': return true;
-        case U'\uA697': return true;
-        case U'\uA698': return true;
-        case U'\uA699': return true;
-        case U'\uA69A': return true;
-        case U'\uA69B': return true;
-        case U'\uA69C': return true;
-        case U'\uA69D': return true;
-        case U'\uA722': return true;
-        case U'\uA723': return true;
-        case U'\uA724': return true;
-        case U'\uA725': return true;
-        case U'\uA726': return true;
-        case U'\uA727': return true;
-        case U'\uA728': return true;
-        case U'\uA729': return true;
-        case U'\uA72A': return true;
-        case U'\uA72B': return true;
-        case U'\uA72C': return true;
-        case U'\uA72D': return true;
-        case U'\uA72E': return true;
-        case U'\uA72F': return true;
-        case U'\uA730': return true;
-        case U'\uA731': return true;
-        case U'\uA732': return true;
-        case U'\uA733': return true;
-        case U'\uA734': return true;
-        case U'\uA735': return true;
-        case U'\uA736': return true;
-        case U'\uA737': return true;
-        case U'\uA738': return true;
-        case U'\uA739': return true;
-        case U'\uA73A': return true;
-        case U'\uA73B': return true;
-        case U'\uA73C': return true;
-        case U'\uA73D': return true;
-        case U'\uA73E': return true;
-        case U'\uA73F': return true;
-        case U'\uA740': return true;
-        case U'\uA741': return true;
-        case U'\uA742': return true;
-        case U'\uA743': return true;
-        case U'\uA744': return true;
-        case U'\uA745': return true;
-        case U'\uA746': return true;
-        case U'\uA747': return true;
-        case U'\uA748': return true;
-        case U'\uA749': return true;
-        case U'\uA74A': return true;
-        case U'\uA74B': return true;
-        case U'\uA74C': return true;
-        case U'\uA74D': return true;
-        case U'\uA74E': return true;
-        case U'\uA74F': return true;
-        case U'\uA750': return true;
-        case U'\uA751': return true;
-        case U'\uA752': return true;
-        case U'\uA753': return true;
-        case U'\uA754': return true;
-        case U'\uA755': return true;
-        case U'\uA756': return true;
-        case U'\uA757': return true;
-        case U'\uA758': return true;
-        case U'\uA759': return true;
-        case U'\uA75A': return true;
-        case U'\uA75B': return true;
-        case U'\uA75C': return true;
-        case U'\uA75D': return true;
-        case U'\uA75E': return true;
-        case U'\uA75F': return true;
-        case U'\uA760': return true;
-        case U'\uA761': return true;
-        case U'\uA762': return true;
-        case U'\uA763': return true;
-        case U'\uA764': return true;
-        case U'\uA765': return true;
-        case U'\uA766': return true;
-        case U'\uA767': return true;
-        case U'\uA768': return true;
-        case U'\uA769': return true;
-        case U'\uA76A': return true;
-        case U'\uA76B': return true;
-        case U'\uA76C': return true;
-        case U'\uA76D': return true;
-        case U'\uA76E': return true;
-        case U'\uA76F': return true;
-        case U'\uA770': return true;
-        case U'\uA771': return true;
-        case U'\uA772': return true;
-        case U'\uA773': return true;
-        case U'\uA774': return true;
-        case U'\uA775': return true;
-        case U'\uA776': return true;
-        case U'\uA777': return true;
-        case U'\uA778': return true;
-        case U'\uA779': return true;
-        case U'\uA77A': return true;
-        case U'\uA77B': return true;
-        case U'\uA77C': return true;
-        case U'\uA77D': return true;
-        case U'\uA77E': return true;
-        case U'\uA77F': return true;
-        case U'\uA780': return true;
-        case U'\uA781': return true;
-        case U'\uA782': return true;
-        case U'\uA783': return true;
-        case U'\uA784': return true;
-        case U'\uA785': return true;
-        case U'\uA786': return true;
-        case U'\uA787': return true;
-        case U'\uA78B': return true;
-        case U'\uA78C': return true;
-        case U'\uA78D': return true;
-        case U'\uA78E': return true;
-        case U'\uA790': return true;
-        case U'\uA791': return true;
-        case U'\uA792': return true;
-        case U'\uA793': return true;
-        case U'\uA794': return true;
-        case U'\uA795': return true;
-        case U'\uA796': return true;
-        case U'\uA797': return true;
-        case U'\uA798': return true;
-        case U'\uA799': return true;
-        case U'\uA79A': return true;
-        case U'\uA79B': return true;
-        case U'\uA79C': return true;
-        case U'\uA79D': return true;
-        case U'\uA79E': return true;
-        case U'\uA79F': return true;
-        case U'\uA7A0': return true;
-        case U'\uA7A1': return true;
-        case U'\uA7A2': return true;
-        case U'\uA7A3': return true;
-        case U'\uA7A4': return true;
-        case U'\uA7A5': return true;
-        case U'\uA7A6': return true;
-        case U'\uA7A7': return true;
-        case U'\uA7A8': return true;
-        case U'\uA7A9': return true;
-        case U'\uA7AA': return true;
-        case U'\uA7AB': return true;
-        case U'\uA7AC': return true;
-        case U'\uA7AD': return true;
-        case U'\uA7AE': return true;
-        case U'\uA7AF': return true;
-        case U'\uA7B0': return true;
-        case U'\uA7B1': return true;
-        case U'\uA7B2': return true;
-        case U'\uA7B3': return true;
-        case U'\uA7B4': return true;
-        case U'\uA7B5': return true;
-        case U'\uA7B6': return true;
-        case U'\uA7B7': return true;
-        case U'\uA7B8': return true;
-        case U'\uA7B9': return true;
-        case U'\uA7BA': return true;
-        case U'\uA7BB': return true;
-        case U'\uA7BC': return true;
-        case U'\uA7BD': return true;
-        case U'\uA7BE': return true;
-        case U'\uA7BF': return true;
-        case U'\uA7C0': return true;
-        case U'\uA7C1': return true;
-        case U'\uA7C2': return true;
-        case U'\uA7C3': return true;
-        case U'\uA7C4': return true;
-        case U'\uA7C5': return true;
-        case U'\uA7C6': return true;
-        case U'\uA7C7': return true;
-        case U'\uA7C8': return true;
-        case U'\uA7C9': return true;
-        case U'\uA7CA': return true;
-        case U'\uA7CB': return true;
-        case U'\uA7CC': return true;
-        case U'\uA7CD': return true;
-        case U'\uA7CE': return true;
-        case U'\uA7CF': return true;
-        case U'\uA7D0': return true;
-        case U'\uA7D1': return true;
-        case U'\uA7D2': return true;
-        case U'\uA7D3': return true;
-        case U'\uA7D4': return true;
-        case U'\uA7D5': return true;
-        case U'\uA7D6': return true;
-        case U'\uA7D7': return true;
-        case U'\uA7D8': return true;
-        case U'\uA7D9': return true;
-        case U'\uA7DA': return true;
-        case U'\uA7DB': return true;
-        case U'\uA7DC': return true;
-        case U'\uA7F1': return true;
-        case U'\uA7F2': return true;
-        case U'\uA7F3': return true;
-        case U'\uA7F4': return true;
-        case U'\uA7F5': return true;
-        case U'\uA7F6': return true;
-        case U'\uA7F8': return true;
-        case U'\uA7F9': return true;
-        case U'\uA7FA': return true;
-        case U'\uAB30': return true;
-        case U'\uAB31': return true;
-        case U'\uAB32': return true;
-        case U'\uAB33': return true;
-        case U'\uAB34': return true;
-        case U'\uAB35': return true;
-        case U'\uAB36': return true;
-        case U'\uAB37': return true;
-        case U'\uAB38': return true;
-        case U'\uAB39': return true;
-        case U'\uAB3A': return true;
-        case U'\uAB3B': return true;
-        case U'\uAB3C': return true;
-        case U'\uAB3D': return true;
-        case U'\uAB3E': return true;
-        case U'\uAB3F': return true;
-        case U'\uAB40': return true;
-        case U'\uAB41': return true;
-        case U'\uAB42': return true;
-        case U'\uAB43': return true;
-        case U'\uAB44': return true;
-        case U'\uAB45': return true;
-        case U'\uAB46': return true;
-        case U'\uAB47': return true;
-        case U'\uAB48': return true;
-        case U'\uAB49': return true;
-        case U'\uAB4A': return true;
-        case U'\uAB4B': return true;
-        case U'\uAB4C': return true;
-        case U'\uAB4D': return true;
-        case U'\uAB4E': return true;
-        case U'\uAB4F': return true;
-        case U'\uAB50': return true;
-        case U'\uAB51': return true;
-        case U'\uAB52': return true;
-        case U'\uAB53': return true;
-        case U'\uAB54': return true;
-        case U'\uAB55': return true;
-        case U'\uAB56': return true;
-        case U'\uAB57': return true;
-        case U'\uAB58': return true;
-        case U'\uAB59': return true;
-        case U'\uAB5A': return true;
-        case U'\uAB5C': return true;
-        case U'\uAB5D': return true;
-        case U'\uAB5E': return true;
-        case U'\uAB5F': return true;
-        case U'\uAB60': return true;
-        case U'\uAB61': return true;
-        case U'\uAB62': return true;
-        case U'\uAB63': return true;
-        case U'\uAB64': return true;
-        case U'\uAB65': return true;
-        case U'\uAB66': return true;
-        case U'\uAB67': return true;
-        case U'\uAB68': return true;
-        case U'\uAB69': return true;
-        case U'\uAB70': return true;
-        case U'\uAB71': return true;
-        case U'\uAB72': return true;
-        case U'\uAB73': return true;
-        case U'\uAB74': return true;
-        case U'\uAB75': return true;
-        case U'\uAB76': return true;
-        case U'\uAB77': return true;
-        case U'\uAB78': return true;
-        case U'\uAB79': return true;
-        case U'\uAB7A': return true;
-        case U'\uAB7B': return true;
-        case U'\uAB7C': return true;
-        case U'\uAB7D': return true;
-        case U'\uAB7E': return true;
-        case U'\uAB7F': return true;
-        case U'\uAB80': return true;
-        case U'\uAB81': return true;
-        case U'\uAB82': return true;
-        case U'\uAB83': return true;
-        case U'\uAB84': return true;
-        case U'\uAB85': return true;
-        case U'\uAB86': return true;
-        case U'\uAB87': return true;
-        case U'\uAB88': return true;
-        case U'\uAB89': return true;
-        case U'\uAB8A': return true;
-        case U'\uAB8B': return true;
-        case U'\uAB8C': return true;
-        case U'\uAB8D': return true;
-        case U'\uAB8E': return true;
-        case U'\uAB8F': return true;
-        case U'\uAB90': return true;
-        case U'\uAB91': return true;
-        case U'\uAB92': return true;
-        case U'\uAB93': return true;
-        case U'\uAB94': return true;
-        case U'\uAB95': return true;
-        case U'\uAB96': return true;
-        case U'\uAB97': return true;
-        case U'\uAB98': return true;
-        case U'\uAB99': return true;
-        case U'\uAB9A': return true;
-        case U'\uAB9B': return true;
-        case U'\uAB9C': return true;
-        case U'\uAB9D': return true;
-        case U'\uAB9E': return true;
-        case U'\uAB9F': return true;
-        case U'\uABA0': return true;
-        case U'\uABA1': return true;
-        case U'\uABA2': return true;
-        case U'\uABA3': return true;
-        case U'\uABA4': return true;
-        case U'\uABA5': return true;
-        case U'\uABA6': return true;
-        case U'\uABA7': return true;
-        case U'\uABA8': return true;
-        case U'\uABA9': return true;
-        case U'\uABAA': return true;
-        case U'\uABAB': return true;
-        case U'\uABAC': return true;
-        case U'\uABAD': return true;
-        case U'\uABAE': return true;
-        case U'\uABAF': return true;
-        case U'\uABB0': return true;
-        case U'\uABB1': return true;
-        case U'\uABB2': return true;
-        case U'\uABB3': return true;
-        case U'\uABB4': return true;
-        case U'\uABB5': return true;
-        case U'\uABB6': return true;
-        case U'\uABB7': return true;
-        case U'\uABB8': return true;
-        case U'\uABB9': return true;
-        case U'\uABBA': return true;
-        case U'\uABBB': return true;
-        case U'\uABBC': return true;
-        case U'\uABBD': return true;
-        case U'\uABBE': return true;
-        case U'\uABBF': return true;
-        case U'\uFB00': return true;
-        case U'\uFB01': return true;
-        case U'\uFB02': return true;
-        case U'\uFB03': return true;
-        case U'\uFB04': return true;
-        case U'\uFB05': return true;
-        case U'\uFB06': return true;
-        case U'\uFB13': return true;
-        case U'\uFB14': return true;
-        case U'\uFB15': return true;
-        case U'\uFB16': return true;
-        case U'\uFB17': return true;
-        case U'\uFF21': return true;
-        case U'\uFF22': return true;
-        case U'\uFF23': return true;
-        case U'\uFF24': return true;
-        case U'\uFF25': return true;
-        case U'\uFF26': return true;
-        case U'\uFF27': return true;
-        case U'\uFF28': return true;
-        case U'\uFF29': return true;
-        case U'\uFF2A': return true;
-        case U'\uFF2B': return true;
-        case U'\uFF2C': return true;
-        case U'\uFF2D': return true;
-        case U'\uFF2E': return true;
-        case U'\uFF2F': return true;
-        case U'\uFF30': return true;
-        case U'\uFF31': return true;
-        case U'\uFF32': return true;
-        case U'\uFF33': return true;
-        case U'\uFF34': return true;
-        case U'\uFF35': return true;
-        case U'\uFF36': return true;
-        case U'\uFF37': return true;
-        case U'\uFF38': return true;
-        case U'\uFF39': return true;
-        case U'\uFF3A': return true;
-        case U'\uFF41': return true;
-        case U'\uFF42': return true;
-        case U'\uFF43': return true;
-        case U'\uFF44': return true;
-        case U'\uFF45': return true;
-        case U'\uFF46': return true;
-        case U'\uFF47': return true;
-        case U'\uFF48': return true;
-        case U'\uFF49': return true;
-        case U'\uFF4A': return true;
-        case U'\uFF4B': return true;
-        case U'\uFF4C': return true;
-        case U'\uFF4D': return true;
-        case U'\uFF4E': return true;
-        case U'\uFF4F': return true;
-        case U'\uFF50': return true;
-        case U'\uFF51': return true;
-        case U'\uFF52': return true;
-        case U'\uFF53': return true;
-        case U'\uFF54': return true;
-        case U'\uFF55': return true;
-        case U'\uFF56': return true;
-        case U'\uFF57': return true;
-        case U'\uFF58': return true;
-        case U'\uFF59': return true;
-        case U'\uFF5A': return true;
-        case U'\U00010400': return true;
-        case U'\U00010401': return true;
-        case U'\U00010402': return true;
-        case U'\U00010403': return true;
-        case U'\U00010404': return true;
-        case U'\U00010405': return true;
-        case U'\U00010406': return true;
-        case U'\U00010407': return true;
-        case U'\U00010408': return true;
-        case U'\U00010409': return true;
-        case U'\U0001040A': return true;
-        case U'\U0001040B': return true;
-        case U'\U0001040C': return true;
-        case U'\U0001040D': return true;
-        case U'\U0001040E': return true;
-        case U'\U0001040F': return true;
-        case U'\U00010410': return true;
-        case U'\U00010411': return true;
-        case U'\U00010412': return true;
-        case U'\U00010413': return true;
-        case U'\U00010414': return true;
-        case U'\U00010415': return true;
-        case U'\U00010416': return true;
-        case U'\U00010417': return true;
-        case U'\U00010418': return true;
-        case U'\U00010419': return true;
-        case U'\U0001041A': return true;
-        case U'\U0001041B': return true;
-        case U'\U0001041C': return true;
-        case U'\U0001041D': return true;
-        case U'\U0001041E': return true;
-        case U'\U0001041F': return true;
-        case U'\U00010420': return true;
-        case U'\U00010421': return true;
-        case U'\U00010422': return true;
-        case U'\U00010423': return true;
-        case U'\U00010424': return true;
-        case U'\U00010425': return true;
-        case U'\U00010426': return true;
-        case U'\U00010427': return true;
-        case U'\U00010428': return true;
-        case U'\U00010429': return true;
-        case U'\U0001042A': return true;
-        case U'\U0001042B': return true;
-        case U'\U0001042C': return true;
-        case U'\U0001042D': return true;
-        case U'\U0001042E': return true;
-        case U'\U0001042F': return true;
-        case U'\U00010430': return true;
-        case U'\U00010431': return true;
-        case U'\U00010432': return true;
-        case U'\U00010433': return true;
-        case U'\U00010434': return true;
-        case U'\U00010435': return true;
-        case U'\U00010436': return true;
-        case U'\U00010437': return true;
-        case U'\U00010438': return true;
-        case U'\U00010439': return true;
-        case U'\U0001043A': return true;
-        case U'\U0001043B': return true;
-        case U'\U0001043C': return true;
-        case U'\U0001043D': return true;
-        case U'\U0001043E': return true;
-        case U'\U0001043F': return true;
-        case U'\U00010440': return true;
-        case U'\U00010441': return true;
-        case U'\U00010442': return true;
-        case U'\U00010443': return true;
-        case U'\U00010444': return true;
-        case U'\U00010445': return true;
-        case U'\U00010446': return true;
-        case U'\U00010447': return true;
-        case U'\U00010448': return true;
-        case U'\U00010449': return true;
-        case U'\U0001044A': return true;
-        case U'\U0001044B': return true;
-        case U'\U0001044C': return true;
-        case U'\U0001044D': return true;
-        case U'\U0001044E': return true;
-        case U'\U0001044F': return true;
-        case U'\U000104B0': return true;
-        case U'\U000104B1': return true;
-        case U'\U000104B2': return true;
-        case U'\U000104B3': return true;
-        case U'\U000104B4': return true;
-        case U'\U000104B5': return true;
-        case U'\U000104B6': return true;
-        case U'\U000104B7': return true;
-        case U'\U000104B8': return true;
-        case U'\U000104B9': return true;
-        case U'\U000104BA': return true;
-        case U'\U000104BB': return true;
-        case U'\U000104BC': return true;
-        case U'\U000104BD': return true;
-        case U'\U000104BE': return true;
-        case U'\U000104BF': return true;
-        case U'\U000104C0': return true;
-        case U'\U000104C1': return true;
-        case U'\U000104C2': return true;
-        case U'\U000104C3': return true;
-        case U'\U000104C4': return true;
-        case U'\U000104C5': return true;
-        case U'\U000104C6': return true;
-        case U'\U000104C7': return true;
-        case U'\U000104C8': return true;
-        case U'\U000104C9': return true;
-        case U'\U000104CA': return true;
-        case U'\U000104CB': return true;
-        case U'\U000104CC': return true;
-        case U'\U000104CD': return true;
-        case U'\U000104CE': return true;
-        case U'\U000104CF': return true;
-        case U'\U000104D0': return true;
-        case U'\U000104D1': return true;
-        case U'\U000104D2': return true;
-        case U'\U000104D3': return true;
-        case U'\U000104D8': return true;
-        case U'\U000104D9': return true;
-        case U'\U000104DA': return true;
-        case U'\U000104DB': return true;
-        case U'\U000104DC': return true;
-        case U'\U000104DD': return true;
-        case U'\U000104DE': return true;
-        case U'\U000104DF': return true;
-        case U'\U000104E0': return true;
-        case U'\U000104E1': return true;
-        case U'\U000104E2': return true;
-        case U'\U000104E3': return true;
-        case U'\U000104E4': return true;
-        case U'\U000104E5': return true;
-        case U'\U000104E6': return true;
-        case U'\U000104E7': return true;
-        case U'\U000104E8': return true;
-        case U'\U000104E9': return true;
-        case U'\U000104EA': return true;
-        case U'\U000104EB': return true;
-        case U'\U000104EC': return true;
-        case U'\U000104ED': return true;
-        case U'\U000104EE': return true;
-        case U'\U000104EF': return true;
-        case U'\U000104F0': return true;
-        case U'\U000104F1': return true;
-        case U'\U000104F2': return true;
-        case U'\U000104F3': return true;
-        case U'\U000104F4': return true;
-        case U'\U000104F5': return true;
-        case U'\U000104F6': return true;
-        case U'\U000104F7': return true;
-        case U'\U000104F8': return true;
-        case U'\U000104F9': return true;
-        case U'\U000104FA': return true;
-        case U'\U000104FB': return true;
-        case U'\U00010570': return true;
-        case U'\U00010571': return true;
-        case U'\U00010572': return true;
-        case U'\U00010573': return true;
-        case U'\U00010574': return true;
-        case U'\U00010575': return true;
-        case U'\U00010576': return true;
-        case U'\U00010577': return true;
-        case U'\U00010578': return true;
-        case U'\U00010579': return true;
-        case U'\U0001057A': return true;
-        case U'\U0001057C': return true;
-        case U'\U0001057D': return true;
-        case U'\U0001057E': return true;
-        case U'\U0001057F': return true;
-        case U'\U00010580': return true;
-        case U'\U00010581': return true;
-        case U'\U00010582': return true;
-        case U'\U00010583': return true;
-        case U'\U00010584': return true;
-        case U'\U00010585': return true;
-        case U'\U00010586': return true;
-        case U'\U00010587': return true;
-        case U'\U00010588': return true;
-        case U'\U00010589': return true;
-        case U'\U0001058A': return true;
-        case U'\U0001058C': return true;
-        case U'\U0001058D': return true;
-        case U'\U0001058E': return true;
-        case U'\U0001058F': return true;
-        case U'\U00010590': return true;
-        case U'\U00010591': return true;
-        case U'\U00010592': return true;
-        case U'\U00010594': return true;
-        case U'\U00010595': return true;
-        case U'\U00010597': return true;
-        case U'\U00010598': return true;
-        case U'\U00010599': return true;
-        case U'\U0001059A': return true;
-        case U'\U0001059B': return true;
-        case U'\U0001059C': return true;
-        case U'\U0001059D': return true;
-        case U'\U0001059E': return true;
-        case U'\U0001059F': return true;
-        case U'\U000105A0': return true;
-        case U'\U000105A1': return true;
-        case U'\U000105A3': return true;
-        case U'\U000105A4': return true;
-        case U'\U000105A5': return true;
-        case U'\U000105A6': return true;
-        case U'\U000105A7': return true;
-        case U'\U000105A8': return true;
-        case U'\U000105A9': return true;
-        case U'\U000105AA': return true;
-        case U'\U000105AB': return true;
-        case U'\U000105AC': return true;
-        case U'\U000105AD': return true;
-        case U'\U000105AE': return true;
-        case U'\U000105AF': return true;
-        case U'\U000105B0': return true;
-        case U'\U000105B1': return true;
-        case U'\U000105B3': return true;
-        case U'\U000105B4': return true;
-        case U'\U000105B5': return true;
-        case U'\U000105B6': return true;
-        case U'\U000105B7': return true;
-        case U'\U000105B8': return true;
-        case U'\U000105B9': return true;
-        case U'\U000105BB': return true;
-        case U'\U000105BC': return true;
-        case U'\U00010780': return true;
-        case U'\U00010783': return true;
-        case U'\U00010784': return true;
-        case U'\U00010785': return true;
-        case U'\U00010787': return true;
-        case U'\U00010788': return true;
-        case U'\U00010789': return true;
-        case U'\U0001078A': return true;
-        case U'\U0001078B': return true;
-        case U'\U0001078C': return true;
-        case U'\U0001078D': return true;
-        case U'\U0001078E': return true;
-        case U'\U0001078F': return true;
-        case U'\U00010790': return true;
-        case U'\U00010791': return true;
-        case U'\U00010792': return true;
-        case U'\U00010793': return true;
-        case U'\U00010794': return true;
-        case U'\U00010795': return true;
-        case U'\U00010796': return true;
-        case U'\U00010797': return true;
-        case U'\U00010798': return true;
-        case U'\U00010799': return true;
-        case U'\U0001079A': return true;
-        case U'\U0001079B': return true;
-        case U'\U0001079C': return true;
-        case U'\U0001079D': return true;
-        case U'\U0001079E': return true;
-        case U'\U0001079F': return true;
-        case U'\U000107A0': return true;
-        case U'\U000107A1': return true;
-        case U'\U000107A2': return true;
-        case U'\U000107A3': return true;
-        case U'\U000107A4': return true;
-        case U'\U000107A5': return true;
-        case U'\U000107A6': return true;
-        case U'\U000107A7': return true;
-        case U'\U000107A8': return true;
-        case U'\U000107A9': return true;
-        case U'\U000107AA': return true;
-        case U'\U000107AB': return true;
-        case U'\U000107AC': return true;
-        case U'\U000107AD': return true;
-        case U'\U000107AE': return true;
-        case U'\U000107AF': return true;
-        case U'\U000107B0': return true;
-        case U'\U000107B2': return true;
-        case U'\U000107B3': return true;
-        case U'\U000107B4': return true;
-        case U'\U000107B5': return true;
-        case U'\U000107B6': return true;
-        case U'\U000107B7': return true;
-        case U'\U000107B8': return true;
-        case U'\U000107B9': return true;
-        case U'\U000107BA': return true;
-        case U'\U00010C80': return true;
-        case U'\U00010C81': return true;
-        case U'\U00010C82': return true;
-        case U'\U00010C83': return true;
-        case U'\U00010C84': return true;
-        case U'\U00010C85': return true;
-        case U'\U00010C86': return true;
-        case U'\U00010C87': return true;
-        case U'\U00010C88': return true;
-        case U'\U00010C89': return true;
-        case U'\U00010C8A': return true;
-        case U'\U00010C8B': return true;
-        case U'\U00010C8C': return true;
-        case U'\U00010C8D': return true;
-        case U'\U00010C8E': return true;
-        case U'\U00010C8F': return true;
-        case U'\U00010C90': return true;
-        case U'\U00010C91': return true;
-        case U'\U00010C92': return true;
-        case U'\U00010C93': return true;
-        case U'\U00010C94': return true;
-        case U'\U00010C95': return true;
-        case U'\U00010C96': return true;
-        case U'\U00010C97': return true;
-        case U'\U00010C98': return true;
-        case U'\U00010C99': return true;
-        case U'\U00010C9A': return true;
-        case U'\U00010C9B': return true;
-        case U'\U00010C9C': return true;
-        case U'\U00010C9D': return true;
-        case U'\U00010C9E': return true;
-        case U'\U00010C9F': return true;
-        case U'\U00010CA0': return true;
-        case U'\U00010CA1': return true;
-        case U'\U00010CA2': return true;
-        case U'\U00010CA3': return true;
-        case U'\U00010CA4': return true;
-        case U'\U00010CA5': return true;
-        case U'\U00010CA6': return true;
-        case U'\U00010CA7': return true;
-        case U'\U00010CA8': return true;
-        case U'\U00010CA9': return true;
-        case U'\U00010CAA': return true;
-        case U'\U00010CAB': return true;
-        case U'\U00010CAC': return true;
-        case U'\U00010CAD': return true;
-        case U'\U00010CAE': return true;
-        case U'\U00010CAF': return true;
-        case U'\U00010CB0': return true;
-        case U'\U00010CB1': return true;
-        case U'\U00010CB2': return true;
-        case U'\U00010CC0': return true;
-        case U'\U00010CC1': return true;
-        case U'\U00010CC2': return true;
-        case U'\U00010CC3': return true;
-        case U'\U00010CC4': return true;
-        case U'\U00010CC5': return true;
-        case U'\U00010CC6': return true;
-        case U'\U00010CC7': return true;
-        case U'\U00010CC8': return true;
-        case U'\U00010CC9': return true;
-        case U'\U00010CCA': return true;
-        case U'\U00010CCB': return true;
-        case U'\U00010CCC': return true;
-        case U'\U00010CCD': return true;
-        case U'\U00010CCE': return true;
-        case U'\U00010CCF': return true;
-        case U'\U00010CD0': return true;
-        case U'\U00010CD1': return true;
-        case U'\U00010CD2': return true;
-        case U'\U00010CD3': return true;
-        case U'\U00010CD4': return true;
-        case U'\U00010CD5': return true;
-        case U'\U00010CD6': return true;
-        case U'\U00010CD7': return true;
-        case U'\U00010CD8': return true;
-        case U'\U00010CD9': return true;
-        case U'\U00010CDA': return true;
-        case U'\U00010CDB': return true;
-        case U'\U00010CDC': return true;
-        case U'\U00010CDD': return true;
-        case U'\U00010CDE': return true;
-        case U'\U00010CDF': return true;
-        case U'\U00010CE0': return true;
-        case U'\U00010CE1': return true;
-        case U'\U00010CE2': return true;
-        case U'\U00010CE3': return true;
-        case U'\U00010CE4': return true;
-        case U'\U00010CE5': return true;
-        case U'\U00010CE6': return true;
-        case U'\U00010CE7': return true;
-        case U'\U00010CE8': return true;
-        case U'\U00010CE9': return true;
-        case U'\U00010CEA': return true;
-        case U'\U00010CEB': return true;
-        case U'\U00010CEC': return true;
-        case U'\U00010CED': return true;
-        case U'\U00010CEE': return true;
-        case U'\U00010CEF': return true;
-        case U'\U00010CF0': return true;
-        case U'\U00010CF1': return true;
-        case U'\U00010CF2': return true;
-        case U'\U00010D50': return true;
-        case U'\U00010D51': return true;
-        case U'\U00010D52': return true;
-        case U'\U00010D53': return true;
-        case U'\U00010D54': return true;
-        case U'\U00010D55': return true;
-        case U'\U00010D56': return true;
-        case U'\U00010D57': return true;
-        case U'\U00010D58': return true;
-        case U'\U00010D59': return true;
-        case U'\U00010D5A': return true;
-        case U'\U00010D5B': return true;
-        case U'\U00010D5C': return true;
-        case U'\U00010D5D': return true;
-        case U'\U00010D5E': return true;
-        case U'\U00010D5F': return true;
-        case U'\U00010D60': return true;
-        case U'\U00010D61': return true;
-        case U'\U00010D62': return true;
-        case U'\U00010D63': return true;
-        case U'\U00010D64': return true;
-        case U'\U00010D65': return true;
-        case U'\U00010D70': return true;
-        case U'\U00010D71': return true;
-        case U'\U00010D72': return true;
-        case U'\U00010D73': return true;
-        case U'\U00010D74': return true;
-        case U'\U00010D75': return true;
-        case U'\U00010D76': return true;
-        case U'\U00010D77': return true;
-        case U'\U00010D78': return true;
-        case U'\U00010D79': return true;
-        case U'\U00010D7A': return true;
-        case U'\U00010D7B': return true;
-        case U'\U00010D7C': return true;
-        case U'\U00010D7D': return true;
-        case U'\U00010D7E': return true;
-        case U'\U00010D7F': return true;
-        case U'\U00010D80': return true;
-        case U'\U00010D81': return true;
-        case U'\U00010D82': return true;
-        case U'\U00010D83': return true;
-        case U'\U00010D84': return true;
-        case U'\U00010D85': return true;
-        case U'\U000118A0': return true;
-        case U'\U000118A1': return true;
-        case U'\U000118A2': return true;
-        case U'\U000118A3': return true;
-        case U'\U000118A4': return true;
-        case U'\U000118A5': return true;
-        case U'\U000118A6': return true;
-        case U'\U000118A7': return true;
-        case U'\U000118A8': return true;
-        case U'\U000118A9': return true;
-        case U'\U000118AA': return true;
-        case U'\U000118AB': return true;
-        case U'\U000118AC': return true;
-        case U'\U000118AD': return true;
-        case U'\U000118AE': return true;
-        case U'\U000118AF': return true;
-        case U'\U000118B0': return true;
-        case U'\U000118B1': return true;
-        case U'\U000118B2': return true;
-        case U'\U000118B3': return true;
-        case U'\U000118B4': return true;
-        case U'\U000118B5': return true;
-        case U'\U000118B6': return true;
-        case U'\U000118B7': return true;
-        case U'\U000118B8': return true;
-        case U'\U000118B9': return true;
-        case U'\U000118BA': return true;
-        case U'\U000118BB': return true;
-        case U'\U000118BC': return true;
-        case U'\U000118BD': return true;
-        case U'\U000118BE': return true;
-        case U'\U000118BF': return true;
-        case U'\U000118C0': return true;
-        case U'\U000118C1': return true;
-        case U'\U000118C2': return true;
-        case U'\U000118C3': return true;
-        case U'\U000118C4': return true;
-        case U'\U000118C5': return true;
-        case U'\U000118C6': return true;
-        case U'\U000118C7': return true;
-        case U'\U000118C8': return true;
-        case U'\U000118C9': return true;
-        case U'\U000118CA': return true;
-        case U'\U000118CB': return true;
-        case U'\U000118CC': return true;
-        case U'\U000118CD': return true;
-        case U'\U000118CE': return true;
-        case U'\U000118CF': return true;
-        case U'\U000118D0': return true;
-        case U'\U000118D1': return true;
-        case U'\U000118D2': return true;
-        case U'\U000118D3': return true;
-        case U'\U000118D4': return true;
-        case U'\U000118D5': return true;
-        case U'\U000118D6': return true;
-        case U'\U000118D7': return true;
-        case U'\U000118D8': return true;
-        case U'\U000118D9': return true;
-        case U'\U000118DA': return true;
-        case U'\U000118DB': return true;
-        case U'\U000118DC': return true;
-        case U'\U000118DD': return true;
-        case U'\U000118DE': return true;
-        case U'\U000118DF': return true;
-        case U'\U00016E40': return true;
-        case U'\U00016E41': return true;
-        case U'\U00016E42': return true;
-        case U'\U00016E43': return true;
-        case U'\U00016E44': return true;
-        case U'\U00016E45': return true;
-        case U'\U00016E46': return true;
-        case U'\U00016E47': return true;
-        case U'\U00016E48': return true;
-        case U'\U00016E49': return true;
-        case U'\U00016E4A': return true;
-        case U'\U00016E4B': return true;
-        case U'\U00016E4C': return true;
-        case U'\U00016E4D': return true;
-        case U'\U00016E4E': return true;
-        case U'\U00016E4F': return true;
-        case U'\U00016E50': return true;
-        case U'\U00016E51': return true;
-        case U'\U00016E52': return true;
-        case U'\U00016E53': return true;
-        case U'\U00016E54': return true;
-        case U'\U00016E55': return true;
-        case U'\U00016E56': return true;
-        case U'\U00016E57': return true;
-        case U'\U00016E58': return true;
-        case U'\U00016E59': return true;
-        case U'\U00016E5A': return true;
-        case U'\U00016E5B': return true;
-        case U'\U00016E5C': return true;
-        case U'\U00016E5D': return true;
-        case U'\U00016E5E': return true;
-        case U'\U00016E5F': return true;
-        case U'\U00016E60': return true;
-        case U'\U00016E61': return true;
-        case U'\U00016E62': return true;
-        case U'\U00016E63': return true;
-        case U'\U00016E64': return true;
-        case U'\U00016E65': return true;
-        case U'\U00016E66': return true;
-        case U'\U00016E67': return true;
-        case U'\U00016E68': return true;
-        case U'\U00016E69': return true;
-        case U'\U00016E6A': return true;
-        case U'\U00016E6B': return true;
-        case U'\U00016E6C': return true;
-        case U'\U00016E6D': return true;
-        case U'\U00016E6E': return true;
-        case U'\U00016E6F': return true;
-        case U'\U00016E70': return true;
-        case U'\U00016E71': return true;
-        case U'\U00016E72': return true;
-        case U'\U00016E73': return true;
-        case U'\U00016E74': return true;
-        case U'\U00016E75': return true;
-        case U'\U00016E76': return true;
-        case U'\U00016E77': return true;
-        case U'\U00016E78': return true;
-        case U'\U00016E79': return true;
-        case U'\U00016E7A': return true;
-        case U'\U00016E7B': return true;
-        case U'\U00016E7C': return true;
-        case U'\U00016E7D': return true;
-        case U'\U00016E7E': return true;
-        case U'\U00016E7F': return true;
-        case U'\U00016EA0': return true;
-        case U'\U00016EA1': return true;
-        case U'\U00016EA2': return true;
-        case U'\U00016EA3': return true;
-        case U'\U00016EA4': return true;
-        case U'\U00016EA5': return true;
-        case U'\U00016EA6': return true;
-        case U'\U00016EA7': return true;
-        case U'\U00016EA8': return true;
-        case U'\U00016EA9': return true;
-        case U'\U00016EAA': return true;
-        case U'\U00016EAB': return true;
-        case U'\U00016EAC': return true;
-        case U'\U00016EAD': return true;
-        case U'\U00016EAE': return true;
-        case U'\U00016EAF': return true;
-        case U'\U00016EB0': return true;
-        case U'\U00016EB1': return true;
-        case U'\U00016EB2': return true;
-        case U'\U00016EB3': return true;
-        case U'\U00016EB4': return true;
-        case U'\U00016EB5': return true;
-        case U'\U00016EB6': return true;
-        case U'\U00016EB7': return true;
-        case U'\U00016EB8': return true;
-        case U'\U00016EBB': return true;
-        case U'\U00016EBC': return true;
-        case U'\U00016EBD': return true;
-        case U'\U00016EBE': return true;
-        case U'\U00016EBF': return true;
-        case U'\U00016EC0': return true;
-        case U'\U00016EC1': return true;
-        case U'\U00016EC2': return true;
-        case U'\U00016EC3': return true;
-        case U'\U00016EC4': return true;
-        case U'\U00016EC5': return true;
-        case U'\U00016EC6': return true;
-        case U'\U00016EC7': return true;
-        case U'\U00016EC8': return true;
-        case U'\U00016EC9': return true;
-        case U'\U00016ECA': return true;
-        case U'\U00016ECB': return true;
-        case U'\U00016ECC': return true;
-        case U'\U00016ECD': return true;
-        case U'\U00016ECE': return true;
-        case U'\U00016ECF': return true;
-        case U'\U00016ED0': return true;
-        case U'\U00016ED1': return true;
-        case U'\U00016ED2': return true;
-        case U'\U00016ED3': return true;
-        case U'\U0001D400': return true;
-        case U'\U0001D401': return true;
-        case U'\U0001D402': return true;
-        case U'\U0001D403': return true;
-        case U'\U0001D404': return true;
-        case U'\U0001D405': return true;
-        case U'\U0001D406': return true;
-        case U'\U0001D407': return true;
-        case U'\U0001D408': return true;
-        case U'\U0001D409': return true;
-        case U'\U0001D40A': return true;
-        case U'\U0001D40B': return true;
-        case U'\U0001D40C': return true;
-        case U'\U0001D40D': return true;
-        case U'\U0001D40E': return true;
-        case U'\U0001D40F': return true;
-        case U'\U0001D410': return true;
-        case U'\U0001D411': return true;
-        case U'\U0001D412': return true;
-        case U'\U0001D413': return true;
-        case U'\U0001D414': return true;
-        case U'\U0001D415': return true;
-        case U'\U0001D416': return true;
-        case U'\U0001D417': return true;
-        case U'\U0001D418': return true;
-        case U'\U0001D419': return true;
-        case U'\U0001D41A': return true;
-        case U'\U0001D41B': return true;
-        case U'\U0001D41C': return true;
-        case U'\U0001D41D': return true;
-        case U'\U0001D41E': return true;
-        case U'\U0001D41F': return true;
-        case U'\U0001D420': return true;
-        case U'\U0001D421': return true;
-        case U'\U0001D422': return true;
-        case U'\U0001D423': return true;
-        case U'\U0001D424': return true;
-        case U'\U0001D425': return true;
-        case U'\U0001D426': return true;
-        case U'\U0001D427': return true;
-        case U'\U0001D428': return true;
-        case U'\U0001D429': return true;
-        case U'\U0001D42A': return true;
-        case U'\U0001D42B': return true;
-        case U'\U0001D42C': return true;
-        case U'\U0001D42D': return true;
-        case U'\U0001D42E': return true;
-        case U'\U0001D42F': return true;
-        case U'\U0001D430': return true;
-        case U'\U0001D431': return true;
-        case U'\U0001D432': return true;
-        case U'\U0001D433': return true;
-        case U'\U0001D434': return true;
-        case U'\U0001D435': return true;
-        case U'\U0001D436': return true;
-        case U'\U0001D437': return true;
-        case U'\U0001D438': return true;
-        case U'\U0001D439': return true;
-        case U'\U0001D43A': return true;
-        case U'\U0001D43B': return true;
-        case U'\U0001D43C': return true;
-        case U'\U0001D43D': return true;
-        case U'\U0001D43E': return true;
-        case U'\U0001D43F': return true;
-        case U'\U0001D440': return true;
-        case U'\U0001D441': return true;
-        case U'\U0001D442': return true;
-        case U'\U0001D443': return true;
-        case U'\U0001D444': return true;
-        case U'\U0001D445': return true;
-        case U'\U0001D446': return true;
-        case U'\U0001D447': return true;
-        case U'\U0001D448': return true;
-        case U'\U0001D449': return true;
-        case U'\U0001D44A': return true;
-        case U'\U0001D44B': return true;
-        case U'\U0001D44C': return true;
-        case U'\U0001D44D': return true;
-        case U'\U0001D44E': return true;
-        case U'\U0001D44F': return true;
-        case U'\U0001D450': return true;
-        case U'\U0001D451': return true;
-        case U'\U0001D452': return true;
-        case U'\U0001D453': return true;
-        case U'\U0001D454': return true;
-        case U'\U0001D456': return true;
-        case U'\U0001D457': return true;
-        case U'\U0001D458': return true;
-        case U'\U0001D459': return true;
-        case U'\U0001D45A': return true;
-        case U'\U0001D45B': return true;
-        case U'\U0001D45C': return true;
-        case U'\U0001D45D': return true;
-        case U'\U0001D45E': return true;
-        case U'\U0001D45F': return true;
-        case U'\U0001D460': return true;
-        case U'\U0001D461': return true;
-        case U'\U0001D462': return true;
-        case U'\U0001D463': return true;
-        case U'\U0001D464': return true;
-        case U'\U0001D465': return true;
-        case U'\U0001D466': return true;
-        case U'\U0001D467': return true;
-        case U'\U0001D468': return true;
-        case U'\U0001D469': return true;
-        case U'\U0001D46A': return true;
-        case U'\U0001D46B': return true;
-        case U'\U0001D46C': return true;
-        case U'\U0001D46D': return true;
-        case U'\U0001D46E': return true;
-        case U'\U0001D46F': return true;
-        case U'\U0001D470': return true;
-        case U'\U0001D471': return true;
-        case U'\U0001D472': return true;
-        case U'\U0001D473': return true;
-        case U'\U0001D474': return true;
-        case U'\U0001D475': return true;
-        case U'\U0001D476': return true;
-        case U'\U0001D477': return true;
-        case U'\U0001D478': return true;
-        case U'\U0001D479': return true;
-        case U'\U0001D47A': return true;
-        case U'\U0001D47B': return true;
-        case U'\U0001D47C': return true;
-        case U'\U0001D47D': return true;
-        case U'\U0001D47E': return true;
-        case U'\U0001D47F': return true;
-        case U'\U0001D480': return true;
-        case U'\U0001D481': return true;
-        case U'\U0001D482': return true;
-        case U'\U0001D483': return true;
-        case U'\U0001D484': return true;
-        case U'\U0001D485': return true;
-        case U'\U0001D486': return true;
-        case U'\U0001D487': return true;
-        case U'\U0001D488': return true;
-        case U'\U0001D489': return true;
-        case U'\U0001D48A': return true;
-        case U'\U0001D48B': return true;
-        case U'\U0001D48C': return true;
-        case U'\U0001D48D': return true;
-        case U'\U0001D48E': return true;
-        case U'\U0001D48F': return true;
-        case U'\U0001D490': return true;
-        case U'\U0001D491': return true;
-        case U'\U0001D492': return true;
-        case U'\U0001D493': return true;
-        case U'\U0001D494': return true;
-        case U'\U0001D495': return true;
-        case U'\U0001D496': return true;
-        case U'\U0001D497': return true;
-        case U'\U0001D498': return true;
-        case U'\U0001D499': return true;
-        case U'\U0001D49A': return true;
-        case U'\U0001D49B': return true;
-        case U'\U0001D49C': return true;
-        case U'\U0001D49E': return true;
-        case U'\U0001D49F': return true;
-        case U'\U0001D4A2': return true;
-        case U'\U0001D4A5': return true;
-        case U'\U0001D4A6': return true;
-        case U'\U0001D4A9': return true;
-        case U'\U0001D4AA': return true;
-        case U'\U0001D4AB': return true;
-        case U'\U0001D4AC': return true;
-        case U'\U0001D4AE': return true;
-        case U'\U0001D4AF': return true;
-        case U'\U0001D4B0': return true;
-        case U'\U0001D4B1': return true;
-        case U'\U0001D4B2': return true;
-        case U'\U0001D4B3': return true;
-        case U'\U0001D4B4': return true;
-        case U'\U0001D4B5': return true;
-        case U'\U0001D4B6': return true;
-        case U'\U0001D4B7': return true;
-        case U'\U0001D4B8': return true;
-        case U'\U0001D4B9': return true;
-        case U'\U0001D4BB': return true;
-        case U'\U0001D4BD': return true;
-        case U'\U0001D4BE': return true;
-        case U'\U0001D4BF': return true;
-        case U'\U0001D4C0': return true;
-        case U'\U0001D4C1': return true;
-        case U'\U0001D4C2': return true;
-        case U'\U0001D4C3': return true;
-        case U'\U0001D4C5': return true;
-        case U'\U0001D4C6': return true;
-        case U'\U0001D4C7': return true;
-        case U'\U0001D4C8': return true;
-        case U'\U0001D4C9': return true;
-        case U'\U0001D4CA': return true;
-        case U'\U0001D4CB': return true;
-        case U'\U0001D4CC': return true;
-        case U'\U0001D4CD': return true;
-        case U'\U0001D4CE': return true;
-        case U'\U0001D4CF': return true;
-        case U'\U0001D4D0': return true;
-        case U'\U0001D4D1': return true;
-        case U'\U0001D4D2': return true;
-        case U'\U0001D4D3': return true;
-        case U'\U0001D4D4': return true;
-        case U'\U0001D4D5': return true;
-        case U'\U0001D4D6': return true;
-        case U'\U0001D4D7': return true;
-        case U'\U0001D4D8': return true;
-        case U'\U0001D4D9': return true;
-        case U'\U0001D4DA': return true;
-        case U'\U0001D4DB': return true;
-        case U'\U0001D4DC': return true;
-        case U'\U0001D4DD': return true;
-        case U'\U0001D4DE': return true;
-        case U'\U0001D4DF': return true;
-        case U'\U0001D4E0': return true;
-        case U'\U0001D4E1': return true;
-        case U'\U0001D4E2': return true;
-        case U'\U0001D4E3': return true;
-        case U'\U0001D4E4': return true;
-        case U'\U0001D4E5': return true;
-        case U'\U0001D4E6': return true;
-        case U'\U0001D4E7': return true;
-        case U'\U0001D4E8': return true;
-        case U'\U0001D4E9': return true;
-        case U'\U0001D4EA': return true;
-        case U'\U0001D4EB': return true;
-        case U'\U0001D4EC': return true;
-        case U'\U0001D4ED': return true;
-        case U'\U0001D4EE': return true;
-        case U'\U0001D4EF': return true;
-        case U'\U0001D4F0': return true;
-        case U'\U0001D4F1': return true;
-        case U'\U0001D4F2': return true;
-        case U'\U0001D4F3': return true;
-        case U'\U0001D4F4': return true;
-        case U'\U0001D4F5': return true;
-        case U'\U0001D4F6': return true;
-        case U'\U0001D4F7': return true;
-        case U'\U0001D4F8': return true;
-        case U'\U0001D4F9': return true;
-        case U'\U0001D4FA': return true;
-        case U'\U0001D4FB': return true;
-        case U'\U0001D4FC': return true;
-        case U'\U0001D4FD': return true;
-        case U'\U0001D4FE': return true;
-        case U'\U0001D4FF': return true;
-        case U'\U0001D500': return true;
-        case U'\U0001D501': return true;
-        case U'\U0001D502': return true;
-        case U'\U0001D503': return true;
-        case U'\U0001D504': return true;
-        case U'\U0001D505': return true;
-        case U'\U0001D507': return true;
-        case U'\U0001D508': return true;
-        case U'\U0001D509': return true;
-        case U'\U0001D50A': return true;
-        case U'\U0001D50D': return true;
-        case U'\U0001D50E': return true;
-        case U'\U0001D50F': return true;
-        case U'\U0001D510': return true;
-        case U'\U0001D511': return true;
-        case U'\U0001D512': return true;
-        case U'\U0001D513': return true;
-        case U'\U0001D514': return true;
-        case U'\U0001D516': return true;
-        case U'\U0001D517': return true;
-        case U'\U0001D518': return true;
-        case U'\U0001D519': return true;
-        case U'\U0001D51A': return true;
-        case U'\U0001D51B': return true;
-        case U'\U0001D51C': return true;
-        case U'\U0001D51E': return true;
-        case U'\U0001D51F': return true;
-        case U'\U0001D520': return true;
-        case U'\U0001D521': return true;
-        case U'\U0001D522': return true;
-        case U'\U0001D523': return true;
-        case U'\U0001D524': return true;
-        case U'\U0001D525': return true;
-        case U'\U0001D526': return true;
-        case U'\U0001D527': return true;
-        case U'\U0001D528': return true;
-        case U'\U0001D529': return true;
-        case U'\U0001D52A': return true;
-        case U'\U0001D52B': return true;
-        case U'\U0001D52C': return true;
-        case U'\U0001D52D': return true;
-        case U'\U0001D52E': return true;
-        case U'\U0001D52F': return true;
-        case U'\U0001D530': return true;
-        case U'\U0001D531': return true;
-        case U'\U0001D532': return true;
-        case U'\U0001D533': return true;
-        case U'\U0001D534': return true;
-        case U'\U0001D535': return true;
-        case U'\U0001D536': return true;
-        case U'\U0001D537': return true;
-        case U'\U0001D538': return true;
-        case U'\U0001D539': return true;
-        case U'\U0001D53B': return true;
-        case U'\U0001D53C': return true;
-        case U'\U0001D53D': return true;
-        case U'\U0001D53E': return true;
-        case U'\U0001D540': return true;
-        case U'\U0001D541': return true;
-        case U'\U0001D542': return true;
-        case U'\U0001D543': return true;
-        case U'\U0001D544': return true;
-        case U'\U0001D546': return true;
-        case U'\U0001D54A': return true;
-        case U'\U0001D54B': return true;
-        case U'\U0001D54C': return true;
-        case U'\U0001D54D': return true;
-        case U'\U0001D54E': return true;
-        case U'\U0001D54F': return true;
-        case U'\U0001D550': return true;
-        case U'\U0001D552': return true;
-        case U'\U0001D553': return true;
-        case U'\U0001D554': return true;
-        case U'\U0001D555': return true;
-        case U'\U0001D556': return true;
-        case U'\U0001D557': return true;
-        case U'\U0001D558': return true;
-        case U'\U0001D559': return true;
-        case U'\U0001D55A': return true;
-        case U'\U0001D55B': return true;
-        case U'\U0001D55C': return true;
-        case U'\U0001D55D': return true;
-        case U'\U0001D55E': return true;
-        case U'\U0001D55F': return true;
-        case U'\U0001D560': return true;
-        case U'\U0001D561': return true;
-        case U'\U0001D562': return true;
-        case U'\U0001D563': return true;
-        case U'\U0001D564': return true;
-        case U'\U0001D565': return true;
-        case U'\U0001D566': return true;
-        case U'\U0001D567': return true;
-        case U'\U0001D568': return true;
-        case U'\U0001D569': return true;
-        case U'\U0001D56A': return true;
-        case U'\U0001D56B': return true;
-        case U'\U0001D56C': return true;
-        case U'\U0001D56D': return true;
-        case U'\U0001D56E': return true;
-        case U'\U0001D56F': return true;
-        case U'\U0001D570': return true;
-        case U'\U0001D571': return true;
-        case U'\U0001D572': return true;
-        case U'\U0001D573': return true;
-        case U'\U0001D574': return true;
-        case U'\U0001D575': return true;
-        case U'\U0001D576': return true;
-        case U'\U0001D577': return true;
-        case U'\U0001D578': return true;
-        case U'\U0001D579': return true;
-        case U'\U0001D57A': return true;
-        case U'\U0001D57B': return true;
-        case U'\U0001D57C': return true;
-        case U'\U0001D57D': return true;
-        case U'\U0001D57E': return true;
-        case U'\U0001D57F': return true;
-        case U'\U0001D580': return true;
-        case U'\U0001D581': return true;
-        case U'\U0001D582': return true;
-        case U'\U0001D583': return true;
-        case U'\U0001D584': return true;
-        case U'\U0001D585': return true;
-        case U'\U0001D586': return true;
-        case U'\U0001D587': return true;
-        case U'\U0001D588': return true;
-        case U'\U0001D589': return true;
-        case U'\U0001D58A': return true;
-        case U'\U0001D58B': return true;
-        case U'\U0001D58C': return true;
-        case U'\U0001D58D': return true;
-        case U'\U0001D58E': return true;
-        case U'\U0001D58F': return true;
-        case U'\U0001D590': return true;
-        case U'\U0001D591': return true;
-        case U'\U0001D592': return true;
-        case U'\U0001D593': return true;
-        case U'\U0001D594': return true;
-        case U'\U0001D595': return true;
-        case U'\U0001D596': return true;
-        case U'\U0001D597': return true;
-        case U'\U0001D598': return true;
-        case U'\U0001D599': return true;
-        case U'\U0001D59A': return true;
-        case U'\U0001D59B': return true;
-        case U'\U0001D59C': return true;
-        case U'\U0001D59D': return true;
-        case U'\U0001D59E': return true;
-        case U'\U0001D59F': return true;
-        case U'\U0001D5A0': return true;
-        case U'\U0001D5A1': return true;
-        case U'\U0001D5A2': return true;
-        case U'\U0001D5A3': return true;
-        case U'\U0001D5A4': return true;
-        case U'\U0001D5A5': return true;
-        case U'\U0001D5A6': return true;
-        case U'\U0001D5A7': return true;
-        case U'\U0001D5A8': return true;
-        case U'\U0001D5A9': return true;
-        case U'\U0001D5AA': return true;
-        case U'\U0001D5AB': return true;
-        case U'\U0001D5AC': return true;
-        case U'\U0001D5AD': return true;
-        case U'\U0001D5AE': return true;
-        case U'\U0001D5AF': return true;
-        case U'\U0001D5B0': return true;
-        case U'\U0001D5B1': return true;
-        case U'\U0001D5B2': return true;
-        case U'\U0001D5B3': return true;
-        case U'\U0001D5B4': return true;
-        case U'\U0001D5B5': return true;
-        case U'\U0001D5B6': return true;
-        case U'\U0001D5B7': return true;
-        case U'\U0001D5B8': return true;
-        case U'\U0001D5B9': return true;
-        case U'\U0001D5BA': return true;
-        case U'\U0001D5BB': return true;
-        case U'\U0001D5BC': return true;
-        case U'\U0001D5BD': return true;
-        case U'\U0001D5BE': return true;
-        case U'\U0001D5BF': return true;
-        case U'\U0001D5C0': return true;
-        case U'\U0001D5C1': return true;
-        case U'\U0001D5C2': return true;
-        case U'\U0001D5C3': return true;
-        case U'\U0001D5C4': return true;
-        case U'\U0001D5C5': return true;
-        case U'\U0001D5C6': return true;
-        case U'\U0001D5C7': return true;
-        case U'\U0001D5C8': return true;
-        case U'\U0001D5C9': return true;
-        case U'\U0001D5CA': return true;
-        case U'\U0001D5CB': return true;
-        case U'\U0001D5CC': return true;
-        case U'\U0001D5CD': return true;
-        case U'\U0001D5CE': return true;
-        case U'\U0001D5CF': return true;
-        case U'\U0001D5D0': return true;
-        case U'\U0001D5D1': return true;
-        case U'\U0001D5D2': return true;
-        case U'\U0001D5D3': return true;
-        case U'\U0001D5D4': return true;
-        case U'\U0001D5D5': return true;
-        case U'\U0001D5D6': return true;
-        case U'\U0001D5D7': return true;
-        case U'\U0001D5D8': return true;
-        case U'\U0001D5D9': return true;
-        case U'\U0001D5DA': return true;
-        case U'\U0001D5DB': return true;
-        case U'\U0001D5DC': return true;
-        case U'\U0001D5DD': return true;
-        case U'\U0001D5DE': return true;
-        case U'\U0001D5DF': return true;
-        case U'\U0001D5E0': return true;
-        case U'\U0001D5E1': return true;
-        case U'\U0001D5E2': return true;
-        case U'\U0001D5E3': return true;
-        case U'\U0001D5E4': return true;
-        case U'\U0001D5E5': return true;
-        case U'\U0001D5E6': return true;
-        case U'\U0001D5E7': return true;
-        case U'\U0001D5E8': return true;
-        case U'\U0001D5E9': return true;
-        case U'\U0001D5EA': return true;
-        case U'\U0001D5EB': return true;
-        case U'\U0001D5EC': return true;
-        case U'\U0001D5ED': return true;
-        case U'\U0001D5EE': return true;
-        case U'\U0001D5EF': return true;
-        case U'\U0001D5F0': return true;
-        case U'\U0001D5F1': return true;
-        case U'\U0001D5F2': return true;
-        case U'\U0001D5F3': return true;
-        case U'\U0001D5F4': return true;
-        case U'\U0001D5F5': return true;
-        case U'\U0001D5F6': return true;
-        case U'\U0001D5F7': return true;
-        case U'\U0001D5F8': return true;
-        case U'\U0001D5F9': return true;
-        case U'\U0001D5FA': return true;
-        case U'\U0001D5FB': return true;
-        case U'\U0001D5FC': return true;
-        case U'\U0001D5FD': return true;
-        case U'\U0001D5FE': return true;
-        case U'\U0001D5FF': return true;
-        case U'\U0001D600': return true;
-        case U'\U0001D601': return true;
-        case U'\U0001D602': return true;
-        case U'\U0001D603': return true;
-        case U'\U0001D604': return true;
-        case U'\U0001D605': return true;
-        case U'\U0001D606': return true;
-        case U'\U0001D607': return true;
-        case U'\U0001D608': return true;
-        case U'\U0001D609': return true;
-        case U'\U0001D60A': return true;
-        case U'\U0001D60B': return true;
-        case U'\U0001D60C': return true;
-        case U'\U0001D60D': return true;
-        case U'\U0001D60E': return true;
-        case U'\U0001D60F': return true;
-        case U'\U0001D610': return true;
-        case U'\U0001D611': return true;
-        case U'\U0001D612': return true;
-        case U'\U0001D613': return true;
-        case U'\U0001D614': return true;
-        case U'\U0001D615': return true;
-        case U'\U0001D616': return true;
-        case U'\U0001D617': return true;
-        case U'\U0001D618': return true;
-        case U'\U0001D619': return true;
-        case U'\U0001D61A': return true;
-        case U'\U0001D61B': return true;
-        case U'\U0001D61C': return true;
-        case U'\U0001D61D': return true;
-        case U'\U0001D61E': return true;
-        case U'\U0001D61F': return true;
-        case U'\U0001D620': return true;
-        case U'\U0001D621': return true;
-        case U'\U0001D622': return true;
-        case U'\U0001D623': return true;
-        case U'\U0001D624': return true;
-        case U'\U0001D625': return true;
-        case U'\U0001D626': return true;
-        case U'\U0001D627': return true;
-        case U'\U0001D628': return true;
-        case U'\U0001D629': return true;
-        case U'\U0001D62A': return true;
-        case U'\U0001D62B': return true;
-        case U'\U0001D62C': return true;
-        case U'\U0001D62D': return true;
-        case U'\U0001D62E': return true;
-        case U'\U0001D62F': return true;
-        case U'\U0001D630': return true;
-        case U'\U0001D631': return true;
-        case U'\U0001D632': return true;
-        case U'\U0001D633': return true;
-        case U'\U0001D634': return true;
-        case U'\U0001D635': return true;
-        case U'\U0001D636': return true;
-        case U'\U0001D637': return true;
-        case U'\U0001D638': return true;
-        case U'\U0001D639': return true;
-        case U'\U0001D63A': return true;
-        case U'\U0001D63B': return true;
-        case U'\U0001D63C': return true;
-        case U'\U0001D63D': return true;
-        case U'\U0001D63E': return true;
-        case U'\U0001D63F': return true;
-        case U'\U0001D640': return true;
-        case U'\U0001D641': return true;
-        case U'\U0001D642': return true;
-        case U'\U0001D643': return true;
-        case U'\U0001D644': return true;
-        case U'\U0001D645': return true;
-        case U'\U0001D646': return true;
-        case U'\U0001D647': return true;
-        case U'\U0001D648': return true;
-        case U'\U0001D649': return true;
-        case U'\U0001D64A': return true;
-        case U'\U0001D64B': return true;
-        case U'\U0001D64C': return true;
-        case U'\U0001D64D': return true;
-        case U'\U0001D64E': return true;
-        case U'\U0001D64F': return true;
-        case U'\U0001D650': return true;
-        case U'\U0001D651': return true;
-        case U'\U0001D652': return true;
-        case U'\U0001D653': return true;
-        case U'\U0001D654': return true;
-        case U'\U0001D655': return true;
-        case U'\U0001D656': return true;
-        case U'\U0001D657': return true;
-        case U'\U0001D658': return true;
-        case U'\U0001D659': return true;
-        case U'\U0001D65A': return true;
-        case U'\U0001D65B': return true;
-        case U'\U0001D65C': return true;
-        case U'\U0001D65D': return true;
-        case U'\U0001D65E': return true;
-        case U'\U0001D65F': return true;
-        case U'\U0001D660': return true;
-        case U'\U0001D661': return true;
-        case U'\U0001D662': return true;
-        case U'\U0001D663': return true;
-        case U'\U0001D664': return true;
-        case U'\U0001D665': return true;
-        case U'\U0001D666': return true;
-        case U'\U0001D667': return true;
-        case U'\U0001D668': return true;
-        case U'\U0001D669': return true;
-        case U'\U0001D66A': return true;
-        case U'\U0001D66B': return true;
-        case U'\U0001D66C': return true;
-        case U'\U0001D66D': return true;
-        case U'\U0001D66E': return true;
-        case U'\U0001D66F': return true;
-        case U'\U0001D670': return true;
-        case U'\U0001D671': return true;
-        case U'\U0001D672': return true;
-        case U'\U0001D673': return true;
-        case U'\U0001D674': return true;
-        case U'\U0001D675': return true;
-        case U'\U0001D676': return true;
-        case U'\U0001D677': return true;
-        case U'\U0001D678': return true;
-        case U'\U0001D679': return true;
-        case U'\U0001D67A': return true;
-        case U'\U0001D67B': return true;
-        case U'\U0001D67C': return true;
-        case U'\U0001D67D': return true;
-        case U'\U0001D67E': return true;
-        case U'\U0001D67F': return true;
-        case U'\U0001D680': return true;
-        case U'\U0001D681': return true;
-        case U'\U0001D682': return true;
-        case U'\U0001D683': return true;
-        case U'\U0001D684': return true;
-        case U'\U0001D685': return true;
-        case U'\U0001D686': return true;
-        case U'\U0001D687': return true;
-        case U'\U0001D688': return true;
-        case U'\U0001D689': return true;
-        case U'\U0001D68A': return true;
-        case U'\U0001D68B': return true;
-        case U'\U0001D68C': return true;
-        case U'\U0001D68D': return true;
-        case U'\U0001D68E': return true;
-        case U'\U0001D68F': return true;
-        case U'\U0001D690': return true;
-        case U'\U0001D691': return true;
-        case U'\U0001D692': return true;
-        case U'\U0001D693': return true;
-        case U'\U0001D694': return true;
-        case U'\U0001D695': return true;
-        case U'\U0001D696': return true;
-        case U'\U0001D697': return true;
-        case U'\U0001D698': return true;
-        case U'\U0001D699': return true;
-        case U'\U0001D69A': return true;
-        case U'\U0001D69B': return true;
-        case U'\U0001D69C': return true;
-        case U'\U0001D69D': return true;
-        case U'\U0001D69E': return true;
-        case U'\U0001D69F': return true;
-        case U'\U0001D6A0': return true;
-        case U'\U0001D6A1': return true;
-        case U'\U0001D6A2': return true;
-        case U'\U0001D6A3': return true;
-        case U'\U0001D6A4': return true;
-        case U'\U0001D6A5': return true;
-        case U'\U0001D6A8': return true;
-        case U'\U0001D6A9': return true;
-        case U'\U0001D6AA': return true;
-        case U'\U0001D6AB': return true;
-        case U'\U0001D6AC': return true;
-        case U'\U0001D6AD': return true;
-        case U'\U0001D6AE': return true;
-        case U'\U0001D6AF': return true;
-        case U'\U0001D6B0': return true;
-        case U'\U0001D6B1': return true;
-        case U'\U0001D6B2': return true;
-        case U'\U0001D6B3': return true;
-        case U'\U0001D6B4': return true;
-        case U'\U0001D6B5': return true;
-        case U'\U0001D6B6': return true;
-        case U'\U0001D6B7': return true;
-        case U'\U0001D6B8': return true;
-        case U'\U0001D6B9': return true;
-        case U'\U0001D6BA': return true;
-        case U'\U0001D6BB': return true;
-        case U'\U0001D6BC': return true;
-        case U'\U0001D6BD': return true;
-        case U'\U0001D6BE': return true;
-        case U'\U0001D6BF': return true;
-        case U'\U0001D6C0': return true;
-        case U'\U0001D6C2': return true;
-        case U'\U0001D6C3': return true;
-        case U'\U0001D6C4': return true;
-        case U'\U0001D6C5': return true;
-        case U'\U0001D6C6': return true;
-        case U'\U0001D6C7': return true;
-        case U'\U0001D6C8': return true;
-        case U'\U0001D6C9': return true;
-        case U'\U0001D6CA': return true;
-        case U'\U0001D6CB': return true;
-        case U'\U0001D6CC': return true;
-        case U'\U0001D6CD': return true;
-        case U'\U0001D6CE': return true;
-        case U'\U0001D6CF': return true;
-        case U'\U0001D6D0': return true;
-        case U'\U0001D6D1': return true;
-        case U'\U0001D6D2': return true;
-        case U'\U0001D6D3': return true;
-        case U'\U0001D6D4': return true;
-        case U'\U0001D6D5': return true;
-        case U'\U0001D6D6': return true;
-        case U'\U0001D6D7': return true;
-        case U'\U0001D6D8': return true;
-        case U'\U0001D6D9': return true;
-        case U'\U0001D6DA': return true;
-        case U'\U0001D6DC': return true;
-        case U'\U0001D6DD': return true;
-        case U'\U0001D6DE': return true;
-        case U'\U0001D6DF': return true;
-        case U'\U0001D6E0': return true;
-        case U'\U0001D6E1': return true;
-        case U'\U0001D6E2': return true;
-        case U'\U0001D6E3': return true;
-        case U'\U0001D6E4': return true;
-        case U'\U0001D6E5': return true;
-        case U'\U0001D6E6': return true;
-        case U'\U0001D6E7': return true;
-        case U'\U0001D6E8': return true;
-        case U'\U0001D6E9': return true;
-        case U'\U0001D6EA': return true;
-        case U'\U0001D6EB': return true;
-        case U'\U0001D6EC': return true;
-        case U'\U0001D6ED': return true;
-        case U'\U0001D6EE': return true;
-        case U'\U0001D6EF': return true;
-        case U'\U0001D6F0': return true;
-        case U'\U0001D6F1': return true;
-        case U'\U0001D6F2': return true;
-        case U'\U0001D6F3': return true;
-        case U'\U0001D6F4': return true;
-        case U'\U0001D6F5': return true;
-        case U'\U0001D6F6': return true;
-        case U'\U0001D6F7': return true;
-        case U'\U0001D6F8': return true;
-        case U'\U0001D6F9': return true;
-        case U'\U0001D6FA': return true;
-        case U'\U0001D6FC': return true;
-        case U'\U0001D6FD': return true;
-        case U'\U0001D6FE': return true;
-        case U'\U0001D6FF': return true;
-        case U'\U0001D700': return true;
-        case U'\U0001D701': return true;
-        case U'\U0001D702': return true;
-        case U'\U0001D703': return true;
-        case U'\U0001D704': return true;
-        case U'\U0001D705': return true;
-        case U'\U0001D706': return true;
-        case U'\U0001D707': return true;
-        case U'\U0001D708': return true;
-        case U'\U0001D709': return true;
-        case U'\U0001D70A': return true;
-        case U'\U0001D70B': return true;
-        case U'\U0001D70C': return true;
-        case U'\U0001D70D': return true;
-        case U'\U0001D70E': return true;
-        case U'\U0001D70F': return true;
-        case U'\U0001D710': return true;
-        case U'\U0001D711': return true;
-        case U'\U0001D712': return true;
-        case U'\U0001D713': return true;
-        case U'\U0001D714': return true;
-        case U'\U0001D716': return true;
-        case U'\U0001D717': return true;
-        case U'\U0001D718': return true;
-        case U'\U0001D719': return true;
-        case U'\U0001D71A': return true;
-        case U'\U0001D71B': return true;
-        case U'\U0001D71C': return true;
-        case U'\U0001D71D': return true;
-        case U'\U0001D71E': return true;
-        case U'\U0001D71F': return true;
-        case U'\U0001D720': return true;
-        case U'\U0001D721': return true;
-        case U'\U0001D722': return true;
-        case U'\U0001D723': return true;
-        case U'\U0001D724': return true;
-        case U'\U0001D725': return true;
-        case U'\U0001D726': return true;
-        case U'\U0001D727': return true;
-        case U'\U0001D728': return true;
-        case U'\U0001D729': return true;
-        case U'\U0001D72A': return true;
-        case U'\U0001D72B': return true;
-        case U'\U0001D72C': return true;
-        case U'\U0001D72D': return true;
-        case U'\U0001D72E': return true;
-        case U'\U0001D72F': return true;
-        case U'\U0001D730': return true;
-        case U'\U0001D731': return true;
-        case U'\U0001D732': return true;
-        case U'\U0001D733': return true;
-        case U'\U0001D734': return true;
-        case U'\U0001D736': return true;
-        case U'\U0001D737': return true;
-        case U'\U0001D738': return true;
-        case U'\U0001D739': return true;
-        case U'\U0001D73A': return true;
-        case U'\U0001D73B': return true;
-        case U'\U0001D73C': return true;
-        case U'\U0001D73D': return true;
-        case U'\U0001D73E': return true;
-        case U'\U0001D73F': return true;
-        case U'\U0001D740': return true;
-        case U'\U0001D741': return true;
-        case U'\U0001D742': return true;
-        case U'\U0001D743': return true;
-        case U'\U0001D744': return true;
-        case U'\U0001D745': return true;
-        case U'\U0001D746': return true;
-        case U'\U0001D747': return true;
-        case U'\U0001D748': return true;
-        case U'\U0001D749': return true;
-        case U'\U0001D74A': return true;
-        case U'\U0001D74B': return true;
-        case U'\U0001D74C': return true;
-        case U'\U0001D74D': return true;
-        case U'\U0001D74E': return true;
-        case U'\U0001D750': return true;
-        case U'\U0001D751': return true;
-        case U'\U0001D752': return true;
-        case U'\U0001D753': return true;
-        case U'\U0001D754': return true;
-        case U'\U0001D755': return true;
-        case U'\U0001D756': return true;
-        case U'\U0001D757': return true;
-        case U'\U0001D758': return true;
-        case U'\U0001D759': return true;
-        case U'\U0001D75A': return true;
-        case U'\U0001D75B': return true;
-        case U'\U0001D75C': return true;
-        case U'\U0001D75D': return true;
-        case U'\U0001D75E': return true;
-        case U'\U0001D75F': return true;
-        case U'\U0001D760': return true;
-        case U'\U0001D761': return true;
-        case U'\U0001D762': return true;
-        case U'\U0001D763': return true;
-        case U'\U0001D764': return true;
-        case U'\U0001D765': return true;
-        case U'\U0001D766': return true;
-        case U'\U0001D767': return true;
-        case U'\U0001D768': return true;
-        case U'\U0001D769': return true;
-        case U'\U0001D76A': return true;
-        case U'\U0001D76B': return true;
-        case U'\U0001D76C': return true;
-        case U'\U0001D76D': return true;
-        case U'\U0001D76E': return true;
-        case U'\U0001D770': return true;
-        case U'\U0001D771': return true;
-        case U'\U0001D772': return true;
-        case U'\U0001D773': return true;
-        case U'\U0001D774': return true;
-        case U'\U0001D775': return true;
-        case U'\U0001D776': return true;
-        case U'\U0001D777': return true;
-        case U'\U0001D778': return true;
-        case U'\U0001D779': return true;
-        case U'\U0001D77A': return true;
-        case U'\U0001D77B': return true;
-        case U'\U0001D77C': return true;
-        case U'\U0001D77D': return true;
-        case U'\U0001D77E': return true;
-        case U'\U0001D77F': return true;
-        case U'\U0001D780': return true;
-        case U'\U0001D781': return true;
-        case U'\U0001D782': return true;
-        case U'\U0001D783': return true;
-        case U'\U0001D784': return true;
-        case U'\U0001D785': return true;
-        case U'\U0001D786': return true;
-        case U'\U0001D787': return true;
-        case U'\U0001D788': return true;
-        case U'\U0001D78A': return true;
-        case U'\U0001D78B': return true;
-        case U'\U0001D78C': return true;
-        case U'\U0001D78D': return true;
-        case U'\U0001D78E': return true;
-        case U'\U0001D78F': return true;
-        case U'\U0001D790': return true;
-        case U'\U0001D791': return true;
-        case U'\U0001D792': return true;
-        case U'\U0001D793': return true;
-        case U'\U0001D794': return true;
-        case U'\U0001D795': return true;
-        case U'\U0001D796': return true;
-        case U'\U0001D797': return true;
-        case U'\U0001D798': return true;
-        case U'\U0001D799': return true;
-        case U'\U0001D79A': return true;
-        case U'\U0001D79B': return true;
-        case U'\U0001D79C': return true;
-        case U'\U0001D79D': return true;
-        case U'\U0001D79E': return true;
-        case U'\U0001D79F': return true;
-        case U'\U0001D7A0': return true;
-        case U'\U0001D7A1': return true;
-        case U'\U0001D7A2': return true;
-        case U'\U0001D7A3': return true;
-        case U'\U0001D7A4': return true;
-        case U'\U0001D7A5': return true;
-        case U'\U0001D7A6': return true;
-        case U'\U0001D7A7': return true;
-        case U'\U0001D7A8': return true;
-        case U'\U0001D7AA': return true;
-        case U'\U0001D7AB': return true;
-        case U'\U0001D7AC': return true;
-        case U'\U0001D7AD': return true;
-        case U'\U0001D7AE': return true;
-        case U'\U0001D7AF': return true;
-        case U'\U0001D7B0': return true;
-        case U'\U0001D7B1': return true;
-        case U'\U0001D7B2': return true;
-        case U'\U0001D7B3': return true;
-        case U'\U0001D7B4': return true;
-        case U'\U0001D7B5': return true;
-        case U'\U0001D7B6': return true;
-        case U'\U0001D7B7': return true;
-        case U'\U0001D7B8': return true;
-        case U'\U0001D7B9': return true;
-        case U'\U0001D7BA': return true;
-        case U'\U0001D7BB': return true;
-        case U'\U0001D7BC': return true;
-        case U'\U0001D7BD': return true;
-        case U'\U0001D7BE': return true;
-        case U'\U0001D7BF': return true;
-        case U'\U0001D7C0': return true;
-        case U'\U0001D7C1': return true;
-        case U'\U0001D7C2': return true;
-        case U'\U0001D7C4': return true;
-        case U'\U0001D7C5': return true;
-        case U'\U0001D7C6': return true;
-        case U'\U0001D7C7': return true;
-        case U'\U0001D7C8': return true;
-        case U'\U0001D7C9': return true;
-        case U'\U0001D7CA': return true;
-        case U'\U0001D7CB': return true;
-        case U'\U0001DF00': return true;
-        case U'\U0001DF01': return true;
-        case U'\U0001DF02': return true;
-        case U'\U0001DF03': return true;
-        case U'\U0001DF04': return true;
-        case U'\U0001DF05': return true;
-        case U'\U0001DF06': return true;
-        case U'\U0001DF07': return true;
-        case U'\U0001DF08': return true;
-        case U'\U0001DF09': return true;
-        case U'\U0001DF0B': return true;
-        case U'\U0001DF0C': return true;
-        case U'\U0001DF0D': return true;
-        case U'\U0001DF0E': return true;
-        case U'\U0001DF0F': return true;
-        case U'\U0001DF10': return true;
-        case U'\U0001DF11': return true;
-        case U'\U0001DF12': return true;
-        case U'\U0001DF13': return true;
-        case U'\U0001DF14': return true;
-        case U'\U0001DF15': return true;
-        case U'\U0001DF16': return true;
-        case U'\U0001DF17': return true;
-        case U'\U0001DF18': return true;
-        case U'\U0001DF19': return true;
-        case U'\U0001DF1A': return true;
-        case U'\U0001DF1B': return true;
-        case U'\U0001DF1C': return true;
-        case U'\U0001DF1D': return true;
-        case U'\U0001DF1E': return true;
-        case U'\U0001DF25': return true;
-        case U'\U0001DF26': return true;
-        case U'\U0001DF27': return true;
-        case U'\U0001DF28': return true;
-        case U'\U0001DF29': return true;
-        case U'\U0001DF2A': return true;
-        case U'\U0001E030': return true;
-        case U'\U0001E031': return true;
-        case U'\U0001E032': return true;
-        case U'\U0001E033': return true;
-        case U'\U0001E034': return true;
-        case U'\U0001E035': return true;
-        case U'\U0001E036': return true;
-        case U'\U0001E037': return true;
-        case U'\U0001E038': return true;
-        case U'\U0001E039': return true;
-        case U'\U0001E03A': return true;
-        case U'\U0001E03B': return true;
-        case U'\U0001E03C': return true;
-        case U'\U0001E03D': return true;
-        case U'\U0001E03E': return true;
-        case U'\U0001E03F': return true;
-        case U'\U0001E040': return true;
-        case U'\U0001E041': return true;
-        case U'\U0001E042': return true;
-        case U'\U0001E043': return true;
-        case U'\U0001E044': return true;
-        case U'\U0001E045': return true;
-        case U'\U0001E046': return true;
-        case U'\U0001E047': return true;
-        case U'\U0001E048': return true;
-        case U'\U0001E049': return true;
-        case U'\U0001E04A': return true;
-        case U'\U0001E04B': return true;
-        case U'\U0001E04C': return true;
-        case U'\U0001E04D': return true;
-        case U'\U0001E04E': return true;
-        case U'\U0001E04F': return true;
-        case U'\U0001E050': return true;
-        case U'\U0001E051': return true;
-        case U'\U0001E052': return true;
-        case U'\U0001E053': return true;
-        case U'\U0001E054': return true;
-        case U'\U0001E055': return true;
-        case U'\U0001E056': return true;
-        case U'\U0001E057': return true;
-        case U'\U0001E058': return true;
-        case U'\U0001E059': return true;
-        case U'\U0001E05A': return true;
-        case U'\U0001E05B': return true;
-        case U'\U0001E05C': return true;
-        case U'\U0001E05D': return true;
-        case U'\U0001E05E': return true;
-        case U'\U0001E05F': return true;
-        case U'\U0001E060': return true;
-        case U'\U0001E061': return true;
-        case U'\U0001E062': return true;
-        case U'\U0001E063': return true;
-        case U'\U0001E064': return true;
-        case U'\U0001E065': return true;
-        case U'\U0001E066': return true;
-        case U'\U0001E067': return true;
-        case U'\U0001E068': return true;
-        case U'\U0001E069': return true;
-        case U'\U0001E06A': return true;
-        case U'\U0001E06B': return true;
-        case U'\U0001E06C': return true;
-        case U'\U0001E06D': return true;
-        case U'\U0001E900': return true;
-        case U'\U0001E901': return true;
-        case U'\U0001E902': return true;
-        case U'\U0001E903': return true;
-        case U'\U0001E904': return true;
-        case U'\U0001E905': return true;
-        case U'\U0001E906': return true;
-        case U'\U0001E907': return true;
-        case U'\U0001E908': return true;
-        case U'\U0001E909': return true;
-        case U'\U0001E90A': return true;
-        case U'\U0001E90B': return true;
-        case U'\U0001E90C': return true;
-        case U'\U0001E90D': return true;
-        case U'\U0001E90E': return true;
-        case U'\U0001E90F': return true;
-        case U'\U0001E910': return true;
-        case U'\U0001E911': return true;
-        case U'\U0001E912': return true;
-        case U'\U0001E913': return true;
-        case U'\U0001E914': return true;
-        case U'\U0001E915': return true;
-        case U'\U0001E916': return true;
-        case U'\U0001E917': return true;
-        case U'\U0001E918': return true;
-        case U'\U0001E919': return true;
-        case U'\U0001E91A': return true;
-        case U'\U0001E91B': return true;
-        case U'\U0001E91C': return true;
-        case U'\U0001E91D': return true;
-        case U'\U0001E91E': return true;
-        case U'\U0001E91F': return true;
-        case U'\U0001E920': return true;
-        case U'\U0001E921': return true;
-        case U'\U0001E922': return true;
-        case U'\U0001E923': return true;
-        case U'\U0001E924': return true;
-        case U'\U0001E925': return true;
-        case U'\U0001E926': return true;
-        case U'\U0001E927': return true;
-        case U'\U0001E928': return true;
-        case U'\U0001E929': return true;
-        case U'\U0001E92A': return true;
-        case U'\U0001E92B': return true;
-        case U'\U0001E92C': return true;
-        case U'\U0001E92D': return true;
-        case U'\U0001E92E': return true;
-        case U'\U0001E92F': return true;
-        case U'\U0001E930': return true;
-        case U'\U0001E931': return true;
-        case U'\U0001E932': return true;
-        case U'\U0001E933': return true;
-        case U'\U0001E934': return true;
-        case U'\U0001E935': return true;
-        case U'\U0001E936': return true;
-        case U'\U0001E937': return true;
-        case U'\U0001E938': return true;
-        case U'\U0001E939': return true;
-        case U'\U0001E93A': return true;
-        case U'\U0001E93B': return true;
-        case U'\U0001E93C': return true;
-        case U'\U0001E93D': return true;
-        case U'\U0001E93E': return true;
-        case U'\U0001E93F': return true;
-        case U'\U0001E940': return true;
-        case U'\U0001E941': return true;
-        case U'\U0001E942': return true;
-        case U'\U0001E943': return true;
-        case U'\U0001F130': return true;
-        case U'\U0001F131': return true;
-        case U'\U0001F132': return true;
-        case U'\U0001F133': return true;
-        case U'\U0001F134': return true;
-        case U'\U0001F135': return true;
-        case U'\U0001F136': return true;
-        case U'\U0001F137': return true;
-        case U'\U0001F138': return true;
-        case U'\U0001F139': return true;
-        case U'\U0001F13A': return true;
-        case U'\U0001F13B': return true;
-        case U'\U0001F13C': return true;
-        case U'\U0001F13D': return true;
-        case U'\U0001F13E': return true;
-        case U'\U0001F13F': return true;
-        case U'\U0001F140': return true;
-        case U'\U0001F141': return true;
-        case U'\U0001F142': return true;
-        case U'\U0001F143': return true;
-        case U'\U0001F144': return true;
-        case U'\U0001F145': return true;
-        case U'\U0001F146': return true;
-        case U'\U0001F147': return true;
-        case U'\U0001F148': return true;
-        case U'\U0001F149': return true;
-        case U'\U0001F150': return true;
-        case U'\U0001F151': return true;
-        case U'\U0001F152': return true;
-        case U'\U0001F153': return true;
-        case U'\U0001F154': return true;
-        case U'\U0001F155': return true;
-        case U'\U0001F156': return true;
-        case U'\U0001F157': return true;
-        case U'\U0001F158': return true;
-        case U'\U0001F159': return true;
-        case U'\U0001F15A': return true;
-        case U'\U0001F15B': return true;
-        case U'\U0001F15C': return true;
-        case U'\U0001F15D': return true;
-        case U'\U0001F15E': return true;
-        case U'\U0001F15F': return true;
-        case U'\U0001F160': return true;
-        case U'\U0001F161': return true;
-        case U'\U0001F162': return true;
-        case U'\U0001F163': return true;
-        case U'\U0001F164': return true;
-        case U'\U0001F165': return true;
-        case U'\U0001F166': return true;
-        case U'\U0001F167': return true;
-        case U'\U0001F168': return true;
-        case U'\U0001F169': return true;
-        case U'\U0001F170': return true;
-        case U'\U0001F171': return true;
-        case U'\U0001F172': return true;
-        case U'\U0001F173': return true;
-        case U'\U0001F174': return true;
-        case U'\U0001F175': return true;
-        case U'\U0001F176': return true;
-        case U'\U0001F177': return true;
-        case U'\U0001F178': return true;
-        case U'\U0001F179': return true;
-        case U'\U0001F17A': return true;
-        case U'\U0001F17B': return true;
-        case U'\U0001F17C': return true;
-        case U'\U0001F17D': return true;
-        case U'\U0001F17E': return true;
-        case U'\U0001F17F': return true;
-        case U'\U0001F180': return true;
-        case U'\U0001F181': return true;
-        case U'\U0001F182': return true;
-        case U'\U0001F183': return true;
-        case U'\U0001F184': return true;
-        case U'\U0001F185': return true;
-        case U'\U0001F186': return true;
-        case U'\U0001F187': return true;
-        case U'\U0001F188': return true;
-        case U'\U0001F189': return true;
-        default: return false;
-        }
-    }
+        int_least32_t lower_delta;
+        int_least32_t upper_delta;
+        int_least32_t fold_delta;
+        uint_least8_t flags;
+    };
+
     /// @internal
     /// @ingroup sys_internal
-    constexpr bool dchar_is_case_ignorable(const char32_t c) noexcept
-    {
-        switch (c)
-        {
-        case U'\u0027': return true;
-        case U'\u002E': return true;
-        case U'\u003A': return true;
-        case U'\u005E': return true;
-        case U'\u0060': return true;
-        case U'\u00A8': return true;
-        case U'\u00AD': return true;
-        case U'\u00AF': return true;
-        case U'\u00B4': return true;
-        case U'\u00B7': return true;
-        case U'\u00B8': return true;
-        case U'\u02B0': return true;
-        case U'\u02B1': return true;
-        case U'\u02B2': return true;
-        case U'\u02B3': return true;
-        case U'\u02B4': return true;
-        case U'\u02B5': return true;
-        case U'\u02B6': return true;
-        case U'\u02B7': return true;
-        case U'\u02B8': return true;
-        case U'\u02B9': return true;
-        case U'\u02BA': return true;
-        case U'\u02BB': return true;
-        case U'\u02BC': return true;
-        case U'\u02BD': return true;
-        case U'\u02BE': return true;
-        case U'\u02BF': return true;
-        case U'\u02C0': return true;
-        case U'\u02C1': return true;
-        case U'\u02C2': return true;
-        case U'\u02C3': return true;
-        case U'\u02C4': return true;
-        case U'\u02C5': return true;
-        case U'\u02C6': return true;
-        case U'\u02C7': return true;
-        case U'\u02C8': return true;
-        case U'\u02C9': return true;
-        case U'\u02CA': return true;
-        case U'\u02CB': return true;
-        case U'\u02CC': return true;
-        case U'\u02CD': return true;
-        case U'\u02CE': return true;
-        case U'\u02CF': return true;
-        case U'\u02D0': return true;
-        case U'\u02D1': return true;
-        case U'\u02D2': return true;
-        case U'\u02D3': return true;
-        case U'\u02D4': return true;
-        case U'\u02D5': return true;
-        case U'\u02D6': return true;
-        case U'\u02D7': return true;
-        case U'\u02D8': return true;
-        case U'\u02D9': return true;
-        case U'\u02DA': return true;
-        case U'\u02DB': return true;
-        case U'\u02DC': return true;
-        case U'\u02DD': return true;
-        case U'\u02DE': return true;
-        case U'\u02DF': return true;
-        case U'\u02E0': return true;
-        case U'\u02E1': return true;
-        case U'\u02E2': return true;
-        case U'\u02E3': return true;
-        case U'\u02E4': return true;
-        case U'\u02E5': return true;
-        case U'\u02E6': return true;
-        case U'\u02E7': return true;
-        case U'\u02E8': return true;
-        case U'\u02E9': return true;
-        case U'\u02EA': return true;
-        case U'\u02EB': return true;
-        case U'\u02EC': return true;
-        case U'\u02ED': return true;
-        case U'\u02EE': return true;
-        case U'\u02EF': return true;
-        case U'\u02F0': return true;
-        case U'\u02F1': return true;
-        case U'\u02F2': return true;
-        case U'\u02F3': return true;
-        case U'\u02F4': return true;
-        case U'\u02F5': return true;
-        case U'\u02F6': return true;
-        case U'\u02F7': return true;
-        case U'\u02F8': return true;
-        case U'\u02F9': return true;
-        case U'\u02FA': return true;
-        case U'\u02FB': return true;
-        case U'\u02FC': return true;
-        case U'\u02FD': return true;
-        case U'\u02FE': return true;
-        case U'\u02FF': return true;
-        case U'\u0300': return true;
-        case U'\u0301': return true;
-        case U'\u0302': return true;
-        case U'\u0303': return true;
-        case U'\u0304': return true;
-        case U'\u0305': return true;
-        case U'\u0306': return true;
-        case U'\u0307': return true;
-        case U'\u0308': return true;
-        case U'\u0309': return true;
-        case U'\u030A': return true;
-        case U'\u030B': return true;
-        case U'\u030C': return true;
-        case U'\u030D': return true;
-        case U'\u030E': return true;
-        case U'\u030F': return true;
-        case U'\u0310': return true;
-        case U'\u0311': return true;
-        case U'\u0312': return true;
-        case U'\u0313': return true;
-        case U'\u0314': return true;
-        case U'\u0315': return true;
-        case U'\u0316': return true;
-        case U'\u0317': return true;
-        case U'\u0318': return true;
-        case U'\u0319': return true;
-        case U'\u031A': return true;
-        case U'\u031B': return true;
-        case U'\u031C': return true;
-        case U'\u031D': return true;
-        case U'\u031E': return true;
-        case U'\u031F': return true;
-        case U'\u0320': return true;
-        case U'\u0321': return true;
-        case U'\u0322': return true;
-        case U'\u0323': return true;
-        case U'\u0324': return true;
-        case U'\u0325': return true;
-        case U'\u0326': return true;
-        case U'\u0327': return true;
-        case U'\u0328': return true;
-        case U'\u0329': return true;
-        case U'\u032A': return true;
-        case U'\u032B': return true;
-        case U'\u032C': return true;
-        case U'\u032D': return true;
-        case U'\u032E': return true;
-        case U'\u032F': return true;
-        case U'\u0330': return true;
-        case U'\u0331': return true;
-        case U'\u0332': return true;
-        case U'\u0333': return true;
-        case U'\u0334': return true;
-        case U'\u0335': return true;
-        case U'\u0336': return true;
-        case U'\u0337': return true;
-        case U'\u0338': return true;
-        case U'\u0339': return true;
-        case U'\u033A': return true;
-        case U'\u033B': return true;
-        case U'\u033C': return true;
-        case U'\u033D': return true;
-        case U'\u033E': return true;
-        case U'\u033F': return true;
-        case U'\u0340': return true;
-        case U'\u0341': return true;
-        case U'\u0342': return true;
-        case U'\u0343': return true;
-        case U'\u0344': return true;
-        case U'\u0345': return true;
-        case U'\u0346': return true;
-        case U'\u0347': return true;
-        case U'\u0348': return true;
-        case U'\u0349': return true;
-        case U'\u034A': return true;
-        case U'\u034B': return true;
-        case U'\u034C': return true;
-        case U'\u034D': return true;
-        case U'\u034E': return true;
-        case U'\u034F': return true;
-        case U'\u0350': return true;
-        case U'\u0351': return true;
-        case U'\u0352': return true;
-        case U'\u0353': return true;
-        case U'\u0354': return true;
-        case U'\u0355': return true;
-        case U'\u0356': return true;
-        case U'\u0357': return true;
-        case U'\u0358': return true;
-        case U'\u0359': return true;
-        case U'\u035A': return true;
-        case U'\u035B': return true;
-        case U'\u035C': return true;
-        case U'\u035D': return true;
-        case U'\u035E': return true;
-        case U'\u035F': return true;
-        case U'\u0360': return true;
-        case U'\u0361': return true;
-        case U'\u0362': return true;
-        case U'\u0363': return true;
-        case U'\u0364': return true;
-        case U'\u0365': return true;
-        case U'\u0366': return true;
-        case U'\u0367': return true;
-        case U'\u0368': return true;
-        case U'\u0369': return true;
-        case U'\u036A': return true;
-        case U'\u036B': return true;
-        case U'\u036C': return true;
-        case U'\u036D': return true;
-        case U'\u036E': return true;
-        case U'\u036F': return true;
-        case U'\u0374': return true;
-        case U'\u0375': return true;
-        case U'\u037A': return true;
-        case U'\u0384': return true;
-        case U'\u0385': return true;
-        case U'\u0387': return true;
-        case U'\u0483': return true;
-        case U'\u0484': return true;
-        case U'\u0485': return true;
-        case U'\u0486': return true;
-        case U'\u0487': return true;
-        case U'\u0488': return true;
-        case U'\u0489': return true;
-        case U'\u0559': return true;
-        case U'\u055F': return true;
-        case U'\u0591': return true;
-        case U'\u0592': return true;
-        case U'\u0593': return true;
-        case U'\u0594': return true;
-        case U'\u0595': return true;
-        case U'\u0596': return true;
-        case U'\u0597': return true;
-        case U'\u0598': return true;
-        case U'\u0599': return true;
-        case U'\u059A': return true;
-        case U'\u059B': return true;
-        case U'\u059C': return true;
-        case U'\u059D': return true;
-        case U'\u059E': return true;
-        case U'\u059F': return true;
-        case U'\u05A0': return true;
-        case U'\u05A1': return true;
-        case U'\u05A2': return true;
-        case U'\u05A3': return true;
-        case U'\u05A4': return true;
-        case U'\u05A5': return true;
-        case U'\u05A6': return true;
-        case U'\u05A7': return true;
-        case U'\u05A8': return true;
-        case U'\u05A9': return true;
-        case U'\u05AA': return true;
-        case U'\u05AB': return true;
-        case U'\u05AC': return true;
-        case U'\u05AD': return true;
-        case U'\u05AE': return true;
-        case U'\u05AF': return true;
-        case U'\u05B0': return true;
-        case U'\u05B1': return true;
-        case U'\u05B2': return true;
-        case U'\u05B3': return true;
-        case U'\u05B4': return true;
-        case U'\u05B5': return true;
-        case U'\u05B6': return true;
-        case U'\u05B7': return true;
-        case U'\u05B8': return true;
-        case U'\u05B9': return true;
-        case U'\u05BA': return true;
-        case U'\u05BB': return true;
-        case U'\u05BC': return true;
-        case U'\u05BD': return true;
-        case U'\u05BF': return true;
-        case U'\u05C1': return true;
-        case U'\u05C2': return true;
-        case U'\u05C4': return true;
-        case U'\u05C5': return true;
-        case U'\u05C7': return true;
-        case U'\u05F4': return true;
-        case U'\u0600': return true;
-        case U'\u0601': return true;
-        case U'\u0602': return true;
-        case U'\u0603': return true;
-        case U'\u0604': return true;
-        case U'\u0605': return true;
-        case U'\u0610': return true;
-        case U'\u0611': return true;
-        case U'\u0612': return true;
-        case U'\u0613': return true;
-        case U'\u0614': return true;
-        case U'\u0615': return true;
-        case U'\u0616': return true;
-        case U'\u0617': return true;
-        case U'\u0618': return true;
-        case U'\u0619': return true;
-        case U'\u061A': return true;
-        case U'\u061C': return true;
-        case U'\u0640': return true;
-        case U'\u064B': return true;
-        case U'\u064C': return true;
-        case U'\u064D': return true;
-        case U'\u064E': return true;
-        case U'\u064F': return true;
-        case U'\u0650': return true;
-        case U'\u0651': return true;
-        case U'\u0652': return true;
-        case U'\u0653': return true;
-        case U'\u0654': return true;
-        case U'\u0655': return true;
-        case U'\u0656': return true;
-        case U'\u0657': return true;
-        case U'\u0658': return true;
-        case U'\u0659': return true;
-        case U'\u065A': return true;
-        case U'\u065B': return true;
-        case U'\u065C': return true;
-        case U'\u065D': return true;
-        case U'\u065E': return true;
-        case U'\u065F': return true;
-        case U'\u0670': return true;
-        case U'\u06D6': return true;
-        case U'\u06D7': return true;
-        case U'\u06D8': return true;
-        case U'\u06D9': return true;
-        case U'\u06DA': return true;
-        case U'\u06DB': return true;
-        case U'\u06DC': return true;
-        case U'\u06DD': return true;
-        case U'\u06DF': return true;
-        case U'\u06E0': return true;
-        case U'\u06E1': return true;
-        case U'\u06E2': return true;
-        case U'\u06E3': return true;
-        case U'\u06E4': return true;
-        case U'\u06E5': return true;
-        case U'\u06E6': return true;
-        case U'\u06E7': return true;
-        case U'\u06E8': return true;
-        case U'\u06EA': return true;
-        case U'\u06EB': return true;
-        case U'\u06EC': return true;
-        case U'\u06ED': return true;
-        case U'\u070F': return true;
-        case U'\u0711': return true;
-        case U'\u0730': return true;
-        case U'\u0731': return true;
-        case U'\u0732': return true;
-        case U'\u0733': return true;
-        case U'\u0734': return true;
-        case U'\u0735': return true;
-        case U'\u0736': return true;
-        case U'\u0737': return true;
-        case U'\u0738': return true;
-        case U'\u0739': return true;
-        case U'\u073A': return true;
-        case U'\u073B': return true;
-        case U'\u073C': return true;
-        case U'\u073D': return true;
-        case U'\u073E': return true;
-        case U'\u073F': return true;
-        case U'\u0740': return true;
-        case U'\u0741': return true;
-        case U'\u0742': return true;
-        case U'\u0743': return true;
-        case U'\u0744': return true;
-        case U'\u0745': return true;
-        case U'\u0746': return true;
-        case U'\u0747': return true;
-        case U'\u0748': return true;
-        case U'\u0749': return true;
-        case U'\u074A': return true;
-        case U'\u07A6': return true;
-        case U'\u07A7': return true;
-        case U'\u07A8': return true;
-        case U'\u07A9': return true;
-        case U'\u07AA': return true;
-        case U'\u07AB': return true;
-        case U'\u07AC': return true;
-        case U'\u07AD': return true;
-        case U'\u07AE': return true;
-        case U'\u07AF': return true;
-        case U'\u07B0': return true;
-        case U'\u07EB': return true;
-        case U'\u07EC': return true;
-        case U'\u07ED': return true;
-        case U'\u07EE': return true;
-        case U'\u07EF': return true;
-        case U'\u07F0': return true;
-        case U'\u07F1': return true;
-        case U'\u07F2': return true;
-        case U'\u07F3': return true;
-        case U'\u07F4': return true;
-        case U'\u07F5': return true;
-        case U'\u07FA': return true;
-        case U'\u07FD': return true;
-        case U'\u0816': return true;
-        case U'\u0817': return true;
-        case U'\u0818': return true;
-        case U'\u0819': return true;
-        case U'\u081A': return true;
-        case U'\u081B': return true;
-        case U'\u081C': return true;
-        case U'\u081D': return true;
-        case U'\u081E': return true;
-        case U'\u081F': return true;
-        case U'\u0820': return true;
-        case U'\u0821': return true;
-        case U'\u0822': return true;
-        case U'\u0823': return true;
-        case U'\u0824': return true;
-        case U'\u0825': return true;
-        case U'\u0826': return true;
-        case U'\u0827': return true;
-        case U'\u0828': return true;
-        case U'\u0829': return true;
-        case U'\u082A': return true;
-        case U'\u082B': return true;
-        case U'\u082C': return true;
-        case U'\u082D': return true;
-        case U'\u0859': return true;
-        case U'\u085A': return true;
-        case U'\u085B': return true;
-        case U'\u0888': return true;
-        case U'\u0890': return true;
-        case U'\u0891': return true;
-        case U'\u0897': return true;
-        case U'\u0898': return true;
-        case U'\u0899': return true;
-        case U'\u089A': return true;
-        case U'\u089B': return true;
-        case U'\u089C': return true;
-        case U'\u089D': return true;
-        case U'\u089E': return true;
-        case U'\u089F': return true;
-        case U'\u08C9': return true;
-        case U'\u08CA': return true;
-        case U'\u08CB': return true;
-        case U'\u08CC': return true;
-        case U'\u08CD': return true;
-        case U'\u08CE': return true;
-        case U'\u08CF': return true;
-        case U'\u08D0': return true;
-        case U'\u08D1': return true;
-        case U'\u08D2': return true;
-        case U'\u08D3': return true;
-        case U'\u08D4': return true;
-        case U'\u08D5': return true;
-        case U'\u08D6': return true;
-        case U'\u08D7': return true;
-        case U'\u08D8': return true;
-        case U'\u08D9': return true;
-        case U'\u08DA': return true;
-        case U'\u08DB': return true;
-        case U'\u08DC': return true;
-        case U'\u08DD': return true;
-        case U'\u08DE': return true;
-        case U'\u08DF': return true;
-        case U'\u08E0': return true;
-        case U'\u08E1': return true;
-        case U'\u08E2': return true;
-        case U'\u08E3': return true;
-        case U'\u08E4': return true;
-        case U'\u08E5': return true;
-        case U'\u08E6': return true;
-        case U'\u08E7': return true;
-        case U'\u08E8': return true;
-        case U'\u08E9': return true;
-        case U'\u08EA': return true;
-        case U'\u08EB': return true;
-        case U'\u08EC': return true;
-        case U'\u08ED': return true;
-        case U'\u08EE': return true;
-        case U'\u08EF': return true;
-        case U'\u08F0': return true;
-        case U'\u08F1': return true;
-        case U'\u08F2': return true;
-        case U'\u08F3': return true;
-        case U'\u08F4': return true;
-        case U'\u08F5': return true;
-        case U'\u08F6': return true;
-        case U'\u08F7': return true;
-        case U'\u08F8': return true;
-        case U'\u08F9': return true;
-        case U'\u08FA': return true;
-        case U'\u08FB': return true;
-        case U'\u08FC': return true;
-        case U'\u08FD': return true;
-        case U'\u08FE': return true;
-        case U'\u08FF': return true;
-        case U'\u0900': return true;
-        case U'\u0901': return true;
-        case U'\u0902': return true;
-        case U'\u093A': return true;
-        case U'\u093C': return true;
-        case U'\u0941': return true;
-        case U'\u0942': return true;
-        case U'\u0943': return true;
-        case U'\u0944': return true;
-        case U'\u0945': return true;
-        case U'\u0946': return true;
-        case U'\u0947': return true;
-        case U'\u0948': return true;
-        case U'\u094D': return true;
-        case U'\u0951': return true;
-        case U'\u0952': return true;
-        case U'\u0953': return true;
-        case U'\u0954': return true;
-        case U'\u0955': return true;
-        case U'\u0956': return true;
-        case U'\u0957': return true;
-        case U'\u0962': return true;
-        case U'\u0963': return true;
-        case U'\u0971': return true;
-        case U'\u0981': return true;
-        case U'\u09BC': return true;
-        case U'\u09C1': return true;
-        case U'\u09C2': return true;
-        case U'\u09C3': return true;
-        case U'\u09C4': return true;
-        case U'\u09CD': return true;
-        case U'\u09E2': return true;
-        case U'\u09E3': return true;
-        case U'\u09FE': return true;
-        case U'\u0A01': return true;
-        case U'\u0A02': return true;
-        case U'\u0A3C': return true;
-        case U'\u0A41': return true;
-        case U'\u0A42': return true;
-        case U'\u0A47': return true;
-        case U'\u0A48': return true;
-        case U'\u0A4B': return true;
-        case U'\u0A4C': return true;
-        case U'\u0A4D': return true;
-        case U'\u0A51': return true;
-        case U'\u0A70': return true;
-        case U'\u0A71': return true;
-        case U'\u0A75': return true;
-        case U'\u0A81': return true;
-        case U'\u0A82': return true;
-        case U'\u0ABC': return true;
-        case U'\u0AC1': return true;
-        case U'\u0AC2': return true;
-        case U'\u0AC3': return true;
-        case U'\u0AC4': return true;
-        case U'\u0AC5': return true;
-        case U'\u0AC7': return true;
-        case U'\u0AC8': return true;
-        case U'\u0ACD': return true;
-        case U'\u0AE2': return true;
-        case U'\u0AE3': return true;
-        case U'\u0AFA': return true;
-        case U'\u0AFB': return true;
-        case U'\u0AFC': return true;
-        case U'\u0AFD': return true;
-        case U'\u0AFE': return true;
-        case U'\u0AFF': return true;
-        case U'\u0B01': return true;
-        case U'\u0B3C': return true;
-        case U'\u0B3F': return true;
-        case U'\u0B41': return true;
-        case U'\u0B42': return true;
-        case U'\u0B43': return true;
-        case U'\u0B44': return true;
-        case U'\u0B4D': return true;
-        case U'\u0B55': return true;
-        case U'\u0B56': return true;
-        case U'\u0B62': return true;
-        case U'\u0B63': return true;
-        case U'\u0B82': return true;
-        case U'\u0BC0': return true;
-        case U'\u0BCD': return true;
-        case U'\u0C00': return true;
-        case U'\u0C04': return true;
-        case U'\u0C3C': return true;
-        case U'\u0C3E': return true;
-        case U'\u0C3F': return true;
-        case U'\u0C40': return true;
-        case U'\u0C46': return true;
-        case U'\u0C47': return true;
-        case U'\u0C48': return true;
-        case U'\u0C4A': return true;
-        case U'\u0C4B': return true;
-        case U'\u0C4C': return true;
-        case U'\u0C4D': return true;
-        case U'\u0C55': return true;
-        case U'\u0C56': return true;
-        case U'\u0C62': return true;
-        case U'\u0C63': return true;
-        case U'\u0C81': return true;
-        case U'\u0CBC': return true;
-        case U'\u0CBF': return true;
-        case U'\u0CC6': return true;
-        case U'\u0CCC': return true;
-        case U'\u0CCD': return true;
-        case U'\u0CE2': return true;
-        case U'\u0CE3': return true;
-        case U'\u0D00': return true;
-        case U'\u0D01': return true;
-        case U'\u0D3B': return true;
-        case U'\u0D3C': return true;
-        case U'\u0D41': return true;
-        case U'\u0D42': return true;
-        case U'\u0D43': return true;
-        case U'\u0D44': return true;
-        case U'\u0D4D': return true;
-        case U'\u0D62': return true;
-        case U'\u0D63': return true;
-        case U'\u0D81': return true;
-        case U'\u0DCA': return true;
-        case U'\u0DD2': return true;
-        case U'\u0DD3': return true;
-        case U'\u0DD4': return true;
-        case U'\u0DD6': return true;
-        case U'\u0E31': return true;
-        case U'\u0E34': return true;
-        case U'\u0E35': return true;
-        case U'\u0E36': return true;
-        case U'\u0E37': return true;
-        case U'\u0E38': return true;
-        case U'\u0E39': return true;
-        case U'\u0E3A': return true;
-        case U'\u0E46': return true;
-        case U'\u0E47': return true;
-        case U'\u0E48': return true;
-        case U'\u0E49': return true;
-        case U'\u0E4A': return true;
-        case U'\u0E4B': return true;
-        case U'\u0E4C': return true;
-        case U'\u0E4D': return true;
-        case U'\u0E4E': return true;
-        case U'\u0EB1': return true;
-        case U'\u0EB4': return true;
-        case U'\u0EB5': return true;
-        case U'\u0EB6': return true;
-        case U'\u0EB7': return true;
-        case U'\u0EB8': return true;
-        case U'\u0EB9': return true;
-        case U'\u0EBA': return true;
-        case U'\u0EBB': return true;
-        case U'\u0EBC': return true;
-        case U'\u0EC6': return true;
-        case U'\u0EC8': return true;
-        case U'\u0EC9': return true;
-        case U'\u0ECA': return true;
-        case U'\u0ECB': return true;
-        case U'\u0ECC': return true;
-        case U'\u0ECD': return true;
-        case U'\u0ECE': return true;
-        case U'\u0F18': return true;
-        case U'\u0F19': return true;
-        case U'\u0F35': return true;
-        case U'\u0F37': return true;
-        case U'\u0F39': return true;
-        case U'\u0F71': return true;
-        case U'\u0F72': return true;
-        case U'\u0F73': return true;
-        case U'\u0F74': return true;
-        case U'\u0F75': return true;
-        case U'\u0F76': return true;
-        case U'\u0F77': return true;
-        case U'\u0F78': return true;
-        case U'\u0F79': return true;
-        case U'\u0F7A': return true;
-        case U'\u0F7B': return true;
-        case U'\u0F7C': return true;
-        case U'\u0F7D': return true;
-        case U'\u0F7E': return true;
-        case U'\u0F80': return true;
-        case U'\u0F81': return true;
-        case U'\u0F82': return true;
-        case U'\u0F83': return true;
-        case U'\u0F84': return true;
-        case U'\u0F86': return true;
-        case U'\u0F87': return true;
-        case U'\u0F8D': return true;
-        case U'\u0F8E': return true;
-        case U'\u0F8F': return true;
-        case U'\u0F90': return true;
-        case U'\u0F91': return true;
-        case U'\u0F92': return true;
-        case U'\u0F93': return true;
-        case U'\u0F94': return true;
-        case U'\u0F95': return true;
-        case U'\u0F96': return true;
-        case U'\u0F97': return true;
-        case U'\u0F99': return true;
-        case U'\u0F9A': return true;
-        case U'\u0F9B': return true;
-        case U'\u0F9C': return true;
-        case U'\u0F9D': return true;
-        case U'\u0F9E': return true;
-        case U'\u0F9F': return true;
-        case U'\u0FA0': return true;
-        case U'\u0FA1': return true;
-        case U'\u0FA2': return true;
-        case U'\u0FA3': return true;
-        case U'\u0FA4': return true;
-        case U'\u0FA5': return true;
-        case U'\u0FA6': return true;
-        case U'\u0FA7': return true;
-        case U'\u0FA8': return true;
-        case U'\u0FA9': return true;
-        case U'\u0FAA': return true;
-        case U'\u0FAB': return true;
-        case U'\u0FAC': return true;
-        case U'\u0FAD': return true;
-        case U'\u0FAE': return true;
-        case U'\u0FAF': return true;
-        case U'\u0FB0': return true;
-        case U'\u0FB1': return true;
-        case U'\u0FB2': return true;
-        case U'\u0FB3': return true;
-        case U'\u0FB4': return true;
-        case U'\u0FB5': return true;
-        case U'\u0FB6': return true;
-        case U'\u0FB7': return true;
-        case U'\u0FB8': return true;
-        case U'\u0FB9': return true;
-        case U'\u0FBA': return true;
-        case U'\u0FBB': return true;
-        case U'\u0FBC': return true;
-        case U'\u0FC6': return true;
-        case U'\u102D': return true;
-        case U'\u102E': return true;
-        case U'\u102F': return true;
-        case U'\u1030': return true;
-        case U'\u1032': return true;
-        case U'\u1033': return true;
-        case U'\u1034': return true;
-        case U'\u1035': return true;
-        case U'\u1036': return true;
-        case U'\u1037': return true;
-        case U'\u1039': return true;
-        case U'\u103A': return true;
-        case U'\u103D': return true;
-        case U'\u103E': return true;
-        case U'\u1058': return true;
-        case U'\u1059': return true;
-        case U'\u105E': return true;
-        case U'\u105F': return true;
-        case U'\u1060': return true;
-        case U'\u1071': return true;
-        case U'\u1072': return true;
-        case U'\u1073': return true;
-        case U'\u1074': return true;
-        case U'\u1082': return true;
-        case U'\u1085': return true;
-        case U'\u1086': return true;
-        case U'\u108D': return true;
-        case U'\u109D': return true;
-        case U'\u10FC': return true;
-        case U'\u135D': return true;
-        case U'\u135E': return true;
-        case U'\u135F': return true;
-        case U'\u1712': return true;
-        case U'\u1713': return true;
-        case U'\u1714': return true;
-        case U'\u1732': return true;
-        case U'\u1733': return true;
-        case U'\u1752': return true;
-        case U'\u1753': return true;
-        case U'\u1772': return true;
-        case U'\u1773': return true;
-        case U'\u17B4': return true;
-        case U'\u17B5': return true;
-        case U'\u17B7': return true;
-        case U'\u17B8': return true;
-        case U'\u17B9': return true;
-        case U'\u17BA': return true;
-        case U'\u17BB': return true;
-        case U'\u17BC': return true;
-        case U'\u17BD': return true;
-        case U'\u17C6': return true;
-        case U'\u17C9': return true;
-        case U'\u17CA': return true;
-        case U'\u17CB': return true;
-        case U'\u17CC': return true;
-        case U'\u17CD': return true;
-        case U'\u17CE': return true;
-        case U'\u17CF': return true;
-        case U'\u17D0': return true;
-        case U'\u17D1': return true;
-        case U'\u17D2': return true;
-        case U'\u17D3': return true;
-        case U'\u17D7': return true;
-        case U'\u17DD': return true;
-        case U'\u180B': return true;
-        case U'\u180C': return true;
-        case U'\u180D': return true;
-        case U'\u180E': return true;
-        case U'\u180F': return true;
-        case U'\u1843': return true;
-        case U'\u1885': return true;
-        case U'\u1886': return true;
-        case U'\u18A9': return true;
-        case U'\u1920': return true;
-        case U'\u1921': return true;
-        case U'\u1922': return true;
-        case U'\u1927': return true;
-        case U'\u1928': return true;
-        case U'\u1932': return true;
-        case U'\u1939': return true;
-        case U'\u193A': return true;
-        case U'\u193B': return true;
-        case U'\u1A17': return true;
-        case U'\u1A18': return true;
-        case U'\u1A1B': return true;
-        case U'\u1A56': return true;
-        case U'\u1A58': return true;
-        case U'\u1A59': return true;
-        case U'\u1A5A': return true;
-        case U'\u1A5B': return true;
-        case U'\u1A5C': return true;
-        case U'\u1A5D': return true;
-        case U'\u1A5E': return true;
-        case U'\u1A60': return true;
-        case U'\u1A62': return true;
-        case U'\u1A65': return true;
-        case U'\u1A66': return true;
-        case U'\u1A67': return true;
-        case U'\u1A68': return true;
-        case U'\u1A69': return true;
-        case U'\u1A6A': return true;
-        case U'\u1A6B': return true;
-        case U'\u1A6C': return true;
-        case U'\u1A73': return true;
-        case U'\u1A74': return true;
-        case U'\u1A75': return true;
-        case U'\u1A76': return true;
-        case U'\u1A77': return true;
-        case U'\u1A78': return true;
-        case U'\u1A79': return true;
-        case U'\u1A7A': return true;
-        case U'\u1A7B': return true;
-        case U'\u1A7C': return true;
-        case U'\u1A7F': return true;
-        case U'\u1AA7': return true;
-        case U'\u1AB0': return true;
-        case U'\u1AB1': return true;
-        case U'\u1AB2': return true;
-        case U'\u1AB3': return true;
-        case U'\u1AB4': return true;
-        case U'\u1AB5': return true;
-        case U'\u1AB6': return true;
-        case U'\u1AB7': return true;
-        case U'\u1AB8': return true;
-        case U'\u1AB9': return true;
-        case U'\u1ABA': return true;
-        case U'\u1ABB': return true;
-        case U'\u1ABC': return true;
-        case U'\u1ABD': return true;
-        case U'\u1ABE': return true;
-        case U'\u1ABF': return true;
-        case U'\u1AC0': return true;
-        case U'\u1AC1': return true;
-        case U'\u1AC2': return true;
-        case U'\u1AC3': return true;
-        case U'\u1AC4': return true;
-        case U'\u1AC5': return true;
-        case U'\u1AC6': return true;
-        case U'\u1AC7': return true;
-        case U'\u1AC8': return true;
-        case U'\u1AC9': return true;
-        case U'\u1ACA': return true;
-        case U'\u1ACB': return true;
-        case U'\u1ACC': return true;
-        case U'\u1ACD': return true;
-        case U'\u1ACE': return true;
-        case U'\u1ACF': return true;
-        case U'\u1AD0': return true;
-        case U'\u1AD1': return true;
-        case U'\u1AD2': return true;
-        case U'\u1AD3': return true;
-        case U'\u1AD4': return true;
-        case U'\u1AD5': return true;
-        case U'\u1AD6': return true;
-        case U'\u1AD7': return true;
-        case U'\u1AD8': return true;
-        case U'\u1AD9': return true;
-        case U'\u1ADA': return true;
-        case U'\u1ADB': return true;
-        case U'\u1ADC': return true;
-        case U'\u1ADD': return true;
-        case U'\u1AE0': return true;
-        case U'\u1AE1': return true;
-        case U'\u1AE2': return true;
-        case U'\u1AE3': return true;
-        case U'\u1AE4': return true;
-        case U'\u1AE5': return true;
-        case U'\u1AE6': return true;
-        case U'\u1AE7': return true;
-        case U'\u1AE8': return true;
-        case U'\u1AE9': return true;
-        case U'\u1AEA': return true;
-        case U'\u1AEB': return true;
-        case U'\u1B00': return true;
-        case U'\u1B01': return true;
-        case U'\u1B02': return true;
-        case U'\u1B03': return true;
-        case U'\u1B34': return true;
-        case U'\u1B36': return true;
-        case U'\u1B37': return true;
-        case U'\u1B38': return true;
-        case U'\u1B39': return true;
-        case U'\u1B3A': return true;
-        case U'\u1B3C': return true;
-        case U'\u1B42': return true;
-        case U'\u1B6B': return true;
-        case U'\u1B6C': return true;
-        case U'\u1B6D': return true;
-        case U'\u1B6E': return true;
-        case U'\u1B6F': return true;
-        case U'\u1B70': return true;
-        case U'\u1B71': return true;
-        case U'\u1B72': return true;
-        case U'\u1B73': return true;
-        case U'\u1B80': return true;
-        case U'\u1B81': return true;
-        case U'\u1BA2': return true;
-        case U'\u1BA3': return true;
-        case U'\u1BA4': return true;
-        case U'\u1BA5': return true;
-        case U'\u1BA8': return true;
-        case U'\u1BA9': return true;
-        case U'\u1BAB': return true;
-        case U'\u1BAC': return true;
-        case U'\u1BAD': return true;
-        case U'\u1BE6': return true;
-        case U'\u1BE8': return true;
-        case U'\u1BE9': return true;
-        case U'\u1BED': return true;
-        case U'\u1BEF': return true;
-        case U'\u1BF0': return true;
-        case U'\u1BF1': return true;
-        case U'\u1C2C': return true;
-        case U'\u1C2D': return true;
-        case U'\u1C2E': return true;
-        case U'\u1C2F': return true;
-        case U'\u1C30': return true;
-        case U'\u1C31': return true;
-        case U'\u1C32': return true;
-        case U'\u1C33': return true;
-        case U'\u1C36': return true;
-        case U'\u1C37': return true;
-        case U'\u1C78': return true;
-        case U'\u1C79': return true;
-        case U'\u1C7A': return true;
-        case U'\u1C7B': return true;
-        case U'\u1C7C': return true;
-        case U'\u1C7D': return true;
-        case U'\u1CD0': return true;
-        case U'\u1CD1': return true;
-        case U'\u1CD2': return true;
-        case U'\u1CD4': return true;
-        case U'\u1CD5': return true;
-        case U'\u1CD6': return true;
-        case U'\u1CD7': return true;
-        case U'\u1CD8': return true;
-        case U'\u1CD9': return true;
-        case U'\u1CDA': return true;
-        case U'\u1CDB': return true;
-        case U'\u1CDC': return true;
-        case U'\u1CDD': return true;
-        case U'\u1CDE': return true;
-        case U'\u1CDF': return true;
-        case U'\u1CE0': return true;
-        case U'\u1CE2': return true;
-        case U'\u1CE3': return true;
-        case U'\u1CE4': return true;
-        case U'\u1CE5': return true;
-        case U'\u1CE6': return true;
-        case U'\u1CE7': return true;
-        case U'\u1CE8': return true;
-        case U'\u1CED': return true;
-        case U'\u1CF4': return true;
-        case U'\u1CF8': return true;
-        case U'\u1CF9': return true;
-        case U'\u1D2C': return true;
-        case U'\u1D2D': return true;
-        case U'\u1D2E': return true;
-        case U'\u1D2F': return true;
-        case U'\u1D30': return true;
-        case U'\u1D31': return true;
-        case U'\u1D32': return true;
-        case U'\u1D33': return true;
-        case U'\u1D34': return true;
-        case U'\u1D35': return true;
-        case U'\u1D36': return true;
-        case U'\u1D37': return true;
-        case U'\u1D38': return true;
-        case U'\u1D39': return true;
-        case U'\u1D3A': return true;
-        case U'\u1D3B': return true;
-        case U'\u1D3C': return true;
-        case U'\u1D3D': return true;
-        case U'\u1D3E': return true;
-        case U'\u1D3F': return true;
-        case U'\u1D40': return true;
-        case U'\u1D41': return true;
-        case U'\u1D42': return true;
-        case U'\u1D43': return true;
-        case U'\u1D44': return true;
-        case U'\u1D45': return true;
-        case U'\u1D46': return true;
-        case U'\u1D47': return true;
-        case U'\u1D48': return true;
-        case U'\u1D49': return true;
-        case U'\u1D4A': return true;
-        case U'\u1D4B': return true;
-        case U'\u1D4C': return true;
-        case U'\u1D4D': return true;
-        case U'\u1D4E': return true;
-        case U'\u1D4F': return true;
-        case U'\u1D50': return true;
-        case U'\u1D51': return true;
-        case U'\u1D52': return true;
-        case U'\u1D53': return true;
-        case U'\u1D54': return true;
-        case U'\u1D55': return true;
-        case U'\u1D56': return true;
-        case U'\u1D57': return true;
-        case U'\u1D58': return true;
-        case U'\u1D59': return true;
-        case U'\u1D5A': return true;
-        case U'\u1D5B': return true;
-        case U'\u1D5C': return true;
-        case U'\u1D5D': return true;
-        case U'\u1D5E': return true;
-        case U'\u1D5F': return true;
-        case U'\u1D60': return true;
-        case U'\u1D61': return true;
-        case U'\u1D62': return true;
-        case U'\u1D63': return true;
-        case U'\u1D64': return true;
-        case U'\u1D65': return true;
-        case U'\u1D66': return true;
-        case U'\u1D67': return true;
-        case U'\u1D68': return true;
-        case U'\u1D69': return true;
-        case U'\u1D6A': return true;
-        case U'\u1D78': return true;
-        case U'\u1D9B': return true;
-        case U'\u1D9C': return true;
-        case U'\u1D9D': return true;
-        case U'\u1D9E': return true;
-        case U'\u1D9F': return true;
-        case U'\u1DA0': return true;
-        case U'\u1DA1': return true;
-        case U'\u1DA2': return true;
-        case U'\u1DA3': return true;
-        case U'\u1DA4': return true;
-        case U'\u1DA5': return true;
-        case U'\u1DA6': return true;
-        case U'\u1DA7': return true;
-        case U'\u1DA8': return true;
-        case U'\u1DA9': return true;
-        case U'\u1DAA': return true;
-        case U'\u1DAB': return true;
-        case U'\u1DAC': return true;
-        case U'\u1DAD': return true;
-        case U'\u1DAE': return true;
-        case U'\u1DAF': return true;
-        case U'\u1DB0': return true;
-        case U'\u1DB1': return true;
-        case U'\u1DB2': return true;
-        case U'\u1DB3': return true;
-        case U'\u1DB4': return true;
-        case U'\u1DB5': return true;
-        case U'\u1DB6': return true;
-        case U'\u1DB7': return true;
-        case U'\u1DB8': return true;
-        case U'\u1DB9': return true;
-        case U'\u1DBA': return true;
-        case U'\u1DBB': return true;
-        case U'\u1DBC': return true;
-        case U'\u1DBD': return true;
-        case U'\u1DBE': return true;
-        case U'\u1DBF': return true;
-        case U'\u1DC0': return true;
-        case U'\u1DC1': return true;
-        case U'\u1DC2': return true;
-        case U'\u1DC3': return true;
-        case U'\u1DC4': return true;
-        case U'\u1DC5': return true;
-        case U'\u1DC6': return true;
-        case U'\u1DC7': return true;
-        case U'\u1DC8': return true;
-        case U'\u1DC9': return true;
-        case U'\u1DCA': return true;
-        case U'\u1DCB': return true;
-        case U'\u1DCC': return true;
-        case U'\u1DCD': return true;
-        case U'\u1DCE': return true;
-        case U'\u1DCF': return true;
-        case U'\u1DD0': return true;
-        case U'\u1DD1': return true;
-        case U'\u1DD2': return true;
-        case U'\u1DD3': return true;
-        case U'\u1DD4': return true;
-        case U'\u1DD5': return true;
-        case U'\u1DD6': return true;
-        case U'\u1DD7': return true;
-        case U'\u1DD8': return true;
-        case U'\u1DD9': return true;
-        case U'\u1DDA': return true;
-        case U'\u1DDB': return true;
-        case U'\u1DDC': return true;
-        case U'\u1DDD': return true;
-        case U'\u1DDE': return true;
-        case U'\u1DDF': return true;
-        case U'\u1DE0': return true;
-        case U'\u1DE1': return true;
-        case U'\u1DE2': return true;
-        case U'\u1DE3': return true;
-        case U'\u1DE4': return true;
-        case U'\u1DE5': return true;
-        case U'\u1DE6': return true;
-        case U'\u1DE7': return true;
-        case U'\u1DE8': return true;
-        case U'\u1DE9': return true;
-        case U'\u1DEA': return true;
-        case U'\u1DEB': return true;
-        case U'\u1DEC': return true;
-        case U'\u1DED': return true;
-        case U'\u1DEE': return true;
-        case U'\u1DEF': return true;
-        case U'\u1DF0': return true;
-        case U'\u1DF1': return true;
-        case U'\u1DF2': return true;
-        case U'\u1DF3': return true;
-        case U'\u1DF4': return true;
-        case U'\u1DF5': return true;
-        case U'\u1DF6': return true;
-        case U'\u1DF7': return true;
-        case U'\u1DF8': return true;
-        case U'\u1DF9': return true;
-        case U'\u1DFA': return true;
-        case U'\u1DFB': return true;
-        case U'\u1DFC': return true;
-        case U'\u1DFD': return true;
-        case U'\u1DFE': return true;
-        case U'\u1DFF': return true;
-        case U'\u1FBD': return true;
-        case U'\u1FBF': return true;
-        case U'\u1FC0': return true;
-        case U'\u1FC1': return true;
-        case U'\u1FCD': return true;
-        case U'\u1FCE': return true;
-        case U'\u1FCF': return true;
-        case U'\u1FDD': return true;
-        case U'\u1FDE': return true;
-        case U'\u1FDF': return true;
-        case U'\u1FED': return true;
-        case U'\u1FEE': return true;
-        case U'\u1FEF': return true;
-        case U'\u1FFD': return true;
-        case U'\u1FFE': return true;
-        case U'\u200B': return true;
-        case U'\u200C': return true;
-        case U'\u200D': return true;
-        case U'\u200E': return true;
-        case U'\u200F': return true;
-        case U'\u2018': return true;
-        case U'\u2019': return true;
-        case U'\u2024': return true;
-        case U'\u2027': return true;
-        case U'\u202A': return true;
-        case U'\u202B': return true;
-        case U'\u202C': return true;
-        case U'\u202D': return true;
-        case U'\u202E': return true;
-        case U'\u2060': return true;
-        case U'\u2061': return true;
-        case U'\u2062': return true;
-        case U'\u2063': return true;
-        case U'\u2064': return true;
-        case U'\u2066': return true;
-        case U'\u2067': return true;
-        case U'\u2068': return true;
-        case U'\u2069': return true;
-        case U'\u206A': return true;
-        case U'\u206B': return true;
-        case U'\u206C': return true;
-        case U'\u206D': return true;
-        case U'\u206E': return true;
-        case U'\u206F': return true;
-        case U'\u2071': return true;
-        case U'\u207F': return true;
-        case U'\u2090': return true;
-        case U'\u2091': return true;
-        case U'\u2092': return true;
-        case U'\u2093': return true;
-        case U'\u2094': return true;
-        case U'\u2095': return true;
-        case U'\u2096': return true;
-        case U'\u2097': return true;
-        case U'\u2098': return true;
-        case U'\u2099': return true;
-        case U'\u209A': return true;
-        case U'\u209B': return true;
-        case U'\u209C': return true;
-        case U'\u20D0': return true;
-        case U'\u20D1': return true;
-        case U'\u20D2': return true;
-        case U'\u20D3': return true;
-        case U'\u20D4': return true;
-        case U'\u20D5': return true;
-        case U'\u20D6': return true;
-        case U'\u20D7': return true;
-        case U'\u20D8': return true;
-        case U'\u20D9': return true;
-        case U'\u20DA': return true;
-        case U'\u20DB': return true;
-        case U'\u20DC': return true;
-        case U'\u20DD': return true;
-        case U'\u20DE': return true;
-        case U'\u20DF': return true;
-        case U'\u20E0': return true;
-        case U'\u20E1': return true;
-        case U'\u20E2': return true;
-        case U'\u20E3': return true;
-        case U'\u20E4': return true;
-        case U'\u20E5': return true;
-        case U'\u20E6': return true;
-        case U'\u20E7': return true;
-        case U'\u20E8': return true;
-        case U'\u20E9': return true;
-        case U'\u20EA': return true;
-        case U'\u20EB': return true;
-        case U'\u20EC': return true;
-        case U'\u20ED': return true;
-        case U'\u20EE': return true;
-        case U'\u20EF': return true;
-        case U'\u20F0': return true;
-        case U'\u2C7C': return true;
-        case U'\u2C7D': return true;
-        case U'\u2CEF': return true;
-        case U'\u2CF0': return true;
-        case U'\u2CF1': return true;
-        case U'\u2D6F': return true;
-        case U'\u2D7F': return true;
-        case U'\u2DE0': return true;
-        case U'\u2DE1': return true;
-        case U'\u2DE2': return true;
-        case U'\u2DE3': return true;
-        case U'\u2DE4': return true;
-        case U'\u2DE5': return true;
-        case U'\u2DE6': return true;
-        case U'\u2DE7': return true;
-        case U'\u2DE8': return true;
-        case U'\u2DE9': return true;
-        case U'\u2DEA': return true;
-        case U'\u2DEB': return true;
-        case U'\u2DEC': return true;
-        case U'\u2DED': return true;
-        case U'\u2DEE': return true;
-        case U'\u2DEF': return true;
-        case U'\u2DF0': return true;
-        case U'\u2DF1': return true;
-        case U'\u2DF2': return true;
-        case U'\u2DF3': return true;
-        case U'\u2DF4': return true;
-        case U'\u2DF5': return true;
-        case U'\u2DF6': return true;
-        case U'\u2DF7': return true;
-        case U'\u2DF8': return true;
-        case U'\u2DF9': return true;
-        case U'\u2DFA': return true;
-        case U'\u2DFB': return true;
-        case U'\u2DFC': return true;
-        case U'\u2DFD': return true;
-        case U'\u2DFE': return true;
-        case U'\u2DFF': return true;
-        case U'\u2E2F': return true;
-        case U'\u3005': return true;
-        case U'\u302A': return true;
-        case U'\u302B': return true;
-        case U'\u302C': return true;
-        case U'\u302D': return true;
-        case U'\u3031': return true;
-        case U'\u3032': return true;
-        case U'\u3033': return true;
-        case U'\u3034': return true;
-        case U'\u3035': return true;
-        case U'\u303B': return true;
-        case U'\u3099': return true;
-        case U'\u309A': return true;
-        case U'\u309B': return true;
-        case U'\u309C': return true;
-        case U'\u309D': return true;
-        case U'\u309E': return true;
-        case U'\u30FC': return true;
-        case U'\u30FD': return true;
-        case U'\u30FE': return true;
-        case U'\uA015': return true;
-        case U'\uA4F8': return true;
-        case U'\uA4F9': return true;
-        case U'\uA4FA': return true;
-        case U'\uA4FB': return true;
-        case U'\uA4FC': return true;
-        case U'\uA4FD': return true;
-        case U'\uA60C': return true;
-        case U'\uA66F': return true;
-        case U'\uA670': return true;
-        case U'\uA671': return true;
-        case U'\uA672': return true;
-        case U'\uA674': return true;
-        case U'\uA675': return true;
-        case U'\uA676': return true;
-        case U'\uA677': return true;
-        case U'\uA678': return true;
-        case U'\uA679': return true;
-        case U'\uA67A': return true;
-        case U'\uA67B': return true;
-        case U'\uA67C': return true;
-        case U'\uA67D': return true;
-        case U'\uA67F': return true;
-        case U'\uA69C': return true;
-        case U'\uA69D': return true;
-        case U'\uA69E': return true;
-        case U'\uA69F': return true;
-        case U'\uA6F0': return true;
-        case U'\uA6F1': return true;
-        case U'\uA700': return true;
-        case U'\uA701': return true;
-        case U'\uA702': return true;
-        case U'\uA703': return true;
-        case U'\uA704': return true;
-        case U'\uA705': return true;
-        case U'\uA706': return true;
-        case U'\uA707': return true;
-        case U'\uA708': return true;
-        case U'\uA709': return true;
-        case U'\uA70A': return true;
-        case U'\uA70B': return true;
-        case U'\uA70C': return true;
-        case U'\uA70D': return true;
-        case U'\uA70E': return true;
-        case U'\uA70F': return true;
-        case U'\uA710': return true;
-        case U'\uA711': return true;
-        case U'\uA712': return true;
-        case U'\uA713': return true;
-        case U'\uA714': return true;
-        case U'\uA715': return true;
-        case U'\uA716': return true;
-        case U'\uA717': return true;
-        case U'\uA718': return true;
-        case U'\uA719': return true;
-        case U'\uA71A': return true;
-        case U'\uA71B': return true;
-        case U'\uA71C': return true;
-        case U'\uA71D': return true;
-        case U'\uA71E': return true;
-        case U'\uA71F': return true;
-        case U'\uA720': return true;
-        case U'\uA721': return true;
-        case U'\uA770': return true;
-        case U'\uA788': return true;
-        case U'\uA789': return true;
-        case U'\uA78A': return true;
-        case U'\uA7F1': return true;
-        case U'\uA7F2': return true;
-        case U'\uA7F3': return true;
-        case U'\uA7F4': return true;
-        case U'\uA7F8': return true;
-        case U'\uA7F9': return true;
-        case U'\uA802': return true;
-        case U'\uA806': return true;
-        case U'\uA80B': return true;
-        case U'\uA825': return true;
-        case U'\uA826': return true;
-        case U'\uA82C': return true;
-        case U'\uA8C4': return true;
-        case U'\uA8C5': return true;
-        case U'\uA8E0': return true;
-        case U'\uA8E1': return true;
-        case U'\uA8E2': return true;
-        case U'\uA8E3': return true;
-        case U'\uA8E4': return true;
-        case U'\uA8E5': return true;
-        case U'\uA8E6': return true;
-        case U'\uA8E7': return true;
-        case U'\uA8E8': return true;
-        case U'\uA8E9': return true;
-        case U'\uA8EA': return true;
-        case U'\uA8EB': return true;
-        case U'\uA8EC': return true;
-        case U'\uA8ED': return true;
-        case U'\uA8EE': return true;
-        case U'\uA8EF': return true;
-        case U'\uA8F0': return true;
-        case U'\uA8F1': return true;
-        case U'\uA8FF': return true;
-        case U'\uA926': return true;
-        case U'\uA927': return true;
-        case U'\uA928': return true;
-        case U'\uA929': return true;
-        case U'\uA92A': return true;
-        case U'\uA92B': return true;
-        case U'\uA92C': return true;
-        case U'\uA92D': return true;
-        case U'\uA947': return true;
-        case U'\uA948': return true;
-        case U'\uA949': return true;
-        case U'\uA94A': return true;
-        case U'\uA94B': return true;
-        case U'\uA94C': return true;
-        case U'\uA94D': return true;
-        case U'\uA94E': return true;
-        case U'\uA94F': return true;
-        case U'\uA950': return true;
-        case U'\uA951': return true;
-        case U'\uA980': return true;
-        case U'\uA981': return true;
-        case U'\uA982': return true;
-        case U'\uA9B3': return true;
-        case U'\uA9B6': return true;
-        case U'\uA9B7': return true;
-        case U'\uA9B8': return true;
-        case U'\uA9B9': return true;
-        case U'\uA9BC': return true;
-        case U'\uA9BD': return true;
-        case U'\uA9CF': return true;
-        case U'\uA9E5': return true;
-        case U'\uA9E6': return true;
-        case U'\uAA29': return true;
-        case U'\uAA2A': return true;
-        case U'\uAA2B': return true;
-        case U'\uAA2C': return true;
-        case U'\uAA2D': return true;
-        case U'\uAA2E': return true;
-        case U'\uAA31': return true;
-        case U'\uAA32': return true;
-        case U'\uAA35': return true;
-        case U'\uAA36': return true;
-        case U'\uAA43': return true;
-        case U'\uAA4C': return true;
-        case U'\uAA70': return true;
-        case U'\uAA7C': return true;
-        case U'\uAAB0': return true;
-        case U'\uAAB2': return true;
-        case U'\uAAB3': return true;
-        case U'\uAAB4': return true;
-        case U'\uAAB7': return true;
-        case U'\uAAB8': return true;
-        case U'\uAABE': return true;
-        case U'\uAABF': return true;
-        case U'\uAAC1': return true;
-        case U'\uAADD': return true;
-        case U'\uAAEC': return true;
-        case U'\uAAED': return true;
-        case U'\uAAF3': return true;
-        case U'\uAAF4': return true;
-        case U'\uAAF6': return true;
-        case U'\uAB5B': return true;
-        case U'\uAB5C': return true;
-        case U'\uAB5D': return true;
-        case U'\uAB5E': return true;
-        case U'\uAB5F': return true;
-        case U'\uAB69': return true;
-        case U'\uAB6A': return true;
-        case U'\uAB6B': return true;
-        case U'\uABE5': return true;
-        case U'\uABE8': return true;
-        case U'\uABED': return true;
-        case U'\uFB1E': return true;
-        case U'\uFBB2': return true;
-        case U'\uFBB3': return true;
-        case U'\uFBB4': return true;
-        case U'\uFBB5': return true;
-        case U'\uFBB6': return true;
-        case U'\uFBB7': return true;
-        case U'\uFBB8': return true;
-        case U'\uFBB9': return true;
-        case U'\uFBBA': return true;
-        case U'\uFBBB': return true;
-        case U'\uFBBC': return true;
-        case U'\uFBBD': return true;
-        case U'\uFBBE': return true;
-        case U'\uFBBF': return true;
-        case U'\uFBC0': return true;
-        case U'\uFBC1': return true;
-        case U'\uFBC2': return true;
-        case U'\uFE00': return true;
-        case U'\uFE01': return true;
-        case U'\uFE02': return true;
-        case U'\uFE03': return true;
-        case U'\uFE04': return true;
-        case U'\uFE05': return true;
-        case U'\uFE06': return true;
-        case U'\uFE07': return true;
-        case U'\uFE08': return true;
-        case U'\uFE09': return true;
-        case U'\uFE0A': return true;
-        case U'\uFE0B': return true;
-        case U'\uFE0C': return true;
-        case U'\uFE0D': return true;
-        case U'\uFE0E': return true;
-        case U'\uFE0F': return true;
-        case U'\uFE13': return true;
-        case U'\uFE20': return true;
-        case U'\uFE21': return true;
-        case U'\uFE22': return true;
-        case U'\uFE23': return true;
-        case U'\uFE24': return true;
-        case U'\uFE25': return true;
-        case U'\uFE26': return true;
-        case U'\uFE27': return true;
-        case U'\uFE28': return true;
-        case U'\uFE29': return true;
-        case U'\uFE2A': return true;
-        case U'\uFE2B': return true;
-        case U'\uFE2C': return true;
-        case U'\uFE2D': return true;
-        case U'\uFE2E': return true;
-        case U'\uFE2F': return true;
-        case U'\uFE52': return true;
-        case U'\uFE55': return true;
-        case U'\uFEFF': return true;
-        case U'\uFF07': return true;
-        case U'\uFF0E': return true;
-        case U'\uFF1A': return true;
-        case U'\uFF3E': return true;
-        case U'\uFF40': return true;
-        case U'\uFF70': return true;
-        case U'\uFF9E': return true;
-        case U'\uFF9F': return true;
-        case U'\uFFE3': return true;
-        case U'\uFFF9': return true;
-        case U'\uFFFA': return true;
-        case U'\uFFFB': return true;
-        case U'\U000101FD': return true;
-        case U'\U000102E0': return true;
-        case U'\U00010376': return true;
-        case U'\U00010377': return true;
-        case U'\U00010378': return true;
-        case U'\U00010379': return true;
-        case U'\U0001037A': return true;
-        case U'\U00010780': return true;
-        case U'\U00010781': return true;
-        case U'\U00010782': return true;
-        case U'\U00010783': return true;
-        case U'\U00010784': return true;
-        case U'\U00010785': return true;
-        case U'\U00010787': return true;
-        case U'\U00010788': return true;
-        case U'\U00010789': return true;
-        case U'\U0001078A': return true;
-        case U'\U0001078B': return true;
-        case U'\U0001078C': return true;
-        case U'\U0001078D': return true;
-        case U'\U0001078E': return true;
-        case U'\U0001078F': return true;
-        case U'\U00010790': return true;
-        case U'\U00010791': return true;
-        case U'\U00010792': return true;
-        case U'\U00010793': return true;
-        case U'\U00010794': return true;
-        case U'\U00010795': return true;
-        case U'\U00010796': return true;
-        case U'\U00010797': return true;
-        case U'\U00010798': return true;
-        case U'\U00010799': return true;
-        case U'\U0001079A': return true;
-        case U'\U0001079B': return true;
-        case U'\U0001079C': return true;
-        case U'\U0001079D': return true;
-        case U'\U0001079E': return true;
-        case U'\U0001079F': return true;
-        case U'\U000107A0': return true;
-        case U'\U000107A1': return true;
-        case U'\U000107A2': return true;
-        case U'\U000107A3': return true;
-        case U'\U000107A4': return true;
-        case U'\U000107A5': return true;
-        case U'\U000107A6': return true;
-        case U'\U000107A7': return true;
-        case U'\U000107A8': return true;
-        case U'\U000107A9': return true;
-        case U'\U000107AA': return true;
-        case U'\U000107AB': return true;
-        case U'\U000107AC': return true;
-        case U'\U000107AD': return true;
-        case U'\U000107AE': return true;
-        case U'\U000107AF': return true;
-        case U'\U000107B0': return true;
-        case U'\U000107B2': return true;
-        case U'\U000107B3': return true;
-        case U'\U000107B4': return true;
-        case U'\U000107B5': return true;
-        case U'\U000107B6': return true;
-        case U'\U000107B7': return true;
-        case U'\U000107B8': return true;
-        case U'\U000107B9': return true;
-        case U'\U000107BA': return true;
-        case U'\U00010A01': return true;
-        case U'\U00010A02': return true;
-        case U'\U00010A03': return true;
-        case U'\U00010A05': return true;
-        case U'\U00010A06': return true;
-        case U'\U00010A0C': return true;
-        case U'\U00010A0D': return true;
-        case U'\U00010A0E': return true;
-        case U'\U00010A0F': return true;
-        case U'\U00010A38': return true;
-        case U'\U00010A39': return true;
-        case U'\U00010A3A': return true;
-        case U'\U00010A3F': return true;
-        case U'\U00010AE5': return true;
-        case U'\U00010AE6': return true;
-        case U'\U00010D24': return true;
-        case U'\U00010D25': return true;
-        case U'\U00010D26': return true;
-        case U'\U00010D27': return true;
-        case U'\U00010D4E': return true;
-        case U'\U00010D69': return true;
-        case U'\U00010D6A': return true;
-        case U'\U00010D6B': return true;
-        case U'\U00010D6C': return true;
-        case U'\U00010D6D': return true;
-        case U'\U00010D6F': return true;
-        case U'\U00010EAB': return true;
-        case U'\U00010EAC': return true;
-        case U'\U00010EC5': return true;
-        case U'\U00010EFA': return true;
-        case U'\U00010EFB': return true;
-        case U'\U00010EFC': return true;
-        case U'\U00010EFD': return true;
-        case U'\U00010EFE': return true;
-        case U'\U00010EFF': return true;
-        case U'\U00010F46': return true;
-        case U'\U00010F47': return true;
-        case U'\U00010F48': return true;
-        case U'\U00010F49': return true;
-        case U'\U00010F4A': return true;
-        case U'\U00010F4B': return true;
-        case U'\U00010F4C': return true;
-        case U'\U00010F4D': return true;
-        case U'\U00010F4E': return true;
-        case U'\U00010F4F': return true;
-        case U'\U00010F50': return true;
-        case U'\U00010F82': return true;
-        case U'\U00010F83': return true;
-        case U'\U00010F84': return true;
-        case U'\U00010F85': return true;
-        case U'\U00011001': return true;
-        case U'\U00011038': return true;
-        case U'\U00011039': return true;
-        case U'\U0001103A': return true;
-        case U'\U0001103B': return true;
-        case U'\U0001103C': return true;
-        case U'\U0001103D': return true;
-        case U'\U0001103E': return true;
-        case U'\U0001103F': return true;
-        case U'\U00011040': return true;
-        case U'\U00011041': return true;
-        case U'\U00011042': return true;
-        case U'\U00011043': return true;
-        case U'\U00011044': return true;
-        case U'\U00011045': return true;
-        case U'\U00011046': return true;
-        case U'\U00011070': return true;
-        case U'\U00011073': return true;
-        case U'\U00011074': return true;
-        case U'\U0001107F': return true;
-        case U'\U00011080': return true;
-        case U'\U00011081': return true;
-        case U'\U000110B3': return true;
-        case U'\U000110B4': return true;
-        case U'\U000110B5': return true;
-        case U'\U000110B6': return true;
-        case U'\U000110B9': return true;
-        case U'\U000110BA': return true;
-        case U'\U000110BD': return true;
-        case U'\U000110C2': return true;
-        case U'\U000110CD': return true;
-        case U'\U00011100': return true;
-        case U'\U00011101': return true;
-        case U'\U00011102': return true;
-        case U'\U00011127': return true;
-        case U'\U00011128': return true;
-        case U'\U00011129': return true;
-        case U'\U0001112A': return true;
-        case U'\U0001112B': return true;
-        case U'\U0001112D': return true;
-        case U'\U0001112E': return true;
-        case U'\U0001112F': return true;
-        case U'\U00011130': return true;
-        case U'\U00011131': return true;
-        case U'\U00011132': return true;
-        case U'\U00011133': return true;
-        case U'\U00011134': return true;
-        case U'\U00011173': return true;
-        case U'\U00011180': return true;
-        case U'\U00011181': return true;
-        case U'\U000111B6': return true;
-        case U'\U000111B7': return true;
-        case U'\U000111B8': return true;
-        case U'\U000111B9': return true;
-        case U'\U000111BA': return true;
-        case U'\U000111BB': return true;
-        case U'\U000111BC': return true;
-        case U'\U000111BD': return true;
-        case U'\U000111BE': return true;
-        case U'\U000111C9': return true;
-        case U'\U000111CA': return true;
-        case U'\U000111CB': return true;
-        case U'\U000111CC': return true;
-        case U'\U000111CF': return true;
-        case U'\U0001122F': return true;
-        case U'\U00011230': return true;
-        case U'\U00011231': return true;
-        case U'\U00011234': return true;
-        case U'\U00011236': return true;
-        case U'\U00011237': return true;
-        case U'\U0001123E': return true;
-        case U'\U00011241': return true;
-        case U'\U000112DF': return true;
-        case U'\U000112E3': return true;
-        case U'\U000112E4': return true;
-        case U'\U000112E5': return true;
-        case U'\U000112E6': return true;
-        case U'\U000112E7': return true;
-        case U'\U000112E8': return true;
-        case U'\U000112E9': return true;
-        case U'\U000112EA': return true;
-        case U'\U00011300': return true;
-        case U'\U00011301': return true;
-        case U'\U0001133B': return true;
-        case U'\U0001133C': return true;
-        case U'\U00011340': return true;
-        case U'\U00011366': return true;
-        case U'\U00011367': return true;
-        case U'\U00011368': return true;
-        case U'\U00011369': return true;
-        case U'\U0001136A': return true;
-        case U'\U0001136B': return true;
-        case U'\U0001136C': return true;
-        case U'\U00011370': return true;
-        case U'\U00011371': return true;
-        case U'\U00011372': return true;
-        case U'\U00011373': return true;
-        case U'\U00011374': return true;
-        case U'\U000113BB': return true;
-        case U'\U000113BC': return true;
-        case U'\U000113BD': return true;
-        case U'\U000113BE': return true;
-        case U'\U000113BF': return true;
-        case U'\U000113C0': return true;
-        case U'\U000113CE': return true;
-        case U'\U000113D0': return true;
-        case U'\U000113D2': return true;
-        case U'\U000113E1': return true;
-        case U'\U000113E2': return true;
-        case U'\U00011438': return true;
-        case U'\U00011439': return true;
-        case U'\U0001143A': return true;
-        case U'\U0001143B': return true;
-        case U'\U0001143C': return true;
-        case U'\U0001143D': return true;
-        case U'\U0001143E': return true;
-        case U'\U0001143F': return true;
-        case U'\U00011442': return true;
-        case U'\U00011443': return true;
-        case U'\U00011444': return true;
-        case U'\U00011446': return true;
-        case U'\U0001145E': return true;
-        case U'\U000114B3': return true;
-        case U'\U000114B4': return true;
-        case U'\U000114B5': return true;
-        case U'\U000114B6': return true;
-        case U'\U000114B7': return true;
-        case U'\U000114B8': return true;
-        case U'\U000114BA': return true;
-        case U'\U000114BF': return true;
-        case U'\U000114C0': return true;
-        case U'\U000114C2': return true;
-        case U'\U000114C3': return true;
-        case U'\U000115B2': return true;
-        case U'\U000115B3': return true;
-        case U'\U000115B4': return true;
-        case U'\U000115B5': return true;
-        case U'\U000115BC': return true;
-        case U'\U000115BD': return true;
-        case U'\U000115BF': return true;
-        case U'\U000115C0': return true;
-        case U'\U000115DC': return true;
-        case U'\U000115DD': return true;
-        case U'\U00011633': return true;
-        case U'\U00011634': return true;
-        case U'\U00011635': return true;
-        case U'\U00011636': return true;
-        case U'\U00011637': return true;
-        case U'\U00011638': return true;
-        case U'\U00011639': return true;
-        case U'\U0001163A': return true;
-        case U'\U0001163D': return true;
-        case U'\U0001163F': return true;
-        case U'\U00011640': return true;
-        case U'\U000116AB': return true;
-        case U'\U000116AD': return true;
-        case U'\U000116B0': return true;
-        case U'\U000116B1': return true;
-        case U'\U000116B2': return true;
-        case U'\U000116B3': return true;
-        case U'\U000116B4': return true;
-        case U'\U000116B5': return true;
-        case U'\U000116B7': return true;
-        case U'\U0001171D': return true;
-        case U'\U0001171F': return true;
-        case U'\U00011722': return true;
-        case U'\U00011723': return true;
-        case U'\U00011724': return true;
-        case U'\U00011725': return true;
-        case U'\U00011727': return true;
-        case U'\U00011728': return true;
-        case U'\U00011729': return true;
-        case U'\U0001172A': return true;
-        case U'\U0001172B': return true;
-        case U'\U0001182F': return true;
-        case U'\U00011830': return true;
-        case U'\U00011831': return true;
-        case U'\U00011832': return true;
-        case U'\U00011833': return true;
-        case U'\U00011834': return true;
-        case U'\U00011835': return true;
-        case U'\U00011836': return true;
-        case U'\U00011837': return true;
-        case U'\U00011839': return true;
-        case U'\U0001183A': return true;
-        case U'\U0001193B': return true;
-        case U'\U0001193C': return true;
-        case U'\U0001193E': return true;
-        case U'\U00011943': return true;
-        case U'\U000119D4': return true;
-        case U'\U000119D5': return true;
-        case U'\U000119D6': return true;
-        case U'\U000119D7': return true;
-        case U'\U000119DA': return true;
-        case U'\U000119DB': return true;
-        case U'\U000119E0': return true;
-        case U'\U00011A01': return true;
-        case U'\U00011A02': return true;
-        case U'\U00011A03': return true;
-        case U'\U00011A04': return true;
-        case U'\U00011A05': return true;
-        case U'\U00011A06': return true;
-        case U'\U00011A07': return true;
-        case U'\U00011A08': return true;
-        case U'\U00011A09': return true;
-        case U'\U00011A0A': return true;
-        case U'\U00011A33': return true;
-        case U'\U00011A34': return true;
-        case U'\U00011A35': return true;
-        case U'\U00011A36': return true;
-        case U'\U00011A37': return true;
-        case U'\U00011A38': return true;
-        case U'\U00011A3B': return true;
-        case U'\U00011A3C': return true;
-        case U'\U00011A3D': return true;
-        case U'\U00011A3E': return true;
-        case U'\U00011A47': return true;
-        case U'\U00011A51': return true;
-        case U'\U00011A52': return true;
-        case U'\U00011A53': return true;
-        case U'\U00011A54': return true;
-        case U'\U00011A55': return true;
-        case U'\U00011A56': return true;
-        case U'\U00011A59': return true;
-        case U'\U00011A5A': return true;
-        case U'\U00011A5B': return true;
-        case U'\U00011A8A': return true;
-        case U'\U00011A8B': return true;
-        case U'\U00011A8C': return true;
-        case U'\U00011A8D': return true;
-        case U'\U00011A8E': return true;
-        case U'\U00011A8F': return true;
-        case U'\U00011A90': return true;
-        case U'\U00011A91': return true;
-        case U'\U00011A92': return true;
-        case U'\U00011A93': return true;
-        case U'\U00011A94': return true;
-        case U'\U00011A95': return true;
-        case U'\U00011A96': return true;
-        case U'\U00011A98': return true;
-        case U'\U00011A99': return true;
-        case U'\U00011B60': return true;
-        case U'\U00011B62': return true;
-        case U'\U00011B63': return true;
-        case U'\U00011B64': return true;
-        case U'\U00011B66': return true;
-        case U'\U00011C30': return true;
-        case U'\U00011C31': return true;
-        case U'\U00011C32': return true;
-        case U'\U00011C33': return true;
-        case U'\U00011C34': return true;
-        case U'\U00011C35': return true;
-        case U'\U00011C36': return true;
-        case U'\U00011C38': return true;
-        case U'\U00011C39': return true;
-        case U'\U00011C3A': return true;
-        case U'\U00011C3B': return true;
-        case U'\U00011C3C': return true;
-        case U'\U00011C3D': return true;
-        case U'\U00011C3F': return true;
-        case U'\U00011C92': return true;
-        case U'\U00011C93': return true;
-        case U'\U00011C94': return true;
-        case U'\U00011C95': return true;
-        case U'\U00011C96': return true;
-        case U'\U00011C97': return true;
-        case U'\U00011C98': return true;
-        case U'\U00011C99': return true;
-        case U'\U00011C9A': return true;
-        case U'\U00011C9B': return true;
-        case U'\U00011C9C': return true;
-        case U'\U00011C9D': return true;
-        case U'\U00011C9E': return true;
-        case U'\U00011C9F': return true;
-        case U'\U00011CA0': return true;
-        case U'\U00011CA1': return true;
-        case U'\U00011CA2': return true;
-        case U'\U00011CA3': return true;
-        case U'\U00011CA4': return true;
-        case U'\U00011CA5': return true;
-        case U'\U00011CA6': return true;
-        case U'\U00011CA7': return true;
-        case U'\U00011CAA': return true;
-        case U'\U00011CAB': return true;
-        case U'\U00011CAC': return true;
-        case U'\U00011CAD': return true;
-        case U'\U00011CAE': return true;
-        case U'\U00011CAF': return true;
-        case U'\U00011CB0': return true;
-        case U'\U00011CB2': return true;
-        case U'\U00011CB3': return true;
-        case U'\U00011CB5': return true;
-        case U'\U00011CB6': return true;
-        case U'\U00011D31': return true;
-        case U'\U00011D32': return true;
-        case U'\U00011D33': return true;
-        case U'\U00011D34': return true;
-        case U'\U00011D35': return true;
-        case U'\U00011D36': return true;
-        case U'\U00011D3A': return true;
-        case U'\U00011D3C': return true;
-        case U'\U00011D3D': return true;
-        case U'\U00011D3F': return true;
-        case U'\U00011D40': return true;
-        case U'\U00011D41': return true;
-        case U'\U00011D42': return true;
-        case U'\U00011D43': return true;
-        case U'\U00011D44': return true;
-        case U'\U00011D45': return true;
-        case U'\U00011D47': return true;
-        case U'\U00011D90': return true;
-        case U'\U00011D91': return true;
-        case U'\U00011D95': return true;
-        case U'\U00011D97': return true;
-        case U'\U00011DD9': return true;
-        case U'\U00011EF3': return true;
-        case U'\U00011EF4': return true;
-        case U'\U00011F00': return true;
-        case U'\U00011F01': return true;
-        case U'\U00011F36': return true;
-        case U'\U00011F37': return true;
-        case U'\U00011F38': return true;
-        case U'\U00011F39': return true;
-        case U'\U00011F3A': return true;
-        case U'\U00011F40': return true;
-        case U'\U00011F42': return true;
-        case U'\U00011F5A': return true;
-        case U'\U00013430': return true;
-        case U'\U00013431': return true;
-        case U'\U00013432': return true;
-        case U'\U00013433': return true;
-        case U'\U00013434': return true;
-        case U'\U00013435': return true;
-        case U'\U00013436': return true;
-        case U'\U00013437': return true;
-        case U'\U00013438': return true;
-        case U'\U00013439': return true;
-        case U'\U0001343A': return true;
-        case U'\U0001343B': return true;
-        case U'\U0001343C': return true;
-        case U'\U0001343D': return true;
-        case U'\U0001343E': return true;
-        case U'\U0001343F': return true;
-        case U'\U00013440': return true;
-        case U'\U00013447': return true;
-        case U'\U00013448': return true;
-        case U'\U00013449': return true;
-        case U'\U0001344A': return true;
-        case U'\U0001344B': return true;
-        case U'\U0001344C': return true;
-        case U'\U0001344D': return true;
-        case U'\U0001344E': return true;
-        case U'\U0001344F': return true;
-        case U'\U00013450': return true;
-        case U'\U00013451': return true;
-        case U'\U00013452': return true;
-        case U'\U00013453': return true;
-        case U'\U00013454': return true;
-        case U'\U00013455': return true;
-        case U'\U0001611E': return true;
-        case U'\U0001611F': return true;
-        case U'\U00016120': return true;
-        case U'\U00016121': return true;
-        case U'\U00016122': return true;
-        case U'\U00016123': return true;
-        case U'\U00016124': return true;
-        case U'\U00016125': return true;
-        case U'\U00016126': return true;
-        case U'\U00016127': return true;
-        case U'\U00016128': return true;
-        case U'\U00016129': return true;
-        case U'\U0001612D': return true;
-        case U'\U0001612E': return true;
-        case U'\U0001612F': return true;
-        case U'\U00016AF0': return true;
-        case U'\U00016AF1': return true;
-        case U'\U00016AF2': return true;
-        case U'\U00016AF3': return true;
-        case U'\U00016AF4': return true;
-        case U'\U00016B30': return true;
-        case U'\U00016B31': return true;
-        case U'\U00016B32': return true;
-        case U'\U00016B33': return true;
-        case U'\U00016B34': return true;
-        case U'\U00016B35': return true;
-        case U'\U00016B36': return true;
-        case U'\U00016B40': return true;
-        case U'\U00016B41': return true;
-        case U'\U00016B42': return true;
-        case U'\U00016B43': return true;
-        case U'\U00016D40': return true;
-        case U'\U00016D41': return true;
-        case U'\U00016D42': return true;
-        case U'\U00016D6B': return true;
-        case U'\U00016D6C': return true;
-        case U'\U00016F4F': return true;
-        case U'\U00016F8F': return true;
-        case U'\U00016F90': return true;
-        case U'\U00016F91': return true;
-        case U'\U00016F92': return true;
-        case U'\U00016F93': return true;
-        case U'\U00016F94': return true;
-        case U'\U00016F95': return true;
-        case U'\U00016F96': return true;
-        case U'\U00016F97': return true;
-        case U'\U00016F98': return true;
-        case U'\U00016F99': return true;
-        case U'\U00016F9A': return true;
-        case U'\U00016F9B': return true;
-        case U'\U00016F9C': return true;
-        case U'\U00016F9D': return true;
-        case U'\U00016F9E': return true;
-        case U'\U00016F9F': return true;
-        case U'\U00016FE0': return true;
-        case U'\U00016FE1': return true;
-        case U'\U00016FE3': return true;
-        case U'\U00016FE4': return true;
-        case U'\U00016FF2': return true;
-        case U'\U00016FF3': return true;
-        case U'\U0001AFF0': return true;
-        case U'\U0001AFF1': return true;
-        case U'\U0001AFF2': return true;
-        case U'\U0001AFF3': return true;
-        case U'\U0001AFF5': return true;
-        case U'\U0001AFF6': return true;
-        case U'\U0001AFF7': return true;
-        case U'\U0001AFF8': return true;
-        case U'\U0001AFF9': return true;
-        case U'\U0001AFFA': return true;
-        case U'\U0001AFFB': return true;
-        case U'\U0001AFFD': return true;
-        case U'\U0001AFFE': return true;
-        case U'\U0001BC9D': return true;
-        case U'\U0001BC9E': return true;
-        case U'\U0001BCA0': return true;
-        case U'\U0001BCA1': return true;
-        case U'\U0001BCA2': return true;
-        case U'\U0001BCA3': return true;
-        case U'\U0001CF00': return true;
-        case U'\U0001CF01': return true;
-        case U'\U0001CF02': return true;
-        case U'\U0001CF03': return true;
-        case U'\U0001CF04': return true;
-        case U'\U0001CF05': return true;
-        case U'\U0001CF06': return true;
-        case U'\U0001CF07': return true;
-        case U'\U0001CF08': return true;
-        case U'\U0001CF09': return true;
-        case U'\U0001CF0A': return true;
-        case U'\U0001CF0B': return true;
-        case U'\U0001CF0C': return true;
-        case U'\U0001CF0D': return true;
-        case U'\U0001CF0E': return true;
-        case U'\U0001CF0F': return true;
-        case U'\U0001CF10': return true;
-        case U'\U0001CF11': return true;
-        case U'\U0001CF12': return true;
-        case U'\U0001CF13': return true;
-        case U'\U0001CF14': return true;
-        case U'\U0001CF15': return true;
-        case U'\U0001CF16': return true;
-        case U'\U0001CF17': return true;
-        case U'\U0001CF18': return true;
-        case U'\U0001CF19': return true;
-        case U'\U0001CF1A': return true;
-        case U'\U0001CF1B': return true;
-        case U'\U0001CF1C': return true;
-        case U'\U0001CF1D': return true;
-        case U'\U0001CF1E': return true;
-        case U'\U0001CF1F': return true;
-        case U'\U0001CF20': return true;
-        case U'\U0001CF21': return true;
-        case U'\U0001CF22': return true;
-        case U'\U0001CF23': return true;
-        case U'\U0001CF24': return true;
-        case U'\U0001CF25': return true;
-        case U'\U0001CF26': return true;
-        case U'\U0001CF27': return true;
-        case U'\U0001CF28': return true;
-        case U'\U0001CF29': return true;
-        case U'\U0001CF2A': return true;
-        case U'\U0001CF2B': return true;
-        case U'\U0001CF2C': return true;
-        case U'\U0001CF2D': return true;
-        case U'\U0001CF30': return true;
-        case U'\U0001CF31': return true;
-        case U'\U0001CF32': return true;
-        case U'\U0001CF33': return true;
-        case U'\U0001CF34': return true;
-        case U'\U0001CF35': return true;
-        case U'\U0001CF36': return true;
-        case U'\U0001CF37': return true;
-        case U'\U0001CF38': return true;
-        case U'\U0001CF39': return true;
-        case U'\U0001CF3A': return true;
-        case U'\U0001CF3B': return true;
-        case U'\U0001CF3C': return true;
-        case U'\U0001CF3D': return true;
-        case U'\U0001CF3E': return true;
-        case U'\U0001CF3F': return true;
-        case U'\U0001CF40': return true;
-        case U'\U0001CF41': return true;
-        case U'\U0001CF42': return true;
-        case U'\U0001CF43': return true;
-        case U'\U0001CF44': return true;
-        case U'\U0001CF45': return true;
-        case U'\U0001CF46': return true;
-        case U'\U0001D167': return true;
-        case U'\U0001D168': return true;
-        case U'\U0001D169': return true;
-        case U'\U0001D173': return true;
-        case U'\U0001D174': return true;
-        case U'\U0001D175': return true;
-        case U'\U0001D176': return true;
-        case U'\U0001D177': return true;
-        case U'\U0001D178': return true;
-        case U'\U0001D179': return true;
-        case U'\U0001D17A': return true;
-        case U'\U0001D17B': return true;
-        case U'\U0001D17C': return true;
-        case U'\U0001D17D': return true;
-        case U'\U0001D17E': return true;
-        case U'\U0001D17F': return true;
-        case U'\U0001D180': return true;
-        case U'\U0001D181': return true;
-        case U'\U0001D182': return true;
-        case U'\U0001D185': return true;
-        case U'\U0001D186': return true;
-        case U'\U0001D187': return true;
-        case U'\U0001D188': return true;
-        case U'\U0001D189': return true;
-        case U'\U0001D18A': return true;
-        case U'\U0001D18B': return true;
-        case U'\U0001D1AA': return true;
-        case U'\U0001D1AB': return true;
-        case U'\U0001D1AC': return true;
-        case U'\U0001D1AD': return true;
-        case U'\U0001D242': return true;
-        case U'\U0001D243': return true;
-        case U'\U0001D244': return true;
-        case U'\U0001DA00': return true;
-        case U'\U0001DA01': return true;
-        case U'\U0001DA02': return true;
-        case U'\U0001DA03': return true;
-        case U'\U0001DA04': return true;
-        case U'\U0001DA05': return true;
-        case U'\U0001DA06': return true;
-        case U'\U0001DA07': return true;
-        case U'\U0001DA08': return true;
-        case U'\U0001DA09': return true;
-        case U'\U0001DA0A': return true;
-        case U'\U0001DA0B': return true;
-        case U'\U0001DA0C': return true;
-        case U'\U0001DA0D': return true;
-        case U'\U0001DA0E': return true;
-        case U'\U0001DA0F': return true;
-        case U'\U0001DA10': return true;
-        case U'\U0001DA11': return true;
-        case U'\U0001DA12': return true;
-        case U'\U0001DA13': return true;
-        case U'\U0001DA14': return true;
-        case U'\U0001DA15': return true;
-        case U'\U0001DA16': return true;
-        case U'\U0001DA17': return true;
-        case U'\U0001DA18': return true;
-        case U'\U0001DA19': return true;
-        case U'\U0001DA1A': return true;
-        case U'\U0001DA1B': return true;
-        case U'\U0001DA1C': return true;
-        case U'\U0001DA1D': return true;
-        case U'\U0001DA1E': return true;
-        case U'\U0001DA1F': return true;
-        case U'\U0001DA20': return true;
-        case U'\U0001DA21': return true;
-        case U'\U0001DA22': return true;
-        case U'\U0001DA23': return true;
-        case U'\U0001DA24': return true;
-        case U'\U0001DA25': return true;
-        case U'\U0001DA26': return true;
-        case U'\U0001DA27': return true;
-        case U'\U0001DA28': return true;
-        case U'\U0001DA29': return true;
-        case U'\U0001DA2A': return true;
-        case U'\U0001DA2B': return true;
-        case U'\U0001DA2C': return true;
-        case U'\U0001DA2D': return true;
-        case U'\U0001DA2E': return true;
-        case U'\U0001DA2F': return true;
-        case U'\U0001DA30': return true;
-        case U'\U0001DA31': return true;
-        case U'\U0001DA32': return true;
-        case U'\U0001DA33': return true;
-        case U'\U0001DA34': return true;
-        case U'\U0001DA35': return true;
-        case U'\U0001DA36': return true;
-        case U'\U0001DA3B': return true;
-        case U'\U0001DA3C': return true;
-        case U'\U0001DA3D': return true;
-        case U'\U0001DA3E': return true;
-        case U'\U0001DA3F': return true;
-        case U'\U0001DA40': return true;
-        case U'\U0001DA41': return true;
-        case U'\U0001DA42': return true;
-        case U'\U0001DA43': return true;
-        case U'\U0001DA44': return true;
-        case U'\U0001DA45': return true;
-        case U'\U0001DA46': return true;
-        case U'\U0001DA47': return true;
-        case U'\U0001DA48': return true;
-        case U'\U0001DA49': return true;
-        case U'\U0001DA4A': return true;
-        case U'\U0001DA4B': return true;
-        case U'\U0001DA4C': return true;
-        case U'\U0001DA4D': return true;
-        case U'\U0001DA4E': return true;
-        case U'\U0001DA4F': return true;
-        case U'\U0001DA50': return true;
-        case U'\U0001DA51': return true;
-        case U'\U0001DA52': return true;
-        case U'\U0001DA53': return true;
-        case U'\U0001DA54': return true;
-        case U'\U0001DA55': return true;
-        case U'\U0001DA56': return true;
-        case U'\U0001DA57': return true;
-        case U'\U0001DA58': return true;
-        case U'\U0001DA59': return true;
-        case U'\U0001DA5A': return true;
-        case U'\U0001DA5B': return true;
-        case U'\U0001DA5C': return true;
-        case U'\U0001DA5D': return true;
-        case U'\U0001DA5E': return true;
-        case U'\U0001DA5F': return true;
-        case U'\U0001DA60': return true;
-        case U'\U0001DA61': return true;
-        case U'\U0001DA62': return true;
-        case U'\U0001DA63': return true;
-        case U'\U0001DA64': return true;
-        case U'\U0001DA65': return true;
-        case U'\U0001DA66': return true;
-        case U'\U0001DA67': return true;
-        case U'\U0001DA68': return true;
-        case U'\U0001DA69': return true;
-        case U'\U0001DA6A': return true;
-        case U'\U0001DA6B': return true;
-        case U'\U0001DA6C': return true;
-        case U'\U0001DA75': return true;
-        case U'\U0001DA84': return true;
-        case U'\U0001DA9B': return true;
-        case U'\U0001DA9C': return true;
-        case U'\U0001DA9D': return true;
-        case U'\U0001DA9E': return true;
-        case U'\U0001DA9F': return true;
-        case U'\U0001DAA1': return true;
-        case U'\U0001DAA2': return true;
-        case U'\U0001DAA3': return true;
-        case U'\U0001DAA4': return true;
-        case U'\U0001DAA5': return true;
-        case U'\U0001DAA6': return true;
-        case U'\U0001DAA7': return true;
-        case U'\U0001DAA8': return true;
-        case U'\U0001DAA9': return true;
-        case U'\U0001DAAA': return true;
-        case U'\U0001DAAB': return true;
-        case U'\U0001DAAC': return true;
-        case U'\U0001DAAD': return true;
-        case U'\U0001DAAE': return true;
-        case U'\U0001DAAF': return true;
-        case U'\U0001E000': return true;
-        case U'\U0001E001': return true;
-        case U'\U0001E002': return true;
-        case U'\U0001E003': return true;
-        case U'\U0001E004': return true;
-        case U'\U0001E005': return true;
-        case U'\U0001E006': return true;
-        case U'\U0001E008': return true;
-        case U'\U0001E009': return true;
-        case U'\U0001E00A': return true;
-        case U'\U0001E00B': return true;
-        case U'\U0001E00C': return true;
-        case U'\U0001E00D': return true;
-        case U'\U0001E00E': return true;
-        case U'\U0001E00F': return true;
-        case U'\U0001E010': return true;
-        case U'\U0001E011': return true;
-        case U'\U0001E012': return true;
-        case U'\U0001E013': return true;
-        case U'\U0001E014': return true;
-        case U'\U0001E015': return true;
-        case U'\U0001E016': return true;
-        case U'\U0001E017': return true;
-        case U'\U0001E018': return true;
-        case U'\U0001E01B': return true;
-        case U'\U0001E01C': return true;
-        case U'\U0001E01D': return true;
-        case U'\U0001E01E': return true;
-        case U'\U0001E01F': return true;
-        case U'\U0001E020': return true;
-        case U'\U0001E021': return true;
-        case U'\U0001E023': return true;
-        case U'\U0001E024': return true;
-        case U'\U0001E026': return true;
-        case U'\U0001E027': return true;
-        case U'\U0001E028': return true;
-        case U'\U0001E029': return true;
-        case U'\U0001E02A': return true;
-        case U'\U0001E030': return true;
-        case U'\U0001E031': return true;
-        case U'\U0001E032': return true;
-        case U'\U0001E033': return true;
-        case U'\U0001E034': return true;
-        case U'\U0001E035': return true;
-        case U'\U0001E036': return true;
-        case U'\U0001E037': return true;
-        case U'\U0001E038': return true;
-        case U'\U0001E039': return true;
-        case U'\U0001E03A': return true;
-        case U'\U0001E03B': return true;
-        case U'\U0001E03C': return true;
-        case U'\U0001E03D': return true;
-        case U'\U0001E03E': return true;
-        case U'\U0001E03F': return true;
-        case U'\U0001E040': return true;
-        case U'\U0001E041': return true;
-        case U'\U0001E042': return true;
-        case U'\U0001E043': return true;
-        case U'\U0001E044': return true;
-        case U'\U0001E045': return true;
-        case U'\U0001E046': return true;
-        case U'\U0001E047': return true;
-        case U'\U0001E048': return true;
-        case U'\U0001E049': return true;
-        case U'\U0001E04A': return true;
-        case U'\U0001E04B': return true;
-        case U'\U0001E04C': return true;
-        case U'\U0001E04D': return true;
-        case U'\U0001E04E': return true;
-        case U'\U0001E04F': return true;
-        case U'\U0001E050': return true;
-        case U'\U0001E051': return true;
-        case U'\U0001E052': return true;
-        case U'\U0001E053': return true;
-        case U'\U0001E054': return true;
-        case U'\U0001E055': return true;
-        case U'\U0001E056': return true;
-        case U'\U0001E057': return true;
-        case U'\U0001E058': return true;
-        case U'\U0001E059': return true;
-        case U'\U0001E05A': return true;
-        case U'\U0001E05B': return true;
-        case U'\U0001E05C': return true;
-        case U'\U0001E05D': return true;
-        case U'\U0001E05E': return true;
-        case U'\U0001E05F': return true;
-        case U'\U0001E060': return true;
-        case U'\U0001E061': return true;
-        case U'\U0001E062': return true;
-        case U'\U0001E063': return true;
-        case U'\U0001E064': return true;
-        case U'\U0001E065': return true;
-        case U'\U0001E066': return true;
-        case U'\U0001E067': return true;
-        case U'\U0001E068': return true;
-        case U'\U0001E069': return true;
-        case U'\U0001E06A': return true;
-        case U'\U0001E06B': return true;
-        case U'\U0001E06C': return true;
-        case U'\U0001E06D': return true;
-        case U'\U0001E08F': return true;
-        case U'\U0001E130': return true;
-        case U'\U0001E131': return true;
-        case U'\U0001E132': return true;
-        case U'\U0001E133': return true;
-        case U'\U0001E134': return true;
-        case U'\U0001E135': return true;
-        case U'\U0001E136': return true;
-        case U'\U0001E137': return true;
-        case U'\U0001E138': return true;
-        case U'\U0001E139': return true;
-        case U'\U0001E13A': return true;
-        case U'\U0001E13B': return true;
-        case U'\U0001E13C': return true;
-        case U'\U0001E13D': return true;
-        case U'\U0001E2AE': return true;
-        case U'\U0001E2EC': return true;
-        case U'\U0001E2ED': return true;
-        case U'\U0001E2EE': return true;
-        case U'\U0001E2EF': return true;
-        case U'\U0001E4EB': return true;
-        case U'\U0001E4EC': return true;
-        case U'\U0001E4ED': return true;
-        case U'\U0001E4EE': return true;
-        case U'\U0001E4EF': return true;
-        case U'\U0001E5EE': return true;
-        case U'\U0001E5EF': return true;
-        case U'\U0001E6E3': return true;
-        case U'\U0001E6E6': return true;
-        case U'\U0001E6EE': return true;
-        case U'\U0001E6EF': return true;
-        case U'\U0001E6F5': return true;
-        case U'\U0001E6FF': return true;
-        case U'\U0001E8D0': return true;
-        case U'\U0001E8D1': return true;
-        case U'\U0001E8D2': return true;
-        case U'\U0001E8D3': return true;
-        case U'\U0001E8D4': return true;
-        case U'\U0001E8D5': return true;
-        case U'\U0001E8D6': return true;
-        case U'\U0001E944': return true;
-        case U'\U0001E945': return true;
-        case U'\U0001E946': return true;
-        case U'\U0001E947': return true;
-        case U'\U0001E948': return true;
-        case U'\U0001E949': return true;
-        case U'\U0001E94A': return true;
-        case U'\U0001E94B': return true;
-        case U'\U0001F3FB': return true;
-        case U'\U0001F3FC': return true;
-        case U'\U0001F3FD': return true;
-        case U'\U0001F3FE': return true;
-        case U'\U0001F3FF': return true;
-        case U'\U000E0001': return true;
-        case U'\U000E0020': return true;
-        case U'\U000E0021': return true;
-        case U'\U000E0022': return true;
-        case U'\U000E0023': return true;
-        case U'\U000E0024': return true;
-        case U'\U000E0025': return true;
-        case U'\U000E0026': return true;
-        case U'\U000E0027': return true;
-        case U'\U000E0028': return true;
-        case U'\U000E0029': return true;
-        case U'\U000E002A': return true;
-        case U'\U000E002B': return true;
-        case U'\U000E002C': return true;
-        case U'\U000E002D': return true;
-        case U'\U000E002E': return true;
-        case U'\U000E002F': return true;
-        case U'\U000E0030': return true;
-        case U'\U000E0031': return true;
-        case U'\U000E0032': return true;
-        case U'\U000E0033': return true;
-        case U'\U000E0034': return true;
-        case U'\U000E0035': return true;
-        case U'\U000E0036': return true;
-        case U'\U000E0037': return true;
-        case U'\U000E0038': return true;
-        case U'\U000E0039': return true;
-        case U'\U000E003A': return true;
-        case U'\U000E003B': return true;
-        case U'\U000E003C': return true;
-        case U'\U000E003D': return true;
-        case U'\U000E003E': return true;
-        case U'\U000E003F': return true;
-        case U'\U000E0040': return true;
-        case U'\U000E0041': return true;
-        case U'\U000E0042': return true;
-        case U'\U000E0043': return true;
-        case U'\U000E0044': return true;
-        case U'\U000E0045': return true;
-        case U'\U000E0046': return true;
-        case U'\U000E0047': return true;
-        case U'\U000E0048': return true;
-        case U'\U000E0049': return true;
-        case U'\U000E004A': return true;
-        case U'\U000E004B': return true;
-        case U'\U000E004C': return true;
-        case U'\U000E004D': return true;
-        case U'\U000E004E': return true;
-        case U'\U000E004F': return true;
-        case U'\U000E0050': return true;
-        case U'\U000E0051': return true;
-        case U'\U000E0052': return true;
-        case U'\U000E0053': return true;
-        case U'\U000E0054': return true;
-        case U'\U000E0055': return true;
-        case U'\U000E0056': return true;
-        case U'\U000E0057': return true;
-        case U'\U000E0058': return true;
-        case U'\U000E0059': return true;
-        case U'\U000E005A': return true;
-        case U'\U000E005B': return true;
-        case U'\U000E005C': return true;
-        case U'\U000E005D': return true;
-        case U'\U000E005E': return true;
-        case U'\U000E005F': return true;
-        case U'\U000E0060': return true;
-        case U'\U000E0061': return true;
-        case U'\U000E0062': return true;
-        case U'\U000E0063': return true;
-        case U'\U000E0064': return true;
-        case U'\U000E0065': return true;
-        case U'\U000E0066': return true;
-        case U'\U000E0067': return true;
-        case U'\U000E0068': return true;
-        case U'\U000E0069': return true;
-        case U'\U000E006A': return true;
-        case U'\U000E006B': return true;
-        case U'\U000E006C': return true;
-        case U'\U000E006D': return true;
-        case U'\U000E006E': return true;
-        case U'\U000E006F': return true;
-        case U'\U000E0070': return true;
-        case U'\U000E0071': return true;
-        case U'\U000E0072': return true;
-        case U'\U000E0073': return true;
-        case U'\U000E0074': return true;
-        case U'\U000E0075': return true;
-        case U'\U000E0076': return true;
-        case U'\U000E0077': return true;
-        case U'\U000E0078': return true;
-        case U'\U000E0079': return true;
-        case U'\U000E007A': return true;
-        case U'\U000E007B': return true;
-        case U'\U000E007C': return true;
-        case U'\U000E007D': return true;
-        case U'\U000E007E': return true;
-        case U'\U000E007F': return true;
-        case U'\U000E0100': return true;
-        case U'\U000E0101': return true;
-        case U'\U000E0102': return true;
-        case U'\U000E0103': return true;
-        case U'\U000E0104': return true;
-        case U'\U000E0105': return true;
-        case U'\U000E0106': return true;
-        case U'\U000E0107': return true;
-        case U'\U000E0108': return true;
-        case U'\U000E0109': return true;
-        case U'\U000E010A': return true;
-        case U'\U000E010B': return true;
-        case U'\U000E010C': return true;
-        case U'\U000E010D': return true;
-        case U'\U000E010E': return true;
-        case U'\U000E010F': return true;
-        case U'\U000E0110': return true;
-        case U'\U000E0111': return true;
-        case U'\U000E0112': return true;
-        case U'\U000E0113': return true;
-        case U'\U000E0114': return true;
-        case U'\U000E0115': return true;
-        case U'\U000E0116': return true;
-        case U'\U000E0117': return true;
-        case U'\U000E0118': return true;
-        case U'\U000E0119': return true;
-        case U'\U000E011A': return true;
-        case U'\U000E011B': return true;
-        case U'\U000E011C': return true;
-        case U'\U000E011D': return true;
-        case U'\U000E011E': return true;
-        case U'\U000E011F': return true;
-        case U'\U000E0120': return true;
-        case U'\U000E0121': return true;
-        case U'\U000E0122': return true;
-        case U'\U000E0123': return true;
-        case U'\U000E0124': return true;
-        case U'\U000E0125': return true;
-        case U'\U000E0126': return true;
-        case U'\U000E0127': return true;
-        case U'\U000E0128': return true;
-        case U'\U000E0129': return true;
-        case U'\U000E012A': return true;
-        case U'\U000E012B': return true;
-        case U'\U000E012C': return true;
-        case U'\U000E012D': return true;
-        case U'\U000E012E': return true;
-        case U'\U000E012F': return true;
-        case U'\U000E0130': return true;
-        case U'\U000E0131': return true;
-        case U'\U000E0132': return true;
-        case U'\U000E0133': return true;
-        case U'\U000E0134': return true;
-        case U'\U000E0135': return true;
-        case U'\U000E0136': return true;
-        case U'\U000E0137': return true;
-        case U'\U000E0138': return true;
-        case U'\U000E0139': return true;
-        case U'\U000E013A': return true;
-        case U'\U000E013B': return true;
-        case U'\U000E013C': return true;
-        case U'\U000E013D': return true;
-        case U'\U000E013E': return true;
-        case U'\U000E013F': return true;
-        case U'\U000E0140': return true;
-        case U'\U000E0141': return true;
-        case U'\U000E0142': return true;
-        case U'\U000E0143': return true;
-        case U'\U000E0144': return true;
-        case U'\U000E0145': return true;
-        case U'\U000E0146': return true;
-        case U'\U000E0147': return true;
-        case U'\U000E0148': return true;
-        case U'\U000E0149': return true;
-        case U'\U000E014A': return true;
-        case U'\U000E014B': return true;
-        case U'\U000E014C': return true;
-        case U'\U000E014D': return true;
-        case U'\U000E014E': return true;
-        case U'\U000E014F': return true;
-        case U'\U000E0150': return true;
-        case U'\U000E0151': return true;
-        case U'\U000E0152': return true;
-        case U'\U000E0153': return true;
-        case U'\U000E0154': return true;
-        case U'\U000E0155': return true;
-        case U'\U000E0156': return true;
-        case U'\U000E0157': return true;
-        case U'\U000E0158': return true;
-        case U'\U000E0159': return true;
-        case U'\U000E015A': return true;
-        case U'\U000E015B': return true;
-        case U'\U000E015C': return true;
-        case U'\U000E015D': return true;
-        case U'\U000E015E': return true;
-        case U'\U000E015F': return true;
-        case U'\U000E0160': return true;
-        case U'\U000E0161': return true;
-        case U'\U000E0162': return true;
-        case U'\U000E0163': return true;
-        case U'\U000E0164': return true;
-        case U'\U000E0165': return true;
-        case U'\U000E0166': return true;
-        case U'\U000E0167': return true;
-        case U'\U000E0168': return true;
-        case U'\U000E0169': return true;
-        case U'\U000E016A': return true;
-        case U'\U000E016B': return true;
-        case U'\U000E016C': return true;
-        case U'\U000E016D': return true;
-        case U'\U000E016E': return true;
-        case U'\U000E016F': return true;
-        case U'\U000E0170': return true;
-        case U'\U000E0171': return true;
-        case U'\U000E0172': return true;
-        case U'\U000E0173': return true;
-        case U'\U000E0174': return true;
-        case U'\U000E0175': return true;
-        case U'\U000E0176': return true;
-        case U'\U000E0177': return true;
-        case U'\U000E0178': return true;
-        case U'\U000E0179': return true;
-        case U'\U000E017A': return true;
-        case U'\U000E017B': return true;
-        case U'\U000E017C': return true;
-        case U'\U000E017D': return true;
-        case U'\U000E017E': return true;
-        case U'\U000E017F': return true;
-        case U'\U000E0180': return true;
-        case U'\U000E0181': return true;
-        case U'\U000E0182': return true;
-        case U'\U000E0183': return true;
-        case U'\U000E0184': return true;
-        case U'\U000E0185': return true;
-        case U'\U000E0186': return true;
-        case U'\U000E0187': return true;
-        case U'\U000E0188': return true;
-        case U'\U000E0189': return true;
-        case U'\U000E018A': return true;
-        case U'\U000E018B': return true;
-        case U'\U000E018C': return true;
-        case U'\U000E018D': return true;
-        case U'\U000E018E': return true;
-        case U'\U000E018F': return true;
-        case U'\U000E0190': return true;
-        case U'\U000E0191': return true;
-        case U'\U000E0192': return true;
-        case U'\U000E0193': return true;
-        case U'\U000E0194': return true;
-        case U'\U000E0195': return true;
-        case U'\U000E0196': return true;
-        case U'\U000E0197': return true;
-        case U'\U000E0198': return true;
-        case U'\U000E0199': return true;
-        case U'\U000E019A': return true;
-        case U'\U000E019B': return true;
-        case U'\U000E019C': return true;
-        case U'\U000E019D': return true;
-        case U'\U000E019E': return true;
-        case U'\U000E019F': return true;
-        case U'\U000E01A0': return true;
-        case U'\U000E01A1': return true;
-        case U'\U000E01A2': return true;
-        case U'\U000E01A3': return true;
-        case U'\U000E01A4': return true;
-        case U'\U000E01A5': return true;
-        case U'\U000E01A6': return true;
-        case U'\U000E01A7': return true;
-        case U'\U000E01A8': return true;
-        case U'\U000E01A9': return true;
-        case U'\U000E01AA': return true;
-        case U'\U000E01AB': return true;
-        case U'\U000E01AC': return true;
-        case U'\U000E01AD': return true;
-        case U'\U000E01AE': return true;
-        case U'\U000E01AF': return true;
-        case U'\U000E01B0': return true;
-        case U'\U000E01B1': return true;
-        case U'\U000E01B2': return true;
-        case U'\U000E01B3': return true;
-        case U'\U000E01B4': return true;
-        case U'\U000E01B5': return true;
-        case U'\U000E01B6': return true;
-        case U'\U000E01B7': return true;
-        case U'\U000E01B8': return true;
-        case U'\U000E01B9': return true;
-        case U'\U000E01BA': return true;
-        case U'\U000E01BB': return true;
-        case U'\U000E01BC': return true;
-        case U'\U000E01BD': return true;
-        case U'\U000E01BE': return true;
-        case U'\U000E01BF': return true;
-        case U'\U000E01C0': return true;
-        case U'\U000E01C1': return true;
-        case U'\U000E01C2': return true;
-        case U'\U000E01C3': return true;
-        case U'\U000E01C4': return true;
-        case U'\U000E01C5': return true;
-        case U'\U000E01C6': return true;
-        case U'\U000E01C7': return true;
-        case U'\U000E01C8': return true;
-        case U'\U000E01C9': return true;
-        case U'\U000E01CA': return true;
-        case U'\U000E01CB': return true;
-        case U'\U000E01CC': return true;
-        case U'\U000E01CD': return true;
-        case U'\U000E01CE': return true;
-        case U'\U000E01CF': return true;
-        case U'\U000E01D0': return true;
-        case U'\U000E01D1': return true;
-        case U'\U000E01D2': return true;
-        case U'\U000E01D3': return true;
-        case U'\U000E01D4': return true;
-        case U'\U000E01D5': return true;
-        case U'\U000E01D6': return true;
-        case U'\U000E01D7': return true;
-        case U'\U000E01D8': return true;
-        case U'\U000E01D9': return true;
-        case U'\U000E01DA': return true;
-        case U'\U000E01DB': return true;
-        case U'\U000E01DC': return true;
-        case U'\U000E01DD': return true;
-        case U'\U000E01DE': return true;
-        case U'\U000E01DF': return true;
-        case U'\U000E01E0': return true;
-        case U'\U000E01E1': return true;
-        case U'\U000E01E2': return true;
-        case U'\U000E01E3': return true;
-        case U'\U000E01E4': return true;
-        case U'\U000E01E5': return true;
-        case U'\U000E01E6': return true;
-        case U'\U000E01E7': return true;
-        case U'\U000E01E8': return true;
-        case U'\U000E01E9': return true;
-        case U'\U000E01EA': return true;
-        case U'\U000E01EB': return true;
-        case U'\U000E01EC': return true;
-        case U'\U000E01ED': return true;
-        case U'\U000E01EE': return true;
-        case U'\U000E01EF': return true;
-        default: return false;
-        }
-    }
+    inline constexpr uint_least8_t casing_flag_cased = 0x1u;
     /// @internal
     /// @ingroup sys_internal
-    constexpr bool dchar_is_soft_dotted(const char32_t c) noexcept
-    {
-        switch (c)
-        {
-        case U'\u0069': return true;
-        case U'\u006A': return true;
-        case U'\u012F': return true;
-        case U'\u0249': return true;
-        case U'\u0268': return true;
-        case U'\u029D': return true;
-        case U'\u02B2': return true;
-        case U'\u03F3': return true;
-        case U'\u0456': return true;
-        case U'\u0458': return true;
-        case U'\u1D62': return true;
-        case U'\u1D96': return true;
-        case U'\u1DA4': return true;
-        case U'\u1DA8': return true;
-        case U'\u1E2D': return true;
-        case U'\u1ECB': return true;
-        case U'\u2071': return true;
-        case U'\u2148': return true;
-        case U'\u2149': return true;
-        case U'\u2C7C': return true;
-        case U'\U0001D422': return true;
-        case U'\U0001D423': return true;
-        case U'\U0001D456': return true;
-        case U'\U0001D457': return true;
-        case U'\U0001D48A': return true;
-        case U'\U0001D48B': return true;
-        case U'\U0001D4BE': return true;
-        case U'\U0001D4BF': return true;
-        case U'\U0001D4F2': return true;
-        case U'\U0001D4F3': return true;
-        case U'\U0001D526': return true;
-        case U'\U0001D527': return true;
-        case U'\U0001D55A': return true;
-        case U'\U0001D55B': return true;
-        case U'\U0001D58E': return true;
-        case U'\U0001D58F': return true;
-        case U'\U0001D5C2': return true;
-        case U'\U0001D5C3': return true;
-        case U'\U0001D5F6': return true;
-        case U'\U0001D5F7': return true;
-        case U'\U0001D62A': return true;
-        case U'\U0001D62B': return true;
-        case U'\U0001D65E': return true;
-        case U'\U0001D65F': return true;
-        case U'\U0001D692': return true;
-        case U'\U0001D693': return true;
-        case U'\U0001DF1A': return true;
-        case U'\U0001E04C': return true;
-        case U'\U0001E04D': return true;
-        case U'\U0001E068': return true;
-        default: return false;
-        }
-    }
+    inline constexpr uint_least8_t casing_flag_case_ignorable = 0x2u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t casing_flag_soft_dotted = 0x4u;
 
     /// @internal
     /// @ingroup sys_internal
-    constexpr char32_t dchar_to_lower_simple(const char32_t c) noexcept
-    {
-        switch (c)
-        {
-        case U'\u0041': return U'\u0061';
-        case U'\u0042': return U'\u0062';
-        case U'\u0043': return U'\u0063';
-        case U'\u0044': return U'\u0064';
-        case U'\u0045': return U'\u0065';
-        case U'\u0046': return U'\u0066';
-        case U'\u0047': return U'\u0067';
-        case U'\u0048': return U'\u0068';
-        case U'\u0049': return U'\u0069';
-        case U'\u004A': return U'\u006A';
-        case U'\u004B': return U'\u006B';
-        case U'\u004C': return U'\u006C';
-        case U'\u004D': return U'\u006D';
-        case U'\u004E': return U'\u006E';
-        case U'\u004F': return U'\u006F';
-        case U'\u0050': return U'\u0070';
-        case U'\u0051': return U'\u0071';
-        case U'\u0052': return U'\u0072';
-        case U'\u0053': return U'\u0073';
-        case U'\u0054': return U'\u0074';
-        case U'\u0055': return U'\u0075';
-        case U'\u0056': return U'\u0076';
-        case U'\u0057': return U'\u0077';
-        case U'\u0058': return U'\u0078';
-        case U'\u0059': return U'\u0079';
-        case U'\u005A': return U'\u007A';
-        case U'\u00C0': return U'\u00E0';
-        case U'\u00C1': return U'\u00E1';
-        case U'\u00C2': return U'\u00E2';
-        case U'\u00C3': return U'\u00E3';
-        case U'\u00C4': return U'\u00E4';
-        case U'\u00C5': return U'\u00E5';
-        case U'\u00C6': return U'\u00E6';
-        case U'\u00C7': return U'\u00E7';
-        case U'\u00C8': return U'\u00E8';
-        case U'\u00C9': return U'\u00E9';
-        case U'\u00CA': return U'\u00EA';
-        case U'\u00CB': return U'\u00EB';
-        case U'\u00CC': return U'\u00EC';
-        case U'\u00CD': return U'\u00ED';
-        case U'\u00CE': return U'\u00EE';
-        case U'\u00CF': return U'\u00EF';
-        case U'\u00D0': return U'\u00F0';
-        case U'\u00D1': return U'\u00F1';
-        case U'\u00D2': return U'\u00F2';
-        case U'\u00D3': return U'\u00F3';
-        case U'\u00D4': return U'\u00F4';
-        case U'\u00D5': return U'\u00F5';
-        case U'\u00D6': return U'\u00F6';
-        case U'\u00D8': return U'\u00F8';
-        case U'\u00D9': return U'\u00F9';
-        case U'\u00DA': return U'\u00FA';
-        case U'\u00DB': return U'\u00FB';
-        case U'\u00DC': return U'\u00FC';
-        case U'\u00DD': return U'\u00FD';
-        case U'\u00DE': return U'\u00FE';
-        case U'\u0100': return U'\u0101';
-        case U'\u0102': return U'\u0103';
-        case U'\u0104': return U'\u0105';
-        case U'\u0106': return U'\u0107';
-        case U'\u0108': return U'\u0109';
-        case U'\u010A': return U'\u010B';
-        case U'\u010C': return U'\u010D';
-        case U'\u010E': return U'\u010F';
-        case U'\u0110': return U'\u0111';
-        case U'\u0112': return U'\u0113';
-        case U'\u0114': return U'\u0115';
-        case U'\u0116': return U'\u0117';
-        case U'\u0118': return U'\u0119';
-        case U'\u011A': return U'\u011B';
-        case U'\u011C': return U'\u011D';
-        case U'\u011E': return U'\u011F';
-        case U'\u0120': return U'\u0121';
-        case U'\u0122': return U'\u0123';
-        case U'\u0124': return U'\u0125';
-        case U'\u0126': return U'\u0127';
-        case U'\u0128': return U'\u0129';
-        case U'\u012A': return U'\u012B';
-        case U'\u012C': return U'\u012D';
-        case U'\u012E': return U'\u012F';
-        case U'\u0130': return U'\u0069';
-        case U'\u0132': return U'\u0133';
-        case U'\u0134': return U'\u0135';
-        case U'\u0136': return U'\u0137';
-        case U'\u0139': return U'\u013A';
-        case U'\u013B': return U'\u013C';
-        case U'\u013D': return U'\u013E';
-        case U'\u013F': return U'\u0140';
-        case U'\u0141': return U'\u0142';
-        case U'\u0143': return U'\u0144';
-        case U'\u0145': return U'\u0146';
-        case U'\u0147': return U'\u0148';
-        case U'\u014A': return U'\u014B';
-        case U'\u014C': return U'\u014D';
-        case U'\u014E': return U'\u014F';
-        case U'\u0150': return U'\u0151';
-        case U'\u0152': return U'\u0153';
-        case U'\u0154': return U'\u0155';
-        case U'\u0156': return U'\u0157';
-        case U'\u0158': return U'\u0159';
-        case U'\u015A': return U'\u015B';
-        case U'\u015C': return U'\u015D';
-        case U'\u015E': return U'\u015F';
-        case U'\u0160': return U'\u0161';
-        case U'\u0162': return U'\u0163';
-        case U'\u0164': return U'\u0165';
-        case U'\u0166': return U'\u0167';
-        case U'\u0168': return U'\u0169';
-        case U'\u016A': return U'\u016B';
-        case U'\u016C': return U'\u016D';
-        case U'\u016E': return U'\u016F';
-        case U'\u0170': return U'\u0171';
-        case U'\u0172': return U'\u0173';
-        case U'\u0174': return U'\u0175';
-        case U'\u0176': return U'\u0177';
-        case U'\u0178': return U'\u00FF';
-        case U'\u0179': return U'\u017A';
-        case U'\u017B': return U'\u017C';
-        case U'\u017D': return U'\u017E';
-        case U'\u0181': return U'\u0253';
-        case U'\u0182': return U'\u0183';
-        case U'\u0184': return U'\u0185';
-        case U'\u0186': return U'\u0254';
-        case U'\u0187': return U'\u0188';
-        case U'\u0189': return U'\u0256';
-        case U'\u018A': return U'\u0257';
-        case U'\u018B': return U'\u018C';
-        case U'\u018E': return U'\u01DD';
-        case U'\u018F': return U'\u0259';
-        case U'\u0190': return U'\u025B';
-        case U'\u0191': return U'\u0192';
-        case U'\u0193': return U'\u0260';
-        case U'\u0194': return U'\u0263';
-        case U'\u0196': return U'\u0269';
-        case U'\u0197': return U'\u0268';
-        case U'\u0198': return U'\u0199';
-        case U'\u019C': return U'\u026F';
-        case U'\u019D': return U'\u0272';
-        case U'\u019F': return U'\u0275';
-        case U'\u01A0': return U'\u01A1';
-        case U'\u01A2': return U'\u01A3';
-        case U'\u01A4': return U'\u01A5';
-        case U'\u01A6': return U'\u0280';
-        case U'\u01A7': return U'\u01A8';
-        case U'\u01A9': return U'\u0283';
-        case U'\u01AC': return U'\u01AD';
-        case U'\u01AE': return U'\u0288';
-        case U'\u01AF': return U'\u01B0';
-        case U'\u01B1': return U'\u028A';
-        case U'\u01B2': return U'\u028B';
-        case U'\u01B3': return U'\u01B4';
-        case U'\u01B5': return U'\u01B6';
-        case U'\u01B7': return U'\u0292';
-        case U'\u01B8': return U'\u01B9';
-        case U'\u01BC': return U'\u01BD';
-        case U'\u01C4': return U'\u01C6';
-        case U'\u01C5': return U'\u01C6';
-        case U'\u01C7': return U'\u01C9';
-        case U'\u01C8': return U'\u01C9';
-        case U'\u01CA': return U'\u01CC';
-        case U'\u01CB': return U'\u01CC';
-        case U'\u01CD': return U'\u01CE';
-        case U'\u01CF': return U'\u01D0';
-        case U'\u01D1': return U'\u01D2';
-        case U'\u01D3': return U'\u01D4';
-        case U'\u01D5': return U'\u01D6';
-        case U'\u01D7': return U'\u01D8';
-        case U'\u01D9': return U'\u01DA';
-        case U'\u01DB': return U'\u01DC';
-        case U'\u01DE': return U'\u01DF';
-        case U'\u01E0': return U'\u01E1';
-        case U'\u01E2': return U'\u01E3';
-        case U'\u01E4': return U'\u01E5';
-        case U'\u01E6': return U'\u01E7';
-        case U'\u01E8': return U'\u01E9';
-        case U'\u01EA': return U'\u01EB';
-        case U'\u01EC': return U'\u01ED';
-        case U'\u01EE': return U'\u01EF';
-        case U'\u01F1': return U'\u01F3';
-        case U'\u01F2': return U'\u01F3';
-        case U'\u01F4': return U'\u01F5';
-        case U'\u01F6': return U'\u0195';
-        case U'\u01F7': return U'\u01BF';
-        case U'\u01F8': return U'\u01F9';
-        case U'\u01FA': return U'\u01FB';
-        case U'\u01FC': return U'\u01FD';
-        case U'\u01FE': return U'\u01FF';
-        case U'\u0200': return U'\u0201';
-        case U'\u0202': return U'\u0203';
-        case U'\u0204': return U'\u0205';
-        case U'\u0206': return U'\u0207';
-        case U'\u0208': return U'\u0209';
-        case U'\u020A': return U'\u020B';
-        case U'\u020C': return U'\u020D';
-        case U'\u020E': return U'\u020F';
-        case U'\u0210': return U'\u0211';
-        case U'\u0212': return U'\u0213';
-        case U'\u0214': return U'\u0215';
-        case U'\u0216': return U'\u0217';
-        case U'\u0218': return U'\u0219';
-        case U'\u021A': return U'\u021B';
-        case U'\u021C': return U'\u021D';
-        case U'\u021E': return U'\u021F';
-        case U'\u0220': return U'\u019E';
-        case U'\u0222': return U'\u0223';
-        case U'\u0224': return U'\u0225';
-        case U'\u0226': return U'\u0227';
-        case U'\u0228': return U'\u0229';
-        case U'\u022A': return U'\u022B';
-        case U'\u022C': return U'\u022D';
-        case U'\u022E': return U'\u022F';
-        case U'\u0230': return U'\u0231';
-        case U'\u0232': return U'\u0233';
-        case U'\u023A': return U'\u2C65';
-        case U'\u023B': return U'\u023C';
-        case U'\u023D': return U'\u019A';
-        case U'\u023E': return U'\u2C66';
-        case U'\u0241': return U'\u0242';
-        case U'\u0243': return U'\u0180';
-        case U'\u0244': return U'\u0289';
-        case U'\u0245': return U'\u028C';
-        case U'\u0246': return U'\u0247';
-        case U'\u0248': return U'\u0249';
-        case U'\u024A': return U'\u024B';
-        case U'\u024C': return U'\u024D';
-        case U'\u024E': return U'\u024F';
-        case U'\u0370': return U'\u0371';
-        case U'\u0372': return U'\u0373';
-        case U'\u0376': return U'\u0377';
-        case U'\u037F': return U'\u03F3';
-        case U'\u0386': return U'\u03AC';
-        case U'\u0388': return U'\u03AD';
-        case U'\u0389': return U'\u03AE';
-        case U'\u038A': return U'\u03AF';
-        case U'\u038C': return U'\u03CC';
-        case U'\u038E': return U'\u03CD';
-        case U'\u038F': return U'\u03CE';
-        case U'\u0391': return U'\u03B1';
-        case U'\u0392': return U'\u03B2';
-        case U'\u0393': return U'\u03B3';
-        case U'\u0394': return U'\u03B4';
-        case U'\u0395': return U'\u03B5';
-        case U'\u0396': return U'\u03B6';
-        case U'\u0397': return U'\u03B7';
-        case U'\u0398': return U'\u03B8';
-        case U'\u0399': return U'\u03B9';
-        case U'\u039A': return U'\u03BA';
-        case U'\u039B': return U'\u03BB';
-        case U'\u039C': return U'\u03BC';
-        case U'\u039D': return U'\u03BD';
-        case U'\u039E': return U'\u03BE';
-        case U'\u039F': return U'\u03BF';
-        case U'\u03A0': return U'\u03C0';
-        case U'\u03A1': return U'\u03C1';
-        case U'\u03A3': return U'\u03C3';
-        case U'\u03A4': return U'\u03C4';
-        case U'\u03A5': return U'\u03C5';
-        case U'\u03A6': return U'\u03C6';
-        case U'\u03A7': return U'\u03C7';
-        case U'\u03A8': return U'\u03C8';
-        case U'\u03A9': return U'\u03C9';
-        case U'\u03AA': return U'\u03CA';
-        case U'\u03AB': return U'\u03CB';
-        case U'\u03CF': return U'\u03D7';
-        case U'\u03D8': return U'\u03D9';
-        case U'\u03DA': return U'\u03DB';
-        case U'\u03DC': return U'\u03DD';
-        case U'\u03DE': return U'\u03DF';
-        case U'\u03E0': return U'\u03E1';
-        case U'\u03E2': return U'\u03E3';
-        case U'\u03E4': return U'\u03E5';
-        case U'\u03E6': return U'\u03E7';
-        case U'\u03E8': return U'\u03E9';
-        case U'\u03EA': return U'\u03EB';
-        case U'\u03EC': return U'\u03ED';
-        case U'\u03EE': return U'\u03EF';
-        case U'\u03F4': return U'\u03B8';
-        case U'\u03F7': return U'\u03F8';
-        case U'\u03F9': return U'\u03F2';
-        case U'\u03FA': return U'\u03FB';
-        case U'\u03FD': return U'\u037B';
-        case U'\u03FE': return U'\u037C';
-        case U'\u03FF': return U'\u037D';
-        case U'\u0400': return U'\u0450';
-        case U'\u0401': return U'\u0451';
-        case U'\u0402': return U'\u0452';
-        case U'\u0403': return U'\u0453';
-        case U'\u0404': return U'\u0454';
-        case U'\u0405': return U'\u0455';
-        case U'\u0406': return U'\u0456';
-        case U'\u0407': return U'\u0457';
-        case U'\u0408': return U'\u0458';
-        case U'\u0409': return U'\u0459';
-        case U'\u040A': return U'\u045A';
-        case U'\u040B': return U'\u045B';
-        case U'\u040C': return U'\u045C';
-        case U'\u040D': return U'\u045D';
-        case U'\u040E': return U'\u045E';
-        case U'\u040F': return U'\u045F';
-        case U'\u0410': return U'\u0430';
-        case U'\u0411': return U'\u0431';
-        case U'\u0412': return U'\u0432';
-        case U'\u0413': return U'\u0433';
-        case U'\u0414': return U'\u0434';
-        case U'\u0415': return U'\u0435';
-        case U'\u0416': return U'\u0436';
-        case U'\u0417': return U'\u0437';
-        case U'\u0418': return U'\u0438';
-        case U'\u0419': return U'\u0439';
-        case U'\u041A': return U'\u043A';
-        case U'\u041B': return U'\u043B';
-        case U'\u041C': return U'\u043C';
-        case U'\u041D': return U'\u043D';
-        case U'\u041E': return U'\u043E';
-        case U'\u041F': return U'\u043F';
-        case U'\u0420': return U'\u0440';
-        case U'\u0421': return U'\u0441';
-        case U'\u0422': return U'\u0442';
-        case U'\u0423': return U'\u0443';
-        case U'\u0424': return U'\u0444';
-        case U'\u0425': return U'\u0445';
-        case U'\u0426': return U'\u0446';
-        case U'\u0427': return U'\u0447';
-        case U'\u0428': return U'\u0448';
-        case U'\u0429': return U'\u0449';
-        case U'\u042A': return U'\u044A';
-        case U'\u042B': return U'\u044B';
-        case U'\u042C': return U'\u044C';
-        case U'\u042D': return U'\u044D';
-        case U'\u042E': return U'\u044E';
-        case U'\u042F': return U'\u044F';
-        case U'\u0460': return U'\u0461';
-        case U'\u0462': return U'\u0463';
-        case U'\u0464': return U'\u0465';
-        case U'\u0466': return U'\u0467';
-        case U'\u0468': return U'\u0469';
-        case U'\u046A': return U'\u046B';
-        case U'\u046C': return U'\u046D';
-        case U'\u046E': return U'\u046F';
-        case U'\u0470': return U'\u0471';
-        case U'\u0472': return U'\u0473';
-        case U'\u0474': return U'\u0475';
-        case U'\u0476': return U'\u0477';
-        case U'\u0478': return U'\u0479';
-        case U'\u047A': return U'\u047B';
-        case U'\u047C': return U'\u047D';
-        case U'\u047E': return U'\u047F';
-        case U'\u0480': return U'\u0481';
-        case U'\u048A': return U'\u048B';
-        case U'\u048C': return U'\u048D';
-        case U'\u048E': return U'\u048F';
-        case U'\u0490': return U'\u0491';
-        case U'\u0492': return U'\u0493';
-        case U'\u0494': return U'\u0495';
-        case U'\u0496': return U'\u0497';
-        case U'\u0498': return U'\u0499';
-        case U'\u049A': return U'\u049B';
-        case U'\u049C': return U'\u049D';
-        case U'\u049E': return U'\u049F';
-        case U'\u04A0': return U'\u04A1';
-        case U'\u04A2': return U'\u04A3';
-        case U'\u04A4': return U'\u04A5';
-        case U'\u04A6': return U'\u04A7';
-        case U'\u04A8': return U'\u04A9';
-        case U'\u04AA': return U'\u04AB';
-        case U'\u04AC': return U'\u04AD';
-        case U'\u04AE': return U'\u04AF';
-        case U'\u04B0': return U'\u04B1';
-        case U'\u04B2': return U'\u04B3';
-        case U'\u04B4': return U'\u04B5';
-        case U'\u04B6': return U'\u04B7';
-        case U'\u04B8': return U'\u04B9';
-        case U'\u04BA': return U'\u04BB';
-        case U'\u04BC': return U'\u04BD';
-        case U'\u04BE': return U'\u04BF';
-        case U'\u04C0': return U'\u04CF';
-        case U'\u04C1': return U'\u04C2';
-        case U'\u04C3': return U'\u04C4';
-        case U'\u04C5': return U'\u04C6';
-        case U'\u04C7': return U'\u04C8';
-        case U'\u04C9': return U'\u04CA';
-        case U'\u04CB': return U'\u04CC';
-        case U'\u04CD': return U'\u04CE';
-        case U'\u04D0': return U'\u04D1';
-        case U'\u04D2': return U'\u04D3';
-        case U'\u04D4': return U'\u04D5';
-        case U'\u04D6': return U'\u04D7';
-        case U'\u04D8': return U'\u04D9';
-        case U'\u04DA': return U'\u04DB';
-        case U'\u04DC': return U'\u04DD';
-        case U'\u04DE': return U'\u04DF';
-        case U'\u04E0': return U'\u04E1';
-        case U'\u04E2': return U'\u04E3';
-        case U'\u04E4': return U'\u04E5';
-        case U'\u04E6': return U'\u04E7';
-        case U'\u04E8': return U'\u04E9';
-        case U'\u04EA': return U'\u04EB';
-        case U'\u04EC': return U'\u04ED';
-        case U'\u04EE': return U'\u04EF';
-        case U'\u04F0': return U'\u04F1';
-        case U'\u04F2': return U'\u04F3';
-        case U'\u04F4': return U'\u04F5';
-        case U'\u04F6': return U'\u04F7';
-        case U'\u04F8': return U'\u04F9';
-        case U'\u04FA': return U'\u04FB';
-        case U'\u04FC': return U'\u04FD';
-        case U'\u04FE': return U'\u04FF';
-        case U'\u0500': return U'\u0501';
-        case U'\u0502': return U'\u0503';
-        case U'\u0504': return U'\u0505';
-        case U'\u0506': return U'\u0507';
-        case U'\u0508': return U'\u0509';
-        case U'\u050A': return U'\u050B';
-        case U'\u050C': return U'\u050D';
-        case U'\u050E': return U'\u050F';
-        case U'\u0510': return U'\u0511';
-        case U'\u0512': return U'\u0513';
-        case U'\u0514': return U'\u0515';
-        case U'\u0516': return U'\u0517';
-        case U'\u0518': return U'\u0519';
-        case U'\u051A': return U'\u051B';
-        case U'\u051C': return U'\u051D';
-        case U'\u051E': return U'\u051F';
-        case U'\u0520': return U'\u0521';
-        case U'\u0522': return U'\u0523';
-        case U'\u0524': return U'\u0525';
-        case U'\u0526': return U'\u0527';
-        case U'\u0528': return U'\u0529';
-        case U'\u052A': return U'\u052B';
-        case U'\u052C': return U'\u052D';
-        case U'\u052E': return U'\u052F';
-        case U'\u0531': return U'\u0561';
-        case U'\u0532': return U'\u0562';
-        case U'\u0533': return U'\u0563';
-        case U'\u0534': return U'\u0564';
-        case U'\u0535': return U'\u0565';
-        case U'\u0536': return U'\u0566';
-        case U'\u0537': return U'\u0567';
-        case U'\u0538': return U'\u0568';
-        case U'\u0539': return U'\u0569';
-        case U'\u053A': return U'\u056A';
-        case U'\u053B': return U'\u056B';
-        case U'\u053C': return U'\u056C';
-        case U'\u053D': return U'\u056D';
-        case U'\u053E': return U'\u056E';
-        case U'\u053F': return U'\u056F';
-        case U'\u0540': return U'\u0570';
-        case U'\u0541': return U'\u0571';
-        case U'\u0542': return U'\u0572';
-        case U'\u0543': return U'\u0573';
-        case U'\u0544': return U'\u0574';
-        case U'\u0545': return U'\u0575';
-        case U'\u0546': return U'\u0576';
-        case U'\u0547': return U'\u0577';
-        case U'\u0548': return U'\u0578';
-        case U'\u0549': return U'\u0579';
-        case U'\u054A': return U'\u057A';
-        case U'\u054B': return U'\u057B';
-        case U'\u054C': return U'\u057C';
-        case U'\u054D': return U'\u057D';
-        case U'\u054E': return U'\u057E';
-        case U'\u054F': return U'\u057F';
-        case U'\u0550': return U'\u0580';
-        case U'\u0551': return U'\u0581';
-        case U'\u0552': return U'\u0582';
-        case U'\u0553': return U'\u0583';
-        case U'\u0554': return U'\u0584';
-        case U'\u0555': return U'\u0585';
-        case U'\u0556': return U'\u0586';
-        case U'\u10A0': return U'\u2D00';
-        case U'\u10A1': return U'\u2D01';
-        case U'\u10A2': return U'\u2D02';
-        case U'\u10A3': return U'\u2D03';
-        case U'\u10A4': return U'\u2D04';
-        case U'\u10A5': return U'\u2D05';
-        case U'\u10A6': return U'\u2D06';
-        case U'\u10A7': return U'\u2D07';
-        case U'\u10A8': return U'\u2D08';
-        case U'\u10A9': return U'\u2D09';
-        case U'\u10AA': return U'\u2D0A';
-        case U'\u10AB': return U'\u2D0B';
-        case U'\u10AC': return U'\u2D0C';
-        case U'\u10AD': return U'\u2D0D';
-        case U'\u10AE': return U'\u2D0E';
-        case U'\u10AF': return U'\u2D0F';
-        case U'\u10B0': return U'\u2D10';
-        case U'\u10B1': return U'\u2D11';
-        case U'\u10B2': return U'\u2D12';
-        case U'\u10B3': return U'\u2D13';
-        case U'\u10B4': return U'\u2D14';
-        case U'\u10B5': return U'\u2D15';
-        case U'\u10B6': return U'\u2D16';
-        case U'\u10B7': return U'\u2D17';
-        case U'\u10B8': return U'\u2D18';
-        case U'\u10B9': return U'\u2D19';
-        case U'\u10BA': return U'\u2D1A';
-        case U'\u10BB': return U'\u2D1B';
-        case U'\u10BC': return U'\u2D1C';
-        case U'\u10BD': return U'\u2D1D';
-        case U'\u10BE': return U'\u2D1E';
-        case U'\u10BF': return U'\u2D1F';
-        case U'\u10C0': return U'\u2D20';
-        case U'\u10C1': return U'\u2D21';
-        case U'\u10C2': return U'\u2D22';
-        case U'\u10C3': return U'\u2D23';
-        case U'\u10C4': return U'\u2D24';
-        case U'\u10C5': return U'\u2D25';
-        case U'\u10C7': return U'\u2D27';
-        case U'\u10CD': return U'\u2D2D';
-        case U'\u13A0': return U'\uAB70';
-        case U'\u13A1': return U'\uAB71';
-        case U'\u13A2': return U'\uAB72';
-        case U'\u13A3': return U'\uAB73';
-        case U'\u13A4': return U'\uAB74';
-        case U'\u13A5': return U'\uAB75';
-        case U'\u13A6': return U'\uAB76';
-        case U'\u13A7': return U'\uAB77';
-        case U'\u13A8': return U'\uAB78';
-        case U'\u13A9': return U'\uAB79';
-        case U'\u13AA': return U'\uAB7A';
-        case U'\u13AB': return U'\uAB7B';
-        case U'\u13AC': return U'\uAB7C';
-        case U'\u13AD': return U'\uAB7D';
-        case U'\u13AE': return U'\uAB7E';
-        case U'\u13AF': return U'\uAB7F';
-        case U'\u13B0': return U'\uAB80';
-        case U'\u13B1': return U'\uAB81';
-        case U'\u13B2': return U'\uAB82';
-        case U'\u13B3': return U'\uAB83';
-        case U'\u13B4': return U'\uAB84';
-        case U'\u13B5': return U'\uAB85';
-        case U'\u13B6': return U'\uAB86';
-        case U'\u13B7': return U'\uAB87';
-        case U'\u13B8': return U'\uAB88';
-        case U'\u13B9': return U'\uAB89';
-        case U'\u13BA': return U'\uAB8A';
-        case U'\u13BB': return U'\uAB8B';
-        case U'\u13BC': return U'\uAB8C';
-        case U'\u13BD': return U'\uAB8D';
-        case U'\u13BE': return U'\uAB8E';
-        case U'\u13BF': return U'\uAB8F';
-        case U'\u13C0': return U'\uAB90';
-        case U'\u13C1': return U'\uAB91';
-        case U'\u13C2': return U'\uAB92';
-        case U'\u13C3': return U'\uAB93';
-        case U'\u13C4': return U'\uAB94';
-        case U'\u13C5': return U'\uAB95';
-        case U'\u13C6': return U'\uAB96';
-        case U'\u13C7': return U'\uAB97';
-        case U'\u13C8': return U'\uAB98';
-        case U'\u13C9': return U'\uAB99';
-        case U'\u13CA': return U'\uAB9A';
-        case U'\u13CB': return U'\uAB9B';
-        case U'\u13CC': return U'\uAB9C';
-        case U'\u13CD': return U'\uAB9D';
-        case U'\u13CE': return U'\uAB9E';
-        case U'\u13CF': return U'\uAB9F';
-        case U'\u13D0': return U'\uABA0';
-        case U'\u13D1': return U'\uABA1';
-        case U'\u13D2': return U'\uABA2';
-        case U'\u13D3': return U'\uABA3';
-        case U'\u13D4': return U'\uABA4';
-        case U'\u13D5': return U'\uABA5';
-        case U'\u13D6': return U'\uABA6';
-        case U'\u13D7': return U'\uABA7';
-        case U'\u13D8': return U'\uABA8';
-        case U'\u13D9': return U'\uABA9';
-        case U'\u13DA': return U'\uABAA';
-        case U'\u13DB': return U'\uABAB';
-        case U'\u13DC': return U'\uABAC';
-        case U'\u13DD': return U'\uABAD';
-        case U'\u13DE': return U'\uABAE';
-        case U'\u13DF': return U'\uABAF';
-        case U'\u13E0': return U'\uABB0';
-        case U'\u13E1': return U'\uABB1';
-        case U'\u13E2': return U'\uABB2';
-        case U'\u13E3': return U'\uABB3';
-        case U'\u13E4': return U'\uABB4';
-        case U'\u13E5': return U'\uABB5';
-        case U'\u13E6': return U'\uABB6';
-        case U'\u13E7': return U'\uABB7';
-        case U'\u13E8': return U'\uABB8';
-        case U'\u13E9': return U'\uABB9';
-        case U'\u13EA': return U'\uABBA';
-        case U'\u13EB': return U'\uABBB';
-        case U'\u13EC': return U'\uABBC';
-        case U'\u13ED': return U'\uABBD';
-        case U'\u13EE': return U'\uABBE';
-        case U'\u13EF': return U'\uABBF';
-        case U'\u13F0': return U'\u13F8';
-        case U'\u13F1': return U'\u13F9';
-        case U'\u13F2': return U'\u13FA';
-        case U'\u13F3': return U'\u13FB';
-        case U'\u13F4': return U'\u13FC';
-        case U'\u13F5': return U'\u13FD';
-        case U'\u1C89': return U'\u1C8A';
-        case U'\u1C90': return U'\u10D0';
-        case U'\u1C91': return U'\u10D1';
-        case U'\u1C92': return U'\u10D2';
-        case U'\u1C93': return U'\u10D3';
-        case U'\u1C94': return U'\u10D4';
-        case U'\u1C95': return U'\u10D5';
-        case U'\u1C96': return U'\u10D6';
-        case U'\u1C97': return U'\u10D7';
-        case U'\u1C98': return U'\u10D8';
-        case U'\u1C99': return U'\u10D9';
-        case U'\u1C9A': return U'\u10DA';
-        case U'\u1C9B': return U'\u10DB';
-        case U'\u1C9C': return U'\u10DC';
-        case U'\u1C9D': return U'\u10DD';
-        case U'\u1C9E': return U'\u10DE';
-        case U'\u1C9F': return U'\u10DF';
-        case U'\u1CA0': return U'\u10E0';
-        case U'\u1CA1': return U'\u10E1';
-        case U'\u1CA2': return U'\u10E2';
-        case U'\u1CA3': return U'\u10E3';
-        case U'\u1CA4': return U'\u10E4';
-        case U'\u1CA5': return U'\u10E5';
-        case U'\u1CA6': return U'\u10E6';
-        case U'\u1CA7': return U'\u10E7';
-        case U'\u1CA8': return U'\u10E8';
-        case U'\u1CA9': return U'\u10E9';
-        case U'\u1CAA': return U'\u10EA';
-        case U'\u1CAB': return U'\u10EB';
-        case U'\u1CAC': return U'\u10EC';
-        case U'\u1CAD': return U'\u10ED';
-        case U'\u1CAE': return U'\u10EE';
-        case U'\u1CAF': return U'\u10EF';
-        case U'\u1CB0': return U'\u10F0';
-        case U'\u1CB1': return U'\u10F1';
-        case U'\u1CB2': return U'\u10F2';
-        case U'\u1CB3': return U'\u10F3';
-        case U'\u1CB4': return U'\u10F4';
-        case U'\u1CB5': return U'\u10F5';
-        case U'\u1CB6': return U'\u10F6';
-        case U'\u1CB7': return U'\u10F7';
-        case U'\u1CB8': return U'\u10F8';
-        case U'\u1CB9': return U'\u10F9';
-        case U'\u1CBA': return U'\u10FA';
-        case U'\u1CBD': return U'\u10FD';
-        case U'\u1CBE': return U'\u10FE';
-        case U'\u1CBF': return U'\u10FF';
-        case U'\u1E00': return U'\u1E01';
-        case U'\u1E02': return U'\u1E03';
-        case U'\u1E04': return U'\u1E05';
-        case U'\u1E06': return U'\u1E07';
-        case U'\u1E08': return U'\u1E09';
-        case U'\u1E0A': return U'\u1E0B';
-        case U'\u1E0C': return U'\u1E0D';
-        case U'\u1E0E': return U'\u1E0F';
-        case U'\u1E10': return U'\u1E11';
-        case U'\u1E12': return U'\u1E13';
-        case U'\u1E14': return U'\u1E15';
-        case U'\u1E16': return U'\u1E17';
-        case U'\u1E18': return U'\u1E19';
-        case U'\u1E1A': return U'\u1E1B';
-        case U'\u1E1C': return U'\u1E1D';
-        case U'\u1E1E': return U'\u1E1F';
-        case U'\u1E20': return U'\u1E21';
-        case U'\u1E22': return U'\u1E23';
-        case U'\u1E24': return U'\u1E25';
-        case U'\u1E26': return U'\u1E27';
-        case U'\u1E28': return U'\u1E29';
-        case U'\u1E2A': return U'\u1E2B';
-        case U'\u1E2C': return U'\u1E2D';
-        case U'\u1E2E': return U'\u1E2F';
-        case U'\u1E30': return U'\u1E31';
-        case U'\u1E32': return U'\u1E33';
-        case U'\u1E34': return U'\u1E35';
-        case U'\u1E36': return U'\u1E37';
-        case U'\u1E38': return U'\u1E39';
-        case U'\u1E3A': return U'\u1E3B';
-        case U'\u1E3C': return U'\u1E3D';
-        case U'\u1E3E': return U'\u1E3F';
-        case U'\u1E40': return U'\u1E41';
-        case U'\u1E42': return U'\u1E43';
-        case U'\u1E44': return U'\u1E45';
-        case U'\u1E46': return U'\u1E47';
-        case U'\u1E48': return U'\u1E49';
-        case U'\u1E4A': return U'\u1E4B';
-        case U'\u1E4C': return U'\u1E4D';
-        case U'\u1E4E': return U'\u1E4F';
-        case U'\u1E50': return U'\u1E51';
-        case U'\u1E52': return U'\u1E53';
-        case U'\u1E54': return U'\u1E55';
-        case U'\u1E56': return U'\u1E57';
-        case U'\u1E58': return U'\u1E59';
-        case U'\u1E5A': return U'\u1E5B';
-        case U'\u1E5C': return U'\u1E5D';
-        case U'\u1E5E': return U'\u1E5F';
-        case U'\u1E60': return U'\u1E61';
-        case U'\u1E62': return U'\u1E63';
-        case U'\u1E64': return U'\u1E65';
-        case U'\u1E66': return U'\u1E67';
-        case U'\u1E68': return U'\u1E69';
-        case U'\u1E6A': return U'\u1E6B';
-        case U'\u1E6C': return U'\u1E6D';
-        case U'\u1E6E': return U'\u1E6F';
-        case U'\u1E70': return U'\u1E71';
-        case U'\u1E72': return U'\u1E73';
-        case U'\u1E74': return U'\u1E75';
-        case U'\u1E76': return U'\u1E77';
-        case U'\u1E78': return U'\u1E79';
-        case U'\u1E7A': return U'\u1E7B';
-        case U'\u1E7C': return U'\u1E7D';
-        case U'\u1E7E': return U'\u1E7F';
-        case U'\u1E80': return U'\u1E81';
-        case U'\u1E82': return U'\u1E83';
-        case U'\u1E84': return U'\u1E85';
-        case U'\u1E86': return U'\u1E87';
-        case U'\u1E88': return U'\u1E89';
-        case U'\u1E8A': return U'\u1E8B';
-        case U'\u1E8C': return U'\u1E8D';
-        case U'\u1E8E': return U'\u1E8F';
-        case U'\u1E90': return U'\u1E91';
-        case U'\u1E92': return U'\u1E93';
-        case U'\u1E94': return U'\u1E95';
-        case U'\u1E9E': return U'\u00DF';
-        case U'\u1EA0': return U'\u1EA1';
-        case U'\u1EA2': return U'\u1EA3';
-        case U'\u1EA4': return U'\u1EA5';
-        case U'\u1EA6': return U'\u1EA7';
-        case U'\u1EA8': return U'\u1EA9';
-        case U'\u1EAA': return U'\u1EAB';
-        case U'\u1EAC': return U'\u1EAD';
-        case U'\u1EAE': return U'\u1EAF';
-        case U'\u1EB0': return U'\u1EB1';
-        case U'\u1EB2': return U'\u1EB3';
-        case U'\u1EB4': return U'\u1EB5';
-        case U'\u1EB6': return U'\u1EB7';
-        case U'\u1EB8': return U'\u1EB9';
-        case U'\u1EBA': return U'\u1EBB';
-        case U'\u1EBC': return U'\u1EBD';
-        case U'\u1EBE': return U'\u1EBF';
-        case U'\u1EC0': return U'\u1EC1';
-        case U'\u1EC2': return U'\u1EC3';
-        case U'\u1EC4': return U'\u1EC5';
-        case U'\u1EC6': return U'\u1EC7';
-        case U'\u1EC8': return U'\u1EC9';
-        case U'\u1ECA': return U'\u1ECB';
-        case U'\u1ECC': return U'\u1ECD';
-        case U'\u1ECE': return U'\u1ECF';
-        case U'\u1ED0': return U'\u1ED1';
-        case U'\u1ED2': return U'\u1ED3';
-        case U'\u1ED4': return U'\u1ED5';
-        case U'\u1ED6': return U'\u1ED7';
-        case U'\u1ED8': return U'\u1ED9';
-        case U'\u1EDA': return U'\u1EDB';
-        case U'\u1EDC': return U'\u1EDD';
-        case U'\u1EDE': return U'\u1EDF';
-        case U'\u1EE0': return U'\u1EE1';
-        case U'\u1EE2': return U'\u1EE3';
-        case U'\u1EE4': return U'\u1EE5';
-        case U'\u1EE6': return U'\u1EE7';
-        case U'\u1EE8': return U'\u1EE9';
-        case U'\u1EEA': return U'\u1EEB';
-        case U'\u1EEC': return U'\u1EED';
-        case U'\u1EEE': return U'\u1EEF';
-        case U'\u1EF0': return U'\u1EF1';
-        case U'\u1EF2': return U'\u1EF3';
-        case U'\u1EF4': return U'\u1EF5';
-        case U'\u1EF6': return U'\u1EF7';
-        case U'\u1EF8': return U'\u1EF9';
-        case U'\u1EFA': return U'\u1EFB';
-        case U'\u1EFC': return U'\u1EFD';
-        case U'\u1EFE': return U'\u1EFF';
-        case U'\u1F08': return U'\u1F00';
-        case U'\u1F09': return U'\u1F01';
-        case U'\u1F0A': return U'\u1F02';
-        case U'\u1F0B': return U'\u1F03';
-        case U'\u1F0C': return U'\u1F04';
-        case U'\u1F0D': return U'\u1F05';
-        case U'\u1F0E': return U'\u1F06';
-        case U'\u1F0F': return U'\u1F07';
-        case U'\u1F18': return U'\u1F10';
-        case U'\u1F19': return U'\u1F11';
-        case U'\u1F1A': return U'\u1F12';
-        case U'\u1F1B': return U'\u1F13';
-        case U'\u1F1C': return U'\u1F14';
-        case U'\u1F1D': return U'\u1F15';
-        case U'\u1F28': return U'\u1F20';
-        case U'\u1F29': return U'\u1F21';
-        case U'\u1F2A': return U'\u1F22';
-        case U'\u1F2B': return U'\u1F23';
-        case U'\u1F2C': return U'\u1F24';
-        case U'\u1F2D': return U'\u1F25';
-        case U'\u1F2E': return U'\u1F26';
-        case U'\u1F2F': return U'\u1F27';
-        case U'\u1F38': return U'\u1F30';
-        case U'\u1F39': return U'\u1F31';
-        case U'\u1F3A': return U'\u1F32';
-        case U'\u1F3B': return U'\u1F33';
-        case U'\u1F3C': return U'\u1F34';
-        case U'\u1F3D': return U'\u1F35';
-        case U'\u1F3E': return U'\u1F36';
-        case U'\u1F3F': return U'\u1F37';
-        case U'\u1F48': return U'\u1F40';
-        case U'\u1F49': return U'\u1F41';
-        case U'\u1F4A': return U'\u1F42';
-        case U'\u1F4B': return U'\u1F43';
-        case U'\u1F4C': return U'\u1F44';
-        case U'\u1F4D': return U'\u1F45';
-        case U'\u1F59': return U'\u1F51';
-        case U'\u1F5B': return U'\u1F53';
-        case U'\u1F5D': return U'\u1F55';
-        case U'\u1F5F': return U'\u1F57';
-        case U'\u1F68': return U'\u1F60';
-        case U'\u1F69': return U'\u1F61';
-        case U'\u1F6A': return U'\u1F62';
-        case U'\u1F6B': return U'\u1F63';
-        case U'\u1F6C': return U'\u1F64';
-        case U'\u1F6D': return U'\u1F65';
-        case U'\u1F6E': return U'\u1F66';
-        case U'\u1F6F': return U'\u1F67';
-        case U'\u1F88': return U'\u1F80';
-        case U'\u1F89': return U'\u1F81';
-        case U'\u1F8A': return U'\u1F82';
-        case U'\u1F8B': return U'\u1F83';
-        case U'\u1F8C': return U'\u1F84';
-        case U'\u1F8D': return U'\u1F85';
-        case U'\u1F8E': return U'\u1F86';
-        case U'\u1F8F': return U'\u1F87';
-        case U'\u1F98': return U'\u1F90';
-        case U'\u1F99': return U'\u1F91';
-        case U'\u1F9A': return U'\u1F92';
-        case U'\u1F9B': return U'\u1F93';
-        case U'\u1F9C': return U'\u1F94';
-        case U'\u1F9D': return U'\u1F95';
-        case U'\u1F9E': return U'\u1F96';
-        case U'\u1F9F': return U'\u1F97';
-        case U'\u1FA8': return U'\u1FA0';
-        case U'\u1FA9': return U'\u1FA1';
-        case U'\u1FAA': return U'\u1FA2';
-        case U'\u1FAB': return U'\u1FA3';
-        case U'\u1FAC': return U'\u1FA4';
-        case U'\u1FAD': return U'\u1FA5';
-        case U'\u1FAE': return U'\u1FA6';
-        case U'\u1FAF': return U'\u1FA7';
-        case U'\u1FB8': return U'\u1FB0';
-        case U'\u1FB9': return U'\u1FB1';
-        case U'\u1FBA': return U'\u1F70';
-        case U'\u1FBB': return U'\u1F71';
-        case U'\u1FBC': return U'\u1FB3';
-        case U'\u1FC8': return U'\u1F72';
-        case U'\u1FC9': return U'\u1F73';
-        case U'\u1FCA': return U'\u1F74';
-        case U'\u1FCB': return U'\u1F75';
-        case U'\u1FCC': return U'\u1FC3';
-        case U'\u1FD8': return U'\u1FD0';
-        case U'\u1FD9': return U'\u1FD1';
-        case U'\u1FDA': return U'\u1F76';
-        case U'\u1FDB': return U'\u1F77';
-        case U'\u1FE8': return U'\u1FE0';
-        case U'\u1FE9': return U'\u1FE1';
-        case U'\u1FEA': return U'\u1F7A';
-        case U'\u1FEB': return U'\u1F7B';
-        case U'\u1FEC': return U'\u1FE5';
-        case U'\u1FF8': return U'\u1F78';
-        case U'\u1FF9': return U'\u1F79';
-        case U'\u1FFA': return U'\u1F7C';
-        case U'\u1FFB': return U'\u1F7D';
-        case U'\u1FFC': return U'\u1FF3';
-        case U'\u2126': return U'\u03C9';
-        case U'\u212A': return U'\u006B';
-        case U'\u212B': return U'\u00E5';
-        case U'\u2132': return U'\u214E';
-        case U'\u2160': return U'\u2170';
-        case U'\u2161': return U'\u2171';
-        case U'\u2162': return U'\u2172';
-        case U'\u2163': return U'\u2173';
-        case U'\u2164': return U'\u2174';
-        case U'\u2165': return U'\u2175';
-        case U'\u2166': return U'\u2176';
-        case U'\u2167': return U'\u2177';
-        case U'\u2168': return U'\u2178';
-        case U'\u2169': return U'\u2179';
-        case U'\u216A': return U'\u217A';
-        case U'\u216B': return U'\u217B';
-        case U'\u216C': return U'\u217C';
-        case U'\u216D': return U'\u217D';
-        case U'\u216E': return U'\u217E';
-        case U'\u216F': return U'\u217F';
-        case U'\u2183': return U'\u2184';
-        case U'\u24B6': return U'\u24D0';
-        case U'\u24B7': return U'\u24D1';
-        case U'\u24B8': return U'\u24D2';
-        case U'\u24B9': return U'\u24D3';
-        case U'\u24BA': return U'\u24D4';
-        case U'\u24BB': return U'\u24D5';
-        case U'\u24BC': return U'\u24D6';
-        case U'\u24BD': return U'\u24D7';
-        case U'\u24BE': return U'\u24D8';
-        case U'\u24BF': return U'\u24D9';
-        case U'\u24C0': return U'\u24DA';
-        case U'\u24C1': return U'\u24DB';
-        case U'\u24C2': return U'\u24DC';
-        case U'\u24C3': return U'\u24DD';
-        case U'\u24C4': return U'\u24DE';
-        case U'\u24C5': return U'\u24DF';
-        case U'\u24C6': return U'\u24E0';
-        case U'\u24C7': return U'\u24E1';
-        case U'\u24C8': return U'\u24E2';
-        case U'\u24C9': return U'\u24E3';
-        case U'\u24CA': return U'\u24E4';
-        case U'\u24CB': return U'\u24E5';
-        case U'\u24CC': return U'\u24E6';
-        case U'\u24CD': return U'\u24E7';
-        case U'\u24CE': return U'\u24E8';
-        case U'\u24CF': return U'\u24E9';
-        case U'\u2C00': return U'\u2C30';
-        case U'\u2C01': return U'\u2C31';
-        case U'\u2C02': return U'\u2C32';
-        case U'\u2C03': return U'\u2C33';
-        case U'\u2C04': return U'\u2C34';
-        case U'\u2C05': return U'\u2C35';
-        case U'\u2C06': return U'\u2C36';
-        case U'\u2C07': return U'\u2C37';
-        case U'\u2C08': return U'\u2C38';
-        case U'\u2C09': return U'\u2C39';
-        case U'\u2C0A': return U'\u2C3A';
-        case U'\u2C0B': return U'\u2C3B';
-        case U'\u2C0C': return U'\u2C3C';
-        case U'\u2C0D': return U'\u2C3D';
-        case U'\u2C0E': return U'\u2C3E';
-        case U'\u2C0F': return U'\u2C3F';
-        case U'\u2C10': return U'\u2C40';
-        case U'\u2C11': return U'\u2C41';
-        case U'\u2C12': return U'\u2C42';
-        case U'\u2C13': return U'\u2C43';
-        case U'\u2C14': return U'\u2C44';
-        case U'\u2C15': return U'\u2C45';
-        case U'\u2C16': return U'\u2C46';
-        case U'\u2C17': return U'\u2C47';
-        case U'\u2C18': return U'\u2C48';
-        case U'\u2C19': return U'\u2C49';
-        case U'\u2C1A': return U'\u2C4A';
-        case U'\u2C1B': return U'\u2C4B';
-        case U'\u2C1C': return U'\u2C4C';
-        case U'\u2C1D': return U'\u2C4D';
-        case U'\u2C1E': return U'\u2C4E';
-        case U'\u2C1F': return U'\u2C4F';
-        case U'\u2C20': return U'\u2C50';
-        case U'\u2C21': return U'\u2C51';
-        case U'\u2C22': return U'\u2C52';
-        case U'\u2C23': return U'\u2C53';
-        case U'\u2C24': return U'\u2C54';
-        case U'\u2C25': return U'\u2C55';
-        case U'\u2C26': return U'\u2C56';
-        case U'\u2C27': return U'\u2C57';
-        case U'\u2C28': return U'\u2C58';
-        case U'\u2C29': return U'\u2C59';
-        case U'\u2C2A': return U'\u2C5A';
-        case U'\u2C2B': return U'\u2C5B';
-        case U'\u2C2C': return U'\u2C5C';
-        case U'\u2C2D': return U'\u2C5D';
-        case U'\u2C2E': return U'\u2C5E';
-        case U'\u2C2F': return U'\u2C5F';
-        case U'\u2C60': return U'\u2C61';
-        case U'\u2C62': return U'\u026B';
-        case U'\u2C63': return U'\u1D7D';
-        case U'\u2C64': return U'\u027D';
-        case U'\u2C67': return U'\u2C68';
-        case U'\u2C69': return U'\u2C6A';
-        case U'\u2C6B': return U'\u2C6C';
-        case U'\u2C6D': return U'\u0251';
-        case U'\u2C6E': return U'\u0271';
-        case U'\u2C6F': return U'\u0250';
-        case U'\u2C70': return U'\u0252';
-        case U'\u2C72': return U'\u2C73';
-        case U'\u2C75': return U'\u2C76';
-        case U'\u2C7E': return U'\u023F';
-        case U'\u2C7F': return U'\u0240';
-        case U'\u2C80': return U'\u2C81';
-        case U'\u2C82': return U'\u2C83';
-        case U'\u2C84': return U'\u2C85';
-        case U'\u2C86': return U'\u2C87';
-        case U'\u2C88': return U'\u2C89';
-        case U'\u2C8A': return U'\u2C8B';
-        case U'\u2C8C': return U'\u2C8D';
-        case U'\u2C8E': return U'\u2C8F';
-        case U'\u2C90': return U'\u2C91';
-        case U'\u2C92': return U'\u2C93';
-        case U'\u2C94': return U'\u2C95';
-        case U'\u2C96': return U'\u2C97';
-        case U'\u2C98': return U'\u2C99';
-        case U'\u2C9A': return U'\u2C9B';
-        case U'\u2C9C': return U'\u2C9D';
-        case U'\u2C9E': return U'\u2C9F';
-        case U'\u2CA0': return U'\u2CA1';
-        case U'\u2CA2': return U'\u2CA3';
-        case U'\u2CA4': return U'\u2CA5';
-        case U'\u2CA6': return U'\u2CA7';
-        case U'\u2CA8': return U'\u2CA9';
-        case U'\u2CAA': return U'\u2CAB';
-        case U'\u2CAC': return U'\u2CAD';
-        case U'\u2CAE': return U'\u2CAF';
-        case U'\u2CB0': return U'\u2CB1';
-        case U'\u2CB2': return U'\u2CB3';
-        case U'\u2CB4': return U'\u2CB5';
-        case U'\u2CB6': return U'\u2CB7';
-        case U'\u2CB8': return U'\u2CB9';
-        case U'\u2CBA': return U'\u2CBB';
-        case U'\u2CBC': return U'\u2CBD';
-        case U'\u2CBE': return U'\u2CBF';
-        case U'\u2CC0': return U'\u2CC1';
-        case U'\u2CC2': return U'\u2CC3';
-        case U'\u2CC4': return U'\u2CC5';
-        case U'\u2CC6': return U'\u2CC7';
-        case U'\u2CC8': return U'\u2CC9';
-        case U'\u2CCA': return U'\u2CCB';
-        case U'\u2CCC': return U'\u2CCD';
-        case U'\u2CCE': return U'\u2CCF';
-        case U'\u2CD0': return U'\u2CD1';
-        case U'\u2CD2': return U'\u2CD3';
-        case U'\u2CD4': return U'\u2CD5';
-        case U'\u2CD6': return U'\u2CD7';
-        case U'\u2CD8': return U'\u2CD9';
-        case U'\u2CDA': return U'\u2CDB';
-        case U'\u2CDC': return U'\u2CDD';
-        case U'\u2CDE': return U'\u2CDF';
-        case U'\u2CE0': return U'\u2CE1';
-        case U'\u2CE2': return U'\u2CE3';
-        case U'\u2CEB': return U'\u2CEC';
-        case U'\u2CED': return U'\u2CEE';
-        case U'\u2CF2': return U'\u2CF3';
-        case U'\uA640': return U'\uA641';
-        case U'\uA642': return U'\uA643';
-        case U'\uA644': return U'\uA645';
-        case U'\uA646': return U'\uA647';
-        case U'\uA648': return U'\uA649';
-        case U'\uA64A': return U'\uA64B';
-        case U'\uA64C': return U'\uA64D';
-        case U'\uA64E': return U'\uA64F';
-        case U'\uA650': return U'\uA651';
-        case U'\uA652': return U'\uA653';
-        case U'\uA654': return U'\uA655';
-        case U'\uA656': return U'\uA657';
-        case U'\uA658': return U'\uA659';
-        case U'\uA65A': return U'\uA65B';
-        case U'\uA65C': return U'\uA65D';
-        case U'\uA65E': return U'\uA65F';
-        case U'\uA660': return U'\uA661';
-        case U'\uA662': return U'\uA663';
-        case U'\uA664': return U'\uA665';
-        case U'\uA666': return U'\uA667';
-        case U'\uA668': return U'\uA669';
-        case U'\uA66A': return U'\uA66B';
-        case U'\uA66C': return U'\uA66D';
-        case U'\uA680': return U'\uA681';
-        case U'\uA682': return U'\uA683';
-        case U'\uA684': return U'\uA685';
-        case U'\uA686': return U'\uA687';
-        case U'\uA688': return U'\uA689';
-        case U'\uA68A': return U'\uA68B';
-        case U'\uA68C': return U'\uA68D';
-        case U'\uA68E': return U'\uA68F';
-        case U'\uA690': return U'\uA691';
-        case U'\uA692': return U'\uA693';
-        case U'\uA694': return U'\uA695';
-        case U'\uA696': return U'\uA697';
-        case U'\uA698': return U'\uA699';
-        case U'\uA69A': return U'\uA69B';
-        case U'\uA722': return U'\uA723';
-        case U'\uA724': return U'\uA725';
-        case U'\uA726': return U'\uA727';
-        case U'\uA728': return U'\uA729';
-        case U'\uA72A': return U'\uA72B';
-        case U'\uA72C': return U'\uA72D';
-        case U'\uA72E': return U'\uA72F';
-        case U'\uA732': return U'\uA733';
-        case U'\uA734': return U'\uA735';
-        case U'\uA736': return U'\uA737';
-        case U'\uA738': return U'\uA739';
-        case U'\uA73A': return U'\uA73B';
-        case U'\uA73C': return U'\uA73D';
-        case U'\uA73E': return U'\uA73F';
-        case U'\uA740': return U'\uA741';
-        case U'\uA742': return U'\uA743';
-        case U'\uA744': return U'\uA745';
-        case U'\uA746': return U'\uA747';
-        case U'\uA748': return U'\uA749';
-        case U'\uA74A': return U'\uA74B';
-        case U'\uA74C': return U'\uA74D';
-        case U'\uA74E': return U'\uA74F';
-        case U'\uA750': return U'\uA751';
-        case U'\uA752': return U'\uA753';
-        case U'\uA754': return U'\uA755';
-        case U'\uA756': return U'\uA757';
-        case U'\uA758': return U'\uA759';
-        case U'\uA75A': return U'\uA75B';
-        case U'\uA75C': return U'\uA75D';
-        case U'\uA75E': return U'\uA75F';
-        case U'\uA760': return U'\uA761';
-        case U'\uA762': return U'\uA763';
-        case U'\uA764': return U'\uA765';
-        case U'\uA766': return U'\uA767';
-        case U'\uA768': return U'\uA769';
-        case U'\uA76A': return U'\uA76B';
-        case U'\uA76C': return U'\uA76D';
-        case U'\uA76E': return U'\uA76F';
-        case U'\uA779': return U'\uA77A';
-        case U'\uA77B': return U'\uA77C';
-        case U'\uA77D': return U'\u1D79';
-        case U'\uA77E': return U'\uA77F';
-        case U'\uA780': return U'\uA781';
-        case U'\uA782': return U'\uA783';
-        case U'\uA784': return U'\uA785';
-        case U'\uA786': return U'\uA787';
-        case U'\uA78B': return U'\uA78C';
-        case U'\uA78D': return U'\u0265';
-        case U'\uA790': return U'\uA791';
-        case U'\uA792': return U'\uA793';
-        case U'\uA796': return U'\uA797';
-        case U'\uA798': return U'\uA799';
-        case U'\uA79A': return U'\uA79B';
-        case U'\uA79C': return U'\uA79D';
-        case U'\uA79E': return U'\uA79F';
-        case U'\uA7A0': return U'\uA7A1';
-        case U'\uA7A2': return U'\uA7A3';
-        case U'\uA7A4': return U'\uA7A5';
-        case U'\uA7A6': return U'\uA7A7';
-        case U'\uA7A8': return U'\uA7A9';
-        case U'\uA7AA': return U'\u0266';
-        case U'\uA7AB': return U'\u025C';
-        case U'\uA7AC': return U'\u0261';
-        case U'\uA7AD': return U'\u026C';
-        case U'\uA7AE': return U'\u026A';
-        case U'\uA7B0': return U'\u029E';
-        case U'\uA7B1': return U'\u0287';
-        case U'\uA7B2': return U'\u029D';
-        case U'\uA7B3': return U'\uAB53';
-        case U'\uA7B4': return U'\uA7B5';
-        case U'\uA7B6': return U'\uA7B7';
-        case U'\uA7B8': return U'\uA7B9';
-        case U'\uA7BA': return U'\uA7BB';
-        case U'\uA7BC': return U'\uA7BD';
-        case U'\uA7BE': return U'\uA7BF';
-        case U'\uA7C0': return U'\uA7C1';
-        case U'\uA7C2': return U'\uA7C3';
-        case U'\uA7C4': return U'\uA794';
-        case U'\uA7C5': return U'\u0282';
-        case U'\uA7C6': return U'\u1D8E';
-        case U'\uA7C7': return U'\uA7C8';
-        case U'\uA7C9': return U'\uA7CA';
-        case U'\uA7CB': return U'\u0264';
-        case U'\uA7CC': return U'\uA7CD';
-        case U'\uA7CE': return U'\uA7CF';
-        case U'\uA7D0': return U'\uA7D1';
-        case U'\uA7D2': return U'\uA7D3';
-        case U'\uA7D4': return U'\uA7D5';
-        case U'\uA7D6': return U'\uA7D7';
-        case U'\uA7D8': return U'\uA7D9';
-        case U'\uA7DA': return U'\uA7DB';
-        case U'\uA7DC': return U'\u019B';
-        case U'\uA7F5': return U'\uA7F6';
-        case U'\uFF21': return U'\uFF41';
-        case U'\uFF22': return U'\uFF42';
-        case U'\uFF23': return U'\uFF43';
-        case U'\uFF24': return U'\uFF44';
-        case U'\uFF25': return U'\uFF45';
-        case U'\uFF26': return U'\uFF46';
-        case U'\uFF27': return U'\uFF47';
-        case U'\uFF28': return U'\uFF48';
-        case U'\uFF29': return U'\uFF49';
-        case U'\uFF2A': return U'\uFF4A';
-        case U'\uFF2B': return U'\uFF4B';
-        case U'\uFF2C': return U'\uFF4C';
-        case U'\uFF2D': return U'\uFF4D';
-        case U'\uFF2E': return U'\uFF4E';
-        case U'\uFF2F': return U'\uFF4F';
-        case U'\uFF30': return U'\uFF50';
-        case U'\uFF31': return U'\uFF51';
-        case U'\uFF32': return U'\uFF52';
-        case U'\uFF33': return U'\uFF53';
-        case U'\uFF34': return U'\uFF54';
-        case U'\uFF35': return U'\uFF55';
-        case U'\uFF36': return U'\uFF56';
-        case U'\uFF37': return U'\uFF57';
-        case U'\uFF38': return U'\uFF58';
-        case U'\uFF39': return U'\uFF59';
-        case U'\uFF3A': return U'\uFF5A';
-        case U'\U00010400': return U'\U00010428';
-        case U'\U00010401': return U'\U00010429';
-        case U'\U00010402': return U'\U0001042A';
-        case U'\U00010403': return U'\U0001042B';
-        case U'\U00010404': return U'\U0001042C';
-        case U'\U00010405': return U'\U0001042D';
-        case U'\U00010406': return U'\U0001042E';
-        case U'\U00010407': return U'\U0001042F';
-        case U'\U00010408': return U'\U00010430';
-        case U'\U00010409': return U'\U00010431';
-        case U'\U0001040A': return U'\U00010432';
-        case U'\U0001040B': return U'\U00010433';
-        case U'\U0001040C': return U'\U00010434';
-        case U'\U0001040D': return U'\U00010435';
-        case U'\U0001040E': return U'\U00010436';
-        case U'\U0001040F': return U'\U00010437';
-        case U'\U00010410': return U'\U00010438';
-        case U'\U00010411': return U'\U00010439';
-        case U'\U00010412': return U'\U0001043A';
-        case U'\U00010413': return U'\U0001043B';
-        case U'\U00010414': return U'\U0001043C';
-        case U'\U00010415': return U'\U0001043D';
-        case U'\U00010416': return U'\U0001043E';
-        case U'\U00010417': return U'\U0001043F';
-        case U'\U00010418': return U'\U00010440';
-        case U'\U00010419': return U'\U00010441';
-        case U'\U0001041A': return U'\U00010442';
-        case U'\U0001041B': return U'\U00010443';
-        case U'\U0001041C': return U'\U00010444';
-        case U'\U0001041D': return U'\U00010445';
-        case U'\U0001041E': return U'\U00010446';
-        case U'\U0001041F': return U'\U00010447';
-        case U'\U00010420': return U'\U00010448';
-        case U'\U00010421': return U'\U00010449';
-        case U'\U00010422': return U'\U0001044A';
-        case U'\U00010423': return U'\U0001044B';
-        case U'\U00010424': return U'\U0001044C';
-        case U'\U00010425': return U'\U0001044D';
-        case U'\U00010426': return U'\U0001044E';
-        case U'\U00010427': return U'\U0001044F';
-        case U'\U000104B0': return U'\U000104D8';
-        case U'\U000104B1': return U'\U000104D9';
-        case U'\U000104B2': return U'\U000104DA';
-        case U'\U000104B3': return U'\U000104DB';
-        case U'\U000104B4': return U'\U000104DC';
-        case U'\U000104B5': return U'\U000104DD';
-        case U'\U000104B6': return U'\U000104DE';
-        case U'\U000104B7': return U'\U000104DF';
-        case U'\U000104B8': return U'\U000104E0';
-        case U'\U000104B9': return U'\U000104E1';
-        case U'\U000104BA': return U'\U000104E2';
-        case U'\U000104BB': return U'\U000104E3';
-        case U'\U000104BC': return U'\U000104E4';
-        case U'\U000104BD': return U'\U000104E5';
-        case U'\U000104BE': return U'\U000104E6';
-        case U'\U000104BF': return U'\U000104E7';
-        case U'\U000104C0': return U'\U000104E8';
-        case U'\U000104C1': return U'\U000104E9';
-        case U'\U000104C2': return U'\U000104EA';
-        case U'\U000104C3': return U'\U000104EB';
-        case U'\U000104C4': return U'\U000104EC';
-        case U'\U000104C5': return U'\U000104ED';
-        case U'\U000104C6': return U'\U000104EE';
-        case U'\U000104C7': return U'\U000104EF';
-        case U'\U000104C8': return U'\U000104F0';
-        case U'\U000104C9': return U'\U000104F1';
-        case U'\U000104CA': return U'\U000104F2';
-        case U'\U000104CB': return U'\U000104F3';
-        case U'\U000104CC': return U'\U000104F4';
-        case U'\U000104CD': return U'\U000104F5';
-        case U'\U000104CE': return U'\U000104F6';
-        case U'\U000104CF': return U'\U000104F7';
-        case U'\U000104D0': return U'\U000104F8';
-        case U'\U000104D1': return U'\U000104F9';
-        case U'\U000104D2': return U'\U000104FA';
-        case U'\U000104D3': return U'\U000104FB';
-        case U'\U00010570': return U'\U00010597';
-        case U'\U00010571': return U'\U00010598';
-        case U'\U00010572': return U'\U00010599';
-        case U'\U00010573': return U'\U0001059A';
-        case U'\U00010574': return U'\U0001059B';
-        case U'\U00010575': return U'\U0001059C';
-        case U'\U00010576': return U'\U0001059D';
-        case U'\U00010577': return U'\U0001059E';
-        case U'\U00010578': return U'\U0001059F';
-        case U'\U00010579': return U'\U000105A0';
-        case U'\U0001057A': return U'\U000105A1';
-        case U'\U0001057C': return U'\U000105A3';
-        case U'\U0001057D': return U'\U000105A4';
-        case U'\U0001057E': return U'\U000105A5';
-        case U'\U0001057F': return U'\U000105A6';
-        case U'\U00010580': return U'\U000105A7';
-        case U'\U00010581': return U'\U000105A8';
-        case U'\U00010582': return U'\U000105A9';
-        case U'\U00010583': return U'\U000105AA';
-        case U'\U00010584': return U'\U000105AB';
-        case U'\U00010585': return U'\U000105AC';
-        case U'\U00010586': return U'\U000105AD';
-        case U'\U00010587': return U'\U000105AE';
-        case U'\U00010588': return U'\U000105AF';
-        case U'\U00010589': return U'\U000105B0';
-        case U'\U0001058A': return U'\U000105B1';
-        case U'\U0001058C': return U'\U000105B3';
-        case U'\U0001058D': return U'\U000105B4';
-        case U'\U0001058E': return U'\U000105B5';
-        case U'\U0001058F': return U'\U000105B6';
-        case U'\U00010590': return U'\U000105B7';
-        case U'\U00010591': return U'\U000105B8';
-        case U'\U00010592': return U'\U000105B9';
-        case U'\U00010594': return U'\U000105BB';
-        case U'\U00010595': return U'\U000105BC';
-        case U'\U00010C80': return U'\U00010CC0';
-        case U'\U00010C81': return U'\U00010CC1';
-        case U'\U00010C82': return U'\U00010CC2';
-        case U'\U00010C83': return U'\U00010CC3';
-        case U'\U00010C84': return U'\U00010CC4';
-        case U'\U00010C85': return U'\U00010CC5';
-        case U'\U00010C86': return U'\U00010CC6';
-        case U'\U00010C87': return U'\U00010CC7';
-        case U'\U00010C88': return U'\U00010CC8';
-        case U'\U00010C89': return U'\U00010CC9';
-        case U'\U00010C8A': return U'\U00010CCA';
-        case U'\U00010C8B': return U'\U00010CCB';
-        case U'\U00010C8C': return U'\U00010CCC';
-        case U'\U00010C8D': return U'\U00010CCD';
-        case U'\U00010C8E': return U'\U00010CCE';
-        case U'\U00010C8F': return U'\U00010CCF';
-        case U'\U00010C90': return U'\U00010CD0';
-        case U'\U00010C91': return U'\U00010CD1';
-        case U'\U00010C92': return U'\U00010CD2';
-        case U'\U00010C93': return U'\U00010CD3';
-        case U'\U00010C94': return U'\U00010CD4';
-        case U'\U00010C95': return U'\U00010CD5';
-        case U'\U00010C96': return U'\U00010CD6';
-        case U'\U00010C97': return U'\U00010CD7';
-        case U'\U00010C98': return U'\U00010CD8';
-        case U'\U00010C99': return U'\U00010CD9';
-        case U'\U00010C9A': return U'\U00010CDA';
-        case U'\U00010C9B': return U'\U00010CDB';
-        case U'\U00010C9C': return U'\U00010CDC';
-        case U'\U00010C9D': return U'\U00010CDD';
-        case U'\U00010C9E': return U'\U00010CDE';
-        case U'\U00010C9F': return U'\U00010CDF';
-        case U'\U00010CA0': return U'\U00010CE0';
-        case U'\U00010CA1': return U'\U00010CE1';
-        case U'\U00010CA2': return U'\U00010CE2';
-        case U'\U00010CA3': return U'\U00010CE3';
-        case U'\U00010CA4': return U'\U00010CE4';
-        case U'\U00010CA5': return U'\U00010CE5';
-        case U'\U00010CA6': return U'\U00010CE6';
-        case U'\U00010CA7': return U'\U00010CE7';
-        case U'\U00010CA8': return U'\U00010CE8';
-        case U'\U00010CA9': return U'\U00010CE9';
-        case U'\U00010CAA': return U'\U00010CEA';
-        case U'\U00010CAB': return U'\U00010CEB';
-        case U'\U00010CAC': return U'\U00010CEC';
-        case U'\U00010CAD': return U'\U00010CED';
-        case U'\U00010CAE': return U'\U00010CEE';
-        case U'\U00010CAF': return U'\U00010CEF';
-        case U'\U00010CB0': return U'\U00010CF0';
-        case U'\U00010CB1': return U'\U00010CF1';
-        case U'\U00010CB2': return U'\U00010CF2';
-        case U'\U00010D50': return U'\U00010D70';
-        case U'\U00010D51': return U'\U00010D71';
-        case U'\U00010D52': return U'\U00010D72';
-        case U'\U00010D53': return U'\U00010D73';
-        case U'\U00010D54': return U'\U00010D74';
-        case U'\U00010D55': return U'\U00010D75';
-        case U'\U00010D56': return U'\U00010D76';
-        case U'\U00010D57': return U'\U00010D77';
-        case U'\U00010D58': return U'\U00010D78';
-        case U'\U00010D59': return U'\U00010D79';
-        case U'\U00010D5A': return U'\U00010D7A';
-        case U'\U00010D5B': return U'\U00010D7B';
-        case U'\U00010D5C': return U'\U00010D7C';
-        case U'\U00010D5D': return U'\U00010D7D';
-        case U'\U00010D5E': return U'\U00010D7E';
-        case U'\U00010D5F': return U'\U00010D7F';
-        case U'\U00010D60': return U'\U00010D80';
-        case U'\U00010D61': return U'\U00010D81';
-        case U'\U00010D62': return U'\U00010D82';
-        case U'\U00010D63': return U'\U00010D83';
-        case U'\U00010D64': return U'\U00010D84';
-        case U'\U00010D65': return U'\U00010D85';
-        case U'\U000118A0': return U'\U000118C0';
-        case U'\U000118A1': return U'\U000118C1';
-        case U'\U000118A2': return U'\U000118C2';
-        case U'\U000118A3': return U'\U000118C3';
-        case U'\U000118A4': return U'\U000118C4';
-        case U'\U000118A5': return U'\U000118C5';
-        case U'\U000118A6': return U'\U000118C6';
-        case U'\U000118A7': return U'\U000118C7';
-        case U'\U000118A8': return U'\U000118C8';
-        case U'\U000118A9': return U'\U000118C9';
-        case U'\U000118AA': return U'\U000118CA';
-        case U'\U000118AB': return U'\U000118CB';
-        case U'\U000118AC': return U'\U000118CC';
-        case U'\U000118AD': return U'\U000118CD';
-        case U'\U000118AE': return U'\U000118CE';
-        case U'\U000118AF': return U'\U000118CF';
-        case U'\U000118B0': return U'\U000118D0';
-        case U'\U000118B1': return U'\U000118D1';
-        case U'\U000118B2': return U'\U000118D2';
-        case U'\U000118B3': return U'\U000118D3';
-        case U'\U000118B4': return U'\U000118D4';
-        case U'\U000118B5': return U'\U000118D5';
-        case U'\U000118B6': return U'\U000118D6';
-        case U'\U000118B7': return U'\U000118D7';
-        case U'\U000118B8': return U'\U000118D8';
-        case U'\U000118B9': return U'\U000118D9';
-        case U'\U000118BA': return U'\U000118DA';
-        case U'\U000118BB': return U'\U000118DB';
-        case U'\U000118BC': return U'\U000118DC';
-        case U'\U000118BD': return U'\U000118DD';
-        case U'\U000118BE': return U'\U000118DE';
-        case U'\U000118BF': return U'\U000118DF';
-        case U'\U00016E40': return U'\U00016E60';
-        case U'\U00016E41': return U'\U00016E61';
-        case U'\U00016E42': return U'\U00016E62';
-        case U'\U00016E43': return U'\U00016E63';
-        case U'\U00016E44': return U'\U00016E64';
-        case U'\U00016E45': return U'\U00016E65';
-        case U'\U00016E46': return U'\U00016E66';
-        case U'\U00016E47': return U'\U00016E67';
-        case U'\U00016E48': return U'\U00016E68';
-        case U'\U00016E49': return U'\U00016E69';
-        case U'\U00016E4A': return U'\U00016E6A';
-        case U'\U00016E4B': return U'\U00016E6B';
-        case U'\U00016E4C': return U'\U00016E6C';
-        case U'\U00016E4D': return U'\U00016E6D';
-        case U'\U00016E4E': return U'\U00016E6E';
-        case U'\U00016E4F': return U'\U00016E6F';
-        case U'\U00016E50': return U'\U00016E70';
-        case U'\U00016E51': return U'\U00016E71';
-        case U'\U00016E52': return U'\U00016E72';
-        case U'\U00016E53': return U'\U00016E73';
-        case U'\U00016E54': return U'\U00016E74';
-        case U'\U00016E55': return U'\U00016E75';
-        case U'\U00016E56': return U'\U00016E76';
-        case U'\U00016E57': return U'\U00016E77';
-        case U'\U00016E58': return U'\U00016E78';
-        case U'\U00016E59': return U'\U00016E79';
-        case U'\U00016E5A': return U'\U00016E7A';
-        case U'\U00016E5B': return U'\U00016E7B';
-        case U'\U00016E5C': return U'\U00016E7C';
-        case U'\U00016E5D': return U'\U00016E7D';
-        case U'\U00016E5E': return U'\U00016E7E';
-        case U'\U00016E5F': return U'\U00016E7F';
-        case U'\U00016EA0': return U'\U00016EBB';
-        case U'\U00016EA1': return U'\U00016EBC';
-        case U'\U00016EA2': return U'\U00016EBD';
-        case U'\U00016EA3': return U'\U00016EBE';
-        case U'\U00016EA4': return U'\U00016EBF';
-        case U'\U00016EA5': return U'\U00016EC0';
-        case U'\U00016EA6': return U'\U00016EC1';
-        case U'\U00016EA7': return U'\U00016EC2';
-        case U'\U00016EA8': return U'\U00016EC3';
-        case U'\U00016EA9': return U'\U00016EC4';
-        case U'\U00016EAA': return U'\U00016EC5';
-        case U'\U00016EAB': return U'\U00016EC6';
-        case U'\U00016EAC': return U'\U00016EC7';
-        case U'\U00016EAD': return U'\U00016EC8';
-        case U'\U00016EAE': return U'\U00016EC9';
-        case U'\U00016EAF': return U'\U00016ECA';
-        case U'\U00016EB0': return U'\U00016ECB';
-        case U'\U00016EB1': return U'\U00016ECC';
-        case U'\U00016EB2': return U'\U00016ECD';
-        case U'\U00016EB3': return U'\U00016ECE';
-        case U'\U00016EB4': return U'\U00016ECF';
-        case U'\U00016EB5': return U'\U00016ED0';
-        case U'\U00016EB6': return U'\U00016ED1';
-        case U'\U00016EB7': return U'\U00016ED2';
-        case U'\U00016EB8': return U'\U00016ED3';
-        case U'\U0001E900': return U'\U0001E922';
-        case U'\U0001E901': return U'\U0001E923';
-        case U'\U0001E902': return U'\U0001E924';
-        case U'\U0001E903': return U'\U0001E925';
-        case U'\U0001E904': return U'\U0001E926';
-        case U'\U0001E905': return U'\U0001E927';
-        case U'\U0001E906': return U'\U0001E928';
-        case U'\U0001E907': return U'\U0001E929';
-        case U'\U0001E908': return U'\U0001E92A';
-        case U'\U0001E909': return U'\U0001E92B';
-        case U'\U0001E90A': return U'\U0001E92C';
-        case U'\U0001E90B': return U'\U0001E92D';
-        case U'\U0001E90C': return U'\U0001E92E';
-        case U'\U0001E90D': return U'\U0001E92F';
-        case U'\U0001E90E': return U'\U0001E930';
-        case U'\U0001E90F': return U'\U0001E931';
-        case U'\U0001E910': return U'\U0001E932';
-        case U'\U0001E911': return U'\U0001E933';
-        case U'\U0001E912': return U'\U0001E934';
-        case U'\U0001E913': return U'\U0001E935';
-        case U'\U0001E914': return U'\U0001E936';
-        case U'\U0001E915': return U'\U0001E937';
-        case U'\U0001E916': return U'\U0001E938';
-        case U'\U0001E917': return U'\U0001E939';
-        case U'\U0001E918': return U'\U0001E93A';
-        case U'\U0001E919': return U'\U0001E93B';
-        case U'\U0001E91A': return U'\U0001E93C';
-        case U'\U0001E91B': return U'\U0001E93D';
-        case U'\U0001E91C': return U'\U0001E93E';
-        case U'\U0001E91D': return U'\U0001E93F';
-        case U'\U0001E91E': return U'\U0001E940';
-        case U'\U0001E91F': return U'\U0001E941';
-        case U'\U0001E920': return U'\U0001E942';
-        case U'\U0001E921': return U'\U0001E943';
-        default: return c;
-        }
-    }
+    inline constexpr size_t casing_shift = 7uz;
     /// @internal
     /// @ingroup sys_internal
-    constexpr char32_t dchar_to_upper_simple(const char32_t c) noexcept
-    {
-        switch (c)
-        {
-        case U'\u0061': return U'\u0041';
-        case U'\u0062': return U'\u0042';
-        case U'\u0063': return U'\u0043';
-        case U'\u0064': return U'\u0044';
-        case U'\u0065': return U'\u0045';
-        case U'\u0066': return U'\u0046';
-        case U'\u0067': return U'\u0047';
-        case U'\u0068': return U'\u0048';
-        case U'\u0069': return U'\u0049';
-        case U'\u006A': return U'\u004A';
-        case U'\u006B': return U'\u004B';
-        case U'\u006C': return U'\u004C';
-        case U'\u006D': return U'\u004D';
-        case U'\u006E': return U'\u004E';
-        case U'\u006F': return U'\u004F';
-        case U'\u0070': return U'\u0050';
-        case U'\u0071': return U'\u0051';
-        case U'\u0072': return U'\u0052';
-        case U'\u0073': return U'\u0053';
-        case U'\u0074': return U'\u0054';
-        case U'\u0075': return U'\u0055';
-        case U'\u0076': return U'\u0056';
-        case U'\u0077': return U'\u0057';
-        case U'\u0078': return U'\u0058';
-        case U'\u0079': return U'\u0059';
-        case U'\u007A': return U'\u005A';
-        case U'\u00B5': return U'\u039C';
-        case U'\u00E0': return U'\u00C0';
-        case U'\u00E1': return U'\u00C1';
-        case U'\u00E2': return U'\u00C2';
-        case U'\u00E3': return U'\u00C3';
-        case U'\u00E4': return U'\u00C4';
-        case U'\u00E5': return U'\u00C5';
-        case U'\u00E6': return U'\u00C6';
-        case U'\u00E7': return U'\u00C7';
-        case U'\u00E8': return U'\u00C8';
-        case U'\u00E9': return U'\u00C9';
-        case U'\u00EA': return U'\u00CA';
-        case U'\u00EB': return U'\u00CB';
-        case U'\u00EC': return U'\u00CC';
-        case U'\u00ED': return U'\u00CD';
-        case U'\u00EE': return U'\u00CE';
-        case U'\u00EF': return U'\u00CF';
-        case U'\u00F0': return U'\u00D0';
-        case U'\u00F1': return U'\u00D1';
-        case U'\u00F2': return U'\u00D2';
-        case U'\u00F3': return U'\u00D3';
-        case U'\u00F4': return U'\u00D4';
-        case U'\u00F5': return U'\u00D5';
-        case U'\u00F6': return U'\u00D6';
-        case U'\u00F8': return U'\u00D8';
-        case U'\u00F9': return U'\u00D9';
-        case U'\u00FA': return U'\u00DA';
-        case U'\u00FB': return U'\u00DB';
-        case U'\u00FC': return U'\u00DC';
-        case U'\u00FD': return U'\u00DD';
-        case U'\u00FE': return U'\u00DE';
-        case U'\u00FF': return U'\u0178';
-        case U'\u0101': return U'\u0100';
-        case U'\u0103': return U'\u0102';
-        case U'\u0105': return U'\u0104';
-        case U'\u0107': return U'\u0106';
-        case U'\u0109': return U'\u0108';
-        case U'\u010B': return U'\u010A';
-        case U'\u010D': return U'\u010C';
-        case U'\u010F': return U'\u010E';
-        case U'\u0111': return U'\u0110';
-        case U'\u0113': return U'\u0112';
-        case U'\u0115': return U'\u0114';
-        case U'\u0117': return U'\u0116';
-        case U'\u0119': return U'\u0118';
-        case U'\u011B': return U'\u011A';
-        case U'\u011D': return U'\u011C';
-        case U'\u011F': return U'\u011E';
-        case U'\u0121': return U'\u0120';
-        case U'\u0123': return U'\u0122';
-        case U'\u0125': return U'\u0124';
-        case U'\u0127': return U'\u0126';
-        case U'\u0129': return U'\u0128';
-        case U'\u012B': return U'\u012A';
-        case U'\u012D': return U'\u012C';
-        case U'\u012F': return U'\u012E';
-        case U'\u0131': return U'\u0049';
-        case U'\u0133': return U'\u0132';
-        case U'\u0135': return U'\u0134';
-        case U'\u0137': return U'\u0136';
-        case U'\u013A': return U'\u0139';
-        case U'\u013C': return U'\u013B';
-        case U'\u013E': return U'\u013D';
-        case U'\u0140': return U'\u013F';
-        case U'\u0142': return U'\u0141';
-        case U'\u0144': return U'\u0143';
-        case U'\u0146': return U'\u0145';
-        case U'\u0148': return U'\u0147';
-        case U'\u014B': return U'\u014A';
-        case U'\u014D': return U'\u014C';
-        case U'\u014F': return U'\u014E';
-        case U'\u0151': return U'\u0150';
-        case U'\u0153': return U'\u0152';
-        case U'\u0155': return U'\u0154';
-        case U'\u0157': return U'\u0156';
-        case U'\u0159': return U'\u0158';
-        case U'\u015B': return U'\u015A';
-        case U'\u015D': return U'\u015C';
-        case U'\u015F': return U'\u015E';
-        case U'\u0161': return U'\u0160';
-        case U'\u0163': return U'\u0162';
-        case U'\u0165': return U'\u0164';
-        case U'\u0167': return U'\u0166';
-        case U'\u0169': return U'\u0168';
-        case U'\u016B': return U'\u016A';
-        case U'\u016D': return U'\u016C';
-        case U'\u016F': return U'\u016E';
-        case U'\u0171': return U'\u0170';
-        case U'\u0173': return U'\u0172';
-        case U'\u0175': return U'\u0174';
-        case U'\u0177': return U'\u0176';
-        case U'\u017A': return U'\u0179';
-        case U'\u017C': return U'\u017B';
-        case U'\u017E': return U'\u017D';
-        case U'\u017F': return U'\u0053';
-        case U'\u0180': return U'\u0243';
-        case U'\u0183': return U'\u0182';
-        case U'\u0185': return U'\u0184';
-        case U'\u0188': return U'\u0187';
-        case U'\u018C': return U'\u018B';
-        case U'\u0192': return U'\u0191';
-        case U'\u0195': return U'\u01F6';
-        case U'\u0199': return U'\u0198';
-        case U'\u019A': return U'\u023D';
-        case U'\u019B': return U'\uA7DC';
-        case U'\u019E': return U'\u0220';
-        case U'\u01A1': return U'\u01A0';
-        case U'\u01A3': return U'\u01A2';
-        case U'\u01A5': return U'\u01A4';
-        case U'\u01A8': return U'\u01A7';
-        case U'\u01AD': return U'\u01AC';
-        case U'\u01B0': return U'\u01AF';
-        case U'\u01B4': return U'\u01B3';
-        case U'\u01B6': return U'\u01B5';
-        case U'\u01B9': return U'\u01B8';
-        case U'\u01BD': return U'\u01BC';
-        case U'\u01BF': return U'\u01F7';
-        case U'\u01C5': return U'\u01C4';
-        case U'\u01C6': return U'\u01C4';
-        case U'\u01C8': return U'\u01C7';
-        case U'\u01C9': return U'\u01C7';
-        case U'\u01CB': return U'\u01CA';
-        case U'\u01CC': return U'\u01CA';
-        case U'\u01CE': return U'\u01CD';
-        case U'\u01D0': return U'\u01CF';
-        case U'\u01D2': return U'\u01D1';
-        case U'\u01D4': return U'\u01D3';
-        case U'\u01D6': return U'\u01D5';
-        case U'\u01D8': return U'\u01D7';
-        case U'\u01DA': return U'\u01D9';
-        case U'\u01DC': return U'\u01DB';
-        case U'\u01DD': return U'\u018E';
-        case U'\u01DF': return U'\u01DE';
-        case U'\u01E1': return U'\u01E0';
-        case U'\u01E3': return U'\u01E2';
-        case U'\u01E5': return U'\u01E4';
-        case U'\u01E7': return U'\u01E6';
-        case U'\u01E9': return U'\u01E8';
-        case U'\u01EB': return U'\u01EA';
-        case U'\u01ED': return U'\u01EC';
-        case U'\u01EF': return U'\u01EE';
-        case U'\u01F2': return U'\u01F1';
-        case U'\u01F3': return U'\u01F1';
-        case U'\u01F5': return U'\u01F4';
-        case U'\u01F9': return U'\u01F8';
-        case U'\u01FB': return U'\u01FA';
-        case U'\u01FD': return U'\u01FC';
-        case U'\u01FF': return U'\u01FE';
-        case U'\u0201': return U'\u0200';
-        case U'\u0203': return U'\u0202';
-        case U'\u0205': return U'\u0204';
-        case U'\u0207': return U'\u0206';
-        case U'\u0209': return U'\u0208';
-        case U'\u020B': return U'\u020A';
-        case U'\u020D': return U'\u020C';
-        case U'\u020F': return U'\u020E';
-        case U'\u0211': return U'\u0210';
-        case U'\u0213': return U'\u0212';
-        case U'\u0215': return U'\u0214';
-        case U'\u0217': return U'\u0216';
-        case U'\u0219': return U'\u0218';
-        case U'\u021B': return U'\u021A';
-        case U'\u021D': return U'\u021C';
-        case U'\u021F': return U'\u021E';
-        case U'\u0223': return U'\u0222';
-        case U'\u0225': return U'\u0224';
-        case U'\u0227': return U'\u0226';
-        case U'\u0229': return U'\u0228';
-        case U'\u022B': return U'\u022A';
-        case U'\u022D': return U'\u022C';
-        case U'\u022F': return U'\u022E';
-        case U'\u0231': return U'\u0230';
-        case U'\u0233': return U'\u0232';
-        case U'\u023C': return U'\u023B';
-        case U'\u023F': return U'\u2C7E';
-        case U'\u0240': return U'\u2C7F';
-        case U'\u0242': return U'\u0241';
-        case U'\u0247': return U'\u0246';
-        case U'\u0249': return U'\u0248';
-        case U'\u024B': return U'\u024A';
-        case U'\u024D': return U'\u024C';
-        case U'\u024F': return U'\u024E';
-        case U'\u0250': return U'\u2C6F';
-        case U'\u0251': return U'\u2C6D';
-        case U'\u0252': return U'\u2C70';
-        case U'\u0253': return U'\u0181';
-        case U'\u0254': return U'\u0186';
-        case U'\u0256': return U'\u0189';
-        case U'\u0257': return U'\u018A';
-        case U'\u0259': return U'\u018F';
-        case U'\u025B': return U'\u0190';
-        case U'\u025C': return U'\uA7AB';
-        case U'\u0260': return U'\u0193';
-        case U'\u0261': return U'\uA7AC';
-        case U'\u0263': return U'\u0194';
-        case U'\u0264': return U'\uA7CB';
-        case U'\u0265': return U'\uA78D';
-        case U'\u0266': return U'\uA7AA';
-        case U'\u0268': return U'\u0197';
-        case U'\u0269': return U'\u0196';
-        case U'\u026A': return U'\uA7AE';
-        case U'\u026B': return U'\u2C62';
-        case U'\u026C': return U'\uA7AD';
-        case U'\u026F': return U'\u019C';
-        case U'\u0271': return U'\u2C6E';
-        case U'\u0272': return U'\u019D';
-        case U'\u0275': return U'\u019F';
-        case U'\u027D': return U'\u2C64';
-        case U'\u0280': return U'\u01A6';
-        case U'\u0282': return U'\uA7C5';
-        case U'\u0283': return U'\u01A9';
-        case U'\u0287': return U'\uA7B1';
-        case U'\u0288': return U'\u01AE';
-        case U'\u0289': return U'\u0244';
-        case U'\u028A': return U'\u01B1';
-        case U'\u028B': return U'\u01B2';
-        case U'\u028C': return U'\u0245';
-        case U'\u0292': return U'\u01B7';
-        case U'\u029D': return U'\uA7B2';
-        case U'\u029E': return U'\uA7B0';
-        case U'\u0345': return U'\u0399';
-        case U'\u0371': return U'\u0370';
-        case U'\u0373': return U'\u0372';
-        case U'\u0377': return U'\u0376';
-        case U'\u037B': return U'\u03FD';
-        case U'\u037C': return U'\u03FE';
-        case U'\u037D': return U'\u03FF';
-        case U'\u03AC': return U'\u0386';
-        case U'\u03AD': return U'\u0388';
-        case U'\u03AE': return U'\u0389';
-        case U'\u03AF': return U'\u038A';
-        case U'\u03B1': return U'\u0391';
-        case U'\u03B2': return U'\u0392';
-        case U'\u03B3': return U'\u0393';
-        case U'\u03B4': return U'\u0394';
-        case U'\u03B5': return U'\u0395';
-        case U'\u03B6': return U'\u0396';
-        case U'\u03B7': return U'\u0397';
-        case U'\u03B8': return U'\u0398';
-        case U'\u03B9': return U'\u0399';
-        case U'\u03BA': return U'\u039A';
-        case U'\u03BB': return U'\u039B';
-        case U'\u03BC': return U'\u039C';
-        case U'\u03BD': return U'\u039D';
-        case U'\u03BE': return U'\u039E';
-        case U'\u03BF': return U'\u039F';
-        case U'\u03C0': return U'\u03A0';
-        case U'\u03C1': return U'\u03A1';
-        case U'\u03C2': return U'\u03A3';
-        case U'\u03C3': return U'\u03A3';
-        case U'\u03C4': return U'\u03A4';
-        case U'\u03C5': return U'\u03A5';
-        case U'\u03C6': return U'\u03A6';
-        case U'\u03C7': return U'\u03A7';
-        case U'\u03C8': return U'\u03A8';
-        case U'\u03C9': return U'\u03A9';
-        case U'\u03CA': return U'\u03AA';
-        case U'\u03CB': return U'\u03AB';
-        case U'\u03CC': return U'\u038C';
-        case U'\u03CD': return U'\u038E';
-        case U'\u03CE': return U'\u038F';
-        case U'\u03D0': return U'\u0392';
-        case U'\u03D1': return U'\u0398';
-        case U'\u03D5': return U'\u03A6';
-        case U'\u03D6': return U'\u03A0';
-        case U'\u03D7': return U'\u03CF';
-        case U'\u03D9': return U'\u03D8';
-        case U'\u03DB': return U'\u03DA';
-        case U'\u03DD': return U'\u03DC';
-        case U'\u03DF': return U'\u03DE';
-        case U'\u03E1': return U'\u03E0';
-        case U'\u03E3': return U'\u03E2';
-        case U'\u03E5': return U'\u03E4';
-        case U'\u03E7': return U'\u03E6';
-        case U'\u03E9': return U'\u03E8';
-        case U'\u03EB': return U'\u03EA';
-        case U'\u03ED': return U'\u03EC';
-        case U'\u03EF': return U'\u03EE';
-        case U'\u03F0': return U'\u039A';
-        case U'\u03F1': return U'\u03A1';
-        case U'\u03F2': return U'\u03F9';
-        case U'\u03F3': return U'\u037F';
-        case U'\u03F5': return U'\u0395';
-        case U'\u03F8': return U'\u03F7';
-        case U'\u03FB': return U'\u03FA';
-        case U'\u0430': return U'\u0410';
-        case U'\u0431': return U'\u0411';
-        case U'\u0432': return U'\u0412';
-        case U'\u0433': return U'\u0413';
-        case U'\u0434': return U'\u0414';
-        case U'\u0435': return U'\u0415';
-        case U'\u0436': return U'\u0416';
-        case U'\u0437': return U'\u0417';
-        case U'\u0438': return U'\u0418';
-        case U'\u0439': return U'\u0419';
-        case U'\u043A': return U'\u041A';
-        case U'\u043B': return U'\u041B';
-        case U'\u043C': return U'\u041C';
-        case U'\u043D': return U'\u041D';
-        case U'\u043E': return U'\u041E';
-        case U'\u043F': return U'\u041F';
-        case U'\u0440': return U'\u0420';
-        case U'\u0441': return U'\u0421';
-        case U'\u0442': return U'\u0422';
-        case U'\u0443': return U'\u0423';
-        case U'\u0444': return U'\u0424';
-        case U'\u0445': return U'\u0425';
-        case U'\u0446': return U'\u0426';
-        case U'\u0447': return U'\u0427';
-        case U'\u0448': return U'\u0428';
-        case U'\u0449': return U'\u0429';
-        case U'\u044A': return U'\u042A';
-        case U'\u044B': return U'\u042B';
-        case U'\u044C': return U'\u042C';
-        case U'\u044D': return U'\u042D';
-        case U'\u044E': return U'\u042E';
-        case U'\u044F': return U'\u042F';
-        case U'\u0450': return U'\u0400';
-        case U'\u0451': return U'\u0401';
-        case U'\u0452': return U'\u0402';
-        case U'\u0453': return U'\u0403';
-        case U'\u0454': return U'\u0404';
-        case U'\u0455': return U'\u0405';
-        case U'\u0456': return U'\u0406';
-        case U'\u0457': return U'\u0407';
-        case U'\u0458': return U'\u0408';
-        case U'\u0459': return U'\u0409';
-        case U'\u045A': return U'\u040A';
-        case U'\u045B': return U'\u040B';
-        case U'\u045C': return U'\u040C';
-        case U'\u045D': return U'\u040D';
-        case U'\u045E': return U'\u040E';
-        case U'\u045F': return U'\u040F';
-        case U'\u0461': return U'\u0460';
-        case U'\u0463': return U'\u0462';
-        case U'\u0465': return U'\u0464';
-        case U'\u0467': return U'\u0466';
-        case U'\u0469': return U'\u0468';
-        case U'\u046B': return U'\u046A';
-        case U'\u046D': return U'\u046C';
-        case U'\u046F': return U'\u046E';
-        case U'\u0471': return U'\u0470';
-        case U'\u0473': return U'\u0472';
-        case U'\u0475': return U'\u0474';
-        case U'\u0477': return U'\u0476';
-        case U'\u0479': return U'\u0478';
-        case U'\u047B': return U'\u047A';
-        case U'\u047D': return U'\u047C';
-        case U'\u047F': return U'\u047E';
-        case U'\u0481': return U'\u0480';
-        case U'\u048B': return U'\u048A';
-        case U'\u048D': return U'\u048C';
-        case U'\u048F': return U'\u048E';
-        case U'\u0491': return U'\u0490';
-        case U'\u0493': return U'\u0492';
-        case U'\u0495': return U'\u0494';
-        case U'\u0497': return U'\u0496';
-        case U'\u0499': return U'\u0498';
-        case U'\u049B': return U'\u049A';
-        case U'\u049D': return U'\u049C';
-        case U'\u049F': return U'\u049E';
-        case U'\u04A1': return U'\u04A0';
-        case U'\u04A3': return U'\u04A2';
-        case U'\u04A5': return U'\u04A4';
-        case U'\u04A7': return U'\u04A6';
-        case U'\u04A9': return U'\u04A8';
-        case U'\u04AB': return U'\u04AA';
-        case U'\u04AD': return U'\u04AC';
-        case U'\u04AF': return U'\u04AE';
-        case U'\u04B1': return U'\u04B0';
-        case U'\u04B3': return U'\u04B2';
-        case U'\u04B5': return U'\u04B4';
-        case U'\u04B7': return U'\u04B6';
-        case U'\u04B9': return U'\u04B8';
-        case U'\u04BB': return U'\u04BA';
-        case U'\u04BD': return U'\u04BC';
-        case U'\u04BF': return U'\u04BE';
-        case U'\u04C2': return U'\u04C1';
-        case U'\u04C4': return U'\u04C3';
-        case U'\u04C6': return U'\u04C5';
-        case U'\u04C8': return U'\u04C7';
-        case U'\u04CA': return U'\u04C9';
-        case U'\u04CC': return U'\u04CB';
-        case U'\u04CE': return U'\u04CD';
-        case U'\u04CF': return U'\u04C0';
-        case U'\u04D1': return U'\u04D0';
-        case U'\u04D3': return U'\u04D2';
-        case U'\u04D5': return U'\u04D4';
-        case U'\u04D7': return U'\u04D6';
-        case U'\u04D9': return U'\u04D8';
-        case U'\u04DB': return U'\u04DA';
-        case U'\u04DD': return U'\u04DC';
-        case U'\u04DF': return U'\u04DE';
-        case U'\u04E1': return U'\u04E0';
-        case U'\u04E3': return U'\u04E2';
-        case U'\u04E5': return U'\u04E4';
-        case U'\u04E7': return U'\u04E6';
-        case U'\u04E9': return U'\u04E8';
-        case U'\u04EB': return U'\u04EA';
-        case U'\u04ED': return U'\u04EC';
-        case U'\u04EF': return U'\u04EE';
-        case U'\u04F1': return U'\u04F0';
-        case U'\u04F3': return U'\u04F2';
-        case U'\u04F5': return U'\u04F4';
-        case U'\u04F7': return U'\u04F6';
-        case U'\u04F9': return U'\u04F8';
-        case U'\u04FB': return U'\u04FA';
-        case U'\u04FD': return U'\u04FC';
-        case U'\u04FF': return U'\u04FE';
-        case U'\u0501': return U'\u0500';
-        case U'\u0503': return U'\u0502';
-        case U'\u0505': return U'\u0504';
-        case U'\u0507': return U'\u0506';
-        case U'\u0509': return U'\u0508';
-        case U'\u050B': return U'\u050A';
-        case U'\u050D': return U'\u050C';
-        case U'\u050F': return U'\u050E';
-        case U'\u0511': return U'\u0510';
-        case U'\u0513': return U'\u0512';
-        case U'\u0515': return U'\u0514';
-        case U'\u0517': return U'\u0516';
-        case U'\u0519': return U'\u0518';
-        case U'\u051B': return U'\u051A';
-        case U'\u051D': return U'\u051C';
-        case U'\u051F': return U'\u051E';
-        case U'\u0521': return U'\u0520';
-        case U'\u0523': return U'\u0522';
-        case U'\u0525': return U'\u0524';
-        case U'\u0527': return U'\u0526';
-        case U'\u0529': return U'\u0528';
-        case U'\u052B': return U'\u052A';
-        case U'\u052D': return U'\u052C';
-        case U'\u052F': return U'\u052E';
-        case U'\u0561': return U'\u0531';
-        case U'\u0562': return U'\u0532';
-        case U'\u0563': return U'\u0533';
-        case U'\u0564': return U'\u0534';
-        case U'\u0565': return U'\u0535';
-        case U'\u0566': return U'\u0536';
-        case U'\u0567': return U'\u0537';
-        case U'\u0568': return U'\u0538';
-        case U'\u0569': return U'\u0539';
-        case U'\u056A': return U'\u053A';
-        case U'\u056B': return U'\u053B';
-        case U'\u056C': return U'\u053C';
-        case U'\u056D': return U'\u053D';
-        case U'\u056E': return U'\u053E';
-        case U'\u056F': return U'\u053F';
-        case U'\u0570': return U'\u0540';
-        case U'\u0571': return U'\u0541';
-        case U'\u0572': return U'\u0542';
-        case U'\u0573': return U'\u0543';
-        case U'\u0574': return U'\u0544';
-        case U'\u0575': return U'\u0545';
-        case U'\u0576': return U'\u0546';
-        case U'\u0577': return U'\u0547';
-        case U'\u0578': return U'\u0548';
-        case U'\u0579': return U'\u0549';
-        case U'\u057A': return U'\u054A';
-        case U'\u057B': return U'\u054B';
-        case U'\u057C': return U'\u054C';
-        case U'\u057D': return U'\u054D';
-        case U'\u057E': return U'\u054E';
-        case U'\u057F': return U'\u054F';
-        case U'\u0580': return U'\u0550';
-        case U'\u0581': return U'\u0551';
-        case U'\u0582': return U'\u0552';
-        case U'\u0583': return U'\u0553';
-        case U'\u0584': return U'\u0554';
-        case U'\u0585': return U'\u0555';
-        case U'\u0586': return U'\u0556';
-        case U'\u10D0': return U'\u1C90';
-        case U'\u10D1': return U'\u1C91';
-        case U'\u10D2': return U'\u1C92';
-        case U'\u10D3': return U'\u1C93';
-        case U'\u10D4': return U'\u1C94';
-        case U'\u10D5': return U'\u1C95';
-        case U'\u10D6': return U'\u1C96';
-        case U'\u10D7': return U'\u1C97';
-        case U'\u10D8': return U'\u1C98';
-        case U'\u10D9': return U'\u1C99';
-        case U'\u10DA': return U'\u1C9A';
-        case U'\u10DB': return U'\u1C9B';
-        case U'\u10DC': return U'\u1C9C';
-        case U'\u10DD': return U'\u1C9D';
-        case U'\u10DE': return U'\u1C9E';
-        case U'\u10DF': return U'\u1C9F';
-        case U'\u10E0': return U'\u1CA0';
-        case U'\u10E1': return U'\u1CA1';
-        case U'\u10E2': return U'\u1CA2';
-        case U'\u10E3': return U'\u1CA3';
-        case U'\u10E4': return U'\u1CA4';
-        case U'\u10E5': return U'\u1CA5';
-        case U'\u10E6': return U'\u1CA6';
-        case U'\u10E7': return U'\u1CA7';
-        case U'\u10E8': return U'\u1CA8';
-        case U'\u10E9': return U'\u1CA9';
-        case U'\u10EA': return U'\u1CAA';
-        case U'\u10EB': return U'\u1CAB';
-        case U'\u10EC': return U'\u1CAC';
-        case U'\u10ED': return U'\u1CAD';
-        case U'\u10EE': return U'\u1CAE';
-        case U'\u10EF': return U'\u1CAF';
-        case U'\u10F0': return U'\u1CB0';
-        case U'\u10F1': return U'\u1CB1';
-        case U'\u10F2': return U'\u1CB2';
-        case U'\u10F3': return U'\u1CB3';
-        case U'\u10F4': return U'\u1CB4';
-        case U'\u10F5': return U'\u1CB5';
-        case U'\u10F6': return U'\u1CB6';
-        case U'\u10F7': return U'\u1CB7';
-        case U'\u10F8': return U'\u1CB8';
-        case U'\u10F9': return U'\u1CB9';
-        case U'\u10FA': return U'\u1CBA';
-        case U'\u10FD': return U'\u1CBD';
-        case U'\u10FE': return U'\u1CBE';
-        case U'\u10FF': return U'\u1CBF';
-        case U'\u13F8': return U'\u13F0';
-        case U'\u13F9': return U'\u13F1';
-        case U'\u13FA': return U'\u13F2';
-        case U'\u13FB': return U'\u13F3';
-        case U'\u13FC': return U'\u13F4';
-        case U'\u13FD': return U'\u13F5';
-        case U'\u1C80': return U'\u0412';
-        case U'\u1C81': return U'\u0414';
-        case U'\u1C82': return U'\u041E';
-        case U'\u1C83': return U'\u0421';
-        case U'\u1C84': return U'\u0422';
-        case U'\u1C85': return U'\u0422';
-        case U'\u1C86': return U'\u042A';
-        case U'\u1C87': return U'\u0462';
-        case U'\u1C88': return U'\uA64A';
-        case U'\u1C8A': return U'\u1C89';
-        case U'\u1D79': return U'\uA77D';
-        case U'\u1D7D': return U'\u2C63';
-        case U'\u1D8E': return U'\uA7C6';
-        case U'\u1E01': return U'\u1E00';
-        case U'\u1E03': return U'\u1E02';
-        case U'\u1E05': return U'\u1E04';
-        case U'\u1E07': return U'\u1E06';
-        case U'\u1E09': return U'\u1E08';
-        case U'\u1E0B': return U'\u1E0A';
-        case U'\u1E0D': return U'\u1E0C';
-        case U'\u1E0F': return U'\u1E0E';
-        case U'\u1E11': return U'\u1E10';
-        case U'\u1E13': return U'\u1E12';
-        case U'\u1E15': return U'\u1E14';
-        case U'\u1E17': return U'\u1E16';
-        case U'\u1E19': return U'\u1E18';
-        case U'\u1E1B': return U'\u1E1A';
-        case U'\u1E1D': return U'\u1E1C';
-        case U'\u1E1F': return U'\u1E1E';
-        case U'\u1E21': return U'\u1E20';
-        case U'\u1E23': return U'\u1E22';
-        case U'\u1E25': return U'\u1E24';
-        case U'\u1E27': return U'\u1E26';
-        case U'\u1E29': return U'\u1E28';
-        case U'\u1E2B': return U'\u1E2A';
-        case U'\u1E2D': return U'\u1E2C';
-        case U'\u1E2F': return U'\u1E2E';
-        case U'\u1E31': return U'\u1E30';
-        case U'\u1E33': return U'\u1E32';
-        case U'\u1E35': return U'\u1E34';
-        case U'\u1E37': return U'\u1E36';
-        case U'\u1E39': return U'\u1E38';
-        case U'\u1E3B': return U'\u1E3A';
-        case U'\u1E3D': return U'\u1E3C';
-        case U'\u1E3F': return U'\u1E3E';
-        case U'\u1E41': return U'\u1E40';
-        case U'\u1E43': return U'\u1E42';
-        case U'\u1E45': return U'\u1E44';
-        case U'\u1E47': return U'\u1E46';
-        case U'\u1E49': return U'\u1E48';
-        case U'\u1E4B': return U'\u1E4A';
-        case U'\u1E4D': return U'\u1E4C';
-        case U'\u1E4F': return U'\u1E4E';
-        case U'\u1E51': return U'\u1E50';
-        case U'\u1E53': return U'\u1E52';
-        case U'\u1E55': return U'\u1E54';
-        case U'\u1E57': return U'\u1E56';
-        case U'\u1E59': return U'\u1E58';
-        case U'\u1E5B': return U'\u1E5A';
-        case U'\u1E5D': return U'\u1E5C';
-        case U'\u1E5F': return U'\u1E5E';
-        case U'\u1E61': return U'\u1E60';
-        case U'\u1E63': return U'\u1E62';
-        case U'\u1E65': return U'\u1E64';
-        case U'\u1E67': return U'\u1E66';
-        case U'\u1E69': return U'\u1E68';
-        case U'\u1E6B': return U'\u1E6A';
-        case U'\u1E6D': return U'\u1E6C';
-        case U'\u1E6F': return U'\u1E6E';
-        case U'\u1E71': return U'\u1E70';
-        case U'\u1E73': return U'\u1E72';
-        case U'\u1E75': return U'\u1E74';
-        case U'\u1E77': return U'\u1E76';
-        case U'\u1E79': return U'\u1E78';
-        case U'\u1E7B': return U'\u1E7A';
-        case U'\u1E7D': return U'\u1E7C';
-        case U'\u1E7F': return U'\u1E7E';
-        case U'\u1E81': return U'\u1E80';
-        case U'\u1E83': return U'\u1E82';
-        case U'\u1E85': return U'\u1E84';
-        case U'\u1E87': return U'\u1E86';
-        case U'\u1E89': return U'\u1E88';
-        case U'\u1E8B': return U'\u1E8A';
-        case U'\u1E8D': return U'\u1E8C';
-        case U'\u1E8F': return U'\u1E8E';
-        case U'\u1E91': return U'\u1E90';
-        case U'\u1E93': return U'\u1E92';
-        case U'\u1E95': return U'\u1E94';
-        case U'\u1E9B': return U'\u1E60';
-        case U'\u1EA1': return U'\u1EA0';
-        case U'\u1EA3': return U'\u1EA2';
-        case U'\u1EA5': return U'\u1EA4';
-        case U'\u1EA7': return U'\u1EA6';
-        case U'\u1EA9': return U'\u1EA8';
-        case U'\u1EAB': return U'\u1EAA';
-        case U'\u1EAD': return U'\u1EAC';
-        case U'\u1EAF': return U'\u1EAE';
-        case U'\u1EB1': return U'\u1EB0';
-        case U'\u1EB3': return U'\u1EB2';
-        case U'\u1EB5': return U'\u1EB4';
-        case U'\u1EB7': return U'\u1EB6';
-        case U'\u1EB9': return U'\u1EB8';
-        case U'\u1EBB': return U'\u1EBA';
-        case U'\u1EBD': return U'\u1EBC';
-        case U'\u1EBF': return U'\u1EBE';
-        case U'\u1EC1': return U'\u1EC0';
-        case U'\u1EC3': return U'\u1EC2';
-        case U'\u1EC5': return U'\u1EC4';
-        case U'\u1EC7': return U'\u1EC6';
-        case U'\u1EC9': return U'\u1EC8';
-        case U'\u1ECB': return U'\u1ECA';
-        case U'\u1ECD': return U'\u1ECC';
-        case U'\u1ECF': return U'\u1ECE';
-        case U'\u1ED1': return U'\u1ED0';
-        case U'\u1ED3': return U'\u1ED2';
-        case U'\u1ED5': return U'\u1ED4';
-        case U'\u1ED7': return U'\u1ED6';
-        case U'\u1ED9': return U'\u1ED8';
-        case U'\u1EDB': return U'\u1EDA';
-        case U'\u1EDD': return U'\u1EDC';
-        case U'\u1EDF': return U'\u1EDE';
-        case U'\u1EE1': return U'\u1EE0';
-        case U'\u1EE3': return U'\u1EE2';
-        case U'\u1EE5': return U'\u1EE4';
-        case U'\u1EE7': return U'\u1EE6';
-        case U'\u1EE9': return U'\u1EE8';
-        case U'\u1EEB': return U'\u1EEA';
-        case U'\u1EED': return U'\u1EEC';
-        case U'\u1EEF': return U'\u1EEE';
-        case U'\u1EF1': return U'\u1EF0';
-        case U'\u1EF3': return U'\u1EF2';
-        case U'\u1EF5': return U'\u1EF4';
-        case U'\u1EF7': return U'\u1EF6';
-        case U'\u1EF9': return U'\u1EF8';
-        case U'\u1EFB': return U'\u1EFA';
-        case U'\u1EFD': return U'\u1EFC';
-        case U'\u1EFF': return U'\u1EFE';
-        case U'\u1F00': return U'\u1F08';
-        case U'\u1F01': return U'\u1F09';
-        case U'\u1F02': return U'\u1F0A';
-        case U'\u1F03': return U'\u1F0B';
-        case U'\u1F04': return U'\u1F0C';
-        case U'\u1F05': return U'\u1F0D';
-        case U'\u1F06': return U'\u1F0E';
-        case U'\u1F07': return U'\u1F0F';
-        case U'\u1F10': return U'\u1F18';
-        case U'\u1F11': return U'\u1F19';
-        case U'\u1F12': return U'\u1F1A';
-        case U'\u1F13': return U'\u1F1B';
-        case U'\u1F14': return U'\u1F1C';
-        case U'\u1F15': return U'\u1F1D';
-        case U'\u1F20': return U'\u1F28';
-        case U'\u1F21': return U'\u1F29';
-        case U'\u1F22': return U'\u1F2A';
-        case U'\u1F23': return U'\u1F2B';
-        case U'\u1F24': return U'\u1F2C';
-        case U'\u1F25': return U'\u1F2D';
-        case U'\u1F26': return U'\u1F2E';
-        case U'\u1F27': return U'\u1F2F';
-        case U'\u1F30': return U'\u1F38';
-        case U'\u1F31': return U'\u1F39';
-        case U'\u1F32': return U'\u1F3A';
-        case U'\u1F33': return U'\u1F3B';
-        case U'\u1F34': return U'\u1F3C';
-        case U'\u1F35': return U'\u1F3D';
-        case U'\u1F36': return U'\u1F3E';
-        case U'\u1F37': return U'\u1F3F';
-        case U'\u1F40': return U'\u1F48';
-        case U'\u1F41': return U'\u1F49';
-        case U'\u1F42': return U'\u1F4A';
-        case U'\u1F43': return U'\u1F4B';
-        case U'\u1F44': return U'\u1F4C';
-        case U'\u1F45': return U'\u1F4D';
-        case U'\u1F51': return U'\u1F59';
-        case U'\u1F53': return U'\u1F5B';
-        case U'\u1F55': return U'\u1F5D';
-        case U'\u1F57': return U'\u1F5F';
-        case U'\u1F60': return U'\u1F68';
-        case U'\u1F61': return U'\u1F69';
-        case U'\u1F62': return U'\u1F6A';
-        case U'\u1F63': return U'\u1F6B';
-        case U'\u1F64': return U'\u1F6C';
-        case U'\u1F65': return U'\u1F6D';
-        case U'\u1F66': return U'\u1F6E';
-        case U'\u1F67': return U'\u1F6F';
-        case U'\u1F70': return U'\u1FBA';
-        case U'\u1F71': return U'\u1FBB';
-        case U'\u1F72': return U'\u1FC8';
-        case U'\u1F73': return U'\u1FC9';
-        case U'\u1F74': return U'\u1FCA';
-        case U'\u1F75': return U'\u1FCB';
-        case U'\u1F76': return U'\u1FDA';
-        case U'\u1F77': return U'\u1FDB';
-        case U'\u1F78': return U'\u1FF8';
-        case U'\u1F79': return U'\u1FF9';
-        case U'\u1F7A': return U'\u1FEA';
-        case U'\u1F7B': return U'\u1FEB';
-        case U'\u1F7C': return U'\u1FFA';
-        case U'\u1F7D': return U'\u1FFB';
-        case U'\u1F80': return U'\u1F88';
-        case U'\u1F81': return U'\u1F89';
-        case U'\u1F82': return U'\u1F8A';
-        case U'\u1F83': return U'\u1F8B';
-        case U'\u1F84': return U'\u1F8C';
-        case U'\u1F85': return U'\u1F8D';
-        case U'\u1F86': return U'\u1F8E';
-        case U'\u1F87': return U'\u1F8F';
-        case U'\u1F90': return U'\u1F98';
-        case U'\u1F91': return U'\u1F99';
-        case U'\u1F92': return U'\u1F9A';
-        case U'\u1F93': return U'\u1F9B';
-        case U'\u1F94': return U'\u1F9C';
-        case U'\u1F95': return U'\u1F9D';
-        case U'\u1F96': return U'\u1F9E';
-        case U'\u1F97': return U'\u1F9F';
-        case U'\u1FA0': return U'\u1FA8';
-        case U'\u1FA1': return U'\u1FA9';
-        case U'\u1FA2': return U'\u1FAA';
-        case U'\u1FA3': return U'\u1FAB';
-        case U'\u1FA4': return U'\u1FAC';
-        case U'\u1FA5': return U'\u1FAD';
-        case U'\u1FA6': return U'\u1FAE';
-        case U'\u1FA7': return U'\u1FAF';
-        case U'\u1FB0': return U'\u1FB8';
-        case U'\u1FB1': return U'\u1FB9';
-        case U'\u1FB3': return U'\u1FBC';
-        case U'\u1FBE': return U'\u0399';
-        case U'\u1FC3': return U'\u1FCC';
-        case U'\u1FD0': return U'\u1FD8';
-        case U'\u1FD1': return U'\u1FD9';
-        case U'\u1FE0': return U'\u1FE8';
-        case U'\u1FE1': return U'\u1FE9';
-        case U'\u1FE5': return U'\u1FEC';
-        case U'\u1FF3': return U'\u1FFC';
-        case U'\u214E': return U'\u2132';
-        case U'\u2170': return U'\u2160';
-        case U'\u2171': return U'\u2161';
-        case U'\u2172': return U'\u2162';
-        case U'\u2173': return U'\u2163';
-        case U'\u2174': return U'\u2164';
-        case U'\u2175': return U'\u2165';
-        case U'\u2176': return U'\u2166';
-        case U'\u2177': return U'\u2167';
-        case U'\u2178': return U'\u2168';
-        case U'\u2179': return U'\u2169';
-        case U'\u217A': return U'\u216A';
-        case U'\u217B': return U'\u216B';
-        case U'\u217C': return U'\u216C';
-        case U'\u217D': return U'\u216D';
-        case U'\u217E': return U'\u216E';
-        case U'\u217F': return U'\u216F';
-        case U'\u2184': return U'\u2183';
-        case U'\u24D0': return U'\u24B6';
-        case U'\u24D1': return U'\u24B7';
-        case U'\u24D2': return U'\u24B8';
-        case U'\u24D3': return U'\u24B9';
-        case U'\u24D4': return U'\u24BA';
-        case U'\u24D5': return U'\u24BB';
-        case U'\u24D6': return U'\u24BC';
-        case U'\u24D7': return U'\u24BD';
-        case U'\u24D8': return U'\u24BE';
-        case U'\u24D9': return U'\u24BF';
-        case U'\u24DA': return U'\u24C0';
-        case U'\u24DB': return U'\u24C1';
-        case U'\u24DC': return U'\u24C2';
-        case U'\u24DD': return U'\u24C3';
-        case U'\u24DE': return U'\u24C4';
-        case U'\u24DF': return U'\u24C5';
-        case U'\u24E0': return U'\u24C6';
-        case U'\u24E1': return U'\u24C7';
-        case U'\u24E2': return U'\u24C8';
-        case U'\u24E3': return U'\u24C9';
-        case U'\u24E4': return U'\u24CA';
-        case U'\u24E5': return U'\u24CB';
-        case U'\u24E6': return U'\u24CC';
-        case U'\u24E7': return U'\u24CD';
-        case U'\u24E8': return U'\u24CE';
-        case U'\u24E9': return U'\u24CF';
-        case U'\u2C30': return U'\u2C00';
-        case U'\u2C31': return U'\u2C01';
-        case U'\u2C32': return U'\u2C02';
-        case U'\u2C33': return U'\u2C03';
-        case U'\u2C34': return U'\u2C04';
-        case U'\u2C35': return U'\u2C05';
-        case U'\u2C36': return U'\u2C06';
-        case U'\u2C37': return U'\u2C07';
-        case U'\u2C38': return U'\u2C08';
-        case U'\u2C39': return U'\u2C09';
-        case U'\u2C3A': return U'\u2C0A';
-        case U'\u2C3B': return U'\u2C0B';
-        case U'\u2C3C': return U'\u2C0C';
-        case U'\u2C3D': return U'\u2C0D';
-        case U'\u2C3E': return U'\u2C0E';
-        case U'\u2C3F': return U'\u2C0F';
-        case U'\u2C40': return U'\u2C10';
-        case U'\u2C41': return U'\u2C11';
-        case U'\u2C42': return U'\u2C12';
-        case U'\u2C43': return U'\u2C13';
-        case U'\u2C44': return U'\u2C14';
-        case U'\u2C45': return U'\u2C15';
-        case U'\u2C46': return U'\u2C16';
-        case U'\u2C47': return U'\u2C17';
-        case U'\u2C48': return U'\u2C18';
-        case U'\u2C49': return U'\u2C19';
-        case U'\u2C4A': return U'\u2C1A';
-        case U'\u2C4B': return U'\u2C1B';
-        case U'\u2C4C': return U'\u2C1C';
-        case U'\u2C4D': return U'\u2C1D';
-        case U'\u2C4E': return U'\u2C1E';
-        case U'\u2C4F': return U'\u2C1F';
-        case U'\u2C50': return U'\u2C20';
-        case U'\u2C51': return U'\u2C21';
-        case U'\u2C52': return U'\u2C22';
-        case U'\u2C53': return U'\u2C23';
-        case U'\u2C54': return U'\u2C24';
-        case U'\u2C55': return U'\u2C25';
-        case U'\u2C56': return U'\u2C26';
-        case U'\u2C57': return U'\u2C27';
-        case U'\u2C58': return U'\u2C28';
-        case U'\u2C59': return U'\u2C29';
-        case U'\u2C5A': return U'\u2C2A';
-        case U'\u2C5B': return U'\u2C2B';
-        case U'\u2C5C': return U'\u2C2C';
-        case U'\u2C5D': return U'\u2C2D';
-        case U'\u2C5E': return U'\u2C2E';
-        case U'\u2C5F': return U'\u2C2F';
-        case U'\u2C61': return U'\u2C60';
-        case U'\u2C65': return U'\u023A';
-        case U'\u2C66': return U'\u023E';
-        case U'\u2C68': return U'\u2C67';
-        case U'\u2C6A': return U'\u2C69';
-        case U'\u2C6C': return U'\u2C6B';
-        case U'\u2C73': return U'\u2C72';
-        case U'\u2C76': return U'\u2C75';
-        case U'\u2C81': return U'\u2C80';
-        case U'\u2C83': return U'\u2C82';
-        case U'\u2C85': return U'\u2C84';
-        case U'\u2C87': return U'\u2C86';
-        case U'\u2C89': return U'\u2C88';
-        case U'\u2C8B': return U'\u2C8A';
-        case U'\u2C8D': return U'\u2C8C';
-        case U'\u2C8F': return U'\u2C8E';
-        case U'\u2C91': return U'\u2C90';
-        case U'\u2C93': return U'\u2C92';
-        case U'\u2C95': return U'\u2C94';
-        case U'\u2C97': return U'\u2C96';
-        case U'\u2C99': return U'\u2C98';
-        case U'\u2C9B': return U'\u2C9A';
-        case U'\u2C9D': return U'\u2C9C';
-        case U'\u2C9F': return U'\u2C9E';
-        case U'\u2CA1': return U'\u2CA0';
-        case U'\u2CA3': return U'\u2CA2';
-        case U'\u2CA5': return U'\u2CA4';
-        case U'\u2CA7': return U'\u2CA6';
-        case U'\u2CA9': return U'\u2CA8';
-        case U'\u2CAB': return U'\u2CAA';
-        case U'\u2CAD': return U'\u2CAC';
-        case U'\u2CAF': return U'\u2CAE';
-        case U'\u2CB1': return U'\u2CB0';
-        case U'\u2CB3': return U'\u2CB2';
-        case U'\u2CB5': return U'\u2CB4';
-        case U'\u2CB7': return U'\u2CB6';
-        case U'\u2CB9': return U'\u2CB8';
-        case U'\u2CBB': return U'\u2CBA';
-        case U'\u2CBD': return U'\u2CBC';
-        case U'\u2CBF': return U'\u2CBE';
-        case U'\u2CC1': return U'\u2CC0';
-        case U'\u2CC3': return U'\u2CC2';
-        case U'\u2CC5': return U'\u2CC4';
-        case U'\u2CC7': return U'\u2CC6';
-        case U'\u2CC9': return U'\u2CC8';
-        case U'\u2CCB': return U'\u2CCA';
-        case U'\u2CCD': return U'\u2CCC';
-        case U'\u2CCF': return U'\u2CCE';
-        case U'\u2CD1': return U'\u2CD0';
-        case U'\u2CD3': return U'\u2CD2';
-        case U'\u2CD5': return U'\u2CD4';
-        case U'\u2CD7': return U'\u2CD6';
-        case U'\u2CD9': return U'\u2CD8';
-        case U'\u2CDB': return U'\u2CDA';
-        case U'\u2CDD': return U'\u2CDC';
-        case U'\u2CDF': return U'\u2CDE';
-        case U'\u2CE1': return U'\u2CE0';
-        case U'\u2CE3': return U'\u2CE2';
-        case U'\u2CEC': return U'\u2CEB';
-        case U'\u2CEE': return U'\u2CED';
-        case U'\u2CF3': return U'\u2CF2';
-        case U'\u2D00': return U'\u10A0';
-        case U'\u2D01': return U'\u10A1';
-        case U'\u2D02': return U'\u10A2';
-        case U'\u2D03': return U'\u10A3';
-        case U'\u2D04': return U'\u10A4';
-        case U'\u2D05': return U'\u10A5';
-        case U'\u2D06': return U'\u10A6';
-        case U'\u2D07': return U'\u10A7';
-        case U'\u2D08': return U'\u10A8';
-        case U'\u2D09': return U'\u10A9';
-        case U'\u2D0A': return U'\u10AA';
-        case U'\u2D0B': return U'\u10AB';
-        case U'\u2D0C': return U'\u10AC';
-        case U'\u2D0D': return U'\u10AD';
-        case U'\u2D0E': return U'\u10AE';
-        case U'\u2D0F': return U'\u10AF';
-        case U'\u2D10': return U'\u10B0';
-        case U'\u2D11': return U'\u10B1';
-        case U'\u2D12': return U'\u10B2';
-        case U'\u2D13': return U'\u10B3';
-        case U'\u2D14': return U'\u10B4';
-        case U'\u2D15': return U'\u10B5';
-        case U'\u2D16': return U'\u10B6';
-        case U'\u2D17': return U'\u10B7';
-        case U'\u2D18': return U'\u10B8';
-        case U'\u2D19': return U'\u10B9';
-        case U'\u2D1A': return U'\u10BA';
-        case U'\u2D1B': return U'\u10BB';
-        case U'\u2D1C': return U'\u10BC';
-        case U'\u2D1D': return U'\u10BD';
-        case U'\u2D1E': return U'\u10BE';
-        case U'\u2D1F': return U'\u10BF';
-        case U'\u2D20': return U'\u10C0';
-        case U'\u2D21': return U'\u10C1';
-        case U'\u2D22': return U'\u10C2';
-        case U'\u2D23': return U'\u10C3';
-        case U'\u2D24': return U'\u10C4';
-        case U'\u2D25': return U'\u10C5';
-        case U'\u2D27': return U'\u10C7';
-        case U'\u2D2D': return U'\u10CD';
-        case U'\uA641': return U'\uA640';
-        case U'\uA643': return U'\uA642';
-        case U'\uA645': return U'\uA644';
-        case U'\uA647': return U'\uA646';
-        case U'\uA649': return U'\uA648';
-        case U'\uA64B': return U'\uA64A';
-        case U'\uA64D': return U'\uA64C';
-        case U'\uA64F': return U'\uA64E';
-        case U'\uA651': return U'\uA650';
-        case U'\uA653': return U'\uA652';
-        case U'\uA655': return U'\uA654';
-        case U'\uA657': return U'\uA656';
-        case U'\uA659': return U'\uA658';
-        case U'\uA65B': return U'\uA65A';
-        case U'\uA65D': return U'\uA65C';
-        case U'\uA65F': return U'\uA65E';
-        case U'\uA661': return U'\uA660';
-        case U'\uA663': return U'\uA662';
-        case U'\uA665': return U'\uA664';
-        case U'\uA667': return U'\uA666';
-        case U'\uA669': return U'\uA668';
-        case U'\uA66B': return U'\uA66A';
-        case U'\uA66D': return U'\uA66C';
-        case U'\uA681': return U'\uA680';
-        case U'\uA683': return U'\uA682';
-        case U'\uA685': return U'\uA684';
-        case U'\uA687': return U'\uA686';
-        case U'\uA689': return U'\uA688';
-        case U'\uA68B': return U'\uA68A';
-        case U'\uA68D': return U'\uA68C';
-        case U'\uA68F': return U'\uA68E';
-        case U'\uA691': return U'\uA690';
-        case U'\uA693': return U'\uA692';
-        case U'\uA695': return U'\uA694';
-        case U'\uA697': return U'\uA696';
-        case U'\uA699': return U'\uA698';
-        case U'\uA69B': return U'\uA69A';
-        case U'\uA723': return U'\uA722';
-        case U'\uA725': return U'\uA724';
-        case U'\uA727': return U'\uA726';
-        case U'\uA729': return U'\uA728';
-        case U'\uA72B': return U'\uA72A';
-        case U'\uA72D': return U'\uA72C';
-        case U'\uA72F': return U'\uA72E';
-        case U'\uA733': return U'\uA732';
-        case U'\uA735': return U'\uA734';
-        case U'\uA737': return U'\uA736';
-        case U'\uA739': return U'\uA738';
-        case U'\uA73B': return U'\uA73A';
-        case U'\uA73D': return U'\uA73C';
-        case U'\uA73F': return U'\uA73E';
-        case U'\uA741': return U'\uA740';
-        case U'\uA743': return U'\uA742';
-        case U'\uA745': return U'\uA744';
-        case U'\uA747': return U'\uA746';
-        case U'\uA749': return U'\uA748';
-        case U'\uA74B': return U'\uA74A';
-        case U'\uA74D': return U'\uA74C';
-        case U'\uA74F': return U'\uA74E';
-        case U'\uA751': return U'\uA750';
-        case U'\uA753': return U'\uA752';
-        case U'\uA755': return U'\uA754';
-        case U'\uA757': return U'\uA756';
-        case U'\uA759': return U'\uA758';
-        case U'\uA75B': return U'\uA75A';
-        case U'\uA75D': return U'\uA75C';
-        case U'\uA75F': return U'\uA75E';
-        case U'\uA761': return U'\uA760';
-        case U'\uA763': return U'\uA762';
-        case U'\uA765': return U'\uA764';
-        case U'\uA767': return U'\uA766';
-        case U'\uA769': return U'\uA768';
-        case U'\uA76B': return U'\uA76A';
-        case U'\uA76D': return U'\uA76C';
-        case U'\uA76F': return U'\uA76E';
-        case U'\uA77A': return U'\uA779';
-        case U'\uA77C': return U'\uA77B';
-        case U'\uA77F': return U'\uA77E';
-        case U'\uA781': return U'\uA780';
-        case U'\uA783': return U'\uA782';
-        case U'\uA785': return U'\uA784';
-        case U'\uA787': return U'\uA786';
-        case U'\uA78C': return U'\uA78B';
-        case U'\uA791': return U'\uA790';
-        case U'\uA793': return U'\uA792';
-        case U'\uA794': return U'\uA7C4';
-        case U'\uA797': return U'\uA796';
-        case U'\uA799': return U'\uA798';
-        case U'\uA79B': return U'\uA79A';
-        case U'\uA79D': return U'\uA79C';
-        case U'\uA79F': return U'\uA79E';
-        case U'\uA7A1': return U'\uA7A0';
-        case U'\uA7A3': return U'\uA7A2';
-        case U'\uA7A5': return U'\uA7A4';
-        case U'\uA7A7': return U'\uA7A6';
-        case U'\uA7A9': return U'\uA7A8';
-        case U'\uA7B5': return U'\uA7B4';
-        case U'\uA7B7': return U'\uA7B6';
-        case U'\uA7B9': return U'\uA7B8';
-        case U'\uA7BB': return U'\uA7BA';
-        case U'\uA7BD': return U'\uA7BC';
-        case U'\uA7BF': return U'\uA7BE';
-        case U'\uA7C1': return U'\uA7C0';
-        case U'\uA7C3': return U'\uA7C2';
-        case U'\uA7C8': return U'\uA7C7';
-        case U'\uA7CA': return U'\uA7C9';
-        case U'\uA7CD': return U'\uA7CC';
-        case U'\uA7CF': return U'\uA7CE';
-        case U'\uA7D1': return U'\uA7D0';
-        case U'\uA7D3': return U'\uA7D2';
-        case U'\uA7D5': return U'\uA7D4';
-        case U'\uA7D7': return U'\uA7D6';
-        case U'\uA7D9': return U'\uA7D8';
-        case U'\uA7DB': return U'\uA7DA';
-        case U'\uA7F6': return U'\uA7F5';
-        case U'\uAB53': return U'\uA7B3';
-        case U'\uAB70': return U'\u13A0';
-        case U'\uAB71': return U'\u13A1';
-        case U'\uAB72': return U'\u13A2';
-        case U'\uAB73': return U'\u13A3';
-        case U'\uAB74': return U'\u13A4';
-        case U'\uAB75': return U'\u13A5';
-        case U'\uAB76': return U'\u13A6';
-        case U'\uAB77': return U'\u13A7';
-        case U'\uAB78': return U'\u13A8';
-        case U'\uAB79': return U'\u13A9';
-        case U'\uAB7A': return U'\u13AA';
-        case U'\uAB7B': return U'\u13AB';
-        case U'\uAB7C': return U'\u13AC';
-        case U'\uAB7D': return U'\u13AD';
-        case U'\uAB7E': return U'\u13AE';
-        case U'\uAB7F': return U'\u13AF';
-        case U'\uAB80': return U'\u13B0';
-        case U'\uAB81': return U'\u13B1';
-        case U'\uAB82': return U'\u13B2';
-        case U'\uAB83': return U'\u13B3';
-        case U'\uAB84': return U'\u13B4';
-        case U'\uAB85': return U'\u13B5';
-        case U'\uAB86': return U'\u13B6';
-        case U'\uAB87': return U'\u13B7';
-        case U'\uAB88': return U'\u13B8';
-        case U'\uAB89': return U'\u13B9';
-        case U'\uAB8A': return U'\u13BA';
-        case U'\uAB8B': return U'\u13BB';
-        case U'\uAB8C': return U'\u13BC';
-        case U'\uAB8D': return U'\u13BD';
-        case U'\uAB8E': return U'\u13BE';
-        case U'\uAB8F': return U'\u13BF';
-        case U'\uAB90': return U'\u13C0';
-        case U'\uAB91': return U'\u13C1';
-        case U'\uAB92': return U'\u13C2';
-        case U'\uAB93': return U'\u13C3';
-        case U'\uAB94': return U'\u13C4';
-        case U'\uAB95': return U'\u13C5';
-        case U'\uAB96': return U'\u13C6';
-        case U'\uAB97': return U'\u13C7';
-        case U'\uAB98': return U'\u13C8';
-        case U'\uAB99': return U'\u13C9';
-        case U'\uAB9A': return U'\u13CA';
-        case U'\uAB9B': return U'\u13CB';
-        case U'\uAB9C': return U'\u13CC';
-        case U'\uAB9D': return U'\u13CD';
-        case U'\uAB9E': return U'\u13CE';
-        case U'\uAB9F': return U'\u13CF';
-        case U'\uABA0': return U'\u13D0';
-        case U'\uABA1': return U'\u13D1';
-        case U'\uABA2': return U'\u13D2';
-        case U'\uABA3': return U'\u13D3';
-        case U'\uABA4': return U'\u13D4';
-        case U'\uABA5': return U'\u13D5';
-        case U'\uABA6': return U'\u13D6';
-        case U'\uABA7': return U'\u13D7';
-        case U'\uABA8': return U'\u13D8';
-        case U'\uABA9': return U'\u13D9';
-        case U'\uABAA': return U'\u13DA';
-        case U'\uABAB': return U'\u13DB';
-        case U'\uABAC': return U'\u13DC';
-        case U'\uABAD': return U'\u13DD';
-        case U'\uABAE': return U'\u13DE';
-        case U'\uABAF': return U'\u13DF';
-        case U'\uABB0': return U'\u13E0';
-        case U'\uABB1': return U'\u13E1';
-        case U'\uABB2': return U'\u13E2';
-        case U'\uABB3': return U'\u13E3';
-        case U'\uABB4': return U'\u13E4';
-        case U'\uABB5': return U'\u13E5';
-        case U'\uABB6': return U'\u13E6';
-        case U'\uABB7': return U'\u13E7';
-        case U'\uABB8': return U'\u13E8';
-        case U'\uABB9': return U'\u13E9';
-        case U'\uABBA': return U'\u13EA';
-        case U'\uABBB': return U'\u13EB';
-        case U'\uABBC': return U'\u13EC';
-        case U'\uABBD': return U'\u13ED';
-        case U'\uABBE': return U'\u13EE';
-        case U'\uABBF': return U'\u13EF';
-        case U'\uFF41': return U'\uFF21';
-        case U'\uFF42': return U'\uFF22';
-        case U'\uFF43': return U'\uFF23';
-        case U'\uFF44': return U'\uFF24';
-        case U'\uFF45': return U'\uFF25';
-        case U'\uFF46': return U'\uFF26';
-        case U'\uFF47': return U'\uFF27';
-        case U'\uFF48': return U'\uFF28';
-        case U'\uFF49': return U'\uFF29';
-        case U'\uFF4A': return U'\uFF2A';
-        case U'\uFF4B': return U'\uFF2B';
-        case U'\uFF4C': return U'\uFF2C';
-        case U'\uFF4D': return U'\uFF2D';
-        case U'\uFF4E': return U'\uFF2E';
-        case U'\uFF4F': return U'\uFF2F';
-        case U'\uFF50': return U'\uFF30';
-        case U'\uFF51': return U'\uFF31';
-        case U'\uFF52': return U'\uFF32';
-        case U'\uFF53': return U'\uFF33';
-        case U'\uFF54': return U'\uFF34';
-        case U'\uFF55': return U'\uFF35';
-        case U'\uFF56': return U'\uFF36';
-        case U'\uFF57': return U'\uFF37';
-        case U'\uFF58': return U'\uFF38';
-        case U'\uFF59': return U'\uFF39';
-        case U'\uFF5A': return U'\uFF3A';
-        case U'\U00010428': return U'\U00010400';
-        case U'\U00010429': return U'\U00010401';
-        case U'\U0001042A': return U'\U00010402';
-        case U'\U0001042B': return U'\U00010403';
-        case U'\U0001042C': return U'\U00010404';
-        case U'\U0001042D': return U'\U00010405';
-        case U'\U0001042E': return U'\U00010406';
-        case U'\U0001042F': return U'\U00010407';
-        case U'\U00010430': return U'\U00010408';
-        case U'\U00010431': return U'\U00010409';
-        case U'\U00010432': return U'\U0001040A';
-        case U'\U00010433': return U'\U0001040B';
-        case U'\U00010434': return U'\U0001040C';
-        case U'\U00010435': return U'\U0001040D';
-        case U'\U00010436': return U'\U0001040E';
-        case U'\U00010437': return U'\U0001040F';
-        case U'\U00010438': return U'\U00010410';
-        case U'\U00010439': return U'\U00010411';
-        case U'\U0001043A': return U'\U00010412';
-        case U'\U0001043B': return U'\U00010413';
-        case U'\U0001043C': return U'\U00010414';
-        case U'\U0001043D': return U'\U00010415';
-        case U'\U0001043E': return U'\U00010416';
-        case U'\U0001043F': return U'\U00010417';
-        case U'\U00010440': return U'\U00010418';
-        case U'\U00010441': return U'\U00010419';
-        case U'\U00010442': return U'\U0001041A';
-        case U'\U00010443': return U'\U0001041B';
-        case U'\U00010444': return U'\U0001041C';
-        case U'\U00010445': return U'\U0001041D';
-        case U'\U00010446': return U'\U0001041E';
-        case U'\U00010447': return U'\U0001041F';
-        case U'\U00010448': return U'\U00010420';
-        case U'\U00010449': return U'\U00010421';
-        case U'\U0001044A': return U'\U00010422';
-        case U'\U0001044B': return U'\U00010423';
-        case U'\U0001044C': return U'\U00010424';
-        case U'\U0001044D': return U'\U00010425';
-        case U'\U0001044E': return U'\U00010426';
-        case U'\U0001044F': return U'\U00010427';
-        case U'\U000104D8': return U'\U000104B0';
-        case U'\U000104D9': return U'\U000104B1';
-        case U'\U000104DA': return U'\U000104B2';
-        case U'\U000104DB': return U'\U000104B3';
-        case U'\U000104DC': return U'\U000104B4';
-        case U'\U000104DD': return U'\U000104B5';
-        case U'\U000104DE': return U'\U000104B6';
-        case U'\U000104DF': return U'\U000104B7';
-        case U'\U000104E0': return U'\U000104B8';
-        case U'\U000104E1': return U'\U000104B9';
-        case U'\U000104E2': return U'\U000104BA';
-        case U'\U000104E3': return U'\U000104BB';
-        case U'\U000104E4': return U'\U000104BC';
-        case U'\U000104E5': return U'\U000104BD';
-        case U'\U000104E6': return U'\U000104BE';
-        case U'\U000104E7': return U'\U000104BF';
-        case U'\U000104E8': return U'\U000104C0';
-        case U'\U000104E9': return U'\U000104C1';
-        case U'\U000104EA': return U'\U000104C2';
-        case U'\U000104EB': return U'\U000104C3';
-        case U'\U000104EC': return U'\U000104C4';
-        case U'\U000104ED': return U'\U000104C5';
-        case U'\U000104EE': return U'\U000104C6';
-        case U'\U000104EF': return U'\U000104C7';
-        case U'\U000104F0': return U'\U000104C8';
-        case U'\U000104F1': return U'\U000104C9';
-        case U'\U000104F2': return U'\U000104CA';
-        case U'\U000104F3': return U'\U000104CB';
-        case U'\U000104F4': return U'\U000104CC';
-        case U'\U000104F5': return U'\U000104CD';
-        case U'\U000104F6': return U'\U000104CE';
-        case U'\U000104F7': return U'\U000104CF';
-        case U'\U000104F8': return U'\U000104D0';
-        case U'\U000104F9': return U'\U000104D1';
-        case U'\U000104FA': return U'\U000104D2';
-        case U'\U000104FB': return U'\U000104D3';
-        case U'\U00010597': return U'\U00010570';
-        case U'\U00010598': return U'\U00010571';
-        case U'\U00010599': return U'\U00010572';
-        case U'\U0001059A': return U'\U00010573';
-        case U'\U0001059B': return U'\U00010574';
-        case U'\U0001059C': return U'\U00010575';
-        case U'\U0001059D': return U'\U00010576';
-        case U'\U0001059E': return U'\U00010577';
-        case U'\U0001059F': return U'\U00010578';
-        case U'\U000105A0': return U'\U00010579';
-        case U'\U000105A1': return U'\U0001057A';
-        case U'\U000105A3': return U'\U0001057C';
-        case U'\U000105A4': return U'\U0001057D';
-        case U'\U000105A5': return U'\U0001057E';
-        case U'\U000105A6': return U'\U0001057F';
-        case U'\U000105A7': return U'\U00010580';
-        case U'\U000105A8': return U'\U00010581';
-        case U'\U000105A9': return U'\U00010582';
-        case U'\U000105AA': return U'\U00010583';
-        case U'\U000105AB': return U'\U00010584';
-        case U'\U000105AC': return U'\U00010585';
-        case U'\U000105AD': return U'\U00010586';
-        case U'\U000105AE': return U'\U00010587';
-        case U'\U000105AF': return U'\U00010588';
-        case U'\U000105B0': return U'\U00010589';
-        case U'\U000105B1': return U'\U0001058A';
-        case U'\U000105B3': return U'\U0001058C';
-        case U'\U000105B4': return U'\U0001058D';
-        case U'\U000105B5': return U'\U0001058E';
-        case U'\U000105B6': return U'\U0001058F';
-        case U'\U000105B7': return U'\U00010590';
-        case U'\U000105B8': return U'\U00010591';
-        case U'\U000105B9': return U'\U00010592';
-        case U'\U000105BB': return U'\U00010594';
-        case U'\U000105BC': return U'\U00010595';
-        case U'\U00010CC0': return U'\U00010C80';
-        case U'\U00010CC1': return U'\U00010C81';
-        case U'\U00010CC2': return U'\U00010C82';
-        case U'\U00010CC3': return U'\U00010C83';
-        case U'\U00010CC4': return U'\U00010C84';
-        case U'\U00010CC5': return U'\U00010C85';
-        case U'\U00010CC6': return U'\U00010C86';
-        case U'\U00010CC7': return U'\U00010C87';
-        case U'\U00010CC8': return U'\U00010C88';
-        case U'\U00010CC9': return U'\U00010C89';
-        case U'\U00010CCA': return U'\U00010C8A';
-        case U'\U00010CCB': return U'\U00010C8B';
-        case U'\U00010CCC': return U'\U00010C8C';
-        case U'\U00010CCD': return U'\U00010C8D';
-        case U'\U00010CCE': return U'\U00010C8E';
-        case U'\U00010CCF': return U'\U00010C8F';
-        case U'\U00010CD0': return U'\U00010C90';
-        case U'\U00010CD1': return U'\U00010C91';
-        case U'\U00010CD2': return U'\U00010C92';
-        case U'\U00010CD3': return U'\U00010C93';
-        case U'\U00010CD4': return U'\U00010C94';
-        case U'\U00010CD5': return U'\U00010C95';
-        case U'\U00010CD6': return U'\U00010C96';
-        case U'\U00010CD7': return U'\U00010C97';
-        case U'\U00010CD8': return U'\U00010C98';
-        case U'\U00010CD9': return U'\U00010C99';
-        case U'\U00010CDA': return U'\U00010C9A';
-        case U'\U00010CDB': return U'\U00010C9B';
-        case U'\U00010CDC': return U'\U00010C9C';
-        case U'\U00010CDD': return U'\U00010C9D';
-        case U'\U00010CDE': return U'\U00010C9E';
-        case U'\U00010CDF': return U'\U00010C9F';
-        case U'\U00010CE0': return U'\U00010CA0';
-        case U'\U00010CE1': return U'\U00010CA1';
-        case U'\U00010CE2': return U'\U00010CA2';
-        case U'\U00010CE3': return U'\U00010CA3';
-        case U'\U00010CE4': return U'\U00010CA4';
-        case U'\U00010CE5': return U'\U00010CA5';
-        case U'\U00010CE6': return U'\U00010CA6';
-        case U'\U00010CE7': return U'\U00010CA7';
-        case U'\U00010CE8': return U'\U00010CA8';
-        case U'\U00010CE9': return U'\U00010CA9';
-        case U'\U00010CEA': return U'\U00010CAA';
-        case U'\U00010CEB': return U'\U00010CAB';
-        case U'\U00010CEC': return U'\U00010CAC';
-        case U'\U00010CED': return U'\U00010CAD';
-        case U'\U00010CEE': return U'\U00010CAE';
-        case U'\U00010CEF': return U'\U00010CAF';
-        case U'\U00010CF0': return U'\U00010CB0';
-        case U'\U00010CF1': return U'\U00010CB1';
-        case U'\U00010CF2': return U'\U00010CB2';
-        case U'\U00010D70': return U'\U00010D50';
-        case U'\U00010D71': return U'\U00010D51';
-        case U'\U00010D72': return U'\U00010D52';
-        case U'\U00010D73': return U'\U00010D53';
-        case U'\U00010D74': return U'\U00010D54';
-        case U'\U00010D75': return U'\U00010D55';
-        case U'\U00010D76': return U'\U00010D56';
-        case U'\U00010D77': return U'\U00010D57';
-        case U'\U00010D78': return U'\U00010D58';
-        case U'\U00010D79': return U'\U00010D59';
-        case U'\U00010D7A': return U'\U00010D5A';
-        case U'\U00010D7B': return U'\U00010D5B';
-        case U'\U00010D7C': return U'\U00010D5C';
-        case U'\U00010D7D': return U'\U00010D5D';
-        case U'\U00010D7E': return U'\U00010D5E';
-        case U'\U00010D7F': return U'\U00010D5F';
-        case U'\U00010D80': return U'\U00010D60';
-        case U'\U00010D81': return U'\U00010D61';
-        case U'\U00010D82': return U'\U00010D62';
-        case U'\U00010D83': return U'\U00010D63';
-        case U'\U00010D84': return U'\U00010D64';
-        case U'\U00010D85': return U'\U00010D65';
-        case U'\U000118C0': return U'\U000118A0';
-        case U'\U000118C1': return U'\U000118A1';
-        case U'\U000118C2': return U'\U000118A2';
-        case U'\U000118C3': return U'\U000118A3';
-        case U'\U000118C4': return U'\U000118A4';
-        case U'\U000118C5': return U'\U000118A5';
-        case U'\U000118C6': return U'\U000118A6';
-        case U'\U000118C7': return U'\U000118A7';
-        case U'\U000118C8': return U'\U000118A8';
-        case U'\U000118C9': return U'\U000118A9';
-        case U'\U000118CA': return U'\U000118AA';
-        case U'\U000118CB': return U'\U000118AB';
-        case U'\U000118CC': return U'\U000118AC';
-        case U'\U000118CD': return U'\U000118AD';
-        case U'\U000118CE': return U'\U000118AE';
-        case U'\U000118CF': return U'\U000118AF';
-        case U'\U000118D0': return U'\U000118B0';
-        case U'\U000118D1': return U'\U000118B1';
-        case U'\U000118D2': return U'\U000118B2';
-        case U'\U000118D3': return U'\U000118B3';
-        case U'\U000118D4': return U'\U000118B4';
-        case U'\U000118D5': return U'\U000118B5';
-        case U'\U000118D6': return U'\U000118B6';
-        case U'\U000118D7': return U'\U000118B7';
-        case U'\U000118D8': return U'\U000118B8';
-        case U'\U000118D9': return U'\U000118B9';
-        case U'\U000118DA': return U'\U000118BA';
-        case U'\U000118DB': return U'\U000118BB';
-        case U'\U000118DC': return U'\U000118BC';
-        case U'\U000118DD': return U'\U000118BD';
-        case U'\U000118DE': return U'\U000118BE';
-        case U'\U000118DF': return U'\U000118BF';
-        case U'\U00016E60': return U'\U00016E40';
-        case U'\U00016E61': return U'\U00016E41';
-        case U'\U00016E62': return U'\U00016E42';
-        case U'\U00016E63': return U'\U00016E43';
-        case U'\U00016E64': return U'\U00016E44';
-        case U'\U00016E65': return U'\U00016E45';
-        case U'\U00016E66': return U'\U00016E46';
-        case U'\U00016E67': return U'\U00016E47';
-        case U'\U00016E68': return U'\U00016E48';
-        case U'\U00016E69': return U'\U00016E49';
-        case U'\U00016E6A': return U'\U00016E4A';
-        case U'\U00016E6B': return U'\U00016E4B';
-        case U'\U00016E6C': return U'\U00016E4C';
-        case U'\U00016E6D': return U'\U00016E4D';
-        case U'\U00016E6E': return U'\U00016E4E';
-        case U'\U00016E6F': return U'\U00016E4F';
-        case U'\U00016E70': return U'\U00016E50';
-        case U'\U00016E71': return U'\U00016E51';
-        case U'\U00016E72': return U'\U00016E52';
-        case U'\U00016E73': return U'\U00016E53';
-        case U'\U00016E74': return U'\U00016E54';
-        case U'\U00016E75': return U'\U00016E55';
-        case U'\U00016E76': return U'\U00016E56';
-        case U'\U00016E77': return U'\U00016E57';
-        case U'\U00016E78': return U'\U00016E58';
-        case U'\U00016E79': return U'\U00016E59';
-        case U'\U00016E7A': return U'\U00016E5A';
-        case U'\U00016E7B': return U'\U00016E5B';
-        case U'\U00016E7C': return U'\U00016E5C';
-        case U'\U00016E7D': return U'\U00016E5D';
-        case U'\U00016E7E': return U'\U00016E5E';
-        case U'\U00016E7F': return U'\U00016E5F';
-        case U'\U00016EBB': return U'\U00016EA0';
-        case U'\U00016EBC': return U'\U00016EA1';
-        case U'\U00016EBD': return U'\U00016EA2';
-        case U'\U00016EBE': return U'\U00016EA3';
-        case U'\U00016EBF': return U'\U00016EA4';
-        case U'\U00016EC0': return U'\U00016EA5';
-        case U'\U00016EC1': return U'\U00016EA6';
-        case U'\U00016EC2': return U'\U00016EA7';
-        case U'\U00016EC3': return U'\U00016EA8';
-        case U'\U00016EC4': return U'\U00016EA9';
-        case U'\U00016EC5': return U'\U00016EAA';
-        case U'\U00016EC6': return U'\U00016EAB';
-        case U'\U00016EC7': return U'\U00016EAC';
-        case U'\U00016EC8': return U'\U00016EAD';
-        case U'\U00016EC9': return U'\U00016EAE';
-        case U'\U00016ECA': return U'\U00016EAF';
-        case U'\U00016ECB': return U'\U00016EB0';
-        case U'\U00016ECC': return U'\U00016EB1';
-        case U'\U00016ECD': return U'\U00016EB2';
-        case U'\U00016ECE': return U'\U00016EB3';
-        case U'\U00016ECF': return U'\U00016EB4';
-        case U'\U00016ED0': return U'\U00016EB5';
-        case U'\U00016ED1': return U'\U00016EB6';
-        case U'\U00016ED2': return U'\U00016EB7';
-        case U'\U00016ED3': return U'\U00016EB8';
-        case U'\U0001E922': return U'\U0001E900';
-        case U'\U0001E923': return U'\U0001E901';
-        case U'\U0001E924': return U'\U0001E902';
-        case U'\U0001E925': return U'\U0001E903';
-        case U'\U0001E926': return U'\U0001E904';
-        case U'\U0001E927': return U'\U0001E905';
-        case U'\U0001E928': return U'\U0001E906';
-        case U'\U0001E929': return U'\U0001E907';
-        case U'\U0001E92A': return U'\U0001E908';
-        case U'\U0001E92B': return U'\U0001E909';
-        case U'\U0001E92C': return U'\U0001E90A';
-        case U'\U0001E92D': return U'\U0001E90B';
-        case U'\U0001E92E': return U'\U0001E90C';
-        case U'\U0001E92F': return U'\U0001E90D';
-        case U'\U0001E930': return U'\U0001E90E';
-        case U'\U0001E931': return U'\U0001E90F';
-        case U'\U0001E932': return U'\U0001E910';
-        case U'\U0001E933': return U'\U0001E911';
-        case U'\U0001E934': return U'\U0001E912';
-        case U'\U0001E935': return U'\U0001E913';
-        case U'\U0001E936': return U'\U0001E914';
-        case U'\U0001E937': return U'\U0001E915';
-        case U'\U0001E938': return U'\U0001E916';
-        case U'\U0001E939': return U'\U0001E917';
-        case U'\U0001E93A': return U'\U0001E918';
-        case U'\U0001E93B': return U'\U0001E919';
-        case U'\U0001E93C': return U'\U0001E91A';
-        case U'\U0001E93D': return U'\U0001E91B';
-        case U'\U0001E93E': return U'\U0001E91C';
-        case U'\U0001E93F': return U'\U0001E91D';
-        case U'\U0001E940': return U'\U0001E91E';
-        case U'\U0001E941': return U'\U0001E91F';
-        case U'\U0001E942': return U'\U0001E920';
-        case U'\U0001E943': return U'\U0001E921';
-        default: return c;
-        }
-    }
+    inline constexpr char32_t casing_limit = U'\U000E0200';
+
+    // clang-format off
+    inline constexpr casing_record casing_records[] = {
+        { 0, 0, 0, 0x0u }, { 0, 0, 0, 0x2u }, { 32, 0, 32, 0x1u }, { 0, -32, 0, 0x1u }, { 0, -32, 0, 0x5u }, { 0, 0, 0, 0x1u }, { 0, 743, 775, 0x1u }, { 0, 121, 0, 0x1u },
+        { 1, 0, 1, 0x1u }, { 0, -1, 0, 0x1u }, { 0, -1, 0, 0x5u }, { -199, 0, 0, 0x1u }, { 0, -232, 0, 0x1u }, { -121, 0, -121, 0x1u }, { 0, -300, -268, 0x1u },
+        { 0, 195, 0, 0x1u }, { 210, 0, 210, 0x1u }, { 206, 0, 206, 0x1u }, { 205, 0, 205, 0x1u }, { 79, 0, 79, 0x1u }, { 202, 0, 202, 0x1u }, { 203, 0, 203, 0x1u },
+        { 207, 0, 207, 0x1u }, { 0, 97, 0, 0x1u }, { 211, 0, 211, 0x1u }, { 209, 0, 209, 0x1u }, { 0, 163, 0, 0x1u }, { 0, 42561, 0, 0x1u }, { 213, 0, 213, 0x1u },
+        { 0, 130, 0, 0x1u }, { 214, 0, 214, 0x1u }, { 218, 0, 218, 0x1u }, { 217, 0, 217, 0x1u }, { 219, 0, 219, 0x1u }, { 0, 56, 0, 0x1u }, { 2, 0, 2, 0x1u }, { 1, -1, 1, 0x1u },
+        { 0, -2, 0, 0x1u }, { 0, -79, 0, 0x1u }, { -97, 0, -97, 0x1u }, { -56, 0, -56, 0x1u }, { -130, 0, -130, 0x1u }, { 10795, 0, 10795, 0x1u }, { -163, 0, -163, 0x1u },
+        { 10792, 0, 10792, 0x1u }, { 0, 10815, 0, 0x1u }, { -195, 0, -195, 0x1u }, { 69, 0, 69, 0x1u }, { 71, 0, 71, 0x1u }, { 0, 10783, 0, 0x1u }, { 0, 10780, 0, 0x1u },
+        { 0, 10782, 0, 0x1u }, { 0, -210, 0, 0x1u }, { 0, -206, 0, 0x1u }, { 0, -205, 0, 0x1u }, { 0, -202, 0, 0x1u }, { 0, -203, 0, 0x1u }, { 0, 42319, 0, 0x1u },
+        { 0, 42315, 0, 0x1u }, { 0, -207, 0, 0x1u }, { 0, 42343, 0, 0x1u }, { 0, 42280, 0, 0x1u }, { 0, 42308, 0, 0x1u }, { 0, -209, 0, 0x5u }, { 0, -211, 0, 0x1u },
+        { 0, 10743, 0, 0x1u }, { 0, 42305, 0, 0x1u }, { 0, 10749, 0, 0x1u }, { 0, -213, 0, 0x1u }, { 0, -214, 0, 0x1u }, { 0, 10727, 0, 0x1u }, { 0, -218, 0, 0x1u },
+        { 0, 42307, 0, 0x1u }, { 0, 42282, 0, 0x1u }, { 0, -69, 0, 0x1u }, { 0, -217, 0, 0x1u }, { 0, -71, 0, 0x1u }, { 0, -219, 0, 0x1u }, { 0, 42261, 0, 0x5u },
+        { 0, 42258, 0, 0x1u }, { 0, 0, 0, 0x3u }, { 0, 0, 0, 0x7u }, { 0, 84, 116, 0x3u }, { 116, 0, 116, 0x1u }, { 38, 0, 38, 0x1u }, { 37, 0, 37, 0x1u }, { 64, 0, 64, 0x1u },
+        { 63, 0, 63, 0x1u }, { 0, -38, 0, 0x1u }, { 0, -37, 0, 0x1u }, { 0, -31, 1, 0x1u }, { 0, -64, 0, 0x1u }, { 0, -63, 0, 0x1u }, { 8, 0, 8, 0x1u }, { 0, -62, -30, 0x1u },
+        { 0, -57, -25, 0x1u }, { 0, -47, -15, 0x1u }, { 0, -54, -22, 0x1u }, { 0, -8, 0, 0x1u }, { 0, -86, -54, 0x1u }, { 0, -80, -48, 0x1u }, { 0, 7, 0, 0x1u },
+        { 0, -116, 0, 0x5u }, { -60, 0, -60, 0x1u }, { 0, -96, -64, 0x1u }, { -7, 0, -7, 0x1u }, { 80, 0, 80, 0x1u }, { 0, -80, 0, 0x1u }, { 0, -80, 0, 0x5u },
+        { 15, 0, 15, 0x1u }, { 0, -15, 0, 0x1u }, { 48, 0, 48, 0x1u }, { 0, -48, 0, 0x1u }, { 7264, 0, 7264, 0x1u }, { 0, 3008, 0, 0x1u }, { 38864, 0, 0, 0x1u },
+        { 8, 0, 0, 0x1u }, { 0, -8, -8, 0x1u }, { 0, -6254, -6222, 0x1u }, { 0, -6253, -6221, 0x1u }, { 0, -6244, -6212, 0x1u }, { 0, -6242, -6210, 0x1u },
+        { 0, -6243, -6211, 0x1u }, { 0, -6236, -6204, 0x1u }, { 0, -6181, -6180, 0x1u }, { 0, 35266, 35267, 0x1u }, { -3008, 0, -3008, 0x1u }, { 0, 35332, 0, 0x1u },
+        { 0, 3814, 0, 0x1u }, { 0, 35384, 0, 0x1u }, { 0, 0, 0, 0x5u }, { 0, -59, -58, 0x1u }, { -7615, 0, -7615, 0x1u }, { 0, 8, 0, 0x1u }, { -8, 0, -8, 0x1u },
+        { 0, 74, 0, 0x1u }, { 0, 86, 0, 0x1u }, { 0, 100, 0, 0x1u }, { 0, 128, 0, 0x1u }, { 0, 112, 0, 0x1u }, { 0, 126, 0, 0x1u }, { 0, 9, 0, 0x1u }, { -74, 0, -74, 0x1u },
+        { -9, 0, -9, 0x1u }, { 0, -7205, -7173, 0x1u }, { -86, 0, -86, 0x1u }, { 0, 0, -7235, 0x1u }, { -100, 0, -100, 0x1u }, { 0, 0, -7219, 0x1u }, { -112, 0, -112, 0x1u },
+        { -128, 0, -128, 0x1u }, { -126, 0, -126, 0x1u }, { -7517, 0, -7517, 0x1u }, { -8383, 0, -8383, 0x1u }, { -8262, 0, -8262, 0x1u }, { 28, 0, 28, 0x1u },
+        { 0, -28, 0, 0x1u }, { 16, 0, 16, 0x1u }, { 0, -16, 0, 0x1u }, { 26, 0, 26, 0x1u }, { 0, -26, 0, 0x1u }, { -10743, 0, -10743, 0x1u }, { -3814, 0, -3814, 0x1u },
+        { -10727, 0, -10727, 0x1u }, { 0, -10795, 0, 0x1u }, { 0, -10792, 0, 0x1u }, { -10780, 0, -10780, 0x1u }, { -10749, 0, -10749, 0x1u }, { -10783, 0, -10783, 0x1u },
+        { -10782, 0, -10782, 0x1u }, { -10815, 0, -10815, 0x1u }, { 0, -7264, 0, 0x1u }, { -35332, 0, -35332, 0x1u }, { -42280, 0, -42280, 0x1u }, { 0, 48, 0, 0x1u },
+        { -42308, 0, -42308, 0x1u }, { -42319, 0, -42319, 0x1u }, { -42315, 0, -42315, 0x1u }, { -42305, 0, -42305, 0x1u }, { -42258, 0, -42258, 0x1u },
+        { -42282, 0, -42282, 0x1u }, { -42261, 0, -42261, 0x1u }, { 928, 0, 928, 0x1u }, { -48, 0, -48, 0x1u }, { -42307, 0, -42307, 0x1u }, { -35384, 0, -35384, 0x1u },
+        { -42343, 0, -42343, 0x1u }, { -42561, 0, -42561, 0x1u }, { 0, -928, 0, 0x1u }, { 0, -38864, -38864, 0x1u }, { 0, 0, 1, 0x1u }, { 40, 0, 40, 0x1u }, { 0, -40, 0, 0x1u },
+        { 39, 0, 39, 0x1u }, { 0, -39, 0, 0x1u }, { 27, 0, 27, 0x1u }, { 0, -27, 0, 0x1u }, { 34, 0, 34, 0x1u }, { 0, -34, 0, 0x1u }
+    };
+    inline constexpr uint_least8_t casing_stage1[] = {
+        0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u, 17u, 18u, 19u, 20u, 21u, 22u, 23u, 24u, 25u, 26u, 27u, 28u, 29u, 30u, 31u, 32u, 33u, 34u, 34u,
+        34u, 34u, 35u, 36u, 34u, 34u, 34u, 34u, 34u, 34u, 37u, 38u, 39u, 40u, 41u, 34u, 42u, 43u, 44u, 45u, 46u, 47u, 48u, 49u, 50u, 51u, 52u, 53u, 54u, 55u, 56u, 57u, 34u, 34u,
+        34u, 34u, 34u, 58u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 59u, 60u, 61u, 62u, 63u, 34u, 34u, 34u, 64u, 65u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 66u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 67u, 34u, 34u, 68u, 69u, 70u, 71u, 72u, 73u, 74u, 75u, 76u, 77u,
+        78u, 79u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 80u, 81u, 34u, 34u, 34u, 34u, 82u, 83u, 84u, 85u,
+        34u, 34u, 34u, 86u, 34u, 87u, 88u, 34u, 89u, 90u, 91u, 92u, 34u, 34u, 34u, 93u, 34u, 34u, 34u, 34u, 94u, 95u, 34u, 34u, 34u, 96u, 97u, 98u, 34u, 99u, 100u, 101u, 102u,
+        103u, 104u, 105u, 106u, 107u, 108u, 109u, 110u, 111u, 34u, 112u, 113u, 114u, 115u, 34u, 116u, 117u, 118u, 119u, 120u, 121u, 122u, 34u, 123u, 124u, 125u, 126u, 34u, 127u,
+        128u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 129u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 130u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 131u, 132u, 34u, 34u, 34u, 133u, 34u, 134u, 135u, 136u, 137u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 138u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 139u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 140u, 34u, 34u, 34u, 141u, 142u, 143u, 34u, 34u, 34u, 144u, 145u, 146u, 147u, 148u, 149u, 150u, 151u, 34u,
+        34u, 34u, 34u, 152u, 153u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 154u, 34u, 155u, 156u, 157u, 34u, 34u, 158u, 34u, 34u, 34u, 159u, 34u, 160u, 34u, 161u, 34u, 34u, 34u,
+        162u, 163u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 164u, 165u, 34u, 34u, 34u, 166u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u,
+        34u, 34u, 34u, 34u, 167u, 34u, 168u, 169u
+    };
+    inline constexpr uint_least8_t casing_stage2[] = {
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u,
+        2u, 2u, 2u, 2u, 2u, 0u, 0u, 0u, 1u, 0u, 1u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 5u, 0u,
+        0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 6u, 0u, 1u, 1u, 0u, 5u, 0u, 0u, 0u, 0u, 0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u,
+        0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 5u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 0u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 7u, 8u, 9u,
+        8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 10u, 11u, 12u, 8u, 9u, 8u, 9u, 8u, 9u, 5u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 5u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 13u, 8u, 9u, 8u, 9u, 8u, 9u, 14u, 15u,
+        16u, 8u, 9u, 8u, 9u, 17u, 8u, 9u, 18u, 18u, 8u, 9u, 5u, 19u, 20u, 21u, 8u, 9u, 18u, 22u, 23u, 24u, 25u, 8u, 9u, 26u, 27u, 24u, 28u, 29u, 30u, 8u, 9u, 8u, 9u, 8u, 9u, 31u,
+        8u, 9u, 31u, 5u, 5u, 8u, 9u, 31u, 8u, 9u, 32u, 32u, 8u, 9u, 8u, 9u, 33u, 8u, 9u, 5u, 0u, 8u, 9u, 5u, 34u, 0u, 0u, 0u, 0u, 35u, 36u, 37u, 35u, 36u, 37u, 35u, 36u, 37u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 38u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 5u, 35u, 36u, 37u, 8u, 9u, 39u,
+        40u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 41u,
+        5u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 5u, 5u, 5u, 5u, 5u, 5u, 42u, 8u, 9u, 43u, 44u, 45u, 45u, 8u, 9u, 46u, 47u, 48u, 8u, 9u, 8u,
+        10u, 8u, 9u, 8u, 9u, 8u, 9u, 49u, 50u, 51u, 52u, 53u, 5u, 54u, 54u, 5u, 55u, 5u, 56u, 57u, 5u, 5u, 5u, 54u, 58u, 5u, 59u, 60u, 61u, 62u, 5u, 63u, 64u, 62u, 65u, 66u, 5u,
+        5u, 64u, 5u, 67u, 68u, 5u, 5u, 69u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 70u, 5u, 5u, 71u, 5u, 72u, 71u, 5u, 5u, 5u, 73u, 71u, 74u, 75u, 75u, 76u, 5u, 5u, 5u, 5u, 5u, 77u, 5u, 0u,
+        0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 78u, 79u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 80u, 80u, 81u, 80u, 80u, 80u, 80u, 80u, 80u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 80u, 80u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 80u, 80u, 80u, 80u, 80u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 82u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 8u, 9u, 8u, 9u, 1u, 1u, 8u, 9u, 0u, 0u, 80u, 29u, 29u, 29u, 0u, 83u, 0u, 0u, 0u, 0u, 1u, 1u, 84u, 1u, 85u, 85u, 85u, 0u, 86u, 0u,
+        87u, 87u, 5u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 88u, 89u, 89u, 89u, 5u, 3u, 3u, 3u, 3u, 3u, 3u,
+        3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 90u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 91u, 92u, 92u, 93u, 94u, 95u, 5u, 5u, 5u, 96u, 97u, 98u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 99u, 100u, 101u, 102u, 103u, 104u, 0u, 8u, 9u, 105u, 8u, 9u, 5u, 41u, 41u, 41u, 106u, 106u, 106u, 106u,
+        106u, 106u, 106u, 106u, 106u, 106u, 106u, 106u, 106u, 106u, 106u, 106u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u,
+        2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 107u, 107u,
+        107u, 107u, 107u, 107u, 108u, 107u, 108u, 107u, 107u, 107u, 107u, 107u, 107u, 107u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 109u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 8u, 9u, 110u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 0u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u,
+        111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 5u, 112u,
+        112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u,
+        112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 1u, 1u, 0u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u,
+        1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u,
+        1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u,
+        1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u,
+        113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 113u, 0u, 113u, 0u, 0u, 0u, 0u, 0u, 113u, 0u, 0u,
+        114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u,
+        114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 114u, 0u, 80u, 114u, 114u, 114u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u,
+        115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u,
+        115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u, 115u,
+        115u, 115u, 115u, 115u, 115u, 115u, 115u, 116u, 116u, 116u, 116u, 116u, 116u, 0u, 0u, 117u, 117u, 117u, 117u, 117u, 117u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u,
+        0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u,
+        1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 1u, 0u, 0u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 0u,
+        1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u,
+        1u, 1u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 118u, 119u, 120u, 121u, 121u, 122u, 123u, 124u, 125u, 8u, 9u, 0u, 0u, 0u, 0u,
+        0u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u,
+        126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 126u, 0u, 0u, 126u, 126u, 126u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u,
+        1u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u,
+        80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 81u, 80u, 80u, 80u, 80u, 80u, 80u, 80u,
+        80u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 80u, 127u, 5u, 5u, 5u, 128u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 129u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 130u, 5u, 5u, 5u, 5u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 81u, 80u, 80u, 80u, 81u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u,
+        80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 10u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 5u, 5u, 5u, 5u, 5u, 131u, 5u, 5u, 132u, 5u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 10u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 133u, 133u, 133u, 133u, 133u,
+        133u, 133u, 133u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 133u, 133u, 133u, 133u, 133u, 133u, 0u, 0u, 134u, 134u, 134u, 134u, 134u, 134u, 0u, 0u, 133u, 133u, 133u,
+        133u, 133u, 133u, 133u, 133u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 134u, 134u, 134u, 134u, 134u, 134u, 134u,
+        134u, 133u, 133u, 133u, 133u, 133u, 133u, 0u, 0u, 134u, 134u, 134u, 134u, 134u, 134u, 0u, 0u, 5u, 133u, 5u, 133u, 5u, 133u, 5u, 133u, 0u, 134u, 0u, 134u, 0u, 134u, 0u,
+        134u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 135u, 135u, 136u, 136u, 136u, 136u, 137u, 137u, 138u, 138u, 139u,
+        139u, 140u, 140u, 0u, 0u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 133u,
+        134u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 133u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 134u, 133u, 133u, 5u, 141u, 5u,
+        0u, 5u, 5u, 134u, 134u, 142u, 142u, 143u, 1u, 144u, 1u, 1u, 1u, 5u, 141u, 5u, 0u, 5u, 5u, 145u, 145u, 145u, 145u, 143u, 1u, 1u, 1u, 133u, 133u, 5u, 146u, 0u, 0u, 5u, 5u,
+        134u, 134u, 147u, 147u, 0u, 1u, 1u, 1u, 133u, 133u, 5u, 148u, 5u, 101u, 5u, 5u, 134u, 134u, 149u, 149u, 105u, 1u, 1u, 1u, 0u, 0u, 5u, 141u, 5u, 0u, 5u, 5u, 150u, 150u,
+        151u, 151u, 143u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 81u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 80u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 0u, 0u, 0u, 0u, 5u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 0u, 0u,
+        0u, 0u, 0u, 0u, 5u, 0u, 152u, 0u, 5u, 0u, 153u, 154u, 5u, 5u, 0u, 5u, 5u, 5u, 155u, 5u, 5u, 0u, 0u, 0u, 0u, 5u, 0u, 0u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u,
+        130u, 130u, 0u, 0u, 0u, 0u, 156u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 157u, 157u, 157u, 157u, 157u, 157u, 157u, 157u, 157u, 157u, 157u,
+        157u, 157u, 157u, 157u, 157u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 158u, 0u, 0u, 0u, 8u, 9u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 159u, 160u, 160u,
+        160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 160u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u,
+        111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u, 111u,
+        111u, 111u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u,
+        112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 112u, 8u, 9u, 161u, 162u, 163u, 164u, 165u,
+        8u, 9u, 8u, 9u, 8u, 9u, 166u, 167u, 168u, 169u, 5u, 8u, 9u, 5u, 8u, 9u, 5u, 5u, 5u, 5u, 5u, 81u, 80u, 170u, 170u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        5u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 9u, 8u, 9u, 1u, 1u, 1u, 8u, 9u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u,
+        171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 171u, 0u,
+        171u, 0u, 0u, 0u, 0u, 0u, 171u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 0u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 80u, 80u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u,
+        8u, 9u, 5u, 5u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 80u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 8u, 9u, 8u, 9u, 172u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 1u, 1u, 1u, 8u, 9u, 173u, 5u, 0u, 8u, 9u, 8u, 9u, 174u, 5u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 175u, 176u,
+        177u, 178u, 175u, 5u, 179u, 180u, 181u, 182u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 183u, 184u, 185u, 8u, 9u, 8u, 9u, 186u, 8u, 9u, 8u, 9u, 8u,
+        9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 8u, 9u, 187u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 80u, 80u, 80u, 80u, 8u, 9u, 0u, 80u, 80u,
+        5u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 188u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 1u, 80u, 80u, 80u, 80u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 80u, 1u, 1u, 0u, 0u, 0u, 0u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u,
+        189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u,
+        189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u,
+        189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 189u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 5u, 5u, 5u, 5u, 5u, 190u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u,
+        2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 0u, 0u, 0u, 1u, 0u, 1u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u,
+        3u, 3u, 3u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 191u, 191u, 191u, 191u,
+        191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u,
+        191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u,
+        192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 191u, 191u,
+        191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u, 191u,
+        191u, 191u, 191u, 191u, 191u, 191u, 0u, 0u, 0u, 0u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u,
+        192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 192u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 0u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 193u,
+        193u, 193u, 193u, 193u, 193u, 193u, 0u, 193u, 193u, 193u, 193u, 193u, 193u, 193u, 0u, 193u, 193u, 0u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 0u,
+        194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 0u, 194u, 194u, 194u, 194u, 194u, 194u, 194u, 0u, 194u, 194u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 80u, 1u, 1u, 80u, 80u, 80u, 0u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u,
+        80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 0u, 80u, 80u, 80u,
+        80u, 80u, 80u, 80u, 80u, 80u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 0u,
+        0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u,
+        86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u,
+        86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 86u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u,
+        91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u, 91u,
+        91u, 91u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 3u,
+        3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u,
+        0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u,
+        1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u,
+        0u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u,
+        2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u,
+        3u, 3u, 3u, 3u, 3u, 3u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u,
+        0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 0u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 1u,
+        1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u,
+        0u, 0u, 0u, 1u, 0u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u,
+        1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u,
+        3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u, 195u,
+        195u, 195u, 195u, 0u, 0u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u, 196u,
+        196u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 130u, 130u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 0u, 0u, 5u, 0u, 0u, 5u, 5u, 0u, 0u, 5u, 5u, 5u, 5u, 0u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 0u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 130u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 0u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 130u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u,
+        0u, 0u, 0u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 81u, 81u, 80u, 80u,
+        80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 80u, 81u, 80u, 80u, 80u, 80u, 80u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u,
+        197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 197u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u,
+        198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 198u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u,
+        5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u
+    };
+    // clang-format on
+
     /// @internal
     /// @ingroup sys_internal
-    constexpr char32_t dchar_fold_simple(const char32_t c) noexcept
+    /// @brief Casing properties of `c`.
+    constexpr const casing_record& dchar_casing_record(const char32_t c) noexcept
     {
-        switch (c)
-        {
-        case U'\u0041': return U'\u0061';
-        case U'\u0042': return U'\u0062';
-        case U'\u0043': return U'\u0063';
-        case U'\u0044': return U'\u0064';
-        case U'\u0045': return U'\u0065';
-        case U'\u0046': return U'\u0066';
-        case U'\u0047': return U'\u0067';
-        case U'\u0048': return U'\u0068';
-        case U'\u0049': return U'\u0069';
-        case U'\u004A': return U'\u006A';
-        case U'\u004B': return U'\u006B';
-        case U'\u004C': return U'\u006C';
-        case U'\u004D': return U'\u006D';
-        case U'\u004E': return U'\u006E';
-        case U'\u004F': return U'\u006F';
-        case U'\u0050': return U'\u0070';
-        case U'\u0051': return U'\u0071';
-        case U'\u0052': return U'\u0072';
-        case U'\u0053': return U'\u0073';
-        case U'\u0054': return U'\u0074';
-        case U'\u0055': return U'\u0075';
-        case U'\u0056': return U'\u0076';
-        case U'\u0057': return U'\u0077';
-        case U'\u0058': return U'\u0078';
-        case U'\u0059': return U'\u0079';
-        case U'\u005A': return U'\u007A';
-        case U'\u00B5': return U'\u03BC';
-        case U'\u00C0': return U'\u00E0';
-        case U'\u00C1': return U'\u00E1';
-        case U'\u00C2': return U'\u00E2';
-        case U'\u00C3': return U'\u00E3';
-        case U'\u00C4': return U'\u00E4';
-        case U'\u00C5': return U'\u00E5';
-        case U'\u00C6': return U'\u00E6';
-        case U'\u00C7': return U'\u00E7';
-        case U'\u00C8': return U'\u00E8';
-        case U'\u00C9': return U'\u00E9';
-        case U'\u00CA': return U'\u00EA';
-        case U'\u00CB': return U'\u00EB';
-        case U'\u00CC': return U'\u00EC';
-        case U'\u00CD': return U'\u00ED';
-        case U'\u00CE': return U'\u00EE';
-        case U'\u00CF': return U'\u00EF';
-        case U'\u00D0': return U'\u00F0';
-        case U'\u00D1': return U'\u00F1';
-        case U'\u00D2': return U'\u00F2';
-        case U'\u00D3': return U'\u00F3';
-        case U'\u00D4': return U'\u00F4';
-        case U'\u00D5': return U'\u00F5';
-        case U'\u00D6': return U'\u00F6';
-        case U'\u00D8': return U'\u00F8';
-        case U'\u00D9': return U'\u00F9';
-        case U'\u00DA': return U'\u00FA';
-        case U'\u00DB': return U'\u00FB';
-        case U'\u00DC': return U'\u00FC';
-        case U'\u00DD': return U'\u00FD';
-        case U'\u00DE': return U'\u00FE';
-        case U'\u0100': return U'\u0101';
-        case U'\u0102': return U'\u0103';
-        case U'\u0104': return U'\u0105';
-        case U'\u0106': return U'\u0107';
-        case U'\u0108': return U'\u0109';
-        case U'\u010A': return U'\u010B';
-        case U'\u010C': return U'\u010D';
-        case U'\u010E': return U'\u010F';
-        case U'\u0110': return U'\u0111';
-        case U'\u0112': return U'\u0113';
-        case U'\u0114': return U'\u0115';
-        case U'\u0116': return U'\u0117';
-        case U'\u0118': return U'\u0119';
-        case U'\u011A': return U'\u011B';
-        case U'\u011C': return U'\u011D';
-        case U'\u011E': return U'\u011F';
-        case U'\u0120': return U'\u0121';
-        case U'\u0122': return U'\u0123';
-        case U'\u0124': return U'\u0125';
-        case U'\u0126': return U'\u0127';
-        case U'\u0128': return U'\u0129';
-        case U'\u012A': return U'\u012B';
-        case U'\u012C': return U'\u012D';
-        case U'\u012E': return U'\u012F';
-        case U'\u0132': return U'\u0133';
-        case U'\u0134': return U'\u0135';
-        case U'\u0136': return U'\u0137';
-        case U'\u0139': return U'\u013A';
-        case U'\u013B': return U'\u013C';
-        case U'\u013D': return U'\u013E';
-        case U'\u013F': return U'\u0140';
-        case U'\u0141': return U'\u0142';
-        case U'\u0143': return U'\u0144';
-        case U'\u0145': return U'\u0146';
-        case U'\u0147': return U'\u0148';
-        case U'\u014A': return U'\u014B';
-        case U'\u014C': return U'\u014D';
-        case U'\u014E': return U'\u014F';
-        case U'\u0150': return U'\u0151';
-        case U'\u0152': return U'\u0153';
-        case U'\u0154': return U'\u0155';
-        case U'\u0156': return U'\u0157';
-        case U'\u0158': return U'\u0159';
-        case U'\u015A': return U'\u015B';
-        case U'\u015C': return U'\u015D';
-        case U'\u015E': return U'\u015F';
-        case U'\u0160': return U'\u0161';
-        case U'\u0162': return U'\u0163';
-        case U'\u0164': return U'\u0165';
-        case U'\u0166': return U'\u0167';
-        case U'\u0168': return U'\u0169';
-        case U'\u016A': return U'\u016B';
-        case U'\u016C': return U'\u016D';
-        case U'\u016E': return U'\u016F';
-        case U'\u0170': return U'\u0171';
-        case U'\u0172': return U'\u0173';
-        case U'\u0174': return U'\u0175';
-        case U'\u0176': return U'\u0177';
-        case U'\u0178': return U'\u00FF';
-        case U'\u0179': return U'\u017A';
-        case U'\u017B': return U'\u017C';
-        case U'\u017D': return U'\u017E';
-        case U'\u017F': return U'\u0073';
-        case U'\u0181': return U'\u0253';
-        case U'\u0182': return U'\u0183';
-        case U'\u0184': return U'\u0185';
-        case U'\u0186': return U'\u0254';
-        case U'\u0187': return U'\u0188';
-        case U'\u0189': return U'\u0256';
-        case U'\u018A': return U'\u0257';
-        case U'\u018B': return U'\u018C';
-        case U'\u018E': return U'\u01DD';
-        case U'\u018F': return U'\u0259';
-        case U'\u0190': return U'\u025B';
-        case U'\u0191': return U'\u0192';
-        case U'\u0193': return U'\u0260';
-        case U'\u0194': return U'\u0263';
-        case U'\u0196': return U'\u0269';
-        case U'\u0197': return U'\u0268';
-        case U'\u0198': return U'\u0199';
-        case U'\u019C': return U'\u026F';
-        case U'\u019D': return U'\u0272';
-        case U'\u019F': return U'\u0275';
-        case U'\u01A0': return U'\u01A1';
-        case U'\u01A2': return U'\u01A3';
-        case U'\u01A4': return U'\u01A5';
-        case U'\u01A6': return U'\u0280';
-        case U'\u01A7': return U'\u01A8';
-        case U'\u01A9': return U'\u0283';
-        case U'\u01AC': return U'\u01AD';
-        case U'\u01AE': return U'\u0288';
-        case U'\u01AF': return U'\u01B0';
-        case U'\u01B1': return U'\u028A';
-        case U'\u01B2': return U'\u028B';
-        case U'\u01B3': return U'\u01B4';
-        case U'\u01B5': return U'\u01B6';
-        case U'\u01B7': return U'\u0292';
-        case U'\u01B8': return U'\u01B9';
-        case U'\u01BC': return U'\u01BD';
-        case U'\u01C4': return U'\u01C6';
-        case U'\u01C5': return U'\u01C6';
-        case U'\u01C7': return U'\u01C9';
-        case U'\u01C8': return U'\u01C9';
-        case U'\u01CA': return U'\u01CC';
-        case U'\u01CB': return U'\u01CC';
-        case U'\u01CD': return U'\u01CE';
-        case U'\u01CF': return U'\u01D0';
-        case U'\u01D1': return U'\u01D2';
-        case U'\u01D3': return U'\u01D4';
-        case U'\u01D5': return U'\u01D6';
-        case U'\u01D7': return U'\u01D8';
-        case U'\u01D9': return U'\u01DA';
-        case U'\u01DB': return U'\u01DC';
-        case U'\u01DE': return U'\u01DF';
-        case U'\u01E0': return U'\u01E1';
-        case U'\u01E2': return U'\u01E3';
-        case U'\u01E4': return U'\u01E5';
-        case U'\u01E6': return U'\u01E7';
-        case U'\u01E8': return U'\u01E9';
-        case U'\u01EA': return U'\u01EB';
-        case U'\u01EC': return U'\u01ED';
-        case U'\u01EE': return U'\u01EF';
-        case U'\u01F1': return U'\u01F3';
-        case U'\u01F2': return U'\u01F3';
-        case U'\u01F4': return U'\u01F5';
-        case U'\u01F6': return U'\u0195';
-        case U'\u01F7': return U'\u01BF';
-        case U'\u01F8': return U'\u01F9';
-        case U'\u01FA': return U'\u01FB';
-        case U'\u01FC': return U'\u01FD';
-        case U'\u01FE': return U'\u01FF';
-        case U'\u0200': return U'\u0201';
-        case U'\u0202': return U'\u0203';
-        case U'\u0204': return U'\u0205';
-        case U'\u0206': return U'\u0207';
-        case U'\u0208': return U'\u0209';
-        case U'\u020A': return U'\u020B';
-        case U'\u020C': return U'\u020D';
-        case U'\u020E': return U'\u020F';
-        case U'\u0210': return U'\u0211';
-        case U'\u0212': return U'\u0213';
-        case U'\u0214': return U'\u0215';
-        case U'\u0216': return U'\u0217';
-        case U'\u0218': return U'\u0219';
-        case U'\u021A': return U'\u021B';
-        case U'\u021C': return U'\u021D';
-        case U'\u021E': return U'\u021F';
-        case U'\u0220': return U'\u019E';
-        case U'\u0222': return U'\u0223';
-        case U'\u0224': return U'\u0225';
-        case U'\u0226': return U'\u0227';
-        case U'\u0228': return U'\u0229';
-        case U'\u022A': return U'\u022B';
-        case U'\u022C': return U'\u022D';
-        case U'\u022E': return U'\u022F';
-        case U'\u0230': return U'\u0231';
-        case U'\u0232': return U'\u0233';
-        case U'\u023A': return U'\u2C65';
-        case U'\u023B': return U'\u023C';
-        case U'\u023D': return U'\u019A';
-        case U'\u023E': return U'\u2C66';
-        case U'\u0241': return U'\u0242';
-        case U'\u0243': return U'\u0180';
-        case U'\u0244': return U'\u0289';
-        case U'\u0245': return U'\u028C';
-        case U'\u0246': return U'\u0247';
-        case U'\u0248': return U'\u0249';
-        case U'\u024A': return U'\u024B';
-        case U'\u024C': return U'\u024D';
-        case U'\u024E': return U'\u024F';
-        case U'\u0345': return U'\u03B9';
-        case U'\u0370': return U'\u0371';
-        case U'\u0372': return U'\u0373';
-        case U'\u0376': return U'\u0377';
-        case U'\u037F': return U'\u03F3';
-        case U'\u0386': return U'\u03AC';
-        case U'\u0388': return U'\u03AD';
-        case U'\u0389': return U'\u03AE';
-        case U'\u038A': return U'\u03AF';
-        case U'\u038C': return U'\u03CC';
-        case U'\u038E': return U'\u03CD';
-        case U'\u038F': return U'\u03CE';
-        case U'\u0391': return U'\u03B1';
-        case U'\u0392': return U'\u03B2';
-        case U'\u0393': return U'\u03B3';
-        case U'\u0394': return U'\u03B4';
-        case U'\u0395': return U'\u03B5';
-        case U'\u0396': return U'\u03B6';
-        case U'\u0397': return U'\u03B7';
-        case U'\u0398': return U'\u03B8';
-        case U'\u0399': return U'\u03B9';
-        case U'\u039A': return U'\u03BA';
-        case U'\u039B': return U'\u03BB';
-        case U'\u039C': return U'\u03BC';
-        case U'\u039D': return U'\u03BD';
-        case U'\u039E': return U'\u03BE';
-        case U'\u039F': return U'\u03BF';
-        case U'\u03A0': return U'\u03C0';
-        case U'\u03A1': return U'\u03C1';
-        case U'\u03A3': return U'\u03C3';
-        case U'\u03A4': return U'\u03C4';
-        case U'\u03A5': return U'\u03C5';
-        case U'\u03A6': return U'\u03C6';
-        case U'\u03A7': return U'\u03C7';
-        case U'\u03A8': return U'\u03C8';
-        case U'\u03A9': return U'\u03C9';
-        case U'\u03AA': return U'\u03CA';
-        case U'\u03AB': return U'\u03CB';
-        case U'\u03C2': return U'\u03C3';
-        case U'\u03CF': return U'\u03D7';
-        case U'\u03D0': return U'\u03B2';
-        case U'\u03D1': return U'\u03B8';
-        case U'\u03D5': return U'\u03C6';
-        case U'\u03D6': return U'\u03C0';
-        case U'\u03D8': return U'\u03D9';
-        case U'\u03DA': return U'\u03DB';
-        case U'\u03DC': return U'\u03DD';
-        case U'\u03DE': return U'\u03DF';
-        case U'\u03E0': return U'\u03E1';
-        case U'\u03E2': return U'\u03E3';
-        case U'\u03E4': return U'\u03E5';
-        case U'\u03E6': return U'\u03E7';
-        case U'\u03E8': return U'\u03E9';
-        case U'\u03EA': return U'\u03EB';
-        case U'\u03EC': return U'\u03ED';
-        case U'\u03EE': return U'\u03EF';
-        case U'\u03F0': return U'\u03BA';
-        case U'\u03F1': return U'\u03C1';
-        case U'\u03F4': return U'\u03B8';
-        case U'\u03F5': return U'\u03B5';
-        case U'\u03F7': return U'\u03F8';
-        case U'\u03F9': return U'\u03F2';
-        case U'\u03FA': return U'\u03FB';
-        case U'\u03FD': return U'\u037B';
-        case U'\u03FE': return U'\u037C';
-        case U'\u03FF': return U'\u037D';
-        case U'\u0400': return U'\u0450';
-        case U'\u0401': return U'\u0451';
-        case U'\u0402': return U'\u0452';
-        case U'\u0403': return U'\u0453';
-        case U'\u0404': return U'\u0454';
-        case U'\u0405': return U'\u0455';
-        case U'\u0406': return U'\u0456';
-        case U'\u0407': return U'\u0457';
-        case U'\u0408': return U'\u0458';
-        case U'\u0409': return U'\u0459';
-        case U'\u040A': return U'\u045A';
-        case U'\u040B': return U'\u045B';
-        case U'\u040C': return U'\u045C';
-        case U'\u040D': return U'\u045D';
-        case U'\u040E': return U'\u045E';
-        case U'\u040F': return U'\u045F';
-        case U'\u0410': return U'\u0430';
-        case U'\u0411': return U'\u0431';
-        case U'\u0412': return U'\u0432';
-        case U'\u0413': return U'\u0433';
-        case U'\u0414': return U'\u0434';
-        case U'\u0415': return U'\u0435';
-        case U'\u0416': return U'\u0436';
-        case U'\u0417': return U'\u0437';
-        case U'\u0418': return U'\u0438';
-        case U'\u0419': return U'\u0439';
-        case U'\u041A': return U'\u043A';
-        case U'\u041B': return U'\u043B';
-        case U'\u041C': return U'\u043C';
-        case U'\u041D': return U'\u043D';
-        case U'\u041E': return U'\u043E';
-        case U'\u041F': return U'\u043F';
-        case U'\u0420': return U'\u0440';
-        case U'\u0421': return U'\u0441';
-        case U'\u0422': return U'\u0442';
-        case U'\u0423': return U'\u0443';
-        case U'\u0424': return U'\u0444';
-        case U'\u0425': return U'\u0445';
-        case U'\u0426': return U'\u0446';
-        case U'\u0427': return U'\u0447';
-        case U'\u0428': return U'\u0448';
-        case U'\u0429': return U'\u0449';
-        case U'\u042A': return U'\u044A';
-        case U'\u042B': return U'\u044B';
-        case U'\u042C': return U'\u044C';
-        case U'\u042D': return U'\u044D';
-        case U'\u042E': return U'\u044E';
-        case U'\u042F': return U'\u044F';
-        case U'\u0460': return U'\u0461';
-        case U'\u0462': return U'\u0463';
-        case U'\u0464': return U'\u0465';
-        case U'\u0466': return U'\u0467';
-        case U'\u0468': return U'\u0469';
-        case U'\u046A': return U'\u046B';
-        case U'\u046C': return U'\u046D';
-        case U'\u046E': return U'\u046F';
-        case U'\u0470': return U'\u0471';
-        case U'\u0472': return U'\u0473';
-        case U'\u0474': return U'\u0475';
-        case U'\u0476': return U'\u0477';
-        case U'\u0478': return U'\u0479';
-        case U'\u047A': return U'\u047B';
-        case U'\u047C': return U'\u047D';
-        case U'\u047E': return U'\u047F';
-        case U'\u0480': return U'\u0481';
-        case U'\u048A': return U'\u048B';
-        case U'\u048C': return U'\u048D';
-        case U'\u048E': return U'\u048F';
-        case U'\u0490': return U'\u0491';
-        case U'\u0492': return U'\u0493';
-        case U'\u0494': return U'\u0495';
-        case U'\u0496': return U'\u0497';
-        case U'\u0498': return U'\u0499';
-        case U'\u049A': return U'\u049B';
-        case U'\u049C': return U'\u049D';
-        case U'\u049E': return U'\u049F';
-        case U'\u04A0': return U'\u04A1';
-        case U'\u04A2': return U'\u04A3';
-        case U'\u04A4': return U'\u04A5';
-        case U'\u04A6': return U'\u04A7';
-        case U'\u04A8': return U'\u04A9';
-        case U'\u04AA': return U'\u04AB';
-        case U'\u04AC': return U'\u04AD';
-        case U'\u04AE': return U'\u04AF';
-        case U'\u04B0': return U'\u04B1';
-        case U'\u04B2': return U'\u04B3';
-        case U'\u04B4': return U'\u04B5';
-        case U'\u04B6': return U'\u04B7';
-        case U'\u04B8': return U'\u04B9';
-        case U'\u04BA': return U'\u04BB';
-        case U'\u04BC': return U'\u04BD';
-        case U'\u04BE': return U'\u04BF';
-        case U'\u04C0': return U'\u04CF';
-        case U'\u04C1': return U'\u04C2';
-        case U'\u04C3': return U'\u04C4';
-        case U'\u04C5': return U'\u04C6';
-        case U'\u04C7': return U'\u04C8';
-        case U'\u04C9': return U'\u04CA';
-        case U'\u04CB': return U'\u04CC';
-        case U'\u04CD': return U'\u04CE';
-        case U'\u04D0': return U'\u04D1';
-        case U'\u04D2': return U'\u04D3';
-        case U'\u04D4': return U'\u04D5';
-        case U'\u04D6': return U'\u04D7';
-        case U'\u04D8': return U'\u04D9';
-        case U'\u04DA': return U'\u04DB';
-        case U'\u04DC': return U'\u04DD';
-        case U'\u04DE': return U'\u04DF';
-        case U'\u04E0': return U'\u04E1';
-        case U'\u04E2': return U'\u04E3';
-        case U'\u04E4': return U'\u04E5';
-        case U'\u04E6': return U'\u04E7';
-        case U'\u04E8': return U'\u04E9';
-        case U'\u04EA': return U'\u04EB';
-        case U'\u04EC': return U'\u04ED';
-        case U'\u04EE': return U'\u04EF';
-        case U'\u04F0': return U'\u04F1';
-        case U'\u04F2': return U'\u04F3';
-        case U'\u04F4': return U'\u04F5';
-        case U'\u04F6': return U'\u04F7';
-        case U'\u04F8': return U'\u04F9';
-        case U'\u04FA': return U'\u04FB';
-        case U'\u04FC': return U'\u04FD';
-        case U'\u04FE': return U'\u04FF';
-        case U'\u0500': return U'\u0501';
-        case U'\u0502': return U'\u0503';
-        case U'\u0504': return U'\u0505';
-        case U'\u0506': return U'\u0507';
-        case U'\u0508': return U'\u0509';
-        case U'\u050A': return U'\u050B';
-        case U'\u050C': return U'\u050D';
-        case U'\u050E': return U'\u050F';
-        case U'\u0510': return U'\u0511';
-        case U'\u0512': return U'\u0513';
-        case U'\u0514': return U'\u0515';
-        case U'\u0516': return U'\u0517';
-        case U'\u0518': return U'\u0519';
-        case U'\u051A': return U'\u051B';
-        case U'\u051C': return U'\u051D';
-        case U'\u051E': return U'\u051F';
-        case U'\u0520': return U'\u0521';
-        case U'\u0522': return U'\u0523';
-        case U'\u0524': return U'\u0525';
-        case U'\u0526': return U'\u0527';
-        case U'\u0528': return U'\u0529';
-        case U'\u052A': return U'\u052B';
-        case U'\u052C': return U'\u052D';
-        case U'\u052E': return U'\u052F';
-        case U'\u0531': return U'\u0561';
-        case U'\u0532': return U'\u0562';
-        case U'\u0533': return U'\u0563';
-        case U'\u0534': return U'\u0564';
-        case U'\u0535': return U'\u0565';
-        case U'\u0536': return U'\u0566';
-        case U'\u0537': return U'\u0567';
-        case U'\u0538': return U'\u0568';
-        case U'\u0539': return U'\u0569';
-        case U'\u053A': return U'\u056A';
-        case U'\u053B': return U'\u056B';
-        case U'\u053C': return U'\u056C';
-        case U'\u053D': return U'\u056D';
-        case U'\u053E': return U'\u056E';
-        case U'\u053F': return U'\u056F';
-        case U'\u0540': return U'\u0570';
-        case U'\u0541': return U'\u0571';
-        case U'\u0542': return U'\u0572';
-        case U'\u0543': return U'\u0573';
-        case U'\u0544': return U'\u0574';
-        case U'\u0545': return U'\u0575';
-        case U'\u0546': return U'\u0576';
-        case U'\u0547': return U'\u0577';
-        case U'\u0548': return U'\u0578';
-        case U'\u0549': return U'\u0579';
-        case U'\u054A': return U'\u057A';
-        case U'\u054B': return U'\u057B';
-        case U'\u054C': return U'\u057C';
-        case U'\u054D': return U'\u057D';
-        case U'\u054E': return U'\u057E';
-        case U'\u054F': return U'\u057F';
-        case U'\u0550': return U'\u0580';
-        case U'\u0551': return U'\u0581';
-        case U'\u0552': return U'\u0582';
-        case U'\u0553': return U'\u0583';
-        case U'\u0554': return U'\u0584';
-        case U'\u0555': return U'\u0585';
-        case U'\u0556': return U'\u0586';
-        case U'\u10A0': return U'\u2D00';
-        case U'\u10A1': return U'\u2D01';
-        case U'\u10A2': return U'\u2D02';
-        case U'\u10A3': return U'\u2D03';
-        case U'\u10A4': return U'\u2D04';
-        case U'\u10A5': return U'\u2D05';
-        case U'\u10A6': return U'\u2D06';
-        case U'\u10A7': return U'\u2D07';
-        case U'\u10A8': return U'\u2D08';
-        case U'\u10A9': return U'\u2D09';
-        case U'\u10AA': return U'\u2D0A';
-        case U'\u10AB': return U'\u2D0B';
-        case U'\u10AC': return U'\u2D0C';
-        case U'\u10AD': return U'\u2D0D';
-        case U'\u10AE': return U'\u2D0E';
-        case U'\u10AF': return U'\u2D0F';
-        case U'\u10B0': return U'\u2D10';
-        case U'\u10B1': return U'\u2D11';
-        case U'\u10B2': return U'\u2D12';
-        case U'\u10B3': return U'\u2D13';
-        case U'\u10B4': return U'\u2D14';
-        case U'\u10B5': return U'\u2D15';
-        case U'\u10B6': return U'\u2D16';
-        case U'\u10B7': return U'\u2D17';
-        case U'\u10B8': return U'\u2D18';
-        case U'\u10B9': return U'\u2D19';
-        case U'\u10BA': return U'\u2D1A';
-        case U'\u10BB': return U'\u2D1B';
-        case U'\u10BC': return U'\u2D1C';
-        case U'\u10BD': return U'\u2D1D';
-        case U'\u10BE': return U'\u2D1E';
-        case U'\u10BF': return U'\u2D1F';
-        case U'\u10C0': return U'\u2D20';
-        case U'\u10C1': return U'\u2D21';
-        case U'\u10C2': return U'\u2D22';
-        case U'\u10C3': return U'\u2D23';
-        case U'\u10C4': return U'\u2D24';
-        case U'\u10C5': return U'\u2D25';
-        case U'\u10C7': return U'\u2D27';
-        case U'\u10CD': return U'\u2D2D';
-        case U'\u13F8': return U'\u13F0';
-        case U'\u13F9': return U'\u13F1';
-        case U'\u13FA': return U'\u13F2';
-        case U'\u13FB': return U'\u13F3';
-        case U'\u13FC': return U'\u13F4';
-        case U'\u13FD': return U'\u13F5';
-        case U'\u1C80': return U'\u0432';
-        case U'\u1C81': return U'\u0434';
-        case U'\u1C82': return U'\u043E';
-        case U'\u1C83': return U'\u0441';
-        case U'\u1C84': return U'\u0442';
-        case U'\u1C85': return U'\u0442';
-        case U'\u1C86': return U'\u044A';
-        case U'\u1C87': return U'\u0463';
-        case U'\u1C88': return U'\uA64B';
-        case U'\u1C89': return U'\u1C8A';
-        case U'\u1C90': return U'\u10D0';
-        case U'\u1C91': return U'\u10D1';
-        case U'\u1C92': return U'\u10D2';
-        case U'\u1C93': return U'\u10D3';
-        case U'\u1C94': return U'\u10D4';
-        case U'\u1C95': return U'\u10D5';
-        case U'\u1C96': return U'\u10D6';
-        case U'\u1C97': return U'\u10D7';
-        case U'\u1C98': return U'\u10D8';
-        case U'\u1C99': return U'\u10D9';
-        case U'\u1C9A': return U'\u10DA';
-        case U'\u1C9B': return U'\u10DB';
-        case U'\u1C9C': return U'\u10DC';
-        case U'\u1C9D': return U'\u10DD';
-        case U'\u1C9E': return U'\u10DE';
-        case U'\u1C9F': return U'\u10DF';
-        case U'\u1CA0': return U'\u10E0';
-        case U'\u1CA1': return U'\u10E1';
-        case U'\u1CA2': return U'\u10E2';
-        case U'\u1CA3': return U'\u10E3';
-        case U'\u1CA4': return U'\u10E4';
-        case U'\u1CA5': return U'\u10E5';
-        case U'\u1CA6': return U'\u10E6';
-        case U'\u1CA7': return U'\u10E7';
-        case U'\u1CA8': return U'\u10E8';
-        case U'\u1CA9': return U'\u10E9';
-        case U'\u1CAA': return U'\u10EA';
-        case U'\u1CAB': return U'\u10EB';
-        case U'\u1CAC': return U'\u10EC';
-        case U'\u1CAD': return U'\u10ED';
-        case U'\u1CAE': return U'\u10EE';
-        case U'\u1CAF': return U'\u10EF';
-        case U'\u1CB0': return U'\u10F0';
-        case U'\u1CB1': return U'\u10F1';
-        case U'\u1CB2': return U'\u10F2';
-        case U'\u1CB3': return U'\u10F3';
-        case U'\u1CB4': return U'\u10F4';
-        case U'\u1CB5': return U'\u10F5';
-        case U'\u1CB6': return U'\u10F6';
-        case U'\u1CB7': return U'\u10F7';
-        case U'\u1CB8': return U'\u10F8';
-        case U'\u1CB9': return U'\u10F9';
-        case U'\u1CBA': return U'\u10FA';
-        case U'\u1CBD': return U'\u10FD';
-        case U'\u1CBE': return U'\u10FE';
-        case U'\u1CBF': return U'\u10FF';
-        case U'\u1E00': return U'\u1E01';
-        case U'\u1E02': return U'\u1E03';
-        case U'\u1E04': return U'\u1E05';
-        case U'\u1E06': return U'\u1E07';
-        case U'\u1E08': return U'\u1E09';
-        case U'\u1E0A': return U'\u1E0B';
-        case U'\u1E0C': return U'\u1E0D';
-        case U'\u1E0E': return U'\u1E0F';
-        case U'\u1E10': return U'\u1E11';
-        case U'\u1E12': return U'\u1E13';
-        case U'\u1E14': return U'\u1E15';
-        case U'\u1E16': return U'\u1E17';
-        case U'\u1E18': return U'\u1E19';
-        case U'\u1E1A': return U'\u1E1B';
-        case U'\u1E1C': return U'\u1E1D';
-        case U'\u1E1E': return U'\u1E1F';
-        case U'\u1E20': return U'\u1E21';
-        case U'\u1E22': return U'\u1E23';
-        case U'\u1E24': return U'\u1E25';
-        case U'\u1E26': return U'\u1E27';
-        case U'\u1E28': return U'\u1E29';
-        case U'\u1E2A': return U'\u1E2B';
-        case U'\u1E2C': return U'\u1E2D';
-        case U'\u1E2E': return U'\u1E2F';
-        case U'\u1E30': return U'\u1E31';
-        case U'\u1E32': return U'\u1E33';
-        case U'\u1E34': return U'\u1E35';
-        case U'\u1E36': return U'\u1E37';
-        case U'\u1E38': return U'\u1E39';
-        case U'\u1E3A': return U'\u1E3B';
-        case U'\u1E3C': return U'\u1E3D';
-        case U'\u1E3E': return U'\u1E3F';
-        case U'\u1E40': return U'\u1E41';
-        case U'\u1E42': return U'\u1E43';
-        case U'\u1E44': return U'\u1E45';
-        case U'\u1E46': return U'\u1E47';
-        case U'\u1E48': return U'\u1E49';
-        case U'\u1E4A': return U'\u1E4B';
-        case U'\u1E4C': return U'\u1E4D';
-        case U'\u1E4E': return U'\u1E4F';
-        case U'\u1E50': return U'\u1E51';
-        case U'\u1E52': return U'\u1E53';
-        case U'\u1E54': return U'\u1E55';
-        case U'\u1E56': return U'\u1E57';
-        case U'\u1E58': return U'\u1E59';
-        case U'\u1E5A': return U'\u1E5B';
-        case U'\u1E5C': return U'\u1E5D';
-        case U'\u1E5E': return U'\u1E5F';
-        case U'\u1E60': return U'\u1E61';
-        case U'\u1E62': return U'\u1E63';
-        case U'\u1E64': return U'\u1E65';
-        case U'\u1E66': return U'\u1E67';
-        case U'\u1E68': return U'\u1E69';
-        case U'\u1E6A': return U'\u1E6B';
-        case U'\u1E6C': return U'\u1E6D';
-        case U'\u1E6E': return U'\u1E6F';
-        case U'\u1E70': return U'\u1E71';
-        case U'\u1E72': return U'\u1E73';
-        case U'\u1E74': return U'\u1E75';
-        case U'\u1E76': return U'\u1E77';
-        case U'\u1E78': return U'\u1E79';
-        case U'\u1E7A': return U'\u1E7B';
-        case U'\u1E7C': return U'\u1E7D';
-        case U'\u1E7E': return U'\u1E7F';
-        case U'\u1E80': return U'\u1E81';
-        case U'\u1E82': return U'\u1E83';
-        case U'\u1E84': return U'\u1E85';
-        case U'\u1E86': return U'\u1E87';
-        case U'\u1E88': return U'\u1E89';
-        case U'\u1E8A': return U'\u1E8B';
-        case U'\u1E8C': return U'\u1E8D';
-        case U'\u1E8E': return U'\u1E8F';
-        case U'\u1E90': return U'\u1E91';
-        case U'\u1E92': return U'\u1E93';
-        case U'\u1E94': return U'\u1E95';
-        case U'\u1E9B': return U'\u1E61';
-        case U'\u1E9E': return U'\u00DF';
-        case U'\u1EA0': return U'\u1EA1';
-        case U'\u1EA2': return U'\u1EA3';
-        case U'\u1EA4': return U'\u1EA5';
-        case U'\u1EA6': return U'\u1EA7';
-        case U'\u1EA8': return U'\u1EA9';
-        case U'\u1EAA': return U'\u1EAB';
-        case U'\u1EAC': return U'\u1EAD';
-        case U'\u1EAE': return U'\u1EAF';
-        case U'\u1EB0': return U'\u1EB1';
-        case U'\u1EB2': return U'\u1EB3';
-        case U'\u1EB4': return U'\u1EB5';
-        case U'\u1EB6': return U'\u1EB7';
-        case U'\u1EB8': return U'\u1EB9';
-        case U'\u1EBA': return U'\u1EBB';
-        case U'\u1EBC': return U'\u1EBD';
-        case U'\u1EBE': return U'\u1EBF';
-        case U'\u1EC0': return U'\u1EC1';
-        case U'\u1EC2': return U'\u1EC3';
-        case U'\u1EC4': return U'\u1EC5';
-        case U'\u1EC6': return U'\u1EC7';
-        case U'\u1EC8': return U'\u1EC9';
-        case U'\u1ECA': return U'\u1ECB';
-        case U'\u1ECC': return U'\u1ECD';
-        case U'\u1ECE': return U'\u1ECF';
-        case U'\u1ED0': return U'\u1ED1';
-        case U'\u1ED2': return U'\u1ED3';
-        case U'\u1ED4': return U'\u1ED5';
-        case U'\u1ED6': return U'\u1ED7';
-        case U'\u1ED8': return U'\u1ED9';
-        case U'\u1EDA': return U'\u1EDB';
-        case U'\u1EDC': return U'\u1EDD';
-        case U'\u1EDE': return U'\u1EDF';
-        case U'\u1EE0': return U'\u1EE1';
-        case U'\u1EE2': return U'\u1EE3';
-        case U'\u1EE4': return U'\u1EE5';
-        case U'\u1EE6': return U'\u1EE7';
-        case U'\u1EE8': return U'\u1EE9';
-        case U'\u1EEA': return U'\u1EEB';
-        case U'\u1EEC': return U'\u1EED';
-        case U'\u1EEE': return U'\u1EEF';
-        case U'\u1EF0': return U'\u1EF1';
-        case U'\u1EF2': return U'\u1EF3';
-        case U'\u1EF4': return U'\u1EF5';
-        case U'\u1EF6': return U'\u1EF7';
-        case U'\u1EF8': return U'\u1EF9';
-        case U'\u1EFA': return U'\u1EFB';
-        case U'\u1EFC': return U'\u1EFD';
-        case U'\u1EFE': return U'\u1EFF';
-        case U'\u1F08': return U'\u1F00';
-        case U'\u1F09': return U'\u1F01';
-        case U'\u1F0A': return U'\u1F02';
-        case U'\u1F0B': return U'\u1F03';
-        case U'\u1F0C': return U'\u1F04';
-        case U'\u1F0D': return U'\u1F05';
-        case U'\u1F0E': return U'\u1F06';
-        case U'\u1F0F': return U'\u1F07';
-        case U'\u1F18': return U'\u1F10';
-        case U'\u1F19': return U'\u1F11';
-        case U'\u1F1A': return U'\u1F12';
-        case U'\u1F1B': return U'\u1F13';
-        case U'\u1F1C': return U'\u1F14';
-        case U'\u1F1D': return U'\u1F15';
-        case U'\u1F28': return U'\u1F20';
-        case U'\u1F29': return U'\u1F21';
-        case U'\u1F2A': return U'\u1F22';
-        case U'\u1F2B': return U'\u1F23';
-        case U'\u1F2C': return U'\u1F24';
-        case U'\u1F2D': return U'\u1F25';
-        case U'\u1F2E': return U'\u1F26';
-        case U'\u1F2F': return U'\u1F27';
-        case U'\u1F38': return U'\u1F30';
-        case U'\u1F39': return U'\u1F31';
-        case U'\u1F3A': return U'\u1F32';
-        case U'\u1F3B': return U'\u1F33';
-        case U'\u1F3C': return U'\u1F34';
-        case U'\u1F3D': return U'\u1F35';
-        case U'\u1F3E': return U'\u1F36';
-        case U'\u1F3F': return U'\u1F37';
-        case U'\u1F48': return U'\u1F40';
-        case U'\u1F49': return U'\u1F41';
-        case U'\u1F4A': return U'\u1F42';
-        case U'\u1F4B': return U'\u1F43';
-        case U'\u1F4C': return U'\u1F44';
-        case U'\u1F4D': return U'\u1F45';
-        case U'\u1F59': return U'\u1F51';
-        case U'\u1F5B': return U'\u1F53';
-        case U'\u1F5D': return U'\u1F55';
-        case U'\u1F5F': return U'\u1F57';
-        case U'\u1F68': return U'\u1F60';
-        case U'\u1F69': return U'\u1F61';
-        case U'\u1F6A': return U'\u1F62';
-        case U'\u1F6B': return U'\u1F63';
-        case U'\u1F6C': return U'\u1F64';
-        case U'\u1F6D': return U'\u1F65';
-        case U'\u1F6E': return U'\u1F66';
-        case U'\u1F6F': return U'\u1F67';
-        case U'\u1F88': return U'\u1F80';
-        case U'\u1F89': return U'\u1F81';
-        case U'\u1F8A': return U'\u1F82';
-        case U'\u1F8B': return U'\u1F83';
-        case U'\u1F8C': return U'\u1F84';
-        case U'\u1F8D': return U'\u1F85';
-        case U'\u1F8E': return U'\u1F86';
-        case U'\u1F8F': return U'\u1F87';
-        case U'\u1F98': return U'\u1F90';
-        case U'\u1F99': return U'\u1F91';
-        case U'\u1F9A': return U'\u1F92';
-        case U'\u1F9B': return U'\u1F93';
-        case U'\u1F9C': return U'\u1F94';
-        case U'\u1F9D': return U'\u1F95';
-        case U'\u1F9E': return U'\u1F96';
-        case U'\u1F9F': return U'\u1F97';
-        case U'\u1FA8': return U'\u1FA0';
-        case U'\u1FA9': return U'\u1FA1';
-        case U'\u1FAA': return U'\u1FA2';
-        case U'\u1FAB': return U'\u1FA3';
-        case U'\u1FAC': return U'\u1FA4';
-        case U'\u1FAD': return U'\u1FA5';
-        case U'\u1FAE': return U'\u1FA6';
-        case U'\u1FAF': return U'\u1FA7';
-        case U'\u1FB8': return U'\u1FB0';
-        case U'\u1FB9': return U'\u1FB1';
-        case U'\u1FBA': return U'\u1F70';
-        case U'\u1FBB': return U'\u1F71';
-        case U'\u1FBC': return U'\u1FB3';
-        case U'\u1FBE': return U'\u03B9';
-        case U'\u1FC8': return U'\u1F72';
-        case U'\u1FC9': return U'\u1F73';
-        case U'\u1FCA': return U'\u1F74';
-        case U'\u1FCB': return U'\u1F75';
-        case U'\u1FCC': return U'\u1FC3';
-        case U'\u1FD3': return U'\u0390';
-        case U'\u1FD8': return U'\u1FD0';
-        case U'\u1FD9': return U'\u1FD1';
-        case U'\u1FDA': return U'\u1F76';
-        case U'\u1FDB': return U'\u1F77';
-        case U'\u1FE3': return U'\u03B0';
-        case U'\u1FE8': return U'\u1FE0';
-        case U'\u1FE9': return U'\u1FE1';
-        case U'\u1FEA': return U'\u1F7A';
-        case U'\u1FEB': return U'\u1F7B';
-        case U'\u1FEC': return U'\u1FE5';
-        case U'\u1FF8': return U'\u1F78';
-        case U'\u1FF9': return U'\u1F79';
-        case U'\u1FFA': return U'\u1F7C';
-        case U'\u1FFB': return U'\u1F7D';
-        case U'\u1FFC': return U'\u1FF3';
-        case U'\u2126': return U'\u03C9';
-        case U'\u212A': return U'\u006B';
-        case U'\u212B': return U'\u00E5';
-        case U'\u2132': return U'\u214E';
-        case U'\u2160': return U'\u2170';
-        case U'\u2161': return U'\u2171';
-        case U'\u2162': return U'\u2172';
-        case U'\u2163': return U'\u2173';
-        case U'\u2164': return U'\u2174';
-        case U'\u2165': return U'\u2175';
-        case U'\u2166': return U'\u2176';
-        case U'\u2167': return U'\u2177';
-        case U'\u2168': return U'\u2178';
-        case U'\u2169': return U'\u2179';
-        case U'\u216A': return U'\u217A';
-        case U'\u216B': return U'\u217B';
-        case U'\u216C': return U'\u217C';
-        case U'\u216D': return U'\u217D';
-        case U'\u216E': return U'\u217E';
-        case U'\u216F': return U'\u217F';
-        case U'\u2183': return U'\u2184';
-        case U'\u24B6': return U'\u24D0';
-        case U'\u24B7': return U'\u24D1';
-        case U'\u24B8': return U'\u24D2';
-        case U'\u24B9': return U'\u24D3';
-        case U'\u24BA': return U'\u24D4';
-        case U'\u24BB': return U'\u24D5';
-        case U'\u24BC': return U'\u24D6';
-        case U'\u24BD': return U'\u24D7';
-        case U'\u24BE': return U'\u24D8';
-        case U'\u24BF': return U'\u24D9';
-        case U'\u24C0': return U'\u24DA';
-        case U'\u24C1': return U'\u24DB';
-        case U'\u24C2': return U'\u24DC';
-        case U'\u24C3': return U'\u24DD';
-        case U'\u24C4': return U'\u24DE';
-        case U'\u24C5': return U'\u24DF';
-        case U'\u24C6': return U'\u24E0';
-        case U'\u24C7': return U'\u24E1';
-        case U'\u24C8': return U'\u24E2';
-        case U'\u24C9': return U'\u24E3';
-        case U'\u24CA': return U'\u24E4';
-        case U'\u24CB': return U'\u24E5';
-        case U'\u24CC': return U'\u24E6';
-        case U'\u24CD': return U'\u24E7';
-        case U'\u24CE': return U'\u24E8';
-        case U'\u24CF': return U'\u24E9';
-        case U'\u2C00': return U'\u2C30';
-        case U'\u2C01': return U'\u2C31';
-        case U'\u2C02': return U'\u2C32';
-        case U'\u2C03': return U'\u2C33';
-        case U'\u2C04': return U'\u2C34';
-        case U'\u2C05': return U'\u2C35';
-        case U'\u2C06': return U'\u2C36';
-        case U'\u2C07': return U'\u2C37';
-        case U'\u2C08': return U'\u2C38';
-        case U'\u2C09': return U'\u2C39';
-        case U'\u2C0A': return U'\u2C3A';
-        case U'\u2C0B': return U'\u2C3B';
-        case U'\u2C0C': return U'\u2C3C';
-        case U'\u2C0D': return U'\u2C3D';
-        case U'\u2C0E': return U'\u2C3E';
-        case U'\u2C0F': return U'\u2C3F';
-        case U'\u2C10': return U'\u2C40';
-        case U'\u2C11': return U'\u2C41';
-        case U'\u2C12': return U'\u2C42';
-        case U'\u2C13': return U'\u2C43';
-        case U'\u2C14': return U'\u2C44';
-        case U'\u2C15': return U'\u2C45';
-        case U'\u2C16': return U'\u2C46';
-        case U'\u2C17': return U'\u2C47';
-        case U'\u2C18': return U'\u2C48';
-        case U'\u2C19': return U'\u2C49';
-        case U'\u2C1A': return U'\u2C4A';
-        case U'\u2C1B': return U'\u2C4B';
-        case U'\u2C1C': return U'\u2C4C';
-        case U'\u2C1D': return U'\u2C4D';
-        case U'\u2C1E': return U'\u2C4E';
-        case U'\u2C1F': return U'\u2C4F';
-        case U'\u2C20': return U'\u2C50';
-        case U'\u2C21': return U'\u2C51';
-        case U'\u2C22': return U'\u2C52';
-        case U'\u2C23': return U'\u2C53';
-        case U'\u2C24': return U'\u2C54';
-        case U'\u2C25': return U'\u2C55';
-        case U'\u2C26': return U'\u2C56';
-        case U'\u2C27': return U'\u2C57';
-        case U'\u2C28': return U'\u2C58';
-        case U'\u2C29': return U'\u2C59';
-        case U'\u2C2A': return U'\u2C5A';
-        case U'\u2C2B': return U'\u2C5B';
-        case U'\u2C2C': return U'\u2C5C';
-        case U'\u2C2D': return U'\u2C5D';
-        case U'\u2C2E': return U'\u2C5E';
-        case U'\u2C2F': return U'\u2C5F';
-        case U'\u2C60': return U'\u2C61';
-        case U'\u2C62': return U'\u026B';
-        case U'\u2C63': return U'\u1D7D';
-        case U'\u2C64': return U'\u027D';
-        case U'\u2C67': return U'\u2C68';
-        case U'\u2C69': return U'\u2C6A';
-        case U'\u2C6B': return U'\u2C6C';
-        case U'\u2C6D': return U'\u0251';
-        case U'\u2C6E': return U'\u0271';
-        case U'\u2C6F': return U'\u0250';
-        case U'\u2C70': return U'\u0252';
-        case U'\u2C72': return U'\u2C73';
-        case U'\u2C75': return U'\u2C76';
-        case U'\u2C7E': return U'\u023F';
-        case U'\u2C7F': return U'\u0240';
-        case U'\u2C80': return U'\u2C81';
-        case U'\u2C82': return U'\u2C83';
-        case U'\u2C84': return U'\u2C85';
-        case U'\u2C86': return U'\u2C87';
-        case U'\u2C88': return U'\u2C89';
-        case U'\u2C8A': return U'\u2C8B';
-        case U'\u2C8C': return U'\u2C8D';
-        case U'\u2C8E': return U'\u2C8F';
-        case U'\u2C90': return U'\u2C91';
-        case U'\u2C92': return U'\u2C93';
-        case U'\u2C94': return U'\u2C95';
-        case U'\u2C96': return U'\u2C97';
-        case U'\u2C98': return U'\u2C99';
-        case U'\u2C9A': return U'\u2C9B';
-        case U'\u2C9C': return U'\u2C9D';
-        case U'\u2C9E': return U'\u2C9F';
-        case U'\u2CA0': return U'\u2CA1';
-        case U'\u2CA2': return U'\u2CA3';
-        case U'\u2CA4': return U'\u2CA5';
-        case U'\u2CA6': return U'\u2CA7';
-        case U'\u2CA8': return U'\u2CA9';
-        case U'\u2CAA': return U'\u2CAB';
-        case U'\u2CAC': return U'\u2CAD';
-        case U'\u2CAE': return U'\u2CAF';
-        case U'\u2CB0': return U'\u2CB1';
-        case U'\u2CB2': return U'\u2CB3';
-        case U'\u2CB4': return U'\u2CB5';
-        case U'\u2CB6': return U'\u2CB7';
-        case U'\u2CB8': return U'\u2CB9';
-        case U'\u2CBA': return U'\u2CBB';
-        case U'\u2CBC': return U'\u2CBD';
-        case U'\u2CBE': return U'\u2CBF';
-        case U'\u2CC0': return U'\u2CC1';
-        case U'\u2CC2': return U'\u2CC3';
-        case U'\u2CC4': return U'\u2CC5';
-        case U'\u2CC6': return U'\u2CC7';
-        case U'\u2CC8': return U'\u2CC9';
-        case U'\u2CCA': return U'\u2CCB';
-        case U'\u2CCC': return U'\u2CCD';
-        case U'\u2CCE': return U'\u2CCF';
-        case U'\u2CD0': return U'\u2CD1';
-        case U'\u2CD2': return U'\u2CD3';
-        case U'\u2CD4': return U'\u2CD5';
-        case U'\u2CD6': return U'\u2CD7';
-        case U'\u2CD8': return U'\u2CD9';
-        case U'\u2CDA': return U'\u2CDB';
-        case U'\u2CDC': return U'\u2CDD';
-        case U'\u2CDE': return U'\u2CDF';
-        case U'\u2CE0': return U'\u2CE1';
-        case U'\u2CE2': return U'\u2CE3';
-        case U'\u2CEB': return U'\u2CEC';
-        case U'\u2CED': return U'\u2CEE';
-        case U'\u2CF2': return U'\u2CF3';
-        case U'\uA640': return U'\uA641';
-        case U'\uA642': return U'\uA643';
-        case U'\uA644': return U'\uA645';
-        case U'\uA646': return U'\uA647';
-        case U'\uA648': return U'\uA649';
-        case U'\uA64A': return U'\uA64B';
-        case U'\uA64C': return U'\uA64D';
-        case U'\uA64E': return U'\uA64F';
-        case U'\uA650': return U'\uA651';
-        case U'\uA652': return U'\uA653';
-        case U'\uA654': return U'\uA655';
-        case U'\uA656': return U'\uA657';
-        case U'\uA658': return U'\uA659';
-        case U'\uA65A': return U'\uA65B';
-        case U'\uA65C': return U'\uA65D';
-        case U'\uA65E': return U'\uA65F';
-        case U'\uA660': return U'\uA661';
-        case U'\uA662': return U'\uA663';
-        case U'\uA664': return U'\uA665';
-        case U'\uA666': return U'\uA667';
-        case U'\uA668': return U'\uA669';
-        case U'\uA66A': return U'\uA66B';
-        case U'\uA66C': return U'\uA66D';
-        case U'\uA680': return U'\uA681';
-        case U'\uA682': return U'\uA683';
-        case U'\uA684': return U'\uA685';
-        case U'\uA686': return U'\uA687';
-        case U'\uA688': return U'\uA689';
-        case U'\uA68A': return U'\uA68B';
-        case U'\uA68C': return U'\uA68D';
-        case U'\uA68E': return U'\uA68F';
-        case U'\uA690': return U'\uA691';
-        case U'\uA692': return U'\uA693';
-        case U'\uA694': return U'\uA695';
-        case U'\uA696': return U'\uA697';
-        case U'\uA698': return U'\uA699';
-        case U'\uA69A': return U'\uA69B';
-        case U'\uA722': return U'\uA723';
-        case U'\uA724': return U'\uA725';
-        case U'\uA726': return U'\uA727';
-        case U'\uA728': return U'\uA729';
-        case U'\uA72A': return U'\uA72B';
-        case U'\uA72C': return U'\uA72D';
-        case U'\uA72E': return U'\uA72F';
-        case U'\uA732': return U'\uA733';
-        case U'\uA734': return U'\uA735';
-        case U'\uA736': return U'\uA737';
-        case U'\uA738': return U'\uA739';
-        case U'\uA73A': return U'\uA73B';
-        case U'\uA73C': return U'\uA73D';
-        case U'\uA73E': return U'\uA73F';
-        case U'\uA740': return U'\uA741';
-        case U'\uA742': return U'\uA743';
-        case U'\uA744': return U'\uA745';
-        case U'\uA746': return U'\uA747';
-        case U'\uA748': return U'\uA749';
-        case U'\uA74A': return U'\uA74B';
-        case U'\uA74C': return U'\uA74D';
-        case U'\uA74E': return U'\uA74F';
-        case U'\uA750': return U'\uA751';
-        case U'\uA752': return U'\uA753';
-        case U'\uA754': return U'\uA755';
-        case U'\uA756': return U'\uA757';
-        case U'\uA758': return U'\uA759';
-        case U'\uA75A': return U'\uA75B';
-        case U'\uA75C': return U'\uA75D';
-        case U'\uA75E': return U'\uA75F';
-        case U'\uA760': return U'\uA761';
-        case U'\uA762': return U'\uA763';
-        case U'\uA764': return U'\uA765';
-        case U'\uA766': return U'\uA767';
-        case U'\uA768': return U'\uA769';
-        case U'\uA76A': return U'\uA76B';
-        case U'\uA76C': return U'\uA76D';
-        case U'\uA76E': return U'\uA76F';
-        case U'\uA779': return U'\uA77A';
-        case U'\uA77B': return U'\uA77C';
-        case U'\uA77D': return U'\u1D79';
-        case U'\uA77E': return U'\uA77F';
-        case U'\uA780': return U'\uA781';
-        case U'\uA782': return U'\uA783';
-        case U'\uA784': return U'\uA785';
-        case U'\uA786': return U'\uA787';
-        case U'\uA78B': return U'\uA78C';
-        case U'\uA78D': return U'\u0265';
-        case U'\uA790': return U'\uA791';
-        case U'\uA792': return U'\uA793';
-        case U'\uA796': return U'\uA797';
-        case U'\uA798': return U'\uA799';
-        case U'\uA79A': return U'\uA79B';
-        case U'\uA79C': return U'\uA79D';
-        case U'\uA79E': return U'\uA79F';
-        case U'\uA7A0': return U'\uA7A1';
-        case U'\uA7A2': return U'\uA7A3';
-        case U'\uA7A4': return U'\uA7A5';
-        case U'\uA7A6': return U'\uA7A7';
-        case U'\uA7A8': return U'\uA7A9';
-        case U'\uA7AA': return U'\u0266';
-        case U'\uA7AB': return U'\u025C';
-        case U'\uA7AC': return U'\u0261';
-        case U'\uA7AD': return U'\u026C';
-        case U'\uA7AE': return U'\u026A';
-        case U'\uA7B0': return U'\u029E';
-        case U'\uA7B1': return U'\u0287';
-        case U'\uA7B2': return U'\u029D';
-        case U'\uA7B3': return U'\uAB53';
-        case U'\uA7B4': return U'\uA7B5';
-        case U'\uA7B6': return U'\uA7B7';
-        case U'\uA7B8': return U'\uA7B9';
-        case U'\uA7BA': return U'\uA7BB';
-        case U'\uA7BC': return U'\uA7BD';
-        case U'\uA7BE': return U'\uA7BF';
-        case U'\uA7C0': return U'\uA7C1';
-        case U'\uA7C2': return U'\uA7C3';
-        case U'\uA7C4': return U'\uA794';
-        case U'\uA7C5': return U'\u0282';
-        case U'\uA7C6': return U'\u1D8E';
-        case U'\uA7C7': return U'\uA7C8';
-        case U'\uA7C9': return U'\uA7CA';
-        case U'\uA7CB': return U'\u0264';
-        case U'\uA7CC': return U'\uA7CD';
-        case U'\uA7CE': return U'\uA7CF';
-        case U'\uA7D0': return U'\uA7D1';
-        case U'\uA7D2': return U'\uA7D3';
-        case U'\uA7D4': return U'\uA7D5';
-        case U'\uA7D6': return U'\uA7D7';
-        case U'\uA7D8': return U'\uA7D9';
-        case U'\uA7DA': return U'\uA7DB';
-        case U'\uA7DC': return U'\u019B';
-        case U'\uA7F5': return U'\uA7F6';
-        case U'\uAB70': return U'\u13A0';
-        case U'\uAB71': return U'\u13A1';
-        case U'\uAB72': return U'\u13A2';
-        case U'\uAB73': return U'\u13A3';
-        case U'\uAB74': return U'\u13A4';
-        case U'\uAB75': return U'\u13A5';
-        case U'\uAB76': return U'\u13A6';
-        case U'\uAB77': return U'\u13A7';
-        case U'\uAB78': return U'\u13A8';
-        case U'\uAB79': return U'\u13A9';
-        case U'\uAB7A': return U'\u13AA';
-        case U'\uAB7B': return U'\u13AB';
-        case U'\uAB7C': return U'\u13AC';
-        case U'\uAB7D': return U'\u13AD';
-        case U'\uAB7E': return U'\u13AE';
-        case U'\uAB7F': return U'\u13AF';
-        case U'\uAB80': return U'\u13B0';
-        case U'\uAB81': return U'\u13B1';
-        case U'\uAB82': return U'\u13B2';
-        case U'\uAB83': return U'\u13B3';
-        case U'\uAB84': return U'\u13B4';
-        case U'\uAB85': return U'\u13B5';
-        case U'\uAB86': return U'\u13B6';
-        case U'\uAB87': return U'\u13B7';
-        case U'\uAB88': return U'\u13B8';
-        case U'\uAB89': return U'\u13B9';
-        case U'\uAB8A': return U'\u13BA';
-        case U'\uAB8B': return U'\u13BB';
-        case U'\uAB8C': return U'\u13BC';
-        case U'\uAB8D': return U'\u13BD';
-        case U'\uAB8E': return U'\u13BE';
-        case U'\uAB8F': return U'\u13BF';
-        case U'\uAB90': return U'\u13C0';
-        case U'\uAB91': return U'\u13C1';
-        case U'\uAB92': return U'\u13C2';
-        case U'\uAB93': return U'\u13C3';
-        case U'\uAB94': return U'\u13C4';
-        case U'\uAB95': return U'\u13C5';
-        case U'\uAB96': return U'\u13C6';
-        case U'\uAB97': return U'\u13C7';
-        case U'\uAB98': return U'\u13C8';
-        case U'\uAB99': return U'\u13C9';
-        case U'\uAB9A': return U'\u13CA';
-        case U'\uAB9B': return U'\u13CB';
-        case U'\uAB9C': return U'\u13CC';
-        case U'\uAB9D': return U'\u13CD';
-        case U'\uAB9E': return U'\u13CE';
-        case U'\uAB9F': return U'\u13CF';
-        case U'\uABA0': return U'\u13D0';
-        case U'\uABA1': return U'\u13D1';
-        case U'\uABA2': return U'\u13D2';
-        case U'\uABA3': return U'\u13D3';
-        case U'\uABA4': return U'\u13D4';
-        case U'\uABA5': return U'\u13D5';
-        case U'\uABA6': return U'\u13D6';
-        case U'\uABA7': return U'\u13D7';
-        case U'\uABA8': return U'\u13D8';
-        case U'\uABA9': return U'\u13D9';
-        case U'\uABAA': return U'\u13DA';
-        case U'\uABAB': return U'\u13DB';
-        case U'\uABAC': return U'\u13DC';
-        case U'\uABAD': return U'\u13DD';
-        case U'\uABAE': return U'\u13DE';
-        case U'\uABAF': return U'\u13DF';
-        case U'\uABB0': return U'\u13E0';
-        case U'\uABB1': return U'\u13E1';
-        case U'\uABB2': return U'\u13E2';
-        case U'\uABB3': return U'\u13E3';
-        case U'\uABB4': return U'\u13E4';
-        case U'\uABB5': return U'\u13E5';
-        case U'\uABB6': return U'\u13E6';
-        case U'\uABB7': return U'\u13E7';
-        case U'\uABB8': return U'\u13E8';
-        case U'\uABB9': return U'\u13E9';
-        case U'\uABBA': return U'\u13EA';
-        case U'\uABBB': return U'\u13EB';
-        case U'\uABBC': return U'\u13EC';
-        case U'\uABBD': return U'\u13ED';
-        case U'\uABBE': return U'\u13EE';
-        case U'\uABBF': return U'\u13EF';
-        case U'\uFB05': return U'\uFB06';
-        case U'\uFF21': return U'\uFF41';
-        case U'\uFF22': return U'\uFF42';
-        case U'\uFF23': return U'\uFF43';
-        case U'\uFF24': return U'\uFF44';
-        case U'\uFF25': return U'\uFF45';
-        case U'\uFF26': return U'\uFF46';
-        case U'\uFF27': return U'\uFF47';
-        case U'\uFF28': return U'\uFF48';
-        case U'\uFF29': return U'\uFF49';
-        case U'\uFF2A': return U'\uFF4A';
-        case U'\uFF2B': return U'\uFF4B';
-        case U'\uFF2C': return U'\uFF4C';
-        case U'\uFF2D': return U'\uFF4D';
-        case U'\uFF2E': return U'\uFF4E';
-        case U'\uFF2F': return U'\uFF4F';
-        case U'\uFF30': return U'\uFF50';
-        case U'\uFF31': return U'\uFF51';
-        case U'\uFF32': return U'\uFF52';
-        case U'\uFF33': return U'\uFF53';
-        case U'\uFF34': return U'\uFF54';
-        case U'\uFF35': return U'\uFF55';
-        case U'\uFF36': return U'\uFF56';
-        case U'\uFF37': return U'\uFF57';
-        case U'\uFF38': return U'\uFF58';
-        case U'\uFF39': return U'\uFF59';
-        case U'\uFF3A': return U'\uFF5A';
-        case U'\U00010400': return U'\U00010428';
-        case U'\U00010401': return U'\U00010429';
-        case U'\U00010402': return U'\U0001042A';
-        case U'\U00010403': return U'\U0001042B';
-        case U'\U00010404': return U'\U0001042C';
-        case U'\U00010405': return U'\U0001042D';
-        case U'\U00010406': return U'\U0001042E';
-        case U'\U00010407': return U'\U0001042F';
-        case U'\U00010408': return U'\U00010430';
-        case U'\U00010409': return U'\U00010431';
-        case U'\U0001040A': return U'\U00010432';
-        case U'\U0001040B': return U'\U00010433';
-        case U'\U0001040C': return U'\U00010434';
-        case U'\U0001040D': return U'\U00010435';
-        case U'\U0001040E': return U'\U00010436';
-        case U'\U0001040F': return U'\U00010437';
-        case U'\U00010410': return U'\U00010438';
-        case U'\U00010411': return U'\U00010439';
-        case U'\U00010412': return U'\U0001043A';
-        case U'\U00010413': return U'\U0001043B';
-        case U'\U00010414': return U'\U0001043C';
-        case U'\U00010415': return U'\U0001043D';
-        case U'\U00010416': return U'\U0001043E';
-        case U'\U00010417': return U'\U0001043F';
-        case U'\U00010418': return U'\U00010440';
-        case U'\U00010419': return U'\U00010441';
-        case U'\U0001041A': return U'\U00010442';
-        case U'\U0001041B': return U'\U00010443';
-        case U'\U0001041C': return U'\U00010444';
-        case U'\U0001041D': return U'\U00010445';
-        case U'\U0001041E': return U'\U00010446';
-        case U'\U0001041F': return U'\U00010447';
-        case U'\U00010420': return U'\U00010448';
-        case U'\U00010421': return U'\U00010449';
-        case U'\U00010422': return U'\U0001044A';
-        case U'\U00010423': return U'\U0001044B';
-        case U'\U00010424': return U'\U0001044C';
-        case U'\U00010425': return U'\U0001044D';
-        case U'\U00010426': return U'\U0001044E';
-        case U'\U00010427': return U'\U0001044F';
-        case U'\U000104B0': return U'\U000104D8';
-        case U'\U000104B1': return U'\U000104D9';
-        case U'\U000104B2': return U'\U000104DA';
-        case U'\U000104B3': return U'\U000104DB';
-        case U'\U000104B4': return U'\U000104DC';
-        case U'\U000104B5': return U'\U000104DD';
-        case U'\U000104B6': return U'\U000104DE';
-        case U'\U000104B7': return U'\U000104DF';
-        case U'\U000104B8': return U'\U000104E0';
-        case U'\U000104B9': return U'\U000104E1';
-        case U'\U000104BA': return U'\U000104E2';
-        case U'\U000104BB': return U'\U000104E3';
-        case U'\U000104BC': return U'\U000104E4';
-        case U'\U000104BD': return U'\U000104E5';
-        case U'\U000104BE': return U'\U000104E6';
-        case U'\U000104BF': return U'\U000104E7';
-        case U'\U000104C0': return U'\U000104E8';
-        case U'\U000104C1': return U'\U000104E9';
-        case U'\U000104C2': return U'\U000104EA';
-        case U'\U000104C3': return U'\U000104EB';
-        case U'\U000104C4': return U'\U000104EC';
-        case U'\U000104C5': return U'\U000104ED';
-        case U'\U000104C6': return U'\U000104EE';
-        case U'\U000104C7': return U'\U000104EF';
-        case U'\U000104C8': return U'\U000104F0';
-        case U'\U000104C9': return U'\U000104F1';
-        case U'\U000104CA': return U'\U000104F2';
-        case U'\U000104CB': return U'\U000104F3';
-        case U'\U000104CC': return U'\U000104F4';
-        case U'\U000104CD': return U'\U000104F5';
-        case U'\U000104CE': return U'\U000104F6';
-        case U'\U000104CF': return U'\U000104F7';
-        case U'\U000104D0': return U'\U000104F8';
-        case U'\U000104D1': return U'\U000104F9';
-        case U'\U000104D2': return U'\U000104FA';
-        case U'\U000104D3': return U'\U000104FB';
-        case U'\U00010570': return U'\U00010597';
-        case U'\U00010571': return U'\U00010598';
-        case U'\U00010572': return U'\U00010599';
-        case U'\U00010573': return U'\U0001059A';
-        case U'\U00010574': return U'\U0001059B';
-        case U'\U00010575': return U'\U0001059C';
-        case U'\U00010576': return U'\U0001059D';
-        case U'\U00010577': return U'\U0001059E';
-        case U'\U00010578': return U'\U0001059F';
-        case U'\U00010579': return U'\U000105A0';
-        case U'\U0001057A': return U'\U000105A1';
-        case U'\U0001057C': return U'\U000105A3';
-        case U'\U0001057D': return U'\U000105A4';
-        case U'\U0001057E': return U'\U000105A5';
-        case U'\U0001057F': return U'\U000105A6';
-        case U'\U00010580': return U'\U000105A7';
-        case U'\U00010581': return U'\U000105A8';
-        case U'\U00010582': return U'\U000105A9';
-        case U'\U00010583': return U'\U000105AA';
-        case U'\U00010584': return U'\U000105AB';
-        case U'\U00010585': return U'\U000105AC';
-        case U'\U00010586': return U'\U000105AD';
-        case U'\U00010587': return U'\U000105AE';
-        case U'\U00010588': return U'\U000105AF';
-        case U'\U00010589': return U'\U000105B0';
-        case U'\U0001058A': return U'\U000105B1';
-        case U'\U0001058C': return U'\U000105B3';
-        case U'\U0001058D': return U'\U000105B4';
-        case U'\U0001058E': return U'\U000105B5';
-        case U'\U0001058F': return U'\U000105B6';
-        case U'\U00010590': return U'\U000105B7';
-        case U'\U00010591': return U'\U000105B8';
-        case U'\U00010592': return U'\U000105B9';
-        case U'\U00010594': return U'\U000105BB';
-        case U'\U00010595': return U'\U000105BC';
-        case U'\U00010C80': return U'\U00010CC0';
-        case U'\U00010C81': return U'\U00010CC1';
-        case U'\U00010C82': return U'\U00010CC2';
-        case U'\U00010C83': return U'\U00010CC3';
-        case U'\U00010C84': return U'\U00010CC4';
-        case U'\U00010C85': return U'\U00010CC5';
-        case U'\U00010C86': return U'\U00010CC6';
-        case U'\U00010C87': return U'\U00010CC7';
-        case U'\U00010C88': return U'\U00010CC8';
-        case U'\U00010C89': return U'\U00010CC9';
-        case U'\U00010C8A': return U'\U00010CCA';
-        case U'\U00010C8B': return U'\U00010CCB';
-        case U'\U00010C8C': return U'\U00010CCC';
-        case U'\U00010C8D': return U'\U00010CCD';
-        case U'\U00010C8E': return U'\U00010CCE';
-        case U'\U00010C8F': return U'\U00010CCF';
-        case U'\U00010C90': return U'\U00010CD0';
-        case U'\U00010C91': return U'\U00010CD1';
-        case U'\U00010C92': return U'\U00010CD2';
-        case U'\U00010C93': return U'\U00010CD3';
-        case U'\U00010C94': return U'\U00010CD4';
-        case U'\U00010C95': return U'\U00010CD5';
-        case U'\U00010C96': return U'\U00010CD6';
-        case U'\U00010C97': return U'\U00010CD7';
-        case U'\U00010C98': return U'\U00010CD8';
-        case U'\U00010C99': return U'\U00010CD9';
-        case U'\U00010C9A': return U'\U00010CDA';
-        case U'\U00010C9B': return U'\U00010CDB';
-        case U'\U00010C9C': return U'\U00010CDC';
-        case U'\U00010C9D': return U'\U00010CDD';
-        case U'\U00010C9E': return U'\U00010CDE';
-        case U'\U00010C9F': return U'\U00010CDF';
-        case U'\U00010CA0': return U'\U00010CE0';
-        case U'\U00010CA1': return U'\U00010CE1';
-        case U'\U00010CA2': return U'\U00010CE2';
-        case U'\U00010CA3': return U'\U00010CE3';
-        case U'\U00010CA4': return U'\U00010CE4';
-        case U'\U00010CA5': return U'\U00010CE5';
-        case U'\U00010CA6': return U'\U00010CE6';
-        case U'\U00010CA7': return U'\U00010CE7';
-        case U'\U00010CA8': return U'\U00010CE8';
-        case U'\U00010CA9': return U'\U00010CE9';
-        case U'\U00010CAA': return U'\U00010CEA';
-        case U'\U00010CAB': return U'\U00010CEB';
-        case U'\U00010CAC': return U'\U00010CEC';
-        case U'\U00010CAD': return U'\U00010CED';
-        case U'\U00010CAE': return U'\U00010CEE';
-        case U'\U00010CAF': return U'\U00010CEF';
-        case U'\U00010CB0': return U'\U00010CF0';
-        case U'\U00010CB1': return U'\U00010CF1';
-        case U'\U00010CB2': return U'\U00010CF2';
-        case U'\U00010D50': return U'\U00010D70';
-        case U'\U00010D51': return U'\U00010D71';
-        case U'\U00010D52': return U'\U00010D72';
-        case U'\U00010D53': return U'\U00010D73';
-        case U'\U00010D54': return U'\U00010D74';
-        case U'\U00010D55': return U'\U00010D75';
-        case U'\U00010D56': return U'\U00010D76';
-        case U'\U00010D57': return U'\U00010D77';
-        case U'\U00010D58': return U'\U00010D78';
-        case U'\U00010D59': return U'\U00010D79';
-        case U'\U00010D5A': return U'\U00010D7A';
-        case U'\U00010D5B': return U'\U00010D7B';
-        case U'\U00010D5C': return U'\U00010D7C';
-        case U'\U00010D5D': return U'\U00010D7D';
-        case U'\U00010D5E': return U'\U00010D7E';
-        case U'\U00010D5F': return U'\U00010D7F';
-        case U'\U00010D60': return U'\U00010D80';
-        case U'\U00010D61': return U'\U00010D81';
-        case U'\U00010D62': return U'\U00010D82';
-        case U'\U00010D63': return U'\U00010D83';
-        case U'\U00010D64': return U'\U00010D84';
-        case U'\U00010D65': return U'\U00010D85';
-        case U'\U000118A0': return U'\U000118C0';
-        case U'\U000118A1': return U'\U000118C1';
-        case U'\U000118A2': return U'\U000118C2';
-        case U'\U000118A3': return U'\U000118C3';
-        case U'\U000118A4': return U'\U000118C4';
-        case U'\U000118A5': return U'\U000118C5';
-        case U'\U000118A6': return U'\U000118C6';
-        case U'\U000118A7': return U'\U000118C7';
-        case U'\U000118A8': return U'\U000118C8';
-        case U'\U000118A9': return U'\U000118C9';
-        case U'\U000118AA': return U'\U000118CA';
-        case U'\U000118AB': return U'\U000118CB';
-        case U'\U000118AC': return U'\U000118CC';
-        case U'\U000118AD': return U'\U000118CD';
-        case U'\U000118AE': return U'\U000118CE';
-        case U'\U000118AF': return U'\U000118CF';
-        case U'\U000118B0': return U'\U000118D0';
-        case U'\U000118B1': return U'\U000118D1';
-        case U'\U000118B2': return U'\U000118D2';
-        case U'\U000118B3': return U'\U000118D3';
-        case U'\U000118B4': return U'\U000118D4';
-        case U'\U000118B5': return U'\U000118D5';
-        case U'\U000118B6': return U'\U000118D6';
-        case U'\U000118B7': return U'\U000118D7';
-        case U'\U000118B8': return U'\U000118D8';
-        case U'\U000118B9': return U'\U000118D9';
-        case U'\U000118BA': return U'\U000118DA';
-        case U'\U000118BB': return U'\U000118DB';
-        case U'\U000118BC': return U'\U000118DC';
-        case U'\U000118BD': return U'\U000118DD';
-        case U'\U000118BE': return U'\U000118DE';
-        case U'\U000118BF': return U'\U000118DF';
-        case U'\U00016E40': return U'\U00016E60';
-        case U'\U00016E41': return U'\U00016E61';
-        case U'\U00016E42': return U'\U00016E62';
-        case U'\U00016E43': return U'\U00016E63';
-        case U'\U00016E44': return U'\U00016E64';
-        case U'\U00016E45': return U'\U00016E65';
-        case U'\U00016E46': return U'\U00016E66';
-        case U'\U00016E47': return U'\U00016E67';
-        case U'\U00016E48': return U'\U00016E68';
-        case U'\U00016E49': return U'\U00016E69';
-        case U'\U00016E4A': return U'\U00016E6A';
-        case U'\U00016E4B': return U'\U00016E6B';
-        case U'\U00016E4C': return U'\U00016E6C';
-        case U'\U00016E4D': return U'\U00016E6D';
-        case U'\U00016E4E': return U'\U00016E6E';
-        case U'\U00016E4F': return U'\U00016E6F';
-        case U'\U00016E50': return U'\U00016E70';
-        case U'\U00016E51': return U'\U00016E71';
-        case U'\U00016E52': return U'\U00016E72';
-        case U'\U00016E53': return U'\U00016E73';
-        case U'\U00016E54': return U'\U00016E74';
-        case U'\U00016E55': return U'\U00016E75';
-        case U'\U00016E56': return U'\U00016E76';
-        case U'\U00016E57': return U'\U00016E77';
-        case U'\U00016E58': return U'\U00016E78';
-        case U'\U00016E59': return U'\U00016E79';
-        case U'\U00016E5A': return U'\U00016E7A';
-        case U'\U00016E5B': return U'\U00016E7B';
-        case U'\U00016E5C': return U'\U00016E7C';
-        case U'\U00016E5D': return U'\U00016E7D';
-        case U'\U00016E5E': return U'\U00016E7E';
-        case U'\U00016E5F': return U'\U00016E7F';
-        case U'\U00016EA0': return U'\U00016EBB';
-        case U'\U00016EA1': return U'\U00016EBC';
-        case U'\U00016EA2': return U'\U00016EBD';
-        case U'\U00016EA3': return U'\U00016EBE';
-        case U'\U00016EA4': return U'\U00016EBF';
-        case U'\U00016EA5': return U'\U00016EC0';
-        case U'\U00016EA6': return U'\U00016EC1';
-        case U'\U00016EA7': return U'\U00016EC2';
-        case U'\U00016EA8': return U'\U00016EC3';
-        case U'\U00016EA9': return U'\U00016EC4';
-        case U'\U00016EAA': return U'\U00016EC5';
-        case U'\U00016EAB': return U'\U00016EC6';
-        case U'\U00016EAC': return U'\U00016EC7';
-        case U'\U00016EAD': return U'\U00016EC8';
-        case U'\U00016EAE': return U'\U00016EC9';
-        case U'\U00016EAF': return U'\U00016ECA';
-        case U'\U00016EB0': return U'\U00016ECB';
-        case U'\U00016EB1': return U'\U00016ECC';
-        case U'\U00016EB2': return U'\U00016ECD';
-        case U'\U00016EB3': return U'\U00016ECE';
-        case U'\U00016EB4': return U'\U00016ECF';
-        case U'\U00016EB5': return U'\U00016ED0';
-        case U'\U00016EB6': return U'\U00016ED1';
-        case U'\U00016EB7': return U'\U00016ED2';
-        case U'\U00016EB8': return U'\U00016ED3';
-        case U'\U0001E900': return U'\U0001E922';
-        case U'\U0001E901': return U'\U0001E923';
-        case U'\U0001E902': return U'\U0001E924';
-        case U'\U0001E903': return U'\U0001E925';
-        case U'\U0001E904': return U'\U0001E926';
-        case U'\U0001E905': return U'\U0001E927';
-        case U'\U0001E906': return U'\U0001E928';
-        case U'\U0001E907': return U'\U0001E929';
-        case U'\U0001E908': return U'\U0001E92A';
-        case U'\U0001E909': return U'\U0001E92B';
-        case U'\U0001E90A': return U'\U0001E92C';
-        case U'\U0001E90B': return U'\U0001E92D';
-        case U'\U0001E90C': return U'\U0001E92E';
-        case U'\U0001E90D': return U'\U0001E92F';
-        case U'\U0001E90E': return U'\U0001E930';
-        case U'\U0001E90F': return U'\U0001E931';
-        case U'\U0001E910': return U'\U0001E932';
-        case U'\U0001E911': return U'\U0001E933';
-        case U'\U0001E912': return U'\U0001E934';
-        case U'\U0001E913': return U'\U0001E935';
-        case U'\U0001E914': return U'\U0001E936';
-        case U'\U0001E915': return U'\U0001E937';
-        case U'\U0001E916': return U'\U0001E938';
-        case U'\U0001E917': return U'\U0001E939';
-        case U'\U0001E918': return U'\U0001E93A';
-        case U'\U0001E919': return U'\U0001E93B';
-        case U'\U0001E91A': return U'\U0001E93C';
-        case U'\U0001E91B': return U'\U0001E93D';
-        case U'\U0001E91C': return U'\U0001E93E';
-        case U'\U0001E91D': return U'\U0001E93F';
-        case U'\U0001E91E': return U'\U0001E940';
-        case U'\U0001E91F': return U'\U0001E941';
-        case U'\U0001E920': return U'\U0001E942';
-        case U'\U0001E921': return U'\U0001E943';
-        default: return c;
-        }
+        if (c >= casing_limit)
+            return casing_records[0];
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        const size_t block = casing_stage1[c >> casing_shift];
+        return casing_records[casing_stage2[(block << casing_shift) | (c & ((1uz << casing_shift) - 1uz))]];
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
     }
 
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool dchar_is_cased(const char32_t c) noexcept { return (dchar_casing_record(c).flags & casing_flag_cased) != 0u; }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool dchar_is_case_ignorable(const char32_t c) noexcept { return (dchar_casing_record(c).flags & casing_flag_case_ignorable) != 0u; }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool dchar_is_soft_dotted(const char32_t c) noexcept { return (dchar_casing_record(c).flags & casing_flag_soft_dotted) != 0u; }
+
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr char32_t dchar_to_lower_simple(const char32_t c) noexcept { return _as(_as(c, int_least32_t) + dchar_casing_record(c).lower_delta, char32_t); }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr char32_t dchar_to_upper_simple(const char32_t c) noexcept { return _as(_as(c, int_least32_t) + dchar_casing_record(c).upper_delta, char32_t); }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr char32_t dchar_fold_simple(const char32_t c) noexcept { return _as(_as(c, int_least32_t) + dchar_casing_record(c).fold_delta, char32_t); }
+
     /// @internal
     /// @ingroup sys_internal
     constexpr sz dchar_to_lower_special(char32_t out[], const char32_t c, const std::u8string_view lang, [[maybe_unused]] const sys::forward_casing_context& fctx,
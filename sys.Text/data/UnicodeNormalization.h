@@ -0,0 +1,2034 @@
+#pragma once
+
+/// @file UnicodeNormalization.h
+/// @brief Generated by `workflows/scripts/generate_unicode_normalization.py`.
+/// @note If this file is out of date, please regenerate it!
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#include <LanguageSupport.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Normalization properties shared by a set of codepoints.
+    /// @details Decompositions are full, already applied recursively, and index `normalization_decompositions`.
+    struct normalization_record
+    {
+        uint_least16_t canonical_offset;
+        uint_least8_t canonical_size;
+        uint_least16_t compat_offset;
+        uint_least8_t compat_size;
+        uint_least8_t flags;
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Primary composite `composite` of the canonical pair `first`, `second`.
+    struct normalization_composition
+    {
+        char32_t first;
+        char32_t second;
+        char32_t composite;
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t normalization_flag_nfd_no = 0x1u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t normalization_flag_nfkd_no = 0x2u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t normalization_flag_nfc_no = 0x4u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t normalization_flag_nfc_maybe = 0x8u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t normalization_flag_nfkc_no = 0x10u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t normalization_flag_nfkc_maybe = 0x20u;
+
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr size_t normalization_shift = 6uz;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr char32_t normalization_limit = U'\U0002FA40';
+
+    // clang-format off
+    inline constexpr normalization_record normalization_records[] = {
+        { 0u, 0u, 0u, 0u, 0x0u }, { 0u, 0u, 0u, 1u, 0x12u }, { 0u, 0u, 1u, 2u, 0x12u }, { 0u, 0u, 3u, 1u, 0x12u }, { 0u, 0u, 4u, 2u, 0x12u }, { 0u, 0u, 6u, 1u, 0x12u },
+        { 0u, 0u, 7u, 1u, 0x12u }, { 0u, 0u, 8u, 2u, 0x12u }, { 0u, 0u, 10u, 1u, 0x12u }, { 0u, 0u, 11u, 2u, 0x12u }, { 0u, 0u, 13u, 1u, 0x12u }, { 0u, 0u, 14u, 1u, 0x12u },
+        { 0u, 0u, 15u, 3u, 0x12u }, { 0u, 0u, 18u, 3u, 0x12u }, { 0u, 0u, 21u, 3u, 0x12u }, { 24u, 2u, 24u, 2u, 0x3u }, { 26u, 2u, 26u, 2u, 0x3u }, { 28u, 2u, 28u, 2u, 0x3u },
+        { 30u, 2u, 30u, 2u, 0x3u }, { 32u, 2u, 32u, 2u, 0x3u }, { 34u, 2u, 34u, 2u, 0x3u }, { 36u, 2u, 36u, 2u, 0x3u }, { 38u, 2u, 38u, 2u, 0x3u }, { 40u, 2u, 40u, 2u, 0x3u },
+        { 42u, 2u, 42u, 2u, 0x3u }, { 44u, 2u, 44u, 2u, 0x3u }, { 46u, 2u, 46u, 2u, 0x3u }, { 48u, 2u, 48u, 2u, 0x3u }, { 50u, 2u, 50u, 2u, 0x3u }, { 52u, 2u, 52u, 2u, 0x3u },
+        { 54u, 2u, 54u, 2u, 0x3u }, { 56u, 2u, 56u, 2u, 0x3u }, { 58u, 2u, 58u, 2u, 0x3u }, { 60u, 2u, 60u, 2u, 0x3u }, { 62u, 2u, 62u, 2u, 0x3u }, { 64u, 2u, 64u, 2u, 0x3u },
+        { 66u, 2u, 66u, 2u, 0x3u }, { 68u, 2u, 68u, 2u, 0x3u }, { 70u, 2u, 70u, 2u, 0x3u }, { 72u, 2u, 72u, 2u, 0x3u }, { 74u, 2u, 74u, 2u, 0x3u }, { 76u, 2u, 76u, 2u, 0x3u },
+        { 78u, 2u, 78u, 2u, 0x3u }, { 80u, 2u, 80u, 2u, 0x3u }, { 82u, 2u, 82u, 2u, 0x3u }, { 84u, 2u, 84u, 2u, 0x3u }, { 86u, 2u, 86u, 2u, 0x3u }, { 88u, 2u, 88u, 2u, 0x3u },
+        { 90u, 2u, 90u, 2u, 0x3u }, { 92u, 2u, 92u, 2u, 0x3u }, { 94u, 2u, 94u, 2u, 0x3u }, { 96u, 2u, 96u, 2u, 0x3u }, { 98u, 2u, 98u, 2u, 0x3u }, { 100u, 2u, 100u, 2u, 0x3u },
+        { 102u, 2u, 102u, 2u, 0x3u }, { 104u, 2u, 104u, 2u, 0x3u }, { 106u, 2u, 106u, 2u, 0x3u }, { 108u, 2u, 108u, 2u, 0x3u }, { 110u, 2u, 110u, 2u, 0x3u },
+        { 112u, 2u, 112u, 2u, 0x3u }, { 114u, 2u, 114u, 2u, 0x3u }, { 116u, 2u, 116u, 2u, 0x3u }, { 118u, 2u, 118u, 2u, 0x3u }, { 120u, 2u, 120u, 2u, 0x3u },
+        { 122u, 2u, 122u, 2u, 0x3u }, { 124u, 2u, 124u, 2u, 0x3u }, { 126u, 2u, 126u, 2u, 0x3u }, { 128u, 2u, 128u, 2u, 0x3u }, { 130u, 2u, 130u, 2u, 0x3u },
+        { 132u, 2u, 132u, 2u, 0x3u }, { 134u, 2u, 134u, 2u, 0x3u }, { 136u, 2u, 136u, 2u, 0x3u }, { 138u, 2u, 138u, 2u, 0x3u }, { 140u, 2u, 140u, 2u, 0x3u },
+        { 142u, 2u, 142u, 2u, 0x3u }, { 144u, 2u, 144u, 2u, 0x3u }, { 146u, 2u, 146u, 2u, 0x3u }, { 148u, 2u, 148u, 2u, 0x3u }, { 150u, 2u, 150u, 2u, 0x3u },
+        { 152u, 2u, 152u, 2u, 0x3u }, { 154u, 2u, 154u, 2u, 0x3u }, { 156u, 2u, 156u, 2u, 0x3u }, { 158u, 2u, 158u, 2u, 0x3u }, { 160u, 2u, 160u, 2u, 0x3u },
+        { 162u, 2u, 162u, 2u, 0x3u }, { 164u, 2u, 164u, 2u, 0x3u }, { 166u, 2u, 166u, 2u, 0x3u }, { 168u, 2u, 168u, 2u, 0x3u }, { 170u, 2u, 170u, 2u, 0x3u },
+        { 172u, 2u, 172u, 2u, 0x3u }, { 174u, 2u, 174u, 2u, 0x3u }, { 176u, 2u, 176u, 2u, 0x3u }, { 178u, 2u, 178u, 2u, 0x3u }, { 180u, 2u, 180u, 2u, 0x3u },
+        { 182u, 2u, 182u, 2u, 0x3u }, { 184u, 2u, 184u, 2u, 0x3u }, { 186u, 2u, 186u, 2u, 0x3u }, { 188u, 2u, 188u, 2u, 0x3u }, { 190u, 2u, 190u, 2u, 0x3u },
+        { 192u, 2u, 192u, 2u, 0x3u }, { 194u, 2u, 194u, 2u, 0x3u }, { 196u, 2u, 196u, 2u, 0x3u }, { 198u, 2u, 198u, 2u, 0x3u }, { 200u, 2u, 200u, 2u, 0x3u },
+        { 202u, 2u, 202u, 2u, 0x3u }, { 204u, 2u, 204u, 2u, 0x3u }, { 206u, 2u, 206u, 2u, 0x3u }, { 208u, 2u, 208u, 2u, 0x3u }, { 210u, 2u, 210u, 2u, 0x3u },
+        { 212u, 2u, 212u, 2u, 0x3u }, { 214u, 2u, 214u, 2u, 0x3u }, { 216u, 2u, 216u, 2u, 0x3u }, { 218u, 2u, 218u, 2u, 0x3u }, { 0u, 0u, 220u, 2u, 0x12u },
+        { 0u, 0u, 222u, 2u, 0x12u }, { 224u, 2u, 224u, 2u, 0x3u }, { 226u, 2u, 226u, 2u, 0x3u }, { 228u, 2u, 228u, 2u, 0x3u }, { 230u, 2u, 230u, 2u, 0x3u },
+        { 232u, 2u, 232u, 2u, 0x3u }, { 234u, 2u, 234u, 2u, 0x3u }, { 236u, 2u, 236u, 2u, 0x3u }, { 238u, 2u, 238u, 2u, 0x3u }, { 240u, 2u, 240u, 2u, 0x3u },
+        { 242u, 2u, 242u, 2u, 0x3u }, { 0u, 0u, 244u, 2u, 0x12u }, { 0u, 0u, 246u, 2u, 0x12u }, { 248u, 2u, 248u, 2u, 0x3u }, { 250u, 2u, 250u, 2u, 0x3u },
+        { 252u, 2u, 252u, 2u, 0x3u }, { 254u, 2u, 254u, 2u, 0x3u }, { 256u, 2u, 256u, 2u, 0x3u }, { 258u, 2u, 258u, 2u, 0x3u }, { 0u, 0u, 260u, 2u, 0x12u },
+        { 262u, 2u, 262u, 2u, 0x3u }, { 264u, 2u, 264u, 2u, 0x3u }, { 266u, 2u, 266u, 2u, 0x3u }, { 268u, 2u, 268u, 2u, 0x3u }, { 270u, 2u, 270u, 2u, 0x3u },
+        { 272u, 2u, 272u, 2u, 0x3u }, { 274u, 2u, 274u, 2u, 0x3u }, { 276u, 2u, 276u, 2u, 0x3u }, { 278u, 2u, 278u, 2u, 0x3u }, { 280u, 2u, 280u, 2u, 0x3u },
+        { 282u, 2u, 282u, 2u, 0x3u }, { 284u, 2u, 284u, 2u, 0x3u }, { 286u, 2u, 286u, 2u, 0x3u }, { 288u, 2u, 288u, 2u, 0x3u }, { 290u, 2u, 290u, 2u, 0x3u },
+        { 292u, 2u, 292u, 2u, 0x3u }, { 294u, 2u, 294u, 2u, 0x3u }, { 296u, 2u, 296u, 2u, 0x3u }, { 298u, 2u, 298u, 2u, 0x3u }, { 300u, 2u, 300u, 2u, 0x3u },
+        { 302u, 2u, 302u, 2u, 0x3u }, { 304u, 2u, 304u, 2u, 0x3u }, { 306u, 2u, 306u, 2u, 0x3u }, { 308u, 2u, 308u, 2u, 0x3u }, { 310u, 2u, 310u, 2u, 0x3u },
+        { 312u, 2u, 312u, 2u, 0x3u }, { 314u, 2u, 314u, 2u, 0x3u }, { 316u, 2u, 316u, 2u, 0x3u }, { 318u, 2u, 318u, 2u, 0x3u }, { 320u, 2u, 320u, 2u, 0x3u },
+        { 322u, 2u, 322u, 2u, 0x3u }, { 324u, 2u, 324u, 2u, 0x3u }, { 326u, 2u, 326u, 2u, 0x3u }, { 328u, 2u, 328u, 2u, 0x3u }, { 330u, 2u, 330u, 2u, 0x3u },
+        { 332u, 2u, 332u, 2u, 0x3u }, { 334u, 2u, 334u, 2u, 0x3u }, { 336u, 2u, 336u, 2u, 0x3u }, { 338u, 2u, 338u, 2u, 0x3u }, { 340u, 2u, 340u, 2u, 0x3u },
+        { 342u, 2u, 342u, 2u, 0x3u }, { 344u, 2u, 344u, 2u, 0x3u }, { 346u, 2u, 346u, 2u, 0x3u }, { 348u, 2u, 348u, 2u, 0x3u }, { 350u, 2u, 350u, 2u, 0x3u },
+        { 352u, 2u, 352u, 2u, 0x3u }, { 354u, 2u, 354u, 2u, 0x3u }, { 0u, 0u, 356u, 1u, 0x12u }, { 357u, 2u, 357u, 2u, 0x3u }, { 359u, 2u, 359u, 2u, 0x3u },
+        { 361u, 2u, 361u, 2u, 0x3u }, { 363u, 2u, 363u, 2u, 0x3u }, { 0u, 0u, 365u, 3u, 0x12u }, { 0u, 0u, 368u, 3u, 0x12u }, { 0u, 0u, 371u, 3u, 0x12u },
+        { 0u, 0u, 374u, 2u, 0x12u }, { 0u, 0u, 376u, 2u, 0x12u }, { 0u, 0u, 378u, 2u, 0x12u }, { 0u, 0u, 380u, 2u, 0x12u }, { 0u, 0u, 382u, 2u, 0x12u },
+        { 0u, 0u, 384u, 2u, 0x12u }, { 386u, 2u, 386u, 2u, 0x3u }, { 388u, 2u, 388u, 2u, 0x3u }, { 390u, 2u, 390u, 2u, 0x3u }, { 392u, 2u, 392u, 2u, 0x3u },
+        { 394u, 2u, 394u, 2u, 0x3u }, { 396u, 2u, 396u, 2u, 0x3u }, { 398u, 2u, 398u, 2u, 0x3u }, { 400u, 2u, 400u, 2u, 0x3u }, { 402u, 3u, 402u, 3u, 0x3u },
+        { 405u, 3u, 405u, 3u, 0x3u }, { 408u, 3u, 408u, 3u, 0x3u }, { 411u, 3u, 411u, 3u, 0x3u }, { 414u, 3u, 414u, 3u, 0x3u }, { 417u, 3u, 417u, 3u, 0x3u },
+        { 420u, 3u, 420u, 3u, 0x3u }, { 423u, 3u, 423u, 3u, 0x3u }, { 426u, 3u, 426u, 3u, 0x3u }, { 429u, 3u, 429u, 3u, 0x3u }, { 432u, 3u, 432u, 3u, 0x3u },
+        { 435u, 3u, 435u, 3u, 0x3u }, { 438u, 2u, 438u, 2u, 0x3u }, { 440u, 2u, 440u, 2u, 0x3u }, { 442u, 2u, 442u, 2u, 0x3u }, { 444u, 2u, 444u, 2u, 0x3u },
+        { 446u, 2u, 446u, 2u, 0x3u }, { 448u, 2u, 448u, 2u, 0x3u }, { 450u, 2u, 450u, 2u, 0x3u }, { 452u, 2u, 452u, 2u, 0x3u }, { 454u, 3u, 454u, 3u, 0x3u },
+        { 457u, 3u, 457u, 3u, 0x3u }, { 460u, 2u, 460u, 2u, 0x3u }, { 462u, 2u, 462u, 2u, 0x3u }, { 464u, 2u, 464u, 2u, 0x3u }, { 0u, 0u, 466u, 2u, 0x12u },
+        { 0u, 0u, 468u, 2u, 0x12u }, { 0u, 0u, 470u, 2u, 0x12u }, { 472u, 2u, 472u, 2u, 0x3u }, { 474u, 2u, 474u, 2u, 0x3u }, { 476u, 2u, 476u, 2u, 0x3u },
+        { 478u, 2u, 478u, 2u, 0x3u }, { 480u, 3u, 480u, 3u, 0x3u }, { 483u, 3u, 483u, 3u, 0x3u }, { 486u, 2u, 486u, 2u, 0x3u }, { 488u, 2u, 488u, 2u, 0x3u },
+        { 490u, 2u, 490u, 2u, 0x3u }, { 492u, 2u, 492u, 2u, 0x3u }, { 494u, 2u, 494u, 2u, 0x3u }, { 496u, 2u, 496u, 2u, 0x3u }, { 498u, 2u, 498u, 2u, 0x3u },
+        { 500u, 2u, 500u, 2u, 0x3u }, { 502u, 2u, 502u, 2u, 0x3u }, { 504u, 2u, 504u, 2u, 0x3u }, { 506u, 2u, 506u, 2u, 0x3u }, { 508u, 2u, 508u, 2u, 0x3u },
+        { 510u, 2u, 510u, 2u, 0x3u }, { 512u, 2u, 512u, 2u, 0x3u }, { 514u, 2u, 514u, 2u, 0x3u }, { 516u, 2u, 516u, 2u, 0x3u }, { 518u, 2u, 518u, 2u, 0x3u },
+        { 520u, 2u, 520u, 2u, 0x3u }, { 522u, 2u, 522u, 2u, 0x3u }, { 524u, 2u, 524u, 2u, 0x3u }, { 526u, 2u, 526u, 2u, 0x3u }, { 528u, 2u, 528u, 2u, 0x3u },
+        { 530u, 2u, 530u, 2u, 0x3u }, { 532u, 2u, 532u, 2u, 0x3u }, { 534u, 2u, 534u, 2u, 0x3u }, { 536u, 2u, 536u, 2u, 0x3u }, { 538u, 2u, 538u, 2u, 0x3u },
+        { 540u, 2u, 540u, 2u, 0x3u }, { 542u, 2u, 542u, 2u, 0x3u }, { 544u, 2u, 544u, 2u, 0x3u }, { 546u, 2u, 546u, 2u, 0x3u }, { 548u, 2u, 548u, 2u, 0x3u },
+        { 550u, 2u, 550u, 2u, 0x3u }, { 552u, 2u, 552u, 2u, 0x3u }, { 554u, 2u, 554u, 2u, 0x3u }, { 556u, 2u, 556u, 2u, 0x3u }, { 558u, 2u, 558u, 2u, 0x3u },
+        { 560u, 2u, 560u, 2u, 0x3u }, { 562u, 3u, 562u, 3u, 0x3u }, { 565u, 3u, 565u, 3u, 0x3u }, { 568u, 3u, 568u, 3u, 0x3u }, { 571u, 3u, 571u, 3u, 0x3u },
+        { 574u, 2u, 574u, 2u, 0x3u }, { 576u, 2u, 576u, 2u, 0x3u }, { 578u, 3u, 578u, 3u, 0x3u }, { 581u, 3u, 581u, 3u, 0x3u }, { 584u, 2u, 584u, 2u, 0x3u },
+        { 586u, 2u, 586u, 2u, 0x3u }, { 0u, 0u, 588u, 1u, 0x12u }, { 0u, 0u, 589u, 1u, 0x12u }, { 0u, 0u, 590u, 1u, 0x12u }, { 0u, 0u, 591u, 1u, 0x12u },
+        { 0u, 0u, 592u, 1u, 0x12u }, { 0u, 0u, 593u, 1u, 0x12u }, { 0u, 0u, 594u, 1u, 0x12u }, { 0u, 0u, 595u, 1u, 0x12u }, { 0u, 0u, 596u, 1u, 0x12u },
+        { 0u, 0u, 597u, 2u, 0x12u }, { 0u, 0u, 599u, 2u, 0x12u }, { 0u, 0u, 601u, 2u, 0x12u }, { 0u, 0u, 603u, 2u, 0x12u }, { 0u, 0u, 605u, 2u, 0x12u },
+        { 0u, 0u, 607u, 2u, 0x12u }, { 0u, 0u, 609u, 1u, 0x12u }, { 0u, 0u, 610u, 1u, 0x12u }, { 0u, 0u, 611u, 1u, 0x12u }, { 0u, 0u, 612u, 1u, 0x12u }, { 0u, 0u, 0u, 0u, 0x28u },
+        { 613u, 1u, 613u, 1u, 0x17u }, { 614u, 1u, 614u, 1u, 0x17u }, { 615u, 1u, 615u, 1u, 0x17u }, { 616u, 2u, 616u, 2u, 0x17u }, { 618u, 1u, 618u, 1u, 0x17u },
+        { 0u, 0u, 619u, 2u, 0x12u }, { 621u, 1u, 621u, 1u, 0x17u }, { 622u, 2u, 624u, 3u, 0x13u }, { 627u, 2u, 627u, 2u, 0x3u }, { 629u, 1u, 629u, 1u, 0x17u },
+        { 630u, 2u, 630u, 2u, 0x3u }, { 632u, 2u, 632u, 2u, 0x3u }, { 634u, 2u, 634u, 2u, 0x3u }, { 636u, 2u, 636u, 2u, 0x3u }, { 638u, 2u, 638u, 2u, 0x3u },
+        { 640u, 2u, 640u, 2u, 0x3u }, { 642u, 3u, 642u, 3u, 0x3u }, { 645u, 2u, 645u, 2u, 0x3u }, { 647u, 2u, 647u, 2u, 0x3u }, { 649u, 2u, 649u, 2u, 0x3u },
+        { 651u, 2u, 651u, 2u, 0x3u }, { 653u, 2u, 653u, 2u, 0x3u }, { 655u, 2u, 655u, 2u, 0x3u }, { 657u, 3u, 657u, 3u, 0x3u }, { 660u, 2u, 660u, 2u, 0x3u },
+        { 662u, 2u, 662u, 2u, 0x3u }, { 664u, 2u, 664u, 2u, 0x3u }, { 666u, 2u, 666u, 2u, 0x3u }, { 668u, 2u, 668u, 2u, 0x3u }, { 0u, 0u, 670u, 1u, 0x12u },
+        { 0u, 0u, 671u, 1u, 0x12u }, { 0u, 0u, 672u, 1u, 0x12u }, { 673u, 2u, 638u, 2u, 0x13u }, { 675u, 2u, 647u, 2u, 0x13u }, { 0u, 0u, 677u, 1u, 0x12u },
+        { 0u, 0u, 678u, 1u, 0x12u }, { 0u, 0u, 679u, 1u, 0x12u }, { 0u, 0u, 680u, 1u, 0x12u }, { 0u, 0u, 681u, 1u, 0x12u }, { 0u, 0u, 682u, 1u, 0x12u },
+        { 0u, 0u, 683u, 1u, 0x12u }, { 0u, 0u, 684u, 1u, 0x12u }, { 685u, 2u, 685u, 2u, 0x3u }, { 687u, 2u, 687u, 2u, 0x3u }, { 689u, 2u, 689u, 2u, 0x3u },
+        { 691u, 2u, 691u, 2u, 0x3u }, { 693u, 2u, 693u, 2u, 0x3u }, { 695u, 2u, 695u, 2u, 0x3u }, { 697u, 2u, 697u, 2u, 0x3u }, { 699u, 2u, 699u, 2u, 0x3u },
+        { 701u, 2u, 701u, 2u, 0x3u }, { 703u, 2u, 703u, 2u, 0x3u }, { 705u, 2u, 705u, 2u, 0x3u }, { 707u, 2u, 707u, 2u, 0x3u }, { 709u, 2u, 709u, 2u, 0x3u },
+        { 711u, 2u, 711u, 2u, 0x3u }, { 713u, 2u, 713u, 2u, 0x3u }, { 715u, 2u, 715u, 2u, 0x3u }, { 717u, 2u, 717u, 2u, 0x3u }, { 719u, 2u, 719u, 2u, 0x3u },
+        { 721u, 2u, 721u, 2u, 0x3u }, { 723u, 2u, 723u, 2u, 0x3u }, { 725u, 2u, 725u, 2u, 0x3u }, { 727u, 2u, 727u, 2u, 0x3u }, { 729u, 2u, 729u, 2u, 0x3u },
+        { 731u, 2u, 731u, 2u, 0x3u }, { 733u, 2u, 733u, 2u, 0x3u }, { 735u, 2u, 735u, 2u, 0x3u }, { 737u, 2u, 737u, 2u, 0x3u }, { 739u, 2u, 739u, 2u, 0x3u },
+        { 741u, 2u, 741u, 2u, 0x3u }, { 743u, 2u, 743u, 2u, 0x3u }, { 745u, 2u, 745u, 2u, 0x3u }, { 747u, 2u, 747u, 2u, 0x3u }, { 749u, 2u, 749u, 2u, 0x3u },
+        { 751u, 2u, 751u, 2u, 0x3u }, { 753u, 2u, 753u, 2u, 0x3u }, { 755u, 2u, 755u, 2u, 0x3u }, { 757u, 2u, 757u, 2u, 0x3u }, { 759u, 2u, 759u, 2u, 0x3u },
+        { 761u, 2u, 761u, 2u, 0x3u }, { 763u, 2u, 763u, 2u, 0x3u }, { 765u, 2u, 765u, 2u, 0x3u }, { 767u, 2u, 767u, 2u, 0x3u }, { 769u, 2u, 769u, 2u, 0x3u },
+        { 771u, 2u, 771u, 2u, 0x3u }, { 773u, 2u, 773u, 2u, 0x3u }, { 775u, 2u, 775u, 2u, 0x3u }, { 777u, 2u, 777u, 2u, 0x3u }, { 779u, 2u, 779u, 2u, 0x3u },
+        { 781u, 2u, 781u, 2u, 0x3u }, { 783u, 2u, 783u, 2u, 0x3u }, { 785u, 2u, 785u, 2u, 0x3u }, { 787u, 2u, 787u, 2u, 0x3u }, { 0u, 0u, 789u, 2u, 0x12u },
+        { 791u, 2u, 791u, 2u, 0x3u }, { 793u, 2u, 793u, 2u, 0x3u }, { 795u, 2u, 795u, 2u, 0x3u }, { 797u, 2u, 797u, 2u, 0x3u }, { 799u, 2u, 799u, 2u, 0x3u },
+        { 0u, 0u, 801u, 2u, 0x12u }, { 0u, 0u, 803u, 2u, 0x12u }, { 0u, 0u, 805u, 2u, 0x12u }, { 0u, 0u, 807u, 2u, 0x12u }, { 809u, 2u, 809u, 2u, 0x3u },
+        { 811u, 2u, 811u, 2u, 0x3u }, { 813u, 2u, 813u, 2u, 0x3u }, { 815u, 2u, 815u, 2u, 0x3u }, { 817u, 2u, 817u, 2u, 0x3u }, { 819u, 2u, 819u, 2u, 0x3u },
+        { 821u, 2u, 821u, 2u, 0x17u }, { 823u, 2u, 823u, 2u, 0x17u }, { 825u, 2u, 825u, 2u, 0x17u }, { 827u, 2u, 827u, 2u, 0x17u }, { 829u, 2u, 829u, 2u, 0x17u },
+        { 831u, 2u, 831u, 2u, 0x17u }, { 833u, 2u, 833u, 2u, 0x17u }, { 835u, 2u, 835u, 2u, 0x17u }, { 837u, 2u, 837u, 2u, 0x3u }, { 839u, 2u, 839u, 2u, 0x3u },
+        { 841u, 2u, 841u, 2u, 0x17u }, { 843u, 2u, 843u, 2u, 0x17u }, { 845u, 2u, 845u, 2u, 0x17u }, { 847u, 2u, 847u, 2u, 0x17u }, { 849u, 2u, 849u, 2u, 0x17u },
+        { 851u, 2u, 851u, 2u, 0x17u }, { 853u, 2u, 853u, 2u, 0x17u }, { 855u, 2u, 855u, 2u, 0x17u }, { 857u, 2u, 857u, 2u, 0x17u }, { 859u, 2u, 859u, 2u, 0x3u },
+        { 861u, 2u, 861u, 2u, 0x3u }, { 863u, 2u, 863u, 2u, 0x3u }, { 865u, 2u, 865u, 2u, 0x17u }, { 867u, 2u, 867u, 2u, 0x17u }, { 869u, 2u, 869u, 2u, 0x3u },
+        { 871u, 2u, 871u, 2u, 0x3u }, { 873u, 2u, 873u, 2u, 0x3u }, { 875u, 2u, 875u, 2u, 0x3u }, { 877u, 2u, 877u, 2u, 0x3u }, { 879u, 2u, 879u, 2u, 0x3u },
+        { 881u, 2u, 881u, 2u, 0x3u }, { 883u, 2u, 883u, 2u, 0x3u }, { 885u, 2u, 885u, 2u, 0x3u }, { 887u, 3u, 887u, 3u, 0x3u }, { 890u, 2u, 890u, 2u, 0x3u },
+        { 892u, 2u, 892u, 2u, 0x3u }, { 894u, 2u, 894u, 2u, 0x3u }, { 896u, 2u, 896u, 2u, 0x3u }, { 898u, 2u, 898u, 2u, 0x3u }, { 900u, 3u, 900u, 3u, 0x3u },
+        { 903u, 2u, 903u, 2u, 0x3u }, { 0u, 0u, 905u, 2u, 0x12u }, { 0u, 0u, 907u, 2u, 0x12u }, { 0u, 0u, 909u, 2u, 0x12u }, { 0u, 0u, 911u, 2u, 0x12u },
+        { 0u, 0u, 913u, 1u, 0x12u }, { 914u, 2u, 914u, 2u, 0x17u }, { 916u, 2u, 916u, 2u, 0x17u }, { 918u, 2u, 918u, 2u, 0x17u }, { 920u, 2u, 920u, 2u, 0x17u },
+        { 922u, 2u, 922u, 2u, 0x17u }, { 924u, 2u, 924u, 2u, 0x17u }, { 926u, 2u, 926u, 2u, 0x17u }, { 928u, 2u, 928u, 2u, 0x17u }, { 930u, 2u, 930u, 2u, 0x17u },
+        { 0u, 0u, 932u, 3u, 0x12u }, { 935u, 2u, 935u, 2u, 0x17u }, { 0u, 0u, 937u, 3u, 0x12u }, { 940u, 2u, 940u, 2u, 0x17u }, { 942u, 2u, 942u, 2u, 0x17u },
+        { 944u, 2u, 944u, 2u, 0x17u }, { 946u, 2u, 946u, 2u, 0x17u }, { 948u, 2u, 948u, 2u, 0x17u }, { 950u, 2u, 950u, 2u, 0x17u }, { 952u, 2u, 952u, 2u, 0x17u },
+        { 954u, 2u, 954u, 2u, 0x3u }, { 0u, 0u, 956u, 1u, 0x12u }, { 957u, 2u, 957u, 2u, 0x3u }, { 959u, 2u, 959u, 2u, 0x3u }, { 961u, 2u, 961u, 2u, 0x3u },
+        { 963u, 2u, 963u, 2u, 0x3u }, { 965u, 2u, 965u, 2u, 0x3u }, { 967u, 2u, 967u, 2u, 0x3u }, { 969u, 2u, 969u, 2u, 0x3u }, { 971u, 2u, 971u, 2u, 0x3u },
+        { 973u, 2u, 973u, 2u, 0x3u }, { 975u, 2u, 975u, 2u, 0x3u }, { 977u, 2u, 977u, 2u, 0x3u }, { 0u, 0u, 979u, 1u, 0x12u }, { 0u, 0u, 980u, 1u, 0x12u },
+        { 0u, 0u, 981u, 1u, 0x12u }, { 0u, 0u, 982u, 1u, 0x12u }, { 0u, 0u, 983u, 1u, 0x12u }, { 0u, 0u, 984u, 1u, 0x12u }, { 0u, 0u, 985u, 1u, 0x12u },
+        { 0u, 0u, 986u, 1u, 0x12u }, { 0u, 0u, 987u, 1u, 0x12u }, { 0u, 0u, 988u, 1u, 0x12u }, { 0u, 0u, 989u, 1u, 0x12u }, { 0u, 0u, 990u, 1u, 0x12u },
+        { 0u, 0u, 991u, 1u, 0x12u }, { 0u, 0u, 992u, 1u, 0x12u }, { 0u, 0u, 993u, 1u, 0x12u }, { 0u, 0u, 994u, 1u, 0x12u }, { 0u, 0u, 995u, 1u, 0x12u },
+        { 0u, 0u, 996u, 1u, 0x12u }, { 0u, 0u, 997u, 1u, 0x12u }, { 0u, 0u, 998u, 1u, 0x12u }, { 0u, 0u, 999u, 1u, 0x12u }, { 0u, 0u, 1000u, 1u, 0x12u },
+        { 0u, 0u, 1001u, 1u, 0x12u }, { 0u, 0u, 1002u, 1u, 0x12u }, { 0u, 0u, 1003u, 1u, 0x12u }, { 0u, 0u, 1004u, 1u, 0x12u }, { 0u, 0u, 1005u, 1u, 0x12u },
+        { 0u, 0u, 1006u, 1u, 0x12u }, { 0u, 0u, 1007u, 1u, 0x12u }, { 0u, 0u, 1008u, 1u, 0x12u }, { 0u, 0u, 1009u, 1u, 0x12u }, { 0u, 0u, 1010u, 1u, 0x12u },
+        { 0u, 0u, 1011u, 1u, 0x12u }, { 0u, 0u, 1012u, 1u, 0x12u }, { 0u, 0u, 1013u, 1u, 0x12u }, { 0u, 0u, 1014u, 1u, 0x12u }, { 0u, 0u, 1015u, 1u, 0x12u },
+        { 0u, 0u, 1016u, 1u, 0x12u }, { 0u, 0u, 1017u, 1u, 0x12u }, { 0u, 0u, 1018u, 1u, 0x12u }, { 0u, 0u, 1019u, 1u, 0x12u }, { 0u, 0u, 1020u, 1u, 0x12u },
+        { 0u, 0u, 1021u, 1u, 0x12u }, { 0u, 0u, 1022u, 1u, 0x12u }, { 0u, 0u, 1023u, 1u, 0x12u }, { 0u, 0u, 1024u, 1u, 0x12u }, { 0u, 0u, 1025u, 1u, 0x12u },
+        { 0u, 0u, 1026u, 1u, 0x12u }, { 0u, 0u, 1027u, 1u, 0x12u }, { 0u, 0u, 1028u, 1u, 0x12u }, { 0u, 0u, 1029u, 1u, 0x12u }, { 0u, 0u, 1030u, 1u, 0x12u },
+        { 0u, 0u, 1031u, 1u, 0x12u }, { 0u, 0u, 1032u, 1u, 0x12u }, { 0u, 0u, 1033u, 1u, 0x12u }, { 0u, 0u, 1034u, 1u, 0x12u }, { 0u, 0u, 1035u, 1u, 0x12u },
+        { 0u, 0u, 1036u, 1u, 0x12u }, { 0u, 0u, 1037u, 1u, 0x12u }, { 0u, 0u, 1038u, 1u, 0x12u }, { 0u, 0u, 1039u, 1u, 0x12u }, { 0u, 0u, 1040u, 1u, 0x12u },
+        { 0u, 0u, 1041u, 1u, 0x12u }, { 0u, 0u, 1042u, 1u, 0x12u }, { 0u, 0u, 1043u, 1u, 0x12u }, { 0u, 0u, 1044u, 1u, 0x12u }, { 0u, 0u, 1045u, 1u, 0x12u },
+        { 0u, 0u, 1046u, 1u, 0x12u }, { 0u, 0u, 1047u, 1u, 0x12u }, { 0u, 0u, 1048u, 1u, 0x12u }, { 0u, 0u, 1049u, 1u, 0x12u }, { 0u, 0u, 1050u, 1u, 0x12u },
+        { 0u, 0u, 1051u, 1u, 0x12u }, { 0u, 0u, 1052u, 1u, 0x12u }, { 0u, 0u, 1053u, 1u, 0x12u }, { 0u, 0u, 1054u, 1u, 0x12u }, { 0u, 0u, 1055u, 1u, 0x12u },
+        { 0u, 0u, 1056u, 1u, 0x12u }, { 0u, 0u, 1057u, 1u, 0x12u }, { 0u, 0u, 1058u, 1u, 0x12u }, { 0u, 0u, 1059u, 1u, 0x12u }, { 0u, 0u, 1060u, 1u, 0x12u },
+        { 0u, 0u, 1061u, 1u, 0x12u }, { 0u, 0u, 1062u, 1u, 0x12u }, { 1063u, 2u, 1063u, 2u, 0x3u }, { 1065u, 2u, 1065u, 2u, 0x3u }, { 1067u, 2u, 1067u, 2u, 0x3u },
+        { 1069u, 2u, 1069u, 2u, 0x3u }, { 1071u, 2u, 1071u, 2u, 0x3u }, { 1073u, 2u, 1073u, 2u, 0x3u }, { 1075u, 2u, 1075u, 2u, 0x3u }, { 1077u, 2u, 1077u, 2u, 0x3u },
+        { 1079u, 3u, 1079u, 3u, 0x3u }, { 1082u, 3u, 1082u, 3u, 0x3u }, { 1085u, 2u, 1085u, 2u, 0x3u }, { 1087u, 2u, 1087u, 2u, 0x3u }, { 1089u, 2u, 1089u, 2u, 0x3u },
+        { 1091u, 2u, 1091u, 2u, 0x3u }, { 1093u, 2u, 1093u, 2u, 0x3u }, { 1095u, 2u, 1095u, 2u, 0x3u }, { 1097u, 2u, 1097u, 2u, 0x3u }, { 1099u, 2u, 1099u, 2u, 0x3u },
+        { 1101u, 2u, 1101u, 2u, 0x3u }, { 1103u, 2u, 1103u, 2u, 0x3u }, { 1105u, 3u, 1105u, 3u, 0x3u }, { 1108u, 3u, 1108u, 3u, 0x3u }, { 1111u, 3u, 1111u, 3u, 0x3u },
+        { 1114u, 3u, 1114u, 3u, 0x3u }, { 1117u, 2u, 1117u, 2u, 0x3u }, { 1119u, 2u, 1119u, 2u, 0x3u }, { 1121u, 2u, 1121u, 2u, 0x3u }, { 1123u, 2u, 1123u, 2u, 0x3u },
+        { 1125u, 3u, 1125u, 3u, 0x3u }, { 1128u, 3u, 1128u, 3u, 0x3u }, { 1131u, 2u, 1131u, 2u, 0x3u }, { 1133u, 2u, 1133u, 2u, 0x3u }, { 1135u, 2u, 1135u, 2u, 0x3u },
+        { 1137u, 2u, 1137u, 2u, 0x3u }, { 1139u, 2u, 1139u, 2u, 0x3u }, { 1141u, 2u, 1141u, 2u, 0x3u }, { 1143u, 2u, 1143u, 2u, 0x3u }, { 1145u, 2u, 1145u, 2u, 0x3u },
+        { 1147u, 2u, 1147u, 2u, 0x3u }, { 1149u, 2u, 1149u, 2u, 0x3u }, { 1151u, 2u, 1151u, 2u, 0x3u }, { 1153u, 2u, 1153u, 2u, 0x3u }, { 1155u, 2u, 1155u, 2u, 0x3u },
+        { 1157u, 2u, 1157u, 2u, 0x3u }, { 1159u, 2u, 1159u, 2u, 0x3u }, { 1161u, 2u, 1161u, 2u, 0x3u }, { 1163u, 3u, 1163u, 3u, 0x3u }, { 1166u, 3u, 1166u, 3u, 0x3u },
+        { 1169u, 2u, 1169u, 2u, 0x3u }, { 1171u, 2u, 1171u, 2u, 0x3u }, { 1173u, 2u, 1173u, 2u, 0x3u }, { 1175u, 2u, 1175u, 2u, 0x3u }, { 1177u, 2u, 1177u, 2u, 0x3u },
+        { 1179u, 2u, 1179u, 2u, 0x3u }, { 1181u, 2u, 1181u, 2u, 0x3u }, { 1183u, 2u, 1183u, 2u, 0x3u }, { 1185u, 3u, 1185u, 3u, 0x3u }, { 1188u, 3u, 1188u, 3u, 0x3u },
+        { 1191u, 2u, 1191u, 2u, 0x3u }, { 1193u, 2u, 1193u, 2u, 0x3u }, { 1195u, 2u, 1195u, 2u, 0x3u }, { 1197u, 2u, 1197u, 2u, 0x3u }, { 1199u, 2u, 1199u, 2u, 0x3u },
+        { 1201u, 2u, 1201u, 2u, 0x3u }, { 1203u, 2u, 1203u, 2u, 0x3u }, { 1205u, 2u, 1205u, 2u, 0x3u }, { 1207u, 2u, 1207u, 2u, 0x3u }, { 1209u, 2u, 1209u, 2u, 0x3u },
+        { 1211u, 2u, 1211u, 2u, 0x3u }, { 1213u, 2u, 1213u, 2u, 0x3u }, { 1215u, 2u, 1215u, 2u, 0x3u }, { 1217u, 2u, 1217u, 2u, 0x3u }, { 1219u, 2u, 1219u, 2u, 0x3u },
+        { 1221u, 2u, 1221u, 2u, 0x3u }, { 1223u, 2u, 1223u, 2u, 0x3u }, { 1225u, 2u, 1225u, 2u, 0x3u }, { 1227u, 3u, 1227u, 3u, 0x3u }, { 1230u, 3u, 1230u, 3u, 0x3u },
+        { 1233u, 3u, 1233u, 3u, 0x3u }, { 1236u, 3u, 1236u, 3u, 0x3u }, { 1239u, 3u, 1239u, 3u, 0x3u }, { 1242u, 3u, 1242u, 3u, 0x3u }, { 1245u, 3u, 1245u, 3u, 0x3u },
+        { 1248u, 3u, 1248u, 3u, 0x3u }, { 1251u, 2u, 1251u, 2u, 0x3u }, { 1253u, 2u, 1253u, 2u, 0x3u }, { 1255u, 2u, 1255u, 2u, 0x3u }, { 1257u, 2u, 1257u, 2u, 0x3u },
+        { 1259u, 2u, 1259u, 2u, 0x3u }, { 1261u, 2u, 1261u, 2u, 0x3u }, { 1263u, 2u, 1263u, 2u, 0x3u }, { 1265u, 2u, 1265u, 2u, 0x3u }, { 1267u, 3u, 1267u, 3u, 0x3u },
+        { 1270u, 3u, 1270u, 3u, 0x3u }, { 1273u, 2u, 1273u, 2u, 0x3u }, { 1275u, 2u, 1275u, 2u, 0x3u }, { 1277u, 2u, 1277u, 2u, 0x3u }, { 1279u, 2u, 1279u, 2u, 0x3u },
+        { 1281u, 2u, 1281u, 2u, 0x3u }, { 1283u, 2u, 1283u, 2u, 0x3u }, { 1285u, 3u, 1285u, 3u, 0x3u }, { 1288u, 3u, 1288u, 3u, 0x3u }, { 1291u, 3u, 1291u, 3u, 0x3u },
+        { 1294u, 3u, 1294u, 3u, 0x3u }, { 1297u, 3u, 1297u, 3u, 0x3u }, { 1300u, 3u, 1300u, 3u, 0x3u }, { 1303u, 2u, 1303u, 2u, 0x3u }, { 1305u, 2u, 1305u, 2u, 0x3u },
+        { 1307u, 2u, 1307u, 2u, 0x3u }, { 1309u, 2u, 1309u, 2u, 0x3u }, { 1311u, 2u, 1311u, 2u, 0x3u }, { 1313u, 2u, 1313u, 2u, 0x3u }, { 1315u, 2u, 1315u, 2u, 0x3u },
+        { 1317u, 2u, 1317u, 2u, 0x3u }, { 1319u, 2u, 1319u, 2u, 0x3u }, { 1321u, 2u, 1321u, 2u, 0x3u }, { 1323u, 2u, 1323u, 2u, 0x3u }, { 1325u, 2u, 1325u, 2u, 0x3u },
+        { 1327u, 2u, 1327u, 2u, 0x3u }, { 1329u, 2u, 1329u, 2u, 0x3u }, { 1331u, 3u, 1331u, 3u, 0x3u }, { 1334u, 3u, 1334u, 3u, 0x3u }, { 1337u, 3u, 1337u, 3u, 0x3u },
+        { 1340u, 3u, 1340u, 3u, 0x3u }, { 1343u, 2u, 1343u, 2u, 0x3u }, { 1345u, 2u, 1345u, 2u, 0x3u }, { 1347u, 2u, 1347u, 2u, 0x3u }, { 1349u, 2u, 1349u, 2u, 0x3u },
+        { 1351u, 2u, 1351u, 2u, 0x3u }, { 1353u, 2u, 1353u, 2u, 0x3u }, { 1355u, 2u, 1355u, 2u, 0x3u }, { 1357u, 2u, 1357u, 2u, 0x3u }, { 1359u, 2u, 1359u, 2u, 0x3u },
+        { 1361u, 2u, 1361u, 2u, 0x3u }, { 1363u, 2u, 1363u, 2u, 0x3u }, { 1365u, 2u, 1365u, 2u, 0x3u }, { 1367u, 2u, 1367u, 2u, 0x3u }, { 1369u, 2u, 1369u, 2u, 0x3u },
+        { 1371u, 2u, 1371u, 2u, 0x3u }, { 1373u, 2u, 1373u, 2u, 0x3u }, { 1375u, 2u, 1375u, 2u, 0x3u }, { 1377u, 2u, 1377u, 2u, 0x3u }, { 1379u, 2u, 1379u, 2u, 0x3u },
+        { 1381u, 2u, 1381u, 2u, 0x3u }, { 1383u, 2u, 1383u, 2u, 0x3u }, { 1385u, 2u, 1385u, 2u, 0x3u }, { 1387u, 2u, 1387u, 2u, 0x3u }, { 1389u, 2u, 1389u, 2u, 0x3u },
+        { 1391u, 2u, 1391u, 2u, 0x3u }, { 1393u, 2u, 1393u, 2u, 0x3u }, { 1395u, 2u, 1395u, 2u, 0x3u }, { 1397u, 2u, 1397u, 2u, 0x3u }, { 1399u, 2u, 1399u, 2u, 0x3u },
+        { 1401u, 2u, 1401u, 2u, 0x3u }, { 0u, 0u, 1403u, 2u, 0x12u }, { 1405u, 2u, 1279u, 2u, 0x13u }, { 1407u, 2u, 1407u, 2u, 0x3u }, { 1409u, 2u, 1409u, 2u, 0x3u },
+        { 1411u, 2u, 1411u, 2u, 0x3u }, { 1413u, 2u, 1413u, 2u, 0x3u }, { 1415u, 3u, 1415u, 3u, 0x3u }, { 1418u, 3u, 1418u, 3u, 0x3u }, { 1421u, 3u, 1421u, 3u, 0x3u },
+        { 1424u, 3u, 1424u, 3u, 0x3u }, { 1427u, 3u, 1427u, 3u, 0x3u }, { 1430u, 3u, 1430u, 3u, 0x3u }, { 1433u, 3u, 1433u, 3u, 0x3u }, { 1436u, 3u, 1436u, 3u, 0x3u },
+        { 1439u, 3u, 1439u, 3u, 0x3u }, { 1442u, 3u, 1442u, 3u, 0x3u }, { 1445u, 3u, 1445u, 3u, 0x3u }, { 1448u, 3u, 1448u, 3u, 0x3u }, { 1451u, 3u, 1451u, 3u, 0x3u },
+        { 1454u, 3u, 1454u, 3u, 0x3u }, { 1457u, 3u, 1457u, 3u, 0x3u }, { 1460u, 3u, 1460u, 3u, 0x3u }, { 1463u, 3u, 1463u, 3u, 0x3u }, { 1466u, 3u, 1466u, 3u, 0x3u },
+        { 1469u, 3u, 1469u, 3u, 0x3u }, { 1472u, 3u, 1472u, 3u, 0x3u }, { 1475u, 2u, 1475u, 2u, 0x3u }, { 1477u, 2u, 1477u, 2u, 0x3u }, { 1479u, 2u, 1479u, 2u, 0x3u },
+        { 1481u, 2u, 1481u, 2u, 0x3u }, { 1483u, 2u, 1483u, 2u, 0x3u }, { 1485u, 2u, 1485u, 2u, 0x3u }, { 1487u, 3u, 1487u, 3u, 0x3u }, { 1490u, 3u, 1490u, 3u, 0x3u },
+        { 1493u, 3u, 1493u, 3u, 0x3u }, { 1496u, 3u, 1496u, 3u, 0x3u }, { 1499u, 3u, 1499u, 3u, 0x3u }, { 1502u, 3u, 1502u, 3u, 0x3u }, { 1505u, 3u, 1505u, 3u, 0x3u },
+        { 1508u, 3u, 1508u, 3u, 0x3u }, { 1511u, 3u, 1511u, 3u, 0x3u }, { 1514u, 3u, 1514u, 3u, 0x3u }, { 1517u, 2u, 1517u, 2u, 0x3u }, { 1519u, 2u, 1519u, 2u, 0x3u },
+        { 1521u, 2u, 1521u, 2u, 0x3u }, { 1523u, 2u, 1523u, 2u, 0x3u }, { 1525u, 2u, 1525u, 2u, 0x3u }, { 1527u, 2u, 1527u, 2u, 0x3u }, { 1529u, 2u, 1529u, 2u, 0x3u },
+        { 1531u, 2u, 1531u, 2u, 0x3u }, { 1533u, 3u, 1533u, 3u, 0x3u }, { 1536u, 3u, 1536u, 3u, 0x3u }, { 1539u, 3u, 1539u, 3u, 0x3u }, { 1542u, 3u, 1542u, 3u, 0x3u },
+        { 1545u, 3u, 1545u, 3u, 0x3u }, { 1548u, 3u, 1548u, 3u, 0x3u }, { 1551u, 3u, 1551u, 3u, 0x3u }, { 1554u, 3u, 1554u, 3u, 0x3u }, { 1557u, 3u, 1557u, 3u, 0x3u },
+        { 1560u, 3u, 1560u, 3u, 0x3u }, { 1563u, 3u, 1563u, 3u, 0x3u }, { 1566u, 3u, 1566u, 3u, 0x3u }, { 1569u, 3u, 1569u, 3u, 0x3u }, { 1572u, 3u, 1572u, 3u, 0x3u },
+        { 1575u, 3u, 1575u, 3u, 0x3u }, { 1578u, 3u, 1578u, 3u, 0x3u }, { 1581u, 3u, 1581u, 3u, 0x3u }, { 1584u, 3u, 1584u, 3u, 0x3u }, { 1587u, 3u, 1587u, 3u, 0x3u },
+        { 1590u, 3u, 1590u, 3u, 0x3u }, { 1593u, 2u, 1593u, 2u, 0x3u }, { 1595u, 2u, 1595u, 2u, 0x3u }, { 1597u, 2u, 1597u, 2u, 0x3u }, { 1599u, 2u, 1599u, 2u, 0x3u },
+        { 1601u, 3u, 1601u, 3u, 0x3u }, { 1604u, 3u, 1604u, 3u, 0x3u }, { 1607u, 3u, 1607u, 3u, 0x3u }, { 1610u, 3u, 1610u, 3u, 0x3u }, { 1613u, 3u, 1613u, 3u, 0x3u },
+        { 1616u, 3u, 1616u, 3u, 0x3u }, { 1619u, 3u, 1619u, 3u, 0x3u }, { 1622u, 3u, 1622u, 3u, 0x3u }, { 1625u, 3u, 1625u, 3u, 0x3u }, { 1628u, 3u, 1628u, 3u, 0x3u },
+        { 1631u, 2u, 1631u, 2u, 0x3u }, { 1633u, 2u, 1633u, 2u, 0x3u }, { 1635u, 2u, 1635u, 2u, 0x3u }, { 1637u, 2u, 1637u, 2u, 0x3u }, { 1639u, 2u, 1639u, 2u, 0x3u },
+        { 1641u, 2u, 1641u, 2u, 0x3u }, { 1643u, 2u, 1643u, 2u, 0x3u }, { 1645u, 2u, 1645u, 2u, 0x3u }, { 1647u, 2u, 1647u, 2u, 0x3u }, { 1649u, 2u, 1649u, 2u, 0x3u },
+        { 1651u, 3u, 1651u, 3u, 0x3u }, { 1654u, 3u, 1654u, 3u, 0x3u }, { 1657u, 3u, 1657u, 3u, 0x3u }, { 1660u, 3u, 1660u, 3u, 0x3u }, { 1663u, 3u, 1663u, 3u, 0x3u },
+        { 1666u, 3u, 1666u, 3u, 0x3u }, { 1669u, 2u, 1669u, 2u, 0x3u }, { 1671u, 2u, 1671u, 2u, 0x3u }, { 1673u, 3u, 1673u, 3u, 0x3u }, { 1676u, 3u, 1676u, 3u, 0x3u },
+        { 1679u, 3u, 1679u, 3u, 0x3u }, { 1682u, 3u, 1682u, 3u, 0x3u }, { 1685u, 3u, 1685u, 3u, 0x3u }, { 1688u, 3u, 1688u, 3u, 0x3u }, { 1691u, 2u, 1691u, 2u, 0x3u },
+        { 1693u, 2u, 1693u, 2u, 0x3u }, { 1695u, 3u, 1695u, 3u, 0x3u }, { 1698u, 3u, 1698u, 3u, 0x3u }, { 1701u, 3u, 1701u, 3u, 0x3u }, { 1704u, 3u, 1704u, 3u, 0x3u },
+        { 1707u, 2u, 1707u, 2u, 0x3u }, { 1709u, 2u, 1709u, 2u, 0x3u }, { 1711u, 3u, 1711u, 3u, 0x3u }, { 1714u, 3u, 1714u, 3u, 0x3u }, { 1717u, 3u, 1717u, 3u, 0x3u },
+        { 1720u, 3u, 1720u, 3u, 0x3u }, { 1723u, 2u, 1723u, 2u, 0x3u }, { 1725u, 2u, 1725u, 2u, 0x3u }, { 1727u, 3u, 1727u, 3u, 0x3u }, { 1730u, 3u, 1730u, 3u, 0x3u },
+        { 1733u, 3u, 1733u, 3u, 0x3u }, { 1736u, 3u, 1736u, 3u, 0x3u }, { 1739u, 3u, 1739u, 3u, 0x3u }, { 1742u, 3u, 1742u, 3u, 0x3u }, { 1745u, 2u, 1745u, 2u, 0x3u },
+        { 1747u, 2u, 1747u, 2u, 0x3u }, { 1749u, 3u, 1749u, 3u, 0x3u }, { 1752u, 3u, 1752u, 3u, 0x3u }, { 1755u, 3u, 1755u, 3u, 0x3u }, { 1758u, 3u, 1758u, 3u, 0x3u },
+        { 1761u, 3u, 1761u, 3u, 0x3u }, { 1764u, 3u, 1764u, 3u, 0x3u }, { 1767u, 2u, 1767u, 2u, 0x3u }, { 1769u, 2u, 1769u, 2u, 0x3u }, { 1771u, 3u, 1771u, 3u, 0x3u },
+        { 1774u, 3u, 1774u, 3u, 0x3u }, { 1777u, 3u, 1777u, 3u, 0x3u }, { 1780u, 3u, 1780u, 3u, 0x3u }, { 1783u, 3u, 1783u, 3u, 0x3u }, { 1786u, 3u, 1786u, 3u, 0x3u },
+        { 1789u, 2u, 1789u, 2u, 0x3u }, { 1791u, 2u, 1791u, 2u, 0x3u }, { 1793u, 3u, 1793u, 3u, 0x3u }, { 1796u, 3u, 1796u, 3u, 0x3u }, { 1799u, 3u, 1799u, 3u, 0x3u },
+        { 1802u, 3u, 1802u, 3u, 0x3u }, { 1805u, 3u, 1805u, 3u, 0x3u }, { 1808u, 3u, 1808u, 3u, 0x3u }, { 1811u, 2u, 1811u, 2u, 0x3u }, { 1813u, 2u, 1813u, 2u, 0x3u },
+        { 1815u, 3u, 1815u, 3u, 0x3u }, { 1818u, 3u, 1818u, 3u, 0x3u }, { 1821u, 3u, 1821u, 3u, 0x3u }, { 1824u, 3u, 1824u, 3u, 0x3u }, { 1827u, 2u, 1827u, 2u, 0x3u },
+        { 1829u, 2u, 1829u, 2u, 0x3u }, { 1831u, 3u, 1831u, 3u, 0x3u }, { 1834u, 3u, 1834u, 3u, 0x3u }, { 1837u, 3u, 1837u, 3u, 0x3u }, { 1840u, 3u, 1840u, 3u, 0x3u },
+        { 1843u, 2u, 1843u, 2u, 0x3u }, { 1845u, 2u, 1845u, 2u, 0x3u }, { 1847u, 3u, 1847u, 3u, 0x3u }, { 1850u, 3u, 1850u, 3u, 0x3u }, { 1853u, 3u, 1853u, 3u, 0x3u },
+        { 1856u, 3u, 1856u, 3u, 0x3u }, { 1859u, 3u, 1859u, 3u, 0x3u }, { 1862u, 3u, 1862u, 3u, 0x3u }, { 1865u, 2u, 1865u, 2u, 0x3u }, { 1867u, 3u, 1867u, 3u, 0x3u },
+        { 1870u, 3u, 1870u, 3u, 0x3u }, { 1873u, 3u, 1873u, 3u, 0x3u }, { 1876u, 2u, 1876u, 2u, 0x3u }, { 1878u, 2u, 1878u, 2u, 0x3u }, { 1880u, 3u, 1880u, 3u, 0x3u },
+        { 1883u, 3u, 1883u, 3u, 0x3u }, { 1886u, 3u, 1886u, 3u, 0x3u }, { 1889u, 3u, 1889u, 3u, 0x3u }, { 1892u, 3u, 1892u, 3u, 0x3u }, { 1895u, 3u, 1895u, 3u, 0x3u },
+        { 1898u, 2u, 1898u, 2u, 0x3u }, { 1900u, 2u, 1900u, 2u, 0x3u }, { 1902u, 3u, 1902u, 3u, 0x3u }, { 1905u, 3u, 1905u, 3u, 0x3u }, { 1908u, 3u, 1908u, 3u, 0x3u },
+        { 1911u, 3u, 1911u, 3u, 0x3u }, { 1914u, 3u, 1914u, 3u, 0x3u }, { 1917u, 3u, 1917u, 3u, 0x3u }, { 1920u, 2u, 1920u, 2u, 0x3u }, { 649u, 2u, 649u, 2u, 0x17u },
+        { 1922u, 2u, 1922u, 2u, 0x3u }, { 651u, 2u, 651u, 2u, 0x17u }, { 1924u, 2u, 1924u, 2u, 0x3u }, { 653u, 2u, 653u, 2u, 0x17u }, { 1926u, 2u, 1926u, 2u, 0x3u },
+        { 655u, 2u, 655u, 2u, 0x17u }, { 1928u, 2u, 1928u, 2u, 0x3u }, { 664u, 2u, 664u, 2u, 0x17u }, { 1930u, 2u, 1930u, 2u, 0x3u }, { 666u, 2u, 666u, 2u, 0x17u },
+        { 1932u, 2u, 1932u, 2u, 0x3u }, { 668u, 2u, 668u, 2u, 0x17u }, { 1934u, 3u, 1934u, 3u, 0x3u }, { 1937u, 3u, 1937u, 3u, 0x3u }, { 1940u, 4u, 1940u, 4u, 0x3u },
+        { 1944u, 4u, 1944u, 4u, 0x3u }, { 1948u, 4u, 1948u, 4u, 0x3u }, { 1952u, 4u, 1952u, 4u, 0x3u }, { 1956u, 4u, 1956u, 4u, 0x3u }, { 1960u, 4u, 1960u, 4u, 0x3u },
+        { 1964u, 3u, 1964u, 3u, 0x3u }, { 1967u, 3u, 1967u, 3u, 0x3u }, { 1970u, 4u, 1970u, 4u, 0x3u }, { 1974u, 4u, 1974u, 4u, 0x3u }, { 1978u, 4u, 1978u, 4u, 0x3u },
+        { 1982u, 4u, 1982u, 4u, 0x3u }, { 1986u, 4u, 1986u, 4u, 0x3u }, { 1990u, 4u, 1990u, 4u, 0x3u }, { 1994u, 3u, 1994u, 3u, 0x3u }, { 1997u, 3u, 1997u, 3u, 0x3u },
+        { 2000u, 4u, 2000u, 4u, 0x3u }, { 2004u, 4u, 2004u, 4u, 0x3u }, { 2008u, 4u, 2008u, 4u, 0x3u }, { 2012u, 4u, 2012u, 4u, 0x3u }, { 2016u, 4u, 2016u, 4u, 0x3u },
+        { 2020u, 4u, 2020u, 4u, 0x3u }, { 2024u, 3u, 2024u, 3u, 0x3u }, { 2027u, 3u, 2027u, 3u, 0x3u }, { 2030u, 4u, 2030u, 4u, 0x3u }, { 2034u, 4u, 2034u, 4u, 0x3u },
+        { 2038u, 4u, 2038u, 4u, 0x3u }, { 2042u, 4u, 2042u, 4u, 0x3u }, { 2046u, 4u, 2046u, 4u, 0x3u }, { 2050u, 4u, 2050u, 4u, 0x3u }, { 2054u, 3u, 2054u, 3u, 0x3u },
+        { 2057u, 3u, 2057u, 3u, 0x3u }, { 2060u, 4u, 2060u, 4u, 0x3u }, { 2064u, 4u, 2064u, 4u, 0x3u }, { 2068u, 4u, 2068u, 4u, 0x3u }, { 2072u, 4u, 2072u, 4u, 0x3u },
+        { 2076u, 4u, 2076u, 4u, 0x3u }, { 2080u, 4u, 2080u, 4u, 0x3u }, { 2084u, 3u, 2084u, 3u, 0x3u }, { 2087u, 3u, 2087u, 3u, 0x3u }, { 2090u, 4u, 2090u, 4u, 0x3u },
+        { 2094u, 4u, 2094u, 4u, 0x3u }, { 2098u, 4u, 2098u, 4u, 0x3u }, { 2102u, 4u, 2102u, 4u, 0x3u }, { 2106u, 4u, 2106u, 4u, 0x3u }, { 2110u, 4u, 2110u, 4u, 0x3u },
+        { 2114u, 2u, 2114u, 2u, 0x3u }, { 2116u, 2u, 2116u, 2u, 0x3u }, { 2118u, 3u, 2118u, 3u, 0x3u }, { 2121u, 2u, 2121u, 2u, 0x3u }, { 2123u, 3u, 2123u, 3u, 0x3u },
+        { 2126u, 2u, 2126u, 2u, 0x3u }, { 2128u, 3u, 2128u, 3u, 0x3u }, { 2131u, 2u, 2131u, 2u, 0x3u }, { 2133u, 2u, 2133u, 2u, 0x3u }, { 2135u, 2u, 2135u, 2u, 0x3u },
+        { 627u, 2u, 627u, 2u, 0x17u }, { 2137u, 2u, 2137u, 2u, 0x3u }, { 0u, 0u, 2139u, 2u, 0x12u }, { 2141u, 1u, 2141u, 1u, 0x17u }, { 0u, 0u, 2142u, 2u, 0x12u },
+        { 2144u, 2u, 2146u, 3u, 0x13u }, { 2149u, 3u, 2149u, 3u, 0x3u }, { 2152u, 2u, 2152u, 2u, 0x3u }, { 2154u, 3u, 2154u, 3u, 0x3u }, { 2157u, 2u, 2157u, 2u, 0x3u },
+        { 2159u, 3u, 2159u, 3u, 0x3u }, { 2162u, 2u, 2162u, 2u, 0x3u }, { 630u, 2u, 630u, 2u, 0x17u }, { 2164u, 2u, 2164u, 2u, 0x3u }, { 632u, 2u, 632u, 2u, 0x17u },
+        { 2166u, 2u, 2166u, 2u, 0x3u }, { 2168u, 2u, 2170u, 3u, 0x13u }, { 2173u, 2u, 2175u, 3u, 0x13u }, { 2178u, 2u, 2180u, 3u, 0x13u }, { 2183u, 2u, 2183u, 2u, 0x3u },
+        { 2185u, 2u, 2185u, 2u, 0x3u }, { 2187u, 3u, 2187u, 3u, 0x3u }, { 642u, 3u, 642u, 3u, 0x17u }, { 2190u, 2u, 2190u, 2u, 0x3u }, { 2192u, 3u, 2192u, 3u, 0x3u },
+        { 2195u, 2u, 2195u, 2u, 0x3u }, { 2197u, 2u, 2197u, 2u, 0x3u }, { 2199u, 2u, 2199u, 2u, 0x3u }, { 634u, 2u, 634u, 2u, 0x17u }, { 2201u, 2u, 2203u, 3u, 0x13u },
+        { 2206u, 2u, 2208u, 3u, 0x13u }, { 2211u, 2u, 2213u, 3u, 0x13u }, { 2216u, 2u, 2216u, 2u, 0x3u }, { 2218u, 2u, 2218u, 2u, 0x3u }, { 2220u, 3u, 2220u, 3u, 0x3u },
+        { 657u, 3u, 657u, 3u, 0x17u }, { 2223u, 2u, 2223u, 2u, 0x3u }, { 2225u, 2u, 2225u, 2u, 0x3u }, { 2227u, 2u, 2227u, 2u, 0x3u }, { 2229u, 3u, 2229u, 3u, 0x3u },
+        { 2232u, 2u, 2232u, 2u, 0x3u }, { 2234u, 2u, 2234u, 2u, 0x3u }, { 2236u, 2u, 2236u, 2u, 0x3u }, { 638u, 2u, 638u, 2u, 0x17u }, { 2238u, 2u, 2238u, 2u, 0x3u },
+        { 2240u, 2u, 2242u, 3u, 0x13u }, { 622u, 2u, 624u, 3u, 0x17u }, { 2245u, 1u, 2245u, 1u, 0x17u }, { 2246u, 3u, 2246u, 3u, 0x3u }, { 2249u, 2u, 2249u, 2u, 0x3u },
+        { 2251u, 3u, 2251u, 3u, 0x3u }, { 2254u, 2u, 2254u, 2u, 0x3u }, { 2256u, 3u, 2256u, 3u, 0x3u }, { 2259u, 2u, 2259u, 2u, 0x3u }, { 636u, 2u, 636u, 2u, 0x17u },
+        { 2261u, 2u, 2261u, 2u, 0x3u }, { 640u, 2u, 640u, 2u, 0x17u }, { 2263u, 2u, 2263u, 2u, 0x3u }, { 2265u, 1u, 8u, 2u, 0x17u }, { 0u, 0u, 2266u, 2u, 0x12u },
+        { 2268u, 1u, 0u, 1u, 0x17u }, { 2269u, 1u, 0u, 1u, 0x17u }, { 0u, 0u, 2270u, 1u, 0x12u }, { 0u, 0u, 2271u, 2u, 0x12u }, { 0u, 0u, 2273u, 1u, 0x12u },
+        { 0u, 0u, 2274u, 2u, 0x12u }, { 0u, 0u, 2276u, 3u, 0x12u }, { 0u, 0u, 2279u, 2u, 0x12u }, { 0u, 0u, 2281u, 3u, 0x12u }, { 0u, 0u, 2284u, 2u, 0x12u },
+        { 0u, 0u, 2286u, 3u, 0x12u }, { 0u, 0u, 2289u, 2u, 0x12u }, { 0u, 0u, 2291u, 2u, 0x12u }, { 0u, 0u, 2293u, 2u, 0x12u }, { 0u, 0u, 2295u, 2u, 0x12u },
+        { 0u, 0u, 2297u, 2u, 0x12u }, { 0u, 0u, 2299u, 4u, 0x12u }, { 0u, 0u, 2303u, 1u, 0x12u }, { 0u, 0u, 2304u, 1u, 0x12u }, { 0u, 0u, 2305u, 1u, 0x12u },
+        { 0u, 0u, 2306u, 1u, 0x12u }, { 0u, 0u, 2307u, 1u, 0x12u }, { 0u, 0u, 2308u, 1u, 0x12u }, { 0u, 0u, 2309u, 1u, 0x12u }, { 0u, 0u, 2310u, 1u, 0x12u },
+        { 0u, 0u, 2311u, 1u, 0x12u }, { 0u, 0u, 2312u, 1u, 0x12u }, { 0u, 0u, 2313u, 1u, 0x12u }, { 0u, 0u, 2314u, 1u, 0x12u }, { 0u, 0u, 2315u, 1u, 0x12u },
+        { 0u, 0u, 2316u, 2u, 0x12u }, { 0u, 0u, 2318u, 3u, 0x12u }, { 0u, 0u, 2321u, 3u, 0x12u }, { 0u, 0u, 2324u, 1u, 0x12u }, { 0u, 0u, 2325u, 2u, 0x12u },
+        { 0u, 0u, 2327u, 3u, 0x12u }, { 0u, 0u, 2330u, 3u, 0x12u }, { 0u, 0u, 2333u, 1u, 0x12u }, { 0u, 0u, 2334u, 2u, 0x12u }, { 0u, 0u, 2336u, 1u, 0x12u },
+        { 0u, 0u, 2337u, 2u, 0x12u }, { 0u, 0u, 2339u, 1u, 0x12u }, { 0u, 0u, 2340u, 2u, 0x12u }, { 0u, 0u, 2342u, 3u, 0x12u }, { 0u, 0u, 2345u, 2u, 0x12u },
+        { 0u, 0u, 2347u, 1u, 0x12u }, { 2348u, 1u, 2348u, 1u, 0x17u }, { 989u, 1u, 989u, 1u, 0x17u }, { 34u, 2u, 34u, 2u, 0x17u }, { 0u, 0u, 2349u, 1u, 0x12u },
+        { 0u, 0u, 2350u, 1u, 0x12u }, { 0u, 0u, 2351u, 1u, 0x12u }, { 0u, 0u, 2352u, 1u, 0x12u }, { 0u, 0u, 2353u, 1u, 0x12u }, { 0u, 0u, 2354u, 3u, 0x12u },
+        { 0u, 0u, 2357u, 1u, 0x12u }, { 0u, 0u, 2358u, 1u, 0x12u }, { 0u, 0u, 2359u, 1u, 0x12u }, { 0u, 0u, 2360u, 3u, 0x12u }, { 0u, 0u, 2363u, 3u, 0x12u },
+        { 0u, 0u, 2366u, 4u, 0x12u }, { 0u, 0u, 2370u, 3u, 0x12u }, { 0u, 0u, 2373u, 3u, 0x12u }, { 0u, 0u, 2376u, 3u, 0x12u }, { 0u, 0u, 2379u, 3u, 0x12u },
+        { 0u, 0u, 2382u, 3u, 0x12u }, { 0u, 0u, 2385u, 3u, 0x12u }, { 0u, 0u, 2388u, 3u, 0x12u }, { 0u, 0u, 2391u, 3u, 0x12u }, { 0u, 0u, 2394u, 3u, 0x12u },
+        { 0u, 0u, 2397u, 3u, 0x12u }, { 0u, 0u, 2400u, 3u, 0x12u }, { 0u, 0u, 2403u, 3u, 0x12u }, { 0u, 0u, 2406u, 2u, 0x12u }, { 0u, 0u, 2408u, 2u, 0x12u },
+        { 0u, 0u, 2410u, 3u, 0x12u }, { 0u, 0u, 2413u, 2u, 0x12u }, { 0u, 0u, 2415u, 1u, 0x12u }, { 0u, 0u, 2416u, 2u, 0x12u }, { 0u, 0u, 2418u, 3u, 0x12u },
+        { 0u, 0u, 2421u, 4u, 0x12u }, { 0u, 0u, 2425u, 2u, 0x12u }, { 0u, 0u, 2427u, 1u, 0x12u }, { 0u, 0u, 2428u, 2u, 0x12u }, { 0u, 0u, 2430u, 3u, 0x12u },
+        { 0u, 0u, 2433u, 2u, 0x12u }, { 0u, 0u, 2435u, 3u, 0x12u }, { 0u, 0u, 2438u, 2u, 0x12u }, { 0u, 0u, 2440u, 2u, 0x12u }, { 0u, 0u, 2442u, 3u, 0x12u },
+        { 0u, 0u, 2445u, 4u, 0x12u }, { 0u, 0u, 2449u, 2u, 0x12u }, { 0u, 0u, 2451u, 2u, 0x12u }, { 0u, 0u, 2453u, 3u, 0x12u }, { 0u, 0u, 2456u, 3u, 0x12u },
+        { 2459u, 2u, 2459u, 2u, 0x3u }, { 2461u, 2u, 2461u, 2u, 0x3u }, { 2463u, 2u, 2463u, 2u, 0x3u }, { 2465u, 2u, 2465u, 2u, 0x3u }, { 2467u, 2u, 2467u, 2u, 0x3u },
+        { 2469u, 2u, 2469u, 2u, 0x3u }, { 2471u, 2u, 2471u, 2u, 0x3u }, { 2473u, 2u, 2473u, 2u, 0x3u }, { 2475u, 2u, 2475u, 2u, 0x3u }, { 2477u, 2u, 2477u, 2u, 0x3u },
+        { 2479u, 2u, 2479u, 2u, 0x3u }, { 0u, 0u, 2481u, 2u, 0x12u }, { 0u, 0u, 2483u, 3u, 0x12u }, { 0u, 0u, 2486u, 2u, 0x12u }, { 0u, 0u, 2488u, 3u, 0x12u },
+        { 2491u, 2u, 2491u, 2u, 0x3u }, { 2493u, 2u, 2493u, 2u, 0x3u }, { 2495u, 2u, 2495u, 2u, 0x3u }, { 2497u, 2u, 2497u, 2u, 0x3u }, { 2499u, 2u, 2499u, 2u, 0x3u },
+        { 2501u, 2u, 2501u, 2u, 0x3u }, { 2503u, 2u, 2503u, 2u, 0x3u }, { 2505u, 2u, 2505u, 2u, 0x3u }, { 2507u, 2u, 2507u, 2u, 0x3u }, { 2509u, 2u, 2509u, 2u, 0x3u },
+        { 2511u, 2u, 2511u, 2u, 0x3u }, { 2513u, 2u, 2513u, 2u, 0x3u }, { 2515u, 2u, 2515u, 2u, 0x3u }, { 2517u, 2u, 2517u, 2u, 0x3u }, { 2519u, 2u, 2519u, 2u, 0x3u },
+        { 2521u, 2u, 2521u, 2u, 0x3u }, { 2523u, 2u, 2523u, 2u, 0x3u }, { 2525u, 2u, 2525u, 2u, 0x3u }, { 2527u, 2u, 2527u, 2u, 0x3u }, { 2529u, 2u, 2529u, 2u, 0x3u },
+        { 2531u, 2u, 2531u, 2u, 0x3u }, { 2533u, 2u, 2533u, 2u, 0x3u }, { 2535u, 2u, 2535u, 2u, 0x3u }, { 2537u, 2u, 2537u, 2u, 0x3u }, { 2539u, 2u, 2539u, 2u, 0x3u },
+        { 2541u, 2u, 2541u, 2u, 0x3u }, { 2543u, 2u, 2543u, 2u, 0x3u }, { 2545u, 2u, 2545u, 2u, 0x3u }, { 2547u, 2u, 2547u, 2u, 0x3u }, { 2549u, 2u, 2549u, 2u, 0x3u },
+        { 2551u, 2u, 2551u, 2u, 0x3u }, { 2553u, 2u, 2553u, 2u, 0x3u }, { 2555u, 2u, 2555u, 2u, 0x3u }, { 2557u, 1u, 2557u, 1u, 0x17u }, { 2558u, 1u, 2558u, 1u, 0x17u },
+        { 0u, 0u, 2559u, 2u, 0x12u }, { 0u, 0u, 2561u, 2u, 0x12u }, { 0u, 0u, 2563u, 2u, 0x12u }, { 0u, 0u, 2565u, 2u, 0x12u }, { 0u, 0u, 2567u, 2u, 0x12u },
+        { 0u, 0u, 2569u, 2u, 0x12u }, { 0u, 0u, 2571u, 2u, 0x12u }, { 0u, 0u, 2573u, 2u, 0x12u }, { 0u, 0u, 2575u, 2u, 0x12u }, { 0u, 0u, 2577u, 2u, 0x12u },
+        { 0u, 0u, 2579u, 2u, 0x12u }, { 0u, 0u, 2581u, 3u, 0x12u }, { 0u, 0u, 2584u, 3u, 0x12u }, { 0u, 0u, 2587u, 3u, 0x12u }, { 0u, 0u, 2590u, 3u, 0x12u },
+        { 0u, 0u, 2593u, 3u, 0x12u }, { 0u, 0u, 2596u, 3u, 0x12u }, { 0u, 0u, 2599u, 3u, 0x12u }, { 0u, 0u, 2602u, 3u, 0x12u }, { 0u, 0u, 2605u, 3u, 0x12u },
+        { 0u, 0u, 2608u, 4u, 0x12u }, { 0u, 0u, 2612u, 4u, 0x12u }, { 0u, 0u, 2616u, 4u, 0x12u }, { 0u, 0u, 2620u, 4u, 0x12u }, { 0u, 0u, 2624u, 4u, 0x12u },
+        { 0u, 0u, 2628u, 4u, 0x12u }, { 0u, 0u, 2632u, 4u, 0x12u }, { 0u, 0u, 2636u, 4u, 0x12u }, { 0u, 0u, 2640u, 4u, 0x12u }, { 0u, 0u, 2644u, 4u, 0x12u },
+        { 0u, 0u, 2648u, 4u, 0x12u }, { 0u, 0u, 2652u, 2u, 0x12u }, { 0u, 0u, 2654u, 2u, 0x12u }, { 0u, 0u, 2656u, 2u, 0x12u }, { 0u, 0u, 2658u, 2u, 0x12u },
+        { 0u, 0u, 2660u, 2u, 0x12u }, { 0u, 0u, 2662u, 2u, 0x12u }, { 0u, 0u, 2664u, 2u, 0x12u }, { 0u, 0u, 2666u, 2u, 0x12u }, { 0u, 0u, 2668u, 2u, 0x12u },
+        { 0u, 0u, 2670u, 3u, 0x12u }, { 0u, 0u, 2673u, 3u, 0x12u }, { 0u, 0u, 2676u, 3u, 0x12u }, { 0u, 0u, 2679u, 3u, 0x12u }, { 0u, 0u, 2682u, 3u, 0x12u },
+        { 0u, 0u, 2685u, 3u, 0x12u }, { 0u, 0u, 2688u, 3u, 0x12u }, { 0u, 0u, 2691u, 3u, 0x12u }, { 0u, 0u, 2694u, 3u, 0x12u }, { 0u, 0u, 2697u, 3u, 0x12u },
+        { 0u, 0u, 2700u, 3u, 0x12u }, { 0u, 0u, 2703u, 3u, 0x12u }, { 0u, 0u, 2706u, 3u, 0x12u }, { 0u, 0u, 2709u, 3u, 0x12u }, { 0u, 0u, 2712u, 3u, 0x12u },
+        { 0u, 0u, 2715u, 3u, 0x12u }, { 0u, 0u, 2718u, 3u, 0x12u }, { 0u, 0u, 2721u, 3u, 0x12u }, { 0u, 0u, 2724u, 3u, 0x12u }, { 0u, 0u, 2727u, 3u, 0x12u },
+        { 0u, 0u, 2730u, 3u, 0x12u }, { 0u, 0u, 2733u, 3u, 0x12u }, { 0u, 0u, 2736u, 3u, 0x12u }, { 0u, 0u, 2739u, 3u, 0x12u }, { 0u, 0u, 2742u, 3u, 0x12u },
+        { 0u, 0u, 2745u, 3u, 0x12u }, { 0u, 0u, 2748u, 3u, 0x12u }, { 0u, 0u, 2751u, 3u, 0x12u }, { 0u, 0u, 2754u, 3u, 0x12u }, { 0u, 0u, 2757u, 3u, 0x12u },
+        { 0u, 0u, 2760u, 3u, 0x12u }, { 0u, 0u, 2763u, 3u, 0x12u }, { 0u, 0u, 2766u, 3u, 0x12u }, { 0u, 0u, 2769u, 3u, 0x12u }, { 0u, 0u, 2772u, 3u, 0x12u },
+        { 0u, 0u, 2775u, 3u, 0x12u }, { 0u, 0u, 2778u, 3u, 0x12u }, { 0u, 0u, 2781u, 1u, 0x12u }, { 0u, 0u, 2782u, 1u, 0x12u }, { 0u, 0u, 2783u, 1u, 0x12u },
+        { 0u, 0u, 2784u, 4u, 0x12u }, { 0u, 0u, 2788u, 3u, 0x12u }, { 0u, 0u, 2791u, 2u, 0x12u }, { 0u, 0u, 2793u, 3u, 0x12u }, { 2796u, 2u, 2796u, 2u, 0x17u },
+        { 0u, 0u, 2798u, 1u, 0x12u }, { 0u, 0u, 2799u, 1u, 0x12u }, { 0u, 0u, 2800u, 1u, 0x12u }, { 0u, 0u, 2801u, 1u, 0x12u }, { 0u, 0u, 2802u, 1u, 0x12u },
+        { 0u, 0u, 2803u, 1u, 0x12u }, { 0u, 0u, 2804u, 1u, 0x12u }, { 0u, 0u, 2805u, 1u, 0x12u }, { 0u, 0u, 2806u, 1u, 0x12u }, { 0u, 0u, 2807u, 1u, 0x12u },
+        { 0u, 0u, 2808u, 1u, 0x12u }, { 0u, 0u, 2809u, 1u, 0x12u }, { 0u, 0u, 2810u, 1u, 0x12u }, { 0u, 0u, 2811u, 1u, 0x12u }, { 0u, 0u, 2812u, 1u, 0x12u },
+        { 0u, 0u, 2813u, 1u, 0x12u }, { 0u, 0u, 2814u, 1u, 0x12u }, { 0u, 0u, 2815u, 1u, 0x12u }, { 0u, 0u, 2816u, 1u, 0x12u }, { 0u, 0u, 2817u, 1u, 0x12u },
+        { 0u, 0u, 2818u, 1u, 0x12u }, { 0u, 0u, 2819u, 1u, 0x12u }, { 0u, 0u, 2820u, 1u, 0x12u }, { 0u, 0u, 2821u, 1u, 0x12u }, { 0u, 0u, 2822u, 1u, 0x12u },
+        { 0u, 0u, 2823u, 1u, 0x12u }, { 0u, 0u, 2824u, 1u, 0x12u }, { 0u, 0u, 2825u, 1u, 0x12u }, { 0u, 0u, 2826u, 1u, 0x12u }, { 0u, 0u, 2827u, 1u, 0x12u },
+        { 0u, 0u, 2828u, 1u, 0x12u }, { 0u, 0u, 2829u, 1u, 0x12u }, { 0u, 0u, 2830u, 1u, 0x12u }, { 0u, 0u, 2831u, 1u, 0x12u }, { 0u, 0u, 2832u, 1u, 0x12u },
+        { 0u, 0u, 2833u, 1u, 0x12u }, { 0u, 0u, 2834u, 1u, 0x12u }, { 0u, 0u, 2835u, 1u, 0x12u }, { 0u, 0u, 2836u, 1u, 0x12u }, { 0u, 0u, 2837u, 1u, 0x12u },
+        { 0u, 0u, 2838u, 1u, 0x12u }, { 0u, 0u, 2839u, 1u, 0x12u }, { 0u, 0u, 2840u, 1u, 0x12u }, { 0u, 0u, 2841u, 1u, 0x12u }, { 0u, 0u, 2842u, 1u, 0x12u },
+        { 0u, 0u, 2843u, 1u, 0x12u }, { 0u, 0u, 2844u, 1u, 0x12u }, { 0u, 0u, 2845u, 1u, 0x12u }, { 0u, 0u, 2846u, 1u, 0x12u }, { 0u, 0u, 2847u, 1u, 0x12u },
+        { 0u, 0u, 2848u, 1u, 0x12u }, { 0u, 0u, 2849u, 1u, 0x12u }, { 0u, 0u, 2850u, 1u, 0x12u }, { 0u, 0u, 2851u, 1u, 0x12u }, { 0u, 0u, 2852u, 1u, 0x12u },
+        { 0u, 0u, 2853u, 1u, 0x12u }, { 0u, 0u, 2854u, 1u, 0x12u }, { 0u, 0u, 2855u, 1u, 0x12u }, { 0u, 0u, 2856u, 1u, 0x12u }, { 0u, 0u, 2857u, 1u, 0x12u },
+        { 0u, 0u, 2858u, 1u, 0x12u }, { 0u, 0u, 2859u, 1u, 0x12u }, { 0u, 0u, 2860u, 1u, 0x12u }, { 0u, 0u, 2861u, 1u, 0x12u }, { 0u, 0u, 2862u, 1u, 0x12u },
+        { 0u, 0u, 2863u, 1u, 0x12u }, { 0u, 0u, 2864u, 1u, 0x12u }, { 0u, 0u, 2865u, 1u, 0x12u }, { 0u, 0u, 2866u, 1u, 0x12u }, { 0u, 0u, 2867u, 1u, 0x12u },
+        { 0u, 0u, 2868u, 1u, 0x12u }, { 0u, 0u, 2869u, 1u, 0x12u }, { 0u, 0u, 2870u, 1u, 0x12u }, { 0u, 0u, 2871u, 1u, 0x12u }, { 0u, 0u, 2872u, 1u, 0x12u },
+        { 0u, 0u, 2873u, 1u, 0x12u }, { 0u, 0u, 2874u, 1u, 0x12u }, { 0u, 0u, 2875u, 1u, 0x12u }, { 0u, 0u, 2876u, 1u, 0x12u }, { 0u, 0u, 2877u, 1u, 0x12u },
+        { 0u, 0u, 2878u, 1u, 0x12u }, { 0u, 0u, 2879u, 1u, 0x12u }, { 0u, 0u, 2880u, 1u, 0x12u }, { 0u, 0u, 2881u, 1u, 0x12u }, { 0u, 0u, 2882u, 1u, 0x12u },
+        { 0u, 0u, 2883u, 1u, 0x12u }, { 0u, 0u, 2884u, 1u, 0x12u }, { 0u, 0u, 2885u, 1u, 0x12u }, { 0u, 0u, 2886u, 1u, 0x12u }, { 0u, 0u, 2887u, 1u, 0x12u },
+        { 0u, 0u, 2888u, 1u, 0x12u }, { 0u, 0u, 2889u, 1u, 0x12u }, { 0u, 0u, 2890u, 1u, 0x12u }, { 0u, 0u, 2891u, 1u, 0x12u }, { 0u, 0u, 2892u, 1u, 0x12u },
+        { 0u, 0u, 2893u, 1u, 0x12u }, { 0u, 0u, 2894u, 1u, 0x12u }, { 0u, 0u, 2895u, 1u, 0x12u }, { 0u, 0u, 2896u, 1u, 0x12u }, { 0u, 0u, 2897u, 1u, 0x12u },
+        { 0u, 0u, 2898u, 1u, 0x12u }, { 0u, 0u, 2899u, 1u, 0x12u }, { 0u, 0u, 2900u, 1u, 0x12u }, { 0u, 0u, 2901u, 1u, 0x12u }, { 0u, 0u, 2902u, 1u, 0x12u },
+        { 0u, 0u, 2903u, 1u, 0x12u }, { 0u, 0u, 2904u, 1u, 0x12u }, { 0u, 0u, 2905u, 1u, 0x12u }, { 0u, 0u, 2906u, 1u, 0x12u }, { 0u, 0u, 2907u, 1u, 0x12u },
+        { 0u, 0u, 2908u, 1u, 0x12u }, { 0u, 0u, 2909u, 1u, 0x12u }, { 0u, 0u, 2910u, 1u, 0x12u }, { 0u, 0u, 2911u, 1u, 0x12u }, { 0u, 0u, 2912u, 1u, 0x12u },
+        { 0u, 0u, 2913u, 1u, 0x12u }, { 0u, 0u, 2914u, 1u, 0x12u }, { 0u, 0u, 2915u, 1u, 0x12u }, { 0u, 0u, 2916u, 1u, 0x12u }, { 0u, 0u, 2917u, 1u, 0x12u },
+        { 0u, 0u, 2918u, 1u, 0x12u }, { 0u, 0u, 2919u, 1u, 0x12u }, { 0u, 0u, 2920u, 1u, 0x12u }, { 0u, 0u, 2921u, 1u, 0x12u }, { 0u, 0u, 2922u, 1u, 0x12u },
+        { 0u, 0u, 2923u, 1u, 0x12u }, { 0u, 0u, 2924u, 1u, 0x12u }, { 0u, 0u, 2925u, 1u, 0x12u }, { 0u, 0u, 2926u, 1u, 0x12u }, { 0u, 0u, 2927u, 1u, 0x12u },
+        { 0u, 0u, 2928u, 1u, 0x12u }, { 0u, 0u, 2929u, 1u, 0x12u }, { 0u, 0u, 2930u, 1u, 0x12u }, { 0u, 0u, 2931u, 1u, 0x12u }, { 0u, 0u, 2932u, 1u, 0x12u },
+        { 0u, 0u, 2933u, 1u, 0x12u }, { 0u, 0u, 2934u, 1u, 0x12u }, { 0u, 0u, 2935u, 1u, 0x12u }, { 0u, 0u, 2936u, 1u, 0x12u }, { 0u, 0u, 2937u, 1u, 0x12u },
+        { 0u, 0u, 2938u, 1u, 0x12u }, { 0u, 0u, 2939u, 1u, 0x12u }, { 0u, 0u, 2940u, 1u, 0x12u }, { 0u, 0u, 2941u, 1u, 0x12u }, { 0u, 0u, 2942u, 1u, 0x12u },
+        { 0u, 0u, 2943u, 1u, 0x12u }, { 0u, 0u, 2944u, 1u, 0x12u }, { 0u, 0u, 2945u, 1u, 0x12u }, { 0u, 0u, 2946u, 1u, 0x12u }, { 0u, 0u, 2947u, 1u, 0x12u },
+        { 0u, 0u, 2948u, 1u, 0x12u }, { 0u, 0u, 2949u, 1u, 0x12u }, { 0u, 0u, 2950u, 1u, 0x12u }, { 0u, 0u, 2951u, 1u, 0x12u }, { 0u, 0u, 2952u, 1u, 0x12u },
+        { 0u, 0u, 2953u, 1u, 0x12u }, { 0u, 0u, 2954u, 1u, 0x12u }, { 0u, 0u, 2955u, 1u, 0x12u }, { 0u, 0u, 2956u, 1u, 0x12u }, { 0u, 0u, 2957u, 1u, 0x12u },
+        { 0u, 0u, 2958u, 1u, 0x12u }, { 0u, 0u, 2959u, 1u, 0x12u }, { 0u, 0u, 2960u, 1u, 0x12u }, { 0u, 0u, 2961u, 1u, 0x12u }, { 0u, 0u, 2962u, 1u, 0x12u },
+        { 0u, 0u, 2963u, 1u, 0x12u }, { 0u, 0u, 2964u, 1u, 0x12u }, { 0u, 0u, 2965u, 1u, 0x12u }, { 0u, 0u, 2966u, 1u, 0x12u }, { 0u, 0u, 2967u, 1u, 0x12u },
+        { 0u, 0u, 2968u, 1u, 0x12u }, { 0u, 0u, 2969u, 1u, 0x12u }, { 0u, 0u, 2970u, 1u, 0x12u }, { 0u, 0u, 2971u, 1u, 0x12u }, { 0u, 0u, 2972u, 1u, 0x12u },
+        { 0u, 0u, 2973u, 1u, 0x12u }, { 0u, 0u, 2974u, 1u, 0x12u }, { 0u, 0u, 2975u, 1u, 0x12u }, { 0u, 0u, 2976u, 1u, 0x12u }, { 0u, 0u, 2977u, 1u, 0x12u },
+        { 0u, 0u, 2978u, 1u, 0x12u }, { 0u, 0u, 2979u, 1u, 0x12u }, { 0u, 0u, 2980u, 1u, 0x12u }, { 0u, 0u, 2981u, 1u, 0x12u }, { 0u, 0u, 2982u, 1u, 0x12u },
+        { 0u, 0u, 2983u, 1u, 0x12u }, { 0u, 0u, 2984u, 1u, 0x12u }, { 0u, 0u, 2985u, 1u, 0x12u }, { 0u, 0u, 2986u, 1u, 0x12u }, { 0u, 0u, 2987u, 1u, 0x12u },
+        { 0u, 0u, 2988u, 1u, 0x12u }, { 0u, 0u, 2989u, 1u, 0x12u }, { 0u, 0u, 2990u, 1u, 0x12u }, { 0u, 0u, 2991u, 1u, 0x12u }, { 0u, 0u, 2992u, 1u, 0x12u },
+        { 0u, 0u, 2993u, 1u, 0x12u }, { 0u, 0u, 2994u, 1u, 0x12u }, { 0u, 0u, 2995u, 1u, 0x12u }, { 0u, 0u, 2996u, 1u, 0x12u }, { 0u, 0u, 2997u, 1u, 0x12u },
+        { 0u, 0u, 2998u, 1u, 0x12u }, { 0u, 0u, 2999u, 1u, 0x12u }, { 0u, 0u, 3000u, 1u, 0x12u }, { 0u, 0u, 3001u, 1u, 0x12u }, { 0u, 0u, 3002u, 1u, 0x12u },
+        { 0u, 0u, 3003u, 1u, 0x12u }, { 0u, 0u, 3004u, 1u, 0x12u }, { 0u, 0u, 3005u, 1u, 0x12u }, { 0u, 0u, 3006u, 1u, 0x12u }, { 0u, 0u, 3007u, 1u, 0x12u },
+        { 0u, 0u, 3008u, 1u, 0x12u }, { 0u, 0u, 3009u, 1u, 0x12u }, { 0u, 0u, 3010u, 1u, 0x12u }, { 0u, 0u, 3011u, 1u, 0x12u }, { 0u, 0u, 3012u, 1u, 0x12u },
+        { 0u, 0u, 3013u, 1u, 0x12u }, { 0u, 0u, 3014u, 1u, 0x12u }, { 0u, 0u, 3015u, 1u, 0x12u }, { 0u, 0u, 3016u, 1u, 0x12u }, { 0u, 0u, 3017u, 1u, 0x12u },
+        { 3018u, 2u, 3018u, 2u, 0x3u }, { 3020u, 2u, 3020u, 2u, 0x3u }, { 3022u, 2u, 3022u, 2u, 0x3u }, { 3024u, 2u, 3024u, 2u, 0x3u }, { 3026u, 2u, 3026u, 2u, 0x3u },
+        { 3028u, 2u, 3028u, 2u, 0x3u }, { 3030u, 2u, 3030u, 2u, 0x3u }, { 3032u, 2u, 3032u, 2u, 0x3u }, { 3034u, 2u, 3034u, 2u, 0x3u }, { 3036u, 2u, 3036u, 2u, 0x3u },
+        { 3038u, 2u, 3038u, 2u, 0x3u }, { 3040u, 2u, 3040u, 2u, 0x3u }, { 3042u, 2u, 3042u, 2u, 0x3u }, { 3044u, 2u, 3044u, 2u, 0x3u }, { 3046u, 2u, 3046u, 2u, 0x3u },
+        { 3048u, 2u, 3048u, 2u, 0x3u }, { 3050u, 2u, 3050u, 2u, 0x3u }, { 3052u, 2u, 3052u, 2u, 0x3u }, { 3054u, 2u, 3054u, 2u, 0x3u }, { 3056u, 2u, 3056u, 2u, 0x3u },
+        { 3058u, 2u, 3058u, 2u, 0x3u }, { 3060u, 2u, 3060u, 2u, 0x3u }, { 3062u, 2u, 3062u, 2u, 0x3u }, { 3064u, 2u, 3064u, 2u, 0x3u }, { 3066u, 2u, 3066u, 2u, 0x3u },
+        { 3068u, 2u, 3068u, 2u, 0x3u }, { 0u, 0u, 3070u, 2u, 0x12u }, { 0u, 0u, 3072u, 2u, 0x12u }, { 3074u, 2u, 3074u, 2u, 0x3u }, { 0u, 0u, 3076u, 2u, 0x12u },
+        { 3078u, 2u, 3078u, 2u, 0x3u }, { 3080u, 2u, 3080u, 2u, 0x3u }, { 3082u, 2u, 3082u, 2u, 0x3u }, { 3084u, 2u, 3084u, 2u, 0x3u }, { 3086u, 2u, 3086u, 2u, 0x3u },
+        { 3088u, 2u, 3088u, 2u, 0x3u }, { 3090u, 2u, 3090u, 2u, 0x3u }, { 3092u, 2u, 3092u, 2u, 0x3u }, { 3094u, 2u, 3094u, 2u, 0x3u }, { 3096u, 2u, 3096u, 2u, 0x3u },
+        { 3098u, 2u, 3098u, 2u, 0x3u }, { 3100u, 2u, 3100u, 2u, 0x3u }, { 3102u, 2u, 3102u, 2u, 0x3u }, { 3104u, 2u, 3104u, 2u, 0x3u }, { 3106u, 2u, 3106u, 2u, 0x3u },
+        { 3108u, 2u, 3108u, 2u, 0x3u }, { 3110u, 2u, 3110u, 2u, 0x3u }, { 3112u, 2u, 3112u, 2u, 0x3u }, { 3114u, 2u, 3114u, 2u, 0x3u }, { 3116u, 2u, 3116u, 2u, 0x3u },
+        { 3118u, 2u, 3118u, 2u, 0x3u }, { 3120u, 2u, 3120u, 2u, 0x3u }, { 3122u, 2u, 3122u, 2u, 0x3u }, { 3124u, 2u, 3124u, 2u, 0x3u }, { 3126u, 2u, 3126u, 2u, 0x3u },
+        { 3128u, 2u, 3128u, 2u, 0x3u }, { 3130u, 2u, 3130u, 2u, 0x3u }, { 3132u, 2u, 3132u, 2u, 0x3u }, { 3134u, 2u, 3134u, 2u, 0x3u }, { 3136u, 2u, 3136u, 2u, 0x3u },
+        { 3138u, 2u, 3138u, 2u, 0x3u }, { 0u, 0u, 3140u, 2u, 0x12u }, { 0u, 0u, 3142u, 1u, 0x12u }, { 0u, 0u, 3143u, 1u, 0x12u }, { 0u, 0u, 3144u, 1u, 0x12u },
+        { 0u, 0u, 3145u, 1u, 0x12u }, { 0u, 0u, 3146u, 1u, 0x12u }, { 0u, 0u, 3147u, 1u, 0x12u }, { 0u, 0u, 3148u, 1u, 0x12u }, { 0u, 0u, 3149u, 1u, 0x12u },
+        { 0u, 0u, 3150u, 1u, 0x12u }, { 0u, 0u, 3151u, 1u, 0x12u }, { 0u, 0u, 3152u, 1u, 0x12u }, { 0u, 0u, 3153u, 1u, 0x12u }, { 0u, 0u, 3154u, 1u, 0x12u },
+        { 0u, 0u, 3155u, 1u, 0x12u }, { 0u, 0u, 3156u, 1u, 0x12u }, { 0u, 0u, 3157u, 1u, 0x12u }, { 0u, 0u, 3158u, 1u, 0x12u }, { 0u, 0u, 3159u, 1u, 0x12u },
+        { 0u, 0u, 3160u, 1u, 0x12u }, { 0u, 0u, 3161u, 1u, 0x12u }, { 0u, 0u, 3162u, 1u, 0x12u }, { 0u, 0u, 3163u, 1u, 0x12u }, { 0u, 0u, 3164u, 1u, 0x12u },
+        { 0u, 0u, 3165u, 1u, 0x12u }, { 0u, 0u, 3166u, 1u, 0x12u }, { 0u, 0u, 3167u, 1u, 0x12u }, { 0u, 0u, 3168u, 1u, 0x12u }, { 0u, 0u, 3169u, 1u, 0x12u },
+        { 0u, 0u, 3170u, 1u, 0x12u }, { 0u, 0u, 3171u, 1u, 0x12u }, { 0u, 0u, 3172u, 1u, 0x12u }, { 0u, 0u, 3173u, 1u, 0x12u }, { 0u, 0u, 3174u, 1u, 0x12u },
+        { 0u, 0u, 3175u, 1u, 0x12u }, { 0u, 0u, 3176u, 1u, 0x12u }, { 0u, 0u, 3177u, 1u, 0x12u }, { 0u, 0u, 3178u, 1u, 0x12u }, { 0u, 0u, 3179u, 1u, 0x12u },
+        { 0u, 0u, 3180u, 1u, 0x12u }, { 0u, 0u, 3181u, 1u, 0x12u }, { 0u, 0u, 3182u, 1u, 0x12u }, { 0u, 0u, 3183u, 1u, 0x12u }, { 0u, 0u, 3184u, 1u, 0x12u },
+        { 0u, 0u, 3185u, 1u, 0x12u }, { 0u, 0u, 3186u, 1u, 0x12u }, { 0u, 0u, 3187u, 1u, 0x12u }, { 0u, 0u, 3188u, 1u, 0x12u }, { 0u, 0u, 3189u, 1u, 0x12u },
+        { 0u, 0u, 3190u, 1u, 0x12u }, { 0u, 0u, 3191u, 1u, 0x12u }, { 0u, 0u, 3192u, 1u, 0x12u }, { 0u, 0u, 3193u, 1u, 0x12u }, { 0u, 0u, 3194u, 1u, 0x12u },
+        { 0u, 0u, 3195u, 1u, 0x12u }, { 0u, 0u, 3196u, 1u, 0x12u }, { 0u, 0u, 3197u, 1u, 0x12u }, { 0u, 0u, 3198u, 1u, 0x12u }, { 0u, 0u, 3199u, 1u, 0x12u },
+        { 0u, 0u, 3200u, 1u, 0x12u }, { 0u, 0u, 3201u, 1u, 0x12u }, { 0u, 0u, 3202u, 1u, 0x12u }, { 0u, 0u, 3203u, 1u, 0x12u }, { 0u, 0u, 3204u, 1u, 0x12u },
+        { 0u, 0u, 3205u, 1u, 0x12u }, { 0u, 0u, 3206u, 1u, 0x12u }, { 0u, 0u, 3207u, 1u, 0x12u }, { 0u, 0u, 3208u, 1u, 0x12u }, { 0u, 0u, 3209u, 1u, 0x12u },
+        { 0u, 0u, 3210u, 1u, 0x12u }, { 0u, 0u, 3211u, 1u, 0x12u }, { 0u, 0u, 3212u, 1u, 0x12u }, { 0u, 0u, 3213u, 1u, 0x12u }, { 0u, 0u, 3214u, 1u, 0x12u },
+        { 0u, 0u, 3215u, 1u, 0x12u }, { 0u, 0u, 3216u, 1u, 0x12u }, { 0u, 0u, 3217u, 1u, 0x12u }, { 0u, 0u, 3218u, 1u, 0x12u }, { 0u, 0u, 3219u, 1u, 0x12u },
+        { 0u, 0u, 3220u, 1u, 0x12u }, { 0u, 0u, 3221u, 1u, 0x12u }, { 0u, 0u, 3222u, 1u, 0x12u }, { 0u, 0u, 3223u, 1u, 0x12u }, { 0u, 0u, 3224u, 1u, 0x12u },
+        { 0u, 0u, 3225u, 1u, 0x12u }, { 0u, 0u, 3226u, 1u, 0x12u }, { 0u, 0u, 3227u, 1u, 0x12u }, { 0u, 0u, 3228u, 1u, 0x12u }, { 0u, 0u, 3229u, 1u, 0x12u },
+        { 0u, 0u, 3230u, 1u, 0x12u }, { 0u, 0u, 3231u, 1u, 0x12u }, { 0u, 0u, 3232u, 1u, 0x12u }, { 0u, 0u, 3233u, 1u, 0x12u }, { 0u, 0u, 3234u, 1u, 0x12u },
+        { 0u, 0u, 3235u, 1u, 0x12u }, { 0u, 0u, 3236u, 1u, 0x12u }, { 0u, 0u, 3237u, 1u, 0x12u }, { 0u, 0u, 3238u, 1u, 0x12u }, { 0u, 0u, 3239u, 1u, 0x12u },
+        { 0u, 0u, 3240u, 1u, 0x12u }, { 0u, 0u, 3241u, 1u, 0x12u }, { 0u, 0u, 3242u, 1u, 0x12u }, { 0u, 0u, 3243u, 1u, 0x12u }, { 0u, 0u, 3244u, 1u, 0x12u },
+        { 0u, 0u, 3245u, 1u, 0x12u }, { 0u, 0u, 3246u, 3u, 0x12u }, { 0u, 0u, 3249u, 3u, 0x12u }, { 0u, 0u, 3252u, 3u, 0x12u }, { 0u, 0u, 3255u, 3u, 0x12u },
+        { 0u, 0u, 3258u, 3u, 0x12u }, { 0u, 0u, 3261u, 3u, 0x12u }, { 0u, 0u, 3264u, 3u, 0x12u }, { 0u, 0u, 3267u, 3u, 0x12u }, { 0u, 0u, 3270u, 3u, 0x12u },
+        { 0u, 0u, 3273u, 3u, 0x12u }, { 0u, 0u, 3276u, 3u, 0x12u }, { 0u, 0u, 3279u, 3u, 0x12u }, { 0u, 0u, 3282u, 3u, 0x12u }, { 0u, 0u, 3285u, 3u, 0x12u },
+        { 0u, 0u, 3288u, 4u, 0x12u }, { 0u, 0u, 3292u, 4u, 0x12u }, { 0u, 0u, 3296u, 4u, 0x12u }, { 0u, 0u, 3300u, 4u, 0x12u }, { 0u, 0u, 3304u, 4u, 0x12u },
+        { 0u, 0u, 3308u, 4u, 0x12u }, { 0u, 0u, 3312u, 4u, 0x12u }, { 0u, 0u, 3316u, 4u, 0x12u }, { 0u, 0u, 3320u, 4u, 0x12u }, { 0u, 0u, 3324u, 4u, 0x12u },
+        { 0u, 0u, 3328u, 4u, 0x12u }, { 0u, 0u, 3332u, 4u, 0x12u }, { 0u, 0u, 3336u, 4u, 0x12u }, { 0u, 0u, 3340u, 4u, 0x12u }, { 0u, 0u, 3344u, 4u, 0x12u },
+        { 0u, 0u, 3348u, 7u, 0x12u }, { 0u, 0u, 3355u, 6u, 0x12u }, { 0u, 0u, 3361u, 3u, 0x12u }, { 0u, 0u, 3364u, 3u, 0x12u }, { 0u, 0u, 3367u, 3u, 0x12u },
+        { 0u, 0u, 3370u, 3u, 0x12u }, { 0u, 0u, 3373u, 3u, 0x12u }, { 0u, 0u, 3376u, 3u, 0x12u }, { 0u, 0u, 3379u, 3u, 0x12u }, { 0u, 0u, 3382u, 3u, 0x12u },
+        { 0u, 0u, 3385u, 3u, 0x12u }, { 0u, 0u, 3388u, 3u, 0x12u }, { 0u, 0u, 3391u, 3u, 0x12u }, { 0u, 0u, 3394u, 3u, 0x12u }, { 0u, 0u, 3397u, 3u, 0x12u },
+        { 0u, 0u, 3400u, 3u, 0x12u }, { 0u, 0u, 3403u, 3u, 0x12u }, { 0u, 0u, 3406u, 3u, 0x12u }, { 0u, 0u, 3409u, 3u, 0x12u }, { 0u, 0u, 3412u, 3u, 0x12u },
+        { 0u, 0u, 3415u, 3u, 0x12u }, { 0u, 0u, 3418u, 3u, 0x12u }, { 0u, 0u, 3421u, 3u, 0x12u }, { 0u, 0u, 3424u, 3u, 0x12u }, { 0u, 0u, 3427u, 3u, 0x12u },
+        { 0u, 0u, 3430u, 3u, 0x12u }, { 0u, 0u, 3433u, 3u, 0x12u }, { 0u, 0u, 3436u, 3u, 0x12u }, { 0u, 0u, 3439u, 3u, 0x12u }, { 0u, 0u, 3442u, 3u, 0x12u },
+        { 0u, 0u, 3445u, 3u, 0x12u }, { 0u, 0u, 3448u, 3u, 0x12u }, { 0u, 0u, 3451u, 3u, 0x12u }, { 0u, 0u, 3454u, 3u, 0x12u }, { 0u, 0u, 3457u, 3u, 0x12u },
+        { 0u, 0u, 3460u, 3u, 0x12u }, { 0u, 0u, 3463u, 3u, 0x12u }, { 0u, 0u, 3466u, 3u, 0x12u }, { 0u, 0u, 3469u, 1u, 0x12u }, { 0u, 0u, 3470u, 1u, 0x12u },
+        { 0u, 0u, 3471u, 1u, 0x12u }, { 0u, 0u, 3472u, 3u, 0x12u }, { 0u, 0u, 3475u, 2u, 0x12u }, { 0u, 0u, 3477u, 2u, 0x12u }, { 0u, 0u, 3479u, 2u, 0x12u },
+        { 0u, 0u, 3481u, 2u, 0x12u }, { 0u, 0u, 3483u, 2u, 0x12u }, { 0u, 0u, 3485u, 2u, 0x12u }, { 0u, 0u, 3487u, 2u, 0x12u }, { 0u, 0u, 3489u, 2u, 0x12u },
+        { 0u, 0u, 3491u, 2u, 0x12u }, { 0u, 0u, 3493u, 2u, 0x12u }, { 0u, 0u, 3495u, 2u, 0x12u }, { 0u, 0u, 3497u, 2u, 0x12u }, { 0u, 0u, 3499u, 2u, 0x12u },
+        { 0u, 0u, 3501u, 2u, 0x12u }, { 0u, 0u, 3503u, 2u, 0x12u }, { 0u, 0u, 3505u, 2u, 0x12u }, { 0u, 0u, 3507u, 2u, 0x12u }, { 0u, 0u, 3509u, 2u, 0x12u },
+        { 0u, 0u, 3511u, 2u, 0x12u }, { 0u, 0u, 3513u, 2u, 0x12u }, { 0u, 0u, 3515u, 2u, 0x12u }, { 0u, 0u, 3517u, 2u, 0x12u }, { 0u, 0u, 3519u, 2u, 0x12u },
+        { 0u, 0u, 3521u, 2u, 0x12u }, { 0u, 0u, 3523u, 2u, 0x12u }, { 0u, 0u, 3525u, 2u, 0x12u }, { 0u, 0u, 3527u, 2u, 0x12u }, { 0u, 0u, 3529u, 2u, 0x12u },
+        { 0u, 0u, 3531u, 2u, 0x12u }, { 0u, 0u, 3533u, 5u, 0x12u }, { 0u, 0u, 3538u, 4u, 0x12u }, { 0u, 0u, 3542u, 2u, 0x12u }, { 0u, 0u, 3544u, 1u, 0x12u },
+        { 0u, 0u, 3545u, 1u, 0x12u }, { 0u, 0u, 3546u, 1u, 0x12u }, { 0u, 0u, 3547u, 1u, 0x12u }, { 0u, 0u, 3548u, 1u, 0x12u }, { 0u, 0u, 3549u, 1u, 0x12u },
+        { 0u, 0u, 3550u, 1u, 0x12u }, { 0u, 0u, 3551u, 1u, 0x12u }, { 0u, 0u, 3552u, 1u, 0x12u }, { 0u, 0u, 3553u, 1u, 0x12u }, { 0u, 0u, 3554u, 1u, 0x12u },
+        { 0u, 0u, 3555u, 1u, 0x12u }, { 0u, 0u, 3556u, 1u, 0x12u }, { 0u, 0u, 3557u, 1u, 0x12u }, { 0u, 0u, 3558u, 1u, 0x12u }, { 0u, 0u, 3559u, 1u, 0x12u },
+        { 0u, 0u, 3560u, 1u, 0x12u }, { 0u, 0u, 3561u, 1u, 0x12u }, { 0u, 0u, 3562u, 1u, 0x12u }, { 0u, 0u, 3563u, 1u, 0x12u }, { 0u, 0u, 3564u, 1u, 0x12u },
+        { 0u, 0u, 3565u, 1u, 0x12u }, { 0u, 0u, 3566u, 1u, 0x12u }, { 0u, 0u, 3567u, 1u, 0x12u }, { 0u, 0u, 3568u, 1u, 0x12u }, { 0u, 0u, 3569u, 1u, 0x12u },
+        { 0u, 0u, 3570u, 1u, 0x12u }, { 0u, 0u, 3571u, 1u, 0x12u }, { 0u, 0u, 3572u, 1u, 0x12u }, { 0u, 0u, 3573u, 1u, 0x12u }, { 0u, 0u, 3574u, 1u, 0x12u },
+        { 0u, 0u, 3575u, 1u, 0x12u }, { 0u, 0u, 3576u, 2u, 0x12u }, { 0u, 0u, 3578u, 2u, 0x12u }, { 0u, 0u, 3580u, 2u, 0x12u }, { 0u, 0u, 3582u, 2u, 0x12u },
+        { 0u, 0u, 3584u, 2u, 0x12u }, { 0u, 0u, 3586u, 2u, 0x12u }, { 0u, 0u, 3588u, 2u, 0x12u }, { 0u, 0u, 3590u, 2u, 0x12u }, { 0u, 0u, 3592u, 2u, 0x12u },
+        { 0u, 0u, 3594u, 2u, 0x12u }, { 0u, 0u, 3596u, 2u, 0x12u }, { 0u, 0u, 3598u, 2u, 0x12u }, { 0u, 0u, 3600u, 2u, 0x12u }, { 0u, 0u, 3602u, 2u, 0x12u },
+        { 0u, 0u, 3604u, 2u, 0x12u }, { 0u, 0u, 3606u, 2u, 0x12u }, { 0u, 0u, 3608u, 2u, 0x12u }, { 0u, 0u, 3610u, 2u, 0x12u }, { 0u, 0u, 3612u, 2u, 0x12u },
+        { 0u, 0u, 3614u, 2u, 0x12u }, { 0u, 0u, 3616u, 2u, 0x12u }, { 0u, 0u, 3618u, 2u, 0x12u }, { 0u, 0u, 3620u, 2u, 0x12u }, { 0u, 0u, 3622u, 2u, 0x12u },
+        { 0u, 0u, 3624u, 3u, 0x12u }, { 0u, 0u, 3627u, 3u, 0x12u }, { 0u, 0u, 3630u, 3u, 0x12u }, { 0u, 0u, 3633u, 2u, 0x12u }, { 0u, 0u, 3635u, 3u, 0x12u },
+        { 0u, 0u, 3638u, 2u, 0x12u }, { 0u, 0u, 3640u, 3u, 0x12u }, { 0u, 0u, 3643u, 1u, 0x12u }, { 0u, 0u, 3644u, 1u, 0x12u }, { 0u, 0u, 3645u, 1u, 0x12u },
+        { 0u, 0u, 3646u, 1u, 0x12u }, { 0u, 0u, 3647u, 1u, 0x12u }, { 0u, 0u, 3648u, 1u, 0x12u }, { 0u, 0u, 3649u, 1u, 0x12u }, { 0u, 0u, 3650u, 1u, 0x12u },
+        { 0u, 0u, 3651u, 1u, 0x12u }, { 0u, 0u, 3652u, 1u, 0x12u }, { 0u, 0u, 3653u, 1u, 0x12u }, { 0u, 0u, 3654u, 1u, 0x12u }, { 0u, 0u, 3655u, 1u, 0x12u },
+        { 0u, 0u, 3656u, 1u, 0x12u }, { 0u, 0u, 3657u, 1u, 0x12u }, { 0u, 0u, 3658u, 1u, 0x12u }, { 0u, 0u, 3659u, 1u, 0x12u }, { 0u, 0u, 3660u, 1u, 0x12u },
+        { 0u, 0u, 3661u, 1u, 0x12u }, { 0u, 0u, 3662u, 1u, 0x12u }, { 0u, 0u, 3663u, 1u, 0x12u }, { 0u, 0u, 3664u, 1u, 0x12u }, { 0u, 0u, 3665u, 1u, 0x12u },
+        { 0u, 0u, 3666u, 1u, 0x12u }, { 0u, 0u, 3667u, 1u, 0x12u }, { 0u, 0u, 3668u, 1u, 0x12u }, { 0u, 0u, 3669u, 1u, 0x12u }, { 0u, 0u, 3670u, 1u, 0x12u },
+        { 0u, 0u, 3671u, 1u, 0x12u }, { 0u, 0u, 3672u, 1u, 0x12u }, { 0u, 0u, 3673u, 1u, 0x12u }, { 0u, 0u, 3674u, 1u, 0x12u }, { 0u, 0u, 3675u, 1u, 0x12u },
+        { 0u, 0u, 3676u, 1u, 0x12u }, { 0u, 0u, 3677u, 1u, 0x12u }, { 0u, 0u, 3678u, 1u, 0x12u }, { 0u, 0u, 3679u, 1u, 0x12u }, { 0u, 0u, 3680u, 1u, 0x12u },
+        { 0u, 0u, 3681u, 1u, 0x12u }, { 0u, 0u, 3682u, 1u, 0x12u }, { 0u, 0u, 3683u, 1u, 0x12u }, { 0u, 0u, 3684u, 1u, 0x12u }, { 0u, 0u, 3685u, 1u, 0x12u },
+        { 0u, 0u, 3686u, 1u, 0x12u }, { 0u, 0u, 3687u, 1u, 0x12u }, { 0u, 0u, 3688u, 1u, 0x12u }, { 0u, 0u, 3689u, 1u, 0x12u }, { 0u, 0u, 3690u, 2u, 0x12u },
+        { 0u, 0u, 3692u, 5u, 0x12u }, { 0u, 0u, 3697u, 4u, 0x12u }, { 0u, 0u, 3701u, 5u, 0x12u }, { 0u, 0u, 3706u, 3u, 0x12u }, { 0u, 0u, 3709u, 5u, 0x12u },
+        { 0u, 0u, 3714u, 3u, 0x12u }, { 0u, 0u, 3717u, 3u, 0x12u }, { 0u, 0u, 3720u, 6u, 0x12u }, { 0u, 0u, 3726u, 4u, 0x12u }, { 0u, 0u, 3730u, 3u, 0x12u },
+        { 0u, 0u, 3733u, 3u, 0x12u }, { 0u, 0u, 3736u, 3u, 0x12u }, { 0u, 0u, 3739u, 4u, 0x12u }, { 0u, 0u, 3743u, 4u, 0x12u }, { 0u, 0u, 3747u, 4u, 0x12u },
+        { 0u, 0u, 3751u, 4u, 0x12u }, { 0u, 0u, 3755u, 4u, 0x12u }, { 0u, 0u, 3759u, 4u, 0x12u }, { 0u, 0u, 3763u, 4u, 0x12u }, { 0u, 0u, 3767u, 6u, 0x12u },
+        { 0u, 0u, 3773u, 2u, 0x12u }, { 0u, 0u, 3775u, 6u, 0x12u }, { 0u, 0u, 3781u, 6u, 0x12u }, { 0u, 0u, 3787u, 5u, 0x12u }, { 0u, 0u, 3792u, 4u, 0x12u },
+        { 0u, 0u, 3796u, 6u, 0x12u }, { 0u, 0u, 3802u, 6u, 0x12u }, { 0u, 0u, 3808u, 4u, 0x12u }, { 0u, 0u, 3812u, 3u, 0x12u }, { 0u, 0u, 3815u, 3u, 0x12u },
+        { 0u, 0u, 3818u, 4u, 0x12u }, { 0u, 0u, 3822u, 4u, 0x12u }, { 0u, 0u, 3826u, 5u, 0x12u }, { 0u, 0u, 3831u, 5u, 0x12u }, { 0u, 0u, 3836u, 3u, 0x12u },
+        { 0u, 0u, 3839u, 3u, 0x12u }, { 0u, 0u, 3842u, 4u, 0x12u }, { 0u, 0u, 3846u, 3u, 0x12u }, { 0u, 0u, 3849u, 3u, 0x12u }, { 0u, 0u, 3852u, 2u, 0x12u },
+        { 0u, 0u, 3854u, 2u, 0x12u }, { 0u, 0u, 3856u, 3u, 0x12u }, { 0u, 0u, 3859u, 3u, 0x12u }, { 0u, 0u, 3862u, 6u, 0x12u }, { 0u, 0u, 3868u, 4u, 0x12u },
+        { 0u, 0u, 3872u, 5u, 0x12u }, { 0u, 0u, 3877u, 6u, 0x12u }, { 0u, 0u, 3883u, 4u, 0x12u }, { 0u, 0u, 3887u, 3u, 0x12u }, { 0u, 0u, 3890u, 3u, 0x12u },
+        { 0u, 0u, 3893u, 6u, 0x12u }, { 0u, 0u, 3899u, 4u, 0x12u }, { 0u, 0u, 3903u, 6u, 0x12u }, { 0u, 0u, 3909u, 3u, 0x12u }, { 0u, 0u, 3912u, 5u, 0x12u },
+        { 0u, 0u, 3917u, 3u, 0x12u }, { 0u, 0u, 3920u, 4u, 0x12u }, { 0u, 0u, 3924u, 3u, 0x12u }, { 0u, 0u, 3927u, 4u, 0x12u }, { 0u, 0u, 3931u, 5u, 0x12u },
+        { 0u, 0u, 3936u, 4u, 0x12u }, { 0u, 0u, 3940u, 5u, 0x12u }, { 0u, 0u, 3945u, 4u, 0x12u }, { 0u, 0u, 3949u, 2u, 0x12u }, { 0u, 0u, 3951u, 5u, 0x12u },
+        { 0u, 0u, 3956u, 3u, 0x12u }, { 0u, 0u, 3959u, 3u, 0x12u }, { 0u, 0u, 3962u, 4u, 0x12u }, { 0u, 0u, 3966u, 3u, 0x12u }, { 0u, 0u, 3969u, 3u, 0x12u },
+        { 0u, 0u, 3972u, 3u, 0x12u }, { 0u, 0u, 3975u, 5u, 0x12u }, { 0u, 0u, 3980u, 4u, 0x12u }, { 0u, 0u, 3984u, 2u, 0x12u }, { 0u, 0u, 3986u, 6u, 0x12u },
+        { 0u, 0u, 3992u, 3u, 0x12u }, { 0u, 0u, 3995u, 5u, 0x12u }, { 0u, 0u, 4000u, 4u, 0x12u }, { 0u, 0u, 4004u, 4u, 0x12u }, { 0u, 0u, 4008u, 3u, 0x12u },
+        { 0u, 0u, 4011u, 3u, 0x12u }, { 0u, 0u, 4014u, 4u, 0x12u }, { 0u, 0u, 4018u, 2u, 0x12u }, { 0u, 0u, 4020u, 4u, 0x12u }, { 0u, 0u, 4024u, 5u, 0x12u },
+        { 0u, 0u, 4029u, 2u, 0x12u }, { 0u, 0u, 4031u, 6u, 0x12u }, { 0u, 0u, 4037u, 3u, 0x12u }, { 0u, 0u, 4040u, 2u, 0x12u }, { 0u, 0u, 4042u, 2u, 0x12u },
+        { 0u, 0u, 4044u, 2u, 0x12u }, { 0u, 0u, 4046u, 2u, 0x12u }, { 0u, 0u, 4048u, 2u, 0x12u }, { 0u, 0u, 4050u, 2u, 0x12u }, { 0u, 0u, 4052u, 2u, 0x12u },
+        { 0u, 0u, 4054u, 2u, 0x12u }, { 0u, 0u, 4056u, 2u, 0x12u }, { 0u, 0u, 4058u, 2u, 0x12u }, { 0u, 0u, 4060u, 3u, 0x12u }, { 0u, 0u, 4063u, 3u, 0x12u },
+        { 0u, 0u, 4066u, 3u, 0x12u }, { 0u, 0u, 4069u, 3u, 0x12u }, { 0u, 0u, 4072u, 3u, 0x12u }, { 0u, 0u, 4075u, 3u, 0x12u }, { 0u, 0u, 4078u, 3u, 0x12u },
+        { 0u, 0u, 4081u, 3u, 0x12u }, { 0u, 0u, 4084u, 3u, 0x12u }, { 0u, 0u, 4087u, 3u, 0x12u }, { 0u, 0u, 4090u, 3u, 0x12u }, { 0u, 0u, 4093u, 3u, 0x12u },
+        { 0u, 0u, 4096u, 3u, 0x12u }, { 0u, 0u, 4099u, 3u, 0x12u }, { 0u, 0u, 4102u, 3u, 0x12u }, { 0u, 0u, 4105u, 3u, 0x12u }, { 0u, 0u, 4108u, 2u, 0x12u },
+        { 0u, 0u, 4110u, 2u, 0x12u }, { 0u, 0u, 4112u, 3u, 0x12u }, { 0u, 0u, 4115u, 2u, 0x12u }, { 0u, 0u, 4117u, 2u, 0x12u }, { 0u, 0u, 4119u, 2u, 0x12u },
+        { 0u, 0u, 4121u, 3u, 0x12u }, { 0u, 0u, 4124u, 3u, 0x12u }, { 0u, 0u, 4127u, 2u, 0x12u }, { 0u, 0u, 4129u, 2u, 0x12u }, { 0u, 0u, 4131u, 2u, 0x12u },
+        { 0u, 0u, 4133u, 2u, 0x12u }, { 0u, 0u, 4135u, 2u, 0x12u }, { 0u, 0u, 4137u, 4u, 0x12u }, { 0u, 0u, 4141u, 2u, 0x12u }, { 0u, 0u, 4143u, 2u, 0x12u },
+        { 0u, 0u, 4145u, 2u, 0x12u }, { 0u, 0u, 4147u, 2u, 0x12u }, { 0u, 0u, 4149u, 2u, 0x12u }, { 0u, 0u, 4151u, 2u, 0x12u }, { 0u, 0u, 4153u, 2u, 0x12u },
+        { 0u, 0u, 4155u, 2u, 0x12u }, { 0u, 0u, 4157u, 3u, 0x12u }, { 0u, 0u, 4160u, 4u, 0x12u }, { 0u, 0u, 4164u, 2u, 0x12u }, { 0u, 0u, 4166u, 2u, 0x12u },
+        { 0u, 0u, 4168u, 2u, 0x12u }, { 0u, 0u, 4170u, 2u, 0x12u }, { 0u, 0u, 4172u, 2u, 0x12u }, { 0u, 0u, 4174u, 2u, 0x12u }, { 0u, 0u, 4176u, 2u, 0x12u },
+        { 0u, 0u, 4178u, 3u, 0x12u }, { 0u, 0u, 4181u, 3u, 0x12u }, { 0u, 0u, 4184u, 3u, 0x12u }, { 0u, 0u, 4187u, 3u, 0x12u }, { 0u, 0u, 4190u, 2u, 0x12u },
+        { 0u, 0u, 4192u, 2u, 0x12u }, { 0u, 0u, 4194u, 2u, 0x12u }, { 0u, 0u, 4196u, 2u, 0x12u }, { 0u, 0u, 4198u, 2u, 0x12u }, { 0u, 0u, 4200u, 2u, 0x12u },
+        { 0u, 0u, 4202u, 2u, 0x12u }, { 0u, 0u, 4204u, 2u, 0x12u }, { 0u, 0u, 4206u, 2u, 0x12u }, { 0u, 0u, 4208u, 2u, 0x12u }, { 0u, 0u, 4210u, 3u, 0x12u },
+        { 0u, 0u, 4213u, 3u, 0x12u }, { 0u, 0u, 4216u, 2u, 0x12u }, { 0u, 0u, 4218u, 3u, 0x12u }, { 0u, 0u, 4221u, 3u, 0x12u }, { 0u, 0u, 4224u, 3u, 0x12u },
+        { 0u, 0u, 4227u, 2u, 0x12u }, { 0u, 0u, 4229u, 3u, 0x12u }, { 0u, 0u, 4232u, 3u, 0x12u }, { 0u, 0u, 4235u, 4u, 0x12u }, { 0u, 0u, 4239u, 2u, 0x12u },
+        { 0u, 0u, 4241u, 3u, 0x12u }, { 0u, 0u, 4244u, 3u, 0x12u }, { 0u, 0u, 4247u, 3u, 0x12u }, { 0u, 0u, 4250u, 3u, 0x12u }, { 0u, 0u, 4253u, 5u, 0x12u },
+        { 0u, 0u, 4258u, 6u, 0x12u }, { 0u, 0u, 4264u, 2u, 0x12u }, { 0u, 0u, 4266u, 2u, 0x12u }, { 0u, 0u, 4268u, 2u, 0x12u }, { 0u, 0u, 4270u, 2u, 0x12u },
+        { 0u, 0u, 4272u, 2u, 0x12u }, { 0u, 0u, 4274u, 2u, 0x12u }, { 0u, 0u, 4276u, 2u, 0x12u }, { 0u, 0u, 4278u, 2u, 0x12u }, { 0u, 0u, 4280u, 2u, 0x12u },
+        { 0u, 0u, 4282u, 2u, 0x12u }, { 0u, 0u, 4284u, 2u, 0x12u }, { 0u, 0u, 4286u, 2u, 0x12u }, { 0u, 0u, 4288u, 2u, 0x12u }, { 0u, 0u, 4290u, 2u, 0x12u },
+        { 0u, 0u, 4292u, 2u, 0x12u }, { 0u, 0u, 4294u, 2u, 0x12u }, { 0u, 0u, 4296u, 2u, 0x12u }, { 0u, 0u, 4298u, 2u, 0x12u }, { 0u, 0u, 4300u, 4u, 0x12u },
+        { 0u, 0u, 4304u, 2u, 0x12u }, { 0u, 0u, 4306u, 2u, 0x12u }, { 0u, 0u, 4308u, 2u, 0x12u }, { 0u, 0u, 4310u, 4u, 0x12u }, { 0u, 0u, 4314u, 3u, 0x12u },
+        { 0u, 0u, 4317u, 2u, 0x12u }, { 0u, 0u, 4319u, 2u, 0x12u }, { 0u, 0u, 4321u, 2u, 0x12u }, { 0u, 0u, 4323u, 2u, 0x12u }, { 0u, 0u, 4325u, 2u, 0x12u },
+        { 0u, 0u, 4327u, 2u, 0x12u }, { 0u, 0u, 4329u, 2u, 0x12u }, { 0u, 0u, 4331u, 2u, 0x12u }, { 0u, 0u, 4333u, 2u, 0x12u }, { 0u, 0u, 4335u, 2u, 0x12u },
+        { 0u, 0u, 4337u, 3u, 0x12u }, { 0u, 0u, 4340u, 2u, 0x12u }, { 0u, 0u, 4342u, 2u, 0x12u }, { 0u, 0u, 4344u, 3u, 0x12u }, { 0u, 0u, 4347u, 3u, 0x12u },
+        { 0u, 0u, 4350u, 2u, 0x12u }, { 0u, 0u, 4352u, 4u, 0x12u }, { 0u, 0u, 4356u, 3u, 0x12u }, { 0u, 0u, 4359u, 2u, 0x12u }, { 0u, 0u, 4361u, 2u, 0x12u },
+        { 0u, 0u, 4363u, 2u, 0x12u }, { 0u, 0u, 4365u, 2u, 0x12u }, { 0u, 0u, 4367u, 3u, 0x12u }, { 0u, 0u, 4370u, 3u, 0x12u }, { 0u, 0u, 4373u, 2u, 0x12u },
+        { 0u, 0u, 4375u, 2u, 0x12u }, { 0u, 0u, 4377u, 2u, 0x12u }, { 0u, 0u, 4379u, 2u, 0x12u }, { 0u, 0u, 4381u, 2u, 0x12u }, { 0u, 0u, 4383u, 2u, 0x12u },
+        { 0u, 0u, 4385u, 2u, 0x12u }, { 0u, 0u, 4387u, 2u, 0x12u }, { 0u, 0u, 4389u, 2u, 0x12u }, { 0u, 0u, 4391u, 3u, 0x12u }, { 0u, 0u, 4394u, 3u, 0x12u },
+        { 0u, 0u, 4397u, 3u, 0x12u }, { 0u, 0u, 4400u, 3u, 0x12u }, { 0u, 0u, 4403u, 3u, 0x12u }, { 0u, 0u, 4406u, 3u, 0x12u }, { 0u, 0u, 4409u, 3u, 0x12u },
+        { 0u, 0u, 4412u, 3u, 0x12u }, { 0u, 0u, 4415u, 3u, 0x12u }, { 0u, 0u, 4418u, 3u, 0x12u }, { 0u, 0u, 4421u, 3u, 0x12u }, { 0u, 0u, 4424u, 3u, 0x12u },
+        { 0u, 0u, 4427u, 3u, 0x12u }, { 0u, 0u, 4430u, 3u, 0x12u }, { 0u, 0u, 4433u, 3u, 0x12u }, { 0u, 0u, 4436u, 3u, 0x12u }, { 0u, 0u, 4439u, 3u, 0x12u },
+        { 0u, 0u, 4442u, 3u, 0x12u }, { 0u, 0u, 4445u, 3u, 0x12u }, { 0u, 0u, 4448u, 3u, 0x12u }, { 0u, 0u, 4451u, 3u, 0x12u }, { 0u, 0u, 4454u, 3u, 0x12u },
+        { 0u, 0u, 4457u, 3u, 0x12u }, { 0u, 0u, 4460u, 1u, 0x12u }, { 0u, 0u, 4461u, 1u, 0x12u }, { 0u, 0u, 4462u, 1u, 0x12u }, { 0u, 0u, 4463u, 1u, 0x12u },
+        { 0u, 0u, 4464u, 1u, 0x12u }, { 0u, 0u, 4465u, 1u, 0x12u }, { 0u, 0u, 4466u, 1u, 0x12u }, { 0u, 0u, 4467u, 1u, 0x12u }, { 0u, 0u, 4468u, 1u, 0x12u },
+        { 0u, 0u, 4469u, 1u, 0x12u }, { 0u, 0u, 0u, 0u, 0x3u }, { 4470u, 1u, 4470u, 1u, 0x17u }, { 4471u, 1u, 4471u, 1u, 0x17u }, { 2959u, 1u, 2959u, 1u, 0x17u },
+        { 4472u, 1u, 4472u, 1u, 0x17u }, { 4473u, 1u, 4473u, 1u, 0x17u }, { 4474u, 1u, 4474u, 1u, 0x17u }, { 4475u, 1u, 4475u, 1u, 0x17u }, { 3013u, 1u, 3013u, 1u, 0x17u },
+        { 4476u, 1u, 4476u, 1u, 0x17u }, { 2967u, 1u, 2967u, 1u, 0x17u }, { 4477u, 1u, 4477u, 1u, 0x17u }, { 4478u, 1u, 4478u, 1u, 0x17u }, { 4479u, 1u, 4479u, 1u, 0x17u },
+        { 4480u, 1u, 4480u, 1u, 0x17u }, { 4481u, 1u, 4481u, 1u, 0x17u }, { 4482u, 1u, 4482u, 1u, 0x17u }, { 4483u, 1u, 4483u, 1u, 0x17u }, { 4484u, 1u, 4484u, 1u, 0x17u },
+        { 4485u, 1u, 4485u, 1u, 0x17u }, { 4486u, 1u, 4486u, 1u, 0x17u }, { 4487u, 1u, 4487u, 1u, 0x17u }, { 4488u, 1u, 4488u, 1u, 0x17u }, { 4489u, 1u, 4489u, 1u, 0x17u },
+        { 4490u, 1u, 4490u, 1u, 0x17u }, { 4491u, 1u, 4491u, 1u, 0x17u }, { 4492u, 1u, 4492u, 1u, 0x17u }, { 4493u, 1u, 4493u, 1u, 0x17u }, { 4494u, 1u, 4494u, 1u, 0x17u },
+        { 4495u, 1u, 4495u, 1u, 0x17u }, { 4496u, 1u, 4496u, 1u, 0x17u }, { 4497u, 1u, 4497u, 1u, 0x17u }, { 4498u, 1u, 4498u, 1u, 0x17u }, { 4499u, 1u, 4499u, 1u, 0x17u },
+        { 4500u, 1u, 4500u, 1u, 0x17u }, { 4501u, 1u, 4501u, 1u, 0x17u }, { 4502u, 1u, 4502u, 1u, 0x17u }, { 4503u, 1u, 4503u, 1u, 0x17u }, { 4504u, 1u, 4504u, 1u, 0x17u },
+        { 4505u, 1u, 4505u, 1u, 0x17u }, { 4506u, 1u, 4506u, 1u, 0x17u }, { 4507u, 1u, 4507u, 1u, 0x17u }, { 4508u, 1u, 4508u, 1u, 0x17u }, { 4509u, 1u, 4509u, 1u, 0x17u },
+        { 4510u, 1u, 4510u, 1u, 0x17u }, { 4511u, 1u, 4511u, 1u, 0x17u }, { 4512u, 1u, 4512u, 1u, 0x17u }, { 4513u, 1u, 4513u, 1u, 0x17u }, { 4514u, 1u, 4514u, 1u, 0x17u },
+        { 4515u, 1u, 4515u, 1u, 0x17u }, { 4516u, 1u, 4516u, 1u, 0x17u }, { 4517u, 1u, 4517u, 1u, 0x17u }, { 2925u, 1u, 2925u, 1u, 0x17u }, { 4518u, 1u, 4518u, 1u, 0x17u },
+        { 4519u, 1u, 4519u, 1u, 0x17u }, { 4520u, 1u, 4520u, 1u, 0x17u }, { 4521u, 1u, 4521u, 1u, 0x17u }, { 4522u, 1u, 4522u, 1u, 0x17u }, { 4523u, 1u, 4523u, 1u, 0x17u },
+        { 4524u, 1u, 4524u, 1u, 0x17u }, { 4525u, 1u, 4525u, 1u, 0x17u }, { 4526u, 1u, 4526u, 1u, 0x17u }, { 4527u, 1u, 4527u, 1u, 0x17u }, { 4528u, 1u, 4528u, 1u, 0x17u },
+        { 2998u, 1u, 2998u, 1u, 0x17u }, { 4529u, 1u, 4529u, 1u, 0x17u }, { 4530u, 1u, 4530u, 1u, 0x17u }, { 4531u, 1u, 4531u, 1u, 0x17u }, { 4532u, 1u, 4532u, 1u, 0x17u },
+        { 4533u, 1u, 4533u, 1u, 0x17u }, { 4534u, 1u, 4534u, 1u, 0x17u }, { 4535u, 1u, 4535u, 1u, 0x17u }, { 4536u, 1u, 4536u, 1u, 0x17u }, { 4537u, 1u, 4537u, 1u, 0x17u },
+        { 4538u, 1u, 4538u, 1u, 0x17u }, { 4539u, 1u, 4539u, 1u, 0x17u }, { 4540u, 1u, 4540u, 1u, 0x17u }, { 4541u, 1u, 4541u, 1u, 0x17u }, { 4542u, 1u, 4542u, 1u, 0x17u },
+        { 4543u, 1u, 4543u, 1u, 0x17u }, { 4544u, 1u, 4544u, 1u, 0x17u }, { 4545u, 1u, 4545u, 1u, 0x17u }, { 4546u, 1u, 4546u, 1u, 0x17u }, { 4547u, 1u, 4547u, 1u, 0x17u },
+        { 4548u, 1u, 4548u, 1u, 0x17u }, { 4549u, 1u, 4549u, 1u, 0x17u }, { 4550u, 1u, 4550u, 1u, 0x17u }, { 4551u, 1u, 4551u, 1u, 0x17u }, { 4552u, 1u, 4552u, 1u, 0x17u },
+        { 4553u, 1u, 4553u, 1u, 0x17u }, { 4554u, 1u, 4554u, 1u, 0x17u }, { 4555u, 1u, 4555u, 1u, 0x17u }, { 4556u, 1u, 4556u, 1u, 0x17u }, { 4557u, 1u, 4557u, 1u, 0x17u },
+        { 4558u, 1u, 4558u, 1u, 0x17u }, { 4559u, 1u, 4559u, 1u, 0x17u }, { 4560u, 1u, 4560u, 1u, 0x17u }, { 4561u, 1u, 4561u, 1u, 0x17u }, { 4562u, 1u, 4562u, 1u, 0x17u },
+        { 4563u, 1u, 4563u, 1u, 0x17u }, { 4564u, 1u, 4564u, 1u, 0x17u }, { 4565u, 1u, 4565u, 1u, 0x17u }, { 4566u, 1u, 4566u, 1u, 0x17u }, { 4567u, 1u, 4567u, 1u, 0x17u },
+        { 4568u, 1u, 4568u, 1u, 0x17u }, { 4569u, 1u, 4569u, 1u, 0x17u }, { 4570u, 1u, 4570u, 1u, 0x17u }, { 4571u, 1u, 4571u, 1u, 0x17u }, { 4572u, 1u, 4572u, 1u, 0x17u },
+        { 4573u, 1u, 4573u, 1u, 0x17u }, { 4574u, 1u, 4574u, 1u, 0x17u }, { 4575u, 1u, 4575u, 1u, 0x17u }, { 2961u, 1u, 2961u, 1u, 0x17u }, { 4576u, 1u, 4576u, 1u, 0x17u },
+        { 4577u, 1u, 4577u, 1u, 0x17u }, { 4578u, 1u, 4578u, 1u, 0x17u }, { 4579u, 1u, 4579u, 1u, 0x17u }, { 4580u, 1u, 4580u, 1u, 0x17u }, { 4581u, 1u, 4581u, 1u, 0x17u },
+        { 4582u, 1u, 4582u, 1u, 0x17u }, { 4583u, 1u, 4583u, 1u, 0x17u }, { 4584u, 1u, 4584u, 1u, 0x17u }, { 4585u, 1u, 4585u, 1u, 0x17u }, { 4586u, 1u, 4586u, 1u, 0x17u },
+        { 4587u, 1u, 4587u, 1u, 0x17u }, { 4588u, 1u, 4588u, 1u, 0x17u }, { 4589u, 1u, 4589u, 1u, 0x17u }, { 4590u, 1u, 4590u, 1u, 0x17u }, { 2838u, 1u, 2838u, 1u, 0x17u },
+        { 4591u, 1u, 4591u, 1u, 0x17u }, { 4592u, 1u, 4592u, 1u, 0x17u }, { 4593u, 1u, 4593u, 1u, 0x17u }, { 4594u, 1u, 4594u, 1u, 0x17u }, { 4595u, 1u, 4595u, 1u, 0x17u },
+        { 4596u, 1u, 4596u, 1u, 0x17u }, { 4597u, 1u, 4597u, 1u, 0x17u }, { 4598u, 1u, 4598u, 1u, 0x17u }, { 2819u, 1u, 2819u, 1u, 0x17u }, { 4599u, 1u, 4599u, 1u, 0x17u },
+        { 4600u, 1u, 4600u, 1u, 0x17u }, { 4601u, 1u, 4601u, 1u, 0x17u }, { 4602u, 1u, 4602u, 1u, 0x17u }, { 4603u, 1u, 4603u, 1u, 0x17u }, { 4604u, 1u, 4604u, 1u, 0x17u },
+        { 4605u, 1u, 4605u, 1u, 0x17u }, { 4606u, 1u, 4606u, 1u, 0x17u }, { 4607u, 1u, 4607u, 1u, 0x17u }, { 4608u, 1u, 4608u, 1u, 0x17u }, { 4609u, 1u, 4609u, 1u, 0x17u },
+        { 4610u, 1u, 4610u, 1u, 0x17u }, { 4611u, 1u, 4611u, 1u, 0x17u }, { 4612u, 1u, 4612u, 1u, 0x17u }, { 4613u, 1u, 4613u, 1u, 0x17u }, { 4614u, 1u, 4614u, 1u, 0x17u },
+        { 4615u, 1u, 4615u, 1u, 0x17u }, { 4616u, 1u, 4616u, 1u, 0x17u }, { 4617u, 1u, 4617u, 1u, 0x17u }, { 4618u, 1u, 4618u, 1u, 0x17u }, { 4619u, 1u, 4619u, 1u, 0x17u },
+        { 4620u, 1u, 4620u, 1u, 0x17u }, { 4621u, 1u, 4621u, 1u, 0x17u }, { 4622u, 1u, 4622u, 1u, 0x17u }, { 4623u, 1u, 4623u, 1u, 0x17u }, { 4624u, 1u, 4624u, 1u, 0x17u },
+        { 4625u, 1u, 4625u, 1u, 0x17u }, { 4626u, 1u, 4626u, 1u, 0x17u }, { 4627u, 1u, 4627u, 1u, 0x17u }, { 4628u, 1u, 4628u, 1u, 0x17u }, { 4629u, 1u, 4629u, 1u, 0x17u },
+        { 4630u, 1u, 4630u, 1u, 0x17u }, { 4631u, 1u, 4631u, 1u, 0x17u }, { 4632u, 1u, 4632u, 1u, 0x17u }, { 4633u, 1u, 4633u, 1u, 0x17u }, { 4634u, 1u, 4634u, 1u, 0x17u },
+        { 4635u, 1u, 4635u, 1u, 0x17u }, { 4636u, 1u, 4636u, 1u, 0x17u }, { 4637u, 1u, 4637u, 1u, 0x17u }, { 4638u, 1u, 4638u, 1u, 0x17u }, { 4639u, 1u, 4639u, 1u, 0x17u },
+        { 4640u, 1u, 4640u, 1u, 0x17u }, { 4641u, 1u, 4641u, 1u, 0x17u }, { 4642u, 1u, 4642u, 1u, 0x17u }, { 4643u, 1u, 4643u, 1u, 0x17u }, { 4644u, 1u, 4644u, 1u, 0x17u },
+        { 4645u, 1u, 4645u, 1u, 0x17u }, { 4646u, 1u, 4646u, 1u, 0x17u }, { 4647u, 1u, 4647u, 1u, 0x17u }, { 4648u, 1u, 4648u, 1u, 0x17u }, { 4649u, 1u, 4649u, 1u, 0x17u },
+        { 4650u, 1u, 4650u, 1u, 0x17u }, { 4651u, 1u, 4651u, 1u, 0x17u }, { 4652u, 1u, 4652u, 1u, 0x17u }, { 3012u, 1u, 3012u, 1u, 0x17u }, { 4653u, 1u, 4653u, 1u, 0x17u },
+        { 4654u, 1u, 4654u, 1u, 0x17u }, { 4655u, 1u, 4655u, 1u, 0x17u }, { 4656u, 1u, 4656u, 1u, 0x17u }, { 4657u, 1u, 4657u, 1u, 0x17u }, { 4658u, 1u, 4658u, 1u, 0x17u },
+        { 4659u, 1u, 4659u, 1u, 0x17u }, { 4660u, 1u, 4660u, 1u, 0x17u }, { 4661u, 1u, 4661u, 1u, 0x17u }, { 4662u, 1u, 4662u, 1u, 0x17u }, { 4663u, 1u, 4663u, 1u, 0x17u },
+        { 4664u, 1u, 4664u, 1u, 0x17u }, { 3545u, 1u, 3545u, 1u, 0x17u }, { 4665u, 1u, 4665u, 1u, 0x17u }, { 4666u, 1u, 4666u, 1u, 0x17u }, { 4667u, 1u, 4667u, 1u, 0x17u },
+        { 4668u, 1u, 4668u, 1u, 0x17u }, { 4669u, 1u, 4669u, 1u, 0x17u }, { 4670u, 1u, 4670u, 1u, 0x17u }, { 4671u, 1u, 4671u, 1u, 0x17u }, { 4672u, 1u, 4672u, 1u, 0x17u },
+        { 4673u, 1u, 4673u, 1u, 0x17u }, { 4674u, 1u, 4674u, 1u, 0x17u }, { 4675u, 1u, 4675u, 1u, 0x17u }, { 4676u, 1u, 4676u, 1u, 0x17u }, { 4677u, 1u, 4677u, 1u, 0x17u },
+        { 4678u, 1u, 4678u, 1u, 0x17u }, { 4679u, 1u, 4679u, 1u, 0x17u }, { 4680u, 1u, 4680u, 1u, 0x17u }, { 4681u, 1u, 4681u, 1u, 0x17u }, { 4682u, 1u, 4682u, 1u, 0x17u },
+        { 4683u, 1u, 4683u, 1u, 0x17u }, { 4684u, 1u, 4684u, 1u, 0x17u }, { 4685u, 1u, 4685u, 1u, 0x17u }, { 4686u, 1u, 4686u, 1u, 0x17u }, { 2966u, 1u, 2966u, 1u, 0x17u },
+        { 4687u, 1u, 4687u, 1u, 0x17u }, { 4688u, 1u, 4688u, 1u, 0x17u }, { 4689u, 1u, 4689u, 1u, 0x17u }, { 4690u, 1u, 4690u, 1u, 0x17u }, { 4691u, 1u, 4691u, 1u, 0x17u },
+        { 4692u, 1u, 4692u, 1u, 0x17u }, { 4693u, 1u, 4693u, 1u, 0x17u }, { 4694u, 1u, 4694u, 1u, 0x17u }, { 4695u, 1u, 4695u, 1u, 0x17u }, { 4696u, 1u, 4696u, 1u, 0x17u },
+        { 4697u, 1u, 4697u, 1u, 0x17u }, { 4698u, 1u, 4698u, 1u, 0x17u }, { 4699u, 1u, 4699u, 1u, 0x17u }, { 2917u, 1u, 2917u, 1u, 0x17u }, { 4700u, 1u, 4700u, 1u, 0x17u },
+        { 4701u, 1u, 4701u, 1u, 0x17u }, { 4702u, 1u, 4702u, 1u, 0x17u }, { 4703u, 1u, 4703u, 1u, 0x17u }, { 4704u, 1u, 4704u, 1u, 0x17u }, { 4705u, 1u, 4705u, 1u, 0x17u },
+        { 4706u, 1u, 4706u, 1u, 0x17u }, { 4707u, 1u, 4707u, 1u, 0x17u }, { 4708u, 1u, 4708u, 1u, 0x17u }, { 4709u, 1u, 4709u, 1u, 0x17u }, { 4710u, 1u, 4710u, 1u, 0x17u },
+        { 4711u, 1u, 4711u, 1u, 0x17u }, { 4712u, 1u, 4712u, 1u, 0x17u }, { 4713u, 1u, 4713u, 1u, 0x17u }, { 4714u, 1u, 4714u, 1u, 0x17u }, { 4715u, 1u, 4715u, 1u, 0x17u },
+        { 2944u, 1u, 2944u, 1u, 0x17u }, { 4716u, 1u, 4716u, 1u, 0x17u }, { 2947u, 1u, 2947u, 1u, 0x17u }, { 4717u, 1u, 4717u, 1u, 0x17u }, { 4718u, 1u, 4718u, 1u, 0x17u },
+        { 4719u, 1u, 4719u, 1u, 0x17u }, { 4720u, 1u, 4720u, 1u, 0x17u }, { 4721u, 1u, 4721u, 1u, 0x17u }, { 4722u, 1u, 4722u, 1u, 0x17u }, { 4723u, 1u, 4723u, 1u, 0x17u },
+        { 4724u, 1u, 4724u, 1u, 0x17u }, { 4725u, 1u, 4725u, 1u, 0x17u }, { 4726u, 1u, 4726u, 1u, 0x17u }, { 4727u, 1u, 4727u, 1u, 0x17u }, { 4728u, 1u, 4728u, 1u, 0x17u },
+        { 4729u, 1u, 4729u, 1u, 0x17u }, { 4730u, 1u, 4730u, 1u, 0x17u }, { 2924u, 1u, 2924u, 1u, 0x17u }, { 4731u, 1u, 4731u, 1u, 0x17u }, { 4732u, 1u, 4732u, 1u, 0x17u },
+        { 4733u, 1u, 4733u, 1u, 0x17u }, { 4734u, 1u, 4734u, 1u, 0x17u }, { 4735u, 1u, 4735u, 1u, 0x17u }, { 4736u, 1u, 4736u, 1u, 0x17u }, { 4737u, 1u, 4737u, 1u, 0x17u },
+        { 4738u, 1u, 4738u, 1u, 0x17u }, { 4739u, 1u, 4739u, 1u, 0x17u }, { 4740u, 1u, 4740u, 1u, 0x17u }, { 4741u, 1u, 4741u, 1u, 0x17u }, { 4742u, 1u, 4742u, 1u, 0x17u },
+        { 4743u, 1u, 4743u, 1u, 0x17u }, { 4744u, 1u, 4744u, 1u, 0x17u }, { 4745u, 1u, 4745u, 1u, 0x17u }, { 4746u, 1u, 4746u, 1u, 0x17u }, { 4747u, 1u, 4747u, 1u, 0x17u },
+        { 4748u, 1u, 4748u, 1u, 0x17u }, { 4749u, 1u, 4749u, 1u, 0x17u }, { 4750u, 1u, 4750u, 1u, 0x17u }, { 4751u, 1u, 4751u, 1u, 0x17u }, { 4752u, 1u, 4752u, 1u, 0x17u },
+        { 2845u, 1u, 2845u, 1u, 0x17u }, { 4753u, 1u, 4753u, 1u, 0x17u }, { 4754u, 1u, 4754u, 1u, 0x17u }, { 4755u, 1u, 4755u, 1u, 0x17u }, { 4756u, 1u, 4756u, 1u, 0x17u },
+        { 4757u, 1u, 4757u, 1u, 0x17u }, { 4758u, 1u, 4758u, 1u, 0x17u }, { 4759u, 1u, 4759u, 1u, 0x17u }, { 4760u, 1u, 4760u, 1u, 0x17u }, { 4761u, 1u, 4761u, 1u, 0x17u },
+        { 4762u, 1u, 4762u, 1u, 0x17u }, { 4763u, 1u, 4763u, 1u, 0x17u }, { 4764u, 1u, 4764u, 1u, 0x17u }, { 4765u, 1u, 4765u, 1u, 0x17u }, { 4766u, 1u, 4766u, 1u, 0x17u },
+        { 4767u, 1u, 4767u, 1u, 0x17u }, { 3550u, 1u, 3550u, 1u, 0x17u }, { 4768u, 1u, 4768u, 1u, 0x17u }, { 4769u, 1u, 4769u, 1u, 0x17u }, { 4770u, 1u, 4770u, 1u, 0x17u },
+        { 4771u, 1u, 4771u, 1u, 0x17u }, { 3554u, 1u, 3554u, 1u, 0x17u }, { 4772u, 1u, 4772u, 1u, 0x17u }, { 4773u, 1u, 4773u, 1u, 0x17u }, { 4774u, 1u, 4774u, 1u, 0x17u },
+        { 4775u, 1u, 4775u, 1u, 0x17u }, { 4776u, 1u, 4776u, 1u, 0x17u }, { 4777u, 1u, 4777u, 1u, 0x17u }, { 4778u, 1u, 4778u, 1u, 0x17u }, { 4779u, 1u, 4779u, 1u, 0x17u },
+        { 4780u, 1u, 4780u, 1u, 0x17u }, { 4781u, 1u, 4781u, 1u, 0x17u }, { 4782u, 1u, 4782u, 1u, 0x17u }, { 4783u, 1u, 4783u, 1u, 0x17u }, { 4784u, 1u, 4784u, 1u, 0x17u },
+        { 4785u, 1u, 4785u, 1u, 0x17u }, { 4786u, 1u, 4786u, 1u, 0x17u }, { 4787u, 1u, 4787u, 1u, 0x17u }, { 4788u, 1u, 4788u, 1u, 0x17u }, { 4789u, 1u, 4789u, 1u, 0x17u },
+        { 4790u, 1u, 4790u, 1u, 0x17u }, { 4791u, 1u, 4791u, 1u, 0x17u }, { 4792u, 1u, 4792u, 1u, 0x17u }, { 4793u, 1u, 4793u, 1u, 0x17u }, { 4794u, 1u, 4794u, 1u, 0x17u },
+        { 4795u, 1u, 4795u, 1u, 0x17u }, { 4796u, 1u, 4796u, 1u, 0x17u }, { 4797u, 1u, 4797u, 1u, 0x17u }, { 4798u, 1u, 4798u, 1u, 0x17u }, { 4799u, 1u, 4799u, 1u, 0x17u },
+        { 4800u, 1u, 4800u, 1u, 0x17u }, { 4801u, 1u, 4801u, 1u, 0x17u }, { 4802u, 1u, 4802u, 1u, 0x17u }, { 4803u, 1u, 4803u, 1u, 0x17u }, { 4804u, 1u, 4804u, 1u, 0x17u },
+        { 4805u, 1u, 4805u, 1u, 0x17u }, { 4806u, 1u, 4806u, 1u, 0x17u }, { 4807u, 1u, 4807u, 1u, 0x17u }, { 4808u, 1u, 4808u, 1u, 0x17u }, { 4809u, 1u, 4809u, 1u, 0x17u },
+        { 4810u, 1u, 4810u, 1u, 0x17u }, { 4811u, 1u, 4811u, 1u, 0x17u }, { 4812u, 1u, 4812u, 1u, 0x17u }, { 4813u, 1u, 4813u, 1u, 0x17u }, { 4814u, 1u, 4814u, 1u, 0x17u },
+        { 4815u, 1u, 4815u, 1u, 0x17u }, { 4816u, 1u, 4816u, 1u, 0x17u }, { 4817u, 1u, 4817u, 1u, 0x17u }, { 4818u, 1u, 4818u, 1u, 0x17u }, { 4819u, 1u, 4819u, 1u, 0x17u },
+        { 4820u, 1u, 4820u, 1u, 0x17u }, { 4821u, 1u, 4821u, 1u, 0x17u }, { 4822u, 1u, 4822u, 1u, 0x17u }, { 4823u, 1u, 4823u, 1u, 0x17u }, { 4824u, 1u, 4824u, 1u, 0x17u },
+        { 4825u, 1u, 4825u, 1u, 0x17u }, { 4826u, 1u, 4826u, 1u, 0x17u }, { 4827u, 1u, 4827u, 1u, 0x17u }, { 2878u, 1u, 2878u, 1u, 0x17u }, { 4828u, 1u, 4828u, 1u, 0x17u },
+        { 4829u, 1u, 4829u, 1u, 0x17u }, { 4830u, 1u, 4830u, 1u, 0x17u }, { 4831u, 1u, 4831u, 1u, 0x17u }, { 4832u, 1u, 4832u, 1u, 0x17u }, { 4833u, 1u, 4833u, 1u, 0x17u },
+        { 4834u, 1u, 4834u, 1u, 0x17u }, { 4835u, 1u, 4835u, 1u, 0x17u }, { 4836u, 1u, 4836u, 1u, 0x17u }, { 4837u, 1u, 4837u, 1u, 0x17u }, { 4838u, 1u, 4838u, 1u, 0x17u },
+        { 4839u, 1u, 4839u, 1u, 0x17u }, { 4840u, 1u, 4840u, 1u, 0x17u }, { 4841u, 1u, 4841u, 1u, 0x17u }, { 4842u, 1u, 4842u, 1u, 0x17u }, { 4843u, 1u, 4843u, 1u, 0x17u },
+        { 4844u, 1u, 4844u, 1u, 0x17u }, { 4845u, 1u, 4845u, 1u, 0x17u }, { 4846u, 1u, 4846u, 1u, 0x17u }, { 4847u, 1u, 4847u, 1u, 0x17u }, { 4848u, 1u, 4848u, 1u, 0x17u },
+        { 4849u, 1u, 4849u, 1u, 0x17u }, { 4850u, 1u, 4850u, 1u, 0x17u }, { 4851u, 1u, 4851u, 1u, 0x17u }, { 4852u, 1u, 4852u, 1u, 0x17u }, { 4853u, 1u, 4853u, 1u, 0x17u },
+        { 4854u, 1u, 4854u, 1u, 0x17u }, { 4855u, 1u, 4855u, 1u, 0x17u }, { 4856u, 1u, 4856u, 1u, 0x17u }, { 4857u, 1u, 4857u, 1u, 0x17u }, { 4858u, 1u, 4858u, 1u, 0x17u },
+        { 4859u, 1u, 4859u, 1u, 0x17u }, { 4860u, 1u, 4860u, 1u, 0x17u }, { 4861u, 1u, 4861u, 1u, 0x17u }, { 4862u, 1u, 4862u, 1u, 0x17u }, { 4863u, 1u, 4863u, 1u, 0x17u },
+        { 4864u, 1u, 4864u, 1u, 0x17u }, { 4865u, 1u, 4865u, 1u, 0x17u }, { 4866u, 1u, 4866u, 1u, 0x17u }, { 4867u, 1u, 4867u, 1u, 0x17u }, { 4868u, 1u, 4868u, 1u, 0x17u },
+        { 4869u, 1u, 4869u, 1u, 0x17u }, { 4870u, 1u, 4870u, 1u, 0x17u }, { 4871u, 1u, 4871u, 1u, 0x17u }, { 4872u, 1u, 4872u, 1u, 0x17u }, { 4873u, 1u, 4873u, 1u, 0x17u },
+        { 4874u, 1u, 4874u, 1u, 0x17u }, { 4875u, 1u, 4875u, 1u, 0x17u }, { 0u, 0u, 4876u, 2u, 0x12u }, { 0u, 0u, 4878u, 2u, 0x12u }, { 0u, 0u, 4880u, 2u, 0x12u },
+        { 0u, 0u, 4882u, 3u, 0x12u }, { 0u, 0u, 4885u, 3u, 0x12u }, { 0u, 0u, 4888u, 2u, 0x12u }, { 0u, 0u, 4890u, 2u, 0x12u }, { 0u, 0u, 4892u, 2u, 0x12u },
+        { 0u, 0u, 4894u, 2u, 0x12u }, { 0u, 0u, 4896u, 2u, 0x12u }, { 0u, 0u, 4898u, 2u, 0x12u }, { 4900u, 2u, 4900u, 2u, 0x17u }, { 4902u, 2u, 4902u, 2u, 0x17u },
+        { 0u, 0u, 4904u, 1u, 0x12u }, { 0u, 0u, 4905u, 1u, 0x12u }, { 0u, 0u, 4906u, 1u, 0x12u }, { 0u, 0u, 4907u, 1u, 0x12u }, { 0u, 0u, 4908u, 1u, 0x12u },
+        { 0u, 0u, 4909u, 1u, 0x12u }, { 0u, 0u, 4910u, 1u, 0x12u }, { 4911u, 2u, 4911u, 2u, 0x17u }, { 4913u, 2u, 4913u, 2u, 0x17u }, { 4915u, 3u, 4915u, 3u, 0x17u },
+        { 4918u, 3u, 4918u, 3u, 0x17u }, { 4921u, 2u, 4921u, 2u, 0x17u }, { 4923u, 2u, 4923u, 2u, 0x17u }, { 4925u, 2u, 4925u, 2u, 0x17u }, { 4927u, 2u, 4927u, 2u, 0x17u },
+        { 4929u, 2u, 4929u, 2u, 0x17u }, { 4931u, 2u, 4931u, 2u, 0x17u }, { 4933u, 2u, 4933u, 2u, 0x17u }, { 4935u, 2u, 4935u, 2u, 0x17u }, { 4937u, 2u, 4937u, 2u, 0x17u },
+        { 4939u, 2u, 4939u, 2u, 0x17u }, { 4941u, 2u, 4941u, 2u, 0x17u }, { 4943u, 2u, 4943u, 2u, 0x17u }, { 4945u, 2u, 4945u, 2u, 0x17u }, { 4947u, 2u, 4947u, 2u, 0x17u },
+        { 4949u, 2u, 4949u, 2u, 0x17u }, { 4951u, 2u, 4951u, 2u, 0x17u }, { 4953u, 2u, 4953u, 2u, 0x17u }, { 4955u, 2u, 4955u, 2u, 0x17u }, { 4957u, 2u, 4957u, 2u, 0x17u },
+        { 4959u, 2u, 4959u, 2u, 0x17u }, { 4961u, 2u, 4961u, 2u, 0x17u }, { 4963u, 2u, 4963u, 2u, 0x17u }, { 4965u, 2u, 4965u, 2u, 0x17u }, { 4967u, 2u, 4967u, 2u, 0x17u },
+        { 4969u, 2u, 4969u, 2u, 0x17u }, { 4971u, 2u, 4971u, 2u, 0x17u }, { 4973u, 2u, 4973u, 2u, 0x17u }, { 4975u, 2u, 4975u, 2u, 0x17u }, { 0u, 0u, 4977u, 2u, 0x12u },
+        { 0u, 0u, 4979u, 1u, 0x12u }, { 0u, 0u, 4980u, 1u, 0x12u }, { 0u, 0u, 4981u, 1u, 0x12u }, { 0u, 0u, 4982u, 1u, 0x12u }, { 0u, 0u, 4983u, 1u, 0x12u },
+        { 0u, 0u, 4984u, 1u, 0x12u }, { 0u, 0u, 4985u, 1u, 0x12u }, { 0u, 0u, 4986u, 1u, 0x12u }, { 0u, 0u, 4987u, 1u, 0x12u }, { 0u, 0u, 4988u, 1u, 0x12u },
+        { 0u, 0u, 4989u, 1u, 0x12u }, { 0u, 0u, 4990u, 1u, 0x12u }, { 0u, 0u, 4991u, 1u, 0x12u }, { 0u, 0u, 4992u, 1u, 0x12u }, { 0u, 0u, 4993u, 1u, 0x12u },
+        { 0u, 0u, 4994u, 1u, 0x12u }, { 0u, 0u, 4995u, 1u, 0x12u }, { 0u, 0u, 4996u, 1u, 0x12u }, { 0u, 0u, 4997u, 1u, 0x12u }, { 0u, 0u, 4998u, 1u, 0x12u },
+        { 0u, 0u, 4999u, 1u, 0x12u }, { 0u, 0u, 5000u, 1u, 0x12u }, { 0u, 0u, 5001u, 1u, 0x12u }, { 0u, 0u, 5002u, 1u, 0x12u }, { 0u, 0u, 5003u, 1u, 0x12u },
+        { 0u, 0u, 809u, 2u, 0x12u }, { 0u, 0u, 5004u, 1u, 0x12u }, { 0u, 0u, 5005u, 1u, 0x12u }, { 0u, 0u, 5006u, 1u, 0x12u }, { 0u, 0u, 813u, 2u, 0x12u },
+        { 0u, 0u, 5007u, 1u, 0x12u }, { 0u, 0u, 5008u, 1u, 0x12u }, { 0u, 0u, 5009u, 1u, 0x12u }, { 0u, 0u, 5010u, 1u, 0x12u }, { 0u, 0u, 5011u, 1u, 0x12u },
+        { 0u, 0u, 5012u, 1u, 0x12u }, { 0u, 0u, 5013u, 1u, 0x12u }, { 0u, 0u, 5014u, 1u, 0x12u }, { 0u, 0u, 5015u, 1u, 0x12u }, { 0u, 0u, 5016u, 3u, 0x12u },
+        { 0u, 0u, 5019u, 3u, 0x12u }, { 0u, 0u, 5022u, 3u, 0x12u }, { 0u, 0u, 5025u, 3u, 0x12u }, { 0u, 0u, 5028u, 3u, 0x12u }, { 0u, 0u, 5031u, 3u, 0x12u },
+        { 0u, 0u, 5034u, 3u, 0x12u }, { 0u, 0u, 5037u, 3u, 0x12u }, { 0u, 0u, 5040u, 1u, 0x12u }, { 0u, 0u, 5041u, 3u, 0x12u }, { 0u, 0u, 5044u, 3u, 0x12u },
+        { 0u, 0u, 5047u, 3u, 0x12u }, { 0u, 0u, 5050u, 3u, 0x12u }, { 0u, 0u, 5053u, 2u, 0x12u }, { 0u, 0u, 5055u, 2u, 0x12u }, { 0u, 0u, 5057u, 2u, 0x12u },
+        { 0u, 0u, 5059u, 2u, 0x12u }, { 0u, 0u, 5061u, 2u, 0x12u }, { 0u, 0u, 5063u, 2u, 0x12u }, { 0u, 0u, 5065u, 2u, 0x12u }, { 0u, 0u, 5067u, 2u, 0x12u },
+        { 0u, 0u, 5069u, 2u, 0x12u }, { 0u, 0u, 5071u, 2u, 0x12u }, { 0u, 0u, 5073u, 2u, 0x12u }, { 0u, 0u, 5075u, 2u, 0x12u }, { 0u, 0u, 5077u, 2u, 0x12u },
+        { 0u, 0u, 5079u, 2u, 0x12u }, { 0u, 0u, 5081u, 2u, 0x12u }, { 0u, 0u, 5083u, 2u, 0x12u }, { 0u, 0u, 5085u, 2u, 0x12u }, { 0u, 0u, 5087u, 2u, 0x12u },
+        { 0u, 0u, 5089u, 2u, 0x12u }, { 0u, 0u, 5091u, 2u, 0x12u }, { 0u, 0u, 5093u, 2u, 0x12u }, { 0u, 0u, 5095u, 2u, 0x12u }, { 0u, 0u, 5097u, 2u, 0x12u },
+        { 0u, 0u, 5099u, 2u, 0x12u }, { 0u, 0u, 5101u, 2u, 0x12u }, { 0u, 0u, 5103u, 2u, 0x12u }, { 0u, 0u, 5105u, 2u, 0x12u }, { 0u, 0u, 5107u, 2u, 0x12u },
+        { 0u, 0u, 5109u, 2u, 0x12u }, { 0u, 0u, 5111u, 2u, 0x12u }, { 0u, 0u, 5113u, 2u, 0x12u }, { 0u, 0u, 5115u, 2u, 0x12u }, { 0u, 0u, 5117u, 2u, 0x12u },
+        { 0u, 0u, 5119u, 2u, 0x12u }, { 0u, 0u, 5121u, 2u, 0x12u }, { 0u, 0u, 5123u, 2u, 0x12u }, { 0u, 0u, 5125u, 2u, 0x12u }, { 0u, 0u, 5127u, 2u, 0x12u },
+        { 0u, 0u, 5129u, 2u, 0x12u }, { 0u, 0u, 5131u, 2u, 0x12u }, { 0u, 0u, 5133u, 2u, 0x12u }, { 0u, 0u, 5135u, 2u, 0x12u }, { 0u, 0u, 5137u, 2u, 0x12u },
+        { 0u, 0u, 5139u, 2u, 0x12u }, { 0u, 0u, 5141u, 2u, 0x12u }, { 0u, 0u, 5143u, 2u, 0x12u }, { 0u, 0u, 5145u, 2u, 0x12u }, { 0u, 0u, 5147u, 2u, 0x12u },
+        { 0u, 0u, 5149u, 2u, 0x12u }, { 0u, 0u, 5151u, 2u, 0x12u }, { 0u, 0u, 5153u, 2u, 0x12u }, { 0u, 0u, 5155u, 2u, 0x12u }, { 0u, 0u, 5157u, 2u, 0x12u },
+        { 0u, 0u, 5159u, 2u, 0x12u }, { 0u, 0u, 5161u, 2u, 0x12u }, { 0u, 0u, 5163u, 2u, 0x12u }, { 0u, 0u, 5165u, 2u, 0x12u }, { 0u, 0u, 5167u, 2u, 0x12u },
+        { 0u, 0u, 5169u, 2u, 0x12u }, { 0u, 0u, 5171u, 2u, 0x12u }, { 0u, 0u, 5173u, 2u, 0x12u }, { 0u, 0u, 5175u, 2u, 0x12u }, { 0u, 0u, 5177u, 2u, 0x12u },
+        { 0u, 0u, 5179u, 2u, 0x12u }, { 0u, 0u, 5181u, 2u, 0x12u }, { 0u, 0u, 5183u, 2u, 0x12u }, { 0u, 0u, 5185u, 2u, 0x12u }, { 0u, 0u, 5187u, 2u, 0x12u },
+        { 0u, 0u, 5189u, 2u, 0x12u }, { 0u, 0u, 5191u, 2u, 0x12u }, { 0u, 0u, 5193u, 2u, 0x12u }, { 0u, 0u, 5195u, 2u, 0x12u }, { 0u, 0u, 5197u, 2u, 0x12u },
+        { 0u, 0u, 5199u, 2u, 0x12u }, { 0u, 0u, 5201u, 2u, 0x12u }, { 0u, 0u, 5203u, 2u, 0x12u }, { 0u, 0u, 5205u, 2u, 0x12u }, { 0u, 0u, 5207u, 2u, 0x12u },
+        { 0u, 0u, 5209u, 2u, 0x12u }, { 0u, 0u, 5211u, 2u, 0x12u }, { 0u, 0u, 5213u, 2u, 0x12u }, { 0u, 0u, 5215u, 2u, 0x12u }, { 0u, 0u, 5217u, 2u, 0x12u },
+        { 0u, 0u, 5219u, 2u, 0x12u }, { 0u, 0u, 5221u, 2u, 0x12u }, { 0u, 0u, 5223u, 2u, 0x12u }, { 0u, 0u, 5225u, 2u, 0x12u }, { 0u, 0u, 5227u, 2u, 0x12u },
+        { 0u, 0u, 5229u, 2u, 0x12u }, { 0u, 0u, 5231u, 3u, 0x12u }, { 0u, 0u, 5234u, 3u, 0x12u }, { 0u, 0u, 5237u, 3u, 0x12u }, { 0u, 0u, 5240u, 3u, 0x12u },
+        { 0u, 0u, 5243u, 3u, 0x12u }, { 0u, 0u, 5246u, 3u, 0x12u }, { 0u, 0u, 5249u, 3u, 0x12u }, { 0u, 0u, 5252u, 3u, 0x12u }, { 0u, 0u, 5255u, 3u, 0x12u },
+        { 0u, 0u, 5258u, 2u, 0x12u }, { 0u, 0u, 5260u, 2u, 0x12u }, { 0u, 0u, 5262u, 2u, 0x12u }, { 0u, 0u, 5264u, 2u, 0x12u }, { 0u, 0u, 5266u, 2u, 0x12u },
+        { 0u, 0u, 5268u, 2u, 0x12u }, { 0u, 0u, 5270u, 2u, 0x12u }, { 0u, 0u, 5272u, 2u, 0x12u }, { 0u, 0u, 5274u, 2u, 0x12u }, { 0u, 0u, 5276u, 2u, 0x12u },
+        { 0u, 0u, 5278u, 2u, 0x12u }, { 0u, 0u, 5280u, 2u, 0x12u }, { 0u, 0u, 5282u, 2u, 0x12u }, { 0u, 0u, 5284u, 2u, 0x12u }, { 0u, 0u, 5286u, 2u, 0x12u },
+        { 0u, 0u, 5288u, 2u, 0x12u }, { 0u, 0u, 5290u, 3u, 0x12u }, { 0u, 0u, 5293u, 3u, 0x12u }, { 0u, 0u, 5296u, 2u, 0x12u }, { 0u, 0u, 5298u, 2u, 0x12u },
+        { 0u, 0u, 5300u, 2u, 0x12u }, { 0u, 0u, 5302u, 2u, 0x12u }, { 0u, 0u, 5304u, 2u, 0x12u }, { 0u, 0u, 5306u, 2u, 0x12u }, { 0u, 0u, 5308u, 2u, 0x12u },
+        { 0u, 0u, 5310u, 2u, 0x12u }, { 0u, 0u, 5312u, 2u, 0x12u }, { 0u, 0u, 5314u, 2u, 0x12u }, { 0u, 0u, 5316u, 2u, 0x12u }, { 0u, 0u, 5318u, 3u, 0x12u },
+        { 0u, 0u, 5321u, 3u, 0x12u }, { 0u, 0u, 5324u, 3u, 0x12u }, { 0u, 0u, 5327u, 2u, 0x12u }, { 0u, 0u, 5329u, 2u, 0x12u }, { 0u, 0u, 5331u, 2u, 0x12u },
+        { 0u, 0u, 5333u, 2u, 0x12u }, { 0u, 0u, 5335u, 2u, 0x12u }, { 0u, 0u, 5337u, 2u, 0x12u }, { 0u, 0u, 5339u, 2u, 0x12u }, { 0u, 0u, 5341u, 2u, 0x12u },
+        { 0u, 0u, 5343u, 2u, 0x12u }, { 0u, 0u, 5345u, 2u, 0x12u }, { 0u, 0u, 5347u, 2u, 0x12u }, { 0u, 0u, 5349u, 2u, 0x12u }, { 0u, 0u, 5351u, 2u, 0x12u },
+        { 0u, 0u, 5353u, 2u, 0x12u }, { 0u, 0u, 5355u, 2u, 0x12u }, { 0u, 0u, 5357u, 2u, 0x12u }, { 0u, 0u, 5359u, 2u, 0x12u }, { 0u, 0u, 5361u, 2u, 0x12u },
+        { 0u, 0u, 5363u, 2u, 0x12u }, { 0u, 0u, 5365u, 2u, 0x12u }, { 0u, 0u, 5367u, 2u, 0x12u }, { 0u, 0u, 5369u, 2u, 0x12u }, { 0u, 0u, 5371u, 2u, 0x12u },
+        { 0u, 0u, 5373u, 2u, 0x12u }, { 0u, 0u, 5375u, 2u, 0x12u }, { 0u, 0u, 5377u, 2u, 0x12u }, { 0u, 0u, 5379u, 2u, 0x12u }, { 0u, 0u, 5381u, 2u, 0x12u },
+        { 0u, 0u, 5383u, 3u, 0x12u }, { 0u, 0u, 5386u, 3u, 0x12u }, { 0u, 0u, 5389u, 3u, 0x12u }, { 0u, 0u, 5392u, 3u, 0x12u }, { 0u, 0u, 5395u, 3u, 0x12u },
+        { 0u, 0u, 5398u, 3u, 0x12u }, { 0u, 0u, 5401u, 3u, 0x12u }, { 0u, 0u, 5404u, 3u, 0x12u }, { 0u, 0u, 5407u, 3u, 0x12u }, { 0u, 0u, 5410u, 3u, 0x12u },
+        { 0u, 0u, 5413u, 3u, 0x12u }, { 0u, 0u, 5416u, 3u, 0x12u }, { 0u, 0u, 5419u, 3u, 0x12u }, { 0u, 0u, 5422u, 3u, 0x12u }, { 0u, 0u, 5425u, 3u, 0x12u },
+        { 0u, 0u, 5428u, 3u, 0x12u }, { 0u, 0u, 5431u, 3u, 0x12u }, { 0u, 0u, 5434u, 3u, 0x12u }, { 0u, 0u, 5437u, 3u, 0x12u }, { 0u, 0u, 5440u, 3u, 0x12u },
+        { 0u, 0u, 5443u, 3u, 0x12u }, { 0u, 0u, 5446u, 3u, 0x12u }, { 0u, 0u, 5449u, 3u, 0x12u }, { 0u, 0u, 5452u, 3u, 0x12u }, { 0u, 0u, 5455u, 3u, 0x12u },
+        { 0u, 0u, 5458u, 3u, 0x12u }, { 0u, 0u, 5461u, 3u, 0x12u }, { 0u, 0u, 5464u, 3u, 0x12u }, { 0u, 0u, 5467u, 3u, 0x12u }, { 0u, 0u, 5470u, 3u, 0x12u },
+        { 0u, 0u, 5473u, 3u, 0x12u }, { 0u, 0u, 5476u, 3u, 0x12u }, { 0u, 0u, 5479u, 3u, 0x12u }, { 0u, 0u, 5482u, 3u, 0x12u }, { 0u, 0u, 5485u, 3u, 0x12u },
+        { 0u, 0u, 5488u, 3u, 0x12u }, { 0u, 0u, 5491u, 3u, 0x12u }, { 0u, 0u, 5494u, 3u, 0x12u }, { 0u, 0u, 5497u, 3u, 0x12u }, { 0u, 0u, 5500u, 3u, 0x12u },
+        { 0u, 0u, 5503u, 3u, 0x12u }, { 0u, 0u, 5506u, 3u, 0x12u }, { 0u, 0u, 5509u, 3u, 0x12u }, { 0u, 0u, 5512u, 3u, 0x12u }, { 0u, 0u, 5515u, 3u, 0x12u },
+        { 0u, 0u, 5518u, 3u, 0x12u }, { 0u, 0u, 5521u, 3u, 0x12u }, { 0u, 0u, 5524u, 3u, 0x12u }, { 0u, 0u, 5527u, 3u, 0x12u }, { 0u, 0u, 5530u, 3u, 0x12u },
+        { 0u, 0u, 5533u, 3u, 0x12u }, { 0u, 0u, 5536u, 3u, 0x12u }, { 0u, 0u, 5539u, 3u, 0x12u }, { 0u, 0u, 5542u, 3u, 0x12u }, { 0u, 0u, 5545u, 3u, 0x12u },
+        { 0u, 0u, 5548u, 3u, 0x12u }, { 0u, 0u, 5551u, 3u, 0x12u }, { 0u, 0u, 5554u, 3u, 0x12u }, { 0u, 0u, 5557u, 3u, 0x12u }, { 0u, 0u, 5560u, 3u, 0x12u },
+        { 0u, 0u, 5563u, 3u, 0x12u }, { 0u, 0u, 5566u, 3u, 0x12u }, { 0u, 0u, 5569u, 3u, 0x12u }, { 0u, 0u, 5572u, 3u, 0x12u }, { 0u, 0u, 5575u, 3u, 0x12u },
+        { 0u, 0u, 5578u, 3u, 0x12u }, { 0u, 0u, 5581u, 3u, 0x12u }, { 0u, 0u, 5584u, 3u, 0x12u }, { 0u, 0u, 5587u, 3u, 0x12u }, { 0u, 0u, 5590u, 3u, 0x12u },
+        { 0u, 0u, 5593u, 3u, 0x12u }, { 0u, 0u, 5596u, 3u, 0x12u }, { 0u, 0u, 5599u, 3u, 0x12u }, { 0u, 0u, 5602u, 3u, 0x12u }, { 0u, 0u, 5605u, 3u, 0x12u },
+        { 0u, 0u, 5608u, 3u, 0x12u }, { 0u, 0u, 5611u, 3u, 0x12u }, { 0u, 0u, 5614u, 3u, 0x12u }, { 0u, 0u, 5617u, 3u, 0x12u }, { 0u, 0u, 5620u, 3u, 0x12u },
+        { 0u, 0u, 5623u, 3u, 0x12u }, { 0u, 0u, 5626u, 3u, 0x12u }, { 0u, 0u, 5629u, 3u, 0x12u }, { 0u, 0u, 5632u, 3u, 0x12u }, { 0u, 0u, 5635u, 3u, 0x12u },
+        { 0u, 0u, 5638u, 3u, 0x12u }, { 0u, 0u, 5641u, 3u, 0x12u }, { 0u, 0u, 5644u, 3u, 0x12u }, { 0u, 0u, 5647u, 3u, 0x12u }, { 0u, 0u, 5650u, 3u, 0x12u },
+        { 0u, 0u, 5653u, 3u, 0x12u }, { 0u, 0u, 5656u, 3u, 0x12u }, { 0u, 0u, 5659u, 3u, 0x12u }, { 0u, 0u, 5662u, 3u, 0x12u }, { 0u, 0u, 5665u, 3u, 0x12u },
+        { 0u, 0u, 5668u, 3u, 0x12u }, { 0u, 0u, 5671u, 4u, 0x12u }, { 0u, 0u, 5675u, 4u, 0x12u }, { 0u, 0u, 5679u, 4u, 0x12u }, { 0u, 0u, 5683u, 4u, 0x12u },
+        { 0u, 0u, 5687u, 4u, 0x12u }, { 0u, 0u, 5691u, 4u, 0x12u }, { 0u, 0u, 5695u, 4u, 0x12u }, { 0u, 0u, 5699u, 3u, 0x12u }, { 0u, 0u, 5702u, 18u, 0x12u },
+        { 0u, 0u, 5720u, 8u, 0x12u }, { 0u, 0u, 5728u, 4u, 0x12u }, { 0u, 0u, 5732u, 1u, 0x12u }, { 0u, 0u, 5733u, 1u, 0x12u }, { 0u, 0u, 5734u, 1u, 0x12u },
+        { 0u, 0u, 5735u, 1u, 0x12u }, { 0u, 0u, 621u, 1u, 0x12u }, { 0u, 0u, 5736u, 1u, 0x12u }, { 0u, 0u, 5737u, 1u, 0x12u }, { 0u, 0u, 5738u, 1u, 0x12u },
+        { 0u, 0u, 5739u, 1u, 0x12u }, { 0u, 0u, 5740u, 1u, 0x12u }, { 0u, 0u, 5741u, 1u, 0x12u }, { 0u, 0u, 5742u, 1u, 0x12u }, { 0u, 0u, 5743u, 1u, 0x12u },
+        { 0u, 0u, 5744u, 1u, 0x12u }, { 0u, 0u, 5745u, 1u, 0x12u }, { 0u, 0u, 5746u, 1u, 0x12u }, { 0u, 0u, 5747u, 1u, 0x12u }, { 0u, 0u, 5748u, 1u, 0x12u },
+        { 0u, 0u, 5749u, 1u, 0x12u }, { 0u, 0u, 5750u, 1u, 0x12u }, { 0u, 0u, 2557u, 1u, 0x12u }, { 0u, 0u, 2558u, 1u, 0x12u }, { 0u, 0u, 5751u, 1u, 0x12u },
+        { 0u, 0u, 5752u, 1u, 0x12u }, { 0u, 0u, 5753u, 1u, 0x12u }, { 0u, 0u, 5754u, 1u, 0x12u }, { 0u, 0u, 5755u, 1u, 0x12u }, { 0u, 0u, 5756u, 1u, 0x12u },
+        { 0u, 0u, 5757u, 1u, 0x12u }, { 0u, 0u, 5758u, 1u, 0x12u }, { 0u, 0u, 5759u, 1u, 0x12u }, { 0u, 0u, 5760u, 1u, 0x12u }, { 0u, 0u, 5761u, 1u, 0x12u },
+        { 0u, 0u, 5762u, 1u, 0x12u }, { 0u, 0u, 5763u, 1u, 0x12u }, { 0u, 0u, 5764u, 1u, 0x12u }, { 0u, 0u, 5765u, 1u, 0x12u }, { 0u, 0u, 5766u, 1u, 0x12u },
+        { 0u, 0u, 5767u, 2u, 0x12u }, { 0u, 0u, 5769u, 2u, 0x12u }, { 0u, 0u, 5771u, 2u, 0x12u }, { 0u, 0u, 5773u, 2u, 0x12u }, { 0u, 0u, 5775u, 2u, 0x12u },
+        { 0u, 0u, 5777u, 2u, 0x12u }, { 0u, 0u, 5779u, 2u, 0x12u }, { 0u, 0u, 5781u, 2u, 0x12u }, { 0u, 0u, 5783u, 2u, 0x12u }, { 0u, 0u, 5785u, 2u, 0x12u },
+        { 0u, 0u, 5787u, 2u, 0x12u }, { 0u, 0u, 5789u, 2u, 0x12u }, { 0u, 0u, 5791u, 2u, 0x12u }, { 0u, 0u, 5793u, 2u, 0x12u }, { 0u, 0u, 5795u, 1u, 0x12u },
+        { 0u, 0u, 791u, 2u, 0x12u }, { 0u, 0u, 793u, 2u, 0x12u }, { 0u, 0u, 795u, 2u, 0x12u }, { 0u, 0u, 797u, 2u, 0x12u }, { 0u, 0u, 799u, 2u, 0x12u },
+        { 0u, 0u, 5796u, 1u, 0x12u }, { 0u, 0u, 5797u, 1u, 0x12u }, { 0u, 0u, 5798u, 1u, 0x12u }, { 0u, 0u, 5799u, 1u, 0x12u }, { 0u, 0u, 5800u, 1u, 0x12u },
+        { 0u, 0u, 5801u, 1u, 0x12u }, { 0u, 0u, 5802u, 1u, 0x12u }, { 0u, 0u, 5803u, 1u, 0x12u }, { 0u, 0u, 5804u, 1u, 0x12u }, { 0u, 0u, 5805u, 1u, 0x12u },
+        { 0u, 0u, 5806u, 1u, 0x12u }, { 0u, 0u, 5807u, 1u, 0x12u }, { 0u, 0u, 5808u, 1u, 0x12u }, { 0u, 0u, 5809u, 1u, 0x12u }, { 0u, 0u, 5810u, 1u, 0x12u },
+        { 0u, 0u, 5811u, 1u, 0x12u }, { 0u, 0u, 5812u, 1u, 0x12u }, { 0u, 0u, 5813u, 1u, 0x12u }, { 0u, 0u, 5814u, 1u, 0x12u }, { 0u, 0u, 5815u, 1u, 0x12u },
+        { 0u, 0u, 5816u, 1u, 0x12u }, { 0u, 0u, 5817u, 1u, 0x12u }, { 0u, 0u, 5818u, 1u, 0x12u }, { 0u, 0u, 5819u, 1u, 0x12u }, { 0u, 0u, 5820u, 1u, 0x12u },
+        { 0u, 0u, 5821u, 1u, 0x12u }, { 0u, 0u, 5822u, 1u, 0x12u }, { 0u, 0u, 5823u, 1u, 0x12u }, { 0u, 0u, 5824u, 1u, 0x12u }, { 0u, 0u, 5825u, 3u, 0x12u },
+        { 0u, 0u, 5828u, 3u, 0x12u }, { 0u, 0u, 5831u, 3u, 0x12u }, { 0u, 0u, 5834u, 2u, 0x12u }, { 0u, 0u, 5836u, 1u, 0x12u }, { 0u, 0u, 5837u, 1u, 0x12u },
+        { 0u, 0u, 5838u, 1u, 0x12u }, { 0u, 0u, 5839u, 1u, 0x12u }, { 0u, 0u, 2245u, 1u, 0x12u }, { 0u, 0u, 5840u, 1u, 0x12u }, { 0u, 0u, 5841u, 1u, 0x12u },
+        { 0u, 0u, 5842u, 1u, 0x12u }, { 0u, 0u, 5843u, 1u, 0x12u }, { 0u, 0u, 5844u, 1u, 0x12u }, { 0u, 0u, 5845u, 1u, 0x12u }, { 0u, 0u, 5846u, 1u, 0x12u },
+        { 0u, 0u, 5847u, 1u, 0x12u }, { 0u, 0u, 5848u, 1u, 0x12u }, { 0u, 0u, 5849u, 1u, 0x12u }, { 0u, 0u, 5850u, 1u, 0x12u }, { 0u, 0u, 5851u, 1u, 0x12u },
+        { 0u, 0u, 5852u, 1u, 0x12u }, { 0u, 0u, 5853u, 1u, 0x12u }, { 0u, 0u, 5854u, 1u, 0x12u }, { 0u, 0u, 5855u, 1u, 0x12u }, { 0u, 0u, 5856u, 1u, 0x12u },
+        { 0u, 0u, 5857u, 1u, 0x12u }, { 0u, 0u, 5858u, 1u, 0x12u }, { 0u, 0u, 5859u, 1u, 0x12u }, { 0u, 0u, 5860u, 1u, 0x12u }, { 0u, 0u, 5861u, 1u, 0x12u },
+        { 0u, 0u, 5862u, 1u, 0x12u }, { 0u, 0u, 5863u, 1u, 0x12u }, { 0u, 0u, 5864u, 1u, 0x12u }, { 0u, 0u, 5865u, 1u, 0x12u }, { 0u, 0u, 5866u, 1u, 0x12u },
+        { 0u, 0u, 5867u, 1u, 0x12u }, { 0u, 0u, 5868u, 1u, 0x12u }, { 0u, 0u, 5869u, 1u, 0x12u }, { 0u, 0u, 5870u, 1u, 0x12u }, { 5871u, 2u, 5871u, 2u, 0x3u },
+        { 5873u, 2u, 5873u, 2u, 0x3u }, { 0u, 0u, 5875u, 1u, 0x12u }, { 0u, 0u, 5876u, 1u, 0x12u }, { 0u, 0u, 5877u, 1u, 0x12u }, { 0u, 0u, 5878u, 1u, 0x12u },
+        { 0u, 0u, 5879u, 1u, 0x12u }, { 0u, 0u, 5880u, 1u, 0x12u }, { 0u, 0u, 5881u, 1u, 0x12u }, { 0u, 0u, 5882u, 1u, 0x12u }, { 0u, 0u, 5883u, 1u, 0x12u },
+        { 0u, 0u, 5884u, 1u, 0x12u }, { 0u, 0u, 5885u, 1u, 0x12u }, { 0u, 0u, 5886u, 1u, 0x12u }, { 0u, 0u, 5887u, 1u, 0x12u }, { 0u, 0u, 5888u, 1u, 0x12u },
+        { 0u, 0u, 5889u, 1u, 0x12u }, { 0u, 0u, 5890u, 1u, 0x12u }, { 0u, 0u, 5891u, 1u, 0x12u }, { 0u, 0u, 5892u, 1u, 0x12u }, { 0u, 0u, 5893u, 1u, 0x12u },
+        { 0u, 0u, 5894u, 1u, 0x12u }, { 0u, 0u, 5895u, 1u, 0x12u }, { 0u, 0u, 5896u, 1u, 0x12u }, { 0u, 0u, 5897u, 1u, 0x12u }, { 0u, 0u, 5898u, 1u, 0x12u },
+        { 0u, 0u, 5899u, 1u, 0x12u }, { 0u, 0u, 5900u, 1u, 0x12u }, { 0u, 0u, 5901u, 1u, 0x12u }, { 0u, 0u, 5902u, 1u, 0x12u }, { 0u, 0u, 5903u, 1u, 0x12u },
+        { 0u, 0u, 5904u, 1u, 0x12u }, { 0u, 0u, 5905u, 1u, 0x12u }, { 0u, 0u, 5906u, 1u, 0x12u }, { 0u, 0u, 5907u, 1u, 0x12u }, { 0u, 0u, 5908u, 1u, 0x12u },
+        { 0u, 0u, 5909u, 1u, 0x12u }, { 0u, 0u, 5910u, 1u, 0x12u }, { 0u, 0u, 5911u, 1u, 0x12u }, { 0u, 0u, 5912u, 1u, 0x12u }, { 0u, 0u, 5913u, 1u, 0x12u },
+        { 0u, 0u, 5914u, 1u, 0x12u }, { 0u, 0u, 5915u, 1u, 0x12u }, { 0u, 0u, 5916u, 1u, 0x12u }, { 0u, 0u, 5917u, 1u, 0x12u }, { 0u, 0u, 5918u, 1u, 0x12u },
+        { 0u, 0u, 5919u, 1u, 0x12u }, { 0u, 0u, 5920u, 1u, 0x12u }, { 0u, 0u, 5921u, 1u, 0x12u }, { 0u, 0u, 5922u, 1u, 0x12u }, { 0u, 0u, 5923u, 1u, 0x12u },
+        { 0u, 0u, 5924u, 1u, 0x12u }, { 0u, 0u, 5925u, 1u, 0x12u }, { 0u, 0u, 5926u, 1u, 0x12u }, { 0u, 0u, 5927u, 1u, 0x12u }, { 0u, 0u, 5928u, 1u, 0x12u },
+        { 5929u, 2u, 5929u, 2u, 0x3u }, { 5931u, 2u, 5931u, 2u, 0x3u }, { 5933u, 2u, 5933u, 2u, 0x3u }, { 5935u, 2u, 5935u, 2u, 0x3u }, { 5937u, 2u, 5937u, 2u, 0x3u },
+        { 5939u, 2u, 5939u, 2u, 0x3u }, { 5941u, 2u, 5941u, 2u, 0x3u }, { 5943u, 2u, 5943u, 2u, 0x3u }, { 5945u, 2u, 5945u, 2u, 0x3u }, { 5947u, 2u, 5947u, 2u, 0x3u },
+        { 5949u, 2u, 5949u, 2u, 0x3u }, { 5951u, 2u, 5951u, 2u, 0x3u }, { 5953u, 2u, 5953u, 2u, 0x3u }, { 5955u, 2u, 5955u, 2u, 0x3u }, { 5957u, 2u, 5957u, 2u, 0x3u },
+        { 5959u, 2u, 5959u, 2u, 0x3u }, { 5961u, 2u, 5961u, 2u, 0x3u }, { 5963u, 2u, 5963u, 2u, 0x3u }, { 5965u, 2u, 5965u, 2u, 0x3u }, { 5967u, 2u, 5967u, 2u, 0x3u },
+        { 5969u, 2u, 5969u, 2u, 0x3u }, { 5971u, 2u, 5971u, 2u, 0x3u }, { 5973u, 2u, 5973u, 2u, 0x3u }, { 5975u, 2u, 5975u, 2u, 0x3u }, { 5977u, 2u, 5977u, 2u, 0x3u },
+        { 5979u, 3u, 5979u, 3u, 0x3u }, { 5982u, 3u, 5982u, 3u, 0x3u }, { 5985u, 3u, 5985u, 3u, 0x3u }, { 5988u, 2u, 5988u, 2u, 0x3u }, { 5990u, 2u, 5990u, 2u, 0x3u },
+        { 5992u, 3u, 5992u, 3u, 0x3u }, { 5995u, 2u, 5995u, 2u, 0x17u }, { 5997u, 2u, 5997u, 2u, 0x17u }, { 5999u, 3u, 5999u, 3u, 0x17u }, { 6002u, 3u, 6002u, 3u, 0x17u },
+        { 6005u, 3u, 6005u, 3u, 0x17u }, { 6008u, 3u, 6008u, 3u, 0x17u }, { 6011u, 3u, 6011u, 3u, 0x17u }, { 6014u, 2u, 6014u, 2u, 0x17u }, { 6016u, 2u, 6016u, 2u, 0x17u },
+        { 6018u, 3u, 6018u, 3u, 0x17u }, { 6021u, 3u, 6021u, 3u, 0x17u }, { 6024u, 3u, 6024u, 3u, 0x17u }, { 6027u, 3u, 6027u, 3u, 0x17u }, { 0u, 0u, 6030u, 1u, 0x12u },
+        { 0u, 0u, 6031u, 1u, 0x12u }, { 0u, 0u, 6032u, 1u, 0x12u }, { 0u, 0u, 6033u, 1u, 0x12u }, { 0u, 0u, 6034u, 1u, 0x12u }, { 0u, 0u, 6035u, 1u, 0x12u },
+        { 0u, 0u, 6036u, 1u, 0x12u }, { 0u, 0u, 6037u, 1u, 0x12u }, { 0u, 0u, 6038u, 1u, 0x12u }, { 0u, 0u, 6039u, 1u, 0x12u }, { 0u, 0u, 6040u, 1u, 0x12u },
+        { 0u, 0u, 6041u, 1u, 0x12u }, { 0u, 0u, 6042u, 1u, 0x12u }, { 0u, 0u, 6043u, 1u, 0x12u }, { 0u, 0u, 6044u, 1u, 0x12u }, { 0u, 0u, 6045u, 1u, 0x12u },
+        { 0u, 0u, 6046u, 1u, 0x12u }, { 0u, 0u, 6047u, 1u, 0x12u }, { 0u, 0u, 6048u, 1u, 0x12u }, { 0u, 0u, 6049u, 1u, 0x12u }, { 0u, 0u, 2348u, 1u, 0x12u },
+        { 0u, 0u, 6050u, 1u, 0x12u }, { 0u, 0u, 6051u, 1u, 0x12u }, { 0u, 0u, 6052u, 1u, 0x12u }, { 0u, 0u, 6053u, 1u, 0x12u }, { 0u, 0u, 2141u, 1u, 0x12u },
+        { 0u, 0u, 6054u, 1u, 0x12u }, { 0u, 0u, 6055u, 1u, 0x12u }, { 0u, 0u, 6056u, 1u, 0x12u }, { 0u, 0u, 6057u, 1u, 0x12u }, { 0u, 0u, 6058u, 1u, 0x12u },
+        { 0u, 0u, 6059u, 1u, 0x12u }, { 0u, 0u, 6060u, 1u, 0x12u }, { 0u, 0u, 6061u, 1u, 0x12u }, { 0u, 0u, 6062u, 1u, 0x12u }, { 0u, 0u, 6063u, 1u, 0x12u },
+        { 0u, 0u, 6064u, 1u, 0x12u }, { 0u, 0u, 6065u, 1u, 0x12u }, { 0u, 0u, 6066u, 1u, 0x12u }, { 0u, 0u, 6067u, 1u, 0x12u }, { 0u, 0u, 6068u, 1u, 0x12u },
+        { 0u, 0u, 6069u, 1u, 0x12u }, { 0u, 0u, 6070u, 1u, 0x12u }, { 0u, 0u, 6071u, 1u, 0x12u }, { 0u, 0u, 6072u, 1u, 0x12u }, { 0u, 0u, 6073u, 1u, 0x12u },
+        { 0u, 0u, 6074u, 1u, 0x12u }, { 0u, 0u, 6075u, 1u, 0x12u }, { 0u, 0u, 6076u, 1u, 0x12u }, { 0u, 0u, 6077u, 1u, 0x12u }, { 0u, 0u, 6078u, 1u, 0x12u },
+        { 0u, 0u, 6079u, 1u, 0x12u }, { 0u, 0u, 6080u, 1u, 0x12u }, { 0u, 0u, 6081u, 1u, 0x12u }, { 0u, 0u, 6082u, 1u, 0x12u }, { 0u, 0u, 6083u, 1u, 0x12u },
+        { 0u, 0u, 6084u, 1u, 0x12u }, { 0u, 0u, 6085u, 1u, 0x12u }, { 0u, 0u, 6086u, 1u, 0x12u }, { 0u, 0u, 6087u, 1u, 0x12u }, { 0u, 0u, 6088u, 1u, 0x12u },
+        { 0u, 0u, 6089u, 1u, 0x12u }, { 0u, 0u, 6090u, 1u, 0x12u }, { 0u, 0u, 6091u, 1u, 0x12u }, { 0u, 0u, 6092u, 1u, 0x12u }, { 0u, 0u, 6093u, 1u, 0x12u },
+        { 0u, 0u, 6094u, 1u, 0x12u }, { 0u, 0u, 6095u, 1u, 0x12u }, { 0u, 0u, 6096u, 1u, 0x12u }, { 0u, 0u, 6097u, 1u, 0x12u }, { 0u, 0u, 6098u, 1u, 0x12u },
+        { 0u, 0u, 6099u, 1u, 0x12u }, { 0u, 0u, 6100u, 1u, 0x12u }, { 0u, 0u, 6101u, 1u, 0x12u }, { 0u, 0u, 6102u, 1u, 0x12u }, { 0u, 0u, 6103u, 1u, 0x12u },
+        { 0u, 0u, 6104u, 1u, 0x12u }, { 0u, 0u, 6105u, 1u, 0x12u }, { 0u, 0u, 6106u, 1u, 0x12u }, { 0u, 0u, 6107u, 1u, 0x12u }, { 0u, 0u, 6108u, 2u, 0x12u },
+        { 0u, 0u, 6110u, 2u, 0x12u }, { 0u, 0u, 6112u, 2u, 0x12u }, { 0u, 0u, 6114u, 2u, 0x12u }, { 0u, 0u, 6116u, 2u, 0x12u }, { 0u, 0u, 6118u, 2u, 0x12u },
+        { 0u, 0u, 6120u, 2u, 0x12u }, { 0u, 0u, 6122u, 2u, 0x12u }, { 0u, 0u, 6124u, 2u, 0x12u }, { 0u, 0u, 6126u, 2u, 0x12u }, { 0u, 0u, 6128u, 2u, 0x12u },
+        { 0u, 0u, 6130u, 3u, 0x12u }, { 0u, 0u, 6133u, 3u, 0x12u }, { 0u, 0u, 6136u, 3u, 0x12u }, { 0u, 0u, 6139u, 3u, 0x12u }, { 0u, 0u, 6142u, 3u, 0x12u },
+        { 0u, 0u, 6145u, 3u, 0x12u }, { 0u, 0u, 6148u, 3u, 0x12u }, { 0u, 0u, 6151u, 3u, 0x12u }, { 0u, 0u, 6154u, 3u, 0x12u }, { 0u, 0u, 6157u, 3u, 0x12u },
+        { 0u, 0u, 6160u, 3u, 0x12u }, { 0u, 0u, 6163u, 3u, 0x12u }, { 0u, 0u, 6166u, 3u, 0x12u }, { 0u, 0u, 6169u, 3u, 0x12u }, { 0u, 0u, 6172u, 3u, 0x12u },
+        { 0u, 0u, 6175u, 3u, 0x12u }, { 0u, 0u, 6178u, 3u, 0x12u }, { 0u, 0u, 6181u, 3u, 0x12u }, { 0u, 0u, 6184u, 3u, 0x12u }, { 0u, 0u, 6187u, 3u, 0x12u },
+        { 0u, 0u, 6190u, 3u, 0x12u }, { 0u, 0u, 6193u, 3u, 0x12u }, { 0u, 0u, 6196u, 3u, 0x12u }, { 0u, 0u, 6199u, 3u, 0x12u }, { 0u, 0u, 6202u, 3u, 0x12u },
+        { 0u, 0u, 6205u, 3u, 0x12u }, { 0u, 0u, 6208u, 3u, 0x12u }, { 0u, 0u, 6211u, 2u, 0x12u }, { 0u, 0u, 6213u, 2u, 0x12u }, { 0u, 0u, 6215u, 2u, 0x12u },
+        { 0u, 0u, 6217u, 2u, 0x12u }, { 0u, 0u, 6219u, 2u, 0x12u }, { 0u, 0u, 6221u, 3u, 0x12u }, { 0u, 0u, 6224u, 2u, 0x12u }, { 0u, 0u, 6226u, 2u, 0x12u },
+        { 0u, 0u, 6228u, 2u, 0x12u }, { 0u, 0u, 6230u, 2u, 0x12u }, { 0u, 0u, 6232u, 2u, 0x12u }, { 0u, 0u, 6234u, 2u, 0x12u }, { 0u, 0u, 6236u, 2u, 0x12u },
+        { 0u, 0u, 6238u, 1u, 0x12u }, { 0u, 0u, 6239u, 1u, 0x12u }, { 0u, 0u, 3104u, 2u, 0x12u }, { 0u, 0u, 6240u, 1u, 0x12u }, { 0u, 0u, 6241u, 1u, 0x12u },
+        { 0u, 0u, 6242u, 1u, 0x12u }, { 0u, 0u, 6243u, 1u, 0x12u }, { 0u, 0u, 6244u, 1u, 0x12u }, { 0u, 0u, 4648u, 1u, 0x12u }, { 0u, 0u, 6245u, 1u, 0x12u },
+        { 0u, 0u, 6246u, 1u, 0x12u }, { 0u, 0u, 6247u, 1u, 0x12u }, { 0u, 0u, 6248u, 1u, 0x12u }, { 0u, 0u, 6249u, 1u, 0x12u }, { 0u, 0u, 6250u, 1u, 0x12u },
+        { 0u, 0u, 6251u, 1u, 0x12u }, { 0u, 0u, 6252u, 1u, 0x12u }, { 0u, 0u, 6253u, 1u, 0x12u }, { 0u, 0u, 6254u, 1u, 0x12u }, { 0u, 0u, 6255u, 1u, 0x12u },
+        { 0u, 0u, 6256u, 1u, 0x12u }, { 0u, 0u, 6257u, 1u, 0x12u }, { 0u, 0u, 6258u, 1u, 0x12u }, { 0u, 0u, 6259u, 1u, 0x12u }, { 0u, 0u, 6260u, 1u, 0x12u },
+        { 0u, 0u, 6261u, 1u, 0x12u }, { 0u, 0u, 6262u, 1u, 0x12u }, { 0u, 0u, 6263u, 1u, 0x12u }, { 0u, 0u, 6264u, 1u, 0x12u }, { 0u, 0u, 6265u, 1u, 0x12u },
+        { 0u, 0u, 6266u, 1u, 0x12u }, { 0u, 0u, 6267u, 1u, 0x12u }, { 0u, 0u, 6268u, 3u, 0x12u }, { 0u, 0u, 6271u, 3u, 0x12u }, { 0u, 0u, 6274u, 3u, 0x12u },
+        { 0u, 0u, 6277u, 3u, 0x12u }, { 0u, 0u, 6280u, 3u, 0x12u }, { 0u, 0u, 6283u, 3u, 0x12u }, { 0u, 0u, 6286u, 3u, 0x12u }, { 0u, 0u, 6289u, 3u, 0x12u },
+        { 0u, 0u, 6292u, 3u, 0x12u }, { 0u, 0u, 6295u, 1u, 0x12u }, { 0u, 0u, 6296u, 1u, 0x12u }, { 6297u, 1u, 6297u, 1u, 0x17u }, { 6298u, 1u, 6298u, 1u, 0x17u },
+        { 6299u, 1u, 6299u, 1u, 0x17u }, { 6300u, 1u, 6300u, 1u, 0x17u }, { 6301u, 1u, 6301u, 1u, 0x17u }, { 6302u, 1u, 6302u, 1u, 0x17u }, { 6303u, 1u, 6303u, 1u, 0x17u },
+        { 6304u, 1u, 6304u, 1u, 0x17u }, { 6305u, 1u, 6305u, 1u, 0x17u }, { 6306u, 1u, 6306u, 1u, 0x17u }, { 6307u, 1u, 6307u, 1u, 0x17u }, { 6308u, 1u, 6308u, 1u, 0x17u },
+        { 6309u, 1u, 6309u, 1u, 0x17u }, { 6310u, 1u, 6310u, 1u, 0x17u }, { 6311u, 1u, 6311u, 1u, 0x17u }, { 6312u, 1u, 6312u, 1u, 0x17u }, { 6313u, 1u, 6313u, 1u, 0x17u },
+        { 6314u, 1u, 6314u, 1u, 0x17u }, { 6247u, 1u, 6247u, 1u, 0x17u }, { 6315u, 1u, 6315u, 1u, 0x17u }, { 6316u, 1u, 6316u, 1u, 0x17u }, { 6317u, 1u, 6317u, 1u, 0x17u },
+        { 6318u, 1u, 6318u, 1u, 0x17u }, { 6319u, 1u, 6319u, 1u, 0x17u }, { 6320u, 1u, 6320u, 1u, 0x17u }, { 2817u, 1u, 2817u, 1u, 0x17u }, { 6321u, 1u, 6321u, 1u, 0x17u },
+        { 6322u, 1u, 6322u, 1u, 0x17u }, { 6323u, 1u, 6323u, 1u, 0x17u }, { 6324u, 1u, 6324u, 1u, 0x17u }, { 6265u, 1u, 6265u, 1u, 0x17u }, { 6325u, 1u, 6325u, 1u, 0x17u },
+        { 6326u, 1u, 6326u, 1u, 0x17u }, { 6327u, 1u, 6327u, 1u, 0x17u }, { 6328u, 1u, 6328u, 1u, 0x17u }, { 6329u, 1u, 6329u, 1u, 0x17u }, { 6330u, 1u, 6330u, 1u, 0x17u },
+        { 6331u, 1u, 6331u, 1u, 0x17u }, { 6332u, 1u, 6332u, 1u, 0x17u }, { 6333u, 1u, 6333u, 1u, 0x17u }, { 6334u, 1u, 6334u, 1u, 0x17u }, { 6335u, 1u, 6335u, 1u, 0x17u },
+        { 6336u, 1u, 6336u, 1u, 0x17u }, { 6337u, 1u, 6337u, 1u, 0x17u }, { 6338u, 1u, 6338u, 1u, 0x17u }, { 6339u, 1u, 6339u, 1u, 0x17u }, { 6340u, 1u, 6340u, 1u, 0x17u },
+        { 6341u, 1u, 6341u, 1u, 0x17u }, { 6342u, 1u, 6342u, 1u, 0x17u }, { 6343u, 1u, 6343u, 1u, 0x17u }, { 6344u, 1u, 6344u, 1u, 0x17u }, { 6345u, 1u, 6345u, 1u, 0x17u },
+        { 6346u, 1u, 6346u, 1u, 0x17u }, { 6347u, 1u, 6347u, 1u, 0x17u }, { 6348u, 1u, 6348u, 1u, 0x17u }, { 6349u, 1u, 6349u, 1u, 0x17u }, { 6350u, 1u, 6350u, 1u, 0x17u },
+        { 6351u, 1u, 6351u, 1u, 0x17u }, { 6352u, 1u, 6352u, 1u, 0x17u }, { 6353u, 1u, 6353u, 1u, 0x17u }, { 6354u, 1u, 6354u, 1u, 0x17u }, { 6355u, 1u, 6355u, 1u, 0x17u },
+        { 6356u, 1u, 6356u, 1u, 0x17u }, { 6357u, 1u, 6357u, 1u, 0x17u }, { 6358u, 1u, 6358u, 1u, 0x17u }, { 6359u, 1u, 6359u, 1u, 0x17u }, { 6360u, 1u, 6360u, 1u, 0x17u },
+        { 6361u, 1u, 6361u, 1u, 0x17u }, { 6362u, 1u, 6362u, 1u, 0x17u }, { 6363u, 1u, 6363u, 1u, 0x17u }, { 6364u, 1u, 6364u, 1u, 0x17u }, { 6365u, 1u, 6365u, 1u, 0x17u },
+        { 6366u, 1u, 6366u, 1u, 0x17u }, { 6367u, 1u, 6367u, 1u, 0x17u }, { 6368u, 1u, 6368u, 1u, 0x17u }, { 6369u, 1u, 6369u, 1u, 0x17u }, { 6370u, 1u, 6370u, 1u, 0x17u },
+        { 6240u, 1u, 6240u, 1u, 0x17u }, { 6371u, 1u, 6371u, 1u, 0x17u }, { 6372u, 1u, 6372u, 1u, 0x17u }, { 6373u, 1u, 6373u, 1u, 0x17u }, { 6374u, 1u, 6374u, 1u, 0x17u },
+        { 6375u, 1u, 6375u, 1u, 0x17u }, { 6376u, 1u, 6376u, 1u, 0x17u }, { 6377u, 1u, 6377u, 1u, 0x17u }, { 6378u, 1u, 6378u, 1u, 0x17u }, { 6379u, 1u, 6379u, 1u, 0x17u },
+        { 6380u, 1u, 6380u, 1u, 0x17u }, { 6381u, 1u, 6381u, 1u, 0x17u }, { 6382u, 1u, 6382u, 1u, 0x17u }, { 6383u, 1u, 6383u, 1u, 0x17u }, { 6384u, 1u, 6384u, 1u, 0x17u },
+        { 6385u, 1u, 6385u, 1u, 0x17u }, { 6386u, 1u, 6386u, 1u, 0x17u }, { 6387u, 1u, 6387u, 1u, 0x17u }, { 6388u, 1u, 6388u, 1u, 0x17u }, { 6389u, 1u, 6389u, 1u, 0x17u },
+        { 6390u, 1u, 6390u, 1u, 0x17u }, { 6391u, 1u, 6391u, 1u, 0x17u }, { 2843u, 1u, 2843u, 1u, 0x17u }, { 6392u, 1u, 6392u, 1u, 0x17u }, { 6393u, 1u, 6393u, 1u, 0x17u },
+        { 6394u, 1u, 6394u, 1u, 0x17u }, { 6395u, 1u, 6395u, 1u, 0x17u }, { 6396u, 1u, 6396u, 1u, 0x17u }, { 6397u, 1u, 6397u, 1u, 0x17u }, { 6398u, 1u, 6398u, 1u, 0x17u },
+        { 6399u, 1u, 6399u, 1u, 0x17u }, { 6400u, 1u, 6400u, 1u, 0x17u }, { 6401u, 1u, 6401u, 1u, 0x17u }, { 6402u, 1u, 6402u, 1u, 0x17u }, { 6403u, 1u, 6403u, 1u, 0x17u },
+        { 6404u, 1u, 6404u, 1u, 0x17u }, { 6405u, 1u, 6405u, 1u, 0x17u }, { 6406u, 1u, 6406u, 1u, 0x17u }, { 6407u, 1u, 6407u, 1u, 0x17u }, { 6408u, 1u, 6408u, 1u, 0x17u },
+        { 6409u, 1u, 6409u, 1u, 0x17u }, { 6410u, 1u, 6410u, 1u, 0x17u }, { 6411u, 1u, 6411u, 1u, 0x17u }, { 6412u, 1u, 6412u, 1u, 0x17u }, { 6413u, 1u, 6413u, 1u, 0x17u },
+        { 6414u, 1u, 6414u, 1u, 0x17u }, { 6415u, 1u, 6415u, 1u, 0x17u }, { 2855u, 1u, 2855u, 1u, 0x17u }, { 6416u, 1u, 6416u, 1u, 0x17u }, { 6417u, 1u, 6417u, 1u, 0x17u },
+        { 6418u, 1u, 6418u, 1u, 0x17u }, { 6419u, 1u, 6419u, 1u, 0x17u }, { 6420u, 1u, 6420u, 1u, 0x17u }, { 6421u, 1u, 6421u, 1u, 0x17u }, { 6422u, 1u, 6422u, 1u, 0x17u },
+        { 6423u, 1u, 6423u, 1u, 0x17u }, { 6424u, 1u, 6424u, 1u, 0x17u }, { 6425u, 1u, 6425u, 1u, 0x17u }, { 6426u, 1u, 6426u, 1u, 0x17u }, { 6427u, 1u, 6427u, 1u, 0x17u },
+        { 6428u, 1u, 6428u, 1u, 0x17u }, { 6429u, 1u, 6429u, 1u, 0x17u }, { 6430u, 1u, 6430u, 1u, 0x17u }, { 6431u, 1u, 6431u, 1u, 0x17u }, { 6432u, 1u, 6432u, 1u, 0x17u },
+        { 6433u, 1u, 6433u, 1u, 0x17u }, { 6434u, 1u, 6434u, 1u, 0x17u }, { 6435u, 1u, 6435u, 1u, 0x17u }, { 6436u, 1u, 6436u, 1u, 0x17u }, { 6437u, 1u, 6437u, 1u, 0x17u },
+        { 6438u, 1u, 6438u, 1u, 0x17u }, { 6439u, 1u, 6439u, 1u, 0x17u }, { 6440u, 1u, 6440u, 1u, 0x17u }, { 6441u, 1u, 6441u, 1u, 0x17u }, { 6442u, 1u, 6442u, 1u, 0x17u },
+        { 6443u, 1u, 6443u, 1u, 0x17u }, { 6444u, 1u, 6444u, 1u, 0x17u }, { 6445u, 1u, 6445u, 1u, 0x17u }, { 6446u, 1u, 6446u, 1u, 0x17u }, { 6447u, 1u, 6447u, 1u, 0x17u },
+        { 6448u, 1u, 6448u, 1u, 0x17u }, { 6449u, 1u, 6449u, 1u, 0x17u }, { 6450u, 1u, 6450u, 1u, 0x17u }, { 6451u, 1u, 6451u, 1u, 0x17u }, { 6452u, 1u, 6452u, 1u, 0x17u },
+        { 6453u, 1u, 6453u, 1u, 0x17u }, { 6454u, 1u, 6454u, 1u, 0x17u }, { 6455u, 1u, 6455u, 1u, 0x17u }, { 6456u, 1u, 6456u, 1u, 0x17u }, { 6457u, 1u, 6457u, 1u, 0x17u },
+        { 6458u, 1u, 6458u, 1u, 0x17u }, { 6459u, 1u, 6459u, 1u, 0x17u }, { 6460u, 1u, 6460u, 1u, 0x17u }, { 6461u, 1u, 6461u, 1u, 0x17u }, { 6462u, 1u, 6462u, 1u, 0x17u },
+        { 6463u, 1u, 6463u, 1u, 0x17u }, { 6464u, 1u, 6464u, 1u, 0x17u }, { 6465u, 1u, 6465u, 1u, 0x17u }, { 6466u, 1u, 6466u, 1u, 0x17u }, { 6467u, 1u, 6467u, 1u, 0x17u },
+        { 6468u, 1u, 6468u, 1u, 0x17u }, { 6469u, 1u, 6469u, 1u, 0x17u }, { 6470u, 1u, 6470u, 1u, 0x17u }, { 6471u, 1u, 6471u, 1u, 0x17u }, { 6472u, 1u, 6472u, 1u, 0x17u },
+        { 6473u, 1u, 6473u, 1u, 0x17u }, { 6474u, 1u, 6474u, 1u, 0x17u }, { 6475u, 1u, 6475u, 1u, 0x17u }, { 6476u, 1u, 6476u, 1u, 0x17u }, { 6477u, 1u, 6477u, 1u, 0x17u },
+        { 6478u, 1u, 6478u, 1u, 0x17u }, { 6479u, 1u, 6479u, 1u, 0x17u }, { 6480u, 1u, 6480u, 1u, 0x17u }, { 6481u, 1u, 6481u, 1u, 0x17u }, { 6482u, 1u, 6482u, 1u, 0x17u },
+        { 6483u, 1u, 6483u, 1u, 0x17u }, { 6484u, 1u, 6484u, 1u, 0x17u }, { 6485u, 1u, 6485u, 1u, 0x17u }, { 6486u, 1u, 6486u, 1u, 0x17u }, { 6487u, 1u, 6487u, 1u, 0x17u },
+        { 6488u, 1u, 6488u, 1u, 0x17u }, { 6489u, 1u, 6489u, 1u, 0x17u }, { 6490u, 1u, 6490u, 1u, 0x17u }, { 6491u, 1u, 6491u, 1u, 0x17u }, { 6492u, 1u, 6492u, 1u, 0x17u },
+        { 6493u, 1u, 6493u, 1u, 0x17u }, { 6494u, 1u, 6494u, 1u, 0x17u }, { 6495u, 1u, 6495u, 1u, 0x17u }, { 6496u, 1u, 6496u, 1u, 0x17u }, { 6497u, 1u, 6497u, 1u, 0x17u },
+        { 6498u, 1u, 6498u, 1u, 0x17u }, { 6499u, 1u, 6499u, 1u, 0x17u }, { 6500u, 1u, 6500u, 1u, 0x17u }, { 6501u, 1u, 6501u, 1u, 0x17u }, { 6502u, 1u, 6502u, 1u, 0x17u },
+        { 6503u, 1u, 6503u, 1u, 0x17u }, { 6504u, 1u, 6504u, 1u, 0x17u }, { 6505u, 1u, 6505u, 1u, 0x17u }, { 6506u, 1u, 6506u, 1u, 0x17u }, { 6507u, 1u, 6507u, 1u, 0x17u },
+        { 6508u, 1u, 6508u, 1u, 0x17u }, { 6509u, 1u, 6509u, 1u, 0x17u }, { 6510u, 1u, 6510u, 1u, 0x17u }, { 6511u, 1u, 6511u, 1u, 0x17u }, { 6512u, 1u, 6512u, 1u, 0x17u },
+        { 6513u, 1u, 6513u, 1u, 0x17u }, { 6514u, 1u, 6514u, 1u, 0x17u }, { 6515u, 1u, 6515u, 1u, 0x17u }, { 6516u, 1u, 6516u, 1u, 0x17u }, { 6517u, 1u, 6517u, 1u, 0x17u },
+        { 6518u, 1u, 6518u, 1u, 0x17u }, { 6519u, 1u, 6519u, 1u, 0x17u }, { 6520u, 1u, 6520u, 1u, 0x17u }, { 6521u, 1u, 6521u, 1u, 0x17u }, { 6522u, 1u, 6522u, 1u, 0x17u },
+        { 6523u, 1u, 6523u, 1u, 0x17u }, { 6524u, 1u, 6524u, 1u, 0x17u }, { 6525u, 1u, 6525u, 1u, 0x17u }, { 6526u, 1u, 6526u, 1u, 0x17u }, { 6527u, 1u, 6527u, 1u, 0x17u },
+        { 6528u, 1u, 6528u, 1u, 0x17u }, { 6529u, 1u, 6529u, 1u, 0x17u }, { 6530u, 1u, 6530u, 1u, 0x17u }, { 6531u, 1u, 6531u, 1u, 0x17u }, { 6532u, 1u, 6532u, 1u, 0x17u },
+        { 6533u, 1u, 6533u, 1u, 0x17u }, { 6534u, 1u, 6534u, 1u, 0x17u }, { 6535u, 1u, 6535u, 1u, 0x17u }, { 6536u, 1u, 6536u, 1u, 0x17u }, { 6537u, 1u, 6537u, 1u, 0x17u },
+        { 6538u, 1u, 6538u, 1u, 0x17u }, { 6539u, 1u, 6539u, 1u, 0x17u }, { 6540u, 1u, 6540u, 1u, 0x17u }, { 6541u, 1u, 6541u, 1u, 0x17u }, { 6542u, 1u, 6542u, 1u, 0x17u },
+        { 6543u, 1u, 6543u, 1u, 0x17u }, { 6544u, 1u, 6544u, 1u, 0x17u }, { 6545u, 1u, 6545u, 1u, 0x17u }, { 6546u, 1u, 6546u, 1u, 0x17u }, { 6547u, 1u, 6547u, 1u, 0x17u },
+        { 6548u, 1u, 6548u, 1u, 0x17u }, { 6549u, 1u, 6549u, 1u, 0x17u }, { 6550u, 1u, 6550u, 1u, 0x17u }, { 6551u, 1u, 6551u, 1u, 0x17u }, { 6552u, 1u, 6552u, 1u, 0x17u },
+        { 6553u, 1u, 6553u, 1u, 0x17u }, { 6554u, 1u, 6554u, 1u, 0x17u }, { 6555u, 1u, 6555u, 1u, 0x17u }, { 6556u, 1u, 6556u, 1u, 0x17u }, { 6557u, 1u, 6557u, 1u, 0x17u },
+        { 6558u, 1u, 6558u, 1u, 0x17u }, { 6559u, 1u, 6559u, 1u, 0x17u }, { 6560u, 1u, 6560u, 1u, 0x17u }, { 6561u, 1u, 6561u, 1u, 0x17u }, { 6562u, 1u, 6562u, 1u, 0x17u },
+        { 6563u, 1u, 6563u, 1u, 0x17u }, { 6564u, 1u, 6564u, 1u, 0x17u }, { 6565u, 1u, 6565u, 1u, 0x17u }, { 6566u, 1u, 6566u, 1u, 0x17u }, { 6567u, 1u, 6567u, 1u, 0x17u },
+        { 6568u, 1u, 6568u, 1u, 0x17u }, { 6569u, 1u, 6569u, 1u, 0x17u }, { 6570u, 1u, 6570u, 1u, 0x17u }, { 6571u, 1u, 6571u, 1u, 0x17u }, { 6572u, 1u, 6572u, 1u, 0x17u },
+        { 6573u, 1u, 6573u, 1u, 0x17u }, { 6574u, 1u, 6574u, 1u, 0x17u }, { 6575u, 1u, 6575u, 1u, 0x17u }, { 6576u, 1u, 6576u, 1u, 0x17u }, { 6577u, 1u, 6577u, 1u, 0x17u },
+        { 6578u, 1u, 6578u, 1u, 0x17u }, { 6579u, 1u, 6579u, 1u, 0x17u }, { 6580u, 1u, 6580u, 1u, 0x17u }, { 6581u, 1u, 6581u, 1u, 0x17u }, { 6582u, 1u, 6582u, 1u, 0x17u },
+        { 6583u, 1u, 6583u, 1u, 0x17u }, { 6584u, 1u, 6584u, 1u, 0x17u }, { 6585u, 1u, 6585u, 1u, 0x17u }, { 6586u, 1u, 6586u, 1u, 0x17u }, { 6587u, 1u, 6587u, 1u, 0x17u },
+        { 6588u, 1u, 6588u, 1u, 0x17u }, { 6589u, 1u, 6589u, 1u, 0x17u }, { 6590u, 1u, 6590u, 1u, 0x17u }, { 6591u, 1u, 6591u, 1u, 0x17u }, { 6592u, 1u, 6592u, 1u, 0x17u },
+        { 6593u, 1u, 6593u, 1u, 0x17u }, { 6594u, 1u, 6594u, 1u, 0x17u }, { 6595u, 1u, 6595u, 1u, 0x17u }, { 6596u, 1u, 6596u, 1u, 0x17u }, { 6597u, 1u, 6597u, 1u, 0x17u },
+        { 6598u, 1u, 6598u, 1u, 0x17u }, { 6599u, 1u, 6599u, 1u, 0x17u }, { 6600u, 1u, 6600u, 1u, 0x17u }, { 6601u, 1u, 6601u, 1u, 0x17u }, { 6602u, 1u, 6602u, 1u, 0x17u },
+        { 6603u, 1u, 6603u, 1u, 0x17u }, { 6604u, 1u, 6604u, 1u, 0x17u }, { 6605u, 1u, 6605u, 1u, 0x17u }, { 6606u, 1u, 6606u, 1u, 0x17u }, { 6607u, 1u, 6607u, 1u, 0x17u },
+        { 6608u, 1u, 6608u, 1u, 0x17u }, { 6609u, 1u, 6609u, 1u, 0x17u }, { 6610u, 1u, 6610u, 1u, 0x17u }, { 6611u, 1u, 6611u, 1u, 0x17u }, { 6612u, 1u, 6612u, 1u, 0x17u },
+        { 6613u, 1u, 6613u, 1u, 0x17u }, { 6614u, 1u, 6614u, 1u, 0x17u }, { 6615u, 1u, 6615u, 1u, 0x17u }, { 6616u, 1u, 6616u, 1u, 0x17u }, { 6617u, 1u, 6617u, 1u, 0x17u },
+        { 6618u, 1u, 6618u, 1u, 0x17u }, { 6619u, 1u, 6619u, 1u, 0x17u }, { 6620u, 1u, 6620u, 1u, 0x17u }, { 6621u, 1u, 6621u, 1u, 0x17u }, { 6622u, 1u, 6622u, 1u, 0x17u },
+        { 6623u, 1u, 6623u, 1u, 0x17u }, { 6624u, 1u, 6624u, 1u, 0x17u }, { 6625u, 1u, 6625u, 1u, 0x17u }, { 6626u, 1u, 6626u, 1u, 0x17u }, { 6627u, 1u, 6627u, 1u, 0x17u },
+        { 6628u, 1u, 6628u, 1u, 0x17u }, { 6629u, 1u, 6629u, 1u, 0x17u }, { 6630u, 1u, 6630u, 1u, 0x17u }, { 6631u, 1u, 6631u, 1u, 0x17u }, { 6632u, 1u, 6632u, 1u, 0x17u },
+        { 6633u, 1u, 6633u, 1u, 0x17u }, { 6634u, 1u, 6634u, 1u, 0x17u }, { 6635u, 1u, 6635u, 1u, 0x17u }, { 6636u, 1u, 6636u, 1u, 0x17u }, { 6637u, 1u, 6637u, 1u, 0x17u },
+        { 6638u, 1u, 6638u, 1u, 0x17u }, { 6639u, 1u, 6639u, 1u, 0x17u }, { 6640u, 1u, 6640u, 1u, 0x17u }, { 6641u, 1u, 6641u, 1u, 0x17u }, { 6642u, 1u, 6642u, 1u, 0x17u },
+        { 6643u, 1u, 6643u, 1u, 0x17u }, { 6644u, 1u, 6644u, 1u, 0x17u }, { 6645u, 1u, 6645u, 1u, 0x17u }, { 6646u, 1u, 6646u, 1u, 0x17u }, { 6647u, 1u, 6647u, 1u, 0x17u },
+        { 6648u, 1u, 6648u, 1u, 0x17u }, { 6649u, 1u, 6649u, 1u, 0x17u }, { 6650u, 1u, 6650u, 1u, 0x17u }, { 6651u, 1u, 6651u, 1u, 0x17u }, { 6652u, 1u, 6652u, 1u, 0x17u },
+        { 6653u, 1u, 6653u, 1u, 0x17u }, { 6654u, 1u, 6654u, 1u, 0x17u }, { 6655u, 1u, 6655u, 1u, 0x17u }, { 6656u, 1u, 6656u, 1u, 0x17u }, { 6657u, 1u, 6657u, 1u, 0x17u },
+        { 6658u, 1u, 6658u, 1u, 0x17u }, { 6659u, 1u, 6659u, 1u, 0x17u }, { 6660u, 1u, 6660u, 1u, 0x17u }, { 6661u, 1u, 6661u, 1u, 0x17u }, { 6662u, 1u, 6662u, 1u, 0x17u },
+        { 6663u, 1u, 6663u, 1u, 0x17u }, { 6664u, 1u, 6664u, 1u, 0x17u }, { 6665u, 1u, 6665u, 1u, 0x17u }, { 6666u, 1u, 6666u, 1u, 0x17u }, { 6667u, 1u, 6667u, 1u, 0x17u },
+        { 6668u, 1u, 6668u, 1u, 0x17u }, { 6669u, 1u, 6669u, 1u, 0x17u }, { 6670u, 1u, 6670u, 1u, 0x17u }, { 6671u, 1u, 6671u, 1u, 0x17u }, { 6672u, 1u, 6672u, 1u, 0x17u },
+        { 6673u, 1u, 6673u, 1u, 0x17u }, { 6674u, 1u, 6674u, 1u, 0x17u }, { 6675u, 1u, 6675u, 1u, 0x17u }, { 6676u, 1u, 6676u, 1u, 0x17u }, { 6677u, 1u, 6677u, 1u, 0x17u },
+        { 6678u, 1u, 6678u, 1u, 0x17u }, { 6679u, 1u, 6679u, 1u, 0x17u }, { 6680u, 1u, 6680u, 1u, 0x17u }, { 6681u, 1u, 6681u, 1u, 0x17u }, { 6682u, 1u, 6682u, 1u, 0x17u },
+        { 6683u, 1u, 6683u, 1u, 0x17u }, { 2945u, 1u, 2945u, 1u, 0x17u }, { 6684u, 1u, 6684u, 1u, 0x17u }, { 6685u, 1u, 6685u, 1u, 0x17u }, { 6686u, 1u, 6686u, 1u, 0x17u },
+        { 6687u, 1u, 6687u, 1u, 0x17u }, { 6688u, 1u, 6688u, 1u, 0x17u }, { 6689u, 1u, 6689u, 1u, 0x17u }, { 6690u, 1u, 6690u, 1u, 0x17u }, { 6691u, 1u, 6691u, 1u, 0x17u },
+        { 6692u, 1u, 6692u, 1u, 0x17u }, { 6693u, 1u, 6693u, 1u, 0x17u }, { 6694u, 1u, 6694u, 1u, 0x17u }, { 2952u, 1u, 2952u, 1u, 0x17u }, { 6695u, 1u, 6695u, 1u, 0x17u },
+        { 6696u, 1u, 6696u, 1u, 0x17u }, { 6697u, 1u, 6697u, 1u, 0x17u }, { 6698u, 1u, 6698u, 1u, 0x17u }, { 6699u, 1u, 6699u, 1u, 0x17u }, { 6700u, 1u, 6700u, 1u, 0x17u },
+        { 6701u, 1u, 6701u, 1u, 0x17u }, { 6702u, 1u, 6702u, 1u, 0x17u }, { 6703u, 1u, 6703u, 1u, 0x17u }, { 6704u, 1u, 6704u, 1u, 0x17u }, { 6705u, 1u, 6705u, 1u, 0x17u },
+        { 6706u, 1u, 6706u, 1u, 0x17u }, { 6707u, 1u, 6707u, 1u, 0x17u }, { 6708u, 1u, 6708u, 1u, 0x17u }, { 6709u, 1u, 6709u, 1u, 0x17u }, { 6710u, 1u, 6710u, 1u, 0x17u },
+        { 6711u, 1u, 6711u, 1u, 0x17u }, { 6712u, 1u, 6712u, 1u, 0x17u }, { 6713u, 1u, 6713u, 1u, 0x17u }, { 6714u, 1u, 6714u, 1u, 0x17u }, { 6715u, 1u, 6715u, 1u, 0x17u },
+        { 6716u, 1u, 6716u, 1u, 0x17u }, { 6717u, 1u, 6717u, 1u, 0x17u }, { 6718u, 1u, 6718u, 1u, 0x17u }, { 6719u, 1u, 6719u, 1u, 0x17u }, { 6720u, 1u, 6720u, 1u, 0x17u },
+        { 6721u, 1u, 6721u, 1u, 0x17u }, { 6722u, 1u, 6722u, 1u, 0x17u }, { 6723u, 1u, 6723u, 1u, 0x17u }, { 6724u, 1u, 6724u, 1u, 0x17u }, { 6725u, 1u, 6725u, 1u, 0x17u },
+        { 6726u, 1u, 6726u, 1u, 0x17u }, { 6727u, 1u, 6727u, 1u, 0x17u }, { 6728u, 1u, 6728u, 1u, 0x17u }, { 6729u, 1u, 6729u, 1u, 0x17u }, { 6730u, 1u, 6730u, 1u, 0x17u },
+        { 6731u, 1u, 6731u, 1u, 0x17u }, { 6732u, 1u, 6732u, 1u, 0x17u }, { 6733u, 1u, 6733u, 1u, 0x17u }, { 6734u, 1u, 6734u, 1u, 0x17u }, { 6735u, 1u, 6735u, 1u, 0x17u },
+        { 6736u, 1u, 6736u, 1u, 0x17u }, { 6737u, 1u, 6737u, 1u, 0x17u }, { 6738u, 1u, 6738u, 1u, 0x17u }, { 6739u, 1u, 6739u, 1u, 0x17u }, { 6740u, 1u, 6740u, 1u, 0x17u },
+        { 6741u, 1u, 6741u, 1u, 0x17u }, { 6742u, 1u, 6742u, 1u, 0x17u }, { 6743u, 1u, 6743u, 1u, 0x17u }, { 6744u, 1u, 6744u, 1u, 0x17u }, { 6745u, 1u, 6745u, 1u, 0x17u },
+        { 6746u, 1u, 6746u, 1u, 0x17u }, { 6747u, 1u, 6747u, 1u, 0x17u }, { 6748u, 1u, 6748u, 1u, 0x17u }, { 6749u, 1u, 6749u, 1u, 0x17u }, { 6750u, 1u, 6750u, 1u, 0x17u },
+        { 6751u, 1u, 6751u, 1u, 0x17u }, { 6752u, 1u, 6752u, 1u, 0x17u }, { 6753u, 1u, 6753u, 1u, 0x17u }, { 6754u, 1u, 6754u, 1u, 0x17u }, { 6755u, 1u, 6755u, 1u, 0x17u },
+        { 6756u, 1u, 6756u, 1u, 0x17u }, { 3000u, 1u, 3000u, 1u, 0x17u }, { 6757u, 1u, 6757u, 1u, 0x17u }, { 3004u, 1u, 3004u, 1u, 0x17u }, { 6758u, 1u, 6758u, 1u, 0x17u },
+        { 6759u, 1u, 6759u, 1u, 0x17u }, { 6760u, 1u, 6760u, 1u, 0x17u }, { 6761u, 1u, 6761u, 1u, 0x17u }, { 3009u, 1u, 3009u, 1u, 0x17u }, { 6762u, 1u, 6762u, 1u, 0x17u }
+    };
+    inline constexpr uint_least8_t normalization_stage1[] = {
+        0u, 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 0u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 0u, 16u, 0u, 0u, 17u, 0u, 18u, 19u, 0u, 20u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 21u, 22u, 23u,
+        24u, 25u, 26u, 0u, 0u, 23u, 27u, 28u, 29u, 0u, 30u, 0u, 31u, 23u, 32u, 0u, 33u, 34u, 0u, 35u, 36u, 37u, 38u, 39u, 0u, 40u, 0u, 0u, 41u, 0u, 42u, 43u, 44u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 45u, 46u, 0u, 0u, 0u, 0u, 0u, 0u, 47u, 48u,
+        49u, 0u, 50u, 51u, 52u, 53u, 54u, 55u, 56u, 57u, 58u, 59u, 60u, 0u, 61u, 62u, 63u, 64u, 65u, 66u, 67u, 68u, 69u, 0u, 0u, 0u, 0u, 70u, 71u, 72u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 73u, 74u, 0u, 75u, 0u, 0u, 0u, 0u, 0u, 76u, 0u, 0u, 0u, 77u, 0u, 0u, 0u, 0u, 78u, 79u, 80u, 81u, 82u, 83u, 84u, 85u,
+        86u, 87u, 88u, 89u, 90u, 0u, 91u, 92u, 93u, 94u, 95u, 96u, 97u, 98u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 99u, 0u, 0u, 100u, 0u, 101u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 102u, 0u, 0u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u,
+        103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u,
+        103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u,
+        103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u,
+        103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u,
+        103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u,
+        103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 103u, 104u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        105u, 106u, 107u, 108u, 109u, 110u, 111u, 112u, 113u, 114u, 115u, 116u, 117u, 118u, 119u, 120u, 121u, 122u, 123u, 124u, 125u, 126u, 127u, 128u, 129u, 130u, 131u, 132u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 133u, 0u, 0u, 0u, 0u, 0u, 0u, 134u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 135u, 0u, 136u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 23u, 137u, 138u, 139u, 0u, 0u,
+        140u, 0u, 0u, 0u, 141u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 142u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 143u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 144u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 145u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 146u, 147u, 148u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 149u,
+        150u, 151u, 152u, 153u, 154u, 155u, 156u, 157u, 158u, 159u, 160u, 161u, 162u, 163u, 164u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 165u, 166u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 167u, 168u, 169u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 170u, 171u,
+        172u, 0u, 173u, 174u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        175u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 176u, 177u, 178u, 179u, 180u, 181u, 182u, 183u, 184u
+    };
+    inline constexpr uint_least16_t normalization_stage2[] = {
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 0u, 3u, 0u, 0u, 0u, 0u, 4u, 0u, 0u, 5u, 6u, 7u, 8u, 0u, 0u, 9u, 10u, 11u, 0u, 12u, 13u, 14u,
+        0u, 15u, 16u, 17u, 18u, 19u, 20u, 0u, 21u, 22u, 23u, 24u, 25u, 26u, 27u, 28u, 29u, 0u, 30u, 31u, 32u, 33u, 34u, 35u, 0u, 0u, 36u, 37u, 38u, 39u, 40u, 0u, 0u, 41u, 42u,
+        43u, 44u, 45u, 46u, 0u, 47u, 48u, 49u, 50u, 51u, 52u, 53u, 54u, 55u, 0u, 56u, 57u, 58u, 59u, 60u, 61u, 0u, 0u, 62u, 63u, 64u, 65u, 66u, 0u, 67u, 68u, 69u, 70u, 71u, 72u,
+        73u, 74u, 75u, 76u, 77u, 78u, 79u, 80u, 81u, 82u, 83u, 0u, 0u, 84u, 85u, 86u, 87u, 88u, 89u, 90u, 91u, 92u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 100u, 101u, 102u, 103u, 0u,
+        0u, 104u, 105u, 106u, 107u, 108u, 109u, 110u, 111u, 112u, 0u, 113u, 114u, 115u, 116u, 117u, 118u, 0u, 119u, 120u, 121u, 122u, 123u, 124u, 125u, 126u, 0u, 0u, 127u, 128u,
+        129u, 130u, 131u, 132u, 133u, 0u, 0u, 134u, 135u, 136u, 137u, 138u, 139u, 0u, 0u, 140u, 141u, 142u, 143u, 144u, 145u, 146u, 147u, 148u, 149u, 150u, 151u, 152u, 153u, 154u,
+        155u, 156u, 157u, 0u, 0u, 158u, 159u, 160u, 161u, 162u, 163u, 164u, 165u, 166u, 167u, 168u, 169u, 170u, 171u, 172u, 173u, 174u, 175u, 176u, 177u, 178u, 179u, 180u, 181u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 182u, 183u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 184u, 185u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 186u, 187u, 188u, 189u, 190u, 191u, 192u, 193u, 194u, 195u,
+        196u, 197u, 198u, 199u, 200u, 201u, 202u, 203u, 204u, 205u, 206u, 207u, 208u, 209u, 210u, 0u, 211u, 212u, 213u, 214u, 215u, 216u, 0u, 0u, 217u, 218u, 219u, 220u, 221u,
+        222u, 223u, 224u, 225u, 226u, 227u, 228u, 229u, 230u, 231u, 232u, 0u, 0u, 233u, 234u, 235u, 236u, 237u, 238u, 239u, 240u, 241u, 242u, 243u, 244u, 245u, 246u, 247u, 248u,
+        249u, 250u, 251u, 252u, 253u, 254u, 255u, 256u, 257u, 258u, 259u, 260u, 261u, 262u, 263u, 264u, 265u, 266u, 267u, 268u, 0u, 0u, 269u, 270u, 0u, 0u, 0u, 0u, 0u, 0u, 271u,
+        272u, 273u, 274u, 275u, 276u, 277u, 278u, 279u, 280u, 281u, 282u, 283u, 284u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 285u, 286u, 287u, 288u,
+        289u, 290u, 291u, 292u, 293u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 294u, 295u, 296u,
+        297u, 298u, 299u, 0u, 0u, 300u, 301u, 181u, 302u, 303u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u,
+        304u, 304u, 304u, 304u, 0u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 0u, 0u, 304u, 0u, 304u, 0u, 304u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        304u, 304u, 304u, 304u, 304u, 304u, 0u, 0u, 0u, 0u, 304u, 304u, 0u, 304u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 305u, 306u, 304u, 307u, 308u,
+        304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 309u, 0u, 0u, 0u, 0u, 0u, 310u, 0u, 0u, 0u, 311u, 0u, 0u, 0u, 0u, 0u, 7u, 312u, 313u, 314u, 315u, 316u, 317u, 0u, 318u, 0u, 319u, 320u, 321u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 322u, 323u, 324u, 325u, 326u, 327u, 328u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 329u, 330u, 331u, 332u, 333u, 0u, 334u, 335u, 336u, 337u, 338u, 339u, 340u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 341u, 342u, 343u, 0u, 344u, 345u, 0u, 0u, 0u, 346u, 0u, 0u, 0u, 0u, 0u, 0u, 347u, 348u, 0u, 349u, 0u,
+        0u, 0u, 350u, 0u, 0u, 0u, 0u, 351u, 352u, 353u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 354u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 355u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 356u, 357u, 0u, 358u, 0u, 0u,
+        0u, 359u, 0u, 0u, 0u, 0u, 360u, 361u, 362u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 363u, 364u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 365u, 366u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 367u, 368u, 369u, 370u, 0u, 0u, 371u, 372u, 0u, 0u, 373u, 374u, 375u, 376u, 377u, 378u, 0u, 0u,
+        379u, 380u, 381u, 382u, 383u, 384u, 0u, 0u, 385u, 386u, 387u, 388u, 389u, 390u, 391u, 392u, 393u, 394u, 395u, 396u, 0u, 0u, 397u, 398u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 399u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 400u, 401u, 402u, 403u, 404u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 304u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 405u, 406u, 407u, 408u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 409u, 0u, 410u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 411u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 412u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 413u, 0u, 0u, 414u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 415u, 416u, 417u, 418u, 419u, 420u, 421u, 422u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        423u, 424u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 425u, 426u, 0u, 427u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 428u, 0u, 0u, 429u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 430u, 431u, 432u, 0u, 0u, 433u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 434u, 0u, 0u, 435u, 436u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 304u, 0u,
+        0u, 0u, 0u, 437u, 438u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 439u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 440u, 441u, 442u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 443u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 444u, 0u, 304u, 0u, 0u, 0u, 0u, 445u, 446u, 0u, 447u, 448u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 304u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 449u, 450u, 451u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u,
+        304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 452u, 0u, 453u, 454u, 455u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 456u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 457u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 458u, 459u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 460u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 461u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 462u, 0u, 0u, 0u, 0u, 463u, 0u, 0u, 0u, 0u, 464u, 0u, 0u, 0u, 0u, 465u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 466u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 467u, 0u, 468u, 469u, 470u, 471u, 472u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 473u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 474u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 475u, 0u, 0u, 0u, 0u, 476u, 0u, 0u, 0u, 0u, 477u, 0u, 0u, 0u, 0u,
+        478u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 479u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 480u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 481u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u,
+        304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u, 304u,
+        304u, 304u, 304u, 304u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 482u, 0u, 483u, 0u, 484u, 0u, 485u, 0u,
+        486u, 0u, 0u, 0u, 487u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u,
+        0u, 0u, 0u, 0u, 488u, 0u, 489u, 0u, 0u, 490u, 491u, 0u, 492u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 493u, 494u, 495u, 0u, 496u, 497u,
+        498u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 0u, 507u, 508u, 509u, 510u, 511u, 512u, 513u, 3u, 514u, 515u, 516u, 517u, 518u, 519u, 520u, 521u, 522u, 523u, 0u,
+        524u, 525u, 526u, 11u, 527u, 528u, 529u, 530u, 531u, 532u, 533u, 534u, 535u, 536u, 334u, 537u, 538u, 339u, 539u, 540u, 288u, 532u, 535u, 334u, 537u, 342u, 339u, 539u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 541u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 542u, 543u, 544u, 545u, 522u, 546u, 547u, 548u, 549u, 550u, 551u, 552u, 553u, 554u, 555u, 556u, 557u, 558u, 559u, 560u, 561u, 562u, 563u, 564u, 565u,
+        566u, 567u, 568u, 569u, 570u, 571u, 572u, 573u, 574u, 575u, 576u, 335u, 577u, 578u, 579u, 580u, 581u, 582u, 583u, 584u, 585u, 586u, 587u, 588u, 589u, 590u, 591u, 592u,
+        593u, 594u, 595u, 596u, 597u, 598u, 599u, 600u, 601u, 602u, 603u, 604u, 605u, 606u, 607u, 608u, 609u, 610u, 611u, 612u, 613u, 614u, 615u, 616u, 617u, 618u, 619u, 620u,
+        621u, 622u, 623u, 624u, 625u, 626u, 627u, 628u, 629u, 630u, 631u, 632u, 633u, 634u, 635u, 636u, 637u, 638u, 639u, 640u, 641u, 642u, 643u, 644u, 645u, 646u, 647u, 648u,
+        649u, 650u, 651u, 652u, 653u, 654u, 655u, 656u, 657u, 658u, 659u, 660u, 661u, 662u, 663u, 664u, 665u, 666u, 667u, 668u, 669u, 670u, 671u, 672u, 673u, 674u, 675u, 676u,
+        677u, 678u, 679u, 680u, 681u, 682u, 683u, 684u, 685u, 686u, 687u, 688u, 689u, 690u, 691u, 692u, 693u, 694u, 695u, 696u, 697u, 698u, 699u, 700u, 701u, 702u, 703u, 704u,
+        705u, 706u, 707u, 708u, 709u, 710u, 711u, 712u, 713u, 714u, 715u, 716u, 717u, 718u, 719u, 720u, 721u, 722u, 723u, 724u, 725u, 726u, 727u, 728u, 729u, 730u, 731u, 732u, 0u,
+        0u, 0u, 0u, 733u, 734u, 735u, 736u, 737u, 738u, 739u, 740u, 741u, 742u, 743u, 744u, 745u, 746u, 747u, 748u, 749u, 750u, 751u, 752u, 753u, 754u, 755u, 756u, 757u, 758u,
+        759u, 760u, 761u, 762u, 763u, 764u, 765u, 766u, 767u, 768u, 769u, 770u, 771u, 772u, 773u, 774u, 775u, 776u, 777u, 778u, 779u, 780u, 781u, 782u, 783u, 784u, 785u, 786u,
+        787u, 788u, 789u, 790u, 791u, 792u, 793u, 794u, 795u, 796u, 797u, 798u, 799u, 800u, 801u, 802u, 803u, 804u, 805u, 806u, 807u, 808u, 809u, 810u, 811u, 812u, 813u, 814u,
+        815u, 816u, 817u, 818u, 819u, 820u, 821u, 822u, 0u, 0u, 0u, 0u, 0u, 0u, 823u, 824u, 825u, 826u, 827u, 828u, 829u, 830u, 831u, 832u, 833u, 834u, 835u, 836u, 837u, 838u,
+        839u, 840u, 841u, 842u, 843u, 844u, 0u, 0u, 845u, 846u, 847u, 848u, 849u, 850u, 0u, 0u, 851u, 852u, 853u, 854u, 855u, 856u, 857u, 858u, 859u, 860u, 861u, 862u, 863u, 864u,
+        865u, 866u, 867u, 868u, 869u, 870u, 871u, 872u, 873u, 874u, 875u, 876u, 877u, 878u, 879u, 880u, 881u, 882u, 883u, 884u, 885u, 886u, 887u, 888u, 0u, 0u, 889u, 890u, 891u,
+        892u, 893u, 894u, 0u, 0u, 895u, 896u, 897u, 898u, 899u, 900u, 901u, 902u, 0u, 903u, 0u, 904u, 0u, 905u, 0u, 906u, 907u, 908u, 909u, 910u, 911u, 912u, 913u, 914u, 915u,
+        916u, 917u, 918u, 919u, 920u, 921u, 922u, 923u, 924u, 925u, 926u, 927u, 928u, 929u, 930u, 931u, 932u, 933u, 934u, 935u, 936u, 0u, 0u, 937u, 938u, 939u, 940u, 941u, 942u,
+        943u, 944u, 945u, 946u, 947u, 948u, 949u, 950u, 951u, 952u, 953u, 954u, 955u, 956u, 957u, 958u, 959u, 960u, 961u, 962u, 963u, 964u, 965u, 966u, 967u, 968u, 969u, 970u,
+        971u, 972u, 973u, 974u, 975u, 976u, 977u, 978u, 979u, 980u, 981u, 982u, 983u, 984u, 985u, 986u, 987u, 988u, 989u, 0u, 990u, 991u, 992u, 993u, 994u, 995u, 996u, 997u, 998u,
+        997u, 999u, 1000u, 1001u, 1002u, 1003u, 0u, 1004u, 1005u, 1006u, 1007u, 1008u, 1009u, 1010u, 1011u, 1012u, 1013u, 1014u, 1015u, 1016u, 1017u, 0u, 0u, 1018u, 1019u, 1020u,
+        1021u, 1022u, 1023u, 0u, 1024u, 1025u, 1026u, 1027u, 1028u, 1029u, 1030u, 1031u, 1032u, 1033u, 1034u, 1035u, 1036u, 1037u, 1038u, 1039u, 1040u, 1041u, 1042u, 0u, 0u,
+        1043u, 1044u, 1045u, 0u, 1046u, 1047u, 1048u, 1049u, 1050u, 1051u, 1052u, 1053u, 1054u, 0u, 1055u, 1056u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1057u, 0u, 0u, 0u, 0u, 0u, 1058u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1059u, 1060u, 1061u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1062u, 1063u, 0u,
+        1064u, 1065u, 0u, 0u, 0u, 0u, 1066u, 0u, 1067u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1068u, 1069u, 1070u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1071u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1072u, 540u, 0u, 0u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 1079u, 1080u, 1081u,
+        1082u, 1083u, 1084u, 1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 1079u, 1080u, 1081u, 1082u, 1083u, 0u, 3u, 519u, 11u, 302u, 520u, 285u, 524u, 301u,
+        525u, 1084u, 530u, 181u, 531u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1085u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 1086u, 1087u, 1088u, 1089u, 0u, 1090u, 1091u, 1092u, 0u, 1093u, 523u, 500u, 500u, 500u, 285u, 1094u, 501u, 501u, 504u, 301u, 0u, 506u, 1095u, 0u, 0u, 509u, 1096u,
+        510u, 510u, 510u, 0u, 0u, 1097u, 1098u, 1099u, 0u, 1100u, 0u, 1101u, 0u, 1100u, 0u, 1102u, 1103u, 495u, 1088u, 0u, 519u, 497u, 1104u, 0u, 505u, 11u, 1105u, 1106u, 1107u,
+        1108u, 540u, 0u, 1109u, 340u, 537u, 1110u, 1111u, 1112u, 0u, 0u, 0u, 0u, 496u, 518u, 519u, 540u, 287u, 0u, 0u, 0u, 0u, 0u, 0u, 1113u, 1114u, 1115u, 1116u, 1117u, 1118u,
+        1119u, 1120u, 1121u, 1122u, 1123u, 1124u, 1125u, 1126u, 1127u, 1128u, 501u, 1129u, 1130u, 1131u, 1132u, 1133u, 1134u, 1135u, 1136u, 1137u, 1138u, 1139u, 504u, 1088u, 496u,
+        505u, 540u, 1140u, 1141u, 1142u, 535u, 1143u, 1144u, 1145u, 1146u, 302u, 1147u, 1148u, 301u, 543u, 518u, 525u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1149u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1150u, 1151u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1152u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1153u, 1154u, 1155u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1156u, 0u, 0u, 0u,
+        0u, 1157u, 0u, 0u, 1158u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1159u, 0u, 1160u, 0u, 0u, 0u, 0u, 0u, 1161u, 1162u,
+        0u, 1163u, 1164u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1165u, 0u, 0u, 1166u, 0u, 0u, 1167u, 0u, 1168u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1169u, 0u, 1170u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1171u, 1172u, 1173u, 1174u, 1175u, 0u, 0u, 1176u, 1177u, 0u, 0u,
+        1178u, 1179u, 0u, 0u, 0u, 0u, 0u, 0u, 1180u, 1181u, 0u, 0u, 1182u, 1183u, 0u, 0u, 1184u, 1185u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1186u, 1187u, 1188u, 1189u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1190u, 1191u, 1192u, 1193u, 0u, 0u, 0u, 0u, 0u, 0u, 1194u,
+        1195u, 1196u, 1197u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1198u, 1199u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 5u, 6u, 1073u, 1074u,
+        1075u, 1076u, 1077u, 1078u, 1200u, 1201u, 1202u, 1203u, 1204u, 1205u, 1206u, 1207u, 1208u, 1209u, 1210u, 1211u, 1212u, 1213u, 1214u, 1215u, 1216u, 1217u, 1218u, 1219u,
+        1220u, 1221u, 1222u, 1223u, 1224u, 1225u, 1226u, 1227u, 1228u, 1229u, 1230u, 1231u, 1232u, 1233u, 1234u, 1235u, 1236u, 1237u, 1238u, 1239u, 1240u, 1241u, 1242u, 1243u,
+        1244u, 1245u, 1246u, 1247u, 1248u, 1249u, 1250u, 1251u, 1252u, 1253u, 1254u, 1255u, 1256u, 1257u, 1258u, 1259u, 1260u, 1261u, 1262u, 1263u, 1264u, 1265u, 1266u, 1267u,
+        1268u, 1269u, 1270u, 1271u, 1272u, 1273u, 1274u, 1275u, 1276u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u,
+        510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u,
+        531u, 532u, 535u, 292u, 302u, 293u, 573u, 1072u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 1280u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1281u, 1282u, 1283u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1284u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 287u, 1132u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1285u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1286u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1287u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1288u, 1289u, 1290u, 1291u, 1292u, 1293u, 1294u, 1295u, 1296u, 1297u, 1298u, 1299u, 1300u,
+        1301u, 1302u, 1303u, 1304u, 1305u, 1306u, 1307u, 1308u, 1309u, 1310u, 1311u, 1312u, 1313u, 1314u, 1315u, 1316u, 1317u, 1318u, 1319u, 1320u, 1321u, 1322u, 1323u, 1324u,
+        1325u, 1326u, 1327u, 1328u, 1329u, 1330u, 1331u, 1332u, 1333u, 1334u, 1335u, 1336u, 1337u, 1338u, 1339u, 1340u, 1341u, 1342u, 1343u, 1344u, 1345u, 1346u, 1347u, 1348u,
+        1349u, 1350u, 1351u, 1352u, 1353u, 1354u, 1355u, 1356u, 1357u, 1358u, 1359u, 1360u, 1361u, 1362u, 1363u, 1364u, 1365u, 1366u, 1367u, 1368u, 1369u, 1370u, 1371u, 1372u,
+        1373u, 1374u, 1375u, 1376u, 1377u, 1378u, 1379u, 1380u, 1381u, 1382u, 1383u, 1384u, 1385u, 1386u, 1387u, 1388u, 1389u, 1390u, 1391u, 1392u, 1393u, 1394u, 1395u, 1396u,
+        1397u, 1398u, 1399u, 1400u, 1401u, 1402u, 1403u, 1404u, 1405u, 1406u, 1407u, 1408u, 1409u, 1410u, 1411u, 1412u, 1413u, 1414u, 1415u, 1416u, 1417u, 1418u, 1419u, 1420u,
+        1421u, 1422u, 1423u, 1424u, 1425u, 1426u, 1427u, 1428u, 1429u, 1430u, 1431u, 1432u, 1433u, 1434u, 1435u, 1436u, 1437u, 1438u, 1439u, 1440u, 1441u, 1442u, 1443u, 1444u,
+        1445u, 1446u, 1447u, 1448u, 1449u, 1450u, 1451u, 1452u, 1453u, 1454u, 1455u, 1456u, 1457u, 1458u, 1459u, 1460u, 1461u, 1462u, 1463u, 1464u, 1465u, 1466u, 1467u, 1468u,
+        1469u, 1470u, 1471u, 1472u, 1473u, 1474u, 1475u, 1476u, 1477u, 1478u, 1479u, 1480u, 1481u, 1482u, 1483u, 1484u, 1485u, 1486u, 1487u, 1488u, 1489u, 1490u, 1491u, 1492u,
+        1493u, 1494u, 1495u, 1496u, 1497u, 1498u, 1499u, 1500u, 1501u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1502u, 0u, 1311u, 1503u, 1504u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1505u, 0u, 1506u, 0u, 1507u, 0u, 1508u, 0u, 1509u, 0u, 1510u, 0u, 1511u, 0u, 1512u, 0u, 1513u, 0u, 1514u, 0u, 1515u, 0u, 1516u, 0u, 0u,
+        1517u, 0u, 1518u, 0u, 1519u, 0u, 0u, 0u, 0u, 0u, 0u, 1520u, 1521u, 0u, 1522u, 1523u, 0u, 1524u, 1525u, 0u, 1526u, 1527u, 0u, 1528u, 1529u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1530u, 0u, 0u, 0u, 0u, 304u, 304u, 1531u, 1532u, 0u, 1533u, 1534u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        1535u, 0u, 1536u, 0u, 1537u, 0u, 1538u, 0u, 1539u, 0u, 1540u, 0u, 1541u, 0u, 1542u, 0u, 1543u, 0u, 1544u, 0u, 1545u, 0u, 1546u, 0u, 0u, 1547u, 0u, 1548u, 0u, 1549u, 0u,
+        0u, 0u, 0u, 0u, 0u, 1550u, 1551u, 0u, 1552u, 1553u, 0u, 1554u, 1555u, 0u, 1556u, 1557u, 0u, 1558u, 1559u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 1560u, 0u, 0u, 1561u, 1562u, 1563u, 1564u, 0u, 0u, 0u, 1565u, 1566u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1567u, 1568u, 1569u, 1570u, 1571u, 1572u, 1573u,
+        1574u, 1575u, 1576u, 1577u, 1578u, 1579u, 1580u, 1581u, 1582u, 1583u, 1584u, 1585u, 1586u, 1587u, 1588u, 1589u, 1590u, 1591u, 1592u, 1593u, 1594u, 1595u, 1596u, 1597u,
+        1598u, 1599u, 1600u, 1601u, 1602u, 1603u, 1604u, 1605u, 1606u, 1607u, 1608u, 1609u, 1610u, 1611u, 1612u, 1613u, 1614u, 1615u, 1616u, 1617u, 1618u, 1619u, 1620u, 1621u,
+        1622u, 1623u, 1624u, 1625u, 1626u, 1627u, 1628u, 1629u, 1630u, 1631u, 1632u, 1633u, 1634u, 1635u, 1636u, 1637u, 1638u, 1639u, 1640u, 1641u, 1642u, 1643u, 1644u, 1645u,
+        1646u, 1647u, 1648u, 1649u, 1650u, 1651u, 1652u, 1653u, 1654u, 1655u, 1656u, 1657u, 1658u, 1659u, 1660u, 0u, 0u, 0u, 1288u, 1294u, 1661u, 1662u, 1663u, 1664u, 1665u,
+        1666u, 1292u, 1667u, 1668u, 1669u, 1670u, 1296u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 1671u, 1672u, 1673u, 1674u, 1675u, 1676u, 1677u, 1678u, 1679u, 1680u, 1681u, 1682u, 1683u, 1684u, 1685u, 1686u, 1687u, 1688u, 1689u, 1690u, 1691u, 1692u, 1693u,
+        1694u, 1695u, 1696u, 1697u, 1698u, 1699u, 1700u, 1701u, 0u, 1702u, 1703u, 1704u, 1705u, 1706u, 1707u, 1708u, 1709u, 1710u, 1711u, 1712u, 1713u, 1714u, 1715u, 1716u, 1717u,
+        1718u, 1719u, 1720u, 1721u, 1722u, 1723u, 1724u, 1725u, 1726u, 1727u, 1728u, 1729u, 1730u, 1731u, 1732u, 1733u, 1734u, 1735u, 1736u, 1737u, 1738u, 1739u, 1354u, 1740u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 1741u, 1742u, 1743u, 1744u, 1745u, 1746u, 1747u, 1748u, 1749u, 1750u, 1751u, 1752u, 1753u, 1754u, 1755u, 1756u, 1567u, 1570u, 1573u, 1575u,
+        1583u, 1584u, 1587u, 1589u, 1590u, 1592u, 1593u, 1594u, 1595u, 1596u, 1757u, 1758u, 1759u, 1760u, 1761u, 1762u, 1763u, 1764u, 1765u, 1766u, 1767u, 1768u, 1769u, 1770u,
+        1771u, 1772u, 1773u, 0u, 1288u, 1294u, 1661u, 1662u, 1774u, 1775u, 1776u, 1299u, 1777u, 1311u, 1361u, 1373u, 1372u, 1362u, 1454u, 1319u, 1359u, 1778u, 1779u, 1780u, 1781u,
+        1782u, 1783u, 1784u, 1785u, 1786u, 1787u, 1325u, 1788u, 1789u, 1790u, 1791u, 1792u, 1793u, 1794u, 1795u, 1663u, 1664u, 1665u, 1796u, 1797u, 1798u, 1799u, 1800u, 1801u,
+        1802u, 1803u, 1804u, 1805u, 1806u, 1807u, 1808u, 1809u, 1810u, 1811u, 1812u, 1813u, 1814u, 1815u, 1816u, 1817u, 1818u, 1819u, 1820u, 1821u, 1822u, 1823u, 1824u, 1825u,
+        1826u, 1827u, 1828u, 1829u, 1830u, 1831u, 1832u, 1833u, 1834u, 1835u, 1836u, 1837u, 1838u, 1839u, 1840u, 1841u, 1842u, 1843u, 1844u, 1845u, 1846u, 1847u, 1848u, 1849u,
+        1850u, 1851u, 1852u, 1853u, 1854u, 1855u, 1856u, 1857u, 1858u, 1859u, 1860u, 1861u, 1862u, 1863u, 1864u, 1865u, 1866u, 1867u, 1868u, 1869u, 1870u, 1871u, 1872u, 1873u,
+        1874u, 1875u, 1876u, 1877u, 1878u, 1879u, 1880u, 1881u, 1882u, 1883u, 1884u, 1885u, 1886u, 1887u, 1888u, 1889u, 1890u, 1891u, 1892u, 1893u, 1894u, 1895u, 1896u, 1897u,
+        1898u, 1899u, 1900u, 1901u, 1902u, 1903u, 1904u, 1905u, 1906u, 1907u, 1908u, 1909u, 1910u, 1911u, 1912u, 1913u, 1914u, 1915u, 1916u, 1917u, 1918u, 1919u, 1920u, 1921u,
+        1922u, 1923u, 1924u, 1925u, 1926u, 1927u, 1928u, 1929u, 1930u, 1931u, 1932u, 1933u, 1934u, 1935u, 1936u, 1937u, 1938u, 1939u, 1940u, 1941u, 1942u, 1943u, 1944u, 1945u,
+        1946u, 1947u, 1948u, 1949u, 1950u, 1951u, 1952u, 1953u, 1954u, 1955u, 1956u, 1957u, 1958u, 1959u, 1960u, 1961u, 1962u, 1963u, 1964u, 1965u, 1966u, 1967u, 1968u, 1969u,
+        1970u, 1971u, 1972u, 1973u, 1974u, 1975u, 1976u, 1977u, 1978u, 1979u, 1980u, 1981u, 1982u, 1983u, 1984u, 1985u, 1986u, 1987u, 1988u, 1989u, 1990u, 1991u, 1992u, 1993u,
+        1994u, 1995u, 1996u, 1997u, 1998u, 1999u, 2000u, 2001u, 2002u, 2003u, 2004u, 2005u, 2006u, 2007u, 2008u, 2009u, 2010u, 2011u, 2012u, 2013u, 2014u, 2015u, 2016u, 2017u,
+        2018u, 2019u, 2020u, 2021u, 2022u, 2023u, 2024u, 2025u, 2026u, 2027u, 2028u, 2029u, 2030u, 2031u, 2032u, 2033u, 2034u, 2035u, 2036u, 2037u, 2038u, 2039u, 2040u, 2041u,
+        2042u, 2043u, 2044u, 2045u, 2046u, 2047u, 2048u, 2049u, 2050u, 2051u, 2052u, 2053u, 2054u, 2055u, 2056u, 2057u, 2058u, 2059u, 2060u, 2061u, 2062u, 2063u, 2064u, 2065u,
+        2066u, 2067u, 2068u, 2069u, 2070u, 2071u, 2072u, 2073u, 2074u, 2075u, 2076u, 2077u, 2078u, 2079u, 2080u, 2081u, 2082u, 2083u, 2084u, 2085u, 2086u, 2087u, 2088u, 2089u,
+        2090u, 2091u, 2092u, 2093u, 2094u, 2095u, 2096u, 2097u, 2098u, 2099u, 2100u, 2101u, 2102u, 2103u, 2104u, 2105u, 2106u, 2107u, 2108u, 2109u, 2110u, 2111u, 2112u, 2113u,
+        2114u, 2115u, 2116u, 2117u, 2118u, 2119u, 2120u, 2121u, 2122u, 2123u, 2124u, 2125u, 2126u, 2127u, 2128u, 2129u, 2130u, 2131u, 2132u, 2133u, 2134u, 2135u, 2136u, 2137u,
+        2138u, 2139u, 2140u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2141u, 2142u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2143u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1088u, 1104u, 1096u, 0u, 0u, 0u, 2144u, 2145u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2146u, 2147u, 2148u, 2149u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2150u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u,
+        2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u,
+        2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u,
+        2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u,
+        2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 2151u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 2152u, 2153u, 2154u, 2155u, 2156u, 2157u, 2158u, 2159u, 2159u, 2160u, 2161u, 2162u, 2163u, 2164u, 2165u, 2166u, 2167u, 2168u, 2169u, 2170u, 2171u,
+        2172u, 2173u, 2174u, 2175u, 2176u, 2177u, 2178u, 2179u, 2180u, 2181u, 2182u, 2183u, 2184u, 2185u, 2186u, 2187u, 2188u, 2189u, 2190u, 2191u, 2192u, 2193u, 2194u, 2195u,
+        2196u, 2197u, 2198u, 2199u, 2200u, 2201u, 2202u, 2203u, 2204u, 2205u, 2206u, 2207u, 2208u, 2209u, 2210u, 2211u, 2212u, 2213u, 2214u, 2215u, 2216u, 2217u, 2218u, 2219u,
+        2220u, 2221u, 2222u, 2223u, 2224u, 2225u, 2226u, 2227u, 2228u, 2229u, 2230u, 2231u, 2232u, 2233u, 2234u, 2235u, 2236u, 2237u, 2238u, 2239u, 2240u, 2241u, 2242u, 2171u,
+        2243u, 2244u, 2245u, 2246u, 2247u, 2248u, 2249u, 2250u, 2251u, 2252u, 2253u, 2254u, 2255u, 2256u, 2257u, 2258u, 2259u, 2260u, 2261u, 2262u, 2263u, 2264u, 2265u, 2266u,
+        2267u, 2268u, 2269u, 2270u, 2271u, 2272u, 2273u, 2274u, 2275u, 2276u, 2277u, 2278u, 2279u, 2280u, 2281u, 2282u, 2283u, 2284u, 2285u, 2286u, 2287u, 2288u, 2289u, 2290u,
+        2291u, 2292u, 2293u, 2294u, 2295u, 2296u, 2297u, 2298u, 2299u, 2300u, 2301u, 2302u, 2303u, 2304u, 2305u, 2306u, 2307u, 2308u, 2309u, 2310u, 2261u, 2311u, 2312u, 2313u,
+        2314u, 2315u, 2316u, 2317u, 2318u, 2245u, 2319u, 2320u, 2321u, 2322u, 2323u, 2324u, 2325u, 2326u, 2327u, 2328u, 2329u, 2330u, 2331u, 2332u, 2333u, 2334u, 2335u, 2336u,
+        2337u, 2338u, 2171u, 2339u, 2340u, 2341u, 2342u, 2343u, 2344u, 2345u, 2346u, 2347u, 2348u, 2349u, 2350u, 2351u, 2352u, 2353u, 2354u, 2355u, 2356u, 2357u, 2358u, 2359u,
+        2360u, 2361u, 2362u, 2363u, 2364u, 2365u, 2247u, 2366u, 2367u, 2368u, 2369u, 2370u, 2371u, 2372u, 2373u, 2374u, 2375u, 2376u, 2377u, 2378u, 2379u, 2380u, 2381u, 2382u,
+        2383u, 2384u, 2385u, 2386u, 2387u, 2388u, 2389u, 2390u, 2391u, 2392u, 2393u, 2394u, 2395u, 2396u, 2397u, 2398u, 2399u, 2400u, 2401u, 2402u, 2403u, 2404u, 2405u, 2406u,
+        2407u, 2408u, 2409u, 2410u, 2411u, 2412u, 2413u, 2414u, 2415u, 0u, 0u, 2416u, 0u, 2417u, 0u, 0u, 2418u, 2419u, 2420u, 2421u, 2422u, 2423u, 2424u, 2425u, 2426u, 2427u, 0u,
+        2428u, 0u, 2429u, 0u, 0u, 2430u, 2431u, 0u, 0u, 0u, 2432u, 2433u, 2434u, 2435u, 2436u, 2437u, 2438u, 2439u, 2440u, 2441u, 2442u, 2443u, 2444u, 2445u, 2446u, 2447u, 2448u,
+        2449u, 2450u, 2451u, 2452u, 2453u, 2454u, 2455u, 2456u, 2457u, 2458u, 2459u, 2460u, 2461u, 2462u, 2463u, 2464u, 2465u, 2466u, 2467u, 2468u, 2469u, 2470u, 2471u, 2472u,
+        2473u, 2474u, 2475u, 2476u, 2300u, 2477u, 2478u, 2479u, 2480u, 2481u, 2482u, 2482u, 2483u, 2484u, 2485u, 2486u, 2487u, 2488u, 2489u, 2490u, 2430u, 2491u, 2492u, 2493u,
+        2494u, 2495u, 2496u, 0u, 0u, 2497u, 2498u, 2499u, 2500u, 2501u, 2502u, 2503u, 2504u, 2444u, 2505u, 2506u, 2507u, 2416u, 2508u, 2509u, 2510u, 2511u, 2512u, 2513u, 2514u,
+        2515u, 2516u, 2517u, 2518u, 2519u, 2453u, 2520u, 2454u, 2521u, 2522u, 2523u, 2524u, 2525u, 2417u, 2192u, 2526u, 2527u, 2528u, 2262u, 2349u, 2529u, 2530u, 2461u, 2531u,
+        2462u, 2532u, 2533u, 2534u, 2419u, 2535u, 2536u, 2537u, 2538u, 2539u, 2420u, 2540u, 2541u, 2542u, 2543u, 2544u, 2545u, 2476u, 2546u, 2547u, 2300u, 2548u, 2480u, 2549u,
+        2550u, 2551u, 2552u, 2553u, 2485u, 2554u, 2429u, 2555u, 2486u, 2243u, 2556u, 2487u, 2557u, 2489u, 2558u, 2559u, 2560u, 2561u, 2562u, 2491u, 2425u, 2563u, 2492u, 2564u,
+        2493u, 2565u, 2159u, 2566u, 2567u, 2568u, 2569u, 2570u, 2571u, 2572u, 2573u, 2574u, 2575u, 2576u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2577u, 2578u, 2579u, 2580u, 2581u, 2582u, 2582u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 2583u, 2584u, 2585u, 2586u, 2587u, 0u, 0u, 0u, 0u, 0u, 2588u, 0u, 2589u, 2590u, 1105u, 1108u, 2591u, 2592u, 2593u, 2594u, 2595u, 2596u, 1079u, 2597u, 2598u, 2599u,
+        2600u, 2601u, 2602u, 2603u, 2604u, 2605u, 2606u, 2607u, 2608u, 2609u, 0u, 2610u, 2611u, 2612u, 2613u, 2614u, 0u, 2615u, 0u, 2616u, 2617u, 0u, 2618u, 2619u, 0u, 2620u,
+        2621u, 2622u, 2623u, 2624u, 2625u, 2626u, 2627u, 2628u, 2629u, 2630u, 2630u, 2631u, 2631u, 2631u, 2631u, 2632u, 2632u, 2632u, 2632u, 2633u, 2633u, 2633u, 2633u, 2634u,
+        2634u, 2634u, 2634u, 2635u, 2635u, 2635u, 2635u, 2636u, 2636u, 2636u, 2636u, 2637u, 2637u, 2637u, 2637u, 2638u, 2638u, 2638u, 2638u, 2639u, 2639u, 2639u, 2639u, 2640u,
+        2640u, 2640u, 2640u, 2641u, 2641u, 2641u, 2641u, 2642u, 2642u, 2642u, 2642u, 2643u, 2643u, 2644u, 2644u, 2645u, 2645u, 2646u, 2646u, 2647u, 2647u, 2648u, 2648u, 2649u,
+        2649u, 2649u, 2649u, 2650u, 2650u, 2650u, 2650u, 2651u, 2651u, 2651u, 2651u, 2652u, 2652u, 2652u, 2652u, 2653u, 2653u, 2654u, 2654u, 2654u, 2654u, 2655u, 2655u, 2656u,
+        2656u, 2656u, 2656u, 2657u, 2657u, 2657u, 2657u, 2658u, 2658u, 2659u, 2659u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2660u, 2660u, 2660u, 2660u, 2661u, 2661u, 2662u, 2662u, 2663u, 2663u, 407u, 2664u, 2664u, 2665u, 2665u, 2666u, 2666u, 2667u, 2667u,
+        2667u, 2667u, 2668u, 2668u, 2669u, 2669u, 2670u, 2670u, 2671u, 2671u, 2672u, 2672u, 2673u, 2673u, 2674u, 2674u, 2675u, 2675u, 2675u, 2676u, 2676u, 2676u, 2677u, 2677u,
+        2677u, 2677u, 2678u, 2679u, 2680u, 2676u, 2681u, 2682u, 2683u, 2684u, 2685u, 2686u, 2687u, 2688u, 2689u, 2690u, 2691u, 2692u, 2693u, 2694u, 2695u, 2696u, 2697u, 2698u,
+        2699u, 2700u, 2701u, 2702u, 2703u, 2704u, 2705u, 2706u, 2707u, 2708u, 2709u, 2710u, 2711u, 2712u, 2713u, 2714u, 2715u, 2716u, 2717u, 2718u, 2719u, 2720u, 2721u, 2722u,
+        2723u, 2724u, 2725u, 2726u, 2727u, 2728u, 2729u, 2730u, 2731u, 2732u, 2733u, 2734u, 2735u, 2736u, 2737u, 2738u, 2739u, 2740u, 2741u, 2742u, 2743u, 2744u, 2745u, 2746u,
+        2747u, 2748u, 2749u, 2750u, 2751u, 2752u, 2753u, 2754u, 2755u, 2756u, 2757u, 2758u, 2759u, 2760u, 2761u, 2762u, 2763u, 2764u, 2765u, 2766u, 2767u, 2768u, 2769u, 2770u,
+        2771u, 2772u, 2773u, 2774u, 2775u, 2776u, 2777u, 2778u, 2680u, 2779u, 2676u, 2681u, 2780u, 2781u, 2685u, 2782u, 2686u, 2687u, 2783u, 2784u, 2691u, 2785u, 2692u, 2693u,
+        2786u, 2787u, 2695u, 2788u, 2696u, 2697u, 2726u, 2727u, 2730u, 2731u, 2732u, 2736u, 2737u, 2738u, 2739u, 2743u, 2744u, 2745u, 2789u, 2749u, 2790u, 2791u, 2755u, 2792u,
+        2756u, 2757u, 2770u, 2793u, 2794u, 2765u, 2795u, 2766u, 2767u, 2678u, 2679u, 2796u, 2680u, 2797u, 2682u, 2683u, 2684u, 2685u, 2798u, 2688u, 2689u, 2690u, 2691u, 2799u,
+        2695u, 2698u, 2699u, 2700u, 2701u, 2702u, 2704u, 2705u, 2706u, 2707u, 2708u, 2709u, 2800u, 2710u, 2711u, 2712u, 2713u, 2714u, 2715u, 2717u, 2718u, 2719u, 2720u, 2721u,
+        2722u, 2723u, 2724u, 2725u, 2728u, 2729u, 2733u, 2734u, 2735u, 2736u, 2737u, 2740u, 2741u, 2742u, 2743u, 2801u, 2746u, 2747u, 2748u, 2749u, 2752u, 2753u, 2754u, 2755u,
+        2802u, 2758u, 2759u, 2803u, 2762u, 2763u, 2764u, 2765u, 2804u, 2680u, 2797u, 2685u, 2798u, 2691u, 2799u, 2695u, 2805u, 2708u, 2806u, 2807u, 2808u, 2736u, 2737u, 2743u,
+        2755u, 2802u, 2765u, 2804u, 2809u, 2810u, 2811u, 2812u, 2813u, 2814u, 2815u, 2816u, 2817u, 2818u, 2819u, 2820u, 2821u, 2822u, 2823u, 2824u, 2825u, 2826u, 2827u, 2828u,
+        2829u, 2830u, 2831u, 2832u, 2833u, 2834u, 2807u, 2835u, 2836u, 2837u, 2838u, 2812u, 2813u, 2814u, 2815u, 2816u, 2817u, 2818u, 2819u, 2820u, 2821u, 2822u, 2823u, 2824u,
+        2825u, 2826u, 2827u, 2828u, 2829u, 2830u, 2831u, 2832u, 2833u, 2834u, 2807u, 2835u, 2836u, 2837u, 2838u, 2832u, 2833u, 2834u, 2807u, 2806u, 2808u, 2716u, 2705u, 2706u,
+        2707u, 2832u, 2833u, 2834u, 2716u, 2717u, 2839u, 2839u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2840u, 2841u, 2841u, 2842u, 2843u, 2844u,
+        2845u, 2846u, 2847u, 2847u, 2848u, 2849u, 2850u, 2851u, 2852u, 2853u, 2853u, 2854u, 2855u, 2855u, 2856u, 2856u, 2857u, 2858u, 2858u, 2859u, 2860u, 2860u, 2861u, 2861u,
+        2862u, 2863u, 2863u, 2864u, 2864u, 2865u, 2866u, 2867u, 2868u, 2868u, 2869u, 2870u, 2871u, 2872u, 2873u, 2873u, 2874u, 2875u, 2876u, 2877u, 2878u, 2879u, 2879u, 2880u,
+        2880u, 2881u, 2881u, 2882u, 2883u, 2884u, 2885u, 2886u, 2887u, 2888u, 0u, 0u, 2889u, 2890u, 2891u, 2892u, 2893u, 2894u, 2894u, 2895u, 2896u, 2897u, 2898u, 2898u, 2899u,
+        2900u, 2901u, 2902u, 2903u, 2904u, 2905u, 2906u, 2907u, 2908u, 2909u, 2910u, 2911u, 2912u, 2913u, 2914u, 2915u, 2916u, 2917u, 2918u, 2919u, 2920u, 2874u, 2876u, 2921u,
+        2922u, 2923u, 2924u, 2925u, 2926u, 2925u, 2923u, 2927u, 2928u, 2929u, 2930u, 2931u, 2926u, 2867u, 2857u, 2932u, 2933u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2934u, 2935u, 2936u, 2937u, 2938u, 2939u, 2940u, 2941u, 2942u,
+        2943u, 2944u, 2945u, 2946u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2947u, 2948u, 2949u, 2950u, 2951u, 2952u, 2953u, 2954u, 2955u,
+        1061u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1060u, 2956u, 2957u, 2958u, 2958u, 1082u, 1083u, 2959u, 2960u, 2961u, 2962u,
+        2963u, 2964u, 2965u, 2966u, 2967u, 2968u, 2969u, 2970u, 2971u, 2972u, 0u, 0u, 2973u, 2974u, 1067u, 1067u, 1067u, 1067u, 2958u, 2958u, 2958u, 2947u, 2948u, 1059u, 0u,
+        2951u, 2950u, 2953u, 2952u, 2956u, 1082u, 1083u, 2959u, 2960u, 2961u, 2962u, 2975u, 2976u, 2977u, 1079u, 2978u, 2979u, 2980u, 1081u, 0u, 2981u, 2982u, 2983u, 2984u, 0u,
+        0u, 0u, 0u, 2985u, 2986u, 2987u, 0u, 2988u, 0u, 2989u, 2990u, 2991u, 2992u, 2993u, 2994u, 2995u, 2996u, 2997u, 2998u, 2999u, 3000u, 3000u, 3001u, 3001u, 3002u, 3002u,
+        3003u, 3003u, 3004u, 3004u, 3004u, 3004u, 3005u, 3005u, 3006u, 3006u, 3006u, 3006u, 3007u, 3007u, 3008u, 3008u, 3008u, 3008u, 3009u, 3009u, 3009u, 3009u, 3010u, 3010u,
+        3010u, 3010u, 3011u, 3011u, 3011u, 3011u, 3012u, 3012u, 3012u, 3012u, 3013u, 3013u, 3014u, 3014u, 3015u, 3015u, 3016u, 3016u, 3017u, 3017u, 3017u, 3017u, 3018u, 3018u,
+        3018u, 3018u, 3019u, 3019u, 3019u, 3019u, 3020u, 3020u, 3020u, 3020u, 3021u, 3021u, 3021u, 3021u, 3022u, 3022u, 3022u, 3022u, 3023u, 3023u, 3023u, 3023u, 3024u, 3024u,
+        3024u, 3024u, 3025u, 3025u, 3025u, 3025u, 3026u, 3026u, 3026u, 3026u, 3027u, 3027u, 3027u, 3027u, 3028u, 3028u, 3028u, 3028u, 3029u, 3029u, 3029u, 3029u, 3030u, 3030u,
+        3030u, 3030u, 3031u, 3031u, 3031u, 3031u, 3032u, 3032u, 2668u, 2668u, 3033u, 3033u, 3033u, 3033u, 3034u, 3034u, 3035u, 3035u, 3036u, 3036u, 3037u, 3037u, 0u, 0u, 0u, 0u,
+        2952u, 3038u, 2975u, 2982u, 2983u, 2976u, 3039u, 1082u, 1083u, 2977u, 1079u, 2947u, 2978u, 1059u, 3040u, 1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u,
+        2950u, 2951u, 2979u, 1081u, 2980u, 2953u, 2984u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u,
+        511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 2973u, 2981u, 2974u, 3041u, 2958u, 3042u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u,
+        11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 2959u, 3043u, 2960u, 3044u, 3045u, 3046u, 2949u, 2969u, 2970u, 2948u, 3047u, 1883u, 3048u, 3049u,
+        3050u, 3051u, 3052u, 3053u, 3054u, 3055u, 3056u, 3057u, 1837u, 1838u, 1839u, 1840u, 1841u, 1842u, 1843u, 1844u, 1845u, 1846u, 1847u, 1848u, 1849u, 1850u, 1851u, 1852u,
+        1853u, 1854u, 1855u, 1856u, 1857u, 1858u, 1859u, 1860u, 1861u, 1862u, 1863u, 1864u, 1865u, 1866u, 1867u, 1868u, 1869u, 1870u, 1871u, 1872u, 1873u, 1874u, 1875u, 1876u,
+        1877u, 1878u, 1879u, 1880u, 3058u, 3059u, 3060u, 1618u, 1567u, 1568u, 1569u, 1570u, 1571u, 1572u, 1573u, 1574u, 1575u, 1576u, 1577u, 1578u, 1579u, 1580u, 1581u, 1582u,
+        1583u, 1584u, 1585u, 1586u, 1587u, 1588u, 1589u, 1590u, 1591u, 1592u, 1593u, 1594u, 1595u, 1596u, 0u, 0u, 0u, 1597u, 1598u, 1599u, 1600u, 1601u, 1602u, 0u, 0u, 1603u,
+        1604u, 1605u, 1606u, 1607u, 1608u, 0u, 0u, 1609u, 1610u, 1611u, 1612u, 1613u, 1614u, 0u, 0u, 1615u, 1616u, 1617u, 0u, 0u, 0u, 3061u, 3062u, 3063u, 4u, 3064u, 3065u, 3066u,
+        0u, 3067u, 3068u, 3069u, 3070u, 3071u, 3072u, 3073u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3074u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3075u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3076u, 3077u, 3078u, 3079u, 3080u, 0u, 3081u, 3082u, 3083u, 3084u, 3085u, 3086u, 3087u, 3088u, 3089u, 3090u, 3091u, 3092u,
+        3093u, 3094u, 1094u, 3095u, 3096u, 3097u, 3098u, 3099u, 3100u, 3101u, 3102u, 3103u, 3104u, 3105u, 3106u, 3107u, 3108u, 3109u, 1279u, 3110u, 3111u, 3112u, 3113u, 3114u,
+        3115u, 3116u, 3117u, 3118u, 3119u, 3120u, 0u, 3121u, 3122u, 3123u, 3124u, 3125u, 3126u, 3127u, 3128u, 3129u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3130u, 0u, 3131u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3132u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 3133u, 3134u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 3135u, 3136u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3137u, 0u, 3138u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3139u, 0u, 0u, 3140u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 304u, 0u, 0u, 0u, 0u,
+        0u, 0u, 304u, 0u, 0u, 3141u, 0u, 3142u, 3143u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u,
+        3144u, 3145u, 304u, 3146u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3147u, 3148u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 3149u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u,
+        304u, 304u, 3150u, 3151u, 3152u, 3153u, 3154u, 3155u, 3156u, 3157u, 304u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 304u, 3158u, 3159u,
+        3160u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u,
+        1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3161u, 3162u, 3163u, 3164u, 3165u, 3166u, 3167u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3168u, 3169u, 3170u, 3171u, 3172u, 3173u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u,
+        1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u,
+        302u, 293u, 573u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u,
+        1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 0u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u,
+        493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u,
+        517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 0u, 1088u,
+        496u, 0u, 0u, 499u, 0u, 0u, 502u, 503u, 0u, 0u, 506u, 507u, 509u, 1096u, 0u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 0u, 546u, 0u, 285u,
+        540u, 287u, 524u, 301u, 525u, 1084u, 0u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u,
+        503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u,
+        525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 0u, 496u, 497u, 1104u, 499u, 0u, 0u, 502u, 503u, 504u, 505u, 506u, 507u,
+        509u, 1096u, 0u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 0u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u,
+        288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 0u, 496u, 497u, 1104u, 499u, 0u, 501u, 502u, 503u, 504u, 505u, 0u, 507u, 0u, 0u, 0u, 1277u, 511u, 512u,
+        1132u, 513u, 1137u, 1278u, 0u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u,
+        302u, 293u, 573u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u,
+        1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u,
+        493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u,
+        517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 1088u,
+        496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u,
+        519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 1088u, 496u, 497u, 1104u,
+        499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u,
+        540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u,
+        503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u,
+        525u, 1084u, 11u, 530u, 1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 493u, 495u, 1088u, 496u, 497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u,
+        507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3u, 517u, 543u, 518u, 519u, 546u, 523u, 285u, 540u, 287u, 524u, 301u, 525u, 1084u, 11u, 530u,
+        1279u, 288u, 181u, 531u, 532u, 535u, 292u, 302u, 293u, 573u, 3174u, 3175u, 0u, 0u, 3176u, 3177u, 1110u, 3178u, 3179u, 3180u, 3181u, 344u, 3182u, 3183u, 3184u, 3185u,
+        3186u, 3187u, 3188u, 1111u, 3189u, 344u, 346u, 3190u, 336u, 3191u, 3192u, 3193u, 3194u, 3195u, 3196u, 334u, 537u, 538u, 345u, 3197u, 3198u, 335u, 3199u, 341u, 3200u, 8u,
+        3201u, 3202u, 3203u, 340u, 342u, 343u, 3204u, 3205u, 3206u, 339u, 539u, 3207u, 3208u, 3209u, 345u, 335u, 341u, 339u, 342u, 340u, 3176u, 3177u, 1110u, 3178u, 3179u, 3180u,
+        3181u, 344u, 3182u, 3183u, 3184u, 3185u, 3186u, 3187u, 3188u, 1111u, 3189u, 344u, 346u, 3190u, 336u, 3191u, 3192u, 3193u, 3194u, 3195u, 3196u, 334u, 537u, 538u, 345u,
+        3197u, 3198u, 335u, 3199u, 341u, 3200u, 8u, 3201u, 3202u, 3203u, 340u, 342u, 343u, 3204u, 3205u, 3206u, 339u, 539u, 3207u, 3208u, 3209u, 345u, 335u, 341u, 339u, 342u,
+        340u, 3176u, 3177u, 1110u, 3178u, 3179u, 3180u, 3181u, 344u, 3182u, 3183u, 3184u, 3185u, 3186u, 3187u, 3188u, 1111u, 3189u, 344u, 346u, 3190u, 336u, 3191u, 3192u, 3193u,
+        3194u, 3195u, 3196u, 334u, 537u, 538u, 345u, 3197u, 3198u, 335u, 3199u, 341u, 3200u, 8u, 3201u, 3202u, 3203u, 340u, 342u, 343u, 3204u, 3205u, 3206u, 339u, 539u, 3207u,
+        3208u, 3209u, 345u, 335u, 341u, 339u, 342u, 340u, 3176u, 3177u, 1110u, 3178u, 3179u, 3180u, 3181u, 344u, 3182u, 3183u, 3184u, 3185u, 3186u, 3187u, 3188u, 1111u, 3189u,
+        344u, 346u, 3190u, 336u, 3191u, 3192u, 3193u, 3194u, 3195u, 3196u, 334u, 537u, 538u, 345u, 3197u, 3198u, 335u, 3199u, 341u, 3200u, 8u, 3201u, 3202u, 3203u, 340u, 342u,
+        343u, 3204u, 3205u, 3206u, 339u, 539u, 3207u, 3208u, 3209u, 345u, 335u, 341u, 339u, 342u, 340u, 3176u, 3177u, 1110u, 3178u, 3179u, 3180u, 3181u, 344u, 3182u, 3183u, 3184u,
+        3185u, 3186u, 3187u, 3188u, 1111u, 3189u, 344u, 346u, 3190u, 336u, 3191u, 3192u, 3193u, 3194u, 3195u, 3196u, 334u, 537u, 538u, 345u, 3197u, 3198u, 335u, 3199u, 341u,
+        3200u, 8u, 3201u, 3202u, 3203u, 340u, 342u, 343u, 3204u, 3205u, 3206u, 339u, 539u, 3207u, 3208u, 3209u, 345u, 335u, 341u, 339u, 342u, 340u, 3210u, 3211u, 0u, 0u, 1072u,
+        10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u,
+        1078u, 1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 1072u, 10u, 5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3212u, 3213u,
+        3214u, 3215u, 3216u, 3217u, 3218u, 3219u, 3220u, 3221u, 3222u, 3223u, 3224u, 3225u, 3226u, 3227u, 3228u, 3229u, 3230u, 3231u, 3232u, 3233u, 3234u, 3235u, 3236u, 3237u,
+        3238u, 3239u, 3240u, 3241u, 3242u, 3243u, 3244u, 3212u, 3213u, 3214u, 3215u, 3216u, 3217u, 3218u, 3219u, 3220u, 3221u, 3222u, 3224u, 3225u, 3227u, 3229u, 3230u, 3231u,
+        3232u, 3233u, 3234u, 2141u, 3235u, 3245u, 3240u, 3246u, 3247u, 3248u, 3249u, 3250u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3005u, 3006u,
+        3010u, 3013u, 0u, 3032u, 3016u, 3011u, 3021u, 3033u, 3027u, 3028u, 3029u, 3030u, 3017u, 3023u, 3025u, 3019u, 3026u, 3015u, 3018u, 3008u, 3009u, 3012u, 3014u, 3020u, 3022u,
+        3024u, 3251u, 2653u, 3252u, 3253u, 0u, 3006u, 3010u, 0u, 3031u, 0u, 0u, 3011u, 0u, 3033u, 3027u, 3028u, 3029u, 3030u, 3017u, 3023u, 3025u, 3019u, 3026u, 0u, 3018u, 3008u,
+        3009u, 3012u, 0u, 3020u, 0u, 3024u, 0u, 0u, 0u, 0u, 0u, 0u, 3010u, 0u, 0u, 0u, 0u, 3011u, 0u, 3033u, 0u, 3028u, 0u, 3030u, 3017u, 3023u, 0u, 3019u, 3026u, 0u, 3018u, 0u,
+        0u, 3012u, 0u, 3020u, 0u, 3024u, 0u, 2653u, 0u, 3253u, 0u, 3006u, 3010u, 0u, 3031u, 0u, 0u, 3011u, 3021u, 3033u, 3027u, 0u, 3029u, 3030u, 3017u, 3023u, 3025u, 3019u,
+        3026u, 0u, 3018u, 3008u, 3009u, 3012u, 0u, 3020u, 3022u, 3024u, 3251u, 0u, 3252u, 0u, 3005u, 3006u, 3010u, 3013u, 3031u, 3032u, 3016u, 3011u, 3021u, 3033u, 0u, 3028u,
+        3029u, 3030u, 3017u, 3023u, 3025u, 3019u, 3026u, 3015u, 3018u, 3008u, 3009u, 3012u, 3014u, 3020u, 3022u, 3024u, 0u, 0u, 0u, 0u, 0u, 3006u, 3010u, 3013u, 0u, 3032u, 3016u,
+        3011u, 3021u, 3033u, 0u, 3028u, 3029u, 3030u, 3017u, 3023u, 3025u, 3019u, 3026u, 3015u, 3018u, 3008u, 3009u, 3012u, 3014u, 3020u, 3022u, 3024u, 0u, 0u, 0u, 0u, 3254u,
+        3255u, 3256u, 3257u, 3258u, 3259u, 3260u, 3261u, 3262u, 3263u, 3264u, 0u, 0u, 0u, 0u, 0u, 3265u, 3266u, 3267u, 3268u, 3269u, 3270u, 3271u, 3272u, 3273u, 3274u, 3275u,
+        3276u, 3277u, 3278u, 3279u, 3280u, 3281u, 3282u, 3283u, 3284u, 3285u, 3286u, 3287u, 3288u, 3289u, 3290u, 3291u, 1088u, 510u, 3292u, 3293u, 0u, 493u, 495u, 1088u, 496u,
+        497u, 1104u, 499u, 500u, 501u, 502u, 503u, 504u, 505u, 506u, 507u, 509u, 1096u, 510u, 1277u, 511u, 512u, 1132u, 513u, 1137u, 1278u, 1100u, 3294u, 2070u, 3295u, 3296u,
+        3297u, 3298u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3299u, 3300u, 3301u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3302u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3303u, 3304u, 1847u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1351u, 3305u, 3306u, 3307u, 1294u, 3308u, 3309u, 1669u, 3310u, 3311u, 3312u, 3313u, 3314u, 3315u, 3316u, 3317u, 3318u, 3319u, 1387u,
+        3320u, 3321u, 3322u, 3323u, 3324u, 3325u, 1288u, 1661u, 3326u, 1796u, 1664u, 1797u, 3327u, 1443u, 3328u, 3329u, 3330u, 3331u, 3332u, 1779u, 1361u, 3333u, 3334u, 3335u,
+        3336u, 0u, 0u, 0u, 0u, 3337u, 3338u, 3339u, 3340u, 3341u, 3342u, 3343u, 3344u, 3345u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 3346u, 3347u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1072u, 10u,
+        5u, 6u, 1073u, 1074u, 1075u, 1076u, 1077u, 1078u, 0u, 0u, 0u, 0u, 0u, 0u, 3348u, 3349u, 3350u, 3351u, 3352u, 2438u, 3353u, 3354u, 3355u, 3356u, 2439u, 3357u, 3358u, 3359u,
+        2440u, 3360u, 3361u, 3362u, 3363u, 3364u, 3365u, 3366u, 3367u, 3368u, 3369u, 3370u, 3371u, 2498u, 3372u, 3373u, 3374u, 3375u, 3376u, 3377u, 3378u, 3379u, 3380u, 2503u,
+        2441u, 2442u, 2504u, 3381u, 3382u, 2249u, 3383u, 2443u, 3384u, 3385u, 3386u, 3387u, 3387u, 3387u, 3388u, 3389u, 3390u, 3391u, 3392u, 3393u, 3394u, 3395u, 3396u, 3397u,
+        3398u, 3399u, 3400u, 3401u, 3402u, 3403u, 3404u, 3405u, 3405u, 2506u, 3406u, 3407u, 3408u, 3409u, 2445u, 3410u, 3411u, 3412u, 2402u, 3413u, 3414u, 3415u, 3416u, 3417u,
+        3418u, 3419u, 3420u, 3421u, 3422u, 3423u, 3424u, 3425u, 3426u, 3427u, 3428u, 3429u, 3430u, 3431u, 3432u, 3433u, 3434u, 3435u, 3436u, 3437u, 3438u, 3438u, 3439u, 3440u,
+        3441u, 2245u, 3442u, 3443u, 3444u, 3445u, 3446u, 3447u, 3448u, 3449u, 2450u, 3450u, 3451u, 3452u, 3453u, 3454u, 3455u, 3456u, 3457u, 3458u, 3459u, 3460u, 3461u, 3462u,
+        3463u, 3464u, 3465u, 3466u, 3467u, 3468u, 3469u, 3470u, 2191u, 3471u, 3472u, 3473u, 3473u, 3474u, 3475u, 3475u, 3476u, 3477u, 3478u, 3479u, 3480u, 3481u, 3482u, 3483u,
+        3484u, 3485u, 3486u, 3487u, 3488u, 2451u, 3489u, 3490u, 3491u, 3492u, 2518u, 3492u, 3493u, 2453u, 3494u, 3495u, 3496u, 3497u, 2454u, 2164u, 3498u, 3499u, 3500u, 3501u,
+        3502u, 3503u, 3504u, 3505u, 3506u, 3507u, 3508u, 3509u, 3510u, 3511u, 3512u, 3513u, 3514u, 3515u, 3516u, 3517u, 3518u, 3519u, 2455u, 3520u, 3521u, 3522u, 3523u, 3524u,
+        3525u, 2457u, 3526u, 3527u, 3528u, 3529u, 3530u, 3531u, 3532u, 3533u, 2192u, 2526u, 3534u, 3535u, 3536u, 3537u, 3538u, 3539u, 3540u, 3541u, 2458u, 3542u, 3543u, 3544u,
+        3545u, 2569u, 3546u, 3547u, 3548u, 3549u, 3550u, 3551u, 3552u, 3553u, 3554u, 3555u, 3556u, 3557u, 3558u, 2262u, 3559u, 3560u, 3561u, 3562u, 3563u, 3564u, 3565u, 3566u,
+        3567u, 3568u, 3569u, 2459u, 2349u, 3570u, 3571u, 3572u, 3573u, 3574u, 3575u, 3576u, 3577u, 2530u, 3578u, 3579u, 3580u, 3581u, 3582u, 3583u, 3584u, 3585u, 2531u, 3586u,
+        3587u, 3588u, 3589u, 3590u, 3591u, 3592u, 3593u, 3594u, 3595u, 3596u, 3597u, 2533u, 3598u, 3599u, 3600u, 3601u, 3602u, 3603u, 3604u, 3605u, 3606u, 3607u, 3608u, 3608u,
+        3609u, 3610u, 2535u, 3611u, 3612u, 3613u, 3614u, 3615u, 3616u, 3617u, 2248u, 3618u, 3619u, 3620u, 3621u, 3622u, 3623u, 3624u, 2541u, 3625u, 3626u, 3627u, 3628u, 3629u,
+        3630u, 3630u, 2542u, 2571u, 3631u, 3632u, 3633u, 3634u, 3635u, 2210u, 2544u, 3636u, 3637u, 2470u, 3638u, 3639u, 2424u, 3640u, 3641u, 2474u, 3642u, 3643u, 3644u, 3645u,
+        3645u, 3646u, 3647u, 3648u, 3649u, 3650u, 3651u, 3652u, 3653u, 3654u, 3655u, 3656u, 3657u, 3658u, 3659u, 3660u, 3661u, 3662u, 3663u, 3664u, 3665u, 3666u, 3667u, 3668u,
+        3669u, 3670u, 3671u, 3672u, 2480u, 3673u, 3674u, 3675u, 3676u, 3677u, 3678u, 3679u, 3680u, 3681u, 3682u, 3683u, 3684u, 3685u, 3686u, 3687u, 3688u, 3474u, 3689u, 3690u,
+        3691u, 3692u, 3693u, 3694u, 3695u, 3696u, 3697u, 3698u, 3699u, 3700u, 2266u, 3701u, 3702u, 3703u, 3704u, 3705u, 3706u, 2483u, 3707u, 3708u, 3709u, 3710u, 3711u, 3712u,
+        3713u, 3714u, 3715u, 3716u, 3717u, 3718u, 3719u, 3720u, 3721u, 3722u, 3723u, 3724u, 3725u, 3726u, 2205u, 3727u, 3728u, 3729u, 3730u, 3731u, 3732u, 2551u, 3733u, 3734u,
+        3735u, 3736u, 3737u, 3738u, 3739u, 3740u, 3741u, 3742u, 3743u, 3744u, 3745u, 3746u, 3747u, 3748u, 3749u, 3750u, 3751u, 3752u, 2556u, 2557u, 3753u, 3754u, 3755u, 3756u,
+        3757u, 3758u, 3759u, 3760u, 3761u, 3762u, 3763u, 3764u, 3765u, 2558u, 3766u, 3767u, 3768u, 3769u, 3770u, 3771u, 3772u, 3773u, 3774u, 3775u, 3776u, 3777u, 3778u, 3779u,
+        3780u, 3781u, 3782u, 3783u, 3784u, 3785u, 3786u, 3787u, 3788u, 3789u, 3790u, 3791u, 3792u, 3793u, 3794u, 3795u, 2564u, 2564u, 3796u, 3797u, 3798u, 3799u, 3800u, 3801u,
+        3802u, 3803u, 3804u, 3805u, 2565u, 3806u, 3807u, 3808u, 3809u, 3810u, 3811u, 3812u, 3813u, 3814u, 3815u, 3816u, 3817u, 3818u, 3819u, 3820u, 3821u, 3822u, 3823u, 3824u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u
+    };
+    inline constexpr char32_t normalization_decompositions[] = {
+        U'\u0020', U'\u0020', U'\u0308', U'\u0061', U'\u0020', U'\u0304', U'\u0032', U'\u0033', U'\u0020', U'\u0301', U'\u03BC', U'\u0020', U'\u0327', U'\u0031', U'\u006F',
+        U'\u0031', U'\u2044', U'\u0034', U'\u0031', U'\u2044', U'\u0032', U'\u0033', U'\u2044', U'\u0034', U'\u0041', U'\u0300', U'\u0041', U'\u0301', U'\u0041', U'\u0302',
+        U'\u0041', U'\u0303', U'\u0041', U'\u0308', U'\u0041', U'\u030A', U'\u0043', U'\u0327', U'\u0045', U'\u0300', U'\u0045', U'\u0301', U'\u0045', U'\u0302', U'\u0045',
+        U'\u0308', U'\u0049', U'\u0300', U'\u0049', U'\u0301', U'\u0049', U'\u0302', U'\u0049', U'\u0308', U'\u004E', U'\u0303', U'\u004F', U'\u0300', U'\u004F', U'\u0301',
+        U'\u004F', U'\u0302', U'\u004F', U'\u0303', U'\u004F', U'\u0308', U'\u0055', U'\u0300', U'\u0055', U'\u0301', U'\u0055', U'\u0302', U'\u0055', U'\u0308', U'\u0059',
+        U'\u0301', U'\u0061', U'\u0300', U'\u0061', U'\u0301', U'\u0061', U'\u0302', U'\u0061', U'\u0303', U'\u0061', U'\u0308', U'\u0061', U'\u030A', U'\u0063', U'\u0327',
+        U'\u0065', U'\u0300', U'\u0065', U'\u0301', U'\u0065', U'\u0302', U'\u0065', U'\u0308', U'\u0069', U'\u0300', U'\u0069', U'\u0301', U'\u0069', U'\u0302', U'\u0069',
+        U'\u0308', U'\u006E', U'\u0303', U'\u006F', U'\u0300', U'\u006F', U'\u0301', U'\u006F', U'\u0302', U'\u006F', U'\u0303', U'\u006F', U'\u0308', U'\u0075', U'\u0300',
+        U'\u0075', U'\u0301', U'\u0075', U'\u0302', U'\u0075', U'\u0308', U'\u0079', U'\u0301', U'\u0079', U'\u0308', U'\u0041', U'\u0304', U'\u0061', U'\u0304', U'\u0041',
+        U'\u0306', U'\u0061', U'\u0306', U'\u0041', U'\u0328', U'\u0061', U'\u0328', U'\u0043', U'\u0301', U'\u0063', U'\u0301', U'\u0043', U'\u0302', U'\u0063', U'\u0302',
+        U'\u0043', U'\u0307', U'\u0063', U'\u0307', U'\u0043', U'\u030C', U'\u0063', U'\u030C', U'\u0044', U'\u030C', U'\u0064', U'\u030C', U'\u0045', U'\u0304', U'\u0065',
+        U'\u0304', U'\u0045', U'\u0306', U'\u0065', U'\u0306', U'\u0045', U'\u0307', U'\u0065', U'\u0307', U'\u0045', U'\u0328', U'\u0065', U'\u0328', U'\u0045', U'\u030C',
+        U'\u0065', U'\u030C', U'\u0047', U'\u0302', U'\u0067', U'\u0302', U'\u0047', U'\u0306', U'\u0067', U'\u0306', U'\u0047', U'\u0307', U'\u0067', U'\u0307', U'\u0047',
+        U'\u0327', U'\u0067', U'\u0327', U'\u0048', U'\u0302', U'\u0068', U'\u0302', U'\u0049', U'\u0303', U'\u0069', U'\u0303', U'\u0049', U'\u0304', U'\u0069', U'\u0304',
+        U'\u0049', U'\u0306', U'\u0069', U'\u0306', U'\u0049', U'\u0328', U'\u0069', U'\u0328', U'\u0049', U'\u0307', U'\u0049', U'\u004A', U'\u0069', U'\u006A', U'\u004A',
+        U'\u0302', U'\u006A', U'\u0302', U'\u004B', U'\u0327', U'\u006B', U'\u0327', U'\u004C', U'\u0301', U'\u006C', U'\u0301', U'\u004C', U'\u0327', U'\u006C', U'\u0327',
+        U'\u004C', U'\u030C', U'\u006C', U'\u030C', U'\u004C', U'\u00B7', U'\u006C', U'\u00B7', U'\u004E', U'\u0301', U'\u006E', U'\u0301', U'\u004E', U'\u0327', U'\u006E',
+        U'\u0327', U'\u004E', U'\u030C', U'\u006E', U'\u030C', U'\u02BC', U'\u006E', U'\u004F', U'\u0304', U'\u006F', U'\u0304', U'\u004F', U'\u0306', U'\u006F', U'\u0306',
+        U'\u004F', U'\u030B', U'\u006F', U'\u030B', U'\u0052', U'\u0301', U'\u0072', U'\u0301', U'\u0052', U'\u0327', U'\u0072', U'\u0327', U'\u0052', U'\u030C', U'\u0072',
+        U'\u030C', U'\u0053', U'\u0301', U'\u0073', U'\u0301', U'\u0053', U'\u0302', U'\u0073', U'\u0302', U'\u0053', U'\u0327', U'\u0073', U'\u0327', U'\u0053', U'\u030C',
+        U'\u0073', U'\u030C', U'\u0054', U'\u0327', U'\u0074', U'\u0327', U'\u0054', U'\u030C', U'\u0074', U'\u030C', U'\u0055', U'\u0303', U'\u0075', U'\u0303', U'\u0055',
+        U'\u0304', U'\u0075', U'\u0304', U'\u0055', U'\u0306', U'\u0075', U'\u0306', U'\u0055', U'\u030A', U'\u0075', U'\u030A', U'\u0055', U'\u030B', U'\u0075', U'\u030B',
+        U'\u0055', U'\u0328', U'\u0075', U'\u0328', U'\u0057', U'\u0302', U'\u0077', U'\u0302', U'\u0059', U'\u0302', U'\u0079', U'\u0302', U'\u0059', U'\u0308', U'\u005A',
+        U'\u0301', U'\u007A', U'\u0301', U'\u005A', U'\u0307', U'\u007A', U'\u0307', U'\u005A', U'\u030C', U'\u007A', U'\u030C', U'\u0073', U'\u004F', U'\u031B', U'\u006F',
+        U'\u031B', U'\u0055', U'\u031B', U'\u0075', U'\u031B', U'\u0044', U'\u005A', U'\u030C', U'\u0044', U'\u007A', U'\u030C', U'\u0064', U'\u007A', U'\u030C', U'\u004C',
+        U'\u004A', U'\u004C', U'\u006A', U'\u006C', U'\u006A', U'\u004E', U'\u004A', U'\u004E', U'\u006A', U'\u006E', U'\u006A', U'\u0041', U'\u030C', U'\u0061', U'\u030C',
+        U'\u0049', U'\u030C', U'\u0069', U'\u030C', U'\u004F', U'\u030C', U'\u006F', U'\u030C', U'\u0055', U'\u030C', U'\u0075', U'\u030C', U'\u0055', U'\u0308', U'\u0304',
+        U'\u0075', U'\u0308', U'\u0304', U'\u0055', U'\u0308', U'\u0301', U'\u0075', U'\u0308', U'\u0301', U'\u0055', U'\u0308', U'\u030C', U'\u0075', U'\u0308', U'\u030C',
+        U'\u0055', U'\u0308', U'\u0300', U'\u0075', U'\u0308', U'\u0300', U'\u0041', U'\u0308', U'\u0304', U'\u0061', U'\u0308', U'\u0304', U'\u0041', U'\u0307', U'\u0304',
+        U'\u0061', U'\u0307', U'\u0304', U'\u00C6', U'\u0304', U'\u00E6', U'\u0304', U'\u0047', U'\u030C', U'\u0067', U'\u030C', U'\u004B', U'\u030C', U'\u006B', U'\u030C',
+        U'\u004F', U'\u0328', U'\u006F', U'\u0328', U'\u004F', U'\u0328', U'\u0304', U'\u006F', U'\u0328', U'\u0304', U'\u01B7', U'\u030C', U'\u0292', U'\u030C', U'\u006A',
+        U'\u030C', U'\u0044', U'\u005A', U'\u0044', U'\u007A', U'\u0064', U'\u007A', U'\u0047', U'\u0301', U'\u0067', U'\u0301', U'\u004E', U'\u0300', U'\u006E', U'\u0300',
+        U'\u0041', U'\u030A', U'\u0301', U'\u0061', U'\u030A', U'\u0301', U'\u00C6', U'\u0301', U'\u00E6', U'\u0301', U'\u00D8', U'\u0301', U'\u00F8', U'\u0301', U'\u0041',
+        U'\u030F', U'\u0061', U'\u030F', U'\u0041', U'\u0311', U'\u0061', U'\u0311', U'\u0045', U'\u030F', U'\u0065', U'\u030F', U'\u0045', U'\u0311', U'\u0065', U'\u0311',
+        U'\u0049', U'\u030F', U'\u0069', U'\u030F', U'\u0049', U'\u0311', U'\u0069', U'\u0311', U'\u004F', U'\u030F', U'\u006F', U'\u030F', U'\u004F', U'\u0311', U'\u006F',
+        U'\u0311', U'\u0052', U'\u030F', U'\u0072', U'\u030F', U'\u0052', U'\u0311', U'\u0072', U'\u0311', U'\u0055', U'\u030F', U'\u0075', U'\u030F', U'\u0055', U'\u0311',
+        U'\u0075', U'\u0311', U'\u0053', U'\u0326', U'\u0073', U'\u0326', U'\u0054', U'\u0326', U'\u0074', U'\u0326', U'\u0048', U'\u030C', U'\u0068', U'\u030C', U'\u0041',
+        U'\u0307', U'\u0061', U'\u0307', U'\u0045', U'\u0327', U'\u0065', U'\u0327', U'\u004F', U'\u0308', U'\u0304', U'\u006F', U'\u0308', U'\u0304', U'\u004F', U'\u0303',
+        U'\u0304', U'\u006F', U'\u0303', U'\u0304', U'\u004F', U'\u0307', U'\u006F', U'\u0307', U'\u004F', U'\u0307', U'\u0304', U'\u006F', U'\u0307', U'\u0304', U'\u0059',
+        U'\u0304', U'\u0079', U'\u0304', U'\u0068', U'\u0266', U'\u006A', U'\u0072', U'\u0279', U'\u027B', U'\u0281', U'\u0077', U'\u0079', U'\u0020', U'\u0306', U'\u0020',
+        U'\u0307', U'\u0020', U'\u030A', U'\u0020', U'\u0328', U'\u0020', U'\u0303', U'\u0020', U'\u030B', U'\u0263', U'\u006C', U'\u0078', U'\u0295', U'\u0300', U'\u0301',
+        U'\u0313', U'\u0308', U'\u0301', U'\u02B9', U'\u0020', U'\u0345', U'\u003B', U'\u00A8', U'\u0301', U'\u0020', U'\u0308', U'\u0301', U'\u0391', U'\u0301', U'\u00B7',
+        U'\u0395', U'\u0301', U'\u0397', U'\u0301', U'\u0399', U'\u0301', U'\u039F', U'\u0301', U'\u03A5', U'\u0301', U'\u03A9', U'\u0301', U'\u03B9', U'\u0308', U'\u0301',
+        U'\u0399', U'\u0308', U'\u03A5', U'\u0308', U'\u03B1', U'\u0301', U'\u03B5', U'\u0301', U'\u03B7', U'\u0301', U'\u03B9', U'\u0301', U'\u03C5', U'\u0308', U'\u0301',
+        U'\u03B9', U'\u0308', U'\u03C5', U'\u0308', U'\u03BF', U'\u0301', U'\u03C5', U'\u0301', U'\u03C9', U'\u0301', U'\u03B2', U'\u03B8', U'\u03A5', U'\u03D2', U'\u0301',
+        U'\u03D2', U'\u0308', U'\u03C6', U'\u03C0', U'\u03BA', U'\u03C1', U'\u03C2', U'\u0398', U'\u03B5', U'\u03A3', U'\u0415', U'\u0300', U'\u0415', U'\u0308', U'\u0413',
+        U'\u0301', U'\u0406', U'\u0308', U'\u041A', U'\u0301', U'\u0418', U'\u0300', U'\u0423', U'\u0306', U'\u0418', U'\u0306', U'\u0438', U'\u0306', U'\u0435', U'\u0300',
+        U'\u0435', U'\u0308', U'\u0433', U'\u0301', U'\u0456', U'\u0308', U'\u043A', U'\u0301', U'\u0438', U'\u0300', U'\u0443', U'\u0306', U'\u0474', U'\u030F', U'\u0475',
+        U'\u030F', U'\u0416', U'\u0306', U'\u0436', U'\u0306', U'\u0410', U'\u0306', U'\u0430', U'\u0306', U'\u0410', U'\u0308', U'\u0430', U'\u0308', U'\u0415', U'\u0306',
+        U'\u0435', U'\u0306', U'\u04D8', U'\u0308', U'\u04D9', U'\u0308', U'\u0416', U'\u0308', U'\u0436', U'\u0308', U'\u0417', U'\u0308', U'\u0437', U'\u0308', U'\u0418',
+        U'\u0304', U'\u0438', U'\u0304', U'\u0418', U'\u0308', U'\u0438', U'\u0308', U'\u041E', U'\u0308', U'\u043E', U'\u0308', U'\u04E8', U'\u0308', U'\u04E9', U'\u0308',
+        U'\u042D', U'\u0308', U'\u044D', U'\u0308', U'\u0423', U'\u0304', U'\u0443', U'\u0304', U'\u0423', U'\u0308', U'\u0443', U'\u0308', U'\u0423', U'\u030B', U'\u0443',
+        U'\u030B', U'\u0427', U'\u0308', U'\u0447', U'\u0308', U'\u042B', U'\u0308', U'\u044B', U'\u0308', U'\u0565', U'\u0582', U'\u0627', U'\u0653', U'\u0627', U'\u0654',
+        U'\u0648', U'\u0654', U'\u0627', U'\u0655', U'\u064A', U'\u0654', U'\u0627', U'\u0674', U'\u0648', U'\u0674', U'\u06C7', U'\u0674', U'\u064A', U'\u0674', U'\u06D5',
+        U'\u0654', U'\u06C1', U'\u0654', U'\u06D2', U'\u0654', U'\u0928', U'\u093C', U'\u0930', U'\u093C', U'\u0933', U'\u093C', U'\u0915', U'\u093C', U'\u0916', U'\u093C',
+        U'\u0917', U'\u093C', U'\u091C', U'\u093C', U'\u0921', U'\u093C', U'\u0922', U'\u093C', U'\u092B', U'\u093C', U'\u092F', U'\u093C', U'\u09C7', U'\u09BE', U'\u09C7',
+        U'\u09D7', U'\u09A1', U'\u09BC', U'\u09A2', U'\u09BC', U'\u09AF', U'\u09BC', U'\u0A32', U'\u0A3C', U'\u0A38', U'\u0A3C', U'\u0A16', U'\u0A3C', U'\u0A17', U'\u0A3C',
+        U'\u0A1C', U'\u0A3C', U'\u0A2B', U'\u0A3C', U'\u0B47', U'\u0B56', U'\u0B47', U'\u0B3E', U'\u0B47', U'\u0B57', U'\u0B21', U'\u0B3C', U'\u0B22', U'\u0B3C', U'\u0B92',
+        U'\u0BD7', U'\u0BC6', U'\u0BBE', U'\u0BC7', U'\u0BBE', U'\u0BC6', U'\u0BD7', U'\u0C46', U'\u0C56', U'\u0CBF', U'\u0CD5', U'\u0CC6', U'\u0CD5', U'\u0CC6', U'\u0CD6',
+        U'\u0CC6', U'\u0CC2', U'\u0CC6', U'\u0CC2', U'\u0CD5', U'\u0D46', U'\u0D3E', U'\u0D47', U'\u0D3E', U'\u0D46', U'\u0D57', U'\u0DD9', U'\u0DCA', U'\u0DD9', U'\u0DCF',
+        U'\u0DD9', U'\u0DCF', U'\u0DCA', U'\u0DD9', U'\u0DDF', U'\u0E4D', U'\u0E32', U'\u0ECD', U'\u0EB2', U'\u0EAB', U'\u0E99', U'\u0EAB', U'\u0EA1', U'\u0F0B', U'\u0F42',
+        U'\u0FB7', U'\u0F4C', U'\u0FB7', U'\u0F51', U'\u0FB7', U'\u0F56', U'\u0FB7', U'\u0F5B', U'\u0FB7', U'\u0F40', U'\u0FB5', U'\u0F71', U'\u0F72', U'\u0F71', U'\u0F74',
+        U'\u0FB2', U'\u0F80', U'\u0FB2', U'\u0F71', U'\u0F80', U'\u0FB3', U'\u0F80', U'\u0FB3', U'\u0F71', U'\u0F80', U'\u0F71', U'\u0F80', U'\u0F92', U'\u0FB7', U'\u0F9C',
+        U'\u0FB7', U'\u0FA1', U'\u0FB7', U'\u0FA6', U'\u0FB7', U'\u0FAB', U'\u0FB7', U'\u0F90', U'\u0FB5', U'\u1025', U'\u102E', U'\u10DC', U'\u1B05', U'\u1B35', U'\u1B07',
+        U'\u1B35', U'\u1B09', U'\u1B35', U'\u1B0B', U'\u1B35', U'\u1B0D', U'\u1B35', U'\u1B11', U'\u1B35', U'\u1B3A', U'\u1B35', U'\u1B3C', U'\u1B35', U'\u1B3E', U'\u1B35',
+        U'\u1B3F', U'\u1B35', U'\u1B42', U'\u1B35', U'\u0041', U'\u00C6', U'\u0042', U'\u0044', U'\u0045', U'\u018E', U'\u0047', U'\u0048', U'\u0049', U'\u004A', U'\u004B',
+        U'\u004C', U'\u004D', U'\u004E', U'\u004F', U'\u0222', U'\u0050', U'\u0052', U'\u0054', U'\u0055', U'\u0057', U'\u0250', U'\u0251', U'\u1D02', U'\u0062', U'\u0064',
+        U'\u0065', U'\u0259', U'\u025B', U'\u025C', U'\u0067', U'\u006B', U'\u006D', U'\u014B', U'\u0254', U'\u1D16', U'\u1D17', U'\u0070', U'\u0074', U'\u0075', U'\u1D1D',
+        U'\u026F', U'\u0076', U'\u1D25', U'\u03B3', U'\u03B4', U'\u03C7', U'\u0069', U'\u043D', U'\u0252', U'\u0063', U'\u0255', U'\u00F0', U'\u0066', U'\u025F', U'\u0261',
+        U'\u0265', U'\u0268', U'\u0269', U'\u026A', U'\u1D7B', U'\u029D', U'\u026D', U'\u1D85', U'\u029F', U'\u0271', U'\u0270', U'\u0272', U'\u0273', U'\u0274', U'\u0275',
+        U'\u0278', U'\u0282', U'\u0283', U'\u01AB', U'\u0289', U'\u028A', U'\u1D1C', U'\u028B', U'\u028C', U'\u007A', U'\u0290', U'\u0291', U'\u0292', U'\u0041', U'\u0325',
+        U'\u0061', U'\u0325', U'\u0042', U'\u0307', U'\u0062', U'\u0307', U'\u0042', U'\u0323', U'\u0062', U'\u0323', U'\u0042', U'\u0331', U'\u0062', U'\u0331', U'\u0043',
+        U'\u0327', U'\u0301', U'\u0063', U'\u0327', U'\u0301', U'\u0044', U'\u0307', U'\u0064', U'\u0307', U'\u0044', U'\u0323', U'\u0064', U'\u0323', U'\u0044', U'\u0331',
+        U'\u0064', U'\u0331', U'\u0044', U'\u0327', U'\u0064', U'\u0327', U'\u0044', U'\u032D', U'\u0064', U'\u032D', U'\u0045', U'\u0304', U'\u0300', U'\u0065', U'\u0304',
+        U'\u0300', U'\u0045', U'\u0304', U'\u0301', U'\u0065', U'\u0304', U'\u0301', U'\u0045', U'\u032D', U'\u0065', U'\u032D', U'\u0045', U'\u0330', U'\u0065', U'\u0330',
+        U'\u0045', U'\u0327', U'\u0306', U'\u0065', U'\u0327', U'\u0306', U'\u0046', U'\u0307', U'\u0066', U'\u0307', U'\u0047', U'\u0304', U'\u0067', U'\u0304', U'\u0048',
+        U'\u0307', U'\u0068', U'\u0307', U'\u0048', U'\u0323', U'\u0068', U'\u0323', U'\u0048', U'\u0308', U'\u0068', U'\u0308', U'\u0048', U'\u0327', U'\u0068', U'\u0327',
+        U'\u0048', U'\u032E', U'\u0068', U'\u032E', U'\u0049', U'\u0330', U'\u0069', U'\u0330', U'\u0049', U'\u0308', U'\u0301', U'\u0069', U'\u0308', U'\u0301', U'\u004B',
+        U'\u0301', U'\u006B', U'\u0301', U'\u004B', U'\u0323', U'\u006B', U'\u0323', U'\u004B', U'\u0331', U'\u006B', U'\u0331', U'\u004C', U'\u0323', U'\u006C', U'\u0323',
+        U'\u004C', U'\u0323', U'\u0304', U'\u006C', U'\u0323', U'\u0304', U'\u004C', U'\u0331', U'\u006C', U'\u0331', U'\u004C', U'\u032D', U'\u006C', U'\u032D', U'\u004D',
+        U'\u0301', U'\u006D', U'\u0301', U'\u004D', U'\u0307', U'\u006D', U'\u0307', U'\u004D', U'\u0323', U'\u006D', U'\u0323', U'\u004E', U'\u0307', U'\u006E', U'\u0307',
+        U'\u004E', U'\u0323', U'\u006E', U'\u0323', U'\u004E', U'\u0331', U'\u006E', U'\u0331', U'\u004E', U'\u032D', U'\u006E', U'\u032D', U'\u004F', U'\u0303', U'\u0301',
+        U'\u006F', U'\u0303', U'\u0301', U'\u004F', U'\u0303', U'\u0308', U'\u006F', U'\u0303', U'\u0308', U'\u004F', U'\u0304', U'\u0300', U'\u006F', U'\u0304', U'\u0300',
+        U'\u004F', U'\u0304', U'\u0301', U'\u006F', U'\u0304', U'\u0301', U'\u0050', U'\u0301', U'\u0070', U'\u0301', U'\u0050', U'\u0307', U'\u0070', U'\u0307', U'\u0052',
+        U'\u0307', U'\u0072', U'\u0307', U'\u0052', U'\u0323', U'\u0072', U'\u0323', U'\u0052', U'\u0323', U'\u0304', U'\u0072', U'\u0323', U'\u0304', U'\u0052', U'\u0331',
+        U'\u0072', U'\u0331', U'\u0053', U'\u0307', U'\u0073', U'\u0307', U'\u0053', U'\u0323', U'\u0073', U'\u0323', U'\u0053', U'\u0301', U'\u0307', U'\u0073', U'\u0301',
+        U'\u0307', U'\u0053', U'\u030C', U'\u0307', U'\u0073', U'\u030C', U'\u0307', U'\u0053', U'\u0323', U'\u0307', U'\u0073', U'\u0323', U'\u0307', U'\u0054', U'\u0307',
+        U'\u0074', U'\u0307', U'\u0054', U'\u0323', U'\u0074', U'\u0323', U'\u0054', U'\u0331', U'\u0074', U'\u0331', U'\u0054', U'\u032D', U'\u0074', U'\u032D', U'\u0055',
+        U'\u0324', U'\u0075', U'\u0324', U'\u0055', U'\u0330', U'\u0075', U'\u0330', U'\u0055', U'\u032D', U'\u0075', U'\u032D', U'\u0055', U'\u0303', U'\u0301', U'\u0075',
+        U'\u0303', U'\u0301', U'\u0055', U'\u0304', U'\u0308', U'\u0075', U'\u0304', U'\u0308', U'\u0056', U'\u0303', U'\u0076', U'\u0303', U'\u0056', U'\u0323', U'\u0076',
+        U'\u0323', U'\u0057', U'\u0300', U'\u0077', U'\u0300', U'\u0057', U'\u0301', U'\u0077', U'\u0301', U'\u0057', U'\u0308', U'\u0077', U'\u0308', U'\u0057', U'\u0307',
+        U'\u0077', U'\u0307', U'\u0057', U'\u0323', U'\u0077', U'\u0323', U'\u0058', U'\u0307', U'\u0078', U'\u0307', U'\u0058', U'\u0308', U'\u0078', U'\u0308', U'\u0059',
+        U'\u0307', U'\u0079', U'\u0307', U'\u005A', U'\u0302', U'\u007A', U'\u0302', U'\u005A', U'\u0323', U'\u007A', U'\u0323', U'\u005A', U'\u0331', U'\u007A', U'\u0331',
+        U'\u0068', U'\u0331', U'\u0074', U'\u0308', U'\u0077', U'\u030A', U'\u0079', U'\u030A', U'\u0061', U'\u02BE', U'\u017F', U'\u0307', U'\u0041', U'\u0323', U'\u0061',
+        U'\u0323', U'\u0041', U'\u0309', U'\u0061', U'\u0309', U'\u0041', U'\u0302', U'\u0301', U'\u0061', U'\u0302', U'\u0301', U'\u0041', U'\u0302', U'\u0300', U'\u0061',
+        U'\u0302', U'\u0300', U'\u0041', U'\u0302', U'\u0309', U'\u0061', U'\u0302', U'\u0309', U'\u0041', U'\u0302', U'\u0303', U'\u0061', U'\u0302', U'\u0303', U'\u0041',
+        U'\u0323', U'\u0302', U'\u0061', U'\u0323', U'\u0302', U'\u0041', U'\u0306', U'\u0301', U'\u0061', U'\u0306', U'\u0301', U'\u0041', U'\u0306', U'\u0300', U'\u0061',
+        U'\u0306', U'\u0300', U'\u0041', U'\u0306', U'\u0309', U'\u0061', U'\u0306', U'\u0309', U'\u0041', U'\u0306', U'\u0303', U'\u0061', U'\u0306', U'\u0303', U'\u0041',
+        U'\u0323', U'\u0306', U'\u0061', U'\u0323', U'\u0306', U'\u0045', U'\u0323', U'\u0065', U'\u0323', U'\u0045', U'\u0309', U'\u0065', U'\u0309', U'\u0045', U'\u0303',
+        U'\u0065', U'\u0303', U'\u0045', U'\u0302', U'\u0301', U'\u0065', U'\u0302', U'\u0301', U'\u0045', U'\u0302', U'\u0300', U'\u0065', U'\u0302', U'\u0300', U'\u0045',
+        U'\u0302', U'\u0309', U'\u0065', U'\u0302', U'\u0309', U'\u0045', U'\u0302', U'\u0303', U'\u0065', U'\u0302', U'\u0303', U'\u0045', U'\u0323', U'\u0302', U'\u0065',
+        U'\u0323', U'\u0302', U'\u0049', U'\u0309', U'\u0069', U'\u0309', U'\u0049', U'\u0323', U'\u0069', U'\u0323', U'\u004F', U'\u0323', U'\u006F', U'\u0323', U'\u004F',
+        U'\u0309', U'\u006F', U'\u0309', U'\u004F', U'\u0302', U'\u0301', U'\u006F', U'\u0302', U'\u0301', U'\u004F', U'\u0302', U'\u0300', U'\u006F', U'\u0302', U'\u0300',
+        U'\u004F', U'\u0302', U'\u0309', U'\u006F', U'\u0302', U'\u0309', U'\u004F', U'\u0302', U'\u0303', U'\u006F', U'\u0302', U'\u0303', U'\u004F', U'\u0323', U'\u0302',
+        U'\u006F', U'\u0323', U'\u0302', U'\u004F', U'\u031B', U'\u0301', U'\u006F', U'\u031B', U'\u0301', U'\u004F', U'\u031B', U'\u0300', U'\u006F', U'\u031B', U'\u0300',
+        U'\u004F', U'\u031B', U'\u0309', U'\u006F', U'\u031B', U'\u0309', U'\u004F', U'\u031B', U'\u0303', U'\u006F', U'\u031B', U'\u0303', U'\u004F', U'\u031B', U'\u0323',
+        U'\u006F', U'\u031B', U'\u0323', U'\u0055', U'\u0323', U'\u0075', U'\u0323', U'\u0055', U'\u0309', U'\u0075', U'\u0309', U'\u0055', U'\u031B', U'\u0301', U'\u0075',
+        U'\u031B', U'\u0301', U'\u0055', U'\u031B', U'\u0300', U'\u0075', U'\u031B', U'\u0300', U'\u0055', U'\u031B', U'\u0309', U'\u0075', U'\u031B', U'\u0309', U'\u0055',
+        U'\u031B', U'\u0303', U'\u0075', U'\u031B', U'\u0303', U'\u0055', U'\u031B', U'\u0323', U'\u0075', U'\u031B', U'\u0323', U'\u0059', U'\u0300', U'\u0079', U'\u0300',
+        U'\u0059', U'\u0323', U'\u0079', U'\u0323', U'\u0059', U'\u0309', U'\u0079', U'\u0309', U'\u0059', U'\u0303', U'\u0079', U'\u0303', U'\u03B1', U'\u0313', U'\u03B1',
+        U'\u0314', U'\u03B1', U'\u0313', U'\u0300', U'\u03B1', U'\u0314', U'\u0300', U'\u03B1', U'\u0313', U'\u0301', U'\u03B1', U'\u0314', U'\u0301', U'\u03B1', U'\u0313',
+        U'\u0342', U'\u03B1', U'\u0314', U'\u0342', U'\u0391', U'\u0313', U'\u0391', U'\u0314', U'\u0391', U'\u0313', U'\u0300', U'\u0391', U'\u0314', U'\u0300', U'\u0391',
+        U'\u0313', U'\u0301', U'\u0391', U'\u0314', U'\u0301', U'\u0391', U'\u0313', U'\u0342', U'\u0391', U'\u0314', U'\u0342', U'\u03B5', U'\u0313', U'\u03B5', U'\u0314',
+        U'\u03B5', U'\u0313', U'\u0300', U'\u03B5', U'\u0314', U'\u0300', U'\u03B5', U'\u0313', U'\u0301', U'\u03B5', U'\u0314', U'\u0301', U'\u0395', U'\u0313', U'\u0395',
+        U'\u0314', U'\u0395', U'\u0313', U'\u0300', U'\u0395', U'\u0314', U'\u0300', U'\u0395', U'\u0313', U'\u0301', U'\u0395', U'\u0314', U'\u0301', U'\u03B7', U'\u0313',
+        U'\u03B7', U'\u0314', U'\u03B7', U'\u0313', U'\u0300', U'\u03B7', U'\u0314', U'\u0300', U'\u03B7', U'\u0313', U'\u0301', U'\u03B7', U'\u0314', U'\u0301', U'\u03B7',
+        U'\u0313', U'\u0342', U'\u03B7', U'\u0314', U'\u0342', U'\u0397', U'\u0313', U'\u0397', U'\u0314', U'\u0397', U'\u0313', U'\u0300', U'\u0397', U'\u0314', U'\u0300',
+        U'\u0397', U'\u0313', U'\u0301', U'\u0397', U'\u0314', U'\u0301', U'\u0397', U'\u0313', U'\u0342', U'\u0397', U'\u0314', U'\u0342', U'\u03B9', U'\u0313', U'\u03B9',
+        U'\u0314', U'\u03B9', U'\u0313', U'\u0300', U'\u03B9', U'\u0314', U'\u0300', U'\u03B9', U'\u0313', U'\u0301', U'\u03B9', U'\u0314', U'\u0301', U'\u03B9', U'\u0313',
+        U'\u0342', U'\u03B9', U'\u0314', U'\u0342', U'\u0399', U'\u0313', U'\u0399', U'\u0314', U'\u0399', U'\u0313', U'\u0300', U'\u0399', U'\u0314', U'\u0300', U'\u0399',
+        U'\u0313', U'\u0301', U'\u0399', U'\u0314', U'\u0301', U'\u0399', U'\u0313', U'\u0342', U'\u0399', U'\u0314', U'\u0342', U'\u03BF', U'\u0313', U'\u03BF', U'\u0314',
+        U'\u03BF', U'\u0313', U'\u0300', U'\u03BF', U'\u0314', U'\u0300', U'\u03BF', U'\u0313', U'\u0301', U'\u03BF', U'\u0314', U'\u0301', U'\u039F', U'\u0313', U'\u039F',
+        U'\u0314', U'\u039F', U'\u0313', U'\u0300', U'\u039F', U'\u0314', U'\u0300', U'\u039F', U'\u0313', U'\u0301', U'\u039F', U'\u0314', U'\u0301', U'\u03C5', U'\u0313',
+        U'\u03C5', U'\u0314', U'\u03C5', U'\u0313', U'\u0300', U'\u03C5', U'\u0314', U'\u0300', U'\u03C5', U'\u0313', U'\u0301', U'\u03C5', U'\u0314', U'\u0301', U'\u03C5',
+        U'\u0313', U'\u0342', U'\u03C5', U'\u0314', U'\u0342', U'\u03A5', U'\u0314', U'\u03A5', U'\u0314', U'\u0300', U'\u03A5', U'\u0314', U'\u0301', U'\u03A5', U'\u0314',
+        U'\u0342', U'\u03C9', U'\u0313', U'\u03C9', U'\u0314', U'\u03C9', U'\u0313', U'\u0300', U'\u03C9', U'\u0314', U'\u0300', U'\u03C9', U'\u0313', U'\u0301', U'\u03C9',
+        U'\u0314', U'\u0301', U'\u03C9', U'\u0313', U'\u0342', U'\u03C9', U'\u0314', U'\u0342', U'\u03A9', U'\u0313', U'\u03A9', U'\u0314', U'\u03A9', U'\u0313', U'\u0300',
+        U'\u03A9', U'\u0314', U'\u0300', U'\u03A9', U'\u0313', U'\u0301', U'\u03A9', U'\u0314', U'\u0301', U'\u03A9', U'\u0313', U'\u0342', U'\u03A9', U'\u0314', U'\u0342',
+        U'\u03B1', U'\u0300', U'\u03B5', U'\u0300', U'\u03B7', U'\u0300', U'\u03B9', U'\u0300', U'\u03BF', U'\u0300', U'\u03C5', U'\u0300', U'\u03C9', U'\u0300', U'\u03B1',
+        U'\u0313', U'\u0345', U'\u03B1', U'\u0314', U'\u0345', U'\u03B1', U'\u0313', U'\u0300', U'\u0345', U'\u03B1', U'\u0314', U'\u0300', U'\u0345', U'\u03B1', U'\u0313',
+        U'\u0301', U'\u0345', U'\u03B1', U'\u0314', U'\u0301', U'\u0345', U'\u03B1', U'\u0313', U'\u0342', U'\u0345', U'\u03B1', U'\u0314', U'\u0342', U'\u0345', U'\u0391',
+        U'\u0313', U'\u0345', U'\u0391', U'\u0314', U'\u0345', U'\u0391', U'\u0313', U'\u0300', U'\u0345', U'\u0391', U'\u0314', U'\u0300', U'\u0345', U'\u0391', U'\u0313',
+        U'\u0301', U'\u0345', U'\u0391', U'\u0314', U'\u0301', U'\u0345', U'\u0391', U'\u0313', U'\u0342', U'\u0345', U'\u0391', U'\u0314', U'\u0342', U'\u0345', U'\u03B7',
+        U'\u0313', U'\u0345', U'\u03B7', U'\u0314', U'\u0345', U'\u03B7', U'\u0313', U'\u0300', U'\u0345', U'\u03B7', U'\u0314', U'\u0300', U'\u0345', U'\u03B7', U'\u0313',
+        U'\u0301', U'\u0345', U'\u03B7', U'\u0314', U'\u0301', U'\u0345', U'\u03B7', U'\u0313', U'\u0342', U'\u0345', U'\u03B7', U'\u0314', U'\u0342', U'\u0345', U'\u0397',
+        U'\u0313', U'\u0345', U'\u0397', U'\u0314', U'\u0345', U'\u0397', U'\u0313', U'\u0300', U'\u0345', U'\u0397', U'\u0314', U'\u0300', U'\u0345', U'\u0397', U'\u0313',
+        U'\u0301', U'\u0345', U'\u0397', U'\u0314', U'\u0301', U'\u0345', U'\u0397', U'\u0313', U'\u0342', U'\u0345', U'\u0397', U'\u0314', U'\u0342', U'\u0345', U'\u03C9',
+        U'\u0313', U'\u0345', U'\u03C9', U'\u0314', U'\u0345', U'\u03C9', U'\u0313', U'\u0300', U'\u0345', U'\u03C9', U'\u0314', U'\u0300', U'\u0345', U'\u03C9', U'\u0313',
+        U'\u0301', U'\u0345', U'\u03C9', U'\u0314', U'\u0301', U'\u0345', U'\u03C9', U'\u0313', U'\u0342', U'\u0345', U'\u03C9', U'\u0314', U'\u0342', U'\u0345', U'\u03A9',
+        U'\u0313', U'\u0345', U'\u03A9', U'\u0314', U'\u0345', U'\u03A9', U'\u0313', U'\u0300', U'\u0345', U'\u03A9', U'\u0314', U'\u0300', U'\u0345', U'\u03A9', U'\u0313',
+        U'\u0301', U'\u0345', U'\u03A9', U'\u0314', U'\u0301', U'\u0345', U'\u03A9', U'\u0313', U'\u0342', U'\u0345', U'\u03A9', U'\u0314', U'\u0342', U'\u0345', U'\u03B1',
+        U'\u0306', U'\u03B1', U'\u0304', U'\u03B1', U'\u0300', U'\u0345', U'\u03B1', U'\u0345', U'\u03B1', U'\u0301', U'\u0345', U'\u03B1', U'\u0342', U'\u03B1', U'\u0342',
+        U'\u0345', U'\u0391', U'\u0306', U'\u0391', U'\u0304', U'\u0391', U'\u0300', U'\u0391', U'\u0345', U'\u0020', U'\u0313', U'\u03B9', U'\u0020', U'\u0342', U'\u00A8',
+        U'\u0342', U'\u0020', U'\u0308', U'\u0342', U'\u03B7', U'\u0300', U'\u0345', U'\u03B7', U'\u0345', U'\u03B7', U'\u0301', U'\u0345', U'\u03B7', U'\u0342', U'\u03B7',
+        U'\u0342', U'\u0345', U'\u0395', U'\u0300', U'\u0397', U'\u0300', U'\u0397', U'\u0345', U'\u1FBF', U'\u0300', U'\u0020', U'\u0313', U'\u0300', U'\u1FBF', U'\u0301',
+        U'\u0020', U'\u0313', U'\u0301', U'\u1FBF', U'\u0342', U'\u0020', U'\u0313', U'\u0342', U'\u03B9', U'\u0306', U'\u03B9', U'\u0304', U'\u03B9', U'\u0308', U'\u0300',
+        U'\u03B9', U'\u0342', U'\u03B9', U'\u0308', U'\u0342', U'\u0399', U'\u0306', U'\u0399', U'\u0304', U'\u0399', U'\u0300', U'\u1FFE', U'\u0300', U'\u0020', U'\u0314',
+        U'\u0300', U'\u1FFE', U'\u0301', U'\u0020', U'\u0314', U'\u0301', U'\u1FFE', U'\u0342', U'\u0020', U'\u0314', U'\u0342', U'\u03C5', U'\u0306', U'\u03C5', U'\u0304',
+        U'\u03C5', U'\u0308', U'\u0300', U'\u03C1', U'\u0313', U'\u03C1', U'\u0314', U'\u03C5', U'\u0342', U'\u03C5', U'\u0308', U'\u0342', U'\u03A5', U'\u0306', U'\u03A5',
+        U'\u0304', U'\u03A5', U'\u0300', U'\u03A1', U'\u0314', U'\u00A8', U'\u0300', U'\u0020', U'\u0308', U'\u0300', U'\u0060', U'\u03C9', U'\u0300', U'\u0345', U'\u03C9',
+        U'\u0345', U'\u03C9', U'\u0301', U'\u0345', U'\u03C9', U'\u0342', U'\u03C9', U'\u0342', U'\u0345', U'\u039F', U'\u0300', U'\u03A9', U'\u0300', U'\u03A9', U'\u0345',
+        U'\u00B4', U'\u0020', U'\u0314', U'\u2002', U'\u2003', U'\u2010', U'\u0020', U'\u0333', U'\u002E', U'\u002E', U'\u002E', U'\u002E', U'\u002E', U'\u002E', U'\u2032',
+        U'\u2032', U'\u2032', U'\u2032', U'\u2032', U'\u2035', U'\u2035', U'\u2035', U'\u2035', U'\u2035', U'\u0021', U'\u0021', U'\u0020', U'\u0305', U'\u003F', U'\u003F',
+        U'\u003F', U'\u0021', U'\u0021', U'\u003F', U'\u2032', U'\u2032', U'\u2032', U'\u2032', U'\u0030', U'\u0034', U'\u0035', U'\u0036', U'\u0037', U'\u0038', U'\u0039',
+        U'\u002B', U'\u2212', U'\u003D', U'\u0028', U'\u0029', U'\u006E', U'\u0052', U'\u0073', U'\u0061', U'\u002F', U'\u0063', U'\u0061', U'\u002F', U'\u0073', U'\u0043',
+        U'\u00B0', U'\u0043', U'\u0063', U'\u002F', U'\u006F', U'\u0063', U'\u002F', U'\u0075', U'\u0190', U'\u00B0', U'\u0046', U'\u0127', U'\u004E', U'\u006F', U'\u0051',
+        U'\u0053', U'\u004D', U'\u0054', U'\u0045', U'\u004C', U'\u0054', U'\u004D', U'\u005A', U'\u03A9', U'\u0046', U'\u05D0', U'\u05D1', U'\u05D2', U'\u05D3', U'\u0046',
+        U'\u0041', U'\u0058', U'\u0393', U'\u03A0', U'\u2211', U'\u0031', U'\u2044', U'\u0037', U'\u0031', U'\u2044', U'\u0039', U'\u0031', U'\u2044', U'\u0031', U'\u0030',
+        U'\u0031', U'\u2044', U'\u0033', U'\u0032', U'\u2044', U'\u0033', U'\u0031', U'\u2044', U'\u0035', U'\u0032', U'\u2044', U'\u0035', U'\u0033', U'\u2044', U'\u0035',
+        U'\u0034', U'\u2044', U'\u0035', U'\u0031', U'\u2044', U'\u0036', U'\u0035', U'\u2044', U'\u0036', U'\u0031', U'\u2044', U'\u0038', U'\u0033', U'\u2044', U'\u0038',
+        U'\u0035', U'\u2044', U'\u0038', U'\u0037', U'\u2044', U'\u0038', U'\u0031', U'\u2044', U'\u0049', U'\u0049', U'\u0049', U'\u0049', U'\u0049', U'\u0049', U'\u0056',
+        U'\u0056', U'\u0056', U'\u0049', U'\u0056', U'\u0049', U'\u0049', U'\u0056', U'\u0049', U'\u0049', U'\u0049', U'\u0049', U'\u0058', U'\u0058', U'\u0058', U'\u0049',
+        U'\u0058', U'\u0049', U'\u0049', U'\u0069', U'\u0069', U'\u0069', U'\u0069', U'\u0069', U'\u0069', U'\u0076', U'\u0076', U'\u0069', U'\u0076', U'\u0069', U'\u0069',
+        U'\u0076', U'\u0069', U'\u0069', U'\u0069', U'\u0069', U'\u0078', U'\u0078', U'\u0069', U'\u0078', U'\u0069', U'\u0069', U'\u0030', U'\u2044', U'\u0033', U'\u2190',
+        U'\u0338', U'\u2192', U'\u0338', U'\u2194', U'\u0338', U'\u21D0', U'\u0338', U'\u21D4', U'\u0338', U'\u21D2', U'\u0338', U'\u2203', U'\u0338', U'\u2208', U'\u0338',
+        U'\u220B', U'\u0338', U'\u2223', U'\u0338', U'\u2225', U'\u0338', U'\u222B', U'\u222B', U'\u222B', U'\u222B', U'\u222B', U'\u222E', U'\u222E', U'\u222E', U'\u222E',
+        U'\u222E', U'\u223C', U'\u0338', U'\u2243', U'\u0338', U'\u2245', U'\u0338', U'\u2248', U'\u0338', U'\u003D', U'\u0338', U'\u2261', U'\u0338', U'\u224D', U'\u0338',
+        U'\u003C', U'\u0338', U'\u003E', U'\u0338', U'\u2264', U'\u0338', U'\u2265', U'\u0338', U'\u2272', U'\u0338', U'\u2273', U'\u0338', U'\u2276', U'\u0338', U'\u2277',
+        U'\u0338', U'\u227A', U'\u0338', U'\u227B', U'\u0338', U'\u2282', U'\u0338', U'\u2283', U'\u0338', U'\u2286', U'\u0338', U'\u2287', U'\u0338', U'\u22A2', U'\u0338',
+        U'\u22A8', U'\u0338', U'\u22A9', U'\u0338', U'\u22AB', U'\u0338', U'\u227C', U'\u0338', U'\u227D', U'\u0338', U'\u2291', U'\u0338', U'\u2292', U'\u0338', U'\u22B2',
+        U'\u0338', U'\u22B3', U'\u0338', U'\u22B4', U'\u0338', U'\u22B5', U'\u0338', U'\u3008', U'\u3009', U'\u0031', U'\u0030', U'\u0031', U'\u0031', U'\u0031', U'\u0032',
+        U'\u0031', U'\u0033', U'\u0031', U'\u0034', U'\u0031', U'\u0035', U'\u0031', U'\u0036', U'\u0031', U'\u0037', U'\u0031', U'\u0038', U'\u0031', U'\u0039', U'\u0032',
+        U'\u0030', U'\u0028', U'\u0031', U'\u0029', U'\u0028', U'\u0032', U'\u0029', U'\u0028', U'\u0033', U'\u0029', U'\u0028', U'\u0034', U'\u0029', U'\u0028', U'\u0035',
+        U'\u0029', U'\u0028', U'\u0036', U'\u0029', U'\u0028', U'\u0037', U'\u0029', U'\u0028', U'\u0038', U'\u0029', U'\u0028', U'\u0039', U'\u0029', U'\u0028', U'\u0031',
+        U'\u0030', U'\u0029', U'\u0028', U'\u0031', U'\u0031', U'\u0029', U'\u0028', U'\u0031', U'\u0032', U'\u0029', U'\u0028', U'\u0031', U'\u0033', U'\u0029', U'\u0028',
+        U'\u0031', U'\u0034', U'\u0029', U'\u0028', U'\u0031', U'\u0035', U'\u0029', U'\u0028', U'\u0031', U'\u0036', U'\u0029', U'\u0028', U'\u0031', U'\u0037', U'\u0029',
+        U'\u0028', U'\u0031', U'\u0038', U'\u0029', U'\u0028', U'\u0031', U'\u0039', U'\u0029', U'\u0028', U'\u0032', U'\u0030', U'\u0029', U'\u0031', U'\u002E', U'\u0032',
+        U'\u002E', U'\u0033', U'\u002E', U'\u0034', U'\u002E', U'\u0035', U'\u002E', U'\u0036', U'\u002E', U'\u0037', U'\u002E', U'\u0038', U'\u002E', U'\u0039', U'\u002E',
+        U'\u0031', U'\u0030', U'\u002E', U'\u0031', U'\u0031', U'\u002E', U'\u0031', U'\u0032', U'\u002E', U'\u0031', U'\u0033', U'\u002E', U'\u0031', U'\u0034', U'\u002E',
+        U'\u0031', U'\u0035', U'\u002E', U'\u0031', U'\u0036', U'\u002E', U'\u0031', U'\u0037', U'\u002E', U'\u0031', U'\u0038', U'\u002E', U'\u0031', U'\u0039', U'\u002E',
+        U'\u0032', U'\u0030', U'\u002E', U'\u0028', U'\u0061', U'\u0029', U'\u0028', U'\u0062', U'\u0029', U'\u0028', U'\u0063', U'\u0029', U'\u0028', U'\u0064', U'\u0029',
+        U'\u0028', U'\u0065', U'\u0029', U'\u0028', U'\u0066', U'\u0029', U'\u0028', U'\u0067', U'\u0029', U'\u0028', U'\u0068', U'\u0029', U'\u0028', U'\u0069', U'\u0029',
+        U'\u0028', U'\u006A', U'\u0029', U'\u0028', U'\u006B', U'\u0029', U'\u0028', U'\u006C', U'\u0029', U'\u0028', U'\u006D', U'\u0029', U'\u0028', U'\u006E', U'\u0029',
+        U'\u0028', U'\u006F', U'\u0029', U'\u0028', U'\u0070', U'\u0029', U'\u0028', U'\u0071', U'\u0029', U'\u0028', U'\u0072', U'\u0029', U'\u0028', U'\u0073', U'\u0029',
+        U'\u0028', U'\u0074', U'\u0029', U'\u0028', U'\u0075', U'\u0029', U'\u0028', U'\u0076', U'\u0029', U'\u0028', U'\u0077', U'\u0029', U'\u0028', U'\u0078', U'\u0029',
+        U'\u0028', U'\u0079', U'\u0029', U'\u0028', U'\u007A', U'\u0029', U'\u0053', U'\u0059', U'\u0071', U'\u222B', U'\u222B', U'\u222B', U'\u222B', U'\u003A', U'\u003A',
+        U'\u003D', U'\u003D', U'\u003D', U'\u003D', U'\u003D', U'\u003D', U'\u2ADD', U'\u0338', U'\u2D61', U'\u6BCD', U'\u9F9F', U'\u4E00', U'\u4E28', U'\u4E36', U'\u4E3F',
+        U'\u4E59', U'\u4E85', U'\u4E8C', U'\u4EA0', U'\u4EBA', U'\u513F', U'\u5165', U'\u516B', U'\u5182', U'\u5196', U'\u51AB', U'\u51E0', U'\u51F5', U'\u5200', U'\u529B',
+        U'\u52F9', U'\u5315', U'\u531A', U'\u5338', U'\u5341', U'\u535C', U'\u5369', U'\u5382', U'\u53B6', U'\u53C8', U'\u53E3', U'\u56D7', U'\u571F', U'\u58EB', U'\u5902',
+        U'\u590A', U'\u5915', U'\u5927', U'\u5973', U'\u5B50', U'\u5B80', U'\u5BF8', U'\u5C0F', U'\u5C22', U'\u5C38', U'\u5C6E', U'\u5C71', U'\u5DDB', U'\u5DE5', U'\u5DF1',
+        U'\u5DFE', U'\u5E72', U'\u5E7A', U'\u5E7F', U'\u5EF4', U'\u5EFE', U'\u5F0B', U'\u5F13', U'\u5F50', U'\u5F61', U'\u5F73', U'\u5FC3', U'\u6208', U'\u6236', U'\u624B',
+        U'\u652F', U'\u6534', U'\u6587', U'\u6597', U'\u65A4', U'\u65B9', U'\u65E0', U'\u65E5', U'\u66F0', U'\u6708', U'\u6728', U'\u6B20', U'\u6B62', U'\u6B79', U'\u6BB3',
+        U'\u6BCB', U'\u6BD4', U'\u6BDB', U'\u6C0F', U'\u6C14', U'\u6C34', U'\u706B', U'\u722A', U'\u7236', U'\u723B', U'\u723F', U'\u7247', U'\u7259', U'\u725B', U'\u72AC',
+        U'\u7384', U'\u7389', U'\u74DC', U'\u74E6', U'\u7518', U'\u751F', U'\u7528', U'\u7530', U'\u758B', U'\u7592', U'\u7676', U'\u767D', U'\u76AE', U'\u76BF', U'\u76EE',
+        U'\u77DB', U'\u77E2', U'\u77F3', U'\u793A', U'\u79B8', U'\u79BE', U'\u7A74', U'\u7ACB', U'\u7AF9', U'\u7C73', U'\u7CF8', U'\u7F36', U'\u7F51', U'\u7F8A', U'\u7FBD',
+        U'\u8001', U'\u800C', U'\u8012', U'\u8033', U'\u807F', U'\u8089', U'\u81E3', U'\u81EA', U'\u81F3', U'\u81FC', U'\u820C', U'\u821B', U'\u821F', U'\u826E', U'\u8272',
+        U'\u8278', U'\u864D', U'\u866B', U'\u8840', U'\u884C', U'\u8863', U'\u897E', U'\u898B', U'\u89D2', U'\u8A00', U'\u8C37', U'\u8C46', U'\u8C55', U'\u8C78', U'\u8C9D',
+        U'\u8D64', U'\u8D70', U'\u8DB3', U'\u8EAB', U'\u8ECA', U'\u8F9B', U'\u8FB0', U'\u8FB5', U'\u9091', U'\u9149', U'\u91C6', U'\u91CC', U'\u91D1', U'\u9577', U'\u9580',
+        U'\u961C', U'\u96B6', U'\u96B9', U'\u96E8', U'\u9751', U'\u975E', U'\u9762', U'\u9769', U'\u97CB', U'\u97ED', U'\u97F3', U'\u9801', U'\u98A8', U'\u98DB', U'\u98DF',
+        U'\u9996', U'\u9999', U'\u99AC', U'\u9AA8', U'\u9AD8', U'\u9ADF', U'\u9B25', U'\u9B2F', U'\u9B32', U'\u9B3C', U'\u9B5A', U'\u9CE5', U'\u9E75', U'\u9E7F', U'\u9EA5',
+        U'\u9EBB', U'\u9EC3', U'\u9ECD', U'\u9ED1', U'\u9EF9', U'\u9EFD', U'\u9F0E', U'\u9F13', U'\u9F20', U'\u9F3B', U'\u9F4A', U'\u9F52', U'\u9F8D', U'\u9F9C', U'\u9FA0',
+        U'\u3012', U'\u5344', U'\u5345', U'\u304B', U'\u3099', U'\u304D', U'\u3099', U'\u304F', U'\u3099', U'\u3051', U'\u3099', U'\u3053', U'\u3099', U'\u3055', U'\u3099',
+        U'\u3057', U'\u3099', U'\u3059', U'\u3099', U'\u305B', U'\u3099', U'\u305D', U'\u3099', U'\u305F', U'\u3099', U'\u3061', U'\u3099', U'\u3064', U'\u3099', U'\u3066',
+        U'\u3099', U'\u3068', U'\u3099', U'\u306F', U'\u3099', U'\u306F', U'\u309A', U'\u3072', U'\u3099', U'\u3072', U'\u309A', U'\u3075', U'\u3099', U'\u3075', U'\u309A',
+        U'\u3078', U'\u3099', U'\u3078', U'\u309A', U'\u307B', U'\u3099', U'\u307B', U'\u309A', U'\u3046', U'\u3099', U'\u0020', U'\u3099', U'\u0020', U'\u309A', U'\u309D',
+        U'\u3099', U'\u3088', U'\u308A', U'\u30AB', U'\u3099', U'\u30AD', U'\u3099', U'\u30AF', U'\u3099', U'\u30B1', U'\u3099', U'\u30B3', U'\u3099', U'\u30B5', U'\u3099',
+        U'\u30B7', U'\u3099', U'\u30B9', U'\u3099', U'\u30BB', U'\u3099', U'\u30BD', U'\u3099', U'\u30BF', U'\u3099', U'\u30C1', U'\u3099', U'\u30C4', U'\u3099', U'\u30C6',
+        U'\u3099', U'\u30C8', U'\u3099', U'\u30CF', U'\u3099', U'\u30CF', U'\u309A', U'\u30D2', U'\u3099', U'\u30D2', U'\u309A', U'\u30D5', U'\u3099', U'\u30D5', U'\u309A',
+        U'\u30D8', U'\u3099', U'\u30D8', U'\u309A', U'\u30DB', U'\u3099', U'\u30DB', U'\u309A', U'\u30A6', U'\u3099', U'\u30EF', U'\u3099', U'\u30F0', U'\u3099', U'\u30F1',
+        U'\u3099', U'\u30F2', U'\u3099', U'\u30FD', U'\u3099', U'\u30B3', U'\u30C8', U'\u1100', U'\u1101', U'\u11AA', U'\u1102', U'\u11AC', U'\u11AD', U'\u1103', U'\u1104',
+        U'\u1105', U'\u11B0', U'\u11B1', U'\u11B2', U'\u11B3', U'\u11B4', U'\u11B5', U'\u111A', U'\u1106', U'\u1107', U'\u1108', U'\u1121', U'\u1109', U'\u110A', U'\u110B',
+        U'\u110C', U'\u110D', U'\u110E', U'\u110F', U'\u1110', U'\u1111', U'\u1112', U'\u1161', U'\u1162', U'\u1163', U'\u1164', U'\u1165', U'\u1166', U'\u1167', U'\u1168',
+        U'\u1169', U'\u116A', U'\u116B', U'\u116C', U'\u116D', U'\u116E', U'\u116F', U'\u1170', U'\u1171', U'\u1172', U'\u1173', U'\u1174', U'\u1175', U'\u1160', U'\u1114',
+        U'\u1115', U'\u11C7', U'\u11C8', U'\u11CC', U'\u11CE', U'\u11D3', U'\u11D7', U'\u11D9', U'\u111C', U'\u11DD', U'\u11DF', U'\u111D', U'\u111E', U'\u1120', U'\u1122',
+        U'\u1123', U'\u1127', U'\u1129', U'\u112B', U'\u112C', U'\u112D', U'\u112E', U'\u112F', U'\u1132', U'\u1136', U'\u1140', U'\u1147', U'\u114C', U'\u11F1', U'\u11F2',
+        U'\u1157', U'\u1158', U'\u1159', U'\u1184', U'\u1185', U'\u1188', U'\u1191', U'\u1192', U'\u1194', U'\u119E', U'\u11A1', U'\u4E09', U'\u56DB', U'\u4E0A', U'\u4E2D',
+        U'\u4E0B', U'\u7532', U'\u4E19', U'\u4E01', U'\u5929', U'\u5730', U'\u0028', U'\u1100', U'\u0029', U'\u0028', U'\u1102', U'\u0029', U'\u0028', U'\u1103', U'\u0029',
+        U'\u0028', U'\u1105', U'\u0029', U'\u0028', U'\u1106', U'\u0029', U'\u0028', U'\u1107', U'\u0029', U'\u0028', U'\u1109', U'\u0029', U'\u0028', U'\u110B', U'\u0029',
+        U'\u0028', U'\u110C', U'\u0029', U'\u0028', U'\u110E', U'\u0029', U'\u0028', U'\u110F', U'\u0029', U'\u0028', U'\u1110', U'\u0029', U'\u0028', U'\u1111', U'\u0029',
+        U'\u0028', U'\u1112', U'\u0029', U'\u0028', U'\u1100', U'\u1161', U'\u0029', U'\u0028', U'\u1102', U'\u1161', U'\u0029', U'\u0028', U'\u1103', U'\u1161', U'\u0029',
+        U'\u0028', U'\u1105', U'\u1161', U'\u0029', U'\u0028', U'\u1106', U'\u1161', U'\u0029', U'\u0028', U'\u1107', U'\u1161', U'\u0029', U'\u0028', U'\u1109', U'\u1161',
+        U'\u0029', U'\u0028', U'\u110B', U'\u1161', U'\u0029', U'\u0028', U'\u110C', U'\u1161', U'\u0029', U'\u0028', U'\u110E', U'\u1161', U'\u0029', U'\u0028', U'\u110F',
+        U'\u1161', U'\u0029', U'\u0028', U'\u1110', U'\u1161', U'\u0029', U'\u0028', U'\u1111', U'\u1161', U'\u0029', U'\u0028', U'\u1112', U'\u1161', U'\u0029', U'\u0028',
+        U'\u110C', U'\u116E', U'\u0029', U'\u0028', U'\u110B', U'\u1169', U'\u110C', U'\u1165', U'\u11AB', U'\u0029', U'\u0028', U'\u110B', U'\u1169', U'\u1112', U'\u116E',
+        U'\u0029', U'\u0028', U'\u4E00', U'\u0029', U'\u0028', U'\u4E8C', U'\u0029', U'\u0028', U'\u4E09', U'\u0029', U'\u0028', U'\u56DB', U'\u0029', U'\u0028', U'\u4E94',
+        U'\u0029', U'\u0028', U'\u516D', U'\u0029', U'\u0028', U'\u4E03', U'\u0029', U'\u0028', U'\u516B', U'\u0029', U'\u0028', U'\u4E5D', U'\u0029', U'\u0028', U'\u5341',
+        U'\u0029', U'\u0028', U'\u6708', U'\u0029', U'\u0028', U'\u706B', U'\u0029', U'\u0028', U'\u6C34', U'\u0029', U'\u0028', U'\u6728', U'\u0029', U'\u0028', U'\u91D1',
+        U'\u0029', U'\u0028', U'\u571F', U'\u0029', U'\u0028', U'\u65E5', U'\u0029', U'\u0028', U'\u682A', U'\u0029', U'\u0028', U'\u6709', U'\u0029', U'\u0028', U'\u793E',
+        U'\u0029', U'\u0028', U'\u540D', U'\u0029', U'\u0028', U'\u7279', U'\u0029', U'\u0028', U'\u8CA1', U'\u0029', U'\u0028', U'\u795D', U'\u0029', U'\u0028', U'\u52B4',
+        U'\u0029', U'\u0028', U'\u4EE3', U'\u0029', U'\u0028', U'\u547C', U'\u0029', U'\u0028', U'\u5B66', U'\u0029', U'\u0028', U'\u76E3', U'\u0029', U'\u0028', U'\u4F01',
+        U'\u0029', U'\u0028', U'\u8CC7', U'\u0029', U'\u0028', U'\u5354', U'\u0029', U'\u0028', U'\u796D', U'\u0029', U'\u0028', U'\u4F11', U'\u0029', U'\u0028', U'\u81EA',
+        U'\u0029', U'\u0028', U'\u81F3', U'\u0029', U'\u554F', U'\u5E7C', U'\u7B8F', U'\u0050', U'\u0054', U'\u0045', U'\u0032', U'\u0031', U'\u0032', U'\u0032', U'\u0032',
+        U'\u0033', U'\u0032', U'\u0034', U'\u0032', U'\u0035', U'\u0032', U'\u0036', U'\u0032', U'\u0037', U'\u0032', U'\u0038', U'\u0032', U'\u0039', U'\u0033', U'\u0030',
+        U'\u0033', U'\u0031', U'\u0033', U'\u0032', U'\u0033', U'\u0033', U'\u0033', U'\u0034', U'\u0033', U'\u0035', U'\u1100', U'\u1161', U'\u1102', U'\u1161', U'\u1103',
+        U'\u1161', U'\u1105', U'\u1161', U'\u1106', U'\u1161', U'\u1107', U'\u1161', U'\u1109', U'\u1161', U'\u110B', U'\u1161', U'\u110C', U'\u1161', U'\u110E', U'\u1161',
+        U'\u110F', U'\u1161', U'\u1110', U'\u1161', U'\u1111', U'\u1161', U'\u1112', U'\u1161', U'\u110E', U'\u1161', U'\u11B7', U'\u1100', U'\u1169', U'\u110C', U'\u116E',
+        U'\u110B', U'\u1174', U'\u110B', U'\u116E', U'\u4E94', U'\u516D', U'\u4E03', U'\u4E5D', U'\u682A', U'\u6709', U'\u793E', U'\u540D', U'\u7279', U'\u8CA1', U'\u795D',
+        U'\u52B4', U'\u79D8', U'\u7537', U'\u9069', U'\u512A', U'\u5370', U'\u6CE8', U'\u9805', U'\u4F11', U'\u5199', U'\u6B63', U'\u5DE6', U'\u53F3', U'\u533B', U'\u5B97',
+        U'\u5B66', U'\u76E3', U'\u4F01', U'\u8CC7', U'\u5354', U'\u591C', U'\u0033', U'\u0036', U'\u0033', U'\u0037', U'\u0033', U'\u0038', U'\u0033', U'\u0039', U'\u0034',
+        U'\u0030', U'\u0034', U'\u0031', U'\u0034', U'\u0032', U'\u0034', U'\u0033', U'\u0034', U'\u0034', U'\u0034', U'\u0035', U'\u0034', U'\u0036', U'\u0034', U'\u0037',
+        U'\u0034', U'\u0038', U'\u0034', U'\u0039', U'\u0035', U'\u0030', U'\u0031', U'\u6708', U'\u0032', U'\u6708', U'\u0033', U'\u6708', U'\u0034', U'\u6708', U'\u0035',
+        U'\u6708', U'\u0036', U'\u6708', U'\u0037', U'\u6708', U'\u0038', U'\u6708', U'\u0039', U'\u6708', U'\u0031', U'\u0030', U'\u6708', U'\u0031', U'\u0031', U'\u6708',
+        U'\u0031', U'\u0032', U'\u6708', U'\u0048', U'\u0067', U'\u0065', U'\u0072', U'\u0067', U'\u0065', U'\u0056', U'\u004C', U'\u0054', U'\u0044', U'\u30A2', U'\u30A4',
+        U'\u30A6', U'\u30A8', U'\u30AA', U'\u30AB', U'\u30AD', U'\u30AF', U'\u30B1', U'\u30B3', U'\u30B5', U'\u30B7', U'\u30B9', U'\u30BB', U'\u30BD', U'\u30BF', U'\u30C1',
+        U'\u30C4', U'\u30C6', U'\u30C8', U'\u30CA', U'\u30CB', U'\u30CC', U'\u30CD', U'\u30CE', U'\u30CF', U'\u30D2', U'\u30D5', U'\u30D8', U'\u30DB', U'\u30DE', U'\u30DF',
+        U'\u30E0', U'\u30E1', U'\u30E2', U'\u30E4', U'\u30E6', U'\u30E8', U'\u30E9', U'\u30EA', U'\u30EB', U'\u30EC', U'\u30ED', U'\u30EF', U'\u30F0', U'\u30F1', U'\u30F2',
+        U'\u4EE4', U'\u548C', U'\u30A2', U'\u30CF', U'\u309A', U'\u30FC', U'\u30C8', U'\u30A2', U'\u30EB', U'\u30D5', U'\u30A1', U'\u30A2', U'\u30F3', U'\u30D8', U'\u309A',
+        U'\u30A2', U'\u30A2', U'\u30FC', U'\u30EB', U'\u30A4', U'\u30CB', U'\u30F3', U'\u30AF', U'\u3099', U'\u30A4', U'\u30F3', U'\u30C1', U'\u30A6', U'\u30A9', U'\u30F3',
+        U'\u30A8', U'\u30B9', U'\u30AF', U'\u30FC', U'\u30C8', U'\u3099', U'\u30A8', U'\u30FC', U'\u30AB', U'\u30FC', U'\u30AA', U'\u30F3', U'\u30B9', U'\u30AA', U'\u30FC',
+        U'\u30E0', U'\u30AB', U'\u30A4', U'\u30EA', U'\u30AB', U'\u30E9', U'\u30C3', U'\u30C8', U'\u30AB', U'\u30ED', U'\u30EA', U'\u30FC', U'\u30AB', U'\u3099', U'\u30ED',
+        U'\u30F3', U'\u30AB', U'\u3099', U'\u30F3', U'\u30DE', U'\u30AD', U'\u3099', U'\u30AB', U'\u3099', U'\u30AD', U'\u3099', U'\u30CB', U'\u30FC', U'\u30AD', U'\u30E5',
+        U'\u30EA', U'\u30FC', U'\u30AD', U'\u3099', U'\u30EB', U'\u30BF', U'\u3099', U'\u30FC', U'\u30AD', U'\u30ED', U'\u30AD', U'\u30ED', U'\u30AF', U'\u3099', U'\u30E9',
+        U'\u30E0', U'\u30AD', U'\u30ED', U'\u30E1', U'\u30FC', U'\u30C8', U'\u30EB', U'\u30AD', U'\u30ED', U'\u30EF', U'\u30C3', U'\u30C8', U'\u30AF', U'\u3099', U'\u30E9',
+        U'\u30E0', U'\u30AF', U'\u3099', U'\u30E9', U'\u30E0', U'\u30C8', U'\u30F3', U'\u30AF', U'\u30EB', U'\u30BB', U'\u3099', U'\u30A4', U'\u30ED', U'\u30AF', U'\u30ED',
+        U'\u30FC', U'\u30CD', U'\u30B1', U'\u30FC', U'\u30B9', U'\u30B3', U'\u30EB', U'\u30CA', U'\u30B3', U'\u30FC', U'\u30DB', U'\u309A', U'\u30B5', U'\u30A4', U'\u30AF',
+        U'\u30EB', U'\u30B5', U'\u30F3', U'\u30C1', U'\u30FC', U'\u30E0', U'\u30B7', U'\u30EA', U'\u30F3', U'\u30AF', U'\u3099', U'\u30BB', U'\u30F3', U'\u30C1', U'\u30BB',
+        U'\u30F3', U'\u30C8', U'\u30BF', U'\u3099', U'\u30FC', U'\u30B9', U'\u30C6', U'\u3099', U'\u30B7', U'\u30C8', U'\u3099', U'\u30EB', U'\u30C8', U'\u30F3', U'\u30CA',
+        U'\u30CE', U'\u30CE', U'\u30C3', U'\u30C8', U'\u30CF', U'\u30A4', U'\u30C4', U'\u30CF', U'\u309A', U'\u30FC', U'\u30BB', U'\u30F3', U'\u30C8', U'\u30CF', U'\u309A',
+        U'\u30FC', U'\u30C4', U'\u30CF', U'\u3099', U'\u30FC', U'\u30EC', U'\u30EB', U'\u30D2', U'\u309A', U'\u30A2', U'\u30B9', U'\u30C8', U'\u30EB', U'\u30D2', U'\u309A',
+        U'\u30AF', U'\u30EB', U'\u30D2', U'\u309A', U'\u30B3', U'\u30D2', U'\u3099', U'\u30EB', U'\u30D5', U'\u30A1', U'\u30E9', U'\u30C3', U'\u30C8', U'\u3099', U'\u30D5',
+        U'\u30A3', U'\u30FC', U'\u30C8', U'\u30D5', U'\u3099', U'\u30C3', U'\u30B7', U'\u30A7', U'\u30EB', U'\u30D5', U'\u30E9', U'\u30F3', U'\u30D8', U'\u30AF', U'\u30BF',
+        U'\u30FC', U'\u30EB', U'\u30D8', U'\u309A', U'\u30BD', U'\u30D8', U'\u309A', U'\u30CB', U'\u30D2', U'\u30D8', U'\u30EB', U'\u30C4', U'\u30D8', U'\u309A', U'\u30F3',
+        U'\u30B9', U'\u30D8', U'\u309A', U'\u30FC', U'\u30B7', U'\u3099', U'\u30D8', U'\u3099', U'\u30FC', U'\u30BF', U'\u30DB', U'\u309A', U'\u30A4', U'\u30F3', U'\u30C8',
+        U'\u30DB', U'\u3099', U'\u30EB', U'\u30C8', U'\u30DB', U'\u30F3', U'\u30DB', U'\u309A', U'\u30F3', U'\u30C8', U'\u3099', U'\u30DB', U'\u30FC', U'\u30EB', U'\u30DB',
+        U'\u30FC', U'\u30F3', U'\u30DE', U'\u30A4', U'\u30AF', U'\u30ED', U'\u30DE', U'\u30A4', U'\u30EB', U'\u30DE', U'\u30C3', U'\u30CF', U'\u30DE', U'\u30EB', U'\u30AF',
+        U'\u30DE', U'\u30F3', U'\u30B7', U'\u30E7', U'\u30F3', U'\u30DF', U'\u30AF', U'\u30ED', U'\u30F3', U'\u30DF', U'\u30EA', U'\u30DF', U'\u30EA', U'\u30CF', U'\u3099',
+        U'\u30FC', U'\u30EB', U'\u30E1', U'\u30AB', U'\u3099', U'\u30E1', U'\u30AB', U'\u3099', U'\u30C8', U'\u30F3', U'\u30E1', U'\u30FC', U'\u30C8', U'\u30EB', U'\u30E4',
+        U'\u30FC', U'\u30C8', U'\u3099', U'\u30E4', U'\u30FC', U'\u30EB', U'\u30E6', U'\u30A2', U'\u30F3', U'\u30EA', U'\u30C3', U'\u30C8', U'\u30EB', U'\u30EA', U'\u30E9',
+        U'\u30EB', U'\u30D2', U'\u309A', U'\u30FC', U'\u30EB', U'\u30FC', U'\u30D5', U'\u3099', U'\u30EB', U'\u30EC', U'\u30E0', U'\u30EC', U'\u30F3', U'\u30C8', U'\u30B1',
+        U'\u3099', U'\u30F3', U'\u30EF', U'\u30C3', U'\u30C8', U'\u0030', U'\u70B9', U'\u0031', U'\u70B9', U'\u0032', U'\u70B9', U'\u0033', U'\u70B9', U'\u0034', U'\u70B9',
+        U'\u0035', U'\u70B9', U'\u0036', U'\u70B9', U'\u0037', U'\u70B9', U'\u0038', U'\u70B9', U'\u0039', U'\u70B9', U'\u0031', U'\u0030', U'\u70B9', U'\u0031', U'\u0031',
+        U'\u70B9', U'\u0031', U'\u0032', U'\u70B9', U'\u0031', U'\u0033', U'\u70B9', U'\u0031', U'\u0034', U'\u70B9', U'\u0031', U'\u0035', U'\u70B9', U'\u0031', U'\u0036',
+        U'\u70B9', U'\u0031', U'\u0037', U'\u70B9', U'\u0031', U'\u0038', U'\u70B9', U'\u0031', U'\u0039', U'\u70B9', U'\u0032', U'\u0030', U'\u70B9', U'\u0032', U'\u0031',
+        U'\u70B9', U'\u0032', U'\u0032', U'\u70B9', U'\u0032', U'\u0033', U'\u70B9', U'\u0032', U'\u0034', U'\u70B9', U'\u0068', U'\u0050', U'\u0061', U'\u0064', U'\u0061',
+        U'\u0041', U'\u0055', U'\u0062', U'\u0061', U'\u0072', U'\u006F', U'\u0056', U'\u0070', U'\u0063', U'\u0064', U'\u006D', U'\u0064', U'\u006D', U'\u0032', U'\u0064',
+        U'\u006D', U'\u0033', U'\u0049', U'\u0055', U'\u5E73', U'\u6210', U'\u662D', U'\u548C', U'\u5927', U'\u6B63', U'\u660E', U'\u6CBB', U'\u682A', U'\u5F0F', U'\u4F1A',
+        U'\u793E', U'\u0070', U'\u0041', U'\u006E', U'\u0041', U'\u03BC', U'\u0041', U'\u006D', U'\u0041', U'\u006B', U'\u0041', U'\u004B', U'\u0042', U'\u004D', U'\u0042',
+        U'\u0047', U'\u0042', U'\u0063', U'\u0061', U'\u006C', U'\u006B', U'\u0063', U'\u0061', U'\u006C', U'\u0070', U'\u0046', U'\u006E', U'\u0046', U'\u03BC', U'\u0046',
+        U'\u03BC', U'\u0067', U'\u006D', U'\u0067', U'\u006B', U'\u0067', U'\u0048', U'\u007A', U'\u006B', U'\u0048', U'\u007A', U'\u004D', U'\u0048', U'\u007A', U'\u0047',
+        U'\u0048', U'\u007A', U'\u0054', U'\u0048', U'\u007A', U'\u03BC', U'\u006C', U'\u006D', U'\u006C', U'\u0064', U'\u006C', U'\u006B', U'\u006C', U'\u0066', U'\u006D',
+        U'\u006E', U'\u006D', U'\u03BC', U'\u006D', U'\u006D', U'\u006D', U'\u0063', U'\u006D', U'\u006B', U'\u006D', U'\u006D', U'\u006D', U'\u0032', U'\u0063', U'\u006D',
+        U'\u0032', U'\u006D', U'\u0032', U'\u006B', U'\u006D', U'\u0032', U'\u006D', U'\u006D', U'\u0033', U'\u0063', U'\u006D', U'\u0033', U'\u006D', U'\u0033', U'\u006B',
+        U'\u006D', U'\u0033', U'\u006D', U'\u2215', U'\u0073', U'\u006D', U'\u2215', U'\u0073', U'\u0032', U'\u0050', U'\u0061', U'\u006B', U'\u0050', U'\u0061', U'\u004D',
+        U'\u0050', U'\u0061', U'\u0047', U'\u0050', U'\u0061', U'\u0072', U'\u0061', U'\u0064', U'\u0072', U'\u0061', U'\u0064', U'\u2215', U'\u0073', U'\u0072', U'\u0061',
+        U'\u0064', U'\u2215', U'\u0073', U'\u0032', U'\u0070', U'\u0073', U'\u006E', U'\u0073', U'\u03BC', U'\u0073', U'\u006D', U'\u0073', U'\u0070', U'\u0056', U'\u006E',
+        U'\u0056', U'\u03BC', U'\u0056', U'\u006D', U'\u0056', U'\u006B', U'\u0056', U'\u004D', U'\u0056', U'\u0070', U'\u0057', U'\u006E', U'\u0057', U'\u03BC', U'\u0057',
+        U'\u006D', U'\u0057', U'\u006B', U'\u0057', U'\u004D', U'\u0057', U'\u006B', U'\u03A9', U'\u004D', U'\u03A9', U'\u0061', U'\u002E', U'\u006D', U'\u002E', U'\u0042',
+        U'\u0071', U'\u0063', U'\u0063', U'\u0063', U'\u0064', U'\u0043', U'\u2215', U'\u006B', U'\u0067', U'\u0043', U'\u006F', U'\u002E', U'\u0064', U'\u0042', U'\u0047',
+        U'\u0079', U'\u0068', U'\u0061', U'\u0048', U'\u0050', U'\u0069', U'\u006E', U'\u004B', U'\u004B', U'\u004B', U'\u004D', U'\u006B', U'\u0074', U'\u006C', U'\u006D',
+        U'\u006C', U'\u006E', U'\u006C', U'\u006F', U'\u0067', U'\u006C', U'\u0078', U'\u006D', U'\u0062', U'\u006D', U'\u0069', U'\u006C', U'\u006D', U'\u006F', U'\u006C',
+        U'\u0050', U'\u0048', U'\u0070', U'\u002E', U'\u006D', U'\u002E', U'\u0050', U'\u0050', U'\u004D', U'\u0050', U'\u0052', U'\u0073', U'\u0072', U'\u0053', U'\u0076',
+        U'\u0057', U'\u0062', U'\u0056', U'\u2215', U'\u006D', U'\u0041', U'\u2215', U'\u006D', U'\u0031', U'\u65E5', U'\u0032', U'\u65E5', U'\u0033', U'\u65E5', U'\u0034',
+        U'\u65E5', U'\u0035', U'\u65E5', U'\u0036', U'\u65E5', U'\u0037', U'\u65E5', U'\u0038', U'\u65E5', U'\u0039', U'\u65E5', U'\u0031', U'\u0030', U'\u65E5', U'\u0031',
+        U'\u0031', U'\u65E5', U'\u0031', U'\u0032', U'\u65E5', U'\u0031', U'\u0033', U'\u65E5', U'\u0031', U'\u0034', U'\u65E5', U'\u0031', U'\u0035', U'\u65E5', U'\u0031',
+        U'\u0036', U'\u65E5', U'\u0031', U'\u0037', U'\u65E5', U'\u0031', U'\u0038', U'\u65E5', U'\u0031', U'\u0039', U'\u65E5', U'\u0032', U'\u0030', U'\u65E5', U'\u0032',
+        U'\u0031', U'\u65E5', U'\u0032', U'\u0032', U'\u65E5', U'\u0032', U'\u0033', U'\u65E5', U'\u0032', U'\u0034', U'\u65E5', U'\u0032', U'\u0035', U'\u65E5', U'\u0032',
+        U'\u0036', U'\u65E5', U'\u0032', U'\u0037', U'\u65E5', U'\u0032', U'\u0038', U'\u65E5', U'\u0032', U'\u0039', U'\u65E5', U'\u0033', U'\u0030', U'\u65E5', U'\u0033',
+        U'\u0031', U'\u65E5', U'\u0067', U'\u0061', U'\u006C', U'\u044A', U'\u044C', U'\uA76F', U'\u0126', U'\u0153', U'\uA727', U'\uAB37', U'\u026B', U'\uAB52', U'\u028D',
+        U'\u8C48', U'\u66F4', U'\u8CC8', U'\u6ED1', U'\u4E32', U'\u53E5', U'\u5951', U'\u5587', U'\u5948', U'\u61F6', U'\u7669', U'\u7F85', U'\u863F', U'\u87BA', U'\u88F8',
+        U'\u908F', U'\u6A02', U'\u6D1B', U'\u70D9', U'\u73DE', U'\u843D', U'\u916A', U'\u99F1', U'\u4E82', U'\u5375', U'\u6B04', U'\u721B', U'\u862D', U'\u9E1E', U'\u5D50',
+        U'\u6FEB', U'\u85CD', U'\u8964', U'\u62C9', U'\u81D8', U'\u881F', U'\u5ECA', U'\u6717', U'\u6D6A', U'\u72FC', U'\u90CE', U'\u4F86', U'\u51B7', U'\u52DE', U'\u64C4',
+        U'\u6AD3', U'\u7210', U'\u76E7', U'\u8606', U'\u865C', U'\u8DEF', U'\u9732', U'\u9B6F', U'\u9DFA', U'\u788C', U'\u797F', U'\u7DA0', U'\u83C9', U'\u9304', U'\u8AD6',
+        U'\u58DF', U'\u5F04', U'\u7C60', U'\u807E', U'\u7262', U'\u78CA', U'\u8CC2', U'\u96F7', U'\u58D8', U'\u5C62', U'\u6A13', U'\u6DDA', U'\u6F0F', U'\u7D2F', U'\u7E37',
+        U'\u964B', U'\u52D2', U'\u808B', U'\u51DC', U'\u51CC', U'\u7A1C', U'\u7DBE', U'\u83F1', U'\u9675', U'\u8B80', U'\u62CF', U'\u8AFE', U'\u4E39', U'\u5BE7', U'\u6012',
+        U'\u7387', U'\u7570', U'\u5317', U'\u78FB', U'\u4FBF', U'\u5FA9', U'\u4E0D', U'\u6CCC', U'\u6578', U'\u7D22', U'\u53C3', U'\u585E', U'\u7701', U'\u8449', U'\u8AAA',
+        U'\u6BBA', U'\u6C88', U'\u62FE', U'\u82E5', U'\u63A0', U'\u7565', U'\u4EAE', U'\u5169', U'\u51C9', U'\u6881', U'\u7CE7', U'\u826F', U'\u8AD2', U'\u91CF', U'\u52F5',
+        U'\u5442', U'\u5EEC', U'\u65C5', U'\u6FFE', U'\u792A', U'\u95AD', U'\u9A6A', U'\u9E97', U'\u9ECE', U'\u66C6', U'\u6B77', U'\u8F62', U'\u5E74', U'\u6190', U'\u6200',
+        U'\u649A', U'\u6F23', U'\u7149', U'\u7489', U'\u79CA', U'\u7DF4', U'\u806F', U'\u8F26', U'\u84EE', U'\u9023', U'\u934A', U'\u5217', U'\u52A3', U'\u54BD', U'\u70C8',
+        U'\u88C2', U'\u5EC9', U'\u5FF5', U'\u637B', U'\u6BAE', U'\u7C3E', U'\u7375', U'\u4EE4', U'\u56F9', U'\u5DBA', U'\u601C', U'\u73B2', U'\u7469', U'\u7F9A', U'\u8046',
+        U'\u9234', U'\u96F6', U'\u9748', U'\u9818', U'\u4F8B', U'\u79AE', U'\u91B4', U'\u96B8', U'\u60E1', U'\u4E86', U'\u50DA', U'\u5BEE', U'\u5C3F', U'\u6599', U'\u71CE',
+        U'\u7642', U'\u84FC', U'\u907C', U'\u6688', U'\u962E', U'\u5289', U'\u677B', U'\u67F3', U'\u6D41', U'\u6E9C', U'\u7409', U'\u7559', U'\u786B', U'\u7D10', U'\u985E',
+        U'\u622E', U'\u9678', U'\u502B', U'\u5D19', U'\u6DEA', U'\u8F2A', U'\u5F8B', U'\u6144', U'\u6817', U'\u9686', U'\u5229', U'\u540F', U'\u5C65', U'\u6613', U'\u674E',
+        U'\u68A8', U'\u6CE5', U'\u7406', U'\u75E2', U'\u7F79', U'\u88CF', U'\u88E1', U'\u96E2', U'\u533F', U'\u6EBA', U'\u541D', U'\u71D0', U'\u7498', U'\u85FA', U'\u96A3',
+        U'\u9C57', U'\u9E9F', U'\u6797', U'\u6DCB', U'\u81E8', U'\u7B20', U'\u7C92', U'\u72C0', U'\u7099', U'\u8B58', U'\u4EC0', U'\u8336', U'\u523A', U'\u5207', U'\u5EA6',
+        U'\u62D3', U'\u7CD6', U'\u5B85', U'\u6D1E', U'\u66B4', U'\u8F3B', U'\u964D', U'\u5ED3', U'\u5140', U'\u55C0', U'\u585A', U'\u6674', U'\u51DE', U'\u732A', U'\u76CA',
+        U'\u793C', U'\u795E', U'\u7965', U'\u798F', U'\u9756', U'\u7CBE', U'\u8612', U'\u8AF8', U'\u9038', U'\u90FD', U'\u98EF', U'\u98FC', U'\u9928', U'\u9DB4', U'\u90DE',
+        U'\u96B7', U'\u4FAE', U'\u50E7', U'\u514D', U'\u52C9', U'\u52E4', U'\u5351', U'\u559D', U'\u5606', U'\u5668', U'\u5840', U'\u58A8', U'\u5C64', U'\u6094', U'\u6168',
+        U'\u618E', U'\u61F2', U'\u654F', U'\u65E2', U'\u6691', U'\u6885', U'\u6D77', U'\u6E1A', U'\u6F22', U'\u716E', U'\u722B', U'\u7422', U'\u7891', U'\u7949', U'\u7948',
+        U'\u7950', U'\u7956', U'\u798D', U'\u798E', U'\u7A40', U'\u7A81', U'\u7BC0', U'\u7E09', U'\u7E41', U'\u7F72', U'\u8005', U'\u81ED', U'\u8279', U'\u8457', U'\u8910',
+        U'\u8996', U'\u8B01', U'\u8B39', U'\u8CD3', U'\u8D08', U'\u8FB6', U'\u96E3', U'\u97FF', U'\u983B', U'\u6075', U'\U000242EE', U'\u8218', U'\u4E26', U'\u51B5', U'\u5168',
+        U'\u4F80', U'\u5145', U'\u5180', U'\u52C7', U'\u52FA', U'\u5555', U'\u5599', U'\u55E2', U'\u58B3', U'\u5944', U'\u5954', U'\u5A62', U'\u5B28', U'\u5ED2', U'\u5ED9',
+        U'\u5F69', U'\u5FAD', U'\u60D8', U'\u614E', U'\u6108', U'\u6160', U'\u6234', U'\u63C4', U'\u641C', U'\u6452', U'\u6556', U'\u671B', U'\u6756', U'\u6EDB', U'\u6ECB',
+        U'\u701E', U'\u77A7', U'\u7235', U'\u72AF', U'\u7471', U'\u7506', U'\u753B', U'\u761D', U'\u761F', U'\u76DB', U'\u76F4', U'\u774A', U'\u7740', U'\u78CC', U'\u7AB1',
+        U'\u7C7B', U'\u7D5B', U'\u7F3E', U'\u8352', U'\u83EF', U'\u8779', U'\u8941', U'\u8986', U'\u8ABF', U'\u8ACB', U'\u8AED', U'\u8B8A', U'\u8F38', U'\u9072', U'\u9199',
+        U'\u9276', U'\u967C', U'\u97DB', U'\u980B', U'\u9B12', U'\U0002284A', U'\U00022844', U'\U000233D5', U'\u3B9D', U'\u4018', U'\u4039', U'\U00025249', U'\U00025CD0',
+        U'\U00027ED3', U'\u9F43', U'\u9F8E', U'\u0066', U'\u0066', U'\u0066', U'\u0069', U'\u0066', U'\u006C', U'\u0066', U'\u0066', U'\u0069', U'\u0066', U'\u0066', U'\u006C',
+        U'\u0073', U'\u0074', U'\u0574', U'\u0576', U'\u0574', U'\u0565', U'\u0574', U'\u056B', U'\u057E', U'\u0576', U'\u0574', U'\u056D', U'\u05D9', U'\u05B4', U'\u05F2',
+        U'\u05B7', U'\u05E2', U'\u05D4', U'\u05DB', U'\u05DC', U'\u05DD', U'\u05E8', U'\u05EA', U'\u05E9', U'\u05C1', U'\u05E9', U'\u05C2', U'\u05E9', U'\u05BC', U'\u05C1',
+        U'\u05E9', U'\u05BC', U'\u05C2', U'\u05D0', U'\u05B7', U'\u05D0', U'\u05B8', U'\u05D0', U'\u05BC', U'\u05D1', U'\u05BC', U'\u05D2', U'\u05BC', U'\u05D3', U'\u05BC',
+        U'\u05D4', U'\u05BC', U'\u05D5', U'\u05BC', U'\u05D6', U'\u05BC', U'\u05D8', U'\u05BC', U'\u05D9', U'\u05BC', U'\u05DA', U'\u05BC', U'\u05DB', U'\u05BC', U'\u05DC',
+        U'\u05BC', U'\u05DE', U'\u05BC', U'\u05E0', U'\u05BC', U'\u05E1', U'\u05BC', U'\u05E3', U'\u05BC', U'\u05E4', U'\u05BC', U'\u05E6', U'\u05BC', U'\u05E7', U'\u05BC',
+        U'\u05E8', U'\u05BC', U'\u05E9', U'\u05BC', U'\u05EA', U'\u05BC', U'\u05D5', U'\u05B9', U'\u05D1', U'\u05BF', U'\u05DB', U'\u05BF', U'\u05E4', U'\u05BF', U'\u05D0',
+        U'\u05DC', U'\u0671', U'\u067B', U'\u067E', U'\u0680', U'\u067A', U'\u067F', U'\u0679', U'\u06A4', U'\u06A6', U'\u0684', U'\u0683', U'\u0686', U'\u0687', U'\u068D',
+        U'\u068C', U'\u068E', U'\u0688', U'\u0698', U'\u0691', U'\u06A9', U'\u06AF', U'\u06B3', U'\u06B1', U'\u06BA', U'\u06BB', U'\u06C1', U'\u06BE', U'\u06D2', U'\u06AD',
+        U'\u06C7', U'\u06C6', U'\u06C8', U'\u06CB', U'\u06C5', U'\u06C9', U'\u06D0', U'\u0649', U'\u064A', U'\u0654', U'\u0627', U'\u064A', U'\u0654', U'\u06D5', U'\u064A',
+        U'\u0654', U'\u0648', U'\u064A', U'\u0654', U'\u06C7', U'\u064A', U'\u0654', U'\u06C6', U'\u064A', U'\u0654', U'\u06C8', U'\u064A', U'\u0654', U'\u06D0', U'\u064A',
+        U'\u0654', U'\u0649', U'\u06CC', U'\u064A', U'\u0654', U'\u062C', U'\u064A', U'\u0654', U'\u062D', U'\u064A', U'\u0654', U'\u0645', U'\u064A', U'\u0654', U'\u064A',
+        U'\u0628', U'\u062C', U'\u0628', U'\u062D', U'\u0628', U'\u062E', U'\u0628', U'\u0645', U'\u0628', U'\u0649', U'\u0628', U'\u064A', U'\u062A', U'\u062C', U'\u062A',
+        U'\u062D', U'\u062A', U'\u062E', U'\u062A', U'\u0645', U'\u062A', U'\u0649', U'\u062A', U'\u064A', U'\u062B', U'\u062C', U'\u062B', U'\u0645', U'\u062B', U'\u0649',
+        U'\u062B', U'\u064A', U'\u062C', U'\u062D', U'\u062C', U'\u0645', U'\u062D', U'\u062C', U'\u062D', U'\u0645', U'\u062E', U'\u062C', U'\u062E', U'\u062D', U'\u062E',
+        U'\u0645', U'\u0633', U'\u062C', U'\u0633', U'\u062D', U'\u0633', U'\u062E', U'\u0633', U'\u0645', U'\u0635', U'\u062D', U'\u0635', U'\u0645', U'\u0636', U'\u062C',
+        U'\u0636', U'\u062D', U'\u0636', U'\u062E', U'\u0636', U'\u0645', U'\u0637', U'\u062D', U'\u0637', U'\u0645', U'\u0638', U'\u0645', U'\u0639', U'\u062C', U'\u0639',
+        U'\u0645', U'\u063A', U'\u062C', U'\u063A', U'\u0645', U'\u0641', U'\u062C', U'\u0641', U'\u062D', U'\u0641', U'\u062E', U'\u0641', U'\u0645', U'\u0641', U'\u0649',
+        U'\u0641', U'\u064A', U'\u0642', U'\u062D', U'\u0642', U'\u0645', U'\u0642', U'\u0649', U'\u0642', U'\u064A', U'\u0643', U'\u0627', U'\u0643', U'\u062C', U'\u0643',
+        U'\u062D', U'\u0643', U'\u062E', U'\u0643', U'\u0644', U'\u0643', U'\u0645', U'\u0643', U'\u0649', U'\u0643', U'\u064A', U'\u0644', U'\u062C', U'\u0644', U'\u062D',
+        U'\u0644', U'\u062E', U'\u0644', U'\u0645', U'\u0644', U'\u0649', U'\u0644', U'\u064A', U'\u0645', U'\u062C', U'\u0645', U'\u062D', U'\u0645', U'\u062E', U'\u0645',
+        U'\u0645', U'\u0645', U'\u0649', U'\u0645', U'\u064A', U'\u0646', U'\u062C', U'\u0646', U'\u062D', U'\u0646', U'\u062E', U'\u0646', U'\u0645', U'\u0646', U'\u0649',
+        U'\u0646', U'\u064A', U'\u0647', U'\u062C', U'\u0647', U'\u0645', U'\u0647', U'\u0649', U'\u0647', U'\u064A', U'\u064A', U'\u062C', U'\u064A', U'\u062D', U'\u064A',
+        U'\u062E', U'\u064A', U'\u0645', U'\u064A', U'\u0649', U'\u064A', U'\u064A', U'\u0630', U'\u0670', U'\u0631', U'\u0670', U'\u0649', U'\u0670', U'\u0020', U'\u064C',
+        U'\u0651', U'\u0020', U'\u064D', U'\u0651', U'\u0020', U'\u064E', U'\u0651', U'\u0020', U'\u064F', U'\u0651', U'\u0020', U'\u0650', U'\u0651', U'\u0020', U'\u0651',
+        U'\u0670', U'\u064A', U'\u0654', U'\u0631', U'\u064A', U'\u0654', U'\u0632', U'\u064A', U'\u0654', U'\u0646', U'\u0628', U'\u0631', U'\u0628', U'\u0632', U'\u0628',
+        U'\u0646', U'\u062A', U'\u0631', U'\u062A', U'\u0632', U'\u062A', U'\u0646', U'\u062B', U'\u0631', U'\u062B', U'\u0632', U'\u062B', U'\u0646', U'\u0645', U'\u0627',
+        U'\u0646', U'\u0631', U'\u0646', U'\u0632', U'\u0646', U'\u0646', U'\u064A', U'\u0631', U'\u064A', U'\u0632', U'\u064A', U'\u0646', U'\u064A', U'\u0654', U'\u062E',
+        U'\u064A', U'\u0654', U'\u0647', U'\u0628', U'\u0647', U'\u062A', U'\u0647', U'\u0635', U'\u062E', U'\u0644', U'\u0647', U'\u0646', U'\u0647', U'\u0647', U'\u0670',
+        U'\u064A', U'\u0647', U'\u062B', U'\u0647', U'\u0633', U'\u0647', U'\u0634', U'\u0645', U'\u0634', U'\u0647', U'\u0640', U'\u064E', U'\u0651', U'\u0640', U'\u064F',
+        U'\u0651', U'\u0640', U'\u0650', U'\u0651', U'\u0637', U'\u0649', U'\u0637', U'\u064A', U'\u0639', U'\u0649', U'\u0639', U'\u064A', U'\u063A', U'\u0649', U'\u063A',
+        U'\u064A', U'\u0633', U'\u0649', U'\u0633', U'\u064A', U'\u0634', U'\u0649', U'\u0634', U'\u064A', U'\u062D', U'\u0649', U'\u062D', U'\u064A', U'\u062C', U'\u0649',
+        U'\u062C', U'\u064A', U'\u062E', U'\u0649', U'\u062E', U'\u064A', U'\u0635', U'\u0649', U'\u0635', U'\u064A', U'\u0636', U'\u0649', U'\u0636', U'\u064A', U'\u0634',
+        U'\u062C', U'\u0634', U'\u062D', U'\u0634', U'\u062E', U'\u0634', U'\u0631', U'\u0633', U'\u0631', U'\u0635', U'\u0631', U'\u0636', U'\u0631', U'\u0627', U'\u064B',
+        U'\u062A', U'\u062C', U'\u0645', U'\u062A', U'\u062D', U'\u062C', U'\u062A', U'\u062D', U'\u0645', U'\u062A', U'\u062E', U'\u0645', U'\u062A', U'\u0645', U'\u062C',
+        U'\u062A', U'\u0645', U'\u062D', U'\u062A', U'\u0645', U'\u062E', U'\u062C', U'\u0645', U'\u062D', U'\u062D', U'\u0645', U'\u064A', U'\u062D', U'\u0645', U'\u0649',
+        U'\u0633', U'\u062D', U'\u062C', U'\u0633', U'\u062C', U'\u062D', U'\u0633', U'\u062C', U'\u0649', U'\u0633', U'\u0645', U'\u062D', U'\u0633', U'\u0645', U'\u062C',
+        U'\u0633', U'\u0645', U'\u0645', U'\u0635', U'\u062D', U'\u062D', U'\u0635', U'\u0645', U'\u0645', U'\u0634', U'\u062D', U'\u0645', U'\u0634', U'\u062C', U'\u064A',
+        U'\u0634', U'\u0645', U'\u062E', U'\u0634', U'\u0645', U'\u0645', U'\u0636', U'\u062D', U'\u0649', U'\u0636', U'\u062E', U'\u0645', U'\u0637', U'\u0645', U'\u062D',
+        U'\u0637', U'\u0645', U'\u0645', U'\u0637', U'\u0645', U'\u064A', U'\u0639', U'\u062C', U'\u0645', U'\u0639', U'\u0645', U'\u0645', U'\u0639', U'\u0645', U'\u0649',
+        U'\u063A', U'\u0645', U'\u0645', U'\u063A', U'\u0645', U'\u064A', U'\u063A', U'\u0645', U'\u0649', U'\u0641', U'\u062E', U'\u0645', U'\u0642', U'\u0645', U'\u062D',
+        U'\u0642', U'\u0645', U'\u0645', U'\u0644', U'\u062D', U'\u0645', U'\u0644', U'\u062D', U'\u064A', U'\u0644', U'\u062D', U'\u0649', U'\u0644', U'\u062C', U'\u062C',
+        U'\u0644', U'\u062E', U'\u0645', U'\u0644', U'\u0645', U'\u062D', U'\u0645', U'\u062D', U'\u062C', U'\u0645', U'\u062D', U'\u0645', U'\u0645', U'\u062D', U'\u064A',
+        U'\u0645', U'\u062C', U'\u062D', U'\u0645', U'\u062C', U'\u0645', U'\u0645', U'\u062E', U'\u062C', U'\u0645', U'\u062E', U'\u0645', U'\u0645', U'\u062C', U'\u062E',
+        U'\u0647', U'\u0645', U'\u062C', U'\u0647', U'\u0645', U'\u0645', U'\u0646', U'\u062D', U'\u0645', U'\u0646', U'\u062D', U'\u0649', U'\u0646', U'\u062C', U'\u0645',
+        U'\u0646', U'\u062C', U'\u0649', U'\u0646', U'\u0645', U'\u064A', U'\u0646', U'\u0645', U'\u0649', U'\u064A', U'\u0645', U'\u0645', U'\u0628', U'\u062E', U'\u064A',
+        U'\u062A', U'\u062C', U'\u064A', U'\u062A', U'\u062C', U'\u0649', U'\u062A', U'\u062E', U'\u064A', U'\u062A', U'\u062E', U'\u0649', U'\u062A', U'\u0645', U'\u064A',
+        U'\u062A', U'\u0645', U'\u0649', U'\u062C', U'\u0645', U'\u064A', U'\u062C', U'\u062D', U'\u0649', U'\u062C', U'\u0645', U'\u0649', U'\u0633', U'\u062E', U'\u0649',
+        U'\u0635', U'\u062D', U'\u064A', U'\u0634', U'\u062D', U'\u064A', U'\u0636', U'\u062D', U'\u064A', U'\u0644', U'\u062C', U'\u064A', U'\u0644', U'\u0645', U'\u064A',
+        U'\u064A', U'\u062D', U'\u064A', U'\u064A', U'\u062C', U'\u064A', U'\u064A', U'\u0645', U'\u064A', U'\u0645', U'\u0645', U'\u064A', U'\u0642', U'\u0645', U'\u064A',
+        U'\u0646', U'\u062D', U'\u064A', U'\u0639', U'\u0645', U'\u064A', U'\u0643', U'\u0645', U'\u064A', U'\u0646', U'\u062C', U'\u062D', U'\u0645', U'\u062E', U'\u064A',
+        U'\u0644', U'\u062C', U'\u0645', U'\u0643', U'\u0645', U'\u0645', U'\u062C', U'\u062D', U'\u064A', U'\u062D', U'\u062C', U'\u064A', U'\u0645', U'\u062C', U'\u064A',
+        U'\u0641', U'\u0645', U'\u064A', U'\u0628', U'\u062D', U'\u064A', U'\u0633', U'\u062E', U'\u064A', U'\u0646', U'\u062C', U'\u064A', U'\u0635', U'\u0644', U'\u06D2',
+        U'\u0642', U'\u0644', U'\u06D2', U'\u0627', U'\u0644', U'\u0644', U'\u0647', U'\u0627', U'\u0643', U'\u0628', U'\u0631', U'\u0645', U'\u062D', U'\u0645', U'\u062F',
+        U'\u0635', U'\u0644', U'\u0639', U'\u0645', U'\u0631', U'\u0633', U'\u0648', U'\u0644', U'\u0639', U'\u0644', U'\u064A', U'\u0647', U'\u0648', U'\u0633', U'\u0644',
+        U'\u0645', U'\u0635', U'\u0644', U'\u0649', U'\u0635', U'\u0644', U'\u0649', U'\u0020', U'\u0627', U'\u0644', U'\u0644', U'\u0647', U'\u0020', U'\u0639', U'\u0644',
+        U'\u064A', U'\u0647', U'\u0020', U'\u0648', U'\u0633', U'\u0644', U'\u0645', U'\u062C', U'\u0644', U'\u0020', U'\u062C', U'\u0644', U'\u0627', U'\u0644', U'\u0647',
+        U'\u0631', U'\u06CC', U'\u0627', U'\u0644', U'\u002C', U'\u3001', U'\u3002', U'\u003A', U'\u0021', U'\u003F', U'\u3016', U'\u3017', U'\u2014', U'\u2013', U'\u005F',
+        U'\u007B', U'\u007D', U'\u3014', U'\u3015', U'\u3010', U'\u3011', U'\u300A', U'\u300B', U'\u300C', U'\u300D', U'\u300E', U'\u300F', U'\u005B', U'\u005D', U'\u0023',
+        U'\u0026', U'\u002A', U'\u002D', U'\u003C', U'\u003E', U'\u005C', U'\u0024', U'\u0025', U'\u0040', U'\u0020', U'\u064B', U'\u0640', U'\u064B', U'\u0020', U'\u064C',
+        U'\u0020', U'\u064D', U'\u0020', U'\u064E', U'\u0640', U'\u064E', U'\u0020', U'\u064F', U'\u0640', U'\u064F', U'\u0020', U'\u0650', U'\u0640', U'\u0650', U'\u0020',
+        U'\u0651', U'\u0640', U'\u0651', U'\u0020', U'\u0652', U'\u0640', U'\u0652', U'\u0621', U'\u0627', U'\u0628', U'\u0629', U'\u062A', U'\u062B', U'\u062C', U'\u062D',
+        U'\u062E', U'\u062F', U'\u0630', U'\u0631', U'\u0632', U'\u0633', U'\u0634', U'\u0635', U'\u0636', U'\u0637', U'\u0638', U'\u0639', U'\u063A', U'\u0641', U'\u0642',
+        U'\u0643', U'\u0644', U'\u0645', U'\u0646', U'\u0647', U'\u0648', U'\u064A', U'\u0644', U'\u0627', U'\u0653', U'\u0644', U'\u0627', U'\u0654', U'\u0644', U'\u0627',
+        U'\u0655', U'\u0644', U'\u0627', U'\u0022', U'\u0027', U'\u002F', U'\u005E', U'\u007C', U'\u007E', U'\u2985', U'\u2986', U'\u30FB', U'\u30A1', U'\u30A3', U'\u30A5',
+        U'\u30A7', U'\u30A9', U'\u30E3', U'\u30E5', U'\u30E7', U'\u30C3', U'\u30FC', U'\u30F3', U'\u3099', U'\u309A', U'\u00A2', U'\u00A3', U'\u00AC', U'\u00A6', U'\u00A5',
+        U'\u20A9', U'\u2502', U'\u2190', U'\u2191', U'\u2192', U'\u2193', U'\u25A0', U'\u25CB', U'\U000105D2', U'\u0307', U'\U000105DA', U'\u0307', U'\u02D0', U'\u02D1',
+        U'\u00E6', U'\u0299', U'\u0253', U'\u02A3', U'\uAB66', U'\u02A5', U'\u02A4', U'\u0256', U'\u0257', U'\u1D91', U'\u0258', U'\u025E', U'\u02A9', U'\u0264', U'\u0262',
+        U'\u0260', U'\u029B', U'\u029C', U'\u0267', U'\u0284', U'\u02AA', U'\u02AB', U'\u026C', U'\U0001DF04', U'\uA78E', U'\u026E', U'\U0001DF05', U'\u028E', U'\U0001DF06',
+        U'\u00F8', U'\u0276', U'\u0277', U'\u027A', U'\U0001DF08', U'\u027D', U'\u027E', U'\u0280', U'\u02A8', U'\u02A6', U'\uAB67', U'\u02A7', U'\u0288', U'\u2C71', U'\u028F',
+        U'\u02A1', U'\u02A2', U'\u0298', U'\u01C0', U'\u01C1', U'\u01C2', U'\U0001DF0A', U'\U0001DF1E', U'\U00011099', U'\U000110BA', U'\U0001109B', U'\U000110BA', U'\U000110A5',
+        U'\U000110BA', U'\U00011131', U'\U00011127', U'\U00011132', U'\U00011127', U'\U00011347', U'\U0001133E', U'\U00011347', U'\U00011357', U'\U00011382', U'\U000113C9',
+        U'\U00011384', U'\U000113BB', U'\U0001138B', U'\U000113C2', U'\U00011390', U'\U000113C9', U'\U000113C2', U'\U000113C2', U'\U000113C2', U'\U000113B8', U'\U000113C2',
+        U'\U000113C9', U'\U000114B9', U'\U000114BA', U'\U000114B9', U'\U000114B0', U'\U000114B9', U'\U000114BD', U'\U000115B8', U'\U000115AF', U'\U000115B9', U'\U000115AF',
+        U'\U00011935', U'\U00011930', U'\U0001611E', U'\U0001611E', U'\U0001611E', U'\U00016129', U'\U0001611E', U'\U0001611F', U'\U00016129', U'\U0001611F', U'\U0001611E',
+        U'\U00016120', U'\U0001611E', U'\U0001611E', U'\U0001611F', U'\U0001611E', U'\U00016129', U'\U0001611F', U'\U0001611E', U'\U0001611E', U'\U00016120', U'\U00016D67',
+        U'\U00016D67', U'\U00016D63', U'\U00016D67', U'\U00016D63', U'\U00016D67', U'\U00016D67', U'\U0001D157', U'\U0001D165', U'\U0001D158', U'\U0001D165', U'\U0001D158',
+        U'\U0001D165', U'\U0001D16E', U'\U0001D158', U'\U0001D165', U'\U0001D16F', U'\U0001D158', U'\U0001D165', U'\U0001D170', U'\U0001D158', U'\U0001D165', U'\U0001D171',
+        U'\U0001D158', U'\U0001D165', U'\U0001D172', U'\U0001D1B9', U'\U0001D165', U'\U0001D1BA', U'\U0001D165', U'\U0001D1B9', U'\U0001D165', U'\U0001D16E', U'\U0001D1BA',
+        U'\U0001D165', U'\U0001D16E', U'\U0001D1B9', U'\U0001D165', U'\U0001D16F', U'\U0001D1BA', U'\U0001D165', U'\U0001D16F', U'\u0131', U'\u0237', U'\u0391', U'\u0392',
+        U'\u0394', U'\u0395', U'\u0396', U'\u0397', U'\u0399', U'\u039A', U'\u039B', U'\u039C', U'\u039D', U'\u039E', U'\u039F', U'\u03A1', U'\u03A4', U'\u03A6', U'\u03A7',
+        U'\u03A8', U'\u2207', U'\u03B1', U'\u03B6', U'\u03B7', U'\u03BB', U'\u03BD', U'\u03BE', U'\u03BF', U'\u03C3', U'\u03C4', U'\u03C5', U'\u03C8', U'\u03C9', U'\u2202',
+        U'\u03DC', U'\u03DD', U'\u0430', U'\u0431', U'\u0432', U'\u0433', U'\u0434', U'\u0435', U'\u0436', U'\u0437', U'\u0438', U'\u043A', U'\u043B', U'\u043C', U'\u043E',
+        U'\u043F', U'\u0440', U'\u0441', U'\u0442', U'\u0443', U'\u0444', U'\u0445', U'\u0446', U'\u0447', U'\u0448', U'\u044B', U'\u044D', U'\u044E', U'\uA689', U'\u04D9',
+        U'\u0456', U'\u0458', U'\u04E9', U'\u04AF', U'\u04CF', U'\u0491', U'\u0455', U'\u045F', U'\u04AB', U'\uA651', U'\u04B1', U'\u066E', U'\u06A1', U'\u066F', U'\u0030',
+        U'\u002E', U'\u0030', U'\u002C', U'\u0031', U'\u002C', U'\u0032', U'\u002C', U'\u0033', U'\u002C', U'\u0034', U'\u002C', U'\u0035', U'\u002C', U'\u0036', U'\u002C',
+        U'\u0037', U'\u002C', U'\u0038', U'\u002C', U'\u0039', U'\u002C', U'\u0028', U'\u0041', U'\u0029', U'\u0028', U'\u0042', U'\u0029', U'\u0028', U'\u0043', U'\u0029',
+        U'\u0028', U'\u0044', U'\u0029', U'\u0028', U'\u0045', U'\u0029', U'\u0028', U'\u0046', U'\u0029', U'\u0028', U'\u0047', U'\u0029', U'\u0028', U'\u0048', U'\u0029',
+        U'\u0028', U'\u0049', U'\u0029', U'\u0028', U'\u004A', U'\u0029', U'\u0028', U'\u004B', U'\u0029', U'\u0028', U'\u004C', U'\u0029', U'\u0028', U'\u004D', U'\u0029',
+        U'\u0028', U'\u004E', U'\u0029', U'\u0028', U'\u004F', U'\u0029', U'\u0028', U'\u0050', U'\u0029', U'\u0028', U'\u0051', U'\u0029', U'\u0028', U'\u0052', U'\u0029',
+        U'\u0028', U'\u0053', U'\u0029', U'\u0028', U'\u0054', U'\u0029', U'\u0028', U'\u0055', U'\u0029', U'\u0028', U'\u0056', U'\u0029', U'\u0028', U'\u0057', U'\u0029',
+        U'\u0028', U'\u0058', U'\u0029', U'\u0028', U'\u0059', U'\u0029', U'\u0028', U'\u005A', U'\u0029', U'\u3014', U'\u0053', U'\u3015', U'\u0043', U'\u0044', U'\u0057',
+        U'\u005A', U'\u0048', U'\u0056', U'\u0053', U'\u0044', U'\u0053', U'\u0053', U'\u0050', U'\u0050', U'\u0056', U'\u0057', U'\u0043', U'\u004D', U'\u0043', U'\u004D',
+        U'\u0044', U'\u004D', U'\u0052', U'\u0044', U'\u004A', U'\u307B', U'\u304B', U'\u30B3', U'\u30B3', U'\u5B57', U'\u53CC', U'\u591A', U'\u89E3', U'\u4EA4', U'\u6620',
+        U'\u7121', U'\u524D', U'\u5F8C', U'\u518D', U'\u65B0', U'\u521D', U'\u7D42', U'\u8CA9', U'\u58F0', U'\u5439', U'\u6F14', U'\u6295', U'\u6355', U'\u904A', U'\u6307',
+        U'\u6253', U'\u7981', U'\u7A7A', U'\u5408', U'\u6E80', U'\u7533', U'\u5272', U'\u55B6', U'\u914D', U'\u3014', U'\u672C', U'\u3015', U'\u3014', U'\u4E09', U'\u3015',
+        U'\u3014', U'\u4E8C', U'\u3015', U'\u3014', U'\u5B89', U'\u3015', U'\u3014', U'\u70B9', U'\u3015', U'\u3014', U'\u6253', U'\u3015', U'\u3014', U'\u76D7', U'\u3015',
+        U'\u3014', U'\u52DD', U'\u3015', U'\u3014', U'\u6557', U'\u3015', U'\u5F97', U'\u53EF', U'\u4E3D', U'\u4E38', U'\u4E41', U'\U00020122', U'\u4F60', U'\u4FBB', U'\u5002',
+        U'\u507A', U'\u5099', U'\u50CF', U'\u349E', U'\U0002063A', U'\u5154', U'\u5164', U'\u5177', U'\U0002051C', U'\u34B9', U'\u5167', U'\U0002054B', U'\u5197', U'\u51A4',
+        U'\u4ECC', U'\u51AC', U'\U000291DF', U'\u5203', U'\u34DF', U'\u523B', U'\u5246', U'\u5277', U'\u3515', U'\u5305', U'\u5306', U'\u5349', U'\u535A', U'\u5373', U'\u537D',
+        U'\u537F', U'\U00020A2C', U'\u7070', U'\u53CA', U'\u53DF', U'\U00020B63', U'\u53EB', U'\u53F1', U'\u5406', U'\u549E', U'\u5438', U'\u5448', U'\u5468', U'\u54A2',
+        U'\u54F6', U'\u5510', U'\u5553', U'\u5563', U'\u5584', U'\u55AB', U'\u55B3', U'\u55C2', U'\u5716', U'\u5717', U'\u5651', U'\u5674', U'\u58EE', U'\u57CE', U'\u57F4',
+        U'\u580D', U'\u578B', U'\u5832', U'\u5831', U'\u58AC', U'\U000214E4', U'\u58F2', U'\u58F7', U'\u5906', U'\u5922', U'\u5962', U'\U000216A8', U'\U000216EA', U'\u59EC',
+        U'\u5A1B', U'\u5A27', U'\u59D8', U'\u5A66', U'\u36EE', U'\u36FC', U'\u5B08', U'\u5B3E', U'\U000219C8', U'\u5BC3', U'\u5BD8', U'\u5BF3', U'\U00021B18', U'\u5BFF',
+        U'\u5C06', U'\u5F53', U'\u3781', U'\u5C60', U'\u5CC0', U'\u5C8D', U'\U00021DE4', U'\u5D43', U'\U00021DE6', U'\u5D6E', U'\u5D6B', U'\u5D7C', U'\u5DE1', U'\u5DE2',
+        U'\u382F', U'\u5DFD', U'\u5E28', U'\u5E3D', U'\u5E69', U'\u3862', U'\U00022183', U'\u387C', U'\u5EB0', U'\u5EB3', U'\u5EB6', U'\U0002A392', U'\U00022331', U'\u8201',
+        U'\u5F22', U'\u38C7', U'\U000232B8', U'\U000261DA', U'\u5F62', U'\u5F6B', U'\u38E3', U'\u5F9A', U'\u5FCD', U'\u5FD7', U'\u5FF9', U'\u6081', U'\u393A', U'\u391C',
+        U'\U000226D4', U'\u60C7', U'\u6148', U'\u614C', U'\u617A', U'\u61B2', U'\u61A4', U'\u61AF', U'\u61DE', U'\u6210', U'\u621B', U'\u625D', U'\u62B1', U'\u62D4', U'\u6350',
+        U'\U00022B0C', U'\u633D', U'\u62FC', U'\u6368', U'\u6383', U'\u63E4', U'\U00022BF1', U'\u6422', U'\u63C5', U'\u63A9', U'\u3A2E', U'\u6469', U'\u647E', U'\u649D',
+        U'\u6477', U'\u3A6C', U'\u656C', U'\U0002300A', U'\u65E3', U'\u66F8', U'\u6649', U'\u3B19', U'\u3B08', U'\u3AE4', U'\u5192', U'\u5195', U'\u6700', U'\u669C', U'\u80AD',
+        U'\u43D9', U'\u6721', U'\u675E', U'\u6753', U'\U000233C3', U'\u3B49', U'\u67FA', U'\u6785', U'\u6852', U'\U0002346D', U'\u688E', U'\u681F', U'\u6914', U'\u6942',
+        U'\u69A3', U'\u69EA', U'\u6AA8', U'\U000236A3', U'\u6ADB', U'\u3C18', U'\u6B21', U'\U000238A7', U'\u6B54', U'\u3C4E', U'\u6B72', U'\u6B9F', U'\u6BBB', U'\U00023A8D',
+        U'\U00021D0B', U'\U00023AFA', U'\u6C4E', U'\U00023CBC', U'\u6CBF', U'\u6CCD', U'\u6C67', U'\u6D16', U'\u6D3E', U'\u6D69', U'\u6D78', U'\u6D85', U'\U00023D1E', U'\u6D34',
+        U'\u6E2F', U'\u6E6E', U'\u3D33', U'\u6EC7', U'\U00023ED1', U'\u6DF9', U'\u6F6E', U'\U00023F5E', U'\U00023F8E', U'\u6FC6', U'\u7039', U'\u701B', U'\u3D96', U'\u704A',
+        U'\u707D', U'\u7077', U'\u70AD', U'\U00020525', U'\u7145', U'\U00024263', U'\u719C', U'\U000243AB', U'\u7228', U'\u7250', U'\U00024608', U'\u7280', U'\u7295',
+        U'\U00024735', U'\U00024814', U'\u737A', U'\u738B', U'\u3EAC', U'\u73A5', U'\u3EB8', U'\u7447', U'\u745C', U'\u7485', U'\u74CA', U'\u3F1B', U'\u7524', U'\U00024C36',
+        U'\u753E', U'\U00024C92', U'\U0002219F', U'\u7610', U'\U00024FA1', U'\U00024FB8', U'\U00025044', U'\u3FFC', U'\u4008', U'\U000250F3', U'\U000250F2', U'\U00025119',
+        U'\U00025133', U'\u771E', U'\u771F', U'\u778B', U'\u4046', U'\u4096', U'\U0002541D', U'\u784E', U'\u40E3', U'\U00025626', U'\U0002569A', U'\U000256C5', U'\u79EB',
+        U'\u412F', U'\u7A4A', U'\u7A4F', U'\U0002597C', U'\U00025AA7', U'\u7AEE', U'\u4202', U'\U00025BAB', U'\u7BC6', U'\u7BC9', U'\u4227', U'\U00025C80', U'\u7CD2', U'\u42A0',
+        U'\u7CE8', U'\u7CE3', U'\u7D00', U'\U00025F86', U'\u7D63', U'\u4301', U'\u7DC7', U'\u7E02', U'\u7E45', U'\u4334', U'\U00026228', U'\U00026247', U'\u4359', U'\U000262D9',
+        U'\u7F7A', U'\U0002633E', U'\u7F95', U'\u7FFA', U'\U000264DA', U'\U00026523', U'\u8060', U'\U000265A8', U'\u8070', U'\U0002335F', U'\u43D5', U'\u80B2', U'\u8103',
+        U'\u440B', U'\u813E', U'\u5AB5', U'\U000267A7', U'\U000267B5', U'\U00023393', U'\U0002339C', U'\u8204', U'\u8F9E', U'\u446B', U'\u8291', U'\u828B', U'\u829D', U'\u52B3',
+        U'\u82B1', U'\u82B3', U'\u82BD', U'\u82E6', U'\U00026B3C', U'\u831D', U'\u8363', U'\u83AD', U'\u8323', U'\u83BD', U'\u83E7', U'\u8353', U'\u83CA', U'\u83CC', U'\u83DC',
+        U'\U00026C36', U'\U00026D6B', U'\U00026CD5', U'\u452B', U'\u84F1', U'\u84F3', U'\u8516', U'\U000273CA', U'\u8564', U'\U00026F2C', U'\u455D', U'\u4561', U'\U00026FB1',
+        U'\U000270D2', U'\u456B', U'\u8650', U'\u8667', U'\u8669', U'\u86A9', U'\u8688', U'\u870E', U'\u86E2', U'\u8728', U'\u876B', U'\u8786', U'\u45D7', U'\u87E1', U'\u8801',
+        U'\u45F9', U'\u8860', U'\U00027667', U'\u88D7', U'\u88DE', U'\u4635', U'\u88FA', U'\u34BB', U'\U000278AE', U'\U00027966', U'\u46BE', U'\u46C7', U'\u8AA0', U'\U00027CA8',
+        U'\u8CAB', U'\u8CC1', U'\u8D1B', U'\u8D77', U'\U00027F2F', U'\U00020804', U'\u8DCB', U'\u8DBC', U'\u8DF0', U'\U000208DE', U'\u8ED4', U'\U000285D2', U'\U000285ED',
+        U'\u9094', U'\u90F1', U'\u9111', U'\U0002872E', U'\u911B', U'\u9238', U'\u92D7', U'\u92D8', U'\u927C', U'\u93F9', U'\u9415', U'\U00028BFA', U'\u958B', U'\u4995',
+        U'\u95B7', U'\U00028D77', U'\u49E6', U'\u96C3', U'\u5DB2', U'\u9723', U'\U00029145', U'\U0002921A', U'\u4A6E', U'\u4A76', U'\u97E0', U'\U0002940A', U'\u4AB2',
+        U'\U00029496', U'\u9829', U'\U000295B6', U'\u98E2', U'\u4B33', U'\u9929', U'\u99A7', U'\u99C2', U'\u99FE', U'\u4BCE', U'\U00029B30', U'\u9C40', U'\u9CFD', U'\u4CCE',
+        U'\u4CED', U'\u9D67', U'\U0002A0CE', U'\u4CF8', U'\U0002A105', U'\U0002A20E', U'\U0002A291', U'\u4D56', U'\u9EFE', U'\u9F05', U'\u9F0F', U'\u9F16', U'\U0002A600'
+    };
+    inline constexpr normalization_composition normalization_compositions[] = {
+        { U'\u003C', U'\u0338', U'\u226E' }, { U'\u003D', U'\u0338', U'\u2260' }, { U'\u003E', U'\u0338', U'\u226F' }, { U'\u0041', U'\u0300', U'\u00C0' },
+        { U'\u0041', U'\u0301', U'\u00C1' }, { U'\u0041', U'\u0302', U'\u00C2' }, { U'\u0041', U'\u0303', U'\u00C3' }, { U'\u0041', U'\u0304', U'\u0100' },
+        { U'\u0041', U'\u0306', U'\u0102' }, { U'\u0041', U'\u0307', U'\u0226' }, { U'\u0041', U'\u0308', U'\u00C4' }, { U'\u0041', U'\u0309', U'\u1EA2' },
+        { U'\u0041', U'\u030A', U'\u00C5' }, { U'\u0041', U'\u030C', U'\u01CD' }, { U'\u0041', U'\u030F', U'\u0200' }, { U'\u0041', U'\u0311', U'\u0202' },
+        { U'\u0041', U'\u0323', U'\u1EA0' }, { U'\u0041', U'\u0325', U'\u1E00' }, { U'\u0041', U'\u0328', U'\u0104' }, { U'\u0042', U'\u0307', U'\u1E02' },
+        { U'\u0042', U'\u0323', U'\u1E04' }, { U'\u0042', U'\u0331', U'\u1E06' }, { U'\u0043', U'\u0301', U'\u0106' }, { U'\u0043', U'\u0302', U'\u0108' },
+        { U'\u0043', U'\u0307', U'\u010A' }, { U'\u0043', U'\u030C', U'\u010C' }, { U'\u0043', U'\u0327', U'\u00C7' }, { U'\u0044', U'\u0307', U'\u1E0A' },
+        { U'\u0044', U'\u030C', U'\u010E' }, { U'\u0044', U'\u0323', U'\u1E0C' }, { U'\u0044', U'\u0327', U'\u1E10' }, { U'\u0044', U'\u032D', U'\u1E12' },
+        { U'\u0044', U'\u0331', U'\u1E0E' }, { U'\u0045', U'\u0300', U'\u00C8' }, { U'\u0045', U'\u0301', U'\u00C9' }, { U'\u0045', U'\u0302', U'\u00CA' },
+        { U'\u0045', U'\u0303', U'\u1EBC' }, { U'\u0045', U'\u0304', U'\u0112' }, { U'\u0045', U'\u0306', U'\u0114' }, { U'\u0045', U'\u0307', U'\u0116' },
+        { U'\u0045', U'\u0308', U'\u00CB' }, { U'\u0045', U'\u0309', U'\u1EBA' }, { U'\u0045', U'\u030C', U'\u011A' }, { U'\u0045', U'\u030F', U'\u0204' },
+        { U'\u0045', U'\u0311', U'\u0206' }, { U'\u0045', U'\u0323', U'\u1EB8' }, { U'\u0045', U'\u0327', U'\u0228' }, { U'\u0045', U'\u0328', U'\u0118' },
+        { U'\u0045', U'\u032D', U'\u1E18' }, { U'\u0045', U'\u0330', U'\u1E1A' }, { U'\u0046', U'\u0307', U'\u1E1E' }, { U'\u0047', U'\u0301', U'\u01F4' },
+        { U'\u0047', U'\u0302', U'\u011C' }, { U'\u0047', U'\u0304', U'\u1E20' }, { U'\u0047', U'\u0306', U'\u011E' }, { U'\u0047', U'\u0307', U'\u0120' },
+        { U'\u0047', U'\u030C', U'\u01E6' }, { U'\u0047', U'\u0327', U'\u0122' }, { U'\u0048', U'\u0302', U'\u0124' }, { U'\u0048', U'\u0307', U'\u1E22' },
+        { U'\u0048', U'\u0308', U'\u1E26' }, { U'\u0048', U'\u030C', U'\u021E' }, { U'\u0048', U'\u0323', U'\u1E24' }, { U'\u0048', U'\u0327', U'\u1E28' },
+        { U'\u0048', U'\u032E', U'\u1E2A' }, { U'\u0049', U'\u0300', U'\u00CC' }, { U'\u0049', U'\u0301', U'\u00CD' }, { U'\u0049', U'\u0302', U'\u00CE' },
+        { U'\u0049', U'\u0303', U'\u0128' }, { U'\u0049', U'\u0304', U'\u012A' }, { U'\u0049', U'\u0306', U'\u012C' }, { U'\u0049', U'\u0307', U'\u0130' },
+        { U'\u0049', U'\u0308', U'\u00CF' }, { U'\u0049', U'\u0309', U'\u1EC8' }, { U'\u0049', U'\u030C', U'\u01CF' }, { U'\u0049', U'\u030F', U'\u0208' },
+        { U'\u0049', U'\u0311', U'\u020A' }, { U'\u0049', U'\u0323', U'\u1ECA' }, { U'\u0049', U'\u0328', U'\u012E' }, { U'\u0049', U'\u0330', U'\u1E2C' },
+        { U'\u004A', U'\u0302', U'\u0134' }, { U'\u004B', U'\u0301', U'\u1E30' }, { U'\u004B', U'\u030C', U'\u01E8' }, { U'\u004B', U'\u0323', U'\u1E32' },
+        { U'\u004B', U'\u0327', U'\u0136' }, { U'\u004B', U'\u0331', U'\u1E34' }, { U'\u004C', U'\u0301', U'\u0139' }, { U'\u004C', U'\u030C', U'\u013D' },
+        { U'\u004C', U'\u0323', U'\u1E36' }, { U'\u004C', U'\u0327', U'\u013B' }, { U'\u004C', U'\u032D', U'\u1E3C' }, { U'\u004C', U'\u0331', U'\u1E3A' },
+        { U'\u004D', U'\u0301', U'\u1E3E' }, { U'\u004D', U'\u0307', U'\u1E40' }, { U'\u004D', U'\u0323', U'\u1E42' }, { U'\u004E', U'\u0300', U'\u01F8' },
+        { U'\u004E', U'\u0301', U'\u0143' }, { U'\u004E', U'\u0303', U'\u00D1' }, { U'\u004E', U'\u0307', U'\u1E44' }, { U'\u004E', U'\u030C', U'\u0147' },
+        { U'\u004E', U'\u0323', U'\u1E46' }, { U'\u004E', U'\u0327', U'\u0145' }, { U'\u004E', U'\u032D', U'\u1E4A' }, { U'\u004E', U'\u0331', U'\u1E48' },
+        { U'\u004F', U'\u0300', U'\u00D2' }, { U'\u004F', U'\u0301', U'\u00D3' }, { U'\u004F', U'\u0302', U'\u00D4' }, { U'\u004F', U'\u0303', U'\u00D5' },
+        { U'\u004F', U'\u0304', U'\u014C' }, { U'\u004F', U'\u0306', U'\u014E' }, { U'\u004F', U'\u0307', U'\u022E' }, { U'\u004F', U'\u0308', U'\u00D6' },
+        { U'\u004F', U'\u0309', U'\u1ECE' }, { U'\u004F', U'\u030B', U'\u0150' }, { U'\u004F', U'\u030C', U'\u01D1' }, { U'\u004F', U'\u030F', U'\u020C' },
+        { U'\u004F', U'\u0311', U'\u020E' }, { U'\u004F', U'\u031B', U'\u01A0' }, { U'\u004F', U'\u0323', U'\u1ECC' }, { U'\u004F', U'\u0328', U'\u01EA' },
+        { U'\u0050', U'\u0301', U'\u1E54' }, { U'\u0050', U'\u0307', U'\u1E56' }, { U'\u0052', U'\u0301', U'\u0154' }, { U'\u0052', U'\u0307', U'\u1E58' },
+        { U'\u0052', U'\u030C', U'\u0158' }, { U'\u0052', U'\u030F', U'\u0210' }, { U'\u0052', U'\u0311', U'\u0212' }, { U'\u0052', U'\u0323', U'\u1E5A' },
+        { U'\u0052', U'\u0327', U'\u0156' }, { U'\u0052', U'\u0331', U'\u1E5E' }, { U'\u0053', U'\u0301', U'\u015A' }, { U'\u0053', U'\u0302', U'\u015C' },
+        { U'\u0053', U'\u0307', U'\u1E60' }, { U'\u0053', U'\u030C', U'\u0160' }, { U'\u0053', U'\u0323', U'\u1E62' }, { U'\u0053', U'\u0326', U'\u0218' },
+        { U'\u0053', U'\u0327', U'\u015E' }, { U'\u0054', U'\u0307', U'\u1E6A' }, { U'\u0054', U'\u030C', U'\u0164' }, { U'\u0054', U'\u0323', U'\u1E6C' },
+        { U'\u0054', U'\u0326', U'\u021A' }, { U'\u0054', U'\u0327', U'\u0162' }, { U'\u0054', U'\u032D', U'\u1E70' }, { U'\u0054', U'\u0331', U'\u1E6E' },
+        { U'\u0055', U'\u0300', U'\u00D9' }, { U'\u0055', U'\u0301', U'\u00DA' }, { U'\u0055', U'\u0302', U'\u00DB' }, { U'\u0055', U'\u0303', U'\u0168' },
+        { U'\u0055', U'\u0304', U'\u016A' }, { U'\u0055', U'\u0306', U'\u016C' }, { U'\u0055', U'\u0308', U'\u00DC' }, { U'\u0055', U'\u0309', U'\u1EE6' },
+        { U'\u0055', U'\u030A', U'\u016E' }, { U'\u0055', U'\u030B', U'\u0170' }, { U'\u0055', U'\u030C', U'\u01D3' }, { U'\u0055', U'\u030F', U'\u0214' },
+        { U'\u0055', U'\u0311', U'\u0216' }, { U'\u0055', U'\u031B', U'\u01AF' }, { U'\u0055', U'\u0323', U'\u1EE4' }, { U'\u0055', U'\u0324', U'\u1E72' },
+        { U'\u0055', U'\u0328', U'\u0172' }, { U'\u0055', U'\u032D', U'\u1E76' }, { U'\u0055', U'\u0330', U'\u1E74' }, { U'\u0056', U'\u0303', U'\u1E7C' },
+        { U'\u0056', U'\u0323', U'\u1E7E' }, { U'\u0057', U'\u0300', U'\u1E80' }, { U'\u0057', U'\u0301', U'\u1E82' }, { U'\u0057', U'\u0302', U'\u0174' },
+        { U'\u0057', U'\u0307', U'\u1E86' }, { U'\u0057', U'\u0308', U'\u1E84' }, { U'\u0057', U'\u0323', U'\u1E88' }, { U'\u0058', U'\u0307', U'\u1E8A' },
+        { U'\u0058', U'\u0308', U'\u1E8C' }, { U'\u0059', U'\u0300', U'\u1EF2' }, { U'\u0059', U'\u0301', U'\u00DD' }, { U'\u0059', U'\u0302', U'\u0176' },
+        { U'\u0059', U'\u0303', U'\u1EF8' }, { U'\u0059', U'\u0304', U'\u0232' }, { U'\u0059', U'\u0307', U'\u1E8E' }, { U'\u0059', U'\u0308', U'\u0178' },
+        { U'\u0059', U'\u0309', U'\u1EF6' }, { U'\u0059', U'\u0323', U'\u1EF4' }, { U'\u005A', U'\u0301', U'\u0179' }, { U'\u005A', U'\u0302', U'\u1E90' },
+        { U'\u005A', U'\u0307', U'\u017B' }, { U'\u005A', U'\u030C', U'\u017D' }, { U'\u005A', U'\u0323', U'\u1E92' }, { U'\u005A', U'\u0331', U'\u1E94' },
+        { U'\u0061', U'\u0300', U'\u00E0' }, { U'\u0061', U'\u0301', U'\u00E1' }, { U'\u0061', U'\u0302', U'\u00E2' }, { U'\u0061', U'\u0303', U'\u00E3' },
+        { U'\u0061', U'\u0304', U'\u0101' }, { U'\u0061', U'\u0306', U'\u0103' }, { U'\u0061', U'\u0307', U'\u0227' }, { U'\u0061', U'\u0308', U'\u00E4' },
+        { U'\u0061', U'\u0309', U'\u1EA3' }, { U'\u0061', U'\u030A', U'\u00E5' }, { U'\u0061', U'\u030C', U'\u01CE' }, { U'\u0061', U'\u030F', U'\u0201' },
+        { U'\u0061', U'\u0311', U'\u0203' }, { U'\u0061', U'\u0323', U'\u1EA1' }, { U'\u0061', U'\u0325', U'\u1E01' }, { U'\u0061', U'\u0328', U'\u0105' },
+        { U'\u0062', U'\u0307', U'\u1E03' }, { U'\u0062', U'\u0323', U'\u1E05' }, { U'\u0062', U'\u0331', U'\u1E07' }, { U'\u0063', U'\u0301', U'\u0107' },
+        { U'\u0063', U'\u0302', U'\u0109' }, { U'\u0063', U'\u0307', U'\u010B' }, { U'\u0063', U'\u030C', U'\u010D' }, { U'\u0063', U'\u0327', U'\u00E7' },
+        { U'\u0064', U'\u0307', U'\u1E0B' }, { U'\u0064', U'\u030C', U'\u010F' }, { U'\u0064', U'\u0323', U'\u1E0D' }, { U'\u0064', U'\u0327', U'\u1E11' },
+        { U'\u0064', U'\u032D', U'\u1E13' }, { U'\u0064', U'\u0331', U'\u1E0F' }, { U'\u0065', U'\u0300', U'\u00E8' }, { U'\u0065', U'\u0301', U'\u00E9' },
+        { U'\u0065', U'\u0302', U'\u00EA' }, { U'\u0065', U'\u0303', U'\u1EBD' }, { U'\u0065', U'\u0304', U'\u0113' }, { U'\u0065', U'\u0306', U'\u0115' },
+        { U'\u0065', U'\u0307', U'\u0117' }, { U'\u0065', U'\u0308', U'\u00EB' }, { U'\u0065', U'\u0309', U'\u1EBB' }, { U'\u0065', U'\u030C', U'\u011B' },
+        { U'\u0065', U'\u030F', U'\u0205' }, { U'\u0065', U'\u0311', U'\u0207' }, { U'\u0065', U'\u0323', U'\u1EB9' }, { U'\u0065', U'\u0327', U'\u0229' },
+        { U'\u0065', U'\u0328', U'\u0119' }, { U'\u0065', U'\u032D', U'\u1E19' }, { U'\u0065', U'\u0330', U'\u1E1B' }, { U'\u0066', U'\u0307', U'\u1E1F' },
+        { U'\u0067', U'\u0301', U'\u01F5' }, { U'\u0067', U'\u0302', U'\u011D' }, { U'\u0067', U'\u0304', U'\u1E21' }, { U'\u0067', U'\u0306', U'\u011F' },
+        { U'\u0067', U'\u0307', U'\u0121' }, { U'\u0067', U'\u030C', U'\u01E7' }, { U'\u0067', U'\u0327', U'\u0123' }, { U'\u0068', U'\u0302', U'\u0125' },
+        { U'\u0068', U'\u0307', U'\u1E23' }, { U'\u0068', U'\u0308', U'\u1E27' }, { U'\u0068', U'\u030C', U'\u021F' }, { U'\u0068', U'\u0323', U'\u1E25' },
+        { U'\u0068', U'\u0327', U'\u1E29' }, { U'\u0068', U'\u032E', U'\u1E2B' }, { U'\u0068', U'\u0331', U'\u1E96' }, { U'\u0069', U'\u0300', U'\u00EC' },
+        { U'\u0069', U'\u0301', U'\u00ED' }, { U'\u0069', U'\u0302', U'\u00EE' }, { U'\u0069', U'\u0303', U'\u0129' }, { U'\u0069', U'\u0304', U'\u012B' },
+        { U'\u0069', U'\u0306', U'\u012D' }, { U'\u0069', U'\u0308', U'\u00EF' }, { U'\u0069', U'\u0309', U'\u1EC9' }, { U'\u0069', U'\u030C', U'\u01D0' },
+        { U'\u0069', U'\u030F', U'\u0209' }, { U'\u0069', U'\u0311', U'\u020B' }, { U'\u0069', U'\u0323', U'\u1ECB' }, { U'\u0069', U'\u0328', U'\u012F' },
+        { U'\u0069', U'\u0330', U'\u1E2D' }, { U'\u006A', U'\u0302', U'\u0135' }, { U'\u006A', U'\u030C', U'\u01F0' }, { U'\u006B', U'\u0301', U'\u1E31' },
+        { U'\u006B', U'\u030C', U'\u01E9' }, { U'\u006B', U'\u0323', U'\u1E33' }, { U'\u006B', U'\u0327', U'\u0137' }, { U'\u006B', U'\u0331', U'\u1E35' },
+        { U'\u006C', U'\u0301', U'\u013A' }, { U'\u006C', U'\u030C', U'\u013E' }, { U'\u006C', U'\u0323', U'\u1E37' }, { U'\u006C', U'\u0327', U'\u013C' },
+        { U'\u006C', U'\u032D', U'\u1E3D' }, { U'\u006C', U'\u0331', U'\u1E3B' }, { U'\u006D', U'\u0301', U'\u1E3F' }, { U'\u006D', U'\u0307', U'\u1E41' },
+        { U'\u006D', U'\u0323', U'\u1E43' }, { U'\u006E', U'\u0300', U'\u01F9' }, { U'\u006E', U'\u0301', U'\u0144' }, { U'\u006E', U'\u0303', U'\u00F1' },
+        { U'\u006E', U'\u0307', U'\u1E45' }, { U'\u006E', U'\u030C', U'\u0148' }, { U'\u006E', U'\u0323', U'\u1E47' }, { U'\u006E', U'\u0327', U'\u0146' },
+        { U'\u006E', U'\u032D', U'\u1E4B' }, { U'\u006E', U'\u0331', U'\u1E49' }, { U'\u006F', U'\u0300', U'\u00F2' }, { U'\u006F', U'\u0301', U'\u00F3' },
+        { U'\u006F', U'\u0302', U'\u00F4' }, { U'\u006F', U'\u0303', U'\u00F5' }, { U'\u006F', U'\u0304', U'\u014D' }, { U'\u006F', U'\u0306', U'\u014F' },
+        { U'\u006F', U'\u0307', U'\u022F' }, { U'\u006F', U'\u0308', U'\u00F6' }, { U'\u006F', U'\u0309', U'\u1ECF' }, { U'\u006F', U'\u030B', U'\u0151' },
+        { U'\u006F', U'\u030C', U'\u01D2' }, { U'\u006F', U'\u030F', U'\u020D' }, { U'\u006F', U'\u0311', U'\u020F' }, { U'\u006F', U'\u031B', U'\u01A1' },
+        { U'\u006F', U'\u0323', U'\u1ECD' }, { U'\u006F', U'\u0328', U'\u01EB' }, { U'\u0070', U'\u0301', U'\u1E55' }, { U'\u0070', U'\u0307', U'\u1E57' },
+        { U'\u0072', U'\u0301', U'\u0155' }, { U'\u0072', U'\u0307', U'\u1E59' }, { U'\u0072', U'\u030C', U'\u0159' }, { U'\u0072', U'\u030F', U'\u0211' },
+        { U'\u0072', U'\u0311', U'\u0213' }, { U'\u0072', U'\u0323', U'\u1E5B' }, { U'\u0072', U'\u0327', U'\u0157' }, { U'\u0072', U'\u0331', U'\u1E5F' },
+        { U'\u0073', U'\u0301', U'\u015B' }, { U'\u0073', U'\u0302', U'\u015D' }, { U'\u0073', U'\u0307', U'\u1E61' }, { U'\u0073', U'\u030C', U'\u0161' },
+        { U'\u0073', U'\u0323', U'\u1E63' }, { U'\u0073', U'\u0326', U'\u0219' }, { U'\u0073', U'\u0327', U'\u015F' }, { U'\u0074', U'\u0307', U'\u1E6B' },
+        { U'\u0074', U'\u0308', U'\u1E97' }, { U'\u0074', U'\u030C', U'\u0165' }, { U'\u0074', U'\u0323', U'\u1E6D' }, { U'\u0074', U'\u0326', U'\u021B' },
+        { U'\u0074', U'\u0327', U'\u0163' }, { U'\u0074', U'\u032D', U'\u1E71' }, { U'\u0074', U'\u0331', U'\u1E6F' }, { U'\u0075', U'\u0300', U'\u00F9' },
+        { U'\u0075', U'\u0301', U'\u00FA' }, { U'\u0075', U'\u0302', U'\u00FB' }, { U'\u0075', U'\u0303', U'\u0169' }, { U'\u0075', U'\u0304', U'\u016B' },
+        { U'\u0075', U'\u0306', U'\u016D' }, { U'\u0075', U'\u0308', U'\u00FC' }, { U'\u0075', U'\u0309', U'\u1EE7' }, { U'\u0075', U'\u030A', U'\u016F' },
+        { U'\u0075', U'\u030B', U'\u0171' }, { U'\u0075', U'\u030C', U'\u01D4' }, { U'\u0075', U'\u030F', U'\u0215' }, { U'\u0075', U'\u0311', U'\u0217' },
+        { U'\u0075', U'\u031B', U'\u01B0' }, { U'\u0075', U'\u0323', U'\u1EE5' }, { U'\u0075', U'\u0324', U'\u1E73' }, { U'\u0075', U'\u0328', U'\u0173' },
+        { U'\u0075', U'\u032D', U'\u1E77' }, { U'\u0075', U'\u0330', U'\u1E75' }, { U'\u0076', U'\u0303', U'\u1E7D' }, { U'\u0076', U'\u0323', U'\u1E7F' },
+        { U'\u0077', U'\u0300', U'\u1E81' }, { U'\u0077', U'\u0301', U'\u1E83' }, { U'\u0077', U'\u0302', U'\u0175' }, { U'\u0077', U'\u0307', U'\u1E87' },
+        { U'\u0077', U'\u0308', U'\u1E85' }, { U'\u0077', U'\u030A', U'\u1E98' }, { U'\u0077', U'\u0323', U'\u1E89' }, { U'\u0078', U'\u0307', U'\u1E8B' },
+        { U'\u0078', U'\u0308', U'\u1E8D' }, { U'\u0079', U'\u0300', U'\u1EF3' }, { U'\u0079', U'\u0301', U'\u00FD' }, { U'\u0079', U'\u0302', U'\u0177' },
+        { U'\u0079', U'\u0303', U'\u1EF9' }, { U'\u0079', U'\u0304', U'\u0233' }, { U'\u0079', U'\u0307', U'\u1E8F' }, { U'\u0079', U'\u0308', U'\u00FF' },
+        { U'\u0079', U'\u0309', U'\u1EF7' }, { U'\u0079', U'\u030A', U'\u1E99' }, { U'\u0079', U'\u0323', U'\u1EF5' }, { U'\u007A', U'\u0301', U'\u017A' },
+        { U'\u007A', U'\u0302', U'\u1E91' }, { U'\u007A', U'\u0307', U'\u017C' }, { U'\u007A', U'\u030C', U'\u017E' }, { U'\u007A', U'\u0323', U'\u1E93' },
+        { U'\u007A', U'\u0331', U'\u1E95' }, { U'\u00A8', U'\u0300', U'\u1FED' }, { U'\u00A8', U'\u0301', U'\u0385' }, { U'\u00A8', U'\u0342', U'\u1FC1' },
+        { U'\u00C2', U'\u0300', U'\u1EA6' }, { U'\u00C2', U'\u0301', U'\u1EA4' }, { U'\u00C2', U'\u0303', U'\u1EAA' }, { U'\u00C2', U'\u0309', U'\u1EA8' },
+        { U'\u00C4', U'\u0304', U'\u01DE' }, { U'\u00C5', U'\u0301', U'\u01FA' }, { U'\u00C6', U'\u0301', U'\u01FC' }, { U'\u00C6', U'\u0304', U'\u01E2' },
+        { U'\u00C7', U'\u0301', U'\u1E08' }, { U'\u00CA', U'\u0300', U'\u1EC0' }, { U'\u00CA', U'\u0301', U'\u1EBE' }, { U'\u00CA', U'\u0303', U'\u1EC4' },
+        { U'\u00CA', U'\u0309', U'\u1EC2' }, { U'\u00CF', U'\u0301', U'\u1E2E' }, { U'\u00D4', U'\u0300', U'\u1ED2' }, { U'\u00D4', U'\u0301', U'\u1ED0' },
+        { U'\u00D4', U'\u0303', U'\u1ED6' }, { U'\u00D4', U'\u0309', U'\u1ED4' }, { U'\u00D5', U'\u0301', U'\u1E4C' }, { U'\u00D5', U'\u0304', U'\u022C' },
+        { U'\u00D5', U'\u0308', U'\u1E4E' }, { U'\u00D6', U'\u0304', U'\u022A' }, { U'\u00D8', U'\u0301', U'\u01FE' }, { U'\u00DC', U'\u0300', U'\u01DB' },
+        { U'\u00DC', U'\u0301', U'\u01D7' }, { U'\u00DC', U'\u0304', U'\u01D5' }, { U'\u00DC', U'\u030C', U'\u01D9' }, { U'\u00E2', U'\u0300', U'\u1EA7' },
+        { U'\u00E2', U'\u0301', U'\u1EA5' }, { U'\u00E2', U'\u0303', U'\u1EAB' }, { U'\u00E2', U'\u0309', U'\u1EA9' }, { U'\u00E4', U'\u0304', U'\u01DF' },
+        { U'\u00E5', U'\u0301', U'\u01FB' }, { U'\u00E6', U'\u0301', U'\u01FD' }, { U'\u00E6', U'\u0304', U'\u01E3' }, { U'\u00E7', U'\u0301', U'\u1E09' },
+        { U'\u00EA', U'\u0300', U'\u1EC1' }, { U'\u00EA', U'\u0301', U'\u1EBF' }, { U'\u00EA', U'\u0303', U'\u1EC5' }, { U'\u00EA', U'\u0309', U'\u1EC3' },
+        { U'\u00EF', U'\u0301', U'\u1E2F' }, { U'\u00F4', U'\u0300', U'\u1ED3' }, { U'\u00F4', U'\u0301', U'\u1ED1' }, { U'\u00F4', U'\u0303', U'\u1ED7' },
+        { U'\u00F4', U'\u0309', U'\u1ED5' }, { U'\u00F5', U'\u0301', U'\u1E4D' }, { U'\u00F5', U'\u0304', U'\u022D' }, { U'\u00F5', U'\u0308', U'\u1E4F' },
+        { U'\u00F6', U'\u0304', U'\u022B' }, { U'\u00F8', U'\u0301', U'\u01FF' }, { U'\u00FC', U'\u0300', U'\u01DC' }, { U'\u00FC', U'\u0301', U'\u01D8' },
+        { U'\u00FC', U'\u0304', U'\u01D6' }, { U'\u00FC', U'\u030C', U'\u01DA' }, { U'\u0102', U'\u0300', U'\u1EB0' }, { U'\u0102', U'\u0301', U'\u1EAE' },
+        { U'\u0102', U'\u0303', U'\u1EB4' }, { U'\u0102', U'\u0309', U'\u1EB2' }, { U'\u0103', U'\u0300', U'\u1EB1' }, { U'\u0103', U'\u0301', U'\u1EAF' },
+        { U'\u0103', U'\u0303', U'\u1EB5' }, { U'\u0103', U'\u0309', U'\u1EB3' }, { U'\u0112', U'\u0300', U'\u1E14' }, { U'\u0112', U'\u0301', U'\u1E16' },
+        { U'\u0113', U'\u0300', U'\u1E15' }, { U'\u0113', U'\u0301', U'\u1E17' }, { U'\u014C', U'\u0300', U'\u1E50' }, { U'\u014C', U'\u0301', U'\u1E52' },
+        { U'\u014D', U'\u0300', U'\u1E51' }, { U'\u014D', U'\u0301', U'\u1E53' }, { U'\u015A', U'\u0307', U'\u1E64' }, { U'\u015B', U'\u0307', U'\u1E65' },
+        { U'\u0160', U'\u0307', U'\u1E66' }, { U'\u0161', U'\u0307', U'\u1E67' }, { U'\u0168', U'\u0301', U'\u1E78' }, { U'\u0169', U'\u0301', U'\u1E79' },
+        { U'\u016A', U'\u0308', U'\u1E7A' }, { U'\u016B', U'\u0308', U'\u1E7B' }, { U'\u017F', U'\u0307', U'\u1E9B' }, { U'\u01A0', U'\u0300', U'\u1EDC' },
+        { U'\u01A0', U'\u0301', U'\u1EDA' }, { U'\u01A0', U'\u0303', U'\u1EE0' }, { U'\u01A0', U'\u0309', U'\u1EDE' }, { U'\u01A0', U'\u0323', U'\u1EE2' },
+        { U'\u01A1', U'\u0300', U'\u1EDD' }, { U'\u01A1', U'\u0301', U'\u1EDB' }, { U'\u01A1', U'\u0303', U'\u1EE1' }, { U'\u01A1', U'\u0309', U'\u1EDF' },
+        { U'\u01A1', U'\u0323', U'\u1EE3' }, { U'\u01AF', U'\u0300', U'\u1EEA' }, { U'\u01AF', U'\u0301', U'\u1EE8' }, { U'\u01AF', U'\u0303', U'\u1EEE' },
+        { U'\u01AF', U'\u0309', U'\u1EEC' }, { U'\u01AF', U'\u0323', U'\u1EF0' }, { U'\u01B0', U'\u0300', U'\u1EEB' }, { U'\u01B0', U'\u0301', U'\u1EE9' },
+        { U'\u01B0', U'\u0303', U'\u1EEF' }, { U'\u01B0', U'\u0309', U'\u1EED' }, { U'\u01B0', U'\u0323', U'\u1EF1' }, { U'\u01B7', U'\u030C', U'\u01EE' },
+        { U'\u01EA', U'\u0304', U'\u01EC' }, { U'\u01EB', U'\u0304', U'\u01ED' }, { U'\u0226', U'\u0304', U'\u01E0' }, { U'\u0227', U'\u0304', U'\u01E1' },
+        { U'\u0228', U'\u0306', U'\u1E1C' }, { U'\u0229', U'\u0306', U'\u1E1D' }, { U'\u022E', U'\u0304', U'\u0230' }, { U'\u022F', U'\u0304', U'\u0231' },
+        { U'\u0292', U'\u030C', U'\u01EF' }, { U'\u0391', U'\u0300', U'\u1FBA' }, { U'\u0391', U'\u0301', U'\u0386' }, { U'\u0391', U'\u0304', U'\u1FB9' },
+        { U'\u0391', U'\u0306', U'\u1FB8' }, { U'\u0391', U'\u0313', U'\u1F08' }, { U'\u0391', U'\u0314', U'\u1F09' }, { U'\u0391', U'\u0345', U'\u1FBC' },
+        { U'\u0395', U'\u0300', U'\u1FC8' }, { U'\u0395', U'\u0301', U'\u0388' }, { U'\u0395', U'\u0313', U'\u1F18' }, { U'\u0395', U'\u0314', U'\u1F19' },
+        { U'\u0397', U'\u0300', U'\u1FCA' }, { U'\u0397', U'\u0301', U'\u0389' }, { U'\u0397', U'\u0313', U'\u1F28' }, { U'\u0397', U'\u0314', U'\u1F29' },
+        { U'\u0397', U'\u0345', U'\u1FCC' }, { U'\u0399', U'\u0300', U'\u1FDA' }, { U'\u0399', U'\u0301', U'\u038A' }, { U'\u0399', U'\u0304', U'\u1FD9' },
+        { U'\u0399', U'\u0306', U'\u1FD8' }, { U'\u0399', U'\u0308', U'\u03AA' }, { U'\u0399', U'\u0313', U'\u1F38' }, { U'\u0399', U'\u0314', U'\u1F39' },
+        { U'\u039F', U'\u0300', U'\u1FF8' }, { U'\u039F', U'\u0301', U'\u038C' }, { U'\u039F', U'\u0313', U'\u1F48' }, { U'\u039F', U'\u0314', U'\u1F49' },
+        { U'\u03A1', U'\u0314', U'\u1FEC' }, { U'\u03A5', U'\u0300', U'\u1FEA' }, { U'\u03A5', U'\u0301', U'\u038E' }, { U'\u03A5', U'\u0304', U'\u1FE9' },
+        { U'\u03A5', U'\u0306', U'\u1FE8' }, { U'\u03A5', U'\u0308', U'\u03AB' }, { U'\u03A5', U'\u0314', U'\u1F59' }, { U'\u03A9', U'\u0300', U'\u1FFA' },
+        { U'\u03A9', U'\u0301', U'\u038F' }, { U'\u03A9', U'\u0313', U'\u1F68' }, { U'\u03A9', U'\u0314', U'\u1F69' }, { U'\u03A9', U'\u0345', U'\u1FFC' },
+        { U'\u03AC', U'\u0345', U'\u1FB4' }, { U'\u03AE', U'\u0345', U'\u1FC4' }, { U'\u03B1', U'\u0300', U'\u1F70' }, { U'\u03B1', U'\u0301', U'\u03AC' },
+        { U'\u03B1', U'\u0304', U'\u1FB1' }, { U'\u03B1', U'\u0306', U'\u1FB0' }, { U'\u03B1', U'\u0313', U'\u1F00' }, { U'\u03B1', U'\u0314', U'\u1F01' },
+        { U'\u03B1', U'\u0342', U'\u1FB6' }, { U'\u03B1', U'\u0345', U'\u1FB3' }, { U'\u03B5', U'\u0300', U'\u1F72' }, { U'\u03B5', U'\u0301', U'\u03AD' },
+        { U'\u03B5', U'\u0313', U'\u1F10' }, { U'\u03B5', U'\u0314', U'\u1F11' }, { U'\u03B7', U'\u0300', U'\u1F74' }, { U'\u03B7', U'\u0301', U'\u03AE' },
+        { U'\u03B7', U'\u0313', U'\u1F20' }, { U'\u03B7', U'\u0314', U'\u1F21' }, { U'\u03B7', U'\u0342', U'\u1FC6' }, { U'\u03B7', U'\u0345', U'\u1FC3' },
+        { U'\u03B9', U'\u0300', U'\u1F76' }, { U'\u03B9', U'\u0301', U'\u03AF' }, { U'\u03B9', U'\u0304', U'\u1FD1' }, { U'\u03B9', U'\u0306', U'\u1FD0' },
+        { U'\u03B9', U'\u0308', U'\u03CA' }, { U'\u03B9', U'\u0313', U'\u1F30' }, { U'\u03B9', U'\u0314', U'\u1F31' }, { U'\u03B9', U'\u0342', U'\u1FD6' },
+        { U'\u03BF', U'\u0300', U'\u1F78' }, { U'\u03BF', U'\u0301', U'\u03CC' }, { U'\u03BF', U'\u0313', U'\u1F40' }, { U'\u03BF', U'\u0314', U'\u1F41' },
+        { U'\u03C1', U'\u0313', U'\u1FE4' }, { U'\u03C1', U'\u0314', U'\u1FE5' }, { U'\u03C5', U'\u0300', U'\u1F7A' }, { U'\u03C5', U'\u0301', U'\u03CD' },
+        { U'\u03C5', U'\u0304', U'\u1FE1' }, { U'\u03C5', U'\u0306', U'\u1FE0' }, { U'\u03C5', U'\u0308', U'\u03CB' }, { U'\u03C5', U'\u0313', U'\u1F50' },
+        { U'\u03C5', U'\u0314', U'\u1F51' }, { U'\u03C5', U'\u0342', U'\u1FE6' }, { U'\u03C9', U'\u0300', U'\u1F7C' }, { U'\u03C9', U'\u0301', U'\u03CE' },
+        { U'\u03C9', U'\u0313', U'\u1F60' }, { U'\u03C9', U'\u0314', U'\u1F61' }, { U'\u03C9', U'\u0342', U'\u1FF6' }, { U'\u03C9', U'\u0345', U'\u1FF3' },
+        { U'\u03CA', U'\u0300', U'\u1FD2' }, { U'\u03CA', U'\u0301', U'\u0390' }, { U'\u03CA', U'\u0342', U'\u1FD7' }, { U'\u03CB', U'\u0300', U'\u1FE2' },
+        { U'\u03CB', U'\u0301', U'\u03B0' }, { U'\u03CB', U'\u0342', U'\u1FE7' }, { U'\u03CE', U'\u0345', U'\u1FF4' }, { U'\u03D2', U'\u0301', U'\u03D3' },
+        { U'\u03D2', U'\u0308', U'\u03D4' }, { U'\u0406', U'\u0308', U'\u0407' }, { U'\u0410', U'\u0306', U'\u04D0' }, { U'\u0410', U'\u0308', U'\u04D2' },
+        { U'\u0413', U'\u0301', U'\u0403' }, { U'\u0415', U'\u0300', U'\u0400' }, { U'\u0415', U'\u0306', U'\u04D6' }, { U'\u0415', U'\u0308', U'\u0401' },
+        { U'\u0416', U'\u0306', U'\u04C1' }, { U'\u0416', U'\u0308', U'\u04DC' }, { U'\u0417', U'\u0308', U'\u04DE' }, { U'\u0418', U'\u0300', U'\u040D' },
+        { U'\u0418', U'\u0304', U'\u04E2' }, { U'\u0418', U'\u0306', U'\u0419' }, { U'\u0418', U'\u0308', U'\u04E4' }, { U'\u041A', U'\u0301', U'\u040C' },
+        { U'\u041E', U'\u0308', U'\u04E6' }, { U'\u0423', U'\u0304', U'\u04EE' }, { U'\u0423', U'\u0306', U'\u040E' }, { U'\u0423', U'\u0308', U'\u04F0' },
+        { U'\u0423', U'\u030B', U'\u04F2' }, { U'\u0427', U'\u0308', U'\u04F4' }, { U'\u042B', U'\u0308', U'\u04F8' }, { U'\u042D', U'\u0308', U'\u04EC' },
+        { U'\u0430', U'\u0306', U'\u04D1' }, { U'\u0430', U'\u0308', U'\u04D3' }, { U'\u0433', U'\u0301', U'\u0453' }, { U'\u0435', U'\u0300', U'\u0450' },
+        { U'\u0435', U'\u0306', U'\u04D7' }, { U'\u0435', U'\u0308', U'\u0451' }, { U'\u0436', U'\u0306', U'\u04C2' }, { U'\u0436', U'\u0308', U'\u04DD' },
+        { U'\u0437', U'\u0308', U'\u04DF' }, { U'\u0438', U'\u0300', U'\u045D' }, { U'\u0438', U'\u0304', U'\u04E3' }, { U'\u0438', U'\u0306', U'\u0439' },
+        { U'\u0438', U'\u0308', U'\u04E5' }, { U'\u043A', U'\u0301', U'\u045C' }, { U'\u043E', U'\u0308', U'\u04E7' }, { U'\u0443', U'\u0304', U'\u04EF' },
+        { U'\u0443', U'\u0306', U'\u045E' }, { U'\u0443', U'\u0308', U'\u04F1' }, { U'\u0443', U'\u030B', U'\u04F3' }, { U'\u0447', U'\u0308', U'\u04F5' },
+        { U'\u044B', U'\u0308', U'\u04F9' }, { U'\u044D', U'\u0308', U'\u04ED' }, { U'\u0456', U'\u0308', U'\u0457' }, { U'\u0474', U'\u030F', U'\u0476' },
+        { U'\u0475', U'\u030F', U'\u0477' }, { U'\u04D8', U'\u0308', U'\u04DA' }, { U'\u04D9', U'\u0308', U'\u04DB' }, { U'\u04E8', U'\u0308', U'\u04EA' },
+        { U'\u04E9', U'\u0308', U'\u04EB' }, { U'\u0627', U'\u0653', U'\u0622' }, { U'\u0627', U'\u0654', U'\u0623' }, { U'\u0627', U'\u0655', U'\u0625' },
+        { U'\u0648', U'\u0654', U'\u0624' }, { U'\u064A', U'\u0654', U'\u0626' }, { U'\u06C1', U'\u0654', U'\u06C2' }, { U'\u06D2', U'\u0654', U'\u06D3' },
+        { U'\u06D5', U'\u0654', U'\u06C0' }, { U'\u0928', U'\u093C', U'\u0929' }, { U'\u0930', U'\u093C', U'\u0931' }, { U'\u0933', U'\u093C', U'\u0934' },
+        { U'\u09C7', U'\u09BE', U'\u09CB' }, { U'\u09C7', U'\u09D7', U'\u09CC' }, { U'\u0B47', U'\u0B3E', U'\u0B4B' }, { U'\u0B47', U'\u0B56', U'\u0B48' },
+        { U'\u0B47', U'\u0B57', U'\u0B4C' }, { U'\u0B92', U'\u0BD7', U'\u0B94' }, { U'\u0BC6', U'\u0BBE', U'\u0BCA' }, { U'\u0BC6', U'\u0BD7', U'\u0BCC' },
+        { U'\u0BC7', U'\u0BBE', U'\u0BCB' }, { U'\u0C46', U'\u0C56', U'\u0C48' }, { U'\u0CBF', U'\u0CD5', U'\u0CC0' }, { U'\u0CC6', U'\u0CC2', U'\u0CCA' },
+        { U'\u0CC6', U'\u0CD5', U'\u0CC7' }, { U'\u0CC6', U'\u0CD6', U'\u0CC8' }, { U'\u0CCA', U'\u0CD5', U'\u0CCB' }, { U'\u0D46', U'\u0D3E', U'\u0D4A' },
+        { U'\u0D46', U'\u0D57', U'\u0D4C' }, { U'\u0D47', U'\u0D3E', U'\u0D4B' }, { U'\u0DD9', U'\u0DCA', U'\u0DDA' }, { U'\u0DD9', U'\u0DCF', U'\u0DDC' },
+        { U'\u0DD9', U'\u0DDF', U'\u0DDE' }, { U'\u0DDC', U'\u0DCA', U'\u0DDD' }, { U'\u1025', U'\u102E', U'\u1026' }, { U'\u1B05', U'\u1B35', U'\u1B06' },
+        { U'\u1B07', U'\u1B35', U'\u1B08' }, { U'\u1B09', U'\u1B35', U'\u1B0A' }, { U'\u1B0B', U'\u1B35', U'\u1B0C' }, { U'\u1B0D', U'\u1B35', U'\u1B0E' },
+        { U'\u1B11', U'\u1B35', U'\u1B12' }, { U'\u1B3A', U'\u1B35', U'\u1B3B' }, { U'\u1B3C', U'\u1B35', U'\u1B3D' }, { U'\u1B3E', U'\u1B35', U'\u1B40' },
+        { U'\u1B3F', U'\u1B35', U'\u1B41' }, { U'\u1B42', U'\u1B35', U'\u1B43' }, { U'\u1E36', U'\u0304', U'\u1E38' }, { U'\u1E37', U'\u0304', U'\u1E39' },
+        { U'\u1E5A', U'\u0304', U'\u1E5C' }, { U'\u1E5B', U'\u0304', U'\u1E5D' }, { U'\u1E62', U'\u0307', U'\u1E68' }, { U'\u1E63', U'\u0307', U'\u1E69' },
+        { U'\u1EA0', U'\u0302', U'\u1EAC' }, { U'\u1EA0', U'\u0306', U'\u1EB6' }, { U'\u1EA1', U'\u0302', U'\u1EAD' }, { U'\u1EA1', U'\u0306', U'\u1EB7' },
+        { U'\u1EB8', U'\u0302', U'\u1EC6' }, { U'\u1EB9', U'\u0302', U'\u1EC7' }, { U'\u1ECC', U'\u0302', U'\u1ED8' }, { U'\u1ECD', U'\u0302', U'\u1ED9' },
+        { U'\u1F00', U'\u0300', U'\u1F02' }, { U'\u1F00', U'\u0301', U'\u1F04' }, { U'\u1F00', U'\u0342', U'\u1F06' }, { U'\u1F00', U'\u0345', U'\u1F80' },
+        { U'\u1F01', U'\u0300', U'\u1F03' }, { U'\u1F01', U'\u0301', U'\u1F05' }, { U'\u1F01', U'\u0342', U'\u1F07' }, { U'\u1F01', U'\u0345', U'\u1F81' },
+        { U'\u1F02', U'\u0345', U'\u1F82' }, { U'\u1F03', U'\u0345', U'\u1F83' }, { U'\u1F04', U'\u0345', U'\u1F84' }, { U'\u1F05', U'\u0345', U'\u1F85' },
+        { U'\u1F06', U'\u0345', U'\u1F86' }, { U'\u1F07', U'\u0345', U'\u1F87' }, { U'\u1F08', U'\u0300', U'\u1F0A' }, { U'\u1F08', U'\u0301', U'\u1F0C' },
+        { U'\u1F08', U'\u0342', U'\u1F0E' }, { U'\u1F08', U'\u0345', U'\u1F88' }, { U'\u1F09', U'\u0300', U'\u1F0B' }, { U'\u1F09', U'\u0301', U'\u1F0D' },
+        { U'\u1F09', U'\u0342', U'\u1F0F' }, { U'\u1F09', U'\u0345', U'\u1F89' }, { U'\u1F0A', U'\u0345', U'\u1F8A' }, { U'\u1F0B', U'\u0345', U'\u1F8B' },
+        { U'\u1F0C', U'\u0345', U'\u1F8C' }, { U'\u1F0D', U'\u0345', U'\u1F8D' }, { U'\u1F0E', U'\u0345', U'\u1F8E' }, { U'\u1F0F', U'\u0345', U'\u1F8F' },
+        { U'\u1F10', U'\u0300', U'\u1F12' }, { U'\u1F10', U'\u0301', U'\u1F14' }, { U'\u1F11', U'\u0300', U'\u1F13' }, { U'\u1F11', U'\u0301', U'\u1F15' },
+        { U'\u1F18', U'\u0300', U'\u1F1A' }, { U'\u1F18', U'\u0301', U'\u1F1C' }, { U'\u1F19', U'\u0300', U'\u1F1B' }, { U'\u1F19', U'\u0301', U'\u1F1D' },
+        { U'\u1F20', U'\u0300', U'\u1F22' }, { U'\u1F20', U'\u0301', U'\u1F24' }, { U'\u1F20', U'\u0342', U'\u1F26' }, { U'\u1F20', U'\u0345', U'\u1F90' },
+        { U'\u1F21', U'\u0300', U'\u1F23' }, { U'\u1F21', U'\u0301', U'\u1F25' }, { U'\u1F21', U'\u0342', U'\u1F27' }, { U'\u1F21', U'\u0345', U'\u1F91' },
+        { U'\u1F22', U'\u0345', U'\u1F92' }, { U'\u1F23', U'\u0345', U'\u1F93' }, { U'\u1F24', U'\u0345', U'\u1F94' }, { U'\u1F25', U'\u0345', U'\u1F95' },
+        { U'\u1F26', U'\u0345', U'\u1F96' }, { U'\u1F27', U'\u0345', U'\u1F97' }, { U'\u1F28', U'\u0300', U'\u1F2A' }, { U'\u1F28', U'\u0301', U'\u1F2C' },
+        { U'\u1F28', U'\u0342', U'\u1F2E' }, { U'\u1F28', U'\u0345', U'\u1F98' }, { U'\u1F29', U'\u0300', U'\u1F2B' }, { U'\u1F29', U'\u0301', U'\u1F2D' },
+        { U'\u1F29', U'\u0342', U'\u1F2F' }, { U'\u1F29', U'\u0345', U'\u1F99' }, { U'\u1F2A', U'\u0345', U'\u1F9A' }, { U'\u1F2B', U'\u0345', U'\u1F9B' },
+        { U'\u1F2C', U'\u0345', U'\u1F9C' }, { U'\u1F2D', U'\u0345', U'\u1F9D' }, { U'\u1F2E', U'\u0345', U'\u1F9E' }, { U'\u1F2F', U'\u0345', U'\u1F9F' },
+        { U'\u1F30', U'\u0300', U'\u1F32' }, { U'\u1F30', U'\u0301', U'\u1F34' }, { U'\u1F30', U'\u0342', U'\u1F36' }, { U'\u1F31', U'\u0300', U'\u1F33' },
+        { U'\u1F31', U'\u0301', U'\u1F35' }, { U'\u1F31', U'\u0342', U'\u1F37' }, { U'\u1F38', U'\u0300', U'\u1F3A' }, { U'\u1F38', U'\u0301', U'\u1F3C' },
+        { U'\u1F38', U'\u0342', U'\u1F3E' }, { U'\u1F39', U'\u0300', U'\u1F3B' }, { U'\u1F39', U'\u0301', U'\u1F3D' }, { U'\u1F39', U'\u0342', U'\u1F3F' },
+        { U'\u1F40', U'\u0300', U'\u1F42' }, { U'\u1F40', U'\u0301', U'\u1F44' }, { U'\u1F41', U'\u0300', U'\u1F43' }, { U'\u1F41', U'\u0301', U'\u1F45' },
+        { U'\u1F48', U'\u0300', U'\u1F4A' }, { U'\u1F48', U'\u0301', U'\u1F4C' }, { U'\u1F49', U'\u0300', U'\u1F4B' }, { U'\u1F49', U'\u0301', U'\u1F4D' },
+        { U'\u1F50', U'\u0300', U'\u1F52' }, { U'\u1F50', U'\u0301', U'\u1F54' }, { U'\u1F50', U'\u0342', U'\u1F56' }, { U'\u1F51', U'\u0300', U'\u1F53' },
+        { U'\u1F51', U'\u0301', U'\u1F55' }, { U'\u1F51', U'\u0342', U'\u1F57' }, { U'\u1F59', U'\u0300', U'\u1F5B' }, { U'\u1F59', U'\u0301', U'\u1F5D' },
+        { U'\u1F59', U'\u0342', U'\u1F5F' }, { U'\u1F60', U'\u0300', U'\u1F62' }, { U'\u1F60', U'\u0301', U'\u1F64' }, { U'\u1F60', U'\u0342', U'\u1F66' },
+        { U'\u1F60', U'\u0345', U'\u1FA0' }, { U'\u1F61', U'\u0300', U'\u1F63' }, { U'\u1F61', U'\u0301', U'\u1F65' }, { U'\u1F61', U'\u0342', U'\u1F67' },
+        { U'\u1F61', U'\u0345', U'\u1FA1' }, { U'\u1F62', U'\u0345', U'\u1FA2' }, { U'\u1F63', U'\u0345', U'\u1FA3' }, { U'\u1F64', U'\u0345', U'\u1FA4' },
+        { U'\u1F65', U'\u0345', U'\u1FA5' }, { U'\u1F66', U'\u0345', U'\u1FA6' }, { U'\u1F67', U'\u0345', U'\u1FA7' }, { U'\u1F68', U'\u0300', U'\u1F6A' },
+        { U'\u1F68', U'\u0301', U'\u1F6C' }, { U'\u1F68', U'\u0342', U'\u1F6E' }, { U'\u1F68', U'\u0345', U'\u1FA8' }, { U'\u1F69', U'\u0300', U'\u1F6B' },
+        { U'\u1F69', U'\u0301', U'\u1F6D' }, { U'\u1F69', U'\u0342', U'\u1F6F' }, { U'\u1F69', U'\u0345', U'\u1FA9' }, { U'\u1F6A', U'\u0345', U'\u1FAA' },
+        { U'\u1F6B', U'\u0345', U'\u1FAB' }, { U'\u1F6C', U'\u0345', U'\u1FAC' }, { U'\u1F6D', U'\u0345', U'\u1FAD' }, { U'\u1F6E', U'\u0345', U'\u1FAE' },
+        { U'\u1F6F', U'\u0345', U'\u1FAF' }, { U'\u1F70', U'\u0345', U'\u1FB2' }, { U'\u1F74', U'\u0345', U'\u1FC2' }, { U'\u1F7C', U'\u0345', U'\u1FF2' },
+        { U'\u1FB6', U'\u0345', U'\u1FB7' }, { U'\u1FBF', U'\u0300', U'\u1FCD' }, { U'\u1FBF', U'\u0301', U'\u1FCE' }, { U'\u1FBF', U'\u0342', U'\u1FCF' },
+        { U'\u1FC6', U'\u0345', U'\u1FC7' }, { U'\u1FF6', U'\u0345', U'\u1FF7' }, { U'\u1FFE', U'\u0300', U'\u1FDD' }, { U'\u1FFE', U'\u0301', U'\u1FDE' },
+        { U'\u1FFE', U'\u0342', U'\u1FDF' }, { U'\u2190', U'\u0338', U'\u219A' }, { U'\u2192', U'\u0338', U'\u219B' }, { U'\u2194', U'\u0338', U'\u21AE' },
+        { U'\u21D0', U'\u0338', U'\u21CD' }, { U'\u21D2', U'\u0338', U'\u21CF' }, { U'\u21D4', U'\u0338', U'\u21CE' }, { U'\u2203', U'\u0338', U'\u2204' },
+        { U'\u2208', U'\u0338', U'\u2209' }, { U'\u220B', U'\u0338', U'\u220C' }, { U'\u2223', U'\u0338', U'\u2224' }, { U'\u2225', U'\u0338', U'\u2226' },
+        { U'\u223C', U'\u0338', U'\u2241' }, { U'\u2243', U'\u0338', U'\u2244' }, { U'\u2245', U'\u0338', U'\u2247' }, { U'\u2248', U'\u0338', U'\u2249' },
+        { U'\u224D', U'\u0338', U'\u226D' }, { U'\u2261', U'\u0338', U'\u2262' }, { U'\u2264', U'\u0338', U'\u2270' }, { U'\u2265', U'\u0338', U'\u2271' },
+        { U'\u2272', U'\u0338', U'\u2274' }, { U'\u2273', U'\u0338', U'\u2275' }, { U'\u2276', U'\u0338', U'\u2278' }, { U'\u2277', U'\u0338', U'\u2279' },
+        { U'\u227A', U'\u0338', U'\u2280' }, { U'\u227B', U'\u0338', U'\u2281' }, { U'\u227C', U'\u0338', U'\u22E0' }, { U'\u227D', U'\u0338', U'\u22E1' },
+        { U'\u2282', U'\u0338', U'\u2284' }, { U'\u2283', U'\u0338', U'\u2285' }, { U'\u2286', U'\u0338', U'\u2288' }, { U'\u2287', U'\u0338', U'\u2289' },
+        { U'\u2291', U'\u0338', U'\u22E2' }, { U'\u2292', U'\u0338', U'\u22E3' }, { U'\u22A2', U'\u0338', U'\u22AC' }, { U'\u22A8', U'\u0338', U'\u22AD' },
+        { U'\u22A9', U'\u0338', U'\u22AE' }, { U'\u22AB', U'\u0338', U'\u22AF' }, { U'\u22B2', U'\u0338', U'\u22EA' }, { U'\u22B3', U'\u0338', U'\u22EB' },
+        { U'\u22B4', U'\u0338', U'\u22EC' }, { U'\u22B5', U'\u0338', U'\u22ED' }, { U'\u3046', U'\u3099', U'\u3094' }, { U'\u304B', U'\u3099', U'\u304C' },
+        { U'\u304D', U'\u3099', U'\u304E' }, { U'\u304F', U'\u3099', U'\u3050' }, { U'\u3051', U'\u3099', U'\u3052' }, { U'\u3053', U'\u3099', U'\u3054' },
+        { U'\u3055', U'\u3099', U'\u3056' }, { U'\u3057', U'\u3099', U'\u3058' }, { U'\u3059', U'\u3099', U'\u305A' }, { U'\u305B', U'\u3099', U'\u305C' },
+        { U'\u305D', U'\u3099', U'\u305E' }, { U'\u305F', U'\u3099', U'\u3060' }, { U'\u3061', U'\u3099', U'\u3062' }, { U'\u3064', U'\u3099', U'\u3065' },
+        { U'\u3066', U'\u3099', U'\u3067' }, { U'\u3068', U'\u3099', U'\u3069' }, { U'\u306F', U'\u3099', U'\u3070' }, { U'\u306F', U'\u309A', U'\u3071' },
+        { U'\u3072', U'\u3099', U'\u3073' }, { U'\u3072', U'\u309A', U'\u3074' }, { U'\u3075', U'\u3099', U'\u3076' }, { U'\u3075', U'\u309A', U'\u3077' },
+        { U'\u3078', U'\u3099', U'\u3079' }, { U'\u3078', U'\u309A', U'\u307A' }, { U'\u307B', U'\u3099', U'\u307C' }, { U'\u307B', U'\u309A', U'\u307D' },
+        { U'\u309D', U'\u3099', U'\u309E' }, { U'\u30A6', U'\u3099', U'\u30F4' }, { U'\u30AB', U'\u3099', U'\u30AC' }, { U'\u30AD', U'\u3099', U'\u30AE' },
+        { U'\u30AF', U'\u3099', U'\u30B0' }, { U'\u30B1', U'\u3099', U'\u30B2' }, { U'\u30B3', U'\u3099', U'\u30B4' }, { U'\u30B5', U'\u3099', U'\u30B6' },
+        { U'\u30B7', U'\u3099', U'\u30B8' }, { U'\u30B9', U'\u3099', U'\u30BA' }, { U'\u30BB', U'\u3099', U'\u30BC' }, { U'\u30BD', U'\u3099', U'\u30BE' },
+        { U'\u30BF', U'\u3099', U'\u30C0' }, { U'\u30C1', U'\u3099', U'\u30C2' }, { U'\u30C4', U'\u3099', U'\u30C5' }, { U'\u30C6', U'\u3099', U'\u30C7' },
+        { U'\u30C8', U'\u3099', U'\u30C9' }, { U'\u30CF', U'\u3099', U'\u30D0' }, { U'\u30CF', U'\u309A', U'\u30D1' }, { U'\u30D2', U'\u3099', U'\u30D3' },
+        { U'\u30D2', U'\u309A', U'\u30D4' }, { U'\u30D5', U'\u3099', U'\u30D6' }, { U'\u30D5', U'\u309A', U'\u30D7' }, { U'\u30D8', U'\u3099', U'\u30D9' },
+        { U'\u30D8', U'\u309A', U'\u30DA' }, { U'\u30DB', U'\u3099', U'\u30DC' }, { U'\u30DB', U'\u309A', U'\u30DD' }, { U'\u30EF', U'\u3099', U'\u30F7' },
+        { U'\u30F0', U'\u3099', U'\u30F8' }, { U'\u30F1', U'\u3099', U'\u30F9' }, { U'\u30F2', U'\u3099', U'\u30FA' }, { U'\u30FD', U'\u3099', U'\u30FE' },
+        { U'\U000105D2', U'\u0307', U'\U000105C9' }, { U'\U000105DA', U'\u0307', U'\U000105E4' }, { U'\U00011099', U'\U000110BA', U'\U0001109A' },
+        { U'\U0001109B', U'\U000110BA', U'\U0001109C' }, { U'\U000110A5', U'\U000110BA', U'\U000110AB' }, { U'\U00011131', U'\U00011127', U'\U0001112E' },
+        { U'\U00011132', U'\U00011127', U'\U0001112F' }, { U'\U00011347', U'\U0001133E', U'\U0001134B' }, { U'\U00011347', U'\U00011357', U'\U0001134C' },
+        { U'\U00011382', U'\U000113C9', U'\U00011383' }, { U'\U00011384', U'\U000113BB', U'\U00011385' }, { U'\U0001138B', U'\U000113C2', U'\U0001138E' },
+        { U'\U00011390', U'\U000113C9', U'\U00011391' }, { U'\U000113C2', U'\U000113B8', U'\U000113C7' }, { U'\U000113C2', U'\U000113C2', U'\U000113C5' },
+        { U'\U000113C2', U'\U000113C9', U'\U000113C8' }, { U'\U000114B9', U'\U000114B0', U'\U000114BC' }, { U'\U000114B9', U'\U000114BA', U'\U000114BB' },
+        { U'\U000114B9', U'\U000114BD', U'\U000114BE' }, { U'\U000115B8', U'\U000115AF', U'\U000115BA' }, { U'\U000115B9', U'\U000115AF', U'\U000115BB' },
+        { U'\U00011935', U'\U00011930', U'\U00011938' }, { U'\U0001611E', U'\U0001611E', U'\U00016121' }, { U'\U0001611E', U'\U0001611F', U'\U00016123' },
+        { U'\U0001611E', U'\U00016120', U'\U00016125' }, { U'\U0001611E', U'\U00016129', U'\U00016122' }, { U'\U00016121', U'\U0001611F', U'\U00016126' },
+        { U'\U00016121', U'\U00016120', U'\U00016128' }, { U'\U00016122', U'\U0001611F', U'\U00016127' }, { U'\U00016129', U'\U0001611F', U'\U00016124' },
+        { U'\U00016D63', U'\U00016D67', U'\U00016D69' }, { U'\U00016D67', U'\U00016D67', U'\U00016D68' }, { U'\U00016D69', U'\U00016D67', U'\U00016D6A' }
+    };
+    // clang-format on
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Normalization properties of `c`.
+    /// @note Hangul syllables have no decomposition stored, they're decomposed algorithmically.
+    constexpr const normalization_record& dchar_normalization_record(const char32_t c) noexcept
+    {
+        if (c >= normalization_limit)
+            return normalization_records[0];
+        const size_t block = normalization_stage1[c >> normalization_shift];
+        return normalization_records[normalization_stage2[(block << normalization_shift) | (c & ((1uz << normalization_shift) - 1uz))]];
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Full canonical, or with `compat` compatibility, decomposition of `c`, empty if `c` decomposes to itself.
+    constexpr std::u32string_view dchar_decomposition(const char32_t c, const bool compat) noexcept
+    {
+        const normalization_record& record = dchar_normalization_record(c);
+        if (compat)
+            return std::u32string_view(normalization_decompositions + record.compat_offset, record.compat_size);
+        return std::u32string_view(normalization_decompositions + record.canonical_offset, record.canonical_size);
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Primary composite of `first` and `second`, or U+0000 if there is none.
+    /// @note Hangul syllables aren't included, they're composed algorithmically.
+    constexpr char32_t dchar_compose(const char32_t first, const char32_t second) noexcept
+    {
+        size_t lo = 0uz, hi = std::size(normalization_compositions);
+        while (lo < hi)
+        {
+            const size_t mid = lo + (hi - lo) / 2uz;
+            const normalization_composition& at = normalization_compositions[mid];
+            if (at.first < first || (at.first == first && at.second < second))
+                lo = mid + 1uz;
+            else
+                hi = mid;
+        }
+        if (lo < std::size(normalization_compositions) && normalization_compositions[lo].first == first && normalization_compositions[lo].second == second)
+            return normalization_compositions[lo].composite;
+        return U'\0';
+    }
+} // namespace sys::internal
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index, cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,1139 @@
+#pragma once
+
+/// @file UnicodeSegmentation.h
+/// @brief Generated by `workflows/scripts/generate_unicode_segmentation.py`.
+/// @note If this file is out of date, please regenerate it!
+
+#include <cstddef>
+#include <cstdint>
+
+#include <LanguageSupport.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Unicode Grapheme_Cluster_Break property, see UAX #29.
+    enum class grapheme_break : uint_least8_t
+    {
+        other,
+        cr,
+        lf,
+        control,
+        extend,
+        zwj,
+        regional_indicator,
+        prepend,
+        spacing_mark,
+        l,
+        v,
+        t,
+        lv,
+        lvt
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Unicode Word_Break property, see UAX #29.
+    enum class word_break : uint_least8_t
+    {
+        other,
+        cr,
+        lf,
+        newline,
+        extend,
+        zwj,
+        regional_indicator,
+        format,
+        katakana,
+        hebrew_letter,
+        aletter,
+        single_quote,
+        double_quote,
+        mid_num_let,
+        mid_letter,
+        mid_num,
+        numeric,
+        extend_num_let,
+        wseg_space
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Unicode Indic_Conjunct_Break property, see UAX #29.
+    enum class indic_conjunct_break : uint_least8_t
+    {
+        none,
+        consonant,
+        extend,
+        linker
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Segmentation properties shared by a set of codepoints.
+    struct segmentation_record
+    {
+        uint_least8_t grapheme;
+        uint_least8_t word;
+        uint_least8_t flags;
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t segmentation_flag_incb_mask = 0x3u;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr uint_least8_t segmentation_flag_extended_pictographic = 0x4u;
+
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr size_t segmentation_shift = 7uz;
+    /// @internal
+    /// @ingroup sys_internal
+    inline constexpr char32_t segmentation_limit = U'\U000E1000';
+
+    // clang-format off
+    inline constexpr segmentation_record segmentation_records[] = {
+        { 0u, 0u, 0x0u }, { 3u, 0u, 0x0u }, { 2u, 2u, 0x0u }, { 3u, 3u, 0x0u }, { 1u, 1u, 0x0u }, { 0u, 18u, 0x0u }, { 0u, 12u, 0x0u }, { 0u, 11u, 0x0u }, { 0u, 15u, 0x0u },
+        { 0u, 13u, 0x0u }, { 0u, 16u, 0x0u }, { 0u, 14u, 0x0u }, { 0u, 10u, 0x0u }, { 0u, 17u, 0x0u }, { 0u, 0u, 0x4u }, { 3u, 7u, 0x0u }, { 4u, 4u, 0x2u }, { 0u, 9u, 0x0u },
+        { 7u, 16u, 0x0u }, { 7u, 10u, 0x0u }, { 8u, 4u, 0x0u }, { 0u, 10u, 0x1u }, { 4u, 4u, 0x3u }, { 8u, 0u, 0x0u }, { 0u, 4u, 0x0u }, { 9u, 10u, 0x0u }, { 10u, 10u, 0x0u },
+        { 11u, 10u, 0x0u }, { 4u, 4u, 0x0u }, { 5u, 5u, 0x2u }, { 0u, 10u, 0x4u }, { 0u, 8u, 0x0u }, { 12u, 10u, 0x0u }, { 13u, 10u, 0x0u }, { 6u, 6u, 0x0u }
+    };
+    inline constexpr uint_least8_t segmentation_stage1[] = {
+        0u, 1u, 2u, 2u, 2u, 3u, 4u, 5u, 2u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u, 17u, 18u, 19u, 20u, 21u, 22u, 23u, 24u, 25u, 26u, 27u, 28u, 29u, 30u, 31u, 32u, 33u,
+        34u, 35u, 36u, 37u, 2u, 2u, 2u, 38u, 39u, 40u, 41u, 42u, 43u, 44u, 45u, 46u, 47u, 48u, 49u, 50u, 51u, 2u, 52u, 2u, 2u, 53u, 54u, 55u, 56u, 57u, 58u, 59u, 59u, 60u, 61u,
+        59u, 62u, 59u, 63u, 64u, 65u, 66u, 67u, 59u, 59u, 68u, 59u, 59u, 59u, 69u, 59u, 2u, 70u, 71u, 72u, 73u, 59u, 59u, 59u, 74u, 75u, 76u, 77u, 59u, 78u, 79u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 80u, 2u, 2u, 81u, 82u, 83u, 84u, 85u, 86u, 87u, 88u, 89u, 90u, 91u, 92u, 93u, 94u,
+        95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u,
+        94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u,
+        93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 96u, 97u, 98u, 99u, 93u, 94u, 95u, 100u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 101u, 102u, 2u, 2u, 103u, 104u, 105u, 106u, 107u, 108u, 109u, 110u,
+        111u, 112u, 59u, 113u, 114u, 115u, 2u, 116u, 117u, 118u, 2u, 2u, 119u, 120u, 121u, 122u, 123u, 124u, 125u, 126u, 127u, 128u, 129u, 130u, 131u, 132u, 59u, 133u, 134u, 135u,
+        136u, 137u, 138u, 139u, 140u, 141u, 142u, 143u, 144u, 145u, 59u, 146u, 147u, 148u, 149u, 59u, 150u, 151u, 152u, 153u, 154u, 155u, 59u, 156u, 157u, 158u, 159u, 160u, 59u,
+        161u, 162u, 163u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 164u, 165u, 2u, 166u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        167u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 168u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 110u,
+        2u, 2u, 2u, 2u, 169u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 170u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 2u, 2u, 2u, 2u, 171u, 172u, 173u, 174u, 59u, 59u, 175u, 59u, 176u, 59u, 177u, 178u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 179u, 180u, 59u, 181u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 182u, 183u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 184u, 59u, 59u, 59u, 59u, 185u, 59u, 59u, 59u, 186u, 187u, 188u, 59u, 59u, 59u, 189u, 190u, 191u, 2u, 2u, 192u, 193u, 194u, 59u, 59u, 59u, 59u, 195u, 196u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 197u, 59u, 198u, 199u, 200u, 59u, 59u, 201u, 59u, 59u, 59u, 202u, 59u, 203u, 59u, 59u, 59u, 204u, 2u, 205u, 206u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 207u, 208u, 59u, 59u, 209u, 209u, 210u, 211u, 212u, 209u, 209u, 213u, 209u, 209u, 214u, 209u, 215u, 209u, 216u, 217u, 218u, 219u, 220u, 209u,
+        209u, 209u, 59u, 184u, 209u, 209u, 209u, 209u, 209u, 209u, 209u, 221u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u, 59u,
+        59u, 59u, 59u, 59u, 222u, 223u, 224u, 225u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u, 223u,
+        223u, 223u, 223u, 223u, 223u, 223u, 223u
+    };
+    inline constexpr uint_least8_t segmentation_stage2[] = {
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 2u, 3u, 3u, 4u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 5u, 0u, 6u, 0u, 0u, 0u, 0u, 7u, 0u, 0u, 0u,
+        0u, 8u, 0u, 9u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 11u, 8u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 13u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 12u, 0u, 0u, 15u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 11u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u,
+        8u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 11u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 11u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 8u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 0u, 16u, 0u, 16u, 16u, 0u, 16u, 16u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u,
+        17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 0u, 0u, 0u, 0u, 17u, 17u, 17u, 17u, 12u, 11u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 18u, 18u, 18u, 18u, 18u,
+        18u, 0u, 0u, 0u, 0u, 0u, 0u, 8u, 8u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 15u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 10u, 8u, 0u, 12u,
+        12u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 18u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 12u, 12u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 12u, 12u, 12u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 19u, 12u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 0u, 0u, 8u, 0u, 12u, 0u, 0u, 16u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 16u, 16u, 16u, 12u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 18u, 18u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        18u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u,
+        21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 16u, 20u, 16u, 12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 20u, 20u, 20u, 20u, 22u, 20u, 20u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 12u, 12u, 16u, 16u, 0u, 0u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 12u, 16u, 20u, 20u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 12u, 12u, 0u, 0u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 0u, 21u, 21u, 21u, 21u, 21u,
+        21u, 21u, 0u, 21u, 0u, 0u, 0u, 21u, 21u, 21u, 21u, 0u, 0u, 16u, 12u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 0u, 0u, 20u, 20u, 0u, 0u, 20u, 20u, 22u, 12u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 21u, 21u, 0u, 21u, 12u, 12u, 16u, 16u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 21u, 21u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 12u, 0u, 16u, 0u, 0u, 16u, 16u, 20u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 0u, 0u, 16u, 0u, 20u, 20u, 20u,
+        16u, 16u, 0u, 0u, 0u, 0u, 16u, 16u, 0u, 0u, 16u, 16u, 16u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 16u, 16u, 12u, 12u, 12u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 20u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 0u, 21u, 21u, 21u, 21u, 21u,
+        21u, 21u, 0u, 21u, 21u, 0u, 21u, 21u, 21u, 21u, 21u, 0u, 0u, 16u, 12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u, 20u, 0u, 20u, 20u, 22u, 0u, 0u, 12u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 16u, 16u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 21u,
+        16u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 20u, 20u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 0u, 0u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u,
+        21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 0u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 0u, 21u, 21u, 0u, 21u, 21u, 21u, 21u, 21u, 0u, 0u, 16u, 12u, 16u, 16u,
+        20u, 16u, 16u, 16u, 16u, 0u, 0u, 20u, 20u, 0u, 0u, 20u, 20u, 22u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 21u, 21u, 0u, 21u, 12u, 12u, 16u, 16u, 0u, 0u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 21u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        0u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 16u, 20u, 16u, 20u, 20u, 0u, 0u, 0u, 20u, 20u, 20u, 0u, 20u, 20u, 20u, 16u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u,
+        0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 16u, 20u, 20u, 20u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u,
+        21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 0u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 0u, 0u, 16u, 12u, 16u, 16u, 16u, 20u, 20u, 20u,
+        20u, 0u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 22u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 0u, 21u, 21u, 21u, 0u, 0u, 12u, 0u, 0u, 12u, 12u, 16u, 16u, 0u, 0u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 16u, 20u, 20u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 16u, 12u, 20u, 16u, 16u, 20u, 16u, 20u, 20u, 0u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 0u, 12u, 12u, 16u, 16u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 12u, 12u, 20u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 20u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u,
+        21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 21u, 16u, 16u, 12u, 16u, 20u,
+        20u, 16u, 16u, 16u, 16u, 0u, 20u, 20u, 20u, 0u, 20u, 20u, 20u, 22u, 19u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 16u, 16u, 0u,
+        0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 16u, 20u, 20u, 0u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 16u, 20u,
+        20u, 16u, 16u, 16u, 0u, 16u, 0u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 20u, 20u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 23u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 23u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 16u,
+        0u, 16u, 0u, 0u, 0u, 0u, 20u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 20u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 24u, 24u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 24u, 16u, 16u, 20u, 20u, 16u,
+        16u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 20u, 20u, 16u, 16u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 0u, 24u, 24u,
+        24u, 0u, 0u, 24u, 24u, 24u, 24u, 24u, 24u, 24u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 24u, 20u, 16u, 16u, 24u, 24u, 24u,
+        24u, 24u, 24u, 16u, 0u, 24u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 24u, 24u, 24u, 16u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u,
+        25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u,
+        25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u,
+        25u, 25u, 25u, 25u, 25u, 25u, 25u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u,
+        26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u,
+        26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u,
+        27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u,
+        27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u,
+        12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u,
+        12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 0u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 5u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 0u, 16u, 16u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 20u, 20u, 20u, 20u, 20u, 20u,
+        20u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 15u, 16u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 16u, 16u, 16u, 20u, 20u, 20u, 20u,
+        16u, 16u, 20u, 20u, 20u, 0u, 0u, 0u, 0u, 20u, 20u, 16u, 20u, 20u, 20u, 20u, 20u, 20u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u,
+        16u, 20u, 20u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 20u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 24u, 16u, 24u, 24u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 20u, 20u, 20u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 16u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u,
+        0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        16u, 16u, 16u, 16u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 20u, 20u, 20u, 16u, 16u,
+        16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 16u, 16u, 16u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 16u, 16u, 20u, 20u, 20u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 20u, 16u, 16u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 12u, 12u, 12u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 12u,
+        12u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 12u, 12u, 20u, 16u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 0u,
+        12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 0u, 0u, 12u, 12u, 12u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 0u, 5u, 5u, 5u, 1u, 28u, 29u, 15u,
+        15u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 9u, 9u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 9u, 0u, 0u, 11u, 3u, 3u, 15u, 15u, 15u, 15u, 15u, 13u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 14u, 0u, 0u, 13u, 13u, 0u, 0u, 0u, 8u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 13u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 15u,
+        15u, 15u, 15u, 15u, 1u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u,
+        14u, 0u, 12u, 0u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 30u, 0u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 30u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u,
+        14u, 14u, 14u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 0u, 14u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 14u, 0u, 14u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u,
+        14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u,
+        12u, 12u, 12u, 12u, 16u, 16u, 16u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 5u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 14u, 31u,
+        31u, 31u, 31u, 31u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 31u, 31u, 0u, 0u, 0u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 0u, 31u, 31u, 31u, 31u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 14u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 0u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 12u, 12u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 0u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 12u, 12u, 12u, 16u, 12u, 12u, 12u, 12u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 16u, 16u, 20u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 20u, 20u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 16u, 16u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 0u, 12u, 12u, 16u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u,
+        16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u, 25u,
+        25u, 25u, 25u, 25u, 25u, 25u, 0u, 0u, 0u, 16u, 16u, 16u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 20u, 20u,
+        16u, 16u, 20u, 20u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u,
+        16u, 16u, 16u, 16u, 20u, 20u, 16u, 16u, 20u, 20u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 0u,
+        0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 24u, 16u, 24u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 16u, 16u, 16u, 0u, 0u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 16u, 16u, 20u, 20u,
+        0u, 0u, 12u, 12u, 12u, 20u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u,
+        20u, 16u, 20u, 20u, 16u, 20u, 20u, 0u, 20u, 16u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 32u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u, 33u,
+        33u, 33u, 33u, 33u, 33u, 33u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u, 26u,
+        26u, 26u, 26u, 26u, 26u, 0u, 0u, 0u, 0u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u,
+        27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 27u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 17u, 16u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 0u, 17u, 17u, 17u,
+        17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 0u, 17u, 17u, 17u, 17u, 17u, 0u, 17u, 0u, 17u, 17u, 0u, 17u, 17u, 0u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u, 17u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 11u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 13u, 13u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 13u, 13u, 13u, 8u, 0u, 9u, 0u, 8u, 11u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 0u, 0u, 15u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 9u, 0u, 0u, 0u, 0u, 8u, 0u, 9u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 11u, 8u, 0u, 0u,
+        0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 13u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u,
+        31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 15u, 15u, 15u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 0u, 0u, 12u, 0u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        0u, 0u, 0u, 0u, 0u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 16u, 16u, 16u, 0u, 16u, 16u, 0u, 0u, 0u, 0u, 0u,
+        16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 16u, 16u, 0u, 0u, 0u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 20u, 16u,
+        20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 16u, 12u, 12u, 16u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 16u,
+        16u, 16u, 16u, 20u, 20u, 16u, 16u, 0u, 0u, 18u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 18u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u,
+        0u, 0u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u,
+        0u, 12u, 20u, 20u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 12u, 19u, 19u, 12u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 0u, 20u, 16u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 12u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 16u, 16u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 16u,
+        12u, 12u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 20u, 20u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 0u, 16u, 16u, 12u, 16u, 20u,
+        16u, 20u, 20u, 20u, 20u, 0u, 0u, 20u, 20u, 0u, 0u, 20u, 20u, 16u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 0u, 0u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        12u, 0u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 0u, 0u, 16u, 0u, 16u, 16u, 16u, 20u, 0u, 20u, 20u, 16u, 16u, 16u,
+        19u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 20u, 20u, 16u, 16u, 16u, 20u, 16u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 16u, 12u, 12u, 12u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 20u, 20u, 16u, 20u, 16u, 16u, 20u, 16u, 16u, 12u, 12u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 0u, 0u, 20u, 20u, 20u, 20u, 16u, 16u,
+        20u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 20u, 16u, 20u, 16u, 16u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 16u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 20u, 16u, 24u, 24u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 20u, 20u,
+        20u, 20u, 20u, 0u, 20u, 20u, 0u, 0u, 16u, 16u, 16u, 16u, 19u, 20u, 19u, 20u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 16u, 16u, 16u, 16u, 0u, 0u, 16u, 16u, 20u, 20u, 20u, 20u, 16u, 12u, 0u, 12u, 20u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u,
+        16u, 20u, 19u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 20u, 16u, 16u, 16u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 19u, 19u, 19u, 19u, 19u, 19u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 20u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 16u, 16u, 20u, 16u, 16u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 16u, 0u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 19u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 20u, 20u, 20u, 0u, 16u, 16u, 0u, 20u, 20u, 16u, 20u,
+        16u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 20u, 20u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 19u, 20u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 20u, 20u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 20u, 20u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 20u, 20u, 20u, 16u, 16u, 16u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 26u, 12u, 12u, 12u, 26u, 26u,
+        26u, 26u, 12u, 12u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 16u, 12u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u,
+        20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 20u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 0u, 12u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 31u, 31u, 31u, 31u, 0u, 31u, 31u, 31u, 31u, 31u, 31u, 31u, 0u, 31u, 31u, 0u,
+        31u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 31u, 31u, 31u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        31u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 31u, 31u, 31u, 31u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 16u, 16u, 0u, 15u, 15u, 15u, 15u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 16u, 16u,
+        16u, 16u, 16u, 16u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 15u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 0u, 12u, 0u, 0u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u,
+        12u, 0u, 12u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 16u, 16u,
+        0u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u,
+        16u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 12u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 12u, 0u, 0u, 0u, 0u, 10u, 10u, 10u, 10u, 10u,
+        10u, 10u, 10u, 10u, 10u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u,
+        12u, 12u, 0u, 12u, 0u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 0u, 0u, 0u,
+        0u, 12u, 0u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 0u, 12u, 0u, 0u, 12u, 0u, 12u, 0u, 12u, 0u, 12u, 0u, 12u, 0u, 12u, 12u, 0u, 12u, 0u, 0u, 12u, 12u, 12u, 12u,
+        0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 0u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 0u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u,
+        14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 0u, 0u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 14u, 14u, 14u, 14u, 30u, 30u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u,
+        12u, 12u, 12u, 30u, 30u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 12u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 34u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u,
+        0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 16u, 16u, 16u,
+        16u, 16u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u,
+        0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u,
+        14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 14u, 0u, 0u, 1u, 15u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u,
+        1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u,
+        16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 16u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u
+    };
+    // clang-format on
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Segmentation properties of `c`.
+    constexpr const segmentation_record& dchar_segmentation_record(const char32_t c) noexcept
+    {
+        if (c >= segmentation_limit)
+            return segmentation_records[0];
+        const size_t block = segmentation_stage1[c >> segmentation_shift];
+        return segmentation_records[segmentation_stage2[(block << segmentation_shift) | (c & ((1uz << segmentation_shift) - 1uz))]];
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr grapheme_break dchar_grapheme_break(const char32_t c) noexcept { return _as(dchar_segmentation_record(c).grapheme, grapheme_break); }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr word_break dchar_word_break(const char32_t c) noexcept { return _as(dchar_segmentation_record(c).word, word_break); }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr indic_conjunct_break dchar_indic_conjunct_break(const char32_t c) noexcept
+    {
+        return _as(dchar_segmentation_record(c).flags & segmentation_flag_incb_mask, indic_conjunct_break);
+    }
+    /// @internal
+    /// @ingroup sys_internal
+    constexpr bool dchar_is_extended_pictographic(const char32_t c) noexcept
+    {
+        return (dchar_segmentation_record(c).flags & segmentation_flag_extended_pictographic) != 0u;
+    }
+} // namespace sys::internal
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
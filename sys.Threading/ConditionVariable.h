@@ -2,6 +2,7 @@
 
 /// @file
 
+#include <chrono>
 #include <concepts>
 #include <type_traits>
 
@@ -14,6 +15,7 @@
 #include <meta/NamedRequirements.h>
 #include <meta/Type.h>
 
+#include <sup/Deadline.h>
 #include <sup/ThreadingErrors.h>
 
 #if !defined(_libcxxext_mock_sup_cv) || !_libcxxext_mock_sup_cv
@@ -34,16 +36,51 @@ namespace sys
     /// [C++ Docs](https://en.cppreference.com/w/cpp/thread/condition_variable).
     class cond_var final
     {
+        static constexpr bool constant_init = internal::IConstantInitializableHandle<internal::cond_var_handle>;
+
         internal::cond_var_handle cond = nullptr;
         once o;
 
-        sys::result<void> try_init() noexcept
+        template <typename Mutex>
+        sys::result<void, threading_error> wait_deadline(Mutex& mut, const internal::deadline deadline) noexcept
+        {
+            _retif(threading_error::init_failed, !this->try_init());
+            const internal::threading_error ret = this->cond.wait_until(mut.mut, deadline);
+            _retif(threading_error::timeout, ret == internal::threading_error::timeout);
+            _retif(threading_error::operation_failed, ret != internal::threading_error::ok);
+            return {};
+        }
+        template <typename Mutex, typename Pred>
+        sys::result<void, threading_error> wait_deadline(Mutex& mut, const internal::deadline deadline, Pred&& pred) noexcept(INothrowCallable<Pred>)
         {
-            return this->o.call_once([&]() noexcept -> sys::result<void>
+            while (!_forward(pred)() /* NOLINT(bugprone-use-after-move): Spurious. */)
             {
-                _retif(nullptr, this->cond.create() != internal::threading_error::ok);
+                auto waitRes = this->wait_deadline(mut, deadline);
+                _nowarn_begin_one_clang(_clwarn_clang_consumed);
+                if (!waitRes)
+                {
+                    // The predicate may have come true while we were timing out.
+                    const threading_error err = waitRes.err();
+                    _retif({}, err == threading_error::timeout && _forward(pred)() /* NOLINT(bugprone-use-after-move): Spurious. */);
+                    return err;
+                }
+                _nowarn_end_clang();
+            }
+            return {};
+        }
+
+        sys::result<void> try_init() noexcept
+        {
+            if constexpr (constant_init)
                 return {};
-            });
+            else
+            {
+                return this->o.call_once([&]() noexcept -> sys::result<void>
+                {
+                    _retif(nullptr, this->cond.create() != internal::threading_error::ok);
+                    return {};
+                });
+            }
         }
     public:
         cond_var() noexcept = default;
@@ -51,7 +88,7 @@ namespace sys
         cond_var(cond_var&&) noexcept = delete;
         ~cond_var() noexcept
         {
-            if (this->o.is_completed()) [[likely]]
+            if (constant_init || this->o.is_completed()) [[likely]]
                 this->cond.destroy();
         }
 
@@ -94,7 +131,56 @@ namespace sys
             }
             return {};
         }
-        // TODO(halloimdragon): `wait_timeout(...)`.
+        /// @brief Wait for the condition variable to be notified, giving up with `threading_error::timeout` once `timeout` elapsed.
+        /// @pre `mut` must be locked, and locked by the calling thread.
+        /// @warning
+        /// You should note that `sys::cond_var` is allowed to spuriously awaken.
+        /// Be _very_ careful if you choose to wait with a `sys::reentrant_mutex`.
+        template <typename Rep, typename Period>
+        [[nodiscard]] sys::result<void, threading_error> wait_timeout(auto& mut, const std::chrono::duration<Rep, Period> timeout) noexcept
+        requires (sys::meta::type<_decltype_of(mut)>::template is_from<ordinary_mutex>())
+        {
+            return this->wait_deadline(mut, internal::deadline_after(timeout));
+        }
+        /// @brief Wait for the condition variable to be notified, giving up with `threading_error::timeout` once `deadline` passed.
+        /// @pre `mut` must be locked, and locked by the calling thread.
+        /// @warning
+        /// You should note that `sys::cond_var` is allowed to spuriously awaken.
+        /// Be _very_ careful if you choose to wait with a `sys::reentrant_mutex`.
+        template <typename Clock, typename Duration>
+        [[nodiscard]] sys::result<void, threading_error> wait_timeout(auto& mut, const std::chrono::time_point<Clock, Duration> deadline) noexcept
+        requires (sys::meta::type<_decltype_of(mut)>::template is_from<ordinary_mutex>())
+        {
+            return this->wait_deadline(mut, internal::deadline_at(deadline));
+        }
+        /// @brief Wait for the condition variable to be notified, until `pred()` is `true`, giving up with `threading_error::timeout` once `timeout` elapsed.
+        /// @pre `mut` must be locked, and locked by the calling thread.
+        /// @warning Be _very_ careful if you choose to wait with a `sys::reentrant_mutex`.
+        /// @see `sys::cond_var::wait_until(T&, Pred&&)`
+        template <typename Rep, typename Period>
+        [[nodiscard]] sys::result<void, threading_error> wait_timeout(auto& mut, const std::chrono::duration<Rep, Period> timeout, ICallable auto&& pred) noexcept(
+            INothrowCallable<decltype(pred)>)
+        requires requires {
+            requires sys::meta::type<_decltype_of(mut)>::template is_from<ordinary_mutex>();
+            requires std::convertible_to<std::invoke_result_t<_decltype_of(pred)>, bool>;
+        }
+        {
+            return this->wait_deadline(mut, internal::deadline_after(timeout), _forward(pred));
+        }
+        /// @brief Wait for the condition variable to be notified, until `pred()` is `true`, giving up with `threading_error::timeout` once `deadline` passed.
+        /// @pre `mut` must be locked, and locked by the calling thread.
+        /// @warning Be _very_ careful if you choose to wait with a `sys::reentrant_mutex`.
+        /// @see `sys::cond_var::wait_until(T&, Pred&&)`
+        template <typename Clock, typename Duration>
+        [[nodiscard]] sys::result<void, threading_error> wait_timeout(auto& mut, const std::chrono::time_point<Clock, Duration> deadline, ICallable auto&& pred) noexcept(
+            INothrowCallable<decltype(pred)>)
+        requires requires {
+            requires sys::meta::type<_decltype_of(mut)>::template is_from<ordinary_mutex>();
+            requires std::convertible_to<std::invoke_result_t<_decltype_of(pred)>, bool>;
+        }
+        {
+            return this->wait_deadline(mut, internal::deadline_at(deadline), _forward(pred));
+        }
 
         /// @brief Notify one thread waiting on this condition variable.
         [[nodiscard]] sys::result<void, threading_error> notify_one() noexcept
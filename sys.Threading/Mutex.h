@@ -2,6 +2,8 @@
 
 /// @file
 
+#include <chrono>
+
 #include <CompilerWarnings.h>
 #include <LanguageSupport.h>
 #include <Once.h>
@@ -9,6 +11,8 @@
 #include <Result.h>
 #include <ThreadingErrors.h>
 
+#include <sup/Deadline.h>
+
 #if !defined(_libcxxext_mock_sup_mut) || !_libcxxext_mock_sup_mut
 #include <sup/MutexHandle.h>
 #include <sup/ThreadingErrors.h>
@@ -25,16 +29,24 @@ namespace sys
     template <bool IsRecursive>
     class [[clang::capability("mutex")]] ordinary_mutex final
     {
+        // Handles that are ready once constructed don't pay for `once` on every acquisition.
+        static constexpr bool constant_init = internal::IConstantInitializableHandle<internal::mutex_handle>;
+
         internal::mutex_handle mut = nullptr;
         once o;
 
         result<void> try_init() noexcept
         {
-            return this->o.call_once([&]() noexcept -> sys::result<void>
-            {
-                _retif(nullptr, this->mut.create<IsRecursive>() != internal::threading_error::ok);
+            if constexpr (constant_init)
                 return {};
-            });
+            else
+            {
+                return this->o.call_once([&]() noexcept -> sys::result<void>
+                {
+                    _retif(nullptr, this->mut.create<IsRecursive>() != internal::threading_error::ok);
+                    return {};
+                });
+            }
         }
 
         /// @brief Run a possibly-failing, acquire routine.
@@ -45,13 +57,30 @@ namespace sys
         {
             return (ret = (this->mut.*Acquire)()) == internal::threading_error::ok;
         }
+        /// @brief Acquire before `deadline`, mapping the outcome onto the public error.
+        /// @pre `this->try_init() && this->o.is_completed()`
+        /// @warning `unsafe` because `this` has preconditions.
+        result<void, threading_error> acq_until(const internal::deadline deadline, decltype(unsafe)) noexcept
+        {
+            const internal::threading_error ret = this->mut.lock_until(deadline);
+            _retif(threading_error::timeout, ret == internal::threading_error::timeout);
+            _retif(threading_error::operation_failed, ret != internal::threading_error::ok);
+            return {};
+        }
     public:
-        ordinary_mutex() noexcept = default;
+        ordinary_mutex() noexcept
+        requires (!constant_init)
+        = default;
+        constexpr ordinary_mutex() noexcept
+        requires constant_init
+        {
+            this->mut.template create<IsRecursive>();
+        }
         ordinary_mutex(const ordinary_mutex&) noexcept = delete;
         ordinary_mutex(ordinary_mutex&&) noexcept = delete;
         ~ordinary_mutex() noexcept
         {
-            if (this->o.is_completed()) [[likely]]
+            if (constant_init || this->o.is_completed()) [[likely]]
                 this->mut.destroy();
         }
 
@@ -97,6 +126,26 @@ namespace sys
             _retif(threading_error::operation_failed, ret != internal::threading_error::ok);
             return {};
         }
+        /// @brief Try to acquire the lock on `this`, giving up with `threading_error::timeout` once `timeout` elapsed.
+        /// @pre If this mutex is not reentrant, `this` must not already be locked by the current thread.
+        /// @warning `unsafe` because `this` has preconditions.
+        /// @see `sys::ordinary_mutex::acquire(...)`
+        template <typename Rep, typename Period>
+        result<void, threading_error> try_acquire_for(const std::chrono::duration<Rep, Period> timeout, decltype(unsafe)) noexcept
+        {
+            _retif(threading_error::init_failed, !this->try_init());
+            return this->acq_until(internal::deadline_after(timeout), unsafe);
+        }
+        /// @brief Try to acquire the lock on `this`, giving up with `threading_error::timeout` once `deadline` passed.
+        /// @pre If this mutex is not reentrant, `this` must not already be locked by the current thread.
+        /// @warning `unsafe` because `this` has preconditions.
+        /// @see `sys::ordinary_mutex::acquire(...)`
+        template <typename Clock, typename Duration>
+        result<void, threading_error> try_acquire_until(const std::chrono::time_point<Clock, Duration> deadline, decltype(unsafe)) noexcept
+        {
+            _retif(threading_error::init_failed, !this->try_init());
+            return this->acq_until(internal::deadline_at(deadline), unsafe);
+        }
         /// @brief Release the lock on `this`.
         /// @pre `this` must be locked by the current thread.
         /// @attention Lifetime assumptions!
@@ -119,7 +168,7 @@ namespace sys
             _nowarn_begin_one_gcc("-Wterminate");
             _nowarn_begin_one_clang(_clwarn_clang_exceptions);
             _nowarn_begin_one_msvc(_clwarn_msvc_function_function_assumed_not_to_throw_an_exception_but_does);
-            _contract_assert(this->o.is_completed(), "`.acquire()` never called!"); // LCOV_EXCL_BR_LINE
+            _contract_assert(constant_init || this->o.is_completed(), "`.acquire()` never called!"); // LCOV_EXCL_BR_LINE
             _nowarn_end_msvc();
             _nowarn_end_clang();
             _nowarn_end_gcc();
@@ -163,7 +212,20 @@ namespace sys
             _retif(threading_error::operation_failed, ret != internal::threading_error::ok);
             return guard(*this, unsafe);
         }
-        // TODO(halloimdragon): `try_lock_for(...)`.
+        /// @brief Try to lock this mutex and obtain a lock guard for it, giving up with `threading_error::timeout` once `timeout` elapsed.
+        template <typename Rep, typename Period>
+        result<guard, threading_error> try_lock_for(const std::chrono::duration<Rep, Period> timeout) noexcept
+        {
+            return this->try_lock_until(internal::deadline_after(timeout));
+        }
+        /// @brief Try to lock this mutex and obtain a lock guard for it, giving up with `threading_error::timeout` once `deadline` passed.
+        template <typename Clock, typename Duration>
+        result<guard, threading_error> try_lock_until(const std::chrono::time_point<Clock, Duration> deadline) noexcept
+        {
+            _retif(threading_error::init_failed, !this->try_init());
+            _retif(acqRes.err(), auto acqRes = this->acq_until(internal::deadline_at(deadline), unsafe); !acqRes);
+            return guard(*this, unsafe);
+        }
 
         friend class sys::cond_var;
     };
@@ -0,0 +1,156 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <StringEx.h>
+#include <ThreadEx.h>
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Code units of input per thread below which splitting a transform costs more than it saves.
+    constexpr sz parallel_text_min_chunk = 256_uz << 10_uz;
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Append `transform(chunk, out)` of each chunk of `in` to `ret`, transforming the chunks on up to `threads` threads.
+    /// @details
+    /// `in` is split near every `in.size() / threads` code units, at the offset chosen by `boundary(in, at)`, so that each chunk transforms alone exactly as it would
+    /// as part of `in`. A chunk whose thread couldn't be started, or whose transform threw, is transformed again on the calling thread, so any exception is thrown
+    /// from here. The results are then copied into `ret` with a single allocation of exactly their total size.
+    template <ICharacter T, ICharacter U, typename Allocator, typename Boundary, typename Transform>
+    void parallel_transform_append(const std::span<const U> in, size_t threads, const Boundary boundary, const Transform& transform,
+                                   std::basic_string<T, std::char_traits<T>, Allocator>& ret)
+    {
+        struct chunk
+        {
+            std::span<const U> in;
+            std::basic_string<T> out;
+            bool done = false;
+        };
+
+        threads = std::clamp(threads, 1uz, std::max(*(sz(in.size()) / internal::parallel_text_min_chunk), 1uz));
+        std::vector<chunk> chunks;
+        chunks.reserve(threads);
+        sz from = 0_uz;
+        for (size_t i = 1uz; i <= threads; i++)
+        {
+            // A boundary is only looked for up to the next split, if there's none the chunk runs on into the next.
+            const sz limit = sz(in.size() / threads * (i + 1uz));
+            const sz to = i == threads ? sz(in.size()) : boundary(in.first(std::min(limit, sz(in.size()))), sz(in.size() / threads * i));
+            if (i != threads && (to >= limit || to <= from))
+                continue;
+            chunks.push_back(chunk { .in = in.subspan(from, to - from) });
+            from = to;
+        }
+
+        const auto run = [&transform](chunk& c) -> void
+        {
+            c.out.clear();
+            transform(c.in, c.out);
+            c.done = true;
+        };
+
+        // Transform the first chunk on the calling thread, while the workers transform the rest.
+        {
+            std::vector<sys::managed_thread> workers;
+            workers.reserve(chunks.size() - 1uz);
+            for (size_t i = 1uz; i < chunks.size(); i++)
+            {
+                if (auto threadRes = sys::managed_thread::ctor([&run, &c = chunks[i]]() -> void { run(c); }); threadRes)
+                    workers.push_back(threadRes.move());
+            }
+            run(chunks.front());
+        }
+        for (chunk& c : chunks)
+        {
+            if (!c.done)
+                run(c);
+        }
+
+        const sz prevSize = sz(ret.size());
+        sz size = prevSize;
+        for (const chunk& c : chunks)
+            size += sz(c.out.size());
+        ret.resize_and_overwrite(size, [&](T* const buf, size_t) noexcept
+        {
+            T* at = buf + prevSize; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            for (const chunk& c : chunks)
+                at = std::copy(c.out.begin(), c.out.end(), at);
+            return *size;
+        });
+    }
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_threading
+    /// @brief `str.lowered(lang)`, lowercasing chunks of `str` on up to `threads` threads.
+    /// @details `str` is split after ASCII whitespace, where no casing context reaches across, so the result is exactly that of `str.lowered(lang)`.
+    template <ICharacter T, typename Allocator>
+    [[nodiscard]] string<T, Allocator> parallel_lowered(const string<T, Allocator>& str, const std::u8string_view lang = u8"",
+                                                        const size_t threads = std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        std::basic_string<T, std::char_traits<T>, Allocator> ret(str.get_allocator());
+        internal::parallel_transform_append(std::span<const T>(str), threads, &internal::casing_boundary<T>,
+                                            [lang](const std::span<const T> in, std::basic_string<T>& out) -> void { internal::case_append<false>(in, lang, out); }, ret);
+        return string<T, Allocator>(std::move(ret));
+    }
+    /// @ingroup sys_threading
+    /// @brief `str.uppered(lang)`, uppercasing chunks of `str` on up to `threads` threads.
+    /// @see `sys::parallel_lowered(...)`
+    template <ICharacter T, typename Allocator>
+    [[nodiscard]] string<T, Allocator> parallel_uppered(const string<T, Allocator>& str, const std::u8string_view lang = u8"",
+                                                        const size_t threads = std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        std::basic_string<T, std::char_traits<T>, Allocator> ret(str.get_allocator());
+        internal::parallel_transform_append(std::span<const T>(str), threads, &internal::casing_boundary<T>,
+                                            [lang](const std::span<const T> in, std::basic_string<T>& out) -> void { internal::case_append<true>(in, lang, out); }, ret);
+        return string<T, Allocator>(std::move(ret));
+    }
+    /// @ingroup sys_threading
+    /// @brief `str.folded(lang)`, case folding chunks of `str` on up to `threads` threads.
+    template <ICharacter T, typename Allocator>
+    [[nodiscard]] string<T, Allocator> parallel_folded(const string<T, Allocator>& str, const std::u8string_view lang = u8"",
+                                                       const size_t threads = std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        std::basic_string<T, std::char_traits<T>, Allocator> ret(str.get_allocator());
+        internal::parallel_transform_append(std::span<const T>(str), threads, &internal::utf_sequence_boundary<T>,
+                                            [lang](const std::span<const T> in, std::basic_string<T>& out) -> void { internal::fold_append(in, lang, out); }, ret);
+        return string<T, Allocator>(std::move(ret));
+    }
+    /// @ingroup sys_threading
+    /// @brief `str.invalids_replaced()`, validating and replacing chunks of `str` on up to `threads` threads.
+    template <ICharacter T, typename Allocator>
+    [[nodiscard]] string<T, Allocator> parallel_invalids_replaced(const string<T, Allocator>& str, const size_t threads = std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        std::basic_string<T, std::char_traits<T>, Allocator> ret(str.get_allocator());
+        internal::parallel_transform_append(std::span<const T>(str), threads, &internal::utf_sequence_boundary<T>,
+                                            [](const std::span<const T> in, std::basic_string<T>& out) -> void
+        { internal::invalids_replaced_append(in, internal::utf_first_invalid(in), out); }, ret);
+        return string<T, Allocator>(std::move(ret));
+    }
+    /// @ingroup sys_threading
+    /// @brief `sys::string<T, Allocator>(str)`, transcoding chunks of `str` on up to `threads` threads.
+    /// @details `str` is split between sequences, so invalid sequences are replaced exactly as transcoding it whole.
+    template <ICharacter T, ICharacter U, typename UAllocator, typename Allocator = std::allocator<T>>
+    [[nodiscard]] string<T, Allocator> parallel_transcoded(const string<U, UAllocator>& str, const size_t threads = std::max(std::thread::hardware_concurrency(), 1u),
+                                                           const Allocator& alloc = Allocator())
+    {
+        std::basic_string<T, std::char_traits<T>, Allocator> ret(alloc);
+        internal::parallel_transform_append(std::span<const U>(str), threads, &internal::utf_sequence_boundary<U>,
+                                            [](const std::span<const U> in, std::basic_string<T>& out) -> void { internal::transcode_append(in, out); }, ret);
+        return string<T, Allocator>(std::move(ret));
+    }
+} // namespace sys
@@ -0,0 +1,212 @@
+#pragma once
+
+/// @file
+
+#include <atomic>
+#include <cstddef>
+
+#include <CompilerWarnings.h>
+#include <ConditionVariable.h>
+#include <LanguageSupport.h>
+#include <Mutex.h>
+#include <ResourceGuard.h>
+#include <Result.h>
+#include <ThreadingErrors.h>
+
+namespace sys
+{
+    /// @ingroup sys_threading
+    /// @brief A reader-writer mutex threading primitive, which admits either any number of readers, or a single writer.
+    /// @details
+    /// Readers and writers take the lock with a single atomic operation while it's uncontended, and only park on a condition variable otherwise. The lock prefers writers: once
+    /// a writer is waiting, new readers queue up behind it, so a steady stream of readers can't starve writers.
+    ///
+    /// Implements `sys::INothrowDefaultConstructible` and `sys::INothrowDestructible`.
+    /// @attention Neither side is reentrant, a thread already holding the lock must not lock it again, even to read.
+    /// @see
+    /// For more information on reader-writer locks, see
+    /// [Rust Docs](https://doc.rust-lang.org/std/sync/struct.RwLock.html),
+    /// [C++ Docs](https://en.cppreference.com/w/cpp/thread/shared_mutex.html),
+    /// [Wikipedia](https://en.wikipedia.org/wiki/Readers%E2%80%93writer_lock).
+    class [[clang::capability("mutex")]] rw_mutex final
+    {
+        static constexpr size_t writer_bit = ~(~0uz >> 1uz);
+
+        // The number of readers holding the lock, or `writer_bit` while a writer holds it.
+        std::atomic<size_t> state { 0 };
+        std::atomic<size_t> readers_waiting { 0 };
+        std::atomic<size_t> writers_waiting { 0 };
+        sys::mutex mut;
+        sys::cond_var readers_cv;
+        sys::cond_var writers_cv;
+
+        // Paired with the waiter counts, both sides use `seq_cst` so a waiter either sees the lock released, or the releaser sees the waiter.
+        bool try_take_read() noexcept
+        {
+            size_t current = this->state.load(std::memory_order_seq_cst);
+            while (!(current & writer_bit) && this->writers_waiting.load(std::memory_order_seq_cst) == 0)
+            {
+                _contract_assert(current + 1 < writer_bit, "Too many readers!"); // LCOV_EXCL_BR_LINE
+                if (this->state.compare_exchange_weak(current, current + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return true;
+            }
+            return false;
+        }
+        bool try_take_write() noexcept
+        {
+            size_t expected = 0;
+            return this->state.compare_exchange_strong(expected, writer_bit, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+        sys::result<void, threading_error> wake(sys::cond_var& cv, const bool all) noexcept
+        {
+            auto guardRes = this->mut.lock();
+            _retif(guardRes.err(), !guardRes); // LCOV_EXCL_BR_LINE
+            return all ? cv.notify_all() : cv.notify_one();
+        }
+    public:
+        rw_mutex() noexcept = default;
+        rw_mutex(const rw_mutex&) noexcept = delete;
+        rw_mutex(rw_mutex&&) noexcept = delete;
+        ~rw_mutex() noexcept = default;
+
+        rw_mutex& operator=(const rw_mutex&) noexcept = delete;
+        rw_mutex& operator=(rw_mutex&&) noexcept = delete;
+
+        /// @brief Acquire shared, read access to `this`, blocking until successful, or an error occurs.
+        /// @pre The calling thread must not already hold `this`.
+        /// @post There must exist a corresponding, subsequent call to `.release_read(...)`.
+        /// @warning `unsafe` because `this` has preconditions and postconditions.
+        /// @return Propagated error from `sys::mutex::lock()`, `sys::cond_var::wait_until(...)`, or success.
+        sys::result<void, threading_error> acquire_read(decltype(unsafe)) noexcept
+        {
+            _retif({}, this->try_take_read());
+
+            auto guardRes = this->mut.lock();
+            _retif(guardRes.err(), !guardRes); // LCOV_EXCL_BR_LINE
+
+            this->readers_waiting.fetch_add(1, std::memory_order_seq_cst);
+            auto waitRes = this->readers_cv.wait_until(this->mut, [&]() noexcept -> bool { return this->try_take_read(); }); // LCOV_EXCL_BR_LINE
+            this->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            _retif(waitRes.err(), !waitRes); // LCOV_EXCL_BR_LINE
+            return {};
+        }
+        /// @brief Try to acquire shared, read access to `this`, returning `threading_error::busy` immediately if a writer holds, or is waiting on, the lock.
+        /// @pre The calling thread must not already hold `this`.
+        /// @post On success, there must exist a corresponding, subsequent call to `.release_read(...)`.
+        /// @warning `unsafe` because `this` has preconditions and postconditions.
+        sys::result<void, threading_error> try_acquire_read(decltype(unsafe)) noexcept
+        {
+            _retif(threading_error::busy, !this->try_take_read());
+            return {};
+        }
+        /// @brief Release shared, read access to `this`.
+        /// @pre The calling thread must hold read access to `this`.
+        /// @warning `unsafe` because `this` has preconditions.
+        /// @return Propagated error from `sys::mutex::lock()`, `sys::cond_var::notify_one()`, or success.
+        sys::result<void, threading_error> release_read(decltype(unsafe)) noexcept
+        {
+            const size_t prev = this->state.fetch_sub(1, std::memory_order_seq_cst);
+            _contract_assert(prev != 0 && !(prev & writer_bit), "`.acquire_read(...)` never called!"); // LCOV_EXCL_BR_LINE
+
+            _retif({}, prev != 1 || this->writers_waiting.load(std::memory_order_seq_cst) == 0);
+            return this->wake(this->writers_cv, false);
+        }
+
+        /// @brief Acquire exclusive, write access to `this`, blocking until successful, or an error occurs.
+        /// @pre The calling thread must not already hold `this`.
+        /// @post There must exist a corresponding, subsequent call to `.release(...)`.
+        /// @warning `unsafe` because `this` has preconditions and postconditions.
+        /// @return Propagated error from `sys::mutex::lock()`, `sys::cond_var::wait_until(...)`, or success.
+        sys::result<void, threading_error> acquire(decltype(unsafe)) noexcept
+        {
+            _retif({}, this->try_take_write());
+
+            auto guardRes = this->mut.lock();
+            _retif(guardRes.err(), !guardRes); // LCOV_EXCL_BR_LINE
+
+            this->writers_waiting.fetch_add(1, std::memory_order_seq_cst);
+            auto waitRes = this->writers_cv.wait_until(this->mut, [&]() noexcept -> bool { return this->try_take_write(); }); // LCOV_EXCL_BR_LINE
+            this->writers_waiting.fetch_sub(1, std::memory_order_seq_cst);
+            _retif(waitRes.err(), !waitRes); // LCOV_EXCL_BR_LINE
+            return {};
+        }
+        /// @brief Try to acquire exclusive, write access to `this`, returning `threading_error::busy` immediately if the lock is held.
+        /// @pre The calling thread must not already hold `this`.
+        /// @post On success, there must exist a corresponding, subsequent call to `.release(...)`.
+        /// @warning `unsafe` because `this` has preconditions and postconditions.
+        sys::result<void, threading_error> try_acquire(decltype(unsafe)) noexcept
+        {
+            _retif(threading_error::busy, !this->try_take_write());
+            return {};
+        }
+        /// @brief Release exclusive, write access to `this`.
+        /// @pre The calling thread must hold write access to `this`.
+        /// @warning `unsafe` because `this` has preconditions.
+        /// @return Propagated error from `sys::mutex::lock()`, `sys::cond_var::notify_one()`, `sys::cond_var::notify_all()`, or success.
+        sys::result<void, threading_error> release(decltype(unsafe)) noexcept
+        {
+            const size_t prev = this->state.exchange(0, std::memory_order_seq_cst);
+            _contract_assert(prev == writer_bit, "`.acquire(...)` never called!"); // LCOV_EXCL_BR_LINE
+
+            // Hand over to the next writer first, readers only get a turn once no writer is waiting.
+            _retif(this->wake(this->writers_cv, false), this->writers_waiting.load(std::memory_order_seq_cst) != 0);
+            _retif({}, this->readers_waiting.load(std::memory_order_seq_cst) == 0);
+            return this->wake(this->readers_cv, true);
+        }
+    private:
+        static void release_read_guard(rw_mutex& m) noexcept /* NOLINT(bugprone-exception-escape) */
+        {
+            _nowarn_begin_one_gcc("-Wterminate");
+            _nowarn_begin_one_clang(_clwarn_clang_exceptions);
+            _nowarn_begin_one_msvc(_clwarn_msvc_function_function_assumed_not_to_throw_an_exception_but_does);
+            _contract_assert(m.release_read(unsafe), "If this happens we're genuinely cooked."); // LCOV_EXCL_BR_LINE
+            _nowarn_end_msvc();
+            _nowarn_end_clang();
+            _nowarn_end_gcc();
+        }
+        static void release_write_guard(rw_mutex& m) noexcept /* NOLINT(bugprone-exception-escape) */
+        {
+            _nowarn_begin_one_gcc("-Wterminate");
+            _nowarn_begin_one_clang(_clwarn_clang_exceptions);
+            _nowarn_begin_one_msvc(_clwarn_msvc_function_function_assumed_not_to_throw_an_exception_but_does);
+            _contract_assert(m.release(unsafe), "If this happens we're genuinely cooked."); // LCOV_EXCL_BR_LINE
+            _nowarn_end_msvc();
+            _nowarn_end_clang();
+            _nowarn_end_gcc();
+        }
+    public:
+        /// @brief RAII guard for shared, read access to `sys::rw_mutex`.
+        /// @details
+        /// Implements `sys::INothrowDefaultConstructible`, `sys::INothrowMoveConstructible`, `sys::INothrowMoveAssignable`, `sys::INothrowDestructible`, `sys::INothrowSwappable`.
+        using read_guard = resource_guard<rw_mutex, &rw_mutex::release_read_guard>;
+        /// @brief RAII guard for exclusive, write access to `sys::rw_mutex`.
+        /// @details
+        /// Implements `sys::INothrowDefaultConstructible`, `sys::INothrowMoveConstructible`, `sys::INothrowMoveAssignable`, `sys::INothrowDestructible`, `sys::INothrowSwappable`.
+        using write_guard = resource_guard<rw_mutex, &rw_mutex::release_write_guard>;
+
+        /// @brief Lock this mutex for reading and obtain a guard for it.
+        result<read_guard, threading_error> read_lock() noexcept
+        {
+            _retif(acqRes.err(), auto acqRes = this->acquire_read(unsafe); !acqRes); // LCOV_EXCL_BR_LINE
+            return read_guard(*this, unsafe);
+        }
+        /// @brief Try to lock this mutex for reading and obtain a guard for it, if possible.
+        result<read_guard, threading_error> try_read_lock() noexcept
+        {
+            _retif(threading_error::busy, !this->try_take_read());
+            return read_guard(*this, unsafe);
+        }
+        /// @brief Lock this mutex for writing and obtain a guard for it.
+        result<write_guard, threading_error> write_lock() noexcept
+        {
+            _retif(acqRes.err(), auto acqRes = this->acquire(unsafe); !acqRes); // LCOV_EXCL_BR_LINE
+            return write_guard(*this, unsafe);
+        }
+        /// @brief Try to lock this mutex for writing and obtain a guard for it, if possible.
+        result<write_guard, threading_error> try_write_lock() noexcept
+        {
+            _retif(threading_error::busy, !this->try_take_write());
+            return write_guard(*this, unsafe);
+        }
+    };
+} // namespace sys
@@ -2,6 +2,8 @@
 
 /// @file
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
@@ -17,12 +19,18 @@
 #include <ThreadingErrors.h>
 #include <meta/Builtin.h>
 
+#include <sup/Deadline.h>
+
 namespace sys
 {
     /// @ingroup sys_threading
     /// @brief A semaphore threading primitive.
     /// @tparam DefaultConcurrentAccessors A statically-known default number of concurrent accesses, or `sys::bsentinel<T>()` to require a constructor argument.
-    /// @details Implements `sys::INothrowDestructible`. Conditionally implements `sys::INothrowDefaultConstructible` when `DefaultConcurrentAccessors != sys::bsentinel<T>()`.
+    /// @details
+    /// Permits are counted atomically, so acquiring while permits are available and releasing while nobody waits never touch the mutex. Threads only park on the condition
+    /// variable once the count is zero.
+    ///
+    /// Implements `sys::INothrowDestructible`. Conditionally implements `sys::INothrowDefaultConstructible` when `DefaultConcurrentAccessors != sys::bsentinel<T>()`.
     template <sys::IBuiltinInteger T, T DefaultConcurrentAccessors = sys::bsentinel<T>()>
     requires (DefaultConcurrentAccessors >= _as(0, T) || DefaultConcurrentAccessors == sys::bsentinel<T>())
     class [[clang::capability("semaphore")]] ordinary_semaphore final
@@ -30,7 +38,39 @@ namespace sys
     private:
         sys::mutex mut;
         sys::cond_var cv;
-        T counter = DefaultConcurrentAccessors;
+        std::atomic<T> counter { DefaultConcurrentAccessors };
+        std::atomic<size_t> waiters { 0 };
+
+        // Paired with `waiters`, both sides use `seq_cst` so a waiter either sees the released permit, or the releaser sees the waiter.
+        bool try_take() noexcept
+        {
+            T current = this->counter.load(std::memory_order_seq_cst);
+            while (current > _as(0, T))
+            {
+                if (this->counter.compare_exchange_weak(current, _as(current - 1, T), std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return true;
+            }
+            return false;
+        }
+        sys::result<void, threading_error> wake_one() noexcept
+        {
+            auto guardRes = this->mut.lock();
+            _retif(guardRes.err(), !guardRes);
+            return this->cv.notify_one();
+        }
+        sys::result<void, threading_error> acquire_deadline(const internal::deadline deadline)
+        {
+            _retif({}, this->try_take());
+
+            auto guardRes = this->mut.try_lock_until(deadline);
+            _retif(guardRes.err(), !guardRes);
+
+            this->waiters.fetch_add(1, std::memory_order_seq_cst);
+            auto waitRes = this->cv.wait_timeout(this->mut, deadline, [&]() noexcept -> bool { return this->try_take(); });
+            this->waiters.fetch_sub(1, std::memory_order_relaxed);
+            _retif(waitRes.err(), !waitRes);
+            return {};
+        }
     public:
         ordinary_semaphore() noexcept /* LCOV_EXCL_BR_LINE */
         requires (DefaultConcurrentAccessors != sys::bsentinel<T>())
@@ -40,7 +80,7 @@ namespace sys
         /// @warning `unsafe` because `this` has preconditions.
         constexpr explicit ordinary_semaphore(const sys::integer<T> init_count, decltype(unsafe))
         requires (DefaultConcurrentAccessors == sys::bsentinel<T>())
-            : counter(init_count) /* LCOV_EXCL_BR_LINE */
+            : counter(*init_count) /* LCOV_EXCL_BR_LINE */
         {
             if consteval
             {
@@ -64,13 +104,35 @@ namespace sys
         /// @return Propagated error from `sys::mutex::lock()`, `sys::cond_var::wait_until(...)`, or success.
         sys::result<void, threading_error> acquire(decltype(unsafe))
         {
+            _retif({}, this->try_take());
+
             auto guardRes = this->mut.lock();
-            _retif(guardRes.err(), !guardRes);                                                                                                   // LCOV_EXCL_BR_LINE
-            _retif(waitRes.err(), auto waitRes = this->cv.wait_until(this->mut, [&]() -> bool { return this->counter > _as(0, T); }); !waitRes); // LCOV_EXCL_BR_LINE
+            _retif(guardRes.err(), !guardRes); // LCOV_EXCL_BR_LINE
 
-            --this->counter; // LCOV_EXCL_BR_LINE
+            this->waiters.fetch_add(1, std::memory_order_seq_cst);
+            auto waitRes = this->cv.wait_until(this->mut, [&]() noexcept -> bool { return this->try_take(); }); // LCOV_EXCL_BR_LINE
+            this->waiters.fetch_sub(1, std::memory_order_relaxed);
+            _retif(waitRes.err(), !waitRes); // LCOV_EXCL_BR_LINE
             return {};
         }
+        /// @brief Acquires a permit, giving up with `threading_error::timeout` once `timeout` elapsed.
+        /// @post On success, there must exist a corresponding, subsequent call to `.release(...)`, within a finite amount of time.
+        /// @warning `unsafe` because `this` has postconditions.
+        /// @return Propagated error from `sys::mutex::try_lock_until(...)`, `sys::cond_var::wait_timeout(...)`, or success.
+        template <typename Rep, typename Period>
+        sys::result<void, threading_error> try_acquire_for(const std::chrono::duration<Rep, Period> timeout, decltype(unsafe))
+        {
+            return this->acquire_deadline(internal::deadline_after(timeout));
+        }
+        /// @brief Acquires a permit, giving up with `threading_error::timeout` once `deadline` passed.
+        /// @post On success, there must exist a corresponding, subsequent call to `.release(...)`, within a finite amount of time.
+        /// @warning `unsafe` because `this` has postconditions.
+        /// @return Propagated error from `sys::mutex::try_lock_until(...)`, `sys::cond_var::wait_timeout(...)`, or success.
+        template <typename Clock, typename Duration>
+        sys::result<void, threading_error> try_acquire_until(const std::chrono::time_point<Clock, Duration> deadline, decltype(unsafe))
+        {
+            return this->acquire_deadline(internal::deadline_at(deadline));
+        }
         /// @brief Releases a permit.
         /// @pre There must exist a corresponding, preceding call to `.acquire(...)`.
         /// @warning `unsafe` because `this` has preconditions.
@@ -78,15 +140,19 @@ namespace sys
         /// otherwise success.
         sys::result<void, threading_error> release(decltype(unsafe)) noexcept /* NOLINT(bugprone-exception-escape) */
         {
-            auto guardRes = this->mut.lock();
-            _retif(guardRes.err(), !guardRes);
-            _retif(threading_error::overflow, this->counter == *sys::integer<T>::highest());
+            T current = this->counter.load(std::memory_order_relaxed);
+            while (true)
+            {
+                _retif(threading_error::overflow, current == *sys::integer<T>::highest());
+                if (this->counter.compare_exchange_weak(current, _as(current + 1, T), std::memory_order_seq_cst, std::memory_order_relaxed))
+                    break;
+            }
 
-            ++this->counter;
-            if (auto notifRes = this->cv.notify_one(); !notifRes) [[unlikely]]
+            _retif({}, this->waiters.load(std::memory_order_seq_cst) == 0);
+            if (auto wakeRes = this->wake_one(); !wakeRes) [[unlikely]]
             {
-                --this->counter;
-                return notifRes.err();
+                // Take the permit back, unless a waiter already woke up on its own and got it.
+                _retif(wakeRes.err(), this->try_take());
             }
 
             return {};
@@ -113,6 +179,22 @@ namespace sys
             _retif(acqRes.err(), !acqRes);       // LCOV_EXCL_BR_LINE
             return guard(*this, unsafe);
         }
+        /// @brief Attempts to acquire a permit, giving up with `threading_error::timeout` once `timeout` elapsed.
+        /// @return The error from `sys::ordinary_semaphore::try_acquire_for(...)`, or a guard on success.
+        template <typename Rep, typename Period>
+        sys::result<guard, threading_error> try_access_for(const std::chrono::duration<Rep, Period> timeout)
+        {
+            _retif(acqRes.err(), auto acqRes = this->try_acquire_for(timeout, unsafe); !acqRes);
+            return guard(*this, unsafe);
+        }
+        /// @brief Attempts to acquire a permit, giving up with `threading_error::timeout` once `deadline` passed.
+        /// @return The error from `sys::ordinary_semaphore::try_acquire_until(...)`, or a guard on success.
+        template <typename Clock, typename Duration>
+        sys::result<guard, threading_error> try_access_until(const std::chrono::time_point<Clock, Duration> deadline)
+        {
+            _retif(acqRes.err(), auto acqRes = this->try_acquire_until(deadline, unsafe); !acqRes);
+            return guard(*this, unsafe);
+        }
     };
 
     /// @ingroup sys_threading
@@ -0,0 +1,139 @@
+#pragma once
+
+/// @file
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include <LanguageSupport.h>
+#include <Mutex.h>
+#include <Result.h>
+#include <ThreadEx.h>
+#include <ThreadingErrors.h>
+#include <meta/InterfaceRequirements.h>
+#include <meta/NamedRequirements.h>
+
+namespace sys
+{
+    /// @ingroup sys_threading
+    /// @brief A sequence lock, publishing snapshots of a trivially-copyable `T` to readers that never block writers, nor write to shared memory themselves.
+    /// @details
+    /// Writers serialize on a mutex and bump a sequence counter around each update. Readers copy the value out optimistically and retry if the counter moved, so reads scale
+    /// with the number of cores, at the cost of being retried while a write is in flight. Best suited to small values that are read far more often than they're written.
+    ///
+    /// Implements `sys::INothrowDefaultConstructible` (when `T` is) and `sys::INothrowDestructible`.
+    /// @tparam T The type of the value to protect, copied bytewise.
+    /// @see
+    /// For more information on sequence locks, see
+    /// [Wikipedia](https://en.wikipedia.org/wiki/Seqlock),
+    /// [Hans-J. Boehm, "Can Seqlocks Get Along With Programming Language Memory Models?"](https://www.hpl.hp.com/techreports/2012/HPL-2012-68.pdf).
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    class [[clang::capability("seqlock")]] seqlock final
+    {
+        // The value is stored as relaxed atomic words, so racing a reader against a writer is well-defined, merely torn, and the torn copy is then discarded.
+        using word = size_t;
+        static constexpr size_t word_count = (sizeof(T) + sizeof(word) - 1) / sizeof(word);
+
+        // Odd while a write is in progress.
+        std::atomic<size_t> sequence { 0 };
+        std::array<std::atomic<word>, word_count> words {};
+        sys::mutex mut;
+
+        void publish(const T& value) noexcept
+        {
+            std::array<word, word_count> buf {};
+            std::memcpy(buf.data(), &value, sizeof(T));
+
+            const size_t seq = this->sequence.load(std::memory_order_relaxed);
+            this->sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < word_count; i++)
+                this->words[i].store(buf[i], std::memory_order_relaxed);
+            this->sequence.store(seq + 2, std::memory_order_release);
+        }
+        T snapshot() const noexcept
+        {
+            std::array<word, word_count> buf {};
+            for (size_t i = 0; i < word_count; i++)
+                buf[i] = this->words[i].load(std::memory_order_relaxed);
+
+            std::array<std::byte, sizeof(T)> bytes {};
+            std::memcpy(bytes.data(), buf.data(), sizeof(T));
+            return std::bit_cast<T>(bytes);
+        }
+    public:
+        seqlock() noexcept(std::is_nothrow_default_constructible_v<T>)
+        requires std::is_default_constructible_v<T>
+            : seqlock(T())
+        { }
+        explicit seqlock(const T& value) noexcept { this->publish(value); }
+        seqlock(const seqlock&) noexcept = delete;
+        seqlock(seqlock&&) noexcept = delete;
+        ~seqlock() noexcept = default;
+
+        seqlock& operator=(const seqlock&) noexcept = delete;
+        seqlock& operator=(seqlock&&) noexcept = delete;
+
+        /// @brief Read a consistent snapshot of the value, retrying for as long as it's concurrently written.
+        [[nodiscard]] T load() const noexcept
+        {
+            while (true)
+            {
+                const size_t before = this->sequence.load(std::memory_order_acquire);
+                if (before & 1uz)
+                {
+                    sys::thread_yield();
+                    continue;
+                }
+
+                T ret = this->snapshot();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (this->sequence.load(std::memory_order_relaxed) == before)
+                    return ret;
+            }
+        }
+        /// @brief Read a snapshot of the value, without retrying.
+        /// @return Whether `out` now holds a consistent snapshot, or a write was in progress and `out` is left untouched.
+        [[nodiscard]] bool try_load(T& out) const noexcept
+        {
+            const size_t before = this->sequence.load(std::memory_order_acquire);
+            _retif(false, before & 1uz);
+
+            T ret = this->snapshot();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            _retif(false, this->sequence.load(std::memory_order_relaxed) != before);
+            out = ret;
+            return true;
+        }
+
+        /// @brief Replace the value.
+        /// @return Propagated error from `sys::mutex::lock()`, or success.
+        sys::result<void, threading_error> store(const T& value) noexcept
+        {
+            auto guardRes = this->mut.lock();
+            _retif(guardRes.err(), !guardRes); // LCOV_EXCL_BR_LINE
+            this->publish(value);
+            return {};
+        }
+        /// @brief Replace the value with `func` applied to it, excluding other writers in the meantime.
+        /// @return Propagated error from `sys::mutex::lock()`, or success.
+        template <typename Func>
+        requires ICallable<Func, T&>
+        sys::result<void, threading_error> update(Func&& func) noexcept(INothrowCallable<Func, T&>)
+        {
+            auto guardRes = this->mut.lock();
+            _retif(guardRes.err(), !guardRes); // LCOV_EXCL_BR_LINE
+
+            // Writers are serialized, so the stored value can't change under us.
+            T value = this->snapshot();
+            _forward(func)(value);
+            this->publish(value);
+            return {};
+        }
+    };
+} // namespace sys
@@ -0,0 +1,261 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include <Integer.h>
+#include <LanguageSupport.h>
+#include <RwMutex.h>
+#include <StringEx.h>
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The single copy of a string interned in a `sys::string_pool<T>`, never modified or moved once interned.
+    template <ICharacter T>
+    struct interned_entry final
+    {
+        const T* data;
+        size_t hash;
+        uint_least32_t size;
+        uint_least32_t handle;
+    };
+} // namespace sys::internal
+
+namespace sys
+{
+    template <ICharacter T>
+    class string_pool;
+
+    /// @ingroup sys_threading
+    /// @brief A string interned in a `sys::string_pool<T>`, referring to the pool's single copy of it.
+    /// @details
+    /// A pool holds one copy of each distinct string, so interned strings from the same pool are equal exactly when they refer to the same copy, and compare as a
+    /// single pointer comparison rather than by their contents. A default-constructed interned string is null, referring to no string.
+    template <ICharacter T>
+    class interned_string final
+    {
+        const internal::interned_entry<T>* entry = nullptr;
+
+        explicit interned_string(const internal::interned_entry<T>* const entry) noexcept : entry(entry) { }
+
+        friend class string_pool<T>;
+    public:
+        /// @brief Null interned string.
+        interned_string() noexcept = default;
+        interned_string(const interned_string&) noexcept = default;
+        interned_string(interned_string&&) noexcept = default;
+        ~interned_string() = default;
+
+        interned_string& operator=(const interned_string&) noexcept = default;
+        interned_string& operator=(interned_string&&) noexcept = default;
+
+        /// @brief Whether `a` and `b` are the same string, by pointer.
+        /// @pre `a` and `b` were interned in the same pool.
+        friend bool operator==(const interned_string a, const interned_string b) noexcept { return a.entry == b.entry; }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return this->entry; }
+        /// @brief The interned text, empty if null.
+        /// @attention Lifetime assumptions! The text belongs to the pool, so is only valid while the pool is.
+        [[nodiscard]] /* NOLINT(hicpp-explicit-conversions) */ operator std::basic_string_view<T>() const noexcept
+        {
+            return this->entry ? std::basic_string_view<T>(this->entry->data, this->entry->size) : std::basic_string_view<T>();
+        }
+        /// @pre `*this`
+        [[nodiscard]] const T* data() const noexcept { return this->entry->data; }
+        /// @pre `*this`
+        [[nodiscard]] sz size() const noexcept { return sz(this->entry->size); }
+        /// @brief The handle the string can be found by with `sys::string_pool<T>::at(...)`.
+        /// @pre `*this`
+        [[nodiscard]] uint_least32_t handle() const noexcept { return this->entry->handle; }
+        /// @brief The hash of the interned text.
+        /// @pre `*this`
+        [[nodiscard]] sz hash_code() const noexcept { return sz(this->entry->hash); }
+    };
+
+    /// @ingroup sys_threading
+    /// @brief Pool of interned strings, holding a single copy of each distinct string, which can be interned into from any number of threads at once.
+    /// @details
+    /// Strings are copied into arenas, so interning many costs little more than their text, and never moves them, so an interned string remains valid until the
+    /// pool is destroyed. Each is identified both by a `sys::interned_string<T>`, and a stable 32-bit handle, unique within the pool, though not dense.
+    ///
+    /// The pool is split into shards by the hash of the strings, each with its own arena, hash table and reader-writer lock. Finding a string already interned
+    /// only takes its shard's lock for reading, and interning a new one only locks its shard, so threads interning into the same pool seldom contend.
+    /// @code{.cpp}
+    /// sys::string_pool<char8_t> identifiers;
+    /// const sys::interned_string<char8_t> a = identifiers.intern(token);
+    /// if (a == identifiers.intern(u8"return"))
+    ///     ...
+    /// @endcode
+    template <ICharacter T>
+    class string_pool final
+    {
+        using entry = internal::interned_entry<T>;
+
+        // A power of two, so that the low bits of the hash pick the shard, and the rest the slot in its table.
+        static constexpr size_t shard_bits = 6uz;
+        static constexpr size_t shard_count = 1uz << shard_bits;
+        static constexpr size_t chunk_bits = 6uz;
+        static constexpr size_t chunk_size = 1uz << chunk_bits;
+        static constexpr size_t min_slots = 64uz;
+
+        struct shard final
+        {
+            rw_mutex mut;
+            std::pmr::monotonic_buffer_resource arena;
+            // Open addressing with linear probing, kept at most three quarters full, of one more than the index of each entry, or zero where empty.
+            std::pmr::vector<uint_least32_t> slots;
+            // The entries in the order they were interned, in chunks that never move. Allocated from upstream, the arena would leave the rest of a block unused
+            // whenever a chunk didn't fit in it.
+            std::pmr::vector<entry*> chunks;
+            size_t count = 0uz;
+
+            explicit shard(std::pmr::memory_resource* const upstream) : arena(upstream), slots(upstream), chunks(upstream) { }
+            shard(const shard&) = delete;
+            shard(shard&&) = delete;
+            ~shard()
+            {
+                for (entry* const chunk : this->chunks)
+                    this->chunks.get_allocator().deallocate_object(chunk, chunk_size);
+            }
+
+            shard& operator=(const shard&) = delete;
+            shard& operator=(shard&&) = delete;
+
+            [[nodiscard]] const entry& entry_at(const size_t index) const noexcept { return this->chunks[index >> chunk_bits][index & (chunk_size - 1uz)]; }
+
+            [[nodiscard]] const entry* find(const std::basic_string_view<T> text, const size_t hash) const noexcept
+            {
+                _retif(nullptr, this->slots.empty());
+
+                const size_t mask = this->slots.size() - 1uz;
+                for (size_t i = (hash >> shard_bits) & mask;; i = (i + 1uz) & mask)
+                {
+                    const uint_least32_t slot = this->slots[i];
+                    _retif(nullptr, slot == 0u);
+                    const entry& e = this->entry_at(slot - 1uz);
+                    _retif(&e, e.hash == hash && std::basic_string_view<T>(e.data, e.size) == text);
+                }
+            }
+            void place(const size_t index) noexcept
+            {
+                const size_t mask = this->slots.size() - 1uz;
+                size_t i = (this->entry_at(index).hash >> shard_bits) & mask;
+                while (this->slots[i])
+                    i = (i + 1uz) & mask;
+                this->slots[i] = _as(index + 1uz, uint_least32_t);
+            }
+            /// @pre The shard is locked for writing, and `text` isn't already interned.
+            const entry* insert(const std::basic_string_view<T> text, const size_t hash, const size_t index)
+            {
+                _contract_assert(this->count <= (std::numeric_limits<uint_least32_t>::max() >> shard_bits), "Out of `sys::string_pool` handles!");
+                _contract_assert(text.size() <= std::numeric_limits<uint_least32_t>::max(), "String too long to intern!");
+
+                if ((this->count + 1uz) * 4uz > this->slots.size() * 3uz)
+                {
+                    // Grown into a new table, so the old is intact if allocating it throws.
+                    std::pmr::vector<uint_least32_t> grown(std::max(this->slots.size() * 2uz, min_slots), 0u, this->slots.get_allocator());
+                    this->slots.swap(grown);
+                    for (size_t i = 0uz; i < this->count; i++)
+                        this->place(i);
+                }
+                if (this->chunks.size() <= this->count >> chunk_bits)
+                {
+                    this->chunks.reserve(this->chunks.size() + 1uz);
+                    this->chunks.push_back(this->chunks.get_allocator().template allocate_object<entry>(chunk_size));
+                }
+
+                T* const data = _as(this->arena.allocate((text.size() + 1uz) * sizeof(T), alignof(T)), T*);
+                *std::ranges::copy(text, data).out = T();
+                const entry* const ret = std::construct_at(&this->chunks[this->count >> chunk_bits][this->count & (chunk_size - 1uz)],
+                                                           entry { .data = data,
+                                                                   .hash = hash,
+                                                                   .size = _as(text.size(), uint_least32_t),
+                                                                   .handle = _as((this->count << shard_bits) | index, uint_least32_t) });
+                this->place(this->count);
+                this->count++;
+                return ret;
+            }
+        };
+
+        std::unique_ptr<shard> shards[shard_count];
+    public:
+        /// @brief Empty pool, allocating from `upstream`.
+        explicit string_pool(std::pmr::memory_resource* const upstream = std::pmr::new_delete_resource())
+        {
+            for (std::unique_ptr<shard>& s : this->shards)
+                s = std::make_unique<shard>(upstream);
+        }
+        string_pool(const string_pool&) = delete;
+        string_pool(string_pool&&) = delete;
+        ~string_pool() = default;
+
+        string_pool& operator=(const string_pool&) = delete;
+        string_pool& operator=(string_pool&&) = delete;
+
+        /// @brief The interned copy of `text`, copying it into the pool if it's not already.
+        /// @attention Lifetime assumptions! The interned string is only valid while the pool is.
+        interned_string<T> intern(const std::basic_string_view<T> text)
+        {
+            const size_t hash = std::hash<std::basic_string_view<T>>()(text);
+            const size_t index = hash & (shard_count - 1uz);
+            shard& s = *this->shards[index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            {
+                const rw_mutex::read_guard g = s.mut.read_lock().expect();
+                if (const entry* const e = s.find(text, hash); e)
+                    return interned_string<T>(e);
+            }
+
+            // Another thread might have interned the same string between the locks.
+            const rw_mutex::write_guard g = s.mut.write_lock().expect();
+            if (const entry* const e = s.find(text, hash); e)
+                return interned_string<T>(e);
+            return interned_string<T>(s.insert(text, hash, index));
+        }
+        /// @brief The interned copy of `text`, or null if it's not interned.
+        [[nodiscard]] interned_string<T> find(const std::basic_string_view<T> text) const
+        {
+            const size_t hash = std::hash<std::basic_string_view<T>>()(text);
+            shard& s = *this->shards[hash & (shard_count - 1uz)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            const rw_mutex::read_guard g = s.mut.read_lock().expect();
+            return interned_string<T>(s.find(text, hash));
+        }
+        /// @brief The interned string with the handle `handle`.
+        /// @pre `handle` is that of a string interned in this pool.
+        [[nodiscard]] interned_string<T> at(const uint_least32_t handle) const
+        {
+            shard& s = *this->shards[handle & (shard_count - 1uz)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            const rw_mutex::read_guard g = s.mut.read_lock().expect();
+            return interned_string<T>(&s.entry_at(handle >> shard_bits));
+        }
+        /// @brief The number of distinct strings interned.
+        [[nodiscard]] sz size() const
+        {
+            sz ret = 0_uz;
+            for (const std::unique_ptr<shard>& s : this->shards)
+            {
+                const rw_mutex::read_guard g = s->mut.read_lock().expect();
+                ret += sz(s->count);
+            }
+            return ret;
+        }
+    };
+} // namespace sys
+
+/// @ingroup sys_threading
+/// @brief `std::hash<...>` specialization for `sys::interned_string<...>`, so interned strings can key unordered containers.
+template <sys::ICharacter T>
+struct /* NOLINT(bugprone-std-namespace-modification) */ std::hash<sys::interned_string<T>>
+{
+    size_t operator()(const sys::interned_string<T> str) const noexcept { return str ? *str.hash_code() : 0uz; }
+};
@@ -0,0 +1,581 @@
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <CompilerWarnings.h>
+#include <ConditionVariable.h>
+#include <Destructor.h>
+#include <LanguageSupport.h>
+#include <Mutex.h>
+#include <Platform.h>
+#include <Result.h>
+#include <ThreadEx.h>
+#include <ThreadingErrors.h>
+#include <meta/InterfaceRequirements.h>
+
+namespace sys
+{
+    class thread_pool;
+    template <typename T>
+    class task_future;
+} // namespace sys
+
+namespace sys::internal
+{
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Intrusive, type-erased unit of work queued on a `sys::thread_pool`.
+    /// @details `run` takes ownership of the task, and is responsible for freeing it.
+    struct pool_task
+    {
+        void (*run)(pool_task*) noexcept = nullptr;
+        pool_task* next = nullptr;
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Fixed-capacity Chase-Lev deque. The owning worker pushes and pops at the bottom, any thread may steal from the top.
+    /// @see [Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models"](https://dl.acm.org/doi/10.1145/2442516.2442524).
+    class work_stealing_deque
+    {
+        static constexpr int64_t capacity = 256;
+        static constexpr int64_t mask = capacity - 1;
+
+        alignas(_libcxxext_cache_line_size) std::atomic<int64_t> top { 0 };
+        alignas(_libcxxext_cache_line_size) std::atomic<int64_t> bottom { 0 };
+        std::atomic<pool_task*> slots[capacity] {};
+    public:
+        /// @brief Push `task` as the owner.
+        /// @return Whether there was room for `task`.
+        bool push(pool_task* task) noexcept
+        {
+            const int64_t b = this->bottom.load(std::memory_order_relaxed);
+            _retif(false, b - this->top.load(std::memory_order_acquire) >= capacity);
+
+            this->slots[b & mask].store(task, std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            std::atomic_thread_fence(std::memory_order_release);
+            this->bottom.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+        /// @brief Pop the most recently pushed task as the owner, or `nullptr`.
+        [[nodiscard]] pool_task* pop() noexcept
+        {
+            const int64_t b = this->bottom.load(std::memory_order_relaxed) - 1;
+            this->bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = this->top.load(std::memory_order_relaxed);
+
+            pool_task* ret = nullptr;
+            if (t <= b)
+            {
+                ret = this->slots[b & mask].load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (t == b)
+                {
+                    // Last task, race the thieves for it.
+                    if (!this->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        ret = nullptr;
+                    this->bottom.store(b + 1, std::memory_order_relaxed);
+                }
+            }
+            else
+                this->bottom.store(b + 1, std::memory_order_relaxed);
+            return ret;
+        }
+        /// @brief Steal the least recently pushed task, or `nullptr` if empty or another thread won the race.
+        [[nodiscard]] pool_task* steal() noexcept
+        {
+            int64_t t = this->top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t b = this->bottom.load(std::memory_order_acquire);
+            _retif(nullptr, t >= b);
+
+            pool_task* ret = this->slots[t & mask].load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            _retif(nullptr, !this->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed));
+            return ret;
+        }
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Shared state of a `sys::task_future<T>`, which is also the task producing it.
+    template <typename T>
+    struct pool_future_state : pool_task
+    {
+        std::atomic<uint32_t> refs { 2 }; // The pool, and the future.
+        std::atomic<uint32_t> pending { 1 };
+        std::optional<std::conditional_t<std::same_as<T, void>, std::nullptr_t, T>> value;
+        void (*destroy)(pool_future_state*) noexcept = nullptr;
+
+        void release() noexcept
+        {
+            if (this->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                this->destroy(this);
+        }
+    };
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief The worker the calling thread runs as, if any.
+    struct pool_worker_ref
+    {
+        const void* pool = nullptr;
+        size_t index = 0;
+    };
+    /// @internal
+    /// @ingroup sys_internal
+    inline pool_worker_ref& pool_worker_current() noexcept
+    {
+        static thread_local pool_worker_ref ret;
+        return ret;
+    }
+
+    /// @internal
+    /// @ingroup sys_internal
+    /// @brief Heap-allocated state of a `sys::thread_pool`, shared with its workers.
+    class thread_pool_state
+    {
+        struct worker
+        {
+            work_stealing_deque deque;
+            sys::managed_thread th = nullptr;
+        };
+
+        worker* workers = nullptr;
+        size_t worker_count = 0;
+
+        // Tasks queued from outside the pool, or that didn't fit a worker's deque.
+        sys::mutex inject_mut;
+        pool_task* inject_head = nullptr;
+        pool_task* inject_tail = nullptr;
+        std::atomic<size_t> injected { 0 };
+
+        // Every queued task not yet taken by a worker, so idle workers know whether to park.
+        std::atomic<size_t> queued { 0 };
+        std::atomic<size_t> sleeping { 0 };
+        std::atomic<bool> stopping { false };
+        sys::mutex sleep_mut;
+        sys::cond_var sleep_cv;
+
+        [[nodiscard]] bool is_worker(size_t& index) const noexcept
+        {
+            const pool_worker_ref& ref = pool_worker_current();
+            index = ref.index;
+            return ref.pool == this;
+        }
+        static uint64_t next_random() noexcept
+        {
+            static thread_local uint64_t state = _as(_asr(&state, uintptr_t), uint64_t) | 1;
+            state ^= state << 13; // NOLINT(readability-magic-numbers)
+            state ^= state >> 7;  // NOLINT(readability-magic-numbers)
+            state ^= state << 17; // NOLINT(readability-magic-numbers)
+            return state;
+        }
+
+        void inject(pool_task* task) noexcept
+        {
+            const sys::mutex::guard g = this->inject_mut.lock().expect();
+            task->next = nullptr;
+            if (this->inject_tail)
+                this->inject_tail->next = task;
+            else
+                this->inject_head = task;
+            this->inject_tail = task;
+            this->injected.fetch_add(1, std::memory_order_release);
+        }
+        [[nodiscard]] pool_task* take_injected() noexcept
+        {
+            _retif(nullptr, this->injected.load(std::memory_order_acquire) == 0);
+
+            const sys::mutex::guard g = this->inject_mut.lock().expect();
+            pool_task* ret = this->inject_head;
+            if (ret)
+            {
+                this->inject_head = ret->next;
+                if (!this->inject_head)
+                    this->inject_tail = nullptr;
+                this->injected.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return ret;
+        }
+        [[nodiscard]] pool_task* find_task() noexcept
+        {
+            size_t self = 0;
+            const bool isWorker = this->is_worker(self);
+
+            pool_task* ret = nullptr;
+            if (isWorker)
+                ret = this->workers[self].deque.pop(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (!ret)
+                ret = this->take_injected();
+            // Random victims, so thieves spread out rather than convoy on the same deque.
+            for (size_t i = 0; !ret && i < this->worker_count; i++)
+            {
+                const size_t victim = _as(thread_pool_state::next_random() % this->worker_count, size_t);
+                if (!isWorker || victim != self)
+                    ret = this->workers[victim].deque.steal(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+
+            if (ret)
+                this->queued.fetch_sub(1, std::memory_order_seq_cst);
+            return ret;
+        }
+
+        int work(const size_t index) noexcept
+        {
+            pool_worker_current() = { this, index };
+            while (true)
+            {
+                if (pool_task* task = this->find_task())
+                {
+                    task->run(task);
+                    continue;
+                }
+
+                this->sleeping.fetch_add(1, std::memory_order_seq_cst);
+                if (auto guardRes = this->sleep_mut.lock(); guardRes)
+                {
+                    const sys::mutex::guard g = guardRes.move();
+                    (void)this->sleep_cv.wait_until(this->sleep_mut, [&]() noexcept -> bool
+                    { return this->queued.load(std::memory_order_seq_cst) > 0 || this->stopping.load(std::memory_order_relaxed); });
+                }
+                this->sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+                if (this->stopping.load(std::memory_order_relaxed) && this->queued.load(std::memory_order_seq_cst) == 0)
+                    return 0;
+            }
+        }
+    public:
+        thread_pool_state() noexcept = default;
+        thread_pool_state(const thread_pool_state&) noexcept = delete;
+        thread_pool_state(thread_pool_state&&) noexcept = delete;
+        ~thread_pool_state() noexcept
+        {
+            this->stop();
+            delete[] this->workers; // NOLINT(cppcoreguidelines-owning-memory)
+        }
+
+        thread_pool_state& operator=(const thread_pool_state&) noexcept = delete;
+        thread_pool_state& operator=(thread_pool_state&&) noexcept = delete;
+
+        [[nodiscard]] sys::result<void, threading_error> start(const size_t count) noexcept
+        {
+            this->workers = new(std::nothrow) worker[count] /* NOLINT(cppcoreguidelines-owning-memory) */; // LCOV_EXCL_BR_LINE
+            _retif(threading_error::oom, !this->workers);
+            this->worker_count = count;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                auto threadRes = sys::managed_thread::ctor([this, i]() noexcept -> int { return this->work(i); });
+                _retif(threading_error::init_failed, !threadRes);
+                this->workers[i].th = threadRes.move(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+            return {};
+        }
+        /// @brief Let the workers drain the queued tasks, then join them.
+        void stop() noexcept
+        {
+            _retif(, this->stopping.exchange(true, std::memory_order_seq_cst));
+
+            if (auto guardRes = this->sleep_mut.lock(); guardRes)
+            {
+                const sys::mutex::guard g = guardRes.move();
+                (void)this->sleep_cv.notify_all();
+            }
+            for (size_t i = 0; i < this->worker_count; i++)
+            {
+                if (this->workers[i].th) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    (void)this->workers[i].th.join(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return this->worker_count; }
+
+        /// @brief Queue `task`, onto the calling worker's own deque if possible.
+        void push(pool_task* task) noexcept
+        {
+            // Counted before it's visible, so a thief can never take `queued` below zero.
+            this->queued.fetch_add(1, std::memory_order_seq_cst);
+
+            size_t self = 0;
+            if (!this->is_worker(self) || !this->workers[self].deque.push(task)) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                this->inject(task);
+
+            if (this->sleeping.load(std::memory_order_seq_cst) > 0)
+            {
+                if (auto guardRes = this->sleep_mut.lock(); guardRes)
+                {
+                    const sys::mutex::guard g = guardRes.move();
+                    (void)this->sleep_cv.notify_one();
+                }
+            }
+        }
+        /// @brief Run queued tasks until `count` reaches zero.
+        /// @param block Whether to sleep on `count` when no task is queued, rather than yield. `count` must then be notified when it reaches zero.
+        void help_until_zero(std::atomic<uint32_t>& count, const bool block) noexcept
+        {
+            while (const uint32_t current = count.load(std::memory_order_acquire))
+            {
+                if (pool_task* task = this->find_task())
+                    task->run(task);
+                else if (block)
+                    count.wait(current, std::memory_order_acquire);
+                else
+                    sys::thread_yield();
+            }
+        }
+    };
+} // namespace sys::internal
+
+namespace sys
+{
+    /// @ingroup sys_threading
+    /// @brief The eventual result of a task submitted to a `sys::thread_pool`, or `nullptr`.
+    /// @details Implements `sys::INothrowMoveConstructible`, `sys::INothrowMoveAssignable`, `sys::INothrowDestructible`, `sys::IBooleanTestable`, `sys::INothrowSwappable`.
+    /// @note Destroying a future without `.get()` detaches the task, which still runs.
+    template <typename T>
+    class [[nodiscard]] task_future final
+    {
+        internal::pool_future_state<T>* state = nullptr;
+        internal::thread_pool_state* pool = nullptr;
+
+        task_future(internal::pool_future_state<T>* state, internal::thread_pool_state* pool, decltype(unsafe)) noexcept : state(state), pool(pool) { }
+    public:
+        /// @brief Construct an empty future.
+        /* NOLINT(hicpp-explicit-conversions) */ task_future(std::nullptr_t) noexcept { }
+        task_future(const task_future&) noexcept = delete;
+        task_future(task_future&& other) noexcept { swap(*this, other); }
+        ~task_future() noexcept
+        {
+            if (this->state)
+                this->state->release();
+        }
+
+        task_future& operator=(const task_future&) noexcept = delete;
+        task_future& operator=(task_future&& other) noexcept
+        {
+            swap(*this, other);
+            return *this;
+        }
+
+        /// @brief Whether this future is valid (i.e. non-empty).
+        [[nodiscard]] explicit operator bool() const noexcept { return this->state; }
+        /// @brief Whether the task has finished, and `.get()` won't block.
+        [[nodiscard]] bool ready() const noexcept { return this->state && this->state->pending.load(std::memory_order_acquire) == 0; }
+
+        /// @brief Block-and-wait for the task to finish, running other queued tasks meanwhile, and take its result.
+        /// @return The task's result, `threading_error::operation_failed` if it threw, or `threading_error::invalid_operation` if `this` is empty.
+        /// @post `this` is empty.
+        result<T, threading_error> get() noexcept(std::same_as<T, void> || INothrowMoveConstructible<T>)
+        {
+            _retif(threading_error::invalid_operation, !this->state);
+
+            // A finished task may have outlived its pool, which is only alive to help while the task is pending.
+            if (this->state->pending.load(std::memory_order_acquire) != 0)
+                this->pool->help_until_zero(this->state->pending, true);
+            internal::pool_future_state<T>* s = std::exchange(this->state, nullptr);
+            _defer([s]() noexcept -> void { s->release(); }); // LCOV_EXCL_BR_LINE
+
+            _retif(threading_error::operation_failed, !s->value.has_value());
+            if constexpr (std::same_as<T, void>)
+                return {};
+            else
+                return std::move(*s->value);
+        }
+
+        friend void swap(task_future& a, task_future& b) noexcept
+        {
+            std::swap(a.state, b.state);
+            std::swap(a.pool, b.pool);
+        }
+
+        friend class sys::thread_pool;
+    };
+
+    /// @ingroup sys_threading
+    /// @brief A fixed set of worker threads running submitted tasks, or `nullptr`.
+    /// @details
+    /// Each worker owns a Chase-Lev deque. Tasks submitted from a worker go onto its own deque, and idle workers steal from random victims before parking. Waiting on a result
+    /// runs other queued tasks meanwhile, so tasks may submit and wait on subtasks freely.
+    ///
+    /// Implements `sys::INothrowMoveConstructible`, `sys::INothrowMoveAssignable`, `sys::INothrowDestructible`, `sys::IBooleanTestable`, `sys::INothrowSwappable`.
+    /// @note Destroying a pool runs every task already submitted, then joins its workers.
+    class [[nodiscard]] thread_pool final
+    {
+        internal::thread_pool_state* state = nullptr;
+
+        explicit thread_pool(internal::thread_pool_state* state, decltype(unsafe)) noexcept : state(state) { }
+
+        template <typename Func>
+        struct closure_task : internal::pool_task
+        {
+            Func func;
+
+            explicit closure_task(auto&& func) : func(_forward(func)) { this->run = &closure_task::invoke; }
+
+            static void invoke(internal::pool_task* task) noexcept
+            {
+                closure_task* self = _as(task, closure_task*);
+                self->func();
+                delete self; // NOLINT(cppcoreguidelines-owning-memory)
+            }
+        };
+        template <typename Func, typename T>
+        struct future_task : internal::pool_future_state<T>
+        {
+            Func func;
+
+            explicit future_task(auto&& func) : func(_forward(func))
+            {
+                this->run = &future_task::invoke;
+                this->destroy = &future_task::free;
+            }
+
+            static void invoke(internal::pool_task* task) noexcept
+            {
+                future_task* self = _as(task, future_task*);
+                try
+                {
+                    if constexpr (std::same_as<T, void>)
+                    {
+                        self->func();
+                        self->value.emplace(nullptr);
+                    }
+                    else
+                        self->value.emplace(self->func());
+                }
+                catch (...)
+                {
+                    self->value.reset();
+                }
+
+                self->pending.store(0, std::memory_order_release);
+                self->pending.notify_all();
+                self->release();
+            }
+            static void free(internal::pool_future_state<T>* state) noexcept { delete _as(state, future_task*); /* NOLINT(cppcoreguidelines-owning-memory) */ }
+        };
+    public:
+        /// @brief Construct an empty thread pool.
+        /* NOLINT(hicpp-explicit-conversions) */ thread_pool(std::nullptr_t) noexcept { }
+        thread_pool(const thread_pool&) noexcept = delete;
+        thread_pool(thread_pool&& other) noexcept { swap(*this, other); }
+        ~thread_pool() noexcept { delete this->state; /* NOLINT(cppcoreguidelines-owning-memory) */ }
+
+        thread_pool& operator=(const thread_pool&) noexcept = delete;
+        thread_pool& operator=(thread_pool&& other) noexcept
+        {
+            swap(*this, other);
+            return *this;
+        }
+
+        /// @brief Spin up a pool of `workers` threads.
+        /// @return The pool, `threading_error::invalid_argument` if `workers == 0`, or the error spinning up the workers.
+        static result<thread_pool, threading_error> ctor(const size_t workers) noexcept
+        {
+            _retif(threading_error::invalid_argument, workers == 0);
+
+            internal::thread_pool_state* state = new(std::nothrow) internal::thread_pool_state() /* NOLINT(cppcoreguidelines-owning-memory) */; // LCOV_EXCL_BR_LINE
+            _retif(threading_error::oom, !state);
+            thread_pool ret(state, unsafe);
+            _retif(startRes.err(), auto startRes = state->start(workers); !startRes);
+            return ret;
+        }
+        /// @brief Spin up a pool with one thread per hardware thread.
+        static result<thread_pool, threading_error> ctor() noexcept { return thread_pool::ctor(std::max(std::thread::hardware_concurrency(), 1u)); }
+
+        /// @brief Whether this thread pool is valid (i.e. non-empty).
+        [[nodiscard]] explicit operator bool() const noexcept { return this->state; }
+        /// @brief The number of worker threads.
+        [[nodiscard]] size_t size() const noexcept { return this->state ? this->state->size() : 0; }
+
+        /// @brief Queue `func()` to run on a worker.
+        /// @return A future for the result of `func()`, or `threading_error::oom`, or `threading_error::invalid_operation` if `this` is empty.
+        template <typename Func>
+        requires IFunctionObject<std::decay_t<Func>> && INothrowDestructible<std::decay_t<Func>> && (!std::is_reference_v<std::invoke_result_t<std::decay_t<Func>&>>)
+        auto submit(Func&& func) noexcept(INothrowConstructibleFrom<std::decay_t<Func>, decltype(_forward(func))>)
+        {
+            using ret_type = std::invoke_result_t<std::decay_t<Func>&>;
+            using task_type = future_task<std::decay_t<Func>, ret_type>;
+            _retif((result<task_future<ret_type>, threading_error>(threading_error::invalid_operation)), !this->state);
+
+            task_type* task = new(std::nothrow) task_type(_forward(func)) /* NOLINT(cppcoreguidelines-owning-memory) */; // LCOV_EXCL_BR_LINE
+            _retif((result<task_future<ret_type>, threading_error>(threading_error::oom)), !task);
+
+            this->state->push(task);
+            return result<task_future<ret_type>, threading_error>(task_future<ret_type>(task, this->state, unsafe));
+        }
+
+        /// @brief Run `func(i)` for every `i` in `[begin, end)`, split into chunks of `grain` indices across the workers and the calling thread.
+        /// @param grain Indices per chunk, or `0` to pick one from the range and pool size.
+        /// @return Success once every index ran, `threading_error::operation_failed` if any invocation threw, or `threading_error::invalid_operation` if `this` is empty.
+        template <typename Func>
+        requires std::invocable<Func&, size_t>
+        result<void, threading_error> parallel_for(const size_t begin, const size_t end, Func&& func, size_t grain = 0) noexcept
+        {
+            _retif(threading_error::invalid_operation, !this->state);
+            _retif({}, begin >= end);
+
+            const size_t count = end - begin;
+            if (grain == 0)
+                grain = std::max<size_t>(count / ((this->state->size() + 1) * 4), 1); // NOLINT(readability-magic-numbers)
+
+            std::atomic<size_t> next { begin };
+            std::atomic<bool> failed { false };
+            auto body = [&]() noexcept -> void
+            {
+                while (true)
+                {
+                    const size_t from = next.fetch_add(grain, std::memory_order_relaxed);
+                    if (from >= end)
+                        return;
+
+                    const size_t to = std::min(end - from, grain) + from;
+                    try
+                    {
+                        for (size_t i = from; i < to; i++)
+                            func(i);
+                    }
+                    catch (...)
+                    {
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+            };
+
+            // Each helper decrements `active` as its very last access to this frame.
+            std::atomic<uint32_t> active { 0 };
+            auto helper = [&]() noexcept -> void
+            {
+                body();
+                active.fetch_sub(1, std::memory_order_release);
+            };
+            const size_t helpers = std::min((count + grain - 1) / grain - 1, this->state->size());
+            for (size_t i = 0; i < helpers; i++)
+            {
+                auto* task = new(std::nothrow) closure_task<decltype(helper)>(helper) /* NOLINT(cppcoreguidelines-owning-memory) */; // LCOV_EXCL_BR_LINE
+                if (!task) [[unlikely]]
+                    break;
+                active.fetch_add(1, std::memory_order_relaxed);
+                this->state->push(task);
+            }
+
+            body();
+            this->state->help_until_zero(active, false);
+            _retif(threading_error::operation_failed, failed.load(std::memory_order_relaxed));
+            return {};
+        }
+
+        friend void swap(thread_pool& a, thread_pool& b) noexcept { std::swap(a.state, b.state); }
+    };
+} // namespace sys
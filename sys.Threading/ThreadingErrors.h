@@ -17,6 +17,7 @@ namespace sys
         busy,
         invalid_argument,
         invalid_operation,
-        overflow
+        overflow,
+        timeout
     };
 }; // namespace sys
@@ -292,3 +292,13 @@
 /// @endcond
 
 // NOLINTEND(readability-use-concise-preprocessor-directives)
+
+/// @def _libcxxext_cache_line_size
+/// @ingroup sys
+/// @brief Size in bytes of a cache line on the target ISA, for separating data written by different threads.
+/// @note Unlike `std::hardware_destructive_interference_size`, this is stable across compiler flags, and so safe to use in headers.
+#if (_libcxxext_arch_aarch64 && _libcxxext_os_macos) || _libcxxext_arch_powerpc
+#define _libcxxext_cache_line_size 128
+#else
+#define _libcxxext_cache_line_size 64
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+/// @file
+
+#include <Platform.h>
+
+#if _libcxxext_arch_x86_64
+#if _libcxxext_compiler_msvc
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+/// @defgroup simd_detection SIMD Instruction Set Constants
+/// @ingroup tags
+/// @ingroup sys
+/// @brief `#ifdef`able constants for vector instruction set availability.
+/// @{
+
+/// @def _libcxxext_simd_sse2
+/// @brief Check if SSE2 is available unconditionally (part of the x86_64 baseline).
+#define _libcxxext_simd_sse2 0
+/// @def _libcxxext_simd_avx2
+/// @brief Check if AVX2 kernels can be compiled. Availability at runtime must still be queried with `sys::internal::cpu_features_current()`.
+#define _libcxxext_simd_avx2 0
+
+/// @}
+
+/// @cond
+#if _libcxxext_arch_x86_64
+#undef _libcxxext_simd_sse2
+#define _libcxxext_simd_sse2 1
+#undef _libcxxext_simd_avx2
+#define _libcxxext_simd_avx2 1
+#endif
+/// @endcond
+
+/// @def _target_avx2
+/// @ingroup sys
+/// @brief Compile a function for AVX2, independent of the baseline target ISA.
+/// @note Such functions must only be called once `sys::internal::cpu_features_current().avx2` was checked.
+#if _libcxxext_simd_avx2 && !_libcxxext_compiler_msvc
+#define _target_avx2 [[gnu::target("avx2")]]
+#else
+#define _target_avx2
+#endif
+
+namespace sys::internal
+{
+    /// @ingroup sys_internal
+    /// @brief Vector instruction set extensions available at runtime, beyond the baseline of the compilation target.
+    struct cpu_features final
+    {
+        bool avx2 = false;
+    };
+
+    /// @ingroup sys_internal
+    /// @brief Query the vector instruction set extensions of the executing processor.
+    /// @note The result is computed once and cached.
+    [[nodiscard]] inline const cpu_features& cpu_features_current() noexcept
+    {
+        static const cpu_features ret = []
+        {
+            cpu_features features;
+#if _libcxxext_simd_avx2 && _libcxxext_compiler_msvc
+            // NOLINTBEGIN(readability-magic-numbers, hicpp-no-array-decay)
+            int info[4] {};
+            __cpuid(info, 1);
+            const bool cpuHasAvx = (info[2] & (1 << 28)) != 0;
+            const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            features.avx2 = cpuHasAvx && osSavesYmm && (info[1] & (1 << 5)) != 0;
+            // NOLINTEND(readability-magic-numbers, hicpp-no-array-decay)
+#elif _libcxxext_simd_avx2
+            __builtin_cpu_init();
+            features.avx2 = __builtin_cpu_supports("avx2");
+#endif
+            return features;
+        }();
+        return ret;
+    }
+} // namespace sys::internal
@@ -0,0 +1,121 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity, readability-magic-numbers)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys.Containers>
+#include <module/sys.Threading>
+
+TEST_CASE("inplace_mpmc_queue::enqueue(...)/try_dequeue(...)", "[sys.Containers][inplace_mpmc_queue]")
+{
+    sys::inplace_mpmc_queue<int, 4> q;
+    CHECK(q.empty());
+    CHECK(q.capacity() == 4);
+
+    int out = 0;
+    CHECK_FALSE(q.try_dequeue(out));
+
+    // Wrap around the ring a few times.
+    for (int lap = 0; lap < 3; lap++)
+    {
+        for (int i = 0; i < 4; i++)
+            CHECK(q.enqueue(lap * 4 + i));
+        CHECK_FALSE(q.enqueue(-1));
+        CHECK(q.size() == 4);
+
+        for (int i = 0; i < 4; i++)
+        {
+            CHECK(q.try_dequeue(out));
+            CHECK(out == lap * 4 + i);
+        }
+        CHECK_FALSE(q.try_dequeue(out));
+        CHECK(q.empty());
+    }
+}
+
+TEST_CASE("inplace_mpmc_queue::enqueue_bulk(...)/try_dequeue_bulk(...)", "[sys.Containers][inplace_mpmc_queue]")
+{
+    sys::inplace_mpmc_queue<int, 8> q;
+    const std::array<int, 6> in { 1, 2, 3, 4, 5, 6 };
+    std::array<int, 6> out {};
+
+    CHECK(q.enqueue_bulk(in) == 6);
+    CHECK(q.enqueue_bulk(in) == 2);
+    CHECK(q.try_dequeue_bulk(std::span(out).first(5)) == 5);
+    CHECK(out == std::array<int, 6> { 1, 2, 3, 4, 5, 0 });
+    CHECK(q.try_dequeue_bulk(out) == 3);
+    CHECK(out == std::array<int, 6> { 6, 1, 2, 4, 5, 0 });
+    CHECK(q.try_dequeue_bulk(out) == 0);
+    CHECK(q.enqueue_bulk(std::span<const int>()) == 0);
+}
+
+TEST_CASE("inplace_mpmc_queue Producers/Consumers", "[sys.Containers][inplace_mpmc_queue]")
+{
+    constexpr size_t threads = 4, perProducer = 20000;
+
+    // Each item carries its producer in the low bits, so per-producer order can be checked by every consumer.
+    sys::inplace_mpmc_queue<size_t, 64> q;
+    std::atomic<size_t> dequeued = 0, sum = 0;
+    std::atomic<bool> ordered = true;
+
+    std::vector<sys::managed_thread> workers;
+    for (size_t producer = 0; producer < threads; producer++)
+    {
+        workers.push_back(sys::managed_thread::ctor([&q, producer]() -> void
+        {
+            size_t next = 1;
+            while (next <= perProducer)
+            {
+                std::array<size_t, 3> batch {};
+                size_t batchSize = 0;
+                for (; batchSize < batch.size() && next + batchSize <= perProducer; batchSize++)
+                    batch.at(batchSize) = (next + batchSize) * threads + producer;
+
+                const size_t enqueued = q.enqueue_bulk(std::span(batch).first(batchSize));
+                if (!enqueued)
+                    sys::thread_yield();
+                next += enqueued;
+            }
+        }).expect());
+    }
+    for (size_t consumer = 0; consumer < threads; consumer++)
+    {
+        workers.push_back(sys::managed_thread::ctor([&]() -> void
+        {
+            std::array<size_t, threads> last {};
+            while (dequeued.load() < threads * perProducer)
+            {
+                std::array<size_t, 4> batch {};
+                const size_t count = q.try_dequeue_bulk(batch);
+                if (!count)
+                    sys::thread_yield();
+                for (size_t i = 0; i < count; i++)
+                {
+                    const size_t producer = batch.at(i) % threads, value = batch.at(i) / threads;
+                    if (value <= last.at(producer))
+                        ordered = false;
+                    last.at(producer) = value;
+                    sum += value;
+                }
+                dequeued += count;
+            }
+        }).expect());
+    }
+
+    for (sys::managed_thread& t : workers)
+        CHECK(t.join().expect() == 0);
+    CHECK(ordered);
+    CHECK(sum == threads * perProducer * (perProducer + 1) / 2);
+    CHECK(q.empty());
+}
+
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity, readability-magic-numbers)
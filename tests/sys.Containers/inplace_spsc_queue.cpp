@@ -0,0 +1,98 @@
+#include <array>
+#include <cstddef>
+#include <span>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity, readability-magic-numbers)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys.Containers>
+#include <module/sys.Threading>
+
+TEST_CASE("inplace_spsc_queue::enqueue(...)/try_dequeue(...)", "[sys.Containers][inplace_spsc_queue]")
+{
+    sys::inplace_spsc_queue<int, 4> q;
+    CHECK(q.empty());
+    CHECK(q.capacity() == 4);
+
+    int out = 0;
+    CHECK_FALSE(q.try_dequeue(out));
+
+    // Wrap around the ring a few times.
+    for (int lap = 0; lap < 3; lap++)
+    {
+        for (int i = 0; i < 4; i++)
+            CHECK(q.enqueue(lap * 4 + i));
+        CHECK_FALSE(q.enqueue(-1));
+        CHECK(q.size() == 4);
+
+        for (int i = 0; i < 4; i++)
+        {
+            CHECK(q.try_dequeue(out));
+            CHECK(out == lap * 4 + i);
+        }
+        CHECK_FALSE(q.try_dequeue(out));
+        CHECK(q.empty());
+    }
+}
+
+TEST_CASE("inplace_spsc_queue::enqueue_bulk(...)/try_dequeue_bulk(...)", "[sys.Containers][inplace_spsc_queue]")
+{
+    sys::inplace_spsc_queue<int, 8> q;
+    const std::array<int, 6> in { 1, 2, 3, 4, 5, 6 };
+    std::array<int, 6> out {};
+
+    CHECK(q.enqueue_bulk(in) == 6);
+    CHECK(q.enqueue_bulk(in) == 2);
+    CHECK(q.try_dequeue_bulk(std::span(out).first(5)) == 5);
+    CHECK(out == std::array<int, 6> { 1, 2, 3, 4, 5, 0 });
+    CHECK(q.try_dequeue_bulk(out) == 3);
+    CHECK(out == std::array<int, 6> { 6, 1, 2, 4, 5, 0 });
+    CHECK(q.try_dequeue_bulk(out) == 0);
+    CHECK(q.enqueue_bulk(std::span<const int>()) == 0);
+}
+
+TEST_CASE("inplace_spsc_queue Producer/Consumer", "[sys.Containers][inplace_spsc_queue]")
+{
+    constexpr size_t count = 100000;
+
+    sys::inplace_spsc_queue<size_t, 64> q;
+    sys::managed_thread producer = sys::managed_thread::ctor([&q]() -> void
+    {
+        size_t next = 0;
+        while (next < count)
+        {
+            std::array<size_t, 5> batch {};
+            size_t batchSize = 0;
+            for (; batchSize < batch.size() && next + batchSize < count; batchSize++)
+                batch.at(batchSize) = next + batchSize;
+
+            const size_t enqueued = next % 2 ? q.enqueue_bulk(std::span(batch).first(batchSize)) : size_t(q.enqueue(batch.front()));
+            if (!enqueued)
+                sys::thread_yield();
+            next += enqueued;
+        }
+    }).expect();
+
+    bool ordered = true;
+    size_t expected = 0;
+    while (expected < count)
+    {
+        std::array<size_t, 7> batch {};
+        const size_t dequeued = q.try_dequeue_bulk(batch);
+        if (!dequeued)
+            sys::thread_yield();
+        for (size_t i = 0; i < dequeued; i++)
+            ordered &= batch.at(i) == expected++;
+    }
+
+    CHECK(producer.join().expect() == 0);
+    CHECK(ordered);
+    CHECK(q.empty());
+}
+
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity, readability-magic-numbers)
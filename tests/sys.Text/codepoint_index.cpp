@@ -0,0 +1,90 @@
+#include <span>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+TEST_CASE("codepoint_index<...>, random access", "[sys.Text][codepoint_index]")
+{
+    sys::str s;
+    for (sz i = 0_uz; i < 100_uz; i++)
+        s.append(std::u8string_view(u8"aé東😀"));
+
+    for (const sz stride : { 1_uz, 3_uz, 256_uz })
+    {
+        CAPTURE(*stride);
+        const sys::codepoint_index index(s, stride);
+        REQUIRE(index.codepoint_count() == 400_uz);
+        CHECK(index.nth_codepoint(0_uz) == U'a');
+        CHECK(index.nth_codepoint(201_uz) == U'é');
+        CHECK(index.nth_codepoint(398_uz) == U'東');
+        CHECK(index.nth_codepoint(399_uz) == U'😀');
+
+        CHECK(index.unit_offset_of(4_uz) == 10_uz);
+        CHECK(index.unit_offset_of(7_uz) == 16_uz);
+        CHECK(index.unit_offset_of(400_uz) == s.size());
+        CHECK(index.codepoint_offset_of(10_uz) == 4_uz);
+        CHECK(index.codepoint_offset_of(12_uz) == 5_uz); // Inside `é`.
+        CHECK(index.codepoint_offset_of(19_uz) == 7_uz); // Inside `😀`.
+        CHECK(index.codepoint_offset_of(s.size()) == 400_uz);
+    }
+
+    // Invalid sequences are a codepoint per code unit, as when iterating.
+    const std::u8string invalid { u8'a', char8_t(0xE6), char8_t(0x9D), u8'b', char8_t(0x80), u8'c' };
+    const sys::codepoint_index index(std::u8string_view(invalid), 2_uz);
+    CHECK(index.codepoint_count() == 6_uz);
+    CHECK(index.nth_codepoint(2_uz) == U'\uFFFD');
+    CHECK(index.nth_codepoint(5_uz) == U'c');
+
+    const sys::codepoint_index index16(std::u16string_view(u"a😀b"), 1_uz);
+    CHECK(index16.codepoint_count() == 3_uz);
+    CHECK(index16.unit_offset_of(2_uz) == 3_uz);
+    CHECK(index16.codepoint_offset_of(2_uz) == 1_uz);
+
+    CHECK(sys::codepoint_index(std::u32string_view()).codepoint_count() == 0_uz);
+}
+
+TEST_CASE("codepoint_index<...>::extend(...)", "[sys.Text][codepoint_index]")
+{
+    sys::str s(u8'x', 10_uz);
+    sys::codepoint_index index(s, 4_uz);
+
+    // A sequence split between appends is one codepoint once finished.
+    s.append(char8_t(0xF0));
+    s.append(char8_t(0x9F));
+    index.extend(s);
+    CHECK(index.codepoint_count() == 12_uz);
+    s.append(char8_t(0x98));
+    s.append(char8_t(0x80));
+    s.append(std::u8string_view(u8"yz"));
+    index.extend(s);
+    CHECK(index.codepoint_count() == 13_uz);
+    CHECK(index.nth_codepoint(10_uz) == U'😀');
+    CHECK(index.nth_codepoint(12_uz) == U'z');
+    CHECK(index.unit_offset_of(12_uz) == 15_uz);
+
+    for (sz i = 0_uz; i < 1000_uz; i++)
+        s.append(std::u8string_view(u8"é"));
+    index.extend(s);
+    CHECK(index.codepoint_count() == 1013_uz);
+    CHECK(index.codepoint_offset_of(s.size() - 1_uz) == 1012_uz);
+    CHECK(index.nth_codepoint(1012_uz) == U'é');
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
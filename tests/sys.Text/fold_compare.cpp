@@ -0,0 +1,94 @@
+#include <compare>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+static_assert(sys::fold_equals(u8"Straße"sv, u8"STRASSE"sv));
+static_assert(sys::fold_compare(u8"abc"sv, u8"ABD"sv) == std::strong_ordering::less);
+
+TEST_CASE("fold_equals(...)", "[sys.Text][fold]")
+{
+    CHECK(sys::fold_equals(u8"Content-Length"sv, u8"content-length"sv));
+    CHECK(sys::fold_equals(u8"ΌΣΟΣ"sv, u8"όσος"sv));
+    CHECK(sys::fold_equals(u8"ﬀ"sv, u8"FF"sv));
+    CHECK(sys::fold_equals(u8""sv, u8""sv));
+    CHECK_FALSE(sys::fold_equals(u8"abc"sv, u8"ab"sv));
+    CHECK_FALSE(sys::fold_equals(u8"ß"sv, u8"s"sv));
+
+    // Across encodings.
+    CHECK(sys::fold_equals(u8"Größe"sv, u"GRÖSSE"sv));
+    CHECK(sys::fold_equals(U"\U00010400"sv, u"\U00010428"sv));
+
+    // Language-specific folding, where dotless and dotted I are distinct letters.
+    CHECK_FALSE(sys::fold_equals(u8"I"sv, u8"i"sv, u8"tr"));
+    CHECK(sys::fold_equals(u8"I"sv, u8"ı"sv, u8"tr"));
+    CHECK(sys::fold_equals(u8"İ"sv, u8"i"sv, u8"tr"));
+    CHECK(sys::fold_equals(u8"İ"sv, u8"i̇"sv));
+
+    // A common prefix ending partway through a codepoint.
+    CHECK(sys::fold_equals(u8"xxÉ"sv, u8"xxé"sv));
+    CHECK(sys::fold_equals(u"x\U00010400"sv, u"x\U00010428"sv));
+}
+
+TEST_CASE("fold_compare(...), fold_hash(...)", "[sys.Text][fold]")
+{
+    CHECK(sys::fold_compare(u8"apple"sv, u8"APPLE"sv) == std::strong_ordering::equal);
+    CHECK(sys::fold_compare(u8"Apple"sv, u8"banana"sv) == std::strong_ordering::less);
+    CHECK(sys::fold_compare(u8"b"sv, u8"Apple"sv) == std::strong_ordering::greater);
+    CHECK(sys::fold_compare(u8"ab"sv, u8"ABC"sv) == std::strong_ordering::less);
+    CHECK(sys::fold_compare(u8"straße"sv, u8"STRASSEN"sv) == std::strong_ordering::less);
+
+    CHECK(sys::fold_hash(u8"Straße"sv) == sys::fold_hash(u8"STRASSE"sv));
+    CHECK(sys::fold_hash(u8"Straße"sv) == sys::fold_hash(U"strasse"sv));
+    CHECK(sys::fold_hash(u8"I"sv, u8"tr") == sys::fold_hash(u8"ı"sv, u8"tr"));
+}
+
+TEST_CASE("string::fold_equals(...), agrees with string::folded()", "[sys.Text][string][fold]")
+{
+    const std::vector<sys::str> samples { u8"Hello", u8"HELLO", u8"ǅemal", u8"ǆEMAL", u8"Σίσυφος", u8"ΣΊΣΥΦΟΣ", u8"ﬁle", u8"FILE", u8"\u212Aelvin", u8"KELVIN" };
+    for (const sys::str& a : samples)
+    {
+        for (const sys::str& b : samples)
+        {
+            CHECK(a.fold_equals(b) == (a.folded() == b.folded()));
+            CHECK(a.fold_compare(b) == (std::u32string_view(sys::str32(a.folded())) <=> std::u32string_view(sys::str32(b.folded()))));
+            if (a.fold_equals(b))
+                CHECK(a.fold_hash() == b.fold_hash());
+        }
+    }
+}
+
+TEST_CASE("fold_hasher, fold_equal", "[sys.Text][string][fold]")
+{
+    std::unordered_map<sys::str, int, sys::fold_hasher, sys::fold_equal> headers;
+    headers.emplace(u8"Content-Length", 1);
+    headers.emplace(u8"Content-Type", 2);
+    CHECK_FALSE(headers.emplace(u8"CONTENT-TYPE", 3).second);
+
+    CHECK(headers.find(u8"content-length"sv)->second == 1);
+    CHECK(headers.find(std::u8string(u8"content-type"))->second == 2);
+    CHECK(headers.find(u8"content"sv) == headers.end());
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
@@ -0,0 +1,129 @@
+#include <string_view>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+static_assert(sys::is_normalized(u8"Amélie"sv));
+static_assert(!sys::is_normalized(u8"Ame\u0301lie"sv));
+static_assert(sys::is_normalized(u8"Ame\u0301lie"sv, sys::normalization_form::nfd));
+
+TEST_CASE("string::normalized(...)", "[sys.Text][string][normalization]")
+{
+    using enum sys::normalization_form;
+
+    CHECK(sys::str(u8"é").normalized(nfd) == u8"e\u0301");
+    CHECK(sys::str(u8"e\u0301").normalized(nfc) == u8"é");
+    CHECK(sys::str(u8"Ame\u0301lie").normalized() == u8"Amélie");
+
+    // Canonical ordering of combining marks, before composing.
+    CHECK(sys::str(u8"ậ").normalized(nfd) == u8"a\u0323\u0302");
+    CHECK(sys::str(u8"a\u0302\u0323").normalized(nfc) == u8"ậ");
+
+    // Hangul syllables, decomposed and composed algorithmically.
+    CHECK(sys::str(u8"한").normalized(nfd) == u8"\u1112\u1161\u11AB");
+    CHECK(sys::str(u8"\u1112\u1161\u11AB").normalized(nfc) == u8"한");
+    CHECK(sys::str(u8"\u1100\u1161\u11A8").normalized(nfc) == u8"각");
+
+    // Singletons and composition exclusions don't recompose.
+    CHECK(sys::str(u8"\u212B").normalized(nfc) == u8"Å");
+    CHECK(sys::str(u8"\u2126").normalized(nfc) == u8"Ω");
+    CHECK(sys::str(u8"\u0958").normalized(nfc) == u8"क\u093C");
+
+    // A mark blocked by another of the same combining class.
+    CHECK(sys::str(u8"a\u0301\u0301").normalized(nfc) == u8"á\u0301");
+    // A leading non-starter has nothing to combine with.
+    CHECK(sys::str(u8"\u0301a").normalized(nfc) == u8"\u0301a");
+
+    // Compatibility forms.
+    CHECK(sys::str(u8"ﬁ").normalized(nfc) == u8"ﬁ");
+    CHECK(sys::str(u8"ﬁ").normalized(nfkc) == u8"fi");
+    CHECK(sys::str(u8"①").normalized(nfkd) == u8"1");
+    CHECK(sys::str(u8"ẛ\u0323").normalized(nfc) == u8"ẛ\u0323");
+    CHECK(sys::str(u8"ẛ\u0323").normalized(nfd) == u8"ſ\u0323\u0307");
+    CHECK(sys::str(u8"ẛ\u0323").normalized(nfkc) == u8"ṩ");
+    CHECK(sys::str(u8"ẛ\u0323").normalized(nfkd) == u8"s\u0323\u0307");
+
+    // From the same Unicode version as the combining classes, including its newest scripts.
+    CHECK(sys::str32(U"\U000105C9").normalized(nfd) == U"\U000105D2\u0307");
+    CHECK(sys::str32(U"\U00011382\U000113C9").normalized(nfc) == U"\U00011383");
+    CHECK(sys::str32(U"\U00016D6A").normalized(nfd) == U"\U00016D63\U00016D67\U00016D67");
+    CHECK(sys::str32(U"\U00016D63\U00016D67\U00016D67").normalized(nfc) == U"\U00016D6A");
+    CHECK(sys::str32(U"\U0001CCD6\U0001E030").normalized(nfkc) == U"A\u0430");
+    CHECK_FALSE(sys::is_normalized(U"\U000105C9"sv, nfd));
+
+    // Across encodings.
+    CHECK(sys::str16(u"Ame\u0301lie").normalized() == u"Amélie");
+    CHECK(sys::str32(U"\U0001D15E").normalized(nfc) == U"\U0001D157\U0001D165");
+
+    CHECK(sys::str(u8"").normalized() == u8"");
+    CHECK(sys::str(u8"plain ASCII").normalized(nfkd) == u8"plain ASCII");
+}
+
+TEST_CASE("string::normalize(...), string::is_normalized(...)", "[sys.Text][string][normalization]")
+{
+    using enum sys::normalization_form;
+
+    SECTION("Already normalized strings are left in place.")
+    {
+        sys::str s(u8"Amélie, 한국어");
+        const char8_t* const before = s.data();
+        s.normalize();
+        CHECK(s.data() == before);
+        CHECK(s == u8"Amélie, 한국어");
+    }
+    SECTION("Only what follows the last stable codepoint is renormalized.")
+    {
+        sys::str s(u8"Amélie and Ame\u0301lie");
+        s.normalize();
+        CHECK(s == u8"Amélie and Amélie");
+        CHECK(sys::str(u8"Amélie").normalize(nfd) == u8"Ame\u0301lie");
+    }
+    SECTION("Invalid code units are replaced.")
+    {
+        const sys::str s { u8'a', char8_t(0xC3), u8'b' };
+        CHECK_FALSE(s.is_normalized());
+        CHECK(s.normalized() == u8"a�b");
+    }
+
+    CHECK(sys::str(u8"plain ASCII").is_normalized());
+    CHECK_FALSE(sys::str(u8"e\u0301").is_normalized(nfc));
+    CHECK(sys::str(u8"e\u0301").is_normalized(nfd));
+    // May or may not be normalized by the quick check alone.
+    CHECK(sys::str(u8"é\u0301").is_normalized(nfc));
+    CHECK_FALSE(sys::str(u8"\u1100\u1161").is_normalized(nfc));
+    CHECK(sys::str(u8"\u0301a").is_normalized(nfc));
+    CHECK_FALSE(sys::str(u8"ﬁ").is_normalized(nfkc));
+    CHECK_FALSE(sys::str(u8"a\u0302\u0323").is_normalized(nfd));
+
+    const std::vector<sys::str> samples { u8"Ame\u0301lie", u8"ẛ\u0323", u8"한", u8"\u0958\u093C", u8"\u212B\u2126", u8"x\u0327\u0301\u0323" };
+    for (const sys::str& s : samples)
+    {
+        for (const sys::normalization_form form : { nfc, nfd, nfkc, nfkd })
+        {
+            const sys::str normalized = s.normalized(form);
+            CHECK(normalized.is_normalized(form));
+            CHECK(normalized.normalized(form) == normalized);
+            CHECK(sys::str(s).normalize(form) == normalized);
+        }
+    }
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+    // Long enough to span many chunks, with sequences of every length.
+    sys::str document()
+    {
+        sys::str ret;
+        for (sz i = 0_uz; i < 2000_uz; i++)
+            ret.append(std::u8string_view(u8"line aé東😀\n"));
+        return ret;
+    }
+
+    std::u32string decoded(const sys::rope<char8_t>& r) { return std::u32string(r.begin(), r.end()); }
+    std::u32string decoded(const sys::str& s)
+    {
+        const sys::codepoint_view<char8_t> view(s);
+        return std::u32string(view.begin(), view.end());
+    }
+} // namespace
+
+static_assert(std::bidirectional_iterator<sys::rope_iter<char8_t>>);
+
+TEST_CASE("rope<...>, conversion and counts", "[sys.Text][rope]")
+{
+    const sys::str s = document();
+    const sys::rope r(s);
+    CHECK(r.size() == s.size());
+    CHECK(r.codepoint_count() == 20000_uz);
+    CHECK(r.line_count() == 2001_uz);
+    CHECK(r.to_string() == s);
+    CHECK(r == std::u8string_view(s));
+    CHECK(decoded(r) == decoded(s));
+
+    std::u32string backward;
+    for (const char32_t c : r | std::views::reverse)
+        backward.push_back(c);
+    std::ranges::reverse(backward);
+    CHECK(backward == decoded(s));
+
+    // Invalid sequences are replaced as the text is inserted, a code unit at a time as in `sys::string<T>::invalids_replaced()`.
+    const sys::rope invalid(u8"a\xE6\x9D" "b"sv);
+    CHECK(invalid == u8"a��b"sv);
+    CHECK(invalid.codepoint_count() == 4_uz);
+
+    const sys::rope<char8_t> empty;
+    CHECK(empty.empty());
+    CHECK(empty.begin() == empty.end());
+    CHECK(empty.line_count() == 1_uz);
+    CHECK(empty.to_string().empty());
+}
+
+TEST_CASE("rope<...>, random access by codepoint and line", "[sys.Text][rope]")
+{
+    const sys::rope r(document());
+    CHECK(r.nth_codepoint(0_uz) == U'l');
+    CHECK(r.nth_codepoint(6_uz) == U'é');
+    CHECK(r.nth_codepoint(19997_uz) == U'東');
+    CHECK(r.nth_codepoint(19998_uz) == U'😀');
+    CHECK(r.unit_offset_of(7_uz) == 8_uz);
+    CHECK(r.unit_offset_of(17_uz) == 24_uz);
+    CHECK(r.unit_offset_of(r.codepoint_count()) == r.size());
+
+    CHECK(r.line_start(0_uz) == 0_uz);
+    CHECK(r.line_start(1_uz) == 10_uz);
+    CHECK(r.line_start(1500_uz) == 15000_uz);
+    CHECK(r.line_start(2000_uz) == 20000_uz);
+    CHECK(r.line_of(0_uz) == 0_uz);
+    CHECK(r.line_of(9_uz) == 0_uz);
+    CHECK(r.line_of(10_uz) == 1_uz);
+    CHECK(r.line_of(15005_uz) == 1500_uz);
+    CHECK(r.line_of(r.codepoint_count()) == 2000_uz);
+
+    sys::rope_iter<char8_t> it = r.iter_at(15009_uz);
+    CHECK(*it == U'\n');
+    CHECK(*++it == U'l');
+    CHECK(*--it == U'\n');
+    CHECK(*--it == U'😀');
+    CHECK(r.iter_at(r.codepoint_count()) == r.end());
+}
+
+TEST_CASE("rope<...>, editing", "[sys.Text][rope]")
+{
+    const sys::str s = document();
+    std::u32string expected = decoded(s);
+    sys::rope r(s);
+
+    // Small edits within a chunk, and large ones spanning many.
+    r.insert(3_uz, u8"ΩΩ"sv);
+    expected.insert(3uz, U"ΩΩ");
+    r.erase(12000_uz, 5000_uz);
+    expected.erase(12000uz, 5000uz);
+    r.insert(7000_uz, sys::rope(s));
+    expected.insert(7000uz, decoded(s));
+    r.erase(20_uz, 1_uz);
+    expected.erase(20uz, 1uz);
+    r.append(u8"end"sv);
+    expected.append(U"end");
+    CHECK(decoded(r) == expected);
+    CHECK(r.codepoint_count() == expected.size());
+    CHECK(r.line_count() == sz(_as(std::ranges::count(expected, U'\n'), size_t)) + 1_uz);
+
+    // Erasing past the end erases what there is.
+    r.erase(r.codepoint_count() - 2_uz, 100_uz);
+    expected.resize(expected.size() - 2uz);
+    CHECK(decoded(r) == expected);
+    sys::rope tail(s);
+    tail.erase(5_uz, sz::highest());
+    CHECK(tail == u8"line "sv);
+
+    CHECK(decoded(r.substr(100_uz, 30000_uz)) == expected.substr(100uz, 30000uz));
+    CHECK(decoded(r.substr(r.codepoint_count() - 3_uz, 100_uz)) == expected.substr(expected.size() - 3uz));
+    CHECK(r.substr(r.codepoint_count(), 10_uz).empty());
+
+    r.erase(0_uz, r.codepoint_count());
+    CHECK(r.empty());
+}
+
+TEST_CASE("rope<...>, snapshots", "[sys.Text][rope]")
+{
+    const sys::str s = document();
+    sys::rope r(s);
+    const sys::rope<char8_t> snapshot = r;
+    const sys::rope_iter<char8_t> it = snapshot.iter_at(5_uz);
+
+    r.erase(0_uz, 100_uz).insert(50_uz, u8"edited"sv);
+    CHECK(snapshot == std::u8string_view(s));
+    CHECK(*it == U'a');
+    CHECK(r != snapshot);
+    CHECK(r.substr(50_uz, 6_uz) == u8"edited"sv);
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
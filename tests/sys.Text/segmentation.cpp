@@ -0,0 +1,92 @@
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+    template <typename View>
+    auto collect(const View& view)
+    {
+        std::vector<std::ranges::range_value_t<View>> ret;
+        for (const auto piece : view)
+            ret.push_back(piece);
+        return ret;
+    }
+} // namespace
+
+static_assert(std::ranges::forward_range<sys::grapheme_view<char8_t>>);
+static_assert(std::ranges::view<sys::word_view<char16_t>>);
+static_assert(std::ranges::distance(sys::grapheme_view(u8"é🇦🇺🇳🇿x"sv)) == 4);
+static_assert(std::ranges::distance(sys::word_view(u8"Don't panic."sv)) == 4);
+
+TEST_CASE("grapheme_view(...)", "[sys.Text][segmentation]")
+{
+    CHECK(collect(sys::grapheme_view(u8"abc"sv)) == std::vector { u8"a"sv, u8"b"sv, u8"c"sv });
+    CHECK(collect(sys::grapheme_view(u8"e\u0301x"sv)) == std::vector { u8"e\u0301"sv, u8"x"sv });
+    CHECK(collect(sys::grapheme_view(u8"\r\n\r\r"sv)) == std::vector { u8"\r\n"sv, u8"\r"sv, u8"\r"sv });
+    CHECK(collect(sys::grapheme_view(u8""sv)).empty());
+
+    // Regional indicators pair up into flags.
+    CHECK(collect(sys::grapheme_view(u8"🇦🇺🇳🇿🇦"sv)) == std::vector { u8"🇦🇺"sv, u8"🇳🇿"sv, u8"🇦"sv });
+    // Emoji ZWJ sequences and modifiers.
+    CHECK(collect(sys::grapheme_view(u8"👩\u200D👩\u200D👧👍🏽"sv)) == std::vector { u8"👩\u200D👩\u200D👧"sv, u8"👍🏽"sv });
+    CHECK(collect(sys::grapheme_view(u8"a\u200D👩"sv)) == std::vector { u8"a\u200D"sv, u8"👩"sv });
+    // Hangul jamo, and Indic conjuncts joined by a virama.
+    CHECK(collect(sys::grapheme_view(u8"\u1100\u1161\u11A8각"sv)) == std::vector { u8"\u1100\u1161\u11A8"sv, u8"각"sv });
+    CHECK(collect(sys::grapheme_view(u8"क\u094Dषक\u094Da"sv)) == std::vector { u8"क\u094Dष"sv, u8"क\u094D"sv, u8"a"sv });
+
+    // Across encodings.
+    CHECK(collect(sys::grapheme_view(u"e\u0301🇦🇺"sv)) == std::vector { u"e\u0301"sv, u"🇦🇺"sv });
+    CHECK(collect(sys::grapheme_view(U"e\u0301🇦🇺"sv)) == std::vector { U"e\u0301"sv, U"🇦🇺"sv });
+
+    // Invalid code units are clusters of their own.
+    const std::u8string invalid { u8'a', char8_t(0xC3), u8'b' };
+    CHECK(collect(sys::grapheme_view(std::u8string_view(invalid))).size() == 3uz);
+}
+
+TEST_CASE("word_view(...)", "[sys.Text][segmentation]")
+{
+    CHECK(collect(sys::word_view(u8"Don't panic."sv)) == std::vector { u8"Don't"sv, u8" "sv, u8"panic"sv, u8"."sv });
+    CHECK(collect(sys::word_view(u8"3.14 and 1,000"sv)) == std::vector { u8"3.14"sv, u8" "sv, u8"and"sv, u8" "sv, u8"1,000"sv });
+    CHECK(collect(sys::word_view(u8"e.g. foo_bar42"sv)) == std::vector { u8"e.g"sv, u8"."sv, u8" "sv, u8"foo_bar42"sv });
+    CHECK(collect(sys::word_view(u8"a  \tb\r\nc"sv)) == std::vector { u8"a"sv, u8"  "sv, u8"\t"sv, u8"b"sv, u8"\r\n"sv, u8"c"sv });
+    CHECK(collect(sys::word_view(u8""sv)).empty());
+
+    // Combining marks, katakana, ideographs and emoji.
+    CHECK(collect(sys::word_view(u8"nai\u0308ve"sv)) == std::vector { u8"nai\u0308ve"sv });
+    CHECK(collect(sys::word_view(u8"カタカナ漢字"sv)) == std::vector { u8"カタカナ"sv, u8"漢"sv, u8"字"sv });
+    CHECK(collect(sys::word_view(u8"hello👋🏽world"sv)) == std::vector { u8"hello"sv, u8"👋🏽"sv, u8"world"sv });
+
+    // Across encodings.
+    CHECK(collect(sys::word_view(u"Don't panic."sv)) == std::vector { u"Don't"sv, u" "sv, u"panic"sv, u"."sv });
+    CHECK(collect(sys::word_view(U"Amélie's"sv)) == std::vector { U"Amélie's"sv });
+}
+
+TEST_CASE("string::grapheme_view(), string::word_view()", "[sys.Text][string][segmentation]")
+{
+    const sys::str s(u8"Ame\u0301lie 🇦🇺");
+    CHECK(std::ranges::distance(s.grapheme_view()) == 8);
+    CHECK(collect(s.word_view()) == std::vector { u8"Ame\u0301lie"sv, u8" "sv, u8"🇦🇺"sv });
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
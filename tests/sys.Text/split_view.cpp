@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+    template <typename View>
+    auto collect(const View& view)
+    {
+        std::vector<std::ranges::range_value_t<View>> ret;
+        for (const auto piece : view)
+            ret.push_back(piece);
+        return ret;
+    }
+} // namespace
+
+static_assert(std::ranges::forward_range<decltype(sys::split_view(u8"a,b"sv, u8','))>);
+static_assert(std::ranges::view<decltype(sys::split_view(u8"a,b"sv, u8"--"sv))>);
+static_assert(std::ranges::distance(sys::split_view(u8"a,b,,c"sv, u8',')) == 4);
+
+TEST_CASE("split_view(...), code unit delimiter", "[sys.Text][split_view]")
+{
+    CHECK(collect(sys::split_view(u8"a,b,,c"sv, u8',')) == std::vector { u8"a"sv, u8"b"sv, u8""sv, u8"c"sv });
+    CHECK(collect(sys::split_view(u8",a,"sv, u8',')) == std::vector { u8""sv, u8"a"sv, u8""sv });
+    CHECK(collect(sys::split_view(u8"abc"sv, u8',')) == std::vector { u8"abc"sv });
+    CHECK(collect(sys::split_view(u8""sv, u8',')) == std::vector { u8""sv });
+
+    // Long enough to cross every vector kernel's block size, in every code unit width.
+    std::u16string wide(1000uz, u'x');
+    wide[700uz] = u'|';
+    wide[999uz] = u'|';
+    const auto pieces = collect(sys::split_view(std::u16string_view(wide), u'|'));
+    REQUIRE(pieces.size() == 3uz);
+    CHECK(pieces[0].size() == 700uz);
+    CHECK(pieces[1].size() == 298uz);
+    CHECK(pieces[2].empty());
+
+    std::u32string wider(77uz, U'y');
+    wider[40uz] = U'|';
+    CHECK(collect(sys::split_view(std::u32string_view(wider), U'|')).size() == 2uz);
+}
+
+TEST_CASE("split_view(...), substring delimiter", "[sys.Text][split_view]")
+{
+    CHECK(collect(sys::split_view(u8"one--two--three"sv, u8"--"sv)) == std::vector { u8"one"sv, u8"two"sv, u8"three"sv });
+    CHECK(collect(sys::split_view(u8"a---b"sv, u8"--"sv)) == std::vector { u8"a"sv, u8"-b"sv });
+    CHECK(collect(sys::split_view(u8"ab"sv, u8"abc"sv)) == std::vector { u8"ab"sv });
+    CHECK(collect(sys::split_view(u8"abc"sv, u8""sv)) == std::vector { u8"a"sv, u8"b"sv, u8"c"sv });
+    CHECK(collect(sys::split_view(u8"--"sv, u8"--"sv)) == std::vector { u8""sv, u8""sv });
+}
+
+TEST_CASE("split_view(...), codepoint delimiters", "[sys.Text][split_view][codepoint_set]")
+{
+    CHECK(collect(sys::split_view(u8"a b　c;d"sv, sys::codepoint_set(U" ;　"sv))) == std::vector { u8"a"sv, u8"b"sv, u8"c"sv, u8"d"sv });
+    CHECK(collect(sys::split_view(u"x y z"sv, [](const char32_t c) -> bool { return sys::ch::is_whitespace(c); })) == std::vector { u"x"sv, u"y"sv, u"z"sv });
+
+    constexpr sys::codepoint_set set(U"aé"sv);
+    CHECK(set.contains(U'a'));
+    CHECK(set.contains(U'é'));
+    CHECK_FALSE(set.contains(U'b'));
+}
+
+TEST_CASE("string::split_view(...)", "[sys.Text][string][split_view]")
+{
+    const sys::str s = u8"key=value; other=thing";
+
+    std::vector<std::u8string_view> pieces;
+    for (const std::u8string_view field : s.split_view(u8"; "sv))
+        pieces.push_back(field);
+    CHECK(pieces == std::vector { u8"key=value"sv, u8"other=thing"sv });
+
+    CHECK(collect(s.split_view(u8'=')).size() == 3uz);
+    CHECK(collect(s.split_view(sys::codepoint_set(U"=; "sv))).size() == 5uz);
+    CHECK(std::ranges::equal(s.split_view(u8';'), s.split(u8';'), [](const std::u8string_view a, const sys::str& b) -> bool { return a == b; }));
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, misc-include-cleaner)
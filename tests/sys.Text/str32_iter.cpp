@@ -1,3 +1,9 @@
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+
 // NOLINTBEGIN(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, misc-include-cleaner)
 // NOLINTBEGIN(readability-function-cognitive-complexity)
 #include <CompilerWarnings.h>
@@ -98,5 +104,49 @@ TEST_CASE("Dereference Stability", "[sys.Text][codepoint_iter]")
     CHECK(*it == U'A');
 }
 
+TEST_CASE("Backward Iteration", "[sys.Text][codepoint_iter]")
+{
+    static_assert(std::bidirectional_iterator<sys::codepoint_iter<char8_t>>);
+    static_assert(std::ranges::bidirectional_range<sys::reverse_codepoint_view<char16_t>>);
+
+    sys::str s = u8"A\u00A2\u20AC\U00010348";
+    const sys::codepoint_iter<char8_t> beg(s.data(), s.data() + s.size());                       // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    sys::codepoint_iter<char8_t> it(s.data(), s.data() + s.size(), s.data() + s.size()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    --it;
+    CHECK(*it == U'\U00010348');
+    auto next = it--;
+    CHECK(*next == U'\U00010348');
+    CHECK(*it == U'\u20AC');
+    --it;
+    CHECK(*it == U'\u00A2');
+    --it;
+    CHECK(*it == U'A');
+    CHECK(it == beg);
+    ++it;
+    CHECK(*it == U'\u00A2');
+
+    std::u32string reversed;
+    for (const char32_t c : sys::reverse_codepoint_view(std::u16string_view(u"A\u00A2\u20AC\U00010348")))
+        reversed.push_back(c);
+    CHECK(reversed == U"\U00010348\u20AC\u00A2A");
+}
+
+TEST_CASE("Pathological Backward Iteration", "[sys.Text][codepoint_iter]")
+{
+    // The same codepoints as forward: a stray continuation byte after a complete sequence, a truncated sequence, and a valid sequence led by the last of them.
+    const char8_t data[] { 0xC3, 0xA9, 0x80, 0xE2, 0x82, 0x41, 0xE2, 0x82, 0xAC }; // NOLINT(readability-magic-numbers)
+    std::u32string reversed;
+    for (const char32_t c : sys::reverse_codepoint_view(std::span<const char8_t>(data)))
+        reversed.push_back(c);
+    CHECK(reversed == U"\u20ACA\uFFFD\uFFFD\uFFFD\u00E9");
+
+    // Unpaired surrogates.
+    const char16_t data16[] { 0xDC00, 0xD800, 0xDC00, 0xD800 }; // NOLINT(readability-magic-numbers)
+    std::u32string reversed16;
+    for (const char32_t c : sys::reverse_codepoint_view(std::span<const char16_t>(data16)))
+        reversed16.push_back(c);
+    CHECK(reversed16 == U"\uFFFD\U00010000\uFFFD");
+}
+
 // NOLINTEND(readability-function-cognitive-complexity)
 // NOLINTEND(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, misc-include-cleaner)
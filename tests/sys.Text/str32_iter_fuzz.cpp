@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
 // NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
 #include <CompilerWarnings.h>
 _nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
@@ -38,4 +44,46 @@ TEST_CASE("Iterating over random bytes never crashes and exhausts buffer.", "[fu
     }));
 }
 
+TEST_CASE("Iterating backward visits the same codepoints as iterating forward.", "[fuzz][sys.Text][codepoint_iter]")
+{
+    CHECK(rc::check([](const std::vector<u8::underlying_type>& bytes) -> void
+    {
+        const std::span<const char8_t> s(_asr(bytes.data(), const char8_t*), bytes.size());
+
+        std::vector<std::pair<const char8_t*, char32_t>> forward, backward;
+        const sys::codepoint_view<char8_t> view(s);
+        for (auto it = view.begin(); it != view.end(); ++it)
+            forward.emplace_back(std::to_address(it), *it);
+        for (auto it = view.end(); it != view.begin();)
+        {
+            --it;
+            backward.emplace_back(std::to_address(it), *it);
+        }
+        std::ranges::reverse(backward);
+        RC_ASSERT(forward == backward);
+    }));
+}
+
+TEST_CASE("codepoint_index agrees with iterating from the start, however the text is appended.", "[fuzz][sys.Text][codepoint_index]")
+{
+    CHECK(rc::check([](const std::vector<u8::underlying_type>& bytes, const uint8_t stride, const uint8_t split) -> void
+    {
+        const std::span<const char8_t> s(_asr(bytes.data(), const char8_t*), bytes.size());
+
+        std::vector<const char8_t*> starts;
+        const sys::codepoint_view<char8_t> view(s);
+        for (auto it = view.begin(); it != view.end(); ++it)
+            starts.push_back(std::to_address(it));
+
+        sys::codepoint_index index(s.first(std::min(_as(split, size_t), s.size())), sz(stride % 64u) + 1_uz);
+        index.extend(s);
+        RC_ASSERT(index.codepoint_count() == starts.size());
+        for (sz i = 0_uz; i < starts.size(); i++)
+        {
+            RC_ASSERT(s.data() + index.unit_offset_of(i) == starts[i]);
+            RC_ASSERT(index.codepoint_offset_of(sz(starts[i] - s.data())) == i);
+        }
+    }));
+}
+
 // NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
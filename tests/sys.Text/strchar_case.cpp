@@ -156,4 +156,36 @@ TEST_CASE("Folding is Context Independent", "[sys.Text][string][fold]")
     CHECK(sys::str(u8"ΑΣ").fold() == u8"ασ");
 }
 
+TEST_CASE("`sys::ch` Casing Beyond the BMP", "[sys.Text][ch][to_lower][to_upper][fold]")
+{
+    static_assert(sys::ch::to_upper(U'a') == U'A');
+
+    CHECK(sys::ch::to_lower(U'\U00010400') == U'\U00010428'); // DESERET CAPITAL LETTER LONG I -> SMALL
+    CHECK(sys::ch::to_upper(U'\U00010428') == U'\U00010400');
+    CHECK(sys::ch::fold(U'\U0001E900') == U'\U0001E922'); // ADLAM CAPITAL LETTER ALIF -> SMALL
+    CHECK(sys::ch::to_upper(U'\U0001E943') == U'\U0001E921'); // Last cased codepoint of Adlam.
+
+    // Past the last codepoint with casing properties.
+    CHECK(sys::ch::to_lower(U'\U000E01EF') == U'\U000E01EF');
+    CHECK(sys::ch::to_upper(U'\U0010FFFF') == U'\U0010FFFF');
+    CHECK(sys::ch::fold(U'\U0010FFFF') == U'\U0010FFFF');
+}
+
+TEST_CASE("Casing Across Bulk Boundaries", "[sys.Text][string][to_lower][to_upper]")
+{
+    // Runs of ASCII are cased in blocks, the context for the codepoints after them must still be tracked.
+    for (sz n = 0_uz; n < 80_uz; n++)
+    {
+        const std::u8string upper(n, u8'A'), lower(n, u8'a'), ignorable(n, u8'.');
+
+        CHECK(sys::str(upper + u8"ΑΣ").lowered() == sys::str(lower + u8"ας"));
+        CHECK(sys::str(u8"Α" + ignorable + u8"Σ").lowered() == sys::str(u8"α" + ignorable + u8"ς"));
+        CHECK(sys::str(u8"ΑΣ" + ignorable + u8"Α").lowered() == sys::str(u8"ασ" + ignorable + u8"α"));
+        CHECK(sys::str(u8"ΑΣ" + ignorable).lowered() == sys::str(u8"ας" + ignorable));
+        CHECK(sys::str16(sys::str(upper + u8"ẞ" + upper)).lowered() == sys::str16(sys::str(lower + u8"ß" + lower)));
+        CHECK(sys::str32(sys::str(lower + u8"ß" + lower)).uppered() == sys::str32(sys::str(upper + u8"SS" + upper)));
+        CHECK(sys::str(upper + u8"I").lowered(u8"tr") == sys::str(lower + u8"ı"));
+    }
+}
+
 // NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -1,3 +1,5 @@
+#include <string_view>
+
 // NOLINTBEGIN(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-pointer-arithmetic, hicpp-no-array-decay, misc-include-cleaner)
 // NOLINTBEGIN(readability-function-cognitive-complexity, readability-magic-numbers)
 #include <CompilerWarnings.h>
@@ -55,6 +57,7 @@ TEST_CASE("Non-Whitespace Boundaries", "[sys.Text][ch][is_whitespace]")
     CHECK_FALSE(sys::ch::is_whitespace(_as(0x167F, char32_t))); // Just before Ogham.
     CHECK_FALSE(sys::ch::is_whitespace(_as(0x1681, char32_t))); // Just after Ogham.
     CHECK_FALSE(sys::ch::is_whitespace(_as(0x200B, char32_t))); // ZERO WIDTH SPACE
+    CHECK_FALSE(sys::ch::is_whitespace(_as(0x10FFFF, char32_t))); // Past the last whitespace codepoint.
 }
 
 TEST_CASE("Basic ASCII String Trimming", "[sys.Text][string][trim]")
@@ -75,5 +78,28 @@ TEST_CASE("Pathological Trimming Cases", "[sys.Text][string][trim]")
     CHECK(sys::str(u8"").trim().empty());
 }
 
+TEST_CASE("Trimming Long Runs", "[sys.Text][string][trim]")
+{
+    // Runs of ASCII whitespace longer than a vector, broken up by whitespace outside ASCII, in every encoding.
+    sys::str padding(u8' ', 100_uz);
+    padding.append(std::u8string_view(u8"\u3000\t\n"));
+    padding.append(u8'\r', 40_uz);
+    sys::str s = padding;
+    s.append(std::u8string_view(u8"a \u00E9 b"));
+    s.append(padding);
+
+    CHECK(s.trimmed() == u8"a \u00E9 b");
+    CHECK(sys::str16(s).trimmed() == u"a \u00E9 b");
+    CHECK(sys::str32(s).trimmed() == U"a \u00E9 b");
+    CHECK(sys::str(s).trim_end().size() == s.size() - padding.size());
+    CHECK(sys::str(s).trim_start().size() == s.size() - padding.size());
+    CHECK(padding.trimmed().empty());
+
+    // Trailing whitespace after an invalid sequence, and a continuation byte which isn't part of one.
+    sys::str invalid(u8'x', 40_uz);
+    invalid.append(std::u8string_view(u8"\xE2\x82 \x80  "));
+    CHECK(sys::str(invalid).trim_end().size() == invalid.size() - 2_uz);
+}
+
 // NOLINTEND(readability-function-cognitive-complexity, readability-magic-numbers)
 // NOLINTEND(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-pointer-arithmetic, hicpp-no-array-decay, misc-include-cleaner)
@@ -1,4 +1,6 @@
 
+#include <span>
+#include <string>
 #include <string_view>
 #include <utility>
 
@@ -115,6 +117,117 @@ TEST_CASE("Transcoding UTF-8 -> UTF-(16|32)", "[sys.Text][string][conv]")
     CHECK(sys::wstr(s) == L"A\u00A2\u20AC\U00010348");
 }
 
+TEST_CASE("Transcoding Across Bulk Boundaries", "[sys.Text][string][conv]")
+{
+    sys::str ascii;
+    for (sz i = 0_uz; i < 200_uz; i++)
+        ascii.append(_as(u8'a' + *(i % 26_uz), char8_t));
+    const sys::str32 ascii32(ascii);
+    REQUIRE(ascii32.size() == ascii.size());
+    CHECK(sys::str(ascii32) == ascii);
+    CHECK(sys::str(sys::str16(ascii)) == ascii);
+
+    for (const sz at : { 0_uz, 15_uz, 16_uz, 31_uz, 32_uz, 33_uz, 199_uz })
+    {
+        sys::str mixed = ascii;
+        mixed[at, unsafe] = u8'\xFF';
+        const sys::str16 mixed16(mixed);
+        CHECK(mixed16.size() == mixed.size());
+        CHECK(mixed16[at, unsafe] == u'\uFFFD');
+        CHECK(sys::str(mixed16) == sys::str(mixed).replace_invalid());
+    }
+
+    sys::str32 wide(U'\U00010348', 100_uz);
+    wide.append(ascii32);
+    CHECK(sys::str32(sys::str(wide)) == wide);
+    CHECK(sys::str32(sys::str16(wide)) == wide);
+}
+
+TEST_CASE("Transcoded Length", "[sys.Text][string][conv]")
+{
+    sys::str s;
+    for (sz i = 0_uz; i < 40_uz; i++)
+        s.append(u8"ascii text, Größe 東京都 \U00010348 ");
+    s.append(u8"\xFF\xE2\x82 \xF0\x90");
+
+    CHECK(s.transcoded_length<char8_t>() == s.invalids_replaced().size());
+    CHECK(s.transcoded_length<char16_t>() == sys::str16(s).size());
+    CHECK(s.transcoded_length<char32_t>() == sys::str32(s).size());
+
+    sys::str16 s16(s);
+    s16.append(u'\xD800');
+    CHECK(s16.transcoded_length<char8_t>() == sys::str(s16).size());
+    CHECK(s16.transcoded_length<char32_t>() == sys::str32(s16).size());
+
+    const sys::str32 s32(s);
+    CHECK(s32.transcoded_length<char8_t>() == sys::str(s32).size());
+    CHECK(s32.transcoded_length<char16_t>() == sys::str16(s32).size());
+
+    CHECK(sys::str().transcoded_length<char16_t>() == 0_uz);
+}
+
+TEST_CASE("Transcoding Into Caller Buffers", "[sys.Text][string][conv]")
+{
+    const sys::str s = u8"A\u00A2\u20AC\U00010348";
+
+    char16_t exact[5] {};
+    REQUIRE(s.transcoded_length<char16_t>() == 5_uz);
+    CHECK(s.transcode_into(std::span<char16_t>(exact)) == 5_uz);
+    CHECK(std::u16string_view(exact, 5uz) == u"A\u00A2\u20AC\U00010348");
+
+    // Only whole codepoints are stored.
+    char16_t small[4] {};
+    CHECK(s.transcode_into(std::span<char16_t>(small)) == 3_uz);
+    CHECK(std::u16string_view(small, 3uz) == u"A\u00A2\u20AC");
+
+    char8_t narrow[3] {};
+    CHECK(sys::str32(s).transcode_into(std::span<char8_t>(narrow)) == 3_uz);
+    CHECK(std::u8string_view(narrow, 3uz) == u8"A\u00A2");
+}
+
+TEST_CASE("Validation", "[sys.Text][string][validation]")
+{
+    CHECK(sys::str(u8"Größe 東京都 🇦🇺").is_valid());
+    CHECK(sys::str16(u"Größe 東京都 🇦🇺").is_valid());
+    CHECK(sys::str32(U"Größe 東京都 🇦🇺").is_valid());
+    CHECK(sys::str().is_valid());
+
+    // Overlong, surrogate, out of range and truncated sequences, and sequences led by a continuation byte, after enough ASCII to take the vectorized paths.
+    const sys::str ascii(u8'a', 100_uz);
+    for (const std::u8string_view bad : { std::u8string_view(u8"\xC0\x80"), std::u8string_view(u8"\xED\xA0\x80"), std::u8string_view(u8"\xF4\x90\x80\x80"),
+                                          std::u8string_view(u8"\xE6\x9D"), std::u8string_view(u8"\x80"), std::u8string_view(u8"\x8E\xA0\x80"),
+                                          std::u8string_view(u8"\x84\x80\x80\x80"), std::u8string_view(u8"\xC1\x80\x80\x80") })
+    {
+        for (const sz at : { 0_uz, 15_uz, 31_uz, 32_uz, 63_uz, 99_uz })
+        {
+            sys::str s(u8'a', at);
+            s.append(bad);
+            s.append(u8'a', 100_uz - at);
+            CHECK_FALSE(s.is_valid());
+            CHECK(s.first_invalid_offset() == at);
+        }
+    }
+    sys::str16 lone16(u'a', 100_uz);
+    lone16.append(u'\xDC00');
+    CHECK(lone16.first_invalid_offset() == 100_uz);
+    sys::str32 beyond32(U'a', 100_uz);
+    beyond32[40_uz, unsafe] = char32_t(0x110000);
+    CHECK(beyond32.first_invalid_offset() == 40_uz);
+
+    // An actual U+FFFD is valid, and valid strings are left in place.
+    sys::str replaced(u8"a\uFFFDb");
+    const char8_t* const data = replaced.data();
+    CHECK(replaced.is_valid());
+    CHECK(replaced.replace_invalid().data() == data);
+
+    sys::str invalid = ascii;
+    invalid.append(std::u8string_view(u8"\xE6\x9D!\xFF"));
+    sys::str expected = ascii;
+    expected.append(std::u8string_view(u8"\uFFFD\uFFFD!\uFFFD"));
+    CHECK(invalid.invalids_replaced() == expected);
+    CHECK(invalid.replace_invalid() == expected);
+}
+
 TEST_CASE("Predicates", "[sys.Text][string][predicate]")
 {
     const sys::str s = u8"Hello World";
@@ -170,6 +283,45 @@ TEST_CASE("String Format Specifiers", "[sys.Text][string][format]")
 
     CHECK(std::format("{:.3}", sys::str(u8"pumpkin")) == "pum");
 }
+TEST_CASE("String Format Specifiers Count Codepoints", "[sys.Text][string][format]")
+{
+    CHECK(std::format("{:*^7.2}", sys::str32(U"Größe")) == "**Gr***");
+    CHECK(std::format("{:>6}", sys::str(u8"東京")) == "    東京");
+    CHECK(std::format("{:.4s}", sys::str16(u"Größe")) == "Größ");
+    CHECK(std::format(L"{:<5}", sys::str(u8"naïve")) == L"naïve");
+    CHECK(std::format("{:3}", sys::str(u8"pumpkin")) == "pumpkin");
+
+    // The fill can be any codepoint, whatever the output's encoding.
+    CHECK(std::format("{:→>6}", sys::str(u8"東京")) == "→→→→東京");
+    CHECK(std::format(L"{:é^5}", sys::str16(u"ab")) == L"éabéé");
+}
+TEST_CASE("String Format Dynamic Width and Precision", "[sys.Text][string][format]")
+{
+    CHECK(std::format("{:{}}|", sys::str(u8"hi"), 4) == "hi  |");
+    CHECK(std::format("{:>{}.{}}", sys::str(u8"Ωμέγα"), 4, 2) == "  Ωμ");
+    CHECK(std::format("{0:>{2}.{1}}", sys::str16(u"Ωμέγα"), 3, 5) == "  Ωμέ");
+
+    const sys::str s(u8"hi");
+    const int negative = -1;
+    const double fractional = 1.5;
+    CHECK_THROWS_AS(std::vformat("{:{}}", std::make_format_args(s, negative)), std::format_error);
+    CHECK_THROWS_AS(std::vformat("{:{}}", std::make_format_args(s, fractional)), std::format_error);
+}
+TEST_CASE("Mixed String Format", "[sys.Text][string][format]")
+{
+    const sys::str s(u8"Größe");
+    const sys::str16 s16(u"Ωμέγα");
+    const sys::str32 s32(U"東京 😀");
+    CHECK(std::format("{} {} {} {}", s, s16, s32, sys::cstr("x")) == "Größe Ωμέγα 東京 😀 x");
+    CHECK(std::format(L"{} {} {}", s, s16, s32) == L"Größe Ωμέγα 東京 😀");
+
+    // Longer than anything transcoded through at once.
+    std::string expected;
+    for (size_t i = 0uz; i < 1000uz; i++)
+        expected.append("ß");
+    CHECK(std::format("{}", sys::str32(U'ß', 1000_uz)) == expected);
+    CHECK(std::format("{:.999}", sys::str32(U'ß', 1000_uz)) == expected.substr(0uz, 1998uz));
+}
 
 // NOLINTEND(readability-function-cognitive-complexity)
 // NOLINTEND(bugprone-throwing-static-initialization, cppcoreguidelines-pro-bounds-avoid-unchecked-container-access, misc-include-cleaner)
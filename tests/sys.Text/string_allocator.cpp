@@ -0,0 +1,134 @@
+#include <concepts>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+    class counting_resource final : public std::pmr::memory_resource
+    {
+        void* do_allocate(const size_t bytes, const size_t alignment) override
+        {
+            this->allocations++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t alignment) override { std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment); }
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    public:
+        size_t allocations = 0uz;
+    };
+} // namespace
+
+static_assert(std::same_as<sys::str, sys::string<char8_t, std::allocator<char8_t>>>);
+static_assert(std::same_as<decltype(sys::string(std::pmr::u8string(u8"x"))), sys::pmr::str>);
+
+TEST_CASE("Allocator Propagation", "[sys.Text][string][allocator]")
+{
+    counting_resource resource;
+    const auto allocatesFrom = [&](const auto& str) -> bool { return str.get_allocator().resource() == &resource; };
+
+    const sys::pmr::str s(u8"  Größe, Ωμέγα, naïve  "sv, &resource);
+    CHECK(allocatesFrom(s));
+
+    SECTION("Copies produced by the string allocate with its allocator.")
+    {
+        CHECK(allocatesFrom(s.trimmed()));
+        CHECK(allocatesFrom(s.start_trimmed()));
+        CHECK(allocatesFrom(s.end_trimmed()));
+        CHECK(allocatesFrom(s.substr(2_uz, 5_uz)));
+        CHECK(allocatesFrom(s.substr(100_uz, 5_uz)));
+        CHECK(allocatesFrom(s.uppered()));
+        CHECK(allocatesFrom(s.lowered()));
+        CHECK(allocatesFrom(s.folded()));
+        CHECK(allocatesFrom(s.invalids_replaced()));
+        CHECK(allocatesFrom(s.normalized()));
+        CHECK(allocatesFrom(sys::pmr::str(u8"é"sv, &resource).normalized()));
+        CHECK(s.trimmed() == u8"Größe, Ωμέγα, naïve"sv);
+
+        const std::vector<sys::pmr::str> pieces = s.split(u8',');
+        REQUIRE(pieces.size() == 3uz);
+        for (const sys::pmr::str& piece : pieces)
+            CHECK(allocatesFrom(piece));
+        for (const sys::pmr::str& piece : s.split(u8", "sv))
+            CHECK(allocatesFrom(piece));
+
+        const sys::pmr::str joined = sys::pmr::str::join(pieces, u8';', &resource);
+        CHECK(allocatesFrom(joined));
+        CHECK(joined == u8"  Größe; Ωμέγα; naïve  "sv);
+    }
+    SECTION("Transforming in place, moving and transcoding keep to the allocator.")
+    {
+        sys::pmr::str t = s.uppered();
+        t.to_lower().normalize().trim();
+        CHECK(allocatesFrom(t));
+        CHECK(t == u8"grösse, ωμέγα, naïve"sv);
+
+        const sys::pmr::str moved(std::move(t));
+        CHECK(allocatesFrom(moved));
+
+        const sys::pmr::str32 transcoded(s, &resource);
+        CHECK(allocatesFrom(transcoded));
+        CHECK(transcoded == U"  Größe, Ωμέγα, naïve  "sv);
+        CHECK(sys::str32(s) == transcoded);
+    }
+    SECTION("Casing, folding and transcoding allocate once.")
+    {
+        const auto allocationsOf = [&](const auto& produce) -> size_t
+        {
+            const size_t before = resource.allocations;
+            (void)produce();
+            return resource.allocations - before;
+        };
+        CHECK(allocationsOf([&]() -> sys::pmr::str { return s.uppered(); }) == 1uz);
+        CHECK(allocationsOf([&]() -> sys::pmr::str { return s.lowered(); }) == 1uz);
+        CHECK(allocationsOf([&]() -> sys::pmr::str { return s.folded(); }) == 1uz);
+        CHECK(allocationsOf([&]() -> sys::pmr::str16 { return sys::pmr::str16(s, &resource); }) == 1uz);
+        CHECK(allocationsOf([&]() -> sys::pmr::str32 { return sys::pmr::str32(s, &resource); }) == 1uz);
+    }
+}
+
+TEST_CASE("Inline Buffer Resource", "[sys.Text][string][allocator]")
+{
+    counting_resource upstream;
+    sys::inline_buffer_resource<1024uz> arena(&upstream);
+
+    // The pieces of a line being parsed fit in the inline buffer, so never reach the heap.
+    const sys::pmr::str line(u8" first key = some long value , second key = another long value "sv, &arena);
+    for (const sys::pmr::str& field : line.split(u8','))
+    {
+        const sys::pmr::str key = field.substr(0_uz, field.find_index(u8'=')).trimmed();
+        CHECK(key.get_allocator().resource() == &arena);
+        CHECK(key.ends_with(u8"key"sv));
+    }
+    CHECK(upstream.allocations == 0uz);
+
+    // Then spill once it's exhausted.
+    const sys::pmr::str large(u8'x', 4096_uz, &arena);
+    CHECK(upstream.allocations > 0uz);
+    CHECK(large.size() == 4096_uz);
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
 // NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
@@ -17,6 +23,17 @@ _nowarn_end_gcc();
 #include <module/sys>
 #include <module/sys.Text>
 
+namespace
+{
+    // A long ASCII prefix of `fill` exercises the vectorized paths before `input` is reached.
+    std::u8string padded_utf8(const std::string& prefix, const std::string& input, const char fill)
+    {
+        std::u8string ret(prefix.size() * 8uz, _as(fill, char8_t));
+        ret.append(_asr(input.data(), const char8_t*) /* NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) */, input.size());
+        return ret;
+    }
+} // namespace
+
 TEST_CASE("Join of split by same delimiter is invariant.", "[fuzz][sys.Text][string]")
 {
     CHECK(rc::check([](const std::vector<u8::underlying_type>& bytes) -> void
@@ -30,6 +47,125 @@ TEST_CASE("Join of split by same delimiter is invariant.", "[fuzz][sys.Text][str
     }));
 }
 
+TEST_CASE("Join of split by same substring is invariant.", "[fuzz][sys.Text][string][split_view]")
+{
+    CHECK(rc::check([](const std::vector<bool>& units, const bool longDelimiter) -> void
+    {
+        // A two-letter alphabet, so delimiters and near-misses of them are frequent.
+        sys::str s;
+        for (const bool unit : units)
+            s.append(unit ? u8'a' : u8'b');
+        const std::u8string_view delimiter = longDelimiter ? u8"aab" : u8"ab";
+
+        std::vector<sys::str> pieces;
+        for (const std::u8string_view piece : s.split_view(delimiter))
+            pieces.emplace_back(piece);
+        RC_ASSERT(sys::str::join(pieces, delimiter) == s);
+        RC_ASSERT(pieces == s.split(delimiter));
+    }));
+}
+
+TEST_CASE("Substring search agrees with std::basic_string_view<...>::find(...).", "[fuzz][sys.Text][string_searcher]")
+{
+    CHECK(rc::check([](const std::vector<uint8_t>& haystackUnits, const std::vector<uint8_t>& needleUnits, const uint8_t from) -> void
+    {
+        // A small alphabet, so partial matches are frequent.
+        std::u8string haystack, needle;
+        for (const uint8_t unit : haystackUnits)
+            haystack.push_back(_as(u8'a' + unit % 3u, char8_t));
+        for (const uint8_t unit : needleUnits)
+            needle.push_back(_as(u8'a' + unit % 3u, char8_t));
+
+        const size_t expected = std::min(std::u8string_view(haystack).find(needle, from), haystack.size());
+        RC_ASSERT(sys::string_searcher<char8_t>(needle).find(haystack, sz(from)) == expected);
+    }));
+}
+
+TEST_CASE("Streaming fold comparison agrees with folded strings.", "[fuzz][sys.Text][string][fold]")
+{
+    CHECK(rc::check([](const std::vector<uint8_t>& aPicks, const std::vector<uint8_t>& bPicks, const bool turkic) -> void
+    {
+        // Letters with special, multi-codepoint or language-specific foldings, so partial and cross-codepoint matches are frequent.
+        constexpr std::u32string_view alphabet = U"aAsSßẞİıiIΣσςKkKéÉﬀf\U00010400\U00010428";
+        const auto pick = [&](const std::vector<uint8_t>& picks) -> sys::str
+        {
+            std::u32string ret;
+            for (const uint8_t i : picks)
+                ret.push_back(alphabet[i % alphabet.size()]);
+            return sys::str(sys::str32(ret));
+        };
+        const sys::str a = pick(aPicks), b = pick(bPicks);
+        const std::u8string_view lang = turkic ? u8"tr" : u8"";
+
+        const sys::str32 aFolded(a.folded(lang)), bFolded(b.folded(lang));
+        RC_ASSERT(a.fold_equals(b, lang) == (aFolded == bFolded));
+        RC_ASSERT(a.fold_compare(b, lang) == (std::u32string_view(aFolded) <=> std::u32string_view(bFolded)));
+        if (aFolded == bFolded)
+            RC_ASSERT(a.fold_hash(lang) == b.fold_hash(lang));
+    }));
+}
+
+TEST_CASE("Normalization forms are stable and agree with each other.", "[fuzz][sys.Text][string][normalization]")
+{
+    CHECK(rc::check([](const std::vector<uint8_t>& picks) -> void
+    {
+        // Letters and marks which compose, reorder, decompose to compatibility equivalents, or are composed algorithmically.
+        constexpr std::u32string_view alphabet = U"aeAEsſ\u00E9\u00C5\u212B\u1EAD\u1E9B\uFB01\u2460\u0958\u0301\u0302\u0307\u0323\u0327\u093C\uAC00\uD55C\u1100\u1161\u11A8";
+        std::u32string picked;
+        for (const uint8_t i : picks)
+            picked.push_back(alphabet[i % alphabet.size()]);
+        const sys::str s(sys::str32(picked));
+
+        using enum sys::normalization_form;
+        const sys::str nfcS = s.normalized(nfc), nfdS = s.normalized(nfd), nfkcS = s.normalized(nfkc), nfkdS = s.normalized(nfkd);
+        RC_ASSERT(nfcS.is_normalized(nfc));
+        RC_ASSERT(nfdS.is_normalized(nfd));
+        RC_ASSERT(nfcS.normalized(nfc) == nfcS);
+        RC_ASSERT(nfdS.normalized(nfc) == nfcS);
+        RC_ASSERT(nfcS.normalized(nfd) == nfdS);
+        RC_ASSERT(nfkdS.normalized(nfkc) == nfkcS);
+        RC_ASSERT(nfcS.normalized(nfkd) == nfkdS);
+        RC_ASSERT(s.is_normalized(nfc) == (s == nfcS));
+        RC_ASSERT(sys::str(sys::str16(s).normalized(nfc)) == nfcS);
+    }));
+}
+
+TEST_CASE("Segments concatenate back to the string, in every encoding.", "[fuzz][sys.Text][string][segmentation]")
+{
+    CHECK(rc::check([](const std::vector<uint8_t>& picks) -> void
+    {
+        // Letters, punctuation and spaces taking the ASCII fast paths, and codepoints which join into clusters or words by each of the stateful rules.
+        constexpr std::u32string_view alphabet = U"a1_ .,'\r\n\u05D0\u30A2\u0301\u200D\u2060\U0001F469\U0001F3FD\U0001F1E6\u1100\u1161\u11A8\u0915\u094D\u3000";
+        std::u32string picked;
+        for (const uint8_t i : picks)
+            picked.push_back(alphabet[i % alphabet.size()]);
+        const sys::str s(sys::str32(picked));
+        const sys::str16 s16(s);
+        const sys::str32 s32(picked);
+
+        const auto check = [&](const auto& view8, const auto& view16, const auto& view32) -> void
+        {
+            sys::str joined;
+            std::vector<sys::str> pieces8, pieces16, pieces32;
+            for (const std::u8string_view piece : view8)
+            {
+                RC_ASSERT(!piece.empty());
+                joined.append(piece);
+                pieces8.emplace_back(piece);
+            }
+            for (const std::u16string_view piece : view16)
+                pieces16.emplace_back(sys::str16(piece));
+            for (const std::u32string_view piece : view32)
+                pieces32.emplace_back(sys::str32(piece));
+            RC_ASSERT(joined == s);
+            RC_ASSERT(pieces8 == pieces16);
+            RC_ASSERT(pieces8 == pieces32);
+        };
+        check(s.grapheme_view(), s16.grapheme_view(), s32.grapheme_view());
+        check(s.word_view(), s16.word_view(), s32.word_view());
+    }));
+}
+
 TEST_CASE("UTF-8 -> UTF-32 -> UTF-8 is invariant.", "[fuzz][sys.Text][string]")
 {
     CHECK(rc::check([](const std::string& input) -> void
@@ -87,6 +223,112 @@ TEST_CASE("UTF-32 -> UTF-8 -> UTF-32 is invariant.", "[fuzz][sys.Text][string]")
     }));
 }
 
+TEST_CASE("Bulk transcoding matches codepoint-wise transcoding.", "[fuzz][sys.Text][string]")
+{
+    CHECK(rc::check([](const std::string& prefix, const std::string& input) -> void
+    {
+        const std::u8string bytes = padded_utf8(prefix, input, 'x');
+        const std::span<const char8_t> s(bytes);
+
+        sys::str16 expected16;
+        sys::str32 expected32;
+        for (const char32_t c : sys::codepoint_view(s))
+        {
+            char16_t buf16[2];
+            expected16.append(std::span<const char16_t>(buf16, sys::ch::write_codepoint(c, buf16 /* NOLINT(hicpp-no-array-decay) */, unsafe)));
+            expected32.append(c);
+        }
+
+        const sys::str16 actual16(std::u8string_view(s.data(), s.size()));
+        RC_ASSERT(actual16 == expected16);
+        RC_ASSERT(sys::str32(std::u8string_view(s.data(), s.size())) == expected32);
+        RC_ASSERT(sys::str32(actual16) == expected32);
+        RC_ASSERT(sys::str(expected32) == sys::str(s).replace_invalid());
+    }));
+}
+
+TEST_CASE("Validation matches codepoint-wise decoding.", "[fuzz][sys.Text][string]")
+{
+    CHECK(rc::check([](const std::string& prefix, const std::string& input) -> void
+    {
+        const sys::str s(padded_utf8(prefix, input, 'x'));
+
+        sz expected = 0_uz;
+        while (expected != s.size())
+        {
+            const auto [c, size] = sys::ch::read_codepoint(std::span<const char8_t>(s).subspan(expected), unsafe);
+            if (c == U'\uFFFD' && !std::ranges::equal(std::span<const char8_t>(s).subspan(expected, size), sys::ch::replacement<char8_t>()))
+                break;
+            expected += size;
+        }
+        RC_ASSERT(s.first_invalid_offset() == expected);
+        RC_ASSERT(s.is_valid() == (expected == s.size()));
+        RC_ASSERT(sys::str16(s).is_valid());
+        RC_ASSERT(sys::str32(s).is_valid());
+        RC_ASSERT(s.invalids_replaced().is_valid());
+    }));
+}
+
+TEST_CASE("Streaming decoding is independent of the chunk boundaries.", "[fuzz][sys.Text][utf_decoder]")
+{
+    CHECK(rc::check([](const std::string& input, const std::vector<uint8_t>& chunkSizes) -> void
+    {
+        const std::span<const char8_t> s(_asr(input.data(), const char8_t*) /* NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) */, input.size());
+
+        // Chunks of up to 7 bytes, so most multibyte sequences are split somewhere.
+        sys::utf_decoder<char8_t> decoder32, decoder16;
+        std::u32string decoded32;
+        std::u16string decoded16;
+        std::span<const char8_t> rest = s;
+        for (const uint8_t chunkSize : chunkSizes)
+        {
+            const std::span<const char8_t> chunk = rest.first(std::min(_as(chunkSize % 8u, size_t), rest.size()));
+            decoder32.decode(chunk, decoded32);
+            decoder16.decode(chunk, decoded16);
+            rest = rest.subspan(chunk.size());
+        }
+        decoder32.decode(rest, decoded32);
+        decoder16.decode(rest, decoded16);
+        decoder32.finish(decoded32);
+        decoder16.finish(decoded16);
+
+        const sys::str whole = sys::str(s).replace_invalid();
+        RC_ASSERT(sys::str(sys::str32(decoded32)) == whole);
+        RC_ASSERT(sys::str(sys::str16(decoded16)) == whole);
+    }));
+}
+
+TEST_CASE("Casing is independent of the encoding.", "[fuzz][sys.Text][string]")
+{
+    CHECK(rc::check([](const std::string& prefix, const std::string& input) -> void
+    {
+        const sys::str s(padded_utf8(prefix, input, 'X'));
+        const sys::str32 s32(s);
+
+        RC_ASSERT(sys::str(s32.lowered()) == s.lowered());
+        RC_ASSERT(sys::str(s32.uppered()) == s.uppered());
+        RC_ASSERT(sys::str(sys::str16(s).lowered(u8"lt")) == s.lowered(u8"lt"));
+    }));
+}
+
+TEST_CASE("ASCII casing only affects letters.", "[fuzz][sys.Text][string]")
+{
+    CHECK(rc::check([](const std::vector<u8::underlying_type>& bytes) -> void
+    {
+        sys::str s, lower, upper;
+        for (const u8::underlying_type v : bytes)
+        {
+            const char8_t c = _as(v & 0x7Fu, char8_t);
+            s.append(c);
+            lower.append(c >= u8'A' && c <= u8'Z' ? _as(c + 0x20, char8_t) : c);
+            upper.append(c >= u8'a' && c <= u8'z' ? _as(c - 0x20, char8_t) : c);
+        }
+
+        RC_ASSERT(s.lowered() == lower);
+        RC_ASSERT(s.uppered() == upper);
+    }));
+}
+
 TEST_CASE("Trim reduces size or stays same.", "[fuzz][sys.Text][string]")
 {
     CHECK(rc::check([](const std::string& input) -> void
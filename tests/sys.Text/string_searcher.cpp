@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+using namespace std::string_view_literals;
+
+static_assert(sys::string_searcher(u8"abcab"sv).find(u8"xxabcabyabcab"sv, 3_uz) == 8_uz);
+static_assert(sys::string_searcher(u8"aab"sv).find(u8"aaaaab"sv) == 3_uz);
+static_assert(!sys::string_searcher(u8"abc"sv).found_in(u8"ab"sv));
+
+TEST_CASE("string_searcher::find(...)", "[sys.Text][string_searcher]")
+{
+    const sys::string_searcher searcher(u8"needle"sv);
+    CHECK(searcher.find(u8"haystack with a needle in it"sv) == 16_uz);
+    CHECK(searcher.find(u8"haystack with a needle in it"sv, 17_uz) == 28_uz);
+    CHECK(searcher.find(u8"needl"sv) == 5_uz);
+    CHECK(searcher.find(u8"needle"sv, 7_uz) == 6_uz);
+    CHECK(searcher.found_in(u8"needleneedle"sv));
+    CHECK_FALSE(searcher.found_in(u8"n e e d l e"sv));
+
+    CHECK(sys::string_searcher(u8""sv).find(u8"abc"sv, 2_uz) == 2_uz);
+    CHECK(sys::string_searcher(u8""sv).found_in(u8""sv));
+    CHECK(sys::string_searcher(u8"c"sv).find(u8"abcabc"sv, 3_uz) == 5_uz);
+}
+
+TEST_CASE("string_searcher::find(...), repetitive input", "[sys.Text][string_searcher]")
+{
+    // Every position is a candidate for the first and last code unit, so this exercises the switch over to the Two-Way search.
+    std::u8string haystack(100000uz, u8'a');
+    std::u8string needle(300uz, u8'a');
+    needle[150uz] = u8'b';
+    CHECK(sys::string_searcher<char8_t>(needle).find(haystack) == haystack.size());
+
+    haystack.replace(90000uz, needle.size(), needle);
+    CHECK(sys::string_searcher<char8_t>(needle).find(haystack) == 90000_uz);
+
+    std::u16string wide;
+    for (size_t i = 0; i < 2500uz; i++)
+        wide.append(u"ab");
+    wide.append(u"ab\U0001F600ab");
+    CHECK(sys::string_searcher(u"\U0001F600"sv).find(wide) == 5002_uz);
+    CHECK(sys::string_searcher(u"ab\U0001F600a"sv).find(wide) == 5000_uz);
+
+    std::u32string wider(5000uz, U'x');
+    wider.append(U"xyx");
+    CHECK(sys::string_searcher(U"xxy"sv).find(wider) == 4999_uz);
+}
+
+TEST_CASE("string_searcher, reused", "[sys.Text][string][string_searcher]")
+{
+    const sys::string_searcher<char8_t> searcher(u8"ERROR"sv);
+    const sys::str info = u8"INFO: ok", error = u8"ERROR: not ok", warning = u8"WARN: an ERROR soon";
+
+    CHECK_FALSE(info.contains(searcher));
+    CHECK(error.find_index(searcher) == 0_uz);
+    CHECK(warning.find_index(searcher, 3_uz) == 9_uz);
+    CHECK(warning.find_index(searcher, 10_uz) == warning.size());
+
+    size_t pieces = 0;
+    for (const std::u8string_view piece : warning.split_view(searcher))
+    {
+        CHECK(piece == (pieces ? u8" soon"sv : u8"WARN: an "sv));
+        pieces++;
+    }
+    CHECK(pieces == 2uz);
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
@@ -0,0 +1,109 @@
+#include <span>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner)
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+#include <CompilerWarnings.h>
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+_nowarn_begin_conv_comp();
+_nowarn_begin_unreachable();
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_unreachable();
+_nowarn_end_conv_comp();
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+
+namespace
+{
+    template <typename To, typename From>
+    std::basic_string<To> decode_in_chunks(const std::basic_string_view<From> in, const size_t chunkSize)
+    {
+        sys::utf_decoder<From> decoder;
+        std::basic_string<To> ret;
+        for (size_t i = 0uz; i < in.size(); i += chunkSize)
+            decoder.decode(std::span<const From>(in.substr(i, chunkSize)), ret);
+        decoder.finish(ret);
+        return ret;
+    }
+} // namespace
+
+TEST_CASE("utf_decoder<...>::decode(...), split sequences", "[sys.Text][utf_decoder]")
+{
+    constexpr std::u8string_view text = u8"Größe 東京都 🇦🇺 naïve";
+    for (size_t chunkSize = 1uz; chunkSize <= text.size(); chunkSize++)
+    {
+        CAPTURE(chunkSize);
+        CHECK(decode_in_chunks<char32_t>(text, chunkSize) == U"Größe 東京都 🇦🇺 naïve");
+        CHECK(decode_in_chunks<char16_t>(text, chunkSize) == u"Größe 東京都 🇦🇺 naïve");
+        CHECK(decode_in_chunks<char8_t>(text, chunkSize) == text);
+    }
+
+    constexpr std::u16string_view text16 = u"a😀b😀";
+    for (size_t chunkSize = 1uz; chunkSize <= text16.size(); chunkSize++)
+        CHECK(decode_in_chunks<char8_t>(text16, chunkSize) == u8"a😀b😀");
+}
+
+TEST_CASE("utf_decoder<...>::decode(...), invalid sequences", "[sys.Text][utf_decoder]")
+{
+    // Invalid either side of a chunk boundary is replaced as if decoded whole.
+    const std::u8string invalid { u8'a', char8_t(0xE2), char8_t(0x82), u8'b', char8_t(0xF0), char8_t(0x9F), char8_t(0x98), char8_t(0xC3) };
+    const sys::str expected = sys::str(invalid).invalids_replaced();
+    for (size_t chunkSize = 1uz; chunkSize <= invalid.size(); chunkSize++)
+        CHECK(decode_in_chunks<char8_t>(std::u8string_view(invalid), chunkSize) == std::u8string_view(expected));
+
+    SECTION("A sequence left incomplete is only replaced once the stream is finished.")
+    {
+        sys::utf_decoder<char8_t> decoder;
+        std::u32string out;
+        decoder.decode(std::span<const char8_t>(invalid).first(6uz), out);
+        CHECK(out == U"a��b");
+        CHECK(decoder.has_pending());
+        decoder.finish(out);
+        CHECK(out == U"a��b��");
+        CHECK_FALSE(decoder.has_pending());
+    }
+    SECTION("A lone high surrogate at the end of the stream.")
+    {
+        sys::utf_decoder<char16_t> decoder;
+        std::u8string out;
+        const char16_t lead = u"😀"[0];
+        decoder.decode(std::span<const char16_t>(&lead, 1uz), out);
+        CHECK(out.empty());
+        decoder.finish(out);
+        CHECK(out == u8"�");
+    }
+}
+
+TEST_CASE("utf_decoder<...>::decode(...), caller-provided buffers", "[sys.Text][utf_decoder]")
+{
+    std::u8string text(1000uz, u8'x');
+    text.append(u8"é東😀");
+
+    sys::utf_decoder<char8_t> decoder;
+    std::span<const char8_t> in(text);
+    std::u16string out;
+    char16_t buf[7];
+    while (!in.empty())
+    {
+        const auto [read, written] = decoder.decode(in, std::span<char16_t>(buf));
+        REQUIRE((read != 0uz || written != 0uz));
+        in = in.subspan(read);
+        out.append(buf /* NOLINT(hicpp-no-array-decay) */, written);
+    }
+    CHECK(decoder.finish(std::span<char16_t>(buf)) == 0uz);
+    CHECK(out == std::u16string(1000uz, u'x') + u"é東😀");
+
+    // Too small for any codepoint, nothing is consumed.
+    const auto [read, written] = sys::utf_decoder<char8_t>().decode(std::span<const char8_t>(text), std::span<char16_t>(buf, 1uz));
+    CHECK(read == 0uz);
+    CHECK(written == 0uz);
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner)
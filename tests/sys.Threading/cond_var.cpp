@@ -1,3 +1,5 @@
+#include <chrono>
+
 // NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
 #include <CompilerWarnings.h>
 _nowarn_begin_one_clang(_clwarn_clang_consumed);
@@ -74,6 +76,48 @@ TEMPLATE_TEST_CASE /* NOLINT(modernize-use-trailing-return-type) */ ("cond_var::
     CHECK(t.join().expect() == 0);
 }
 
+TEMPLATE_TEST_CASE /* NOLINT(modernize-use-trailing-return-type) */ ("cond_var::wait_timeout(...)", "[sys.Threading][cond_var]", sys::mutex, sys::reentrant_mutex)
+{
+    using namespace std::chrono_literals;
+
+    sys::cond_var cv;
+    TestType mut;
+
+    {
+        const typename TestType::guard g = mut.lock().expect();
+        const auto start = std::chrono::steady_clock::now();
+        CHECK(cv.wait_timeout(mut, 30ms, []() -> bool { return false; }).expect_err() == sys::threading_error::timeout);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        CHECK(elapsed >= 30ms);
+        CHECK(elapsed < 5s);
+
+        CHECK(cv.wait_timeout(mut, std::chrono::system_clock::now() - 1s, []() -> bool { return true; }));
+        CHECK(cv.wait_timeout(mut, std::chrono::steady_clock::now() - 1s).expect_err() == sys::threading_error::timeout);
+    }
+
+    bool ready = false;
+    sys::once gotWaiting;
+
+    sys::managed_thread t = sys::managed_thread::ctor([&ready, &gotWaiting, &cv, &mut]() -> void
+    {
+        const typename TestType::guard g = mut.lock().expect();
+        cv.wait_timeout(mut, 1min, [&ready, &gotWaiting]() -> bool
+        {
+            gotWaiting.call_once([]() -> void { });
+            return ready;
+        }).expect();
+    }).expect();
+
+    gotWaiting.wait();
+    {
+        const typename TestType::guard g = mut.lock().expect();
+        ready = true;
+    }
+
+    CHECK(cv.notify_one());
+    CHECK(t.join().expect() == 0);
+}
+
 TEMPLATE_TEST_CASE /* NOLINT(modernize-use-trailing-return-type) */ ("cond_var::notify_one()", "[sys.Threading][cond_var]", sys::mutex, sys::reentrant_mutex)
 {
     sys::cond_var cv;
@@ -35,6 +35,7 @@ namespace sys::internal
     {
     private:
         cnd_t cond {};
+        mtx_t inner {}; // Only go through `mutex_handle`'s interface, whichever backend implements it.
     public:
         /* NOLINT(hicpp-explicit-conversions) */ cond_var_handle(std::nullptr_t) noexcept { }
         cond_var_handle(const cond_var_handle&) noexcept = delete;
@@ -47,27 +48,52 @@ namespace sys::internal
         // NOLINTBEGIN(concurrency-mt-unsafe, misc-predictable-rand): I do not care.
         internal::threading_error create() noexcept
         {
-            if (std::rand() % 2 == 0)
+            if (std::rand() % 2 == 0 && mtx_init(&this->inner, mtx_plain) == thrd_success)
                 return _as(cnd_init(&this->cond), internal::threading_error);
             return internal::threading_error::error;
         }
-        void destroy() noexcept { cnd_destroy(&this->cond); }
+        void destroy() noexcept
+        {
+            cnd_destroy(&this->cond);
+            mtx_destroy(&this->inner);
+        }
         internal::threading_error signal() noexcept
         {
             if (std::rand() % 2 == 0)
-                return _as(cnd_signal(&this->cond), internal::threading_error);
+            {
+                mtx_lock(&this->inner);
+                const int ret = cnd_signal(&this->cond);
+                mtx_unlock(&this->inner);
+                return _as(ret, internal::threading_error);
+            }
             return internal::threading_error::error;
         }
         internal::threading_error broadcast() noexcept
         {
             if (std::rand() % 2 == 0)
-                return _as(cnd_broadcast(&this->cond), internal::threading_error);
+            {
+                mtx_lock(&this->inner);
+                const int ret = cnd_broadcast(&this->cond);
+                mtx_unlock(&this->inner);
+                return _as(ret, internal::threading_error);
+            }
             return internal::threading_error::error;
         }
         internal::threading_error wait(internal::mutex_handle& mut) noexcept
         {
             if (std::rand() % 2 == 0)
-                return _as(cnd_wait(&this->cond, &mut.mut), internal::threading_error);
+            {
+                mtx_lock(&this->inner);
+                if (mut.unlock() != internal::threading_error::ok)
+                {
+                    mtx_unlock(&this->inner);
+                    return internal::threading_error::error;
+                }
+                const int ret = cnd_wait(&this->cond, &this->inner);
+                mtx_unlock(&this->inner);
+                _retif(internal::threading_error::error, mut.lock() != internal::threading_error::ok);
+                return _as(ret, internal::threading_error);
+            }
             return internal::threading_error::error;
         }
         // NOLINTEND(concurrency-mt-unsafe, misc-predictable-rand)
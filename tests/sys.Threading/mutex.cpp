@@ -1,3 +1,5 @@
+#include <chrono>
+
 // NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
 #include <CompilerWarnings.h>
 _nowarn_begin_one_clang(_clwarn_clang_consumed);
@@ -98,5 +100,52 @@ TEMPLATE_TEST_CASE /* NOLINT(modernize-use-trailing-return-type) */ ("mutex::loc
     CHECK(gotCount == 96_u8);
 }
 
+TEMPLATE_TEST_CASE /* NOLINT(modernize-use-trailing-return-type) */ ("mutex::try_lock_for(...), mutex::try_lock_until(...), reentrant_mutex::try_lock_for(...), "
+                                                                     "reentrant_mutex::try_lock_until(...)",
+                                                                     "[sys.Threading][mutex][reentrant_mutex]", sys::mutex, sys::reentrant_mutex)
+{
+    using namespace std::chrono_literals;
+
+    TestType mut;
+    CHECK(mut.try_lock_for(0ms));
+    CHECK(mut.try_lock_until(std::chrono::system_clock::now() + 10ms));
+
+    sys::once gotLocked, gotTimedOut;
+    sys::managed_thread t = sys::managed_thread::ctor([&gotLocked, &gotTimedOut, &mut]() -> void
+    {
+        const typename TestType::guard g = mut.lock().expect();
+        gotLocked.call_once([]() -> void { });
+        gotTimedOut.wait();
+    }).expect();
+
+    gotLocked.wait();
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(mut.try_lock_for(50ms).expect_err() == sys::threading_error::timeout);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    CHECK(elapsed >= 50ms);
+    CHECK(elapsed < 5s);
+    CHECK(mut.try_lock_until(std::chrono::steady_clock::now() - 1s).expect_err() == sys::threading_error::timeout);
+    gotTimedOut.call_once([]() -> void { });
+
+    CHECK(mut.try_lock_for(std::chrono::hours::max()));
+    CHECK(t.join().expect() == 0);
+}
+
+#if _libcxxext_threading_futex
+TEST_CASE("mutex, reentrant_mutex are constant-initializable with the futex backend", "[sys.Threading][mutex][reentrant_mutex]")
+{
+    static constinit sys::mutex mut;
+    static constinit sys::reentrant_mutex rmut;
+
+    CHECK(mut.try_acquire(unsafe));
+    CHECK(mut.release(unsafe));
+
+    CHECK(rmut.try_acquire(unsafe));
+    CHECK(rmut.try_acquire(unsafe));
+    CHECK(rmut.release(unsafe));
+    CHECK(rmut.release(unsafe));
+}
+#endif
+
 _nowarn_end_clang();
 // NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
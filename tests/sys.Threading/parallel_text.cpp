@@ -0,0 +1,81 @@
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+#include <module/sys.Threading>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace
+{
+    // Large enough to be split between several threads, of pieces with casing context, multi-unit sequences and invalid sequences straddling the splits.
+    template <typename T>
+    std::basic_string<T> repeated(const std::basic_string_view<T> piece)
+    {
+        constexpr size_t size = 4uz << 20uz;
+
+        std::basic_string<T> ret;
+        ret.reserve(size + piece.size());
+        while (ret.size() < size)
+            ret.append(piece);
+        return ret;
+    }
+} // namespace
+
+TEST_CASE("parallel_lowered(...), parallel_uppered(...), parallel_folded(...)", "[sys.Threading][parallel_text]")
+{
+    const sys::str s(repeated(u8"ΟΔΟΣ ΣΑΣ.́ İstanbul Straße ǅ̇ ꭰﬀ "sv));
+
+    for (const size_t threads : { 1uz, 2uz, 3uz, 8uz })
+    {
+        CAPTURE(threads);
+        CHECK(sys::parallel_lowered(s, u8"", threads) == s.lowered());
+        CHECK(sys::parallel_uppered(s, u8"", threads) == s.uppered());
+        CHECK(sys::parallel_folded(s, u8"", threads) == s.folded());
+        CHECK(sys::parallel_lowered(s, u8"tr", threads) == s.lowered(u8"tr"));
+        CHECK(sys::parallel_uppered(s, u8"lt", threads) == s.uppered(u8"lt"));
+    }
+
+    // Without whitespace to split at, the whole string is cased on the calling thread.
+    const sys::str unbroken(repeated(u8"ΣΑΣ.ΣΑΣ"sv));
+    CHECK(sys::parallel_lowered(unbroken, u8"", 4uz) == unbroken.lowered());
+
+    const sys::str16 s16(s);
+    CHECK(sys::parallel_uppered(s16, u8"", 4uz) == s16.uppered());
+    CHECK(sys::parallel_lowered(sys::str(), u8"", 4uz).empty());
+}
+
+TEST_CASE("parallel_invalids_replaced(...), parallel_transcoded(...)", "[sys.Threading][parallel_text]")
+{
+    std::u8string piece = u8"naïve Ωμέγα 😀 abc"s;
+    piece.append({ char8_t(0xF0), char8_t(0x9F), char8_t(0x98), u8'x', char8_t(0xC3), char8_t(0x80), char8_t(0x80), char8_t(0xFF) });
+    const sys::str s(repeated(std::u8string_view(piece)));
+
+    std::u16string piece16 = u"naïve 😀"s;
+    piece16.append({ char16_t(0xDC00), u'x', char16_t(0xD800) });
+    const sys::str16 s16(repeated(std::u16string_view(piece16)));
+
+    for (const size_t threads : { 1uz, 2uz, 3uz, 8uz })
+    {
+        CAPTURE(threads);
+        CHECK(sys::parallel_invalids_replaced(s, threads) == s.invalids_replaced());
+        CHECK(sys::parallel_invalids_replaced(s16, threads) == s16.invalids_replaced());
+        CHECK(sys::parallel_transcoded<char32_t>(s, threads) == sys::str32(s));
+        CHECK(sys::parallel_transcoded<char16_t>(s, threads) == sys::str16(s));
+        CHECK(sys::parallel_transcoded<char8_t>(s16, threads) == sys::str(s16));
+    }
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,107 @@
+#include <array>
+#include <atomic>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Threading>
+
+static_assert(sys::INothrowDefaultConstructible<sys::rw_mutex>);
+static_assert(sys::INothrowDestructible<sys::rw_mutex>);
+
+TEST_CASE("rw_mutex::read_lock(), rw_mutex::write_lock(), rw_mutex::try_read_lock(), rw_mutex::try_write_lock()", "[sys.Threading][rw_mutex]")
+{
+    sys::rw_mutex mut;
+
+    {
+        const sys::rw_mutex::read_guard guard1 = mut.read_lock().expect();
+        const sys::rw_mutex::read_guard guard2 = mut.try_read_lock().expect();
+        CHECK(mut.try_write_lock().expect_err() == sys::threading_error::busy);
+    }
+    {
+        const sys::rw_mutex::write_guard guard = mut.write_lock().expect();
+        CHECK(mut.try_read_lock().expect_err() == sys::threading_error::busy);
+        CHECK(mut.try_write_lock().expect_err() == sys::threading_error::busy);
+    }
+
+    CHECK(mut.try_acquire_read(unsafe));
+    CHECK(mut.release_read(unsafe));
+    CHECK(mut.try_acquire(unsafe));
+    CHECK(mut.release(unsafe));
+}
+
+TEST_CASE("rw_mutex prefers writers", "[sys.Threading][rw_mutex]")
+{
+    sys::rw_mutex mut;
+    sys::once gotWriting;
+    sys::managed_thread t = nullptr;
+
+    {
+        const sys::rw_mutex::read_guard guard = mut.read_lock().expect();
+        t = sys::managed_thread::ctor([&gotWriting, &mut]() -> void
+        {
+            const sys::rw_mutex::write_guard g = mut.write_lock().expect();
+            gotWriting.call_once([]() -> void { });
+        }).expect();
+
+        // Once the writer queues up, new readers have to wait behind it.
+        while (mut.try_read_lock())
+            sys::thread_yield();
+        CHECK_FALSE(gotWriting.is_completed());
+    }
+
+    gotWriting.wait();
+    CHECK(t.join().expect() == 0);
+    CHECK(mut.try_read_lock());
+}
+
+TEST_CASE("rw_mutex under contention", "[sys.Threading][rw_mutex]")
+{
+    sys::rw_mutex mut;
+    std::atomic<size_t> readers = 0uz, writers = 0uz;
+    std::atomic<bool> overlapped = false;
+    size_t written = 0uz;
+
+    std::array<sys::managed_thread, 8uz /* NOLINT(readability-magic-numbers) */> pool { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+    for (size_t i = 0uz; i < pool.size(); i++)
+    {
+        pool[i] = sys::managed_thread::ctor([&, writer = i % 4uz == 0uz]() -> void
+        {
+            for (sz j = 0_uz; j < 500_uz /* NOLINT(readability-magic-numbers) */; j++)
+            {
+                if (writer)
+                {
+                    const sys::rw_mutex::write_guard g = mut.write_lock().expect();
+                    if (writers.fetch_add(1uz) != 0uz || readers.load() != 0uz)
+                        overlapped = true;
+                    written++;
+                    writers.fetch_sub(1uz);
+                }
+                else
+                {
+                    const sys::rw_mutex::read_guard g = mut.read_lock().expect();
+                    readers.fetch_add(1uz);
+                    if (writers.load() != 0uz)
+                        overlapped = true;
+                    sys::thread_yield();
+                    readers.fetch_sub(1uz);
+                }
+            }
+        }).expect();
+    }
+
+    for (sys::managed_thread& t : pool)
+        CHECK(t.join().expect() == 0);
+    CHECK_FALSE(overlapped.load());
+    CHECK(written == 1000uz);
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -1,3 +1,7 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+
 // NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
 #include <CompilerWarnings.h>
 _nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
@@ -106,4 +110,65 @@ TEMPLATE_TEST_CASE /* NOLINT(modernize-use-trailing-return-type) */ ("binary_sem
     CHECK(t.join().expect() == 0);
 }
 
+TEST_CASE("semaphore::access() under contention", "[sys.Threading][semaphore]")
+{
+    sys::semaphore sem(3_uz, unsafe);
+    std::atomic<size_t> holders = 0uz;
+    std::atomic<bool> overcommitted = false;
+
+    std::array<sys::managed_thread, 8uz /* NOLINT(readability-magic-numbers) */> pool { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+    for (sys::managed_thread& t : pool)
+    {
+        t = sys::managed_thread::ctor([&]() -> void
+        {
+            for (sz i = 0_uz; i < 200_uz /* NOLINT(readability-magic-numbers) */; i++)
+            {
+                const sys::semaphore::guard g = sem.access().expect();
+                if (holders.fetch_add(1uz) >= 3uz)
+                    overcommitted = true;
+                sys::thread_yield();
+                holders.fetch_sub(1uz);
+            }
+        }).expect();
+    }
+
+    for (sys::managed_thread& t : pool)
+        CHECK(t.join().expect() == 0);
+    CHECK_FALSE(overcommitted.load());
+
+    for (sz i = 0_uz; i < 3_uz; i++)
+        sem.acquire(unsafe).expect();
+    for (sz i = 0_uz; i < 3_uz; i++)
+        sem.release(unsafe).expect();
+}
+
+TEST_CASE("semaphore::try_acquire_for(...), semaphore::try_acquire_until(...), semaphore::try_access_for(...), semaphore::try_access_until(...)",
+          "[sys.Threading][semaphore]")
+{
+    using namespace std::chrono_literals;
+
+    sys::semaphore sem(1_uz, unsafe);
+    CHECK(sem.try_acquire_for(0ms, unsafe));
+    CHECK(sem.try_acquire_until(std::chrono::system_clock::now() + 10ms, unsafe).expect_err() == sys::threading_error::timeout);
+
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(sem.try_access_for(40ms).expect_err() == sys::threading_error::timeout);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    CHECK(elapsed >= 40ms);
+    CHECK(elapsed < 5s);
+
+    sys::once gotReady;
+    sys::managed_thread t = sys::managed_thread::ctor([&gotReady, &sem]() -> void
+    {
+        gotReady.call_once([]() -> void { });
+        const sys::semaphore::guard g = sem.try_access_until(std::chrono::steady_clock::now() + 1min).expect();
+    }).expect();
+
+    gotReady.wait();
+    sem.release(unsafe).expect();
+    CHECK(t.join().expect() == 0);
+
+    const sys::semaphore::guard g = sem.try_access_for(0ms).expect();
+}
+
 // NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,91 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Threading>
+
+namespace
+{
+    struct snapshot
+    {
+        uint64_t a = 0;
+        uint64_t b = 0;
+        uint8_t check = 0;
+
+        [[nodiscard]] bool consistent() const noexcept { return this->a == this->b && _as(this->a, uint8_t) == this->check; }
+    };
+} // namespace
+
+static_assert(sys::INothrowDefaultConstructible<sys::seqlock<snapshot>>);
+static_assert(sys::INothrowDestructible<sys::seqlock<snapshot>>);
+
+TEST_CASE("seqlock::load(), seqlock::try_load(...), seqlock::store(...), seqlock::update(...)", "[sys.Threading][seqlock]")
+{
+    sys::seqlock<int> value(42 /* NOLINT(readability-magic-numbers) */);
+    CHECK(value.load() == 42);
+
+    CHECK(value.store(7 /* NOLINT(readability-magic-numbers) */));
+    int out = 0;
+    CHECK(value.try_load(out));
+    CHECK(out == 7);
+
+    CHECK(value.update([](int& v) noexcept -> void { v *= 3; }));
+    CHECK(value.load() == 21);
+
+    sys::seqlock<snapshot> def;
+    CHECK(def.load().consistent());
+    CHECK(def.load().a == 0);
+}
+
+TEST_CASE("seqlock never exposes torn values", "[sys.Threading][seqlock]")
+{
+    sys::seqlock<snapshot> value;
+    std::atomic<bool> stop = false, torn = false;
+
+    std::array<sys::managed_thread, 4uz /* NOLINT(readability-magic-numbers) */> readers { nullptr, nullptr, nullptr, nullptr };
+    for (sys::managed_thread& t : readers)
+    {
+        t = sys::managed_thread::ctor([&]() -> void
+        {
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                if (!value.load().consistent())
+                    torn = true;
+            }
+        }).expect();
+    }
+
+    for (uint64_t i = 1; i < 20000 /* NOLINT(readability-magic-numbers) */; i++)
+    {
+        if (i % 2 == 0)
+            value.store(snapshot { .a = i, .b = i, .check = _as(i, uint8_t) }).expect();
+        else
+        {
+            value.update([](snapshot& s) noexcept -> void
+            {
+                s.a++;
+                s.b++;
+                s.check++;
+            }).expect();
+        }
+    }
+    stop = true;
+
+    for (sys::managed_thread& t : readers)
+        CHECK(t.join().expect() == 0);
+    CHECK_FALSE(torn.load());
+    CHECK(value.load().a == 19999);
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
@@ -0,0 +1,122 @@
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Text>
+#include <module/sys.Threading>
+
+using namespace std::string_view_literals;
+
+namespace
+{
+    template <typename T>
+    std::basic_string<T> numbered(const std::basic_string_view<T> prefix, const size_t i)
+    {
+        const std::string digits = std::to_string(i);
+        std::basic_string<T> ret(prefix);
+        ret.append(digits.begin(), digits.end());
+        return ret;
+    }
+} // namespace
+
+TEST_CASE("string_pool<...>::intern(...), string_pool<...>::find(...), string_pool<...>::at(...)", "[sys.Threading][string_pool]")
+{
+    sys::string_pool<char8_t> pool;
+    CHECK(pool.size() == 0_uz);
+    CHECK_FALSE(pool.find(u8"identifier"sv));
+
+    const sys::interned_string<char8_t> a = pool.intern(u8"identifier"sv);
+    const sys::interned_string<char8_t> b = pool.intern(std::u8string(u8"identifier"));
+    const sys::interned_string<char8_t> c = pool.intern(u8"東京都"sv);
+    CHECK(a);
+    CHECK(a == b);
+    CHECK(a.data() == b.data());
+    CHECK(a != c);
+    CHECK(std::u8string_view(a) == u8"identifier"sv);
+    CHECK(a.size() == 10_uz);
+    CHECK(a.data()[*a.size()] == u8'\0');
+    CHECK(std::u8string_view(c) == u8"東京都"sv);
+    CHECK(pool.size() == 2_uz);
+
+    CHECK(pool.find(u8"identifier"sv) == a);
+    CHECK(pool.at(a.handle()) == a);
+    CHECK(pool.at(c.handle()) == c);
+    CHECK(a.handle() != c.handle());
+
+    const sys::interned_string<char8_t> empty = pool.intern(u8""sv);
+    CHECK(empty);
+    CHECK(std::u8string_view(empty).empty());
+    CHECK(pool.intern(u8""sv) == empty);
+
+    const sys::interned_string<char8_t> null;
+    CHECK_FALSE(null);
+    CHECK(null != empty);
+    CHECK(std::u8string_view(null).empty());
+
+    const std::unordered_set<sys::interned_string<char8_t>> set { a, b, c, empty };
+    CHECK(set.size() == 3uz);
+}
+
+TEST_CASE("string_pool<...>, many strings", "[sys.Threading][string_pool]")
+{
+    sys::string_pool<char16_t> pool;
+    std::array<sys::interned_string<char16_t>, 5000uz /* NOLINT(readability-magic-numbers) */> interned;
+    for (size_t i = 0uz; i < interned.size(); i++)
+        interned[i] = pool.intern(numbered(u"name_"sv, i));
+    CHECK(pool.size() == sz(interned.size()));
+
+    // Interning moves nothing already interned, as the tables grow.
+    for (size_t i = 0uz; i < interned.size(); i++)
+    {
+        const std::u16string text = numbered(u"name_"sv, i);
+        CHECK(std::u16string_view(interned[i]) == text);
+        CHECK(pool.intern(text) == interned[i]);
+        CHECK(pool.at(interned[i].handle()) == interned[i]);
+    }
+}
+
+TEST_CASE("string_pool<...> under contention", "[sys.Threading][string_pool]")
+{
+    constexpr size_t strings = 2000uz;
+
+    sys::string_pool<char8_t> pool;
+    std::array<std::array<sys::interned_string<char8_t>, strings>, 8uz /* NOLINT(readability-magic-numbers) */> results {};
+
+    // Every thread interns the same strings, each in a different order.
+    std::array<sys::managed_thread, 8uz /* NOLINT(readability-magic-numbers) */> threads { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+    for (size_t i = 0uz; i < threads.size(); i++)
+    {
+        threads[i] = sys::managed_thread::ctor([&pool, &result = results[i], i]() -> void
+        {
+            for (size_t j = 0uz; j < strings; j++)
+            {
+                const size_t k = (j * 7uz + i * 251uz) % strings;
+                result[k] = pool.intern(numbered(u8""sv, k));
+            }
+        }).expect();
+    }
+    for (sys::managed_thread& t : threads)
+        CHECK(t.join().expect() == 0);
+
+    CHECK(pool.size() == sz(strings));
+    for (size_t k = 0uz; k < strings; k++)
+    {
+        CHECK(std::u8string_view(results[0][k]) == numbered(u8""sv, k));
+        for (const std::array<sys::interned_string<char8_t>, strings>& result : results)
+            CHECK(result[k] == results[0][k]);
+    }
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
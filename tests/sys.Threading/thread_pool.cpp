@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+// NOLINTBEGIN(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
+#include <CompilerWarnings.h>
+_nowarn_begin_one_clang(_clwarn_clang_consumed);
+_nowarn_begin_one_gcc(_clwarn_gcc_redundant_decls);
+
+#include <catch2/catch_all.hpp>
+
+_nowarn_end_gcc();
+
+#include <module/sys>
+#include <module/sys.Threading>
+
+namespace
+{
+    size_t fib(sys::thread_pool& pool, const size_t n) // NOLINT(misc-no-recursion)
+    {
+        if (n < 2uz)
+            return n;
+
+        sys::task_future<size_t> lhs = pool.submit([&pool, n]() -> size_t { return fib(pool, n - 1uz); }).expect();
+        const size_t rhs = fib(pool, n - 2uz);
+        return lhs.get().expect() + rhs;
+    }
+} // namespace
+
+TEST_CASE("thread_pool::ctor(...)", "[sys.Threading][thread_pool]")
+{
+    CHECK(sys::thread_pool::ctor(0uz).expect_err() == sys::threading_error::invalid_argument);
+
+    sys::thread_pool pool = sys::thread_pool::ctor(3uz).expect();
+    CHECK(pool);
+    CHECK(pool.size() == 3uz);
+
+    sys::thread_pool moved = std::move(pool);
+    CHECK(moved);
+    CHECK_FALSE(pool); // NOLINT(bugprone-use-after-move)
+    CHECK(pool.size() == 0uz);
+    CHECK(pool.submit([]() -> void { }).expect_err() == sys::threading_error::invalid_operation);
+    CHECK(pool.parallel_for(0uz, 1uz, [](size_t) -> void { }).expect_err() == sys::threading_error::invalid_operation);
+
+    CHECK(sys::thread_pool::ctor().expect().size() >= 1uz);
+}
+
+TEST_CASE("thread_pool::submit(...), task_future", "[sys.Threading][thread_pool][task_future]")
+{
+    sys::thread_pool pool = sys::thread_pool::ctor(4uz).expect();
+
+    sys::task_future<int> answer = pool.submit([]() -> int { return 42; /* NOLINT(readability-magic-numbers) */ }).expect();
+    CHECK(answer);
+    CHECK(answer.get().expect() == 42);
+    CHECK_FALSE(answer);
+    CHECK(answer.get().expect_err() == sys::threading_error::invalid_operation);
+
+    bool ran = false;
+    sys::task_future<void> nothing = pool.submit([&ran]() -> void { ran = true; }).expect();
+    CHECK(nothing.get());
+    CHECK(ran);
+
+    sys::task_future<int> thrown = pool.submit([]() -> int { throw std::runtime_error("oops"); }).expect();
+    CHECK(thrown.get().expect_err() == sys::threading_error::operation_failed);
+
+    // Tasks waiting on subtasks must not starve the pool.
+    CHECK(fib(pool, 18uz /* NOLINT(readability-magic-numbers) */) == 2584uz);
+
+    std::atomic<size_t> count = 0uz;
+    {
+        sys::thread_pool scoped = sys::thread_pool::ctor(2uz).expect();
+        for (size_t i = 0uz; i < 1000uz /* NOLINT(readability-magic-numbers) */; i++)
+            (void)scoped.submit([&count]() -> void { count.fetch_add(1uz, std::memory_order_relaxed); }).expect();
+    }
+    CHECK(count.load() == 1000uz);
+
+    // Futures may outlive their pool, which ran their tasks before it was destroyed.
+    sys::task_future<int> orphan = nullptr;
+    {
+        sys::thread_pool scoped = sys::thread_pool::ctor(2uz).expect();
+        orphan = scoped.submit([]() -> int { return 7; /* NOLINT(readability-magic-numbers) */ }).expect();
+    }
+    CHECK(orphan.ready());
+    CHECK(orphan.get().expect() == 7);
+}
+
+TEST_CASE("thread_pool::parallel_for(...)", "[sys.Threading][thread_pool]")
+{
+    sys::thread_pool pool = sys::thread_pool::ctor(4uz).expect();
+
+    std::vector<std::atomic<int>> hits(10000uz /* NOLINT(readability-magic-numbers) */);
+    CHECK(pool.parallel_for(0uz, hits.size(), [&hits](const size_t i) -> void { hits[i].fetch_add(1, std::memory_order_relaxed); }));
+    CHECK(std::ranges::all_of(hits, [](const std::atomic<int>& hit) -> bool { return hit.load() == 1; }));
+
+    std::atomic<size_t> sum = 0uz;
+    CHECK(pool.parallel_for(10uz, 20uz, [&sum](const size_t i) -> void { sum.fetch_add(i, std::memory_order_relaxed); }, 3uz));
+    CHECK(sum.load() == 145uz);
+    bool ranEmpty = false;
+    CHECK(pool.parallel_for(5uz, 5uz, [&ranEmpty](size_t) -> void { ranEmpty = true; }));
+    CHECK_FALSE(ranEmpty);
+
+    sum = 0uz;
+    std::atomic<bool> nestedFailed = false;
+    CHECK(pool.parallel_for(0uz, 64uz, [&](size_t) -> void
+    {
+        if (!pool.parallel_for(0uz, 100uz, [&sum](const size_t j) -> void { sum.fetch_add(j, std::memory_order_relaxed); }))
+            nestedFailed = true;
+    }));
+    CHECK_FALSE(nestedFailed.load());
+    CHECK(sum.load() == 64uz * 4950uz);
+
+    CHECK(pool.parallel_for(0uz, 1000uz, [](const size_t i) -> void
+    {
+        if (i == 500uz)
+            throw std::runtime_error("oops");
+    }).expect_err() == sys::threading_error::operation_failed);
+}
+
+_nowarn_end_clang();
+// NOLINTEND(bugprone-throwing-static-initialization, misc-include-cleaner, readability-function-cognitive-complexity)
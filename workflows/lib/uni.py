@@ -3,7 +3,7 @@
 import os
 import urllib.request
 from io import TextIOWrapper
-from typing import Set, List, cast
+from typing import Dict, List, NamedTuple, Sequence, Set, cast
 
 from lib.log import lprint
 
@@ -57,3 +57,89 @@ def parse_codepoints(path: str, property_name: str) -> Set[int]:
                 else:
                     points.add(int(code_range, 16))
     return points
+
+
+class TwoStageTable(NamedTuple):
+    """Codepoint lookup table split into a block index (stage 1) and deduplicated blocks (stage 2).
+
+    The value for a codepoint `cp < limit` is `stage2[(stage1[cp >> shift] << shift) | (cp & ((1 << shift) - 1))]`.
+    """
+
+    shift: int
+    limit: int
+    stage1: List[int]
+    stage2: List[int]
+
+
+def cxx_uint_type(max_value: int) -> str:
+    """Smallest C++ unsigned integer type able to hold `max_value`."""
+
+    if max_value <= 0xFF:
+        return "uint_least8_t"
+    if max_value <= 0xFFFF:
+        return "uint_least16_t"
+    return "uint_least32_t"
+
+
+def _cxx_uint_size(max_value: int) -> int:
+    return 1 if max_value <= 0xFF else 2 if max_value <= 0xFFFF else 4
+
+
+def build_two_stage_table(values: Dict[int, int], default: int = 0) -> TwoStageTable:
+    """Compress a sparse codepoint to value mapping into the smallest `TwoStageTable`.
+
+    Codepoints at or beyond the returned `limit` all map to `default`, and must be handled by the caller.
+    """
+
+    max_cp: int = max((cp for cp, val in values.items() if val != default), default=0)
+    best: TwoStageTable | None = None
+    best_size: int = 0
+    for shift in range(3, 12):
+        block_size: int = 1 << shift
+        limit: int = ((max_cp >> shift) + 1) << shift
+        blocks: Dict[tuple, int] = {}
+        stage1: List[int] = []
+        stage2: List[int] = []
+        for block_start in range(0, limit, block_size):
+            block = tuple(
+                values.get(cp, default)
+                for cp in range(block_start, block_start + block_size)
+            )
+            if block not in blocks:
+                blocks[block] = len(blocks)
+                stage2.extend(block)
+            stage1.append(blocks[block])
+
+        size: int = len(stage1) * _cxx_uint_size(len(blocks) - 1) + len(
+            stage2
+        ) * _cxx_uint_size(max(stage2))
+        if best is None or size < best_size:
+            best = TwoStageTable(shift, limit, stage1, stage2)
+            best_size = size
+
+    assert best is not None
+    return best
+
+
+def write_cxx_array(
+    f: TextIOWrapper,
+    cxx_type: str,
+    name: str,
+    values: Sequence[str],
+    indent_level: int = 1,
+    column_limit: int = 180,
+) -> None:
+    """Write a `constexpr` C++ array definition, wrapping its elements at `column_limit`."""
+
+    prefix: str = "    " * indent_level
+    f.write(f"{prefix}inline constexpr {cxx_type} {name}[] = {{\n")
+    line: str = prefix + "    "
+    for i, val in enumerate(values):
+        item: str = val + ("," if i + 1 < len(values) else "")
+        if line.strip() and len(line) + 1 + len(item) > column_limit:
+            f.write(line.rstrip() + "\n")
+            line = prefix + "    "
+        line += item + " "
+    if line.strip():
+        f.write(line.rstrip() + "\n")
+    f.write(f"{prefix}}};\n")
@@ -1,13 +1,21 @@
 import os
 import sys
 from textwrap import dedent, indent
-from typing import Any, Dict, List, Set
+from typing import Any, Dict, List, Set, Tuple
 
 sys.path.append(os.path.abspath(f"{os.path.dirname(__file__)}/.."))
 
 import lib.config as config
 from lib.log import lcheck_passed, lprint
-from lib.uni import to_cxx_u32_literal, write_header, parse_codepoints
+from lib.uni import (
+    TwoStageTable,
+    build_two_stage_table,
+    cxx_uint_type,
+    parse_codepoints,
+    to_cxx_u32_literal,
+    write_cxx_array,
+    write_header,
+)
 
 script_dir: str = os.path.dirname(os.path.abspath(__file__))
 ucd_dir: str = os.path.abspath(f"{script_dir}/../../sys.Text/data_unicode/ucd")
@@ -30,6 +38,11 @@ CONDITION_MAP = {
     "Not_Before_Dot": "!lctx.before_dot",
 }
 
+# Bits of `casing_record::flags`.
+CASING_FLAG_CASED = 0x1
+CASING_FLAG_CASE_IGNORABLE = 0x2
+CASING_FLAG_SOFT_DOTTED = 0x4
+
 
 def should_add_to_conditional(
     cp: int,
@@ -186,6 +199,8 @@ def main(argv: List[str]) -> None:
         f.write(
             dedent(
                 """\
+                #include <cstddef>
+                #include <cstdint>
                 #include <string_view>
 
                 #include <Integer.h>
@@ -219,96 +234,136 @@ def main(argv: List[str]) -> None:
             )
         )
 
-        def write_bool_switch(name: str, points_set: Set[int]) -> None:
-            f.write(
-                indent(
-                    dedent(
-                        f"""\
-                        /// @internal
-                        /// @ingroup sys_internal
-                        constexpr bool {name}(const char32_t c) noexcept
-                        {{
-                            switch (c)
-                            {{
-                        """
-                    ),
-                    "    ",
-                )
+        # Pack every per-codepoint property into a deduplicated record, indexed by a two-stage table.
+        records: Dict[Tuple[int, int, int, int], int] = {(0, 0, 0, 0): 0}
+        record_indices: Dict[int, int] = {}
+        for cp in sorted(
+            set(simple_lower_mappings)
+            | set(simple_upper_mappings)
+            | set(simple_fold_mappings)
+            | cased_points
+            | case_ignorable_points
+            | soft_dotted_points
+        ):
+            if cp > 0x10FFFF:
+                continue
+            flags: int = (
+                (CASING_FLAG_CASED if cp in cased_points else 0)
+                | (CASING_FLAG_CASE_IGNORABLE if cp in case_ignorable_points else 0)
+                | (CASING_FLAG_SOFT_DOTTED if cp in soft_dotted_points else 0)
             )
-            for cp in sorted(list(points_set)):
-                cp_lit: str = to_cxx_u32_literal(hex(cp)[2:].upper())
-                f.write(f"        case {cp_lit}: return true;\n")
-            f.write(
-                indent(
-                    dedent(
-                        """\
-                            default: return false;
-                            }
-                        }
-                        """
-                    ),
-                    "    ",
-                )
+            record: Tuple[int, int, int, int] = (
+                simple_lower_mappings.get(cp, cp) - cp,
+                simple_upper_mappings.get(cp, cp) - cp,
+                simple_fold_mappings.get(cp, cp) - cp,
+                flags,
             )
+            record_indices[cp] = records.setdefault(record, len(records))
+        table: TwoStageTable = build_two_stage_table(record_indices)
 
-        write_bool_switch("dchar_is_cased", cased_points)
-        write_bool_switch("dchar_is_case_ignorable", case_ignorable_points)
-        write_bool_switch("dchar_is_soft_dotted", soft_dotted_points)
-        f.write("\n")
-
-        def write_simple_mapping(
-            name: str,
-            mappings: Dict[int, int],
-            unconditional_special: Dict[int, List[int]],
-        ) -> None:
-            f.write(
-                indent(
-                    dedent(
-                        f"""\
-                        /// @internal
-                        /// @ingroup sys_internal
-                        constexpr char32_t {name}(const char32_t c) noexcept
-                        {{
-                            switch (c)
-                            {{
-                        """
-                    ),
-                    "    ",
-                )
-            )
-            for cp, mapped_cp in sorted(mappings.items()):
-                if (
-                    cp in unconditional_special
-                    and len(unconditional_special[cp]) == 1
-                    and unconditional_special[cp][0] == mapped_cp
-                ):
-                    continue
-                cp_lit: str = to_cxx_u32_literal(hex(cp)[2:].upper())
-                mapped_lit: str = to_cxx_u32_literal(hex(mapped_cp)[2:].upper())
-                f.write(f"        case {cp_lit}: return {mapped_lit};\n")
-            f.write(
-                indent(
-                    dedent(
-                        """\
-                            default: return c;
-                            }
-                        }
-                        """
-                    ),
-                    "    ",
-                )
+        f.write(
+            indent(
+                dedent(
+                    f"""\
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Casing properties shared by a set of codepoints.
+                    struct casing_record
+                    {{
+                        int_least32_t lower_delta;
+                        int_least32_t upper_delta;
+                        int_least32_t fold_delta;
+                        uint_least8_t flags;
+                    }};
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t casing_flag_cased = {hex(CASING_FLAG_CASED)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t casing_flag_case_ignorable = {hex(CASING_FLAG_CASE_IGNORABLE)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t casing_flag_soft_dotted = {hex(CASING_FLAG_SOFT_DOTTED)}u;
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr size_t casing_shift = {table.shift}uz;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr char32_t casing_limit = {to_cxx_u32_literal(hex(table.limit)[2:].upper())};
+
+                    // clang-format off
+                    """
+                ),
+                "    ",
             )
-
-        write_simple_mapping(
-            "dchar_to_lower_simple", simple_lower_mappings, unconditional_special_lower
         )
-        write_simple_mapping(
-            "dchar_to_upper_simple", simple_upper_mappings, unconditional_special_upper
+        write_cxx_array(
+            f,
+            "casing_record",
+            "casing_records",
+            [
+                f"{{ {lower}, {upper}, {fold}, {hex(flags)}u }}"
+                for (lower, upper, fold, flags) in records
+            ],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage1)),
+            "casing_stage1",
+            [f"{v}u" for v in table.stage1],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage2)),
+            "casing_stage2",
+            [f"{v}u" for v in table.stage2],
         )
-        write_simple_mapping(
-            "dchar_fold_simple", simple_fold_mappings, unconditional_special_fold
+        f.write(
+            indent(
+                dedent(
+                    """\
+                    // clang-format on
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Casing properties of `c`.
+                    constexpr const casing_record& dchar_casing_record(const char32_t c) noexcept
+                    {
+                        if (c >= casing_limit)
+                            return casing_records[0];
+                        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+                        const size_t block = casing_stage1[c >> casing_shift];
+                        return casing_records[casing_stage2[(block << casing_shift) | (c & ((1uz << casing_shift) - 1uz))]];
+                        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+                    }
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr bool dchar_is_cased(const char32_t c) noexcept { return (dchar_casing_record(c).flags & casing_flag_cased) != 0u; }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr bool dchar_is_case_ignorable(const char32_t c) noexcept { return (dchar_casing_record(c).flags & casing_flag_case_ignorable) != 0u; }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr bool dchar_is_soft_dotted(const char32_t c) noexcept { return (dchar_casing_record(c).flags & casing_flag_soft_dotted) != 0u; }
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr char32_t dchar_to_lower_simple(const char32_t c) noexcept { return _as(_as(c, int_least32_t) + dchar_casing_record(c).lower_delta, char32_t); }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr char32_t dchar_to_upper_simple(const char32_t c) noexcept { return _as(_as(c, int_least32_t) + dchar_casing_record(c).upper_delta, char32_t); }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr char32_t dchar_fold_simple(const char32_t c) noexcept { return _as(_as(c, int_least32_t) + dchar_casing_record(c).fold_delta, char32_t); }
+
+                    """
+                ),
+                "    ",
+            )
         )
-        f.write("\n")
 
         def write_special_mapping(
             name: str,
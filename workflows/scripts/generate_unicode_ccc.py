@@ -1,13 +1,20 @@
 import os
 import sys
 from textwrap import dedent
-from typing import List, Dict
+from typing import Dict, List
 
 sys.path.append(os.path.abspath(f"{os.path.dirname(__file__)}/.."))
 
 import lib.config as config
 from lib.log import lcheck_passed, lprint
-from lib.uni import to_cxx_u32_literal, write_header
+from lib.uni import (
+    TwoStageTable,
+    build_two_stage_table,
+    cxx_uint_type,
+    to_cxx_u32_literal,
+    write_cxx_array,
+    write_header,
+)
 
 script_dir: str = os.path.dirname(os.path.abspath(__file__))
 ucd_dir: str = os.path.abspath(f"{script_dir}/../../sys.Text/data_unicode/ucd")
@@ -66,8 +73,11 @@ def main(argv: List[str]) -> None:
         f.write(
             dedent(
                 """\
+                #include <cstddef>
                 #include <cstdint>
 
+                #include <LanguageSupport.h>
+
                 namespace sys
                 {
                     /// @ingroup sys_text
@@ -80,40 +90,57 @@ def main(argv: List[str]) -> None:
         for val in range(0, 256):
             name = ccc_names.get(val, f"ccc{val}")
             f.write(f"        {name} = {val}u,\n")
+        table: TwoStageTable = build_two_stage_table(ccc_map)
         f.write(
             dedent(
-                """\
-                    };
-                } // namespace sys
+                f"""\
+                    }};
+                }} // namespace sys
 
-                // NOLINTBEGIN(bugprone-branch-clone, readability-function-size)
+                // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
 
                 namespace sys::internal
-                {
+                {{
                     /// @internal
                     /// @ingroup sys_internal
-                    constexpr sys::canonical_combining_class dchar_ccc(const char32_t c) noexcept
-                    {
-                        switch (c)
-                        {
+                    inline constexpr size_t ccc_shift = {table.shift}uz;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr char32_t ccc_limit = {to_cxx_u32_literal(hex(table.limit)[2:].upper())};
+
+                    // clang-format off
                 """
             )
         )
-        for cp, ccc in sorted(ccc_map.items()):
-            cp_lit: str = to_cxx_u32_literal(hex(cp)[2:].upper())
-            name = ccc_names.get(ccc, f"ccc{ccc}")
-            f.write(
-                f"        case {cp_lit}: return sys::canonical_combining_class::{name};\n"
-            )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage1)),
+            "ccc_stage1",
+            [f"{v}u" for v in table.stage1],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage2)),
+            "ccc_stage2",
+            [f"{v}u" for v in table.stage2],
+        )
         f.write(
             dedent(
                 """\
-                        default: return sys::canonical_combining_class::not_reordered;
-                        }
+                    // clang-format on
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr sys::canonical_combining_class dchar_ccc(const char32_t c) noexcept
+                    {
+                        if (c >= ccc_limit)
+                            return sys::canonical_combining_class::not_reordered;
+                        const size_t block = ccc_stage1[c >> ccc_shift];
+                        return _as(ccc_stage2[(block << ccc_shift) | (c & ((1uz << ccc_shift) - 1uz))], sys::canonical_combining_class);
                     }
                 } // namespace sys::internal
 
-                // NOLINTEND(bugprone-branch-clone, readability-function-size)
+                // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
                 """
             )
         )
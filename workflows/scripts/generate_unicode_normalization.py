@@ -0,0 +1,357 @@
+import os
+import sys
+from textwrap import dedent, indent
+from typing import Dict, List, Set, Tuple
+
+sys.path.append(os.path.abspath(f"{os.path.dirname(__file__)}/.."))
+
+import lib.config as config
+from lib.log import lcheck_passed, lprint
+from lib.uni import (
+    TwoStageTable,
+    build_two_stage_table,
+    cxx_uint_type,
+    to_cxx_u32_literal,
+    write_cxx_array,
+    write_header,
+)
+
+script_dir: str = os.path.dirname(os.path.abspath(__file__))
+ucd_dir: str = os.path.abspath(f"{script_dir}/../../sys.Text/data_unicode/ucd")
+unicode_data_path: str = os.path.abspath(f"{ucd_dir}/UnicodeData.txt")
+composition_exclusions_path: str = os.path.abspath(
+    f"{ucd_dir}/CompositionExclusions.txt"
+)
+
+output_path: str = os.path.abspath(
+    f"{script_dir}/../../sys.Text/data/UnicodeNormalization.h"
+)
+
+# Hangul syllables are decomposed and composed algorithmically, see the Unicode Standard, section 3.12.
+HANGUL_S_BASE = 0xAC00
+HANGUL_S_COUNT = 11172
+HANGUL_V_FIRST, HANGUL_V_LAST = 0x1161, 0x1175
+HANGUL_T_FIRST, HANGUL_T_LAST = 0x11A8, 0x11C2
+
+# Bits of `normalization_record::flags`, the quick check properties of UAX #15.
+NORMALIZATION_FLAG_NFD_NO = 0x1
+NORMALIZATION_FLAG_NFKD_NO = 0x2
+NORMALIZATION_FLAG_NFC_NO = 0x4
+NORMALIZATION_FLAG_NFC_MAYBE = 0x8
+NORMALIZATION_FLAG_NFKC_NO = 0x10
+NORMALIZATION_FLAG_NFKC_MAYBE = 0x20
+
+
+def parse_unicode_data(
+    path: str,
+) -> Tuple[Dict[int, int], Dict[int, List[int]], Dict[int, List[int]]]:
+    """Parse combining classes, and canonical and compatibility decomposition mappings, from `UnicodeData.txt`."""
+
+    ccc: Dict[int, int] = {}
+    canonical: Dict[int, List[int]] = {}
+    compat: Dict[int, List[int]] = {}
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            parts: List[str] = line.split(";")
+            if len(parts) < 6:
+                continue
+            cp: int = int(parts[0], 16)
+            if int(parts[3]) != 0:
+                ccc[cp] = int(parts[3])
+
+            decomposition: List[str] = parts[5].split()
+            if not decomposition:
+                continue
+            if decomposition[0].startswith("<"):
+                compat[cp] = [int(v, 16) for v in decomposition[1:]]
+            else:
+                canonical[cp] = [int(v, 16) for v in decomposition]
+    return ccc, canonical, compat
+
+
+def parse_composition_exclusions(path: str) -> Set[int]:
+    """Parse the script-specific and post composition version exclusions from `CompositionExclusions.txt`."""
+
+    points: Set[int] = set()
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            if ".." in line:
+                start, end = line.split("..")
+                points.update(range(int(start, 16), int(end, 16) + 1))
+            else:
+                points.add(int(line, 16))
+    return points
+
+
+def full_decomposition(
+    cp: int, canonical: Dict[int, List[int]], compat: Dict[int, List[int]] | None
+) -> List[int]:
+    """Recursively apply decomposition mappings to `cp`, compatibility ones too if `compat` is given."""
+
+    mapping: List[int] | None = canonical.get(cp)
+    if mapping is None and compat is not None:
+        mapping = compat.get(cp)
+    if mapping is None:
+        return [cp]
+    ret: List[int] = []
+    for v in mapping:
+        ret.extend(full_decomposition(v, canonical, compat))
+    return ret
+
+
+def main(argv: List[str]) -> None:
+    config.check_name = "scripts:generate_unicode_normalization"
+
+    ccc, canonical, compat = parse_unicode_data(unicode_data_path)
+    exclusions: Set[int] = parse_composition_exclusions(composition_exclusions_path)
+
+    # Full composition exclusions are the listed exclusions, singletons, and non-starter decompositions, none of which recompose.
+    compositions: Dict[Tuple[int, int], int] = {}
+    full_exclusions: Set[int] = set()
+    for cp, mapping in canonical.items():
+        if (
+            cp in exclusions
+            or len(mapping) == 1
+            or ccc.get(cp, 0) != 0
+            or ccc.get(mapping[0], 0) != 0
+        ):
+            full_exclusions.add(cp)
+        else:
+            assert len(mapping) == 2
+            compositions[(mapping[0], mapping[1])] = cp
+    combining_seconds: Set[int] = {second for (_, second) in compositions}
+    combining_seconds.update(range(HANGUL_V_FIRST, HANGUL_V_LAST + 1))
+    combining_seconds.update(range(HANGUL_T_FIRST, HANGUL_T_LAST + 1))
+
+    # Full decompositions share one pool, where identical sequences are stored once.
+    pool: List[int] = []
+    pool_indices: Dict[Tuple[int, ...], int] = {}
+
+    def pooled(seq: List[int]) -> int:
+        key: Tuple[int, ...] = tuple(seq)
+        if key not in pool_indices:
+            pool_indices[key] = len(pool)
+            pool.extend(seq)
+        return pool_indices[key]
+
+    records: Dict[Tuple[int, int, int, int, int], int] = {(0, 0, 0, 0, 0): 0}
+    record_indices: Dict[int, int] = {}
+    for cp in sorted(
+        set(canonical)
+        | set(compat)
+        | combining_seconds
+        | set(range(HANGUL_S_BASE, HANGUL_S_BASE + HANGUL_S_COUNT))
+    ):
+        canonical_seq: List[int] = []
+        compat_seq: List[int] = []
+        if HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT:
+            flags: int = NORMALIZATION_FLAG_NFD_NO | NORMALIZATION_FLAG_NFKD_NO
+        else:
+            if cp in canonical:
+                canonical_seq = full_decomposition(cp, canonical, None)
+            if cp in canonical or cp in compat:
+                compat_seq = full_decomposition(cp, canonical, compat)
+
+            flags = 0
+            if canonical_seq:
+                flags |= NORMALIZATION_FLAG_NFD_NO
+            if compat_seq:
+                flags |= NORMALIZATION_FLAG_NFKD_NO
+            if cp in full_exclusions:
+                flags |= NORMALIZATION_FLAG_NFC_NO | NORMALIZATION_FLAG_NFKC_NO
+            elif compat_seq and compat_seq != (canonical_seq or [cp]):
+                flags |= NORMALIZATION_FLAG_NFKC_NO
+            if cp in combining_seconds:
+                if not flags & NORMALIZATION_FLAG_NFC_NO:
+                    flags |= NORMALIZATION_FLAG_NFC_MAYBE
+                if not flags & NORMALIZATION_FLAG_NFKC_NO:
+                    flags |= NORMALIZATION_FLAG_NFKC_MAYBE
+
+        record: Tuple[int, int, int, int, int] = (
+            pooled(canonical_seq) if canonical_seq else 0,
+            len(canonical_seq),
+            pooled(compat_seq) if compat_seq else 0,
+            len(compat_seq),
+            flags,
+        )
+        record_indices[cp] = records.setdefault(record, len(records))
+    table: TwoStageTable = build_two_stage_table(record_indices)
+    assert len(pool) <= 0xFFFF
+
+    os.makedirs(os.path.dirname(output_path), exist_ok=True)
+    with open(output_path, "w", encoding="utf-8") as f:
+        f.write("#pragma once\n\n")
+        write_header(f, os.path.basename(output_path), __file__)
+        f.write(
+            dedent(
+                f"""\
+                #include <cstddef>
+                #include <cstdint>
+                #include <iterator>
+                #include <string_view>
+
+                #include <LanguageSupport.h>
+
+                // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+                namespace sys::internal
+                {{
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Normalization properties shared by a set of codepoints.
+                    /// @details Decompositions are full, already applied recursively, and index `normalization_decompositions`.
+                    struct normalization_record
+                    {{
+                        uint_least16_t canonical_offset;
+                        uint_least8_t canonical_size;
+                        uint_least16_t compat_offset;
+                        uint_least8_t compat_size;
+                        uint_least8_t flags;
+                    }};
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Primary composite `composite` of the canonical pair `first`, `second`.
+                    struct normalization_composition
+                    {{
+                        char32_t first;
+                        char32_t second;
+                        char32_t composite;
+                    }};
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t normalization_flag_nfd_no = {hex(NORMALIZATION_FLAG_NFD_NO)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t normalization_flag_nfkd_no = {hex(NORMALIZATION_FLAG_NFKD_NO)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t normalization_flag_nfc_no = {hex(NORMALIZATION_FLAG_NFC_NO)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t normalization_flag_nfc_maybe = {hex(NORMALIZATION_FLAG_NFC_MAYBE)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t normalization_flag_nfkc_no = {hex(NORMALIZATION_FLAG_NFKC_NO)}u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t normalization_flag_nfkc_maybe = {hex(NORMALIZATION_FLAG_NFKC_MAYBE)}u;
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr size_t normalization_shift = {table.shift}uz;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr char32_t normalization_limit = {to_cxx_u32_literal(hex(table.limit)[2:].upper())};
+
+                    // clang-format off
+                """
+            )
+        )
+        write_cxx_array(
+            f,
+            "normalization_record",
+            "normalization_records",
+            [
+                f"{{ {co}u, {cs}u, {ko}u, {ks}u, {hex(flags)}u }}"
+                for (co, cs, ko, ks, flags) in records
+            ],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage1)),
+            "normalization_stage1",
+            [f"{v}u" for v in table.stage1],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage2)),
+            "normalization_stage2",
+            [f"{v}u" for v in table.stage2],
+        )
+        write_cxx_array(
+            f,
+            "char32_t",
+            "normalization_decompositions",
+            [to_cxx_u32_literal(hex(v)[2:].upper()) for v in pool],
+        )
+        write_cxx_array(
+            f,
+            "normalization_composition",
+            "normalization_compositions",
+            [
+                f"{{ {to_cxx_u32_literal(hex(a)[2:].upper())}, {to_cxx_u32_literal(hex(b)[2:].upper())}, {to_cxx_u32_literal(hex(c)[2:].upper())} }}"
+                for (a, b), c in sorted(compositions.items())
+            ],
+        )
+        f.write(
+            indent(
+                dedent(
+                    """\
+                    // clang-format on
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Normalization properties of `c`.
+                    /// @note Hangul syllables have no decomposition stored, they're decomposed algorithmically.
+                    constexpr const normalization_record& dchar_normalization_record(const char32_t c) noexcept
+                    {
+                        if (c >= normalization_limit)
+                            return normalization_records[0];
+                        const size_t block = normalization_stage1[c >> normalization_shift];
+                        return normalization_records[normalization_stage2[(block << normalization_shift) | (c & ((1uz << normalization_shift) - 1uz))]];
+                    }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Full canonical, or with `compat` compatibility, decomposition of `c`, empty if `c` decomposes to itself.
+                    constexpr std::u32string_view dchar_decomposition(const char32_t c, const bool compat) noexcept
+                    {
+                        const normalization_record& record = dchar_normalization_record(c);
+                        if (compat)
+                            return std::u32string_view(normalization_decompositions + record.compat_offset, record.compat_size);
+                        return std::u32string_view(normalization_decompositions + record.canonical_offset, record.canonical_size);
+                    }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Primary composite of `first` and `second`, or U+0000 if there is none.
+                    /// @note Hangul syllables aren't included, they're composed algorithmically.
+                    constexpr char32_t dchar_compose(const char32_t first, const char32_t second) noexcept
+                    {
+                        size_t lo = 0uz, hi = std::size(normalization_compositions);
+                        while (lo < hi)
+                        {
+                            const size_t mid = lo + (hi - lo) / 2uz;
+                            const normalization_composition& at = normalization_compositions[mid];
+                            if (at.first < first || (at.first == first && at.second < second))
+                                lo = mid + 1uz;
+                            else
+                                hi = mid;
+                        }
+                        if (lo < std::size(normalization_compositions) && normalization_compositions[lo].first == first && normalization_compositions[lo].second == second)
+                            return normalization_compositions[lo].composite;
+                        return U'\\0';
+                    }
+                    """
+                ),
+                "    ",
+            )
+        )
+        f.write(
+            dedent(
+                """\
+                } // namespace sys::internal
+
+                // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                """
+            )
+        )
+
+    lprint(f"Successfully generated `{output_path}`.")
+    lcheck_passed()
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,301 @@
+import os
+import re
+import sys
+from textwrap import dedent, indent
+from typing import Dict, List, Set, Tuple
+
+sys.path.append(os.path.abspath(f"{os.path.dirname(__file__)}/.."))
+
+import lib.config as config
+from lib.log import lcheck_passed, lprint
+from lib.uni import (
+    TwoStageTable,
+    build_two_stage_table,
+    cxx_uint_type,
+    to_cxx_u32_literal,
+    write_cxx_array,
+    write_header,
+)
+
+script_dir: str = os.path.dirname(os.path.abspath(__file__))
+ucd_dir: str = os.path.abspath(f"{script_dir}/../../sys.Text/data_unicode/ucd")
+grapheme_break_path: str = os.path.abspath(
+    f"{ucd_dir}/auxiliary/GraphemeBreakProperty.txt"
+)
+word_break_path: str = os.path.abspath(f"{ucd_dir}/auxiliary/WordBreakProperty.txt")
+emoji_data_path: str = os.path.abspath(f"{ucd_dir}/emoji/emoji-data.txt")
+derived_core_props_path: str = os.path.abspath(f"{ucd_dir}/DerivedCoreProperties.txt")
+
+output_path: str = os.path.abspath(
+    f"{script_dir}/../../sys.Text/data/UnicodeSegmentation.h"
+)
+
+# Property values, in the order of their C++ enumerators. The first of each is the default.
+GRAPHEME_BREAK_VALUES: List[str] = [
+    "Other",
+    "CR",
+    "LF",
+    "Control",
+    "Extend",
+    "ZWJ",
+    "Regional_Indicator",
+    "Prepend",
+    "SpacingMark",
+    "L",
+    "V",
+    "T",
+    "LV",
+    "LVT",
+]
+WORD_BREAK_VALUES: List[str] = [
+    "Other",
+    "CR",
+    "LF",
+    "Newline",
+    "Extend",
+    "ZWJ",
+    "Regional_Indicator",
+    "Format",
+    "Katakana",
+    "Hebrew_Letter",
+    "ALetter",
+    "Single_Quote",
+    "Double_Quote",
+    "MidNumLet",
+    "MidLetter",
+    "MidNum",
+    "Numeric",
+    "ExtendNumLet",
+    "WSegSpace",
+]
+INDIC_CONJUNCT_BREAK_VALUES: List[str] = ["None", "Consonant", "Extend", "Linker"]
+
+# Bits of `segmentation_record::flags`, above the Indic_Conjunct_Break value.
+SEGMENTATION_FLAG_EXTENDED_PICTOGRAPHIC = 0x4
+
+
+def cxx_enumerator(value: str) -> str:
+    """C++ enumerator name of a property value."""
+
+    return re.sub(r"(?<=[a-z])(?=[A-Z])", "_", value).lower()
+
+
+def parse_property_values(
+    path: str, property_name: str | None = None
+) -> Dict[int, str]:
+    """Parse `<range> ; <value>` lines, or `<range> ; <property_name> ; <value>` lines if `property_name` is given, matching values exactly."""
+
+    values: Dict[int, str] = {}
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+
+            parts: List[str] = [p.strip() for p in line.split(";")]
+            if property_name is None:
+                if len(parts) != 2:
+                    continue
+                value: str = parts[1]
+            else:
+                if len(parts) != 3 or parts[1] != property_name:
+                    continue
+                value = parts[2]
+
+            if ".." in parts[0]:
+                start, end = parts[0].split("..")
+                for cp in range(int(start, 16), int(end, 16) + 1):
+                    values[cp] = value
+            else:
+                values[int(parts[0], 16)] = value
+    return values
+
+
+def main(argv: List[str]) -> None:
+    config.check_name = "scripts:generate_unicode_segmentation"
+
+    grapheme_breaks: Dict[int, str] = parse_property_values(grapheme_break_path)
+    word_breaks: Dict[int, str] = parse_property_values(word_break_path)
+    incb: Dict[int, str] = parse_property_values(derived_core_props_path, "InCB")
+    extended_pictographic: Set[int] = {
+        cp
+        for cp, value in parse_property_values(emoji_data_path).items()
+        if value == "Extended_Pictographic"
+    }
+
+    # Pack every per-codepoint property into a deduplicated record, indexed by a two-stage table.
+    records: Dict[Tuple[int, int, int], int] = {(0, 0, 0): 0}
+    record_indices: Dict[int, int] = {}
+    for cp in sorted(
+        set(grapheme_breaks) | set(word_breaks) | set(incb) | extended_pictographic
+    ):
+        if cp > 0x10FFFF or 0xD800 <= cp <= 0xDFFF:
+            continue
+        flags: int = INDIC_CONJUNCT_BREAK_VALUES.index(incb.get(cp, "None")) | (
+            SEGMENTATION_FLAG_EXTENDED_PICTOGRAPHIC
+            if cp in extended_pictographic
+            else 0
+        )
+        record: Tuple[int, int, int] = (
+            GRAPHEME_BREAK_VALUES.index(grapheme_breaks.get(cp, "Other")),
+            WORD_BREAK_VALUES.index(word_breaks.get(cp, "Other")),
+            flags,
+        )
+        record_indices[cp] = records.setdefault(record, len(records))
+    table: TwoStageTable = build_two_stage_table(record_indices)
+
+    def cxx_enum(name: str, brief: str, values: List[str]) -> str:
+        enumerators: str = ",\n".join(f"    {cxx_enumerator(v)}" for v in values)
+        return f"/// @internal\n/// @ingroup sys_internal\n/// @brief {brief}\nenum class {name} : uint_least8_t\n{{\n{enumerators}\n}};\n"
+
+    os.makedirs(os.path.dirname(output_path), exist_ok=True)
+    with open(output_path, "w", encoding="utf-8") as f:
+        f.write("#pragma once\n\n")
+        write_header(f, os.path.basename(output_path), __file__)
+        f.write(
+            dedent(
+                """\
+                #include <cstddef>
+                #include <cstdint>
+
+                #include <LanguageSupport.h>
+
+                // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+
+                namespace sys::internal
+                {
+                """
+            )
+        )
+        f.write(
+            indent(
+                cxx_enum(
+                    "grapheme_break",
+                    "Unicode Grapheme_Cluster_Break property, see UAX #29.",
+                    GRAPHEME_BREAK_VALUES,
+                )
+                + cxx_enum(
+                    "word_break",
+                    "Unicode Word_Break property, see UAX #29.",
+                    WORD_BREAK_VALUES,
+                )
+                + cxx_enum(
+                    "indic_conjunct_break",
+                    "Unicode Indic_Conjunct_Break property, see UAX #29.",
+                    INDIC_CONJUNCT_BREAK_VALUES,
+                ),
+                "    ",
+            )
+        )
+        f.write(
+            indent(
+                dedent(
+                    f"""\
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Segmentation properties shared by a set of codepoints.
+                    struct segmentation_record
+                    {{
+                        uint_least8_t grapheme;
+                        uint_least8_t word;
+                        uint_least8_t flags;
+                    }};
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t segmentation_flag_incb_mask = 0x3u;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr uint_least8_t segmentation_flag_extended_pictographic = {hex(SEGMENTATION_FLAG_EXTENDED_PICTOGRAPHIC)}u;
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr size_t segmentation_shift = {table.shift}uz;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr char32_t segmentation_limit = {to_cxx_u32_literal(hex(table.limit)[2:].upper())};
+
+                    // clang-format off
+                    """
+                ),
+                "    ",
+            )
+        )
+        write_cxx_array(
+            f,
+            "segmentation_record",
+            "segmentation_records",
+            [
+                f"{{ {grapheme}u, {word}u, {hex(flags)}u }}"
+                for (grapheme, word, flags) in records
+            ],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage1)),
+            "segmentation_stage1",
+            [f"{v}u" for v in table.stage1],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage2)),
+            "segmentation_stage2",
+            [f"{v}u" for v in table.stage2],
+        )
+        f.write(
+            indent(
+                dedent(
+                    """\
+                    // clang-format on
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    /// @brief Segmentation properties of `c`.
+                    constexpr const segmentation_record& dchar_segmentation_record(const char32_t c) noexcept
+                    {
+                        if (c >= segmentation_limit)
+                            return segmentation_records[0];
+                        const size_t block = segmentation_stage1[c >> segmentation_shift];
+                        return segmentation_records[segmentation_stage2[(block << segmentation_shift) | (c & ((1uz << segmentation_shift) - 1uz))]];
+                    }
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr grapheme_break dchar_grapheme_break(const char32_t c) noexcept { return _as(dchar_segmentation_record(c).grapheme, grapheme_break); }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr word_break dchar_word_break(const char32_t c) noexcept { return _as(dchar_segmentation_record(c).word, word_break); }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr indic_conjunct_break dchar_indic_conjunct_break(const char32_t c) noexcept
+                    {
+                        return _as(dchar_segmentation_record(c).flags & segmentation_flag_incb_mask, indic_conjunct_break);
+                    }
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr bool dchar_is_extended_pictographic(const char32_t c) noexcept
+                    {
+                        return (dchar_segmentation_record(c).flags & segmentation_flag_extended_pictographic) != 0u;
+                    }
+                    """
+                ),
+                "    ",
+            )
+        )
+        f.write(
+            dedent(
+                """\
+                } // namespace sys::internal
+
+                // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+                """
+            )
+        )
+
+    lprint(f"Successfully generated `{output_path}`.")
+    lcheck_passed()
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -1,13 +1,21 @@
 import os
 import sys
-from typing import List
 from textwrap import dedent
+from typing import List
 
 sys.path.append(os.path.abspath(f"{os.path.dirname(__file__)}/.."))
 
 import lib.config as config
 from lib.log import lcheck_passed, lprint
-from lib.uni import to_cxx_u32_literal, write_header, parse_codepoints
+from lib.uni import (
+    TwoStageTable,
+    build_two_stage_table,
+    cxx_uint_type,
+    parse_codepoints,
+    to_cxx_u32_literal,
+    write_cxx_array,
+    write_header,
+)
 
 proplist_path = os.path.abspath(
     f"{os.path.dirname(os.path.abspath(__file__))}/../../sys.Text/data_unicode/ucd/PropList.txt"
@@ -26,34 +34,59 @@ def main(argv: List[str]) -> None:
     with open(output_path, "w", encoding="utf-8") as f:
         f.write("#pragma once\n\n")
         write_header(f, os.path.basename(output_path), __file__)
+        table: TwoStageTable = build_two_stage_table(
+            {cp: 1 for cp in whitespace_codepoints}
+        )
         f.write(
             dedent(
-                """\
-                // NOLINTBEGIN(bugprone-branch-clone)
+                f"""\
+                #include <cstddef>
+                #include <cstdint>
+
+                // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
 
                 namespace sys::internal
-                {
+                {{
                     /// @internal
                     /// @ingroup sys_internal
-                    constexpr bool dchar_is_ws(const char32_t c) noexcept
-                    {
-                        switch (c)
-                        {
+                    inline constexpr size_t ws_shift = {table.shift}uz;
+                    /// @internal
+                    /// @ingroup sys_internal
+                    inline constexpr char32_t ws_limit = {to_cxx_u32_literal(hex(table.limit)[2:].upper())};
+
+                    // clang-format off
                 """
             )
         )
-        for cp in sorted(whitespace_codepoints):
-            cp_hex = hex(cp)[2:].upper()
-            f.write(f"        case {to_cxx_u32_literal(cp_hex)}: return true;\n")
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage1)),
+            "ws_stage1",
+            [f"{v}u" for v in table.stage1],
+        )
+        write_cxx_array(
+            f,
+            cxx_uint_type(max(table.stage2)),
+            "ws_stage2",
+            [f"{v}u" for v in table.stage2],
+        )
         f.write(
             dedent(
                 """\
-                        default: return false;
-                        }
+                    // clang-format on
+
+                    /// @internal
+                    /// @ingroup sys_internal
+                    constexpr bool dchar_is_ws(const char32_t c) noexcept
+                    {
+                        if (c >= ws_limit)
+                            return false;
+                        const size_t block = ws_stage1[c >> ws_shift];
+                        return ws_stage2[(block << ws_shift) | (c & ((1uz << ws_shift) - 1uz))] != 0u;
                     }
                 } // namespace sys::internal
 
-                // NOLINTEND(bugprone-branch-clone)
+                // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
                 """
             )
         )